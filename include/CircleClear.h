@@ -0,0 +1,103 @@
+/**
+ * CircleClear - ガラスの円の消去を DMA で流せる区間に分ける
+ *
+ * renderGlass() の最初の消去（fillCircle(CENTER_X, CENTER_Y, radius, 黒)）と
+ * 同じ画素の集合（GlassRaster.h の rasterFillCircle）を行ごとの区間にしておき、
+ * 各行を「align バイト境界にそろえた中ほど」と「両端の半端」に分ける。
+ * 中ほどは issue() でコピー関数（端末では非同期DMA、ホストでは memcpy）に渡し、
+ * 両端は DMA の完了後に finish() で CPU が消す。消し終えたら renderGlass() に
+ * cleared = true を渡して消去を飛ばす。
+ *
+ * PSRAM へ DMA で書くには宛先と長さを align（キャッシュ行）にそろえる必要があるので、
+ * 分け方はバッファのアドレスで決まる（issue と finish に同じバッファを渡すこと）。
+ * Arduino非依存。
+ */
+#pragma once
+
+#include "GlassEngine.h"
+#include "GlassRaster.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class CircleClear {
+public:
+  CircleClear(int radius, int align) : align(align) {
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+      spanX0[y] = 0;
+      spanX1[y] = 0;
+    }
+    // 同じ行に何度か来る（幅の違う区間）ので、いちばん広いものを取る
+    rasterFillCircle(CENTER_X, CENTER_Y, radius, [this](int x, int y, int len) {
+      if (y < 0 || y >= SCREEN_HEIGHT || len <= 0) return;
+      int x0 = x < 0 ? 0 : x;
+      int x1 = x + len > SCREEN_WIDTH ? SCREEN_WIDTH : x + len;
+      if (spanX0[y] == spanX1[y]) {
+        spanX0[y] = (int16_t)x0;
+        spanX1[y] = (int16_t)x1;
+      } else {
+        if (x0 < spanX0[y]) spanX0[y] = (int16_t)x0;
+        if (x1 > spanX1[y]) spanX1[y] = (int16_t)x1;
+      }
+    });
+  }
+
+  // コピー元に使う 0 の並びに必要なバイト数（いちばん長い行）
+  static size_t zeroBytes() { return SCREEN_WIDTH * sizeof(uint16_t); }
+
+  // 各行の中ほどを copy(dst, bytes) で渡す。渡した区間の数を返す
+  template <typename Copy>
+  int issue(uint16_t* buf, int width, Copy copy) const {
+    int count = 0;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+      int a, b;
+      if (!middle(buf, width, y, a, b)) continue;
+      copy(buf + y * width + a, (size_t)(b - a) * sizeof(uint16_t));
+      count++;
+    }
+    return count;
+  }
+
+  // issue() で渡さなかった両端（と中ほどの取れない短い行）を消す
+  void finish(uint16_t* buf, int width) const {
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+      uint16_t* row = buf + y * width;
+      int a, b;
+      if (!middle(buf, width, y, a, b)) {
+        fill(row, spanX0[y], spanX1[y]);
+        continue;
+      }
+      fill(row, spanX0[y], a);
+      fill(row, b, spanX1[y]);
+    }
+  }
+
+  // 全部を CPU で消す（DMA が使えないとき）
+  void clear(uint16_t* buf, int width) const {
+    for (int y = 0; y < SCREEN_HEIGHT; y++) fill(buf + y * width, spanX0[y], spanX1[y]);
+  }
+
+private:
+  int align;                        // DMA の宛先と長さのそろえ（バイト、2の累乗）
+  int16_t spanX0[SCREEN_HEIGHT];    // 行ごとの消す区間 [x0, x1)（x0 == x1 なら空）
+  int16_t spanX1[SCREEN_HEIGHT];
+
+  // 行 y の区間のうち、アドレスと長さが align にそろう中ほど [a, b)
+  bool middle(const uint16_t* buf, int width, int y, int& a, int& b) const {
+    if (spanX0[y] == spanX1[y]) return false;
+    uintptr_t row = (uintptr_t)(buf + y * width);
+    uintptr_t first = row + spanX0[y] * sizeof(uint16_t);
+    uintptr_t last = row + spanX1[y] * sizeof(uint16_t);
+    first = (first + align - 1) & ~(uintptr_t)(align - 1);
+    last &= ~(uintptr_t)(align - 1);
+    if (last <= first) return false;
+    a = (int)((first - row) / sizeof(uint16_t));
+    b = (int)((last - row) / sizeof(uint16_t));
+    return true;
+  }
+
+  static void fill(uint16_t* row, int x0, int x1) {
+    if (x1 > x0) memset(row + x0, 0, (size_t)(x1 - x0) * sizeof(uint16_t));
+  }
+};
@@ -0,0 +1,121 @@
+/**
+ * CrackDecal - 画像のひび（デカール）の型押し
+ *
+ * 線で描くひび（GlassEngine::cracks）とは別に、衝撃の跡を画像で重ねる。
+ * 画像は tools/crack_decal_gen.cpp が写真（PGM）または手続き生成の模様から
+ * DECAL_ANGLES 通りの向きにあらかじめ回転して 4bpp（16階調）の不透明度にし、
+ * src/crack_decals.h としてフラッシュに置く。端末側は回転も補間もせず、
+ * 向きの番号で選んだ画像を行ごとにそのまま合成する（型押し）ので、
+ * 1枚のコストは画像の大きさだけで決まり、ひびの本数には依らない。
+ *
+ * 型押しの位置と向きは GlassEngine::decals（衝撃の中心の星形のひびと、
+ * 縁に当たった破片の欠け）。描画は clipRadius の円の内側だけ。
+ * フレームバッファへ直接書くので、Gfx は getBuffer / width / height を持ち、
+ * 画素をビッグエンディアンで持つこと（M5Canvas / SoftCanvas）。
+ */
+#pragma once
+
+#include "GlassEngine.h"
+#include "OverdrawHook.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+
+// ========================================
+// アトラスの形式（生成ヘッダと共通）
+// ========================================
+struct DecalImage {
+  uint8_t width;
+  uint8_t height;
+  uint32_t offset;    // bitmap 内の先頭（行ごとに (width + 1) / 2 バイト、上位ニブルが左）
+};
+
+// images[kind * DECAL_ANGLES + angle]。画像の中心が型押しの位置
+struct DecalAtlas {
+  const DecalImage* images;
+  const uint8_t* bitmap;
+};
+
+class DecalLayer {
+public:
+  DecalLayer(const DecalAtlas& atlas, int clipRadius) : atlas(atlas) {
+    const int r = clipRadius;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+      int dy = y - CENTER_Y;
+      clipHalfWidth[y] = dy * dy <= r * r ? (int16_t)sqrtf((float)(r * r - dy * dy)) : -1;
+    }
+  }
+
+  // engine.decals をすべて型押しする。color は RGB565、opacity は全体の不透明度（0 ~ 255）
+  template <typename Gfx>
+  void draw(Gfx& gfx, const std::vector<CrackDecal>& decals, uint16_t color, uint8_t opacity) {
+    for (const CrackDecal& d : decals) {
+      int alpha = (int)(d.alpha * opacity);
+      if (alpha <= 0) continue;
+      stamp(gfx, d.kind, d.angle, (int)d.x, (int)d.y, color, (uint8_t)(alpha > 255 ? 255 : alpha));
+    }
+  }
+
+  // 1枚を中心 (x, y) に型押しする
+  template <typename Gfx>
+  void stamp(Gfx& gfx, int kind, int angle, int x, int y, uint16_t color, uint8_t opacity) {
+    const DecalImage& image = atlas.images[kind * DECAL_ANGLES + angle];
+    const uint8_t* bitmap = atlas.bitmap + image.offset;
+    const int stride = (image.width + 1) / 2;
+    const int left = x - image.width / 2;
+    const int top = y - image.height / 2;
+
+    // 16階調ごとの合成率（0 ~ 32）をこの型押しの不透明度で先に求めておく
+    uint8_t alphaFor[16];
+    for (int a = 0; a < 16; a++) alphaFor[a] = (uint8_t)((a * opacity * 32 + (15 * 255) / 2) / (15 * 255));
+    const uint32_t fgExpanded = (color | ((uint32_t)color << 16)) & 0x07E0F81F;
+
+    uint16_t* buf = (uint16_t*)gfx.getBuffer();
+    const int width = gfx.width();
+    int rowFirst = top < 0 ? -top : 0;
+    int rowLast = top + image.height > SCREEN_HEIGHT ? SCREEN_HEIGHT - top : image.height;
+    for (int row = rowFirst; row < rowLast; row++) {
+      int py = top + row;
+      int half = clipHalfWidth[py];
+      if (half < 0) continue;
+      int colFirst = CENTER_X - half - left;
+      int colLast = CENTER_X + half + 1 - left;
+      if (colFirst < 0) colFirst = 0;
+      if (colLast > image.width) colLast = image.width;
+
+      const uint8_t* src = bitmap + row * stride;
+      uint16_t* dst = buf + py * width + left;
+      int col = colFirst;
+      if ((col & 1) && col < colLast) {
+        if (blendPixel(dst + col, fgExpanded, alphaFor[src[col >> 1] & 0x0F])) countSpan(gfx, left + col, py, 1);
+        col++;
+      }
+      // 2画素（1バイト）ずつ。透明なバイトは読むだけで飛ばす
+      for (; col + 1 < colLast; col += 2) {
+        uint8_t pair = src[col >> 1];
+        if (pair == 0) continue;
+        if (blendPixel(dst + col, fgExpanded, alphaFor[pair >> 4])) countSpan(gfx, left + col, py, 1);
+        if (blendPixel(dst + col + 1, fgExpanded, alphaFor[pair & 0x0F])) countSpan(gfx, left + col + 1, py, 1);
+      }
+      if (col < colLast && blendPixel(dst + col, fgExpanded, alphaFor[src[col >> 1] >> 4])) {
+        countSpan(gfx, left + col, py, 1);
+      }
+    }
+  }
+
+private:
+  DecalAtlas atlas;
+  int16_t clipHalfWidth[SCREEN_HEIGHT];  // 描画範囲の行ごとの半幅（なければ -1）
+
+  // ビッグエンディアンの画素 1つへの合成（alpha は 0 ~ 32）。書いたら true
+  static bool blendPixel(uint16_t* dst, uint32_t fgExpanded, uint32_t alpha) {
+    if (alpha == 0) return false;
+    uint16_t bg = (uint16_t)((*dst >> 8) | (*dst << 8));
+    uint32_t bgExpanded = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+    uint32_t mixed = ((((fgExpanded - bgExpanded) * alpha) >> 5) + bgExpanded) & 0x07E0F81F;
+    uint16_t out = (uint16_t)(mixed | (mixed >> 16));
+    *dst = (uint16_t)((out >> 8) | (out << 8));
+    return true;
+  }
+};
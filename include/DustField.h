@@ -0,0 +1,220 @@
+/**
+ * DustField - 粉塵の密度グリッド描画
+ *
+ * 粉塵（GlassEngine::dust）を1粒ずつ描くのではなく、画面の半分の解像度
+ * （120x120）の密度グリッドへ双一次の重みで整数加算（splat）し、
+ * トーンマップの表を通して2倍に拡大しながらフレームバッファへ加算合成する。
+ * 合成のコストはグリッドの大きさで決まり、粒の数には依らない。
+ *
+ * グリッドは LANES 枚あり、粒の列を分けて別々のコアで splat できる
+ * （端末では core 0 の作業タスクと loop() で半分ずつ）。composite() で合算する。
+ * 流体で運ぶ細かい粉（GlassEngine::fluid の密度）も splatFluid() で同じグリッドに
+ * 加えるので、粒と粉は同じトーンマップで一緒に描かれる。
+ * ホスト側ツールは prepare() で1枚にまとめて splat すればよい。
+ *
+ * 万華鏡モード（mirrorSector）では粒は扇形の中にしかないので、辺の近くの粒は
+ * 辺の向こうの鏡像も splat する（しないと辺の外へ広がった分だけ辺沿いが暗くなる）。
+ * 扇形の外は Kaleidoscope.h が上書きするので、流体の splat と合成は扇形の近くだけ行う。
+ *
+ * 合成はフレームバッファへ直接書くので、Gfx は getBuffer / width / height を持ち、
+ * 画素をビッグエンディアンで持つこと（M5Canvas / SoftCanvas）。
+ * 描画は clipRadius の円の内側だけ（縁のゲージを上書きしないため）。
+ */
+#pragma once
+
+#include "GlassEngine.h"
+#include "OverdrawHook.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+const int DUST_GRID = 120;
+const int DUST_SCALE = SCREEN_WIDTH / DUST_GRID;
+const int DUST_FRACTION_BITS = 4;   // セル内の位置を16段階で持つ（1粒の重みの合計は 256）
+
+class DustField {
+public:
+  static const int LANES = 2;
+
+  explicit DustField(int clipRadius) {
+    for (int lane = 0; lane < LANES; lane++) grids[lane].assign(DUST_GRID * DUST_GRID, 0);
+    toned.assign(DUST_GRID * DUST_GRID, 0);
+    buildTables(clipRadius);
+  }
+
+  void clear(int lane) { memset(grids[lane].data(), 0, grids[lane].size() * sizeof(uint32_t)); }
+
+  bool mirrorSector = false;   // 万華鏡モード（GlassConfig::kaleidoscope と合わせる）
+
+  // motes[0, count) を lane のグリッドへ加算する。lane ごとに別スレッドから呼んでよい
+  void splat(int lane, const DustMote* motes, int count) {
+    uint32_t* grid = grids[lane].data();
+    for (int i = 0; i < count; i++) {
+      splatPoint(grid, motes[i].x, motes[i].y);
+      if (mirrorSector) splatEdgeMirrors(grid, motes[i].x, motes[i].y);
+    }
+  }
+
+  // 流体の密度（1.0 = 1粒分 / 流体セル）をこのグリッドの解像度で lane に加える
+  void splatFluid(int lane, const GlassFluid& fluid) {
+    uint32_t* grid = grids[lane].data();
+    float weight = 256.0f * DUST_SCALE * DUST_SCALE / (fluid.cellSize * fluid.cellSize);
+    for (int gy = firstCell(CENTER_Y); gy < DUST_GRID; gy++) {
+      if (clipHalfWidth[gy * DUST_SCALE] < 0) continue;
+      for (int gx = firstCell(CENTER_X); gx < DUST_GRID; gx++) {
+        float d = fluid.densityAt((gx + 0.5f) * DUST_SCALE, (gy + 0.5f) * DUST_SCALE);
+        if (d > 0.0f) grid[gy * DUST_GRID + gx] += (uint32_t)(d * weight);
+      }
+    }
+  }
+
+  // ホスト用: 全グリッドを消して lane 0 にまとめて加算する
+  void prepare(const GlassEngine& engine) {
+    for (int lane = 0; lane < LANES; lane++) clear(lane);
+    if (engine.dustLevel <= 0.0f) return;
+    mirrorSector = engine.config.kaleidoscope;
+    if (engine.fluidActive) splatFluid(0, engine.fluid);
+    if (!engine.dust.empty()) splat(0, engine.dust.data(), (int)engine.dust.size());
+  }
+
+  // グリッドを合算・トーンマップし、2倍に拡大してフレームバッファへ加算する。
+  // level は全体の明るさ（GlassEngine::dustLevel）
+  template <typename Gfx>
+  void composite(Gfx& gfx, float level) {
+    if (level <= 0.0f) return;
+
+    // 密度 → トーン番号（グリッド解像度で一度だけ）
+    // 1粒が1セルにまるごと乗ると 32 * level
+    uint32_t exposure = (uint32_t)(level * 256);
+    int rowFirst = DUST_GRID, rowLast = -1;
+    for (int gy = firstCell(CENTER_Y); gy < DUST_GRID; gy++) {
+      bool any = false;
+      for (int gx = firstCell(CENTER_X); gx < DUST_GRID; gx++) {
+        int i = gy * DUST_GRID + gx;
+        uint32_t density = 0;
+        for (int lane = 0; lane < LANES; lane++) density += grids[lane][i];
+        uint32_t index = (uint32_t)(((uint64_t)density * exposure) >> 11);
+        toned[i] = toneLut[index > 255 ? 255 : index];
+        any |= toned[i] != 0;
+      }
+      if (any) {
+        if (rowFirst > gy) rowFirst = gy;
+        rowLast = gy;
+      }
+    }
+    if (rowLast < 0) return;
+
+    uint16_t* buf = (uint16_t*)gfx.getBuffer();
+    int width = gfx.width();
+
+    // 出力画素はグリッドの格子点から 1/4 または 3/4 の位置（3:1 の重み）
+    int yFirst = rowFirst * DUST_SCALE - 1;
+    int yLast = rowLast * DUST_SCALE + DUST_SCALE;
+    if (mirrorSector && yFirst < CENTER_Y) yFirst = CENTER_Y;
+    for (int y = yFirst < 0 ? 0 : yFirst; y <= yLast && y < SCREEN_HEIGHT; y++) {
+      int half = clipHalfWidth[y];
+      if (half < 0) continue;
+      int xFirst = CENTER_X - half;
+      if (mirrorSector) xFirst = CENTER_X + (int)((y - CENTER_Y) * 0.57735f);  // 扇形の左の辺（60度）
+      int gy0 = (y - 1) >> 1;
+      int gy1 = gy0 + 1;
+      uint32_t wy1 = (y & 1) ? 1 : 3;  // gy1 の重み
+      if (gy0 < 0) gy0 = 0;
+      if (gy1 >= DUST_GRID) gy1 = DUST_GRID - 1;
+      const uint8_t* row0 = toned.data() + gy0 * DUST_GRID;
+      const uint8_t* row1 = toned.data() + gy1 * DUST_GRID;
+      uint16_t* dst = buf + y * width;
+
+      for (int x = xFirst; x <= CENTER_X + half; x++) {
+        int gx0 = (x - 1) >> 1;
+        int gx1 = gx0 + 1;
+        uint32_t wx1 = (x & 1) ? 1 : 3;
+        if (gx0 < 0) gx0 = 0;
+        if (gx1 >= DUST_GRID) gx1 = DUST_GRID - 1;
+
+        uint32_t top = row0[gx0] * (4 - wx1) + row0[gx1] * wx1;
+        uint32_t bottom = row1[gx0] * (4 - wx1) + row1[gx1] * wx1;
+        uint32_t value = (top * (4 - wy1) + bottom * wy1) >> 4;
+        if (value == 0) continue;
+
+        uint16_t stored = dst[x];
+        uint16_t bg = (uint16_t)((stored >> 8) | (stored << 8));
+        uint16_t out = addSaturate565(bg, colorLut[value]);
+        dst[x] = (uint16_t)((out >> 8) | (out << 8));
+        countSpan(gfx, x, y, 1);
+      }
+    }
+  }
+
+private:
+  std::vector<uint32_t> grids[LANES];
+
+  // 描く範囲の最初のセル（万華鏡では扇形の外接矩形から。双一次の隣のセルも含める）
+  int firstCell(int center) const { return mirrorSector ? center / DUST_SCALE - 1 : 0; }
+
+  static void splatPoint(uint32_t* grid, float x, float y) {
+    const int fixedScale = (1 << DUST_FRACTION_BITS) / DUST_SCALE;
+    const int mask = (1 << DUST_FRACTION_BITS) - 1;
+
+    // セル中心を格子点とする固定小数点の位置
+    int fx = (int)(x * fixedScale) - (1 << DUST_FRACTION_BITS) / 2;
+    int fy = (int)(y * fixedScale) - (1 << DUST_FRACTION_BITS) / 2;
+    int cx = fx >> DUST_FRACTION_BITS;
+    int cy = fy >> DUST_FRACTION_BITS;
+    if (cx < 0 || cy < 0 || cx >= DUST_GRID - 1 || cy >= DUST_GRID - 1) return;
+
+    uint32_t wx = fx & mask;
+    uint32_t wy = fy & mask;
+    uint32_t ix = (1 << DUST_FRACTION_BITS) - wx;
+    uint32_t iy = (1 << DUST_FRACTION_BITS) - wy;
+    uint32_t* cell = grid + cy * DUST_GRID + cx;
+    cell[0] += ix * iy;
+    cell[1] += wx * iy;
+    cell[DUST_GRID] += ix * wy;
+    cell[DUST_GRID + 1] += wx * wy;
+  }
+
+  // 扇形（+x から 0 ~ 60度）の辺から 2セル以内の粒は、辺で折り返した位置にも置く
+  static void splatEdgeMirrors(uint32_t* grid, float x, float y) {
+    const float margin = 2.0f * DUST_SCALE;
+    const float ux = 0.5f, uy = 0.8660254f;
+    float dx = x - CENTER_X, dy = y - CENTER_Y;
+    if (dy < margin) splatPoint(grid, x, CENTER_Y - dy);
+    if (dx * uy - dy * ux < margin) {
+      float pu = dx * ux + dy * uy;
+      splatPoint(grid, CENTER_X + 2 * pu * ux - dx, CENTER_Y + 2 * pu * uy - dy);
+    }
+  }
+  std::vector<uint8_t> toned;
+  uint8_t toneLut[256];           // トーン番号 → 明るさ（1 - exp の飽和曲線）
+  uint16_t colorLut[256];         // 明るさ → 加算する色（RGB565）
+  int16_t clipHalfWidth[SCREEN_HEIGHT];  // 描画範囲の行ごとの半幅（なければ -1）
+
+  void buildTables(int clipRadius) {
+    for (int i = 0; i < 256; i++) {
+      toneLut[i] = (uint8_t)(255.0f * (1.0f - expf(-i / 64.0f)) + 0.5f);
+      // 青白い粉塵（R:G:B = 0.55 : 0.6 : 0.75）
+      uint16_t r = (uint16_t)(i * 0.55f * 31 / 255 + 0.5f);
+      uint16_t g = (uint16_t)(i * 0.6f * 63 / 255 + 0.5f);
+      uint16_t b = (uint16_t)(i * 0.75f * 31 / 255 + 0.5f);
+      colorLut[i] = (uint16_t)((r << 11) | (g << 5) | b);
+    }
+    const int r = clipRadius;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+      int dy = y - CENTER_Y;
+      clipHalfWidth[y] = dy * dy <= r * r ? (int16_t)sqrtf((float)(r * r - dy * dy)) : -1;
+    }
+  }
+
+  static uint16_t addSaturate565(uint16_t a, uint16_t b) {
+    uint32_t r = (a >> 11) + (b >> 11);
+    uint32_t g = ((a >> 5) & 0x3F) + ((b >> 5) & 0x3F);
+    uint32_t bl = (a & 0x1F) + (b & 0x1F);
+    if (r > 31) r = 31;
+    if (g > 63) g = 63;
+    if (bl > 31) bl = 31;
+    return (uint16_t)((r << 11) | (g << 5) | bl);
+  }
+};
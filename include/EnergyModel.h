@@ -0,0 +1,153 @@
+/**
+ * EnergyModel - 活動量からの消費電力の見積もりと、State・機能ごとの集計
+ *
+ * 電力は測らず、端末が数えられる活動量（EnergyActivity）に係数を掛けて足す。
+ *   基本（待機中の SoC・PSRAM・パネル）     baseMw × 時間
+ *   CPU（コアごとの処理時間）               coreActiveMw × 処理時間 × 周波数 / 240MHz
+ *   パネルへの SPI 転送                     spiNanojoulesPerByte × バイト数
+ *   バックライト                            backlightMw × 明るさ / 255 × 時間
+ *   スピーカー（アンプが鳴っている間）      speakerMw × 鳴っていた時間
+ * 係数はボードごとに違うので、-DGLASSDIAL_ENERGY_CALIBRATE の端末で負荷の段階を
+ * 順に流し、各段階の USB 電力計の値から tools/energy_calibrate.cpp で求める
+ * （src/energy_calibration.h を生成。なければ ENERGY_DEFAULT_COEFFICIENTS の目安）。
+ *
+ * 集計は起動からの累計で、State ごと・機能（EnergyFeature）の有無ごとに持つ。
+ * 「1時間あたりの mWh」は、その State（機能）の間の平均電力 [mW] と同じ値になる。
+ * 1日分を足しても桁が落ちないよう、累計は double で持つ。Arduino非依存。
+ */
+#pragma once
+
+#include "GlassEngine.h"
+
+#include <stdint.h>
+
+struct EnergyCoefficients {
+  float baseMw;                 // 何もしていないとき（バックライト消灯・CPU 待機・無音）
+  float coreActiveMw;           // 1コアが 240MHz で処理し続けたときの増分
+  float spiNanojoulesPerByte;   // パネルへ1バイト送る増分
+  float backlightMw;            // バックライト最大のときの増分（明るさに比例）
+  float speakerMw;              // スピーカーが鳴っている間の増分
+};
+
+// 校正前の目安（USB 5V 側、M5Dial の実測ではない）
+const EnergyCoefficients ENERGY_DEFAULT_COEFFICIENTS = {180.0f, 95.0f, 6.0f, 260.0f, 150.0f};
+
+const int ENERGY_CORES = 2;
+const float ENERGY_REFERENCE_MHZ = 240.0f;
+
+// ある区間の活動量
+struct EnergyActivity {
+  uint32_t elapsedMicros;
+  uint32_t coreBusyMicros[ENERGY_CORES];
+  uint32_t cpuMhz;
+  uint32_t spiBytes;
+  uint8_t backlight;            // 0 ~ 255
+  uint32_t speakerMicros;
+};
+
+// 区間のエネルギー [uJ] の内訳
+struct EnergyBreakdown {
+  double base;
+  double cpu;
+  double spi;
+  double backlight;
+  double speaker;
+
+  double total() const { return base + cpu + spi + backlight + speaker; }
+
+  void add(const EnergyBreakdown& o) {
+    base += o.base;
+    cpu += o.cpu;
+    spi += o.spi;
+    backlight += o.backlight;
+    speaker += o.speaker;
+  }
+};
+
+inline EnergyBreakdown estimateEnergy(const EnergyActivity& a, const EnergyCoefficients& c) {
+  // mW × ms = uJ
+  float elapsedMs = a.elapsedMicros / 1000.0f;
+  float busyMs = (a.coreBusyMicros[0] + a.coreBusyMicros[1]) / 1000.0f;
+  EnergyBreakdown e;
+  e.base = c.baseMw * elapsedMs;
+  e.cpu = c.coreActiveMw * busyMs * (a.cpuMhz / ENERGY_REFERENCE_MHZ);
+  e.spi = c.spiNanojoulesPerByte * a.spiBytes / 1000.0f;
+  e.backlight = c.backlightMw * (a.backlight / 255.0f) * elapsedMs;
+  e.speaker = c.speakerMw * a.speakerMicros / 1000.0f;
+  return e;
+}
+
+// ========================================
+// 集計
+// ========================================
+// 有無で分けて比べる機能（同じ時間に複数が重なってよい）
+enum EnergyFeature {
+  ENERGY_HUD,       // 性能HUD の表示
+  ENERGY_ATTRACT,   // アトラクトモードの再生
+  ENERGY_DUST,      // 粉塵の合成（dustLevel > 0）
+  ENERGY_FLUID,     // 流体
+  ENERGY_SOUND,     // 音が鳴っている
+  ENERGY_FEATURE_COUNT
+};
+
+const char* const ENERGY_FEATURE_NAMES[ENERGY_FEATURE_COUNT] = {"hud", "attract", "dust", "fluid", "sound"};
+
+struct EnergyBucket {
+  uint64_t micros;
+  EnergyBreakdown energy;
+
+  // この区分の間の平均電力 [mW]（= 1時間あたりの mWh）
+  double averageMw() const { return micros ? energy.total() / (micros / 1000.0) : 0.0; }
+};
+
+class EnergyMeter {
+public:
+  explicit EnergyMeter(const EnergyCoefficients& coefficients) : coefficients(coefficients) {
+    clear(total);
+    for (int s = 0; s < STATE_COUNT; s++) clear(states[s]);
+    for (int f = 0; f < ENERGY_FEATURE_COUNT; f++) {
+      clear(features[f][0]);
+      clear(features[f][1]);
+    }
+  }
+
+  EnergyCoefficients coefficients;
+  EnergyBucket total;
+  EnergyBucket states[STATE_COUNT];
+  EnergyBucket features[ENERGY_FEATURE_COUNT][2];   // [機能][0 = なし, 1 = あり]
+
+  // featureMask は (1 << EnergyFeature) の和。区間のエネルギー [uJ] を返す
+  double add(int state, uint32_t featureMask, const EnergyActivity& activity) {
+    EnergyBreakdown e = estimateEnergy(activity, coefficients);
+    addTo(total, activity.elapsedMicros, e);
+    addTo(states[state], activity.elapsedMicros, e);
+    for (int f = 0; f < ENERGY_FEATURE_COUNT; f++) {
+      addTo(features[f][(featureMask >> f) & 1], activity.elapsedMicros, e);
+    }
+    return e.total();
+  }
+
+  // 動かした時間のうち State s にいた割合で按分した、1時間あたりの mWh
+  double stateShareMwhPerHour(int s) const {
+    return total.micros ? states[s].energy.total() / (total.micros / 1000.0) : 0.0;
+  }
+
+  // 機能 f があるときとないときの平均電力の差 [mW]（どちらかの時間が 0 なら 0）。
+  // 同じ時間の State や他の機能の違いも含むので、厳密な増分ではなく目安
+  // （たとえば流体は SHATTER の間に多く、その分の描画も含む）
+  double featureCostMw(int f) const {
+    if (features[f][0].micros == 0 || features[f][1].micros == 0) return 0.0;
+    return features[f][1].averageMw() - features[f][0].averageMw();
+  }
+
+private:
+  static void clear(EnergyBucket& b) {
+    b.micros = 0;
+    b.energy = EnergyBreakdown{0, 0, 0, 0, 0};
+  }
+
+  static void addTo(EnergyBucket& b, uint32_t micros, const EnergyBreakdown& e) {
+    b.micros += micros;
+    b.energy.add(e);
+  }
+};
@@ -0,0 +1,280 @@
+/**
+ * FrameCodec - フレーム差分コーデック（XOR + ランレングス）
+ *
+ * 端末側エンコーダとホスト側デコーダで共有する。Arduino非依存。
+ *
+ * 前フレームとのXORを取り、次の3種類の命令列に圧縮する:
+ *   SKIP    変化なし画素の連続（XOR == 0）
+ *   FILL    同一XOR値の連続（フラッシュ円などの塗り）
+ *   LITERAL XOR値をそのまま並べる
+ *
+ * アトラクトモード用に、4bitパレット番号列の差分版（PaletteDelta）も持つ。
+ *
+ * 命令バイト: 上位2bit = 種別, 下位6bit = 長さ-1
+ * 下位6bitが63の場合は続くLEB128可変長整数に (長さ-1-63) が入る。
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// ========================================
+// 命令・パケット定義
+// ========================================
+const uint8_t FRAME_OP_SKIP = 0x00;
+const uint8_t FRAME_OP_FILL = 0x40;
+const uint8_t FRAME_OP_LITERAL = 0x80;
+const uint8_t FRAME_OP_MASK = 0xC0;
+const uint8_t FRAME_OP_INLINE_MAX = 63;
+
+const uint8_t FRAME_FLAG_KEYFRAME = 0x01;  // 参照フレームを黒として符号化
+const uint8_t FRAME_FLAG_SWAPPED = 0x02;   // RGB565がビッグエンディアン（M5Canvasのバッファ形式）
+
+const uint8_t FRAME_PACKET_MAGIC[4] = {'G', 'D', 'F', '1'};
+
+struct __attribute__((packed)) FramePacketHeader {
+  uint8_t magic[4];        // "GDF1"
+  uint32_t frameIndex;     // 描画フレーム番号（欠番 = 帯域制限による間引き）
+  uint16_t width;
+  uint16_t height;
+  uint8_t flags;
+  uint8_t reserved[3];
+  uint32_t payloadBytes;   // 続く圧縮データのバイト数
+  uint32_t encodeMicros;   // 符号化に要したCPU時間
+  uint32_t captureMicros;  // 描画側でのフレーム取り込み時間
+  uint32_t checksum;       // ペイロードのチェックサム
+};
+
+// 最悪ケース（1画素ごとにSKIP/LITERALが交互）でも収まるサイズ
+inline size_t frameDeltaBound(size_t pixels) {
+  return pixels * 2 + pixels / 8 + 16;
+}
+
+inline uint32_t frameChecksum(const uint8_t* data, size_t len) {
+  // Fletcher-32（バイト単位の簡易版）
+  uint32_t a = 1, b = 0;
+  for (size_t i = 0; i < len; i++) {
+    a = (a + data[i]) % 65521;
+    b = (b + a) % 65521;
+  }
+  return (b << 16) | a;
+}
+
+// ========================================
+// エンコード
+// ========================================
+inline uint8_t* frameEmitOp(uint8_t* out, uint8_t op, size_t length) {
+  size_t n = length - 1;
+  if (n < FRAME_OP_INLINE_MAX) {
+    *out++ = op | (uint8_t)n;
+    return out;
+  }
+  *out++ = op | FRAME_OP_INLINE_MAX;
+  n -= FRAME_OP_INLINE_MAX;
+  do {
+    uint8_t b = n & 0x7F;
+    n >>= 7;
+    *out++ = n ? (b | 0x80) : b;
+  } while (n);
+  return out;
+}
+
+inline uint8_t* frameEmitWord(uint8_t* out, uint16_t v) {
+  *out++ = v & 0xFF;
+  *out++ = v >> 8;
+  return out;
+}
+
+// cur を ref とのXORで符号化し、ref を cur で更新する。
+// out には frameDeltaBound(pixels) バイト以上を確保すること。戻り値は出力バイト数。
+inline size_t encodeFrameDelta(const uint16_t* cur, uint16_t* ref, size_t pixels, uint8_t* out) {
+  uint8_t* p = out;
+  size_t i = 0;
+
+  while (i < pixels) {
+    uint16_t d = cur[i] ^ ref[i];
+
+    if (d == 0) {
+      size_t j = i + 1;
+      while (j < pixels && cur[j] == ref[j]) j++;
+      p = frameEmitOp(p, FRAME_OP_SKIP, j - i);
+      i = j;
+      continue;
+    }
+
+    size_t j = i + 1;
+    while (j < pixels && (uint16_t)(cur[j] ^ ref[j]) == d) j++;
+    if (j - i >= 3) {
+      p = frameEmitOp(p, FRAME_OP_FILL, j - i);
+      p = frameEmitWord(p, d);
+      for (size_t k = i; k < j; k++) ref[k] = cur[k];
+      i = j;
+      continue;
+    }
+
+    // リテラル: 変化なし画素か3連続の同値が現れるまで
+    j = i + 1;
+    while (j < pixels) {
+      uint16_t dj = cur[j] ^ ref[j];
+      if (dj == 0) break;
+      if (j + 2 < pixels &&
+          (uint16_t)(cur[j + 1] ^ ref[j + 1]) == dj &&
+          (uint16_t)(cur[j + 2] ^ ref[j + 2]) == dj) break;
+      j++;
+    }
+    p = frameEmitOp(p, FRAME_OP_LITERAL, j - i);
+    for (size_t k = i; k < j; k++) {
+      p = frameEmitWord(p, cur[k] ^ ref[k]);
+      ref[k] = cur[k];
+    }
+    i = j;
+  }
+
+  return p - out;
+}
+
+// ========================================
+// デコード
+// ========================================
+// frame（前フレーム）に差分を適用する。データ不整合なら false。
+inline bool decodeFrameDelta(const uint8_t* in, size_t len, uint16_t* frame, size_t pixels) {
+  const uint8_t* end = in + len;
+  size_t i = 0;
+
+  while (in < end) {
+    uint8_t op = *in & FRAME_OP_MASK;
+    size_t n = *in++ & ~FRAME_OP_MASK;
+    if (n == FRAME_OP_INLINE_MAX) {
+      size_t ext = 0;
+      int shift = 0;
+      uint8_t b;
+      do {
+        if (in >= end || shift > 28) return false;
+        b = *in++;
+        ext |= (size_t)(b & 0x7F) << shift;
+        shift += 7;
+      } while (b & 0x80);
+      n += ext;
+    }
+    size_t length = n + 1;
+    if (i + length > pixels) return false;
+
+    if (op == FRAME_OP_SKIP) {
+      i += length;
+    } else if (op == FRAME_OP_FILL) {
+      if (end - in < 2) return false;
+      uint16_t d = in[0] | (in[1] << 8);
+      in += 2;
+      for (size_t k = 0; k < length; k++) frame[i++] ^= d;
+    } else if (op == FRAME_OP_LITERAL) {
+      if ((size_t)(end - in) < length * 2) return false;
+      for (size_t k = 0; k < length; k++, in += 2) frame[i++] ^= in[0] | (in[1] << 8);
+    } else {
+      return false;
+    }
+  }
+
+  return i == pixels;
+}
+
+// ========================================
+// パレット差分（アトラクトモード用）
+// ========================================
+// 4bitパレット番号の列を前フレームとの比較で符号化する。命令は上と同じで、
+//   SKIP    前フレームと同じ画素の連続
+//   FILL    同一パレット番号の連続（続く1バイトが番号）
+//   LITERAL 続く ceil(長さ/2) バイトに2画素/バイトのニブル列（下位ニブルが先）
+
+// cur/prev はパレット番号（0-15）の配列。戻り値は出力バイト数。
+inline size_t encodePaletteDelta(const uint8_t* cur, const uint8_t* prev, size_t pixels, uint8_t* out) {
+  uint8_t* p = out;
+  size_t i = 0;
+
+  while (i < pixels) {
+    if (cur[i] == prev[i]) {
+      size_t j = i + 1;
+      while (j < pixels && cur[j] == prev[j]) j++;
+      p = frameEmitOp(p, FRAME_OP_SKIP, j - i);
+      i = j;
+      continue;
+    }
+
+    size_t j = i + 1;
+    while (j < pixels && cur[j] == cur[i]) j++;
+    if (j - i >= 3) {
+      p = frameEmitOp(p, FRAME_OP_FILL, j - i);
+      *p++ = cur[i];
+      i = j;
+      continue;
+    }
+
+    j = i + 1;
+    while (j < pixels && cur[j] != prev[j] &&
+           !(j + 2 < pixels && cur[j + 1] == cur[j] && cur[j + 2] == cur[j])) {
+      j++;
+    }
+    p = frameEmitOp(p, FRAME_OP_LITERAL, j - i);
+    for (size_t k = i; k < j; k += 2) {
+      uint8_t hi = (k + 1 < j) ? cur[k + 1] : 0;
+      *p++ = (cur[k] & 0x0F) | (hi << 4);
+    }
+    i = j;
+  }
+
+  return p - out;
+}
+
+// 差分を RGB565 フレームへ適用する。palette はフレームと同じバイト順で渡すこと。
+// dirtyFirst/dirtyLast に書き換えた画素の範囲を返す（変化なしなら first > last）。
+inline bool decodePaletteDelta(const uint8_t* in, size_t len, const uint16_t* palette,
+                               uint16_t* frame, size_t pixels,
+                               size_t* dirtyFirst, size_t* dirtyLast) {
+  const uint8_t* end = in + len;
+  size_t i = 0;
+  *dirtyFirst = pixels;
+  *dirtyLast = 0;
+
+  while (in < end) {
+    uint8_t op = *in & FRAME_OP_MASK;
+    size_t n = *in++ & ~FRAME_OP_MASK;
+    if (n == FRAME_OP_INLINE_MAX) {
+      size_t ext = 0;
+      int shift = 0;
+      uint8_t b;
+      do {
+        if (in >= end || shift > 28) return false;
+        b = *in++;
+        ext |= (size_t)(b & 0x7F) << shift;
+        shift += 7;
+      } while (b & 0x80);
+      n += ext;
+    }
+    size_t length = n + 1;
+    if (i + length > pixels) return false;
+
+    if (op == FRAME_OP_SKIP) {
+      i += length;
+      continue;
+    }
+
+    if (i < *dirtyFirst) *dirtyFirst = i;
+    if (op == FRAME_OP_FILL) {
+      if (in >= end) return false;
+      uint16_t c = palette[*in++ & 0x0F];
+      for (size_t k = 0; k < length; k++) frame[i++] = c;
+    } else if (op == FRAME_OP_LITERAL) {
+      if ((size_t)(end - in) < (length + 1) / 2) return false;
+      for (size_t k = 0; k < length; k += 2) {
+        uint8_t b = *in++;
+        frame[i++] = palette[b & 0x0F];
+        if (k + 1 < length) frame[i++] = palette[b >> 4];
+      }
+    } else {
+      return false;
+    }
+    *dirtyLast = i - 1;
+  }
+
+  return i == pixels;
+}
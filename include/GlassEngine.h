@@ -0,0 +1,374 @@
+/**
+ * GlassEngine - 破壊と再生のシミュレーション本体
+ *
+ * 状態遷移・ひび割れ・粒子をひとつのオブジェクトにまとめたもの。
+ * ハードウェアにもArduinoにも依存しないので、端末（main.cpp）と
+ * ホスト側ツール（tools/）の両方から同じコードを動かせる。
+ *
+ * 時刻は呼び出し側が渡し、乱数は自前の決定的な生成器を使う。
+ * 同じ設定・シード・入力列からは必ず同じ結果になる。
+ * 音・振動・ログは直接出さず、events に積んで呼び出し側に任せる。
+ */
+#pragma once
+
+#include "GlassFluid.h"
+
+#include <stdint.h>
+#include <vector>
+
+// ========================================
+// 状態定義（State Model）
+// ========================================
+enum State {
+  NORMAL,    // 初期状態 - 完全透明な静止画面
+  CRACK,     // ひび割れ生成
+  SHATTER,   // 粉砕
+  SILENCE,   // 無音の余韻
+  REBUILD,   // 修復
+  RECOVERY   // 完全修復
+};
+
+const int STATE_COUNT = RECOVERY + 1;
+
+// ========================================
+// ひび構造体
+// ========================================
+struct Crack {
+  float startX, startY;  // 開始点
+  float endX, endY;      // 終了点
+  float angle;           // 角度
+  float length;          // 長さ
+  int generation;        // 世代（フラクタル深度）
+  float alpha;           // 透明度
+  bool active;           // アクティブ状態
+};
+
+// ========================================
+// 粉末粒子構造体
+// ========================================
+struct Particle {
+  float x, y;           // 位置
+  float vx, vy;         // 速度
+  float size;           // サイズ
+  float alpha;          // 透明度
+  bool active;          // アクティブ状態
+};
+
+// ========================================
+// 粉塵（衝突しない細かな粒。描画は DustField.h の密度グリッド）
+// ========================================
+struct DustMote {
+  float x, y;
+  float vx, vy;
+};
+
+// ========================================
+// 衝突イベント（粒状音の入力）
+// ========================================
+struct ImpactEvent {
+  float x, y;     // 衝突位置
+  float speed;    // 法線方向の衝突速度 [px/frame]
+  float size;     // 破片の大きさ（小さいほど高い音）
+  bool rim;       // true = 縁への衝突, false = 破片同士
+};
+
+// ========================================
+// 重ねたガラス（奥の板。描画は GlassPanes.h が板ごとにひびを覚えておいて合成）
+// ========================================
+const int MAX_PANES = 3;
+
+struct GlassPane {
+  std::vector<Crack> cracks;   // 手前の板が割れたときに伝わったひび
+  uint32_t revision = 0;       // cracks を変えるたびに増える（描画側の作り直しの合図）
+};
+
+// ========================================
+// ひびの画像（デカール。描画は CrackDecal.h のアトラスから型押し）
+// ========================================
+enum DecalKind {
+  DECAL_STAR,     // 衝撃の中心の星形のひび
+  DECAL_CHIP,     // 縁に当たった破片の欠け
+  DECAL_KIND_COUNT
+};
+
+const int DECAL_ANGLES = 16;   // 画像をあらかじめ回転しておく向きの数
+
+struct CrackDecal {
+  float x, y;       // 画像の中心
+  uint8_t kind;     // DecalKind
+  uint8_t angle;    // 向きの番号（0 ~ DECAL_ANGLES - 1、+x から時計回り）
+  float alpha;      // 透明度
+};
+
+// ========================================
+// 画面サイズ
+// ========================================
+const int SCREEN_WIDTH = 240;
+const int SCREEN_HEIGHT = 240;
+const int CENTER_X = 120;
+const int CENTER_Y = 120;
+const float GLASS_RIM_RADIUS = 112.0f;  // 破片が跳ね返るガラスの縁
+
+// 万華鏡モードの扇形の数。シミュレーションは +x から時計回りに
+// 360 / KALEIDOSCOPE_SECTORS 度の扇形 1つだけで行い、描画で残りへ映す
+const int KALEIDOSCOPE_SECTORS = 6;
+
+// ========================================
+// 音響周波数定義
+// ========================================
+const int FREQ_CRACK = 1500;
+const int FREQ_SHATTER = 2000;
+const int FREQ_REBUILD = 800;
+const int FREQ_RECOVERY = 1200;
+const int FREQ_BUTTON = 800;
+
+// ========================================
+// 調整パラメータ
+// ========================================
+struct GlassConfig {
+  float crackThreshold = 0.15f;            // ひび割れ開始閾値
+  float shatterThreshold = 0.65f;          // 粉砕開始閾値
+  float destructionRate = 0.003f;          // エンコーダー1カウントあたりの破壊量
+  float slowDestructionGain = 0.6f;        // ゆっくり回したときの破壊量の倍率
+  float fastDestructionGain = 1.8f;        // 激しく回したときの破壊量の倍率
+  float spinVelocityFast = 400.0f;         // これ以上の回転速度 [count/s] は最も激しい破壊
+  float spinSmoothing = 80.0f;             // 回転速度の平滑化の時定数 [ms]
+  float rotationDecay = 0.9f;              // 無回転時の回転速度の減衰
+  float crackFade = 0.95f;                 // 修復中のひびの減衰
+  float particleDrag = 0.98f;              // 粒子速度の減衰
+  float particleFade = 0.995f;             // 粒子の透明度の減衰
+  float rimRestitution = 0.4f;             // 縁での反発係数
+  float collisionRestitution = 0.5f;       // 破片同士の反発係数
+  float impactMinSpeed = 0.3f;             // これより遅い衝突は音にしない
+  float chipMinSpeed = 2.0f;               // これより速く縁に当たると欠けの跡を残す
+  int crackBranchChance = 30;              // 分岐確率 [%]（中くらいの速さでの値）
+  int maxCracks = 80;
+  int maxDecals = 24;                      // ひびの画像の上限（型押しのコストの上限）
+  int maxParticles = 150;
+  int maxImpactsPerStep = 1024;            // 1ステップで記録する衝突の上限
+  int maxDust = 20000;                     // 粉砕時の粉塵の数（最も激しいとき）
+  float dustDrag = 0.96f;                  // 粉塵の速度の減衰
+  float dustFade = 0.998f;                 // 粉塵全体の明るさの減衰
+  float fluidDustShare = 0.5f;             // 粉塵のうち流体の密度として運ぶ細かい粉の割合（0 = 流体なし）
+  unsigned long fluidInterval = 33;        // 流体の更新間隔 [ms]（約30Hz）
+  float fluidSpinForce = 0.04f;            // 最も激しい回転での渦の外力 [セル/ステップ^2]
+  float fluidInwardForce = 0.03f;          // 修復中に中心へ吸い込む外力 [セル/ステップ^2]
+  float fluidCoupling = 0.1f;              // 粉塵の粒が流れに乗る速さ（0 ~ 1）
+  int dustSortInterval = 8;                // 粉塵を Z 順に並べ直す間隔 [ステップ]（0 = しない）
+  bool kaleidoscope = false;               // 万華鏡モード（Kaleidoscope.h で扇形を6方向へ映す）
+  int paneCount = 1;                       // 重ねたガラスの枚数（1 ~ MAX_PANES）
+  int paneTransmittedCracks = 6;           // 手前の板が割れたとき次の板に伝わるひびの数
+  float paneParallax = 8.0f;               // 1枚奥の板の視差のずれの最大 [px]
+  float parallaxPerCount = 0.04f;          // エンコーダー1カウントあたりの視差の変化（-1 ~ 1）
+  float parallaxDecay = 0.97f;             // 視差が正面に戻る速さ
+  float kaleidoscopeDensity = 2.0f;        // 万華鏡でのひび・破片・粉塵の密度（通常比）。
+                                           // 扇形1つ分だけ動かすので、計算量は 密度 / 6 倍
+  unsigned long autoRecoverTime = 10000;   // 無操作で自動修復するまで [ms]
+  unsigned long silenceDelay = 1000;       // 静止してから余韻に入るまで [ms]
+  unsigned long recoveryDuration = 800;    // RECOVERY演出の長さ [ms]
+};
+
+// ========================================
+// 回転の激しさごとの破壊の仕方
+// ========================================
+// 回転速度を SPIN_BUCKETS 段階に分け、段階ごとの値を reset() で表にしておく。
+// ゆっくり削ると長くまっすぐなひびと大きな破片、激しく回すと短く枝分かれの
+// 多いひびと細かく速い破片になる。
+const int SPIN_BUCKETS = 8;
+
+struct DestructionProfile {
+  float destructionGain;       // destructionRate への倍率
+  int crackLengthMin;          // 1世代目のひびの長さ [px]
+  int crackLengthMax;
+  int branchChance;            // 分岐確率 [%]
+  int branchDepth;             // 分岐する最大の世代
+  int branchSpread;            // 分岐の角度の振れ幅 [deg]
+  int particleCount;           // 粉砕時の破片数
+  float particleSpeedMin;      // 粉砕時の初速 [px/frame]
+  float particleSpeedMax;
+  int spawnRadiusMax;          // 破片の出現位置（中心からの距離の上限）
+  int particleSizeMin;         // 破片の大きさ
+  int particleSizeMax;
+  int shatterHaptic;           // 粉砕時の振動の長さ [ms]
+  int dustCount;               // 粉砕時の粉塵の数
+};
+
+// ========================================
+// 出力イベント（音・振動・ログ）
+// ========================================
+enum GlassEventType {
+  EVENT_SOUND,    // value1 = 周波数, value2 = 長さ [ms]
+  EVENT_HAPTIC,   // value1 = 長さ [ms], value2 = 強さ
+  EVENT_LOG       // message
+};
+
+struct GlassEvent {
+  GlassEventType type;
+  int value1;
+  int value2;
+  const char* message;
+};
+
+// ========================================
+// 1ステップ分の入力
+// ========================================
+enum ButtonInput {
+  BUTTON_NONE,
+  BUTTON_PRESS,   // 短押し: 一段階戻る
+  BUTTON_HOLD     // 長押し: 完全リセット
+};
+
+struct GlassInput {
+  int32_t encoderDelta;
+  ButtonInput button;
+};
+
+// ========================================
+// 決定的な乱数（xorshift32）
+// ========================================
+class GlassRandom {
+public:
+  explicit GlassRandom(uint32_t seed = 1) { setSeed(seed); }
+
+  void setSeed(uint32_t seed) { state = seed ? seed : 0x9E3779B9; }
+
+  uint32_t next() {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+
+  // Arduino の random() と同じく [0, max)
+  long uniform(long max) { return max > 0 ? (long)(next() % (uint32_t)max) : 0; }
+
+  // [min, max)
+  long uniform(long min, long max) { return max > min ? min + uniform(max - min) : min; }
+
+  // [min, max) の実数（1/1024 刻み）
+  float uniformFloat(float min, float max) { return min + (max - min) * (next() & 1023) / 1024.0f; }
+
+private:
+  uint32_t state;
+};
+
+// ========================================
+// シミュレーション本体
+// ========================================
+class GlassEngine {
+public:
+  explicit GlassEngine(const GlassConfig& config = GlassConfig(), uint32_t seed = 1);
+
+  // 全状態を初期化する（起動時・ホストでのセッション開始時）
+  void reset(unsigned long now);
+
+  // 1フレーム分進める。events はステップごとに作り直される
+  void step(const GlassInput& input, unsigned long now);
+
+  GlassConfig config;
+  GlassRandom rng;
+
+  State currentState;
+  State previousState;
+
+  // エンコーダー関連
+  int32_t encoderDelta;
+  float rotationSpeed;
+  float spinVelocity;          // 時刻から求めた回転速度 [count/s]（平滑化済み）
+  int spinBucket;              // 今の回転の激しさ（0 ~ SPIN_BUCKETS - 1）
+  int shatterBucket;           // 粉砕したときの激しさ
+
+  // 激しさごとの破壊の仕方（reset() で config から作る）
+  DestructionProfile profiles[SPIN_BUCKETS];
+
+  // 破壊進行度（0.0 ~ 1.0）
+  float destructionLevel;
+
+  std::vector<Crack> cracks;
+  std::vector<CrackDecal> decals;   // cracks と一緒に増え、一緒に消える
+  std::vector<Particle> particles;
+
+  // 重ねたガラス。cracks / particles は一番手前の割れていない板 activePane のもので、
+  // 奥の板（activePane + 1 以降）は panes[] に自分のひびを持つ。手前の板が割れて
+  // 余韻（SILENCE）に入った後に正回転すると、次の板が手前になる
+  GlassPane panes[MAX_PANES];
+  int activePane;
+  float parallax;              // ダイヤルの回転で傾く視差（-1.0 ~ 1.0）
+
+  // 粉塵は個別の明るさを持たず、全体の明るさ dustLevel（0.0 ~ 1.0）だけを持つ。
+  // 最も細かい粉は粒ではなく fluid の密度として運ぶ
+  std::vector<DustMote> dust;
+  float dustLevel;
+  GlassFluid fluid;
+  bool fluidActive;
+  int fluidSteps;              // このステップで流体を進めた回数（計測用）
+
+  // タイマー
+  unsigned long stateStartTime;
+  unsigned long lastInteractionTime;
+
+  std::vector<GlassEvent> events;
+
+  // このステップで起きた衝突（events と同じくステップごとに作り直す）
+  std::vector<ImpactEvent> impacts;
+  int droppedImpacts;
+
+  int activeParticleCount() const;
+
+  // シミュレーションの状態の FNV-1a ハッシュ（ロックステップの食い違いの検出用）
+  uint32_t stateHash() const;
+
+  // 板 pane の手前の板に対する横のずれ [px]（奥ほど大きい）
+  float paneOffset(int pane) const { return (pane - activePane) * config.paneParallax * parallax; }
+
+private:
+  void applyEncoder(int32_t delta, unsigned long now);
+  void applyButton(ButtonInput button, unsigned long now);
+  void updateDestruction();
+  void updateState(unsigned long now);
+  void updateCracks();
+  void autoRecover(unsigned long now);
+  void changeState(State next, unsigned long now, const char* message);
+  void generateCrack(float centerX, float centerY, float angle, int generation);
+  void addDecal(float x, float y, DecalKind kind, float angle);
+  void clearCracks();
+  void transmitCracks();
+  void breakThrough(unsigned long now);
+  void clearPanes();
+  void generateParticles();
+  void updateParticles();
+  void generateDust();
+  void updateDust(unsigned long now);
+  void updateFluid(unsigned long now);
+  void clearDust();
+  void sortDust();
+  void collideParticles();
+  void emitImpact(float x, float y, float speed, float size, bool rim);
+  void clearAll();
+  void buildProfiles();
+  int sectorCount(int count) const;
+
+  // 粒子の向き用の cos/sin 表（1度刻み）
+  static const int DIRECTION_STEPS = 360;
+  float directionCos[DIRECTION_STEPS];
+  float directionSin[DIRECTION_STEPS];
+  unsigned long lastStepTime;
+  unsigned long stepInterval;  // 直前のステップとの間隔 [ms]
+  unsigned long lastFluidTime;
+
+  // 粉塵の Z 順（Morton 順）ソート用（基数ソートの作業領域）
+  int dustSortCountdown;
+  std::vector<DustMote> dustScratch;
+  std::vector<uint16_t> dustKeys;
+  std::vector<uint16_t> dustKeysScratch;
+
+  // 衝突判定用の一様グリッド（セルごとの連結リスト）
+  static const int COLLISION_CELL = 8;
+  static const int COLLISION_GRID = SCREEN_WIDTH / COLLISION_CELL;
+  std::vector<int> cellHead;
+  std::vector<int> cellNext;
+
+  void emitSound(int frequency, int duration) { events.push_back({EVENT_SOUND, frequency, duration, nullptr}); }
+  void emitHaptic(int duration, int strength) { events.push_back({EVENT_HAPTIC, duration, strength, nullptr}); }
+  void emitLog(const char* message) { events.push_back({EVENT_LOG, 0, 0, message}); }
+};
@@ -0,0 +1,63 @@
+/**
+ * GlassFluid - 粉砕後の細かなガラス粉を運ぶ粗い流体格子
+ *
+ * 画面全体を 64x64 のセルに分けた stable fluids 方式の速度場と密度場。
+ * 1ステップは 外力 → 速度の移流（semi-Lagrangian）→ 圧力投影
+ * （Jacobi 反復）→ 密度の移流。ガラスの縁の外側のセルは壁として扱う。
+ *
+ * 最も細かい粉は粒として持たず、この密度場の値として運ぶ（粒の数に
+ * 依らないコスト）。ダイヤルの回転は縁に沿った渦の外力になる。
+ *
+ * 格子は一辺 size px の正方形の画面全体を覆い、中心から rimRadius px の
+ * 外側を壁にする。内部の単位はセル（1セル = cellSize px）と流体の1ステップ。
+ * Arduino に依存しないので、ホスト側ツールでも同じ結果になる。
+ */
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+const int FLUID_N = 64;
+const int FLUID_JACOBI_ITERATIONS = 10;  // 前回の圧力から始めるので少なくてよい
+
+class GlassFluid {
+public:
+  GlassFluid(float size, float rimRadius);
+
+  void clear();
+
+  // 画面座標 (x, y) に amount だけ粉を置く（双一次に4セルへ分配）
+  void deposit(float x, float y, float amount);
+
+  // 1ステップ進める。swirl は縁に沿った渦の強さ（正 = 時計回り）、
+  // inward は中心へ吸い込む強さ（REBUILD 用）[セル/ステップ^2]
+  void step(float swirl, float inward);
+
+  // 画面座標 (x, y) の速度 [px/ステップ]（最寄りのセル）
+  void velocityAt(float x, float y, float& vx, float& vy) const;
+
+  // 画面座標 (x, y) の密度（双一次）
+  float densityAt(float x, float y) const {
+    return sample(density, x / cellSize - 0.5f, y / cellSize - 0.5f);
+  }
+
+  // 密度の合計（粉の量）
+  float totalDensity() const;
+
+  std::vector<float> density;   // FLUID_N * FLUID_N、1.0 = 粉塵1粒分
+  float cellSize;               // 1セルの大きさ [px]（240 px / 64 = 3.75）
+
+private:
+  std::vector<float> u, v;       // セル中心の速度
+  std::vector<float> u0, v0, density0;
+  std::vector<float> pressure, pressure0, divergence;
+  std::vector<uint8_t> solid;    // 縁の外側 = 1
+  std::vector<float> swirlX, swirlY;    // 単位の渦方向（時計回りの接線）
+  std::vector<float> inwardX, inwardY;  // 単位の中心方向
+  int spanBegin[FLUID_N], spanEnd[FLUID_N];  // 行ごとの流体セルの範囲 [begin, end)
+
+  void advect(const std::vector<float>& src, std::vector<float>& dst,
+              const std::vector<float>& velU, const std::vector<float>& velV);
+  void project();
+  float sample(const std::vector<float>& field, float x, float y) const;
+};
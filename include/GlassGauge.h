@@ -0,0 +1,114 @@
+/**
+ * GlassGauge - 縁に沿った破壊進行度の円弧ゲージ
+ *
+ * 画面の縁（半径 GAUGE_INNER_RADIUS 以上 GAUGE_OUTER_RADIUS 未満の円環）に、
+ * 12時から時計回りに destructionLevel を細い弧で描く。
+ *
+ * 円環を1度ごとの扇形に分け、扇形ごとの横方向の画素ラン（y, x, 長さ）を
+ * 起動時に一度だけ求めておく。毎フレームは前回の値と今回の値の間の
+ * 扇形だけを塗り直すので、コストは弧の長さではなく変化量に比例する。
+ *
+ * 円環は renderGlass() の消去範囲（GLASS_CLEAR_RADIUS）の外にあるので、
+ * 描いた弧はフレームをまたいで残る。他の処理が円環を上書きしたとき
+ * （アトラクトモードの後など）は invalidate() で全体を描き直す。
+ */
+#pragma once
+
+#include "GlassRenderer.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+
+const int GAUGE_SECTORS = 360;
+const int GAUGE_INNER_RADIUS = GLASS_CLEAR_RADIUS + 1;  // 消去円の縁と1画素あける
+const int GAUGE_OUTER_RADIUS = 120;
+
+class GlassGauge {
+public:
+  GlassGauge() : shownSectors(-1) { buildRuns(); }
+
+  // 次の update() で円環全体を描き直す
+  void invalidate() { shownSectors = -1; }
+
+  template <typename Gfx>
+  void update(Gfx& gfx, float level) {
+    int sectors = (int)(level * GAUGE_SECTORS + 0.5f);
+    if (sectors < 0) sectors = 0;
+    if (sectors > GAUGE_SECTORS) sectors = GAUGE_SECTORS;
+
+    uint32_t fillColor = gfx.color565(200, 200, 255);
+    uint32_t emptyColor = gfx.color565(0, 0, 0);
+
+    if (shownSectors < 0) {
+      drawSectors(gfx, 0, sectors, fillColor);
+      drawSectors(gfx, sectors, GAUGE_SECTORS, emptyColor);
+    } else if (sectors > shownSectors) {
+      drawSectors(gfx, shownSectors, sectors, fillColor);
+    } else if (sectors < shownSectors) {
+      drawSectors(gfx, sectors, shownSectors, emptyColor);
+    }
+    shownSectors = sectors;
+  }
+
+  // 直近の update() で塗った扇形数（計測用）
+  int shownSectors;
+
+private:
+  struct Run {
+    int16_t y, x, length;
+  };
+
+  // sectorStart[s] ~ sectorStart[s + 1] が扇形 s のラン
+  std::vector<Run> runs;
+  std::vector<uint16_t> sectorStart;
+
+  template <typename Gfx, typename T>
+  void drawSectors(Gfx& gfx, int from, int to, T color) {
+    for (int i = sectorStart[from]; i < sectorStart[to]; i++) {
+      gfx.drawFastHLine(runs[i].x, runs[i].y, runs[i].length, color);
+    }
+  }
+
+  static int sectorOf(int x, int y) {
+    // 12時が0、時計回り
+    float angle = atan2f((float)(x - CENTER_X) + 0.5f, (float)(CENTER_Y - y) - 0.5f);
+    if (angle < 0) angle += 6.283185307179586f;
+    int s = (int)(angle * (GAUGE_SECTORS / 6.283185307179586f));
+    return s < GAUGE_SECTORS ? s : GAUGE_SECTORS - 1;
+  }
+
+  void buildRuns() {
+    // 扇形ごとにランを集めてから、扇形順に並べる
+    std::vector<std::vector<Run>> bySector(GAUGE_SECTORS);
+    // 距離は fillCircle と同じく画素の整数座標で測る
+    int inner2 = GAUGE_INNER_RADIUS * GAUGE_INNER_RADIUS;
+    int outer2 = GAUGE_OUTER_RADIUS * GAUGE_OUTER_RADIUS;
+
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+      int runSector = -1;
+      for (int x = 0; x <= SCREEN_WIDTH; x++) {
+        int s = -1;
+        if (x < SCREEN_WIDTH) {
+          int dx = x - CENTER_X;
+          int dy = y - CENTER_Y;
+          int d2 = dx * dx + dy * dy;
+          if (d2 >= inner2 && d2 < outer2) s = sectorOf(x, y);
+        }
+        if (s != runSector || s < 0) {
+          runSector = s;
+          if (s >= 0) bySector[s].push_back({(int16_t)y, (int16_t)x, 1});
+        } else {
+          bySector[s].back().length++;
+        }
+      }
+    }
+
+    sectorStart.assign(GAUGE_SECTORS + 1, 0);
+    for (int s = 0; s < GAUGE_SECTORS; s++) {
+      sectorStart[s] = (uint16_t)runs.size();
+      runs.insert(runs.end(), bySector[s].begin(), bySector[s].end());
+    }
+    sectorStart[GAUGE_SECTORS] = (uint16_t)runs.size();
+  }
+};
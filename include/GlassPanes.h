@@ -0,0 +1,163 @@
+/**
+ * GlassPanes - 奥に重ねたガラスの描画
+ *
+ * GlassConfig::paneCount > 1 のとき、一番手前の割れていない板
+ * （GlassEngine::activePane）の奥に残りの板を描く。奥の板は縁の円と、
+ * 手前の板が割れたときに伝わったひび（GlassPane::cracks）だけを持ち、
+ * ダイヤルの回転による視差（GlassEngine::paneOffset）で横にずれ、奥ほど暗い。
+ *
+ * 奥の板の中身は手前になるまで変わらないので、線は板ごとに一度だけ
+ * 画素の並び（中心からのずれ）にしておき、revision が変わった板だけ作り直す。
+ * 毎フレームは視差のずれを足して点を打つだけなので、コストは線の画素数で決まり、
+ * 板を重ねても1枚のときとほとんど変わらない。フレームバッファは毎フレーム消すので、
+ * 奥の板を画像として取っておいても消去円ぶんの写しが要り、点を打つ方が安い
+ * （3枚で平均 875 画素 / フレーム、ホストでは消去の半分以下。tools/pane_bench.cpp）。
+ *
+ * フレームバッファへ直接書くので、Gfx は getBuffer / width を持ち、
+ * 画素をビッグエンディアンで持つこと（M5Canvas / SoftCanvas / OverdrawGfx。
+ * OverdrawGfx には書いた画素を countSpan で知らせる）。描画は clipRadius の円の内側だけ。
+ */
+#pragma once
+
+#include "GlassEngine.h"
+#include "OverdrawHook.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+const int PANE_RING_RADIUS = 80;   // 板の縁（renderNormal の円と同じ）
+
+class PaneStack {
+public:
+  explicit PaneStack(int clipRadius) : rebuilds(0) {
+    const int r = clipRadius;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+      int dy = y - CENTER_Y;
+      clipHalfWidth[y] = dy * dy <= r * r ? (int16_t)sqrtf((float)(r * r - dy * dy)) : -1;
+    }
+    mark.assign(SCREEN_WIDTH * SCREEN_HEIGHT / 32, 0);
+    invalidate();
+
+    // 縁の円（中点アルゴリズム）
+    int x = PANE_RING_RADIUS, y = 0, err = 1 - x;
+    while (x >= y) {
+      const int points[8][2] = {{x, y}, {y, x}, {-y, x}, {-x, y}, {-x, -y}, {-y, -x}, {y, -x}, {x, -y}};
+      for (const auto& p : points) addPixel(ring, p[0], p[1]);
+      y++;
+      if (err < 0) {
+        err += 2 * y + 1;
+      } else {
+        x--;
+        err += 2 * (y - x) + 1;
+      }
+    }
+    clearMarks(ring);
+  }
+
+  int rebuilds;   // 線の並びを作り直した回数（計測用）
+
+  // 別のセッション（別の GlassEngine）を描き始めるときに呼ぶ（revision は比べられない）
+  void invalidate() {
+    for (Layer& layer : layers) layer.valid = false;
+  }
+
+  // activePane より奥の板を、奥から順に描く
+  template <typename Gfx>
+  void draw(Gfx& gfx, const GlassEngine& engine) {
+    uint16_t* buf = (uint16_t*)gfx.getBuffer();
+    const int width = gfx.width();
+    for (int pane = engine.config.paneCount - 1; pane > engine.activePane; pane--) {
+      Layer& layer = layers[pane];
+      const GlassPane& source = engine.panes[pane];
+      if (!layer.valid || layer.revision != source.revision) rebuild(layer, source);
+
+      int depth = pane - engine.activePane;
+      int offset = (int)lroundf(engine.paneOffset(pane));
+      plot(gfx, buf, width, ring, offset, shade(123, 125, 123, depth));
+      plot(gfx, buf, width, layer.pixels, offset, shade(170, 170, 230, depth));
+    }
+  }
+
+private:
+  struct Layer {
+    std::vector<uint16_t> pixels;   // 中心からのずれ（下位バイト dx、上位バイト dy、各 int8）
+    uint32_t revision;
+    bool valid;
+  };
+  Layer layers[MAX_PANES];
+  std::vector<uint16_t> ring;
+  std::vector<uint32_t> mark;            // 同じ画素を2度並べないための印（1画素1ビット）
+  int16_t clipHalfWidth[SCREEN_HEIGHT];  // 描画範囲の行ごとの半幅（なければ -1）
+
+  void rebuild(Layer& layer, const GlassPane& source) {
+    layer.pixels.clear();
+    for (const Crack& crack : source.cracks) {
+      // GlassRenderer の drawLine と同じ整数の端点を Bresenham でたどる
+      int x0 = (int)crack.startX - CENTER_X, y0 = (int)crack.startY - CENTER_Y;
+      int x1 = (int)crack.endX - CENTER_X, y1 = (int)crack.endY - CENTER_Y;
+      int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+      int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+      int err = dx + dy;
+      for (;;) {
+        addPixel(layer.pixels, x0, y0);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) {
+          err += dy;
+          x0 += sx;
+        }
+        if (e2 <= dx) {
+          err += dx;
+          y0 += sy;
+        }
+      }
+    }
+    clearMarks(layer.pixels);
+    layer.revision = source.revision;
+    layer.valid = true;
+    rebuilds++;
+  }
+
+  void addPixel(std::vector<uint16_t>& out, int dx, int dy) {
+    int x = dx + CENTER_X, y = dy + CENTER_Y;
+    if (dx < -128 || dx > 127 || dy < -128 || dy > 127) return;
+    if (x < 0 || x >= SCREEN_WIDTH || y < 0 || y >= SCREEN_HEIGHT) return;
+    int index = y * SCREEN_WIDTH + x;
+    uint32_t bit = 1u << (index & 31);
+    if (mark[index >> 5] & bit) return;
+    mark[index >> 5] |= bit;
+    out.push_back((uint16_t)((uint8_t)dx | ((uint8_t)dy << 8)));
+  }
+
+  // 並べた画素の印だけを消す（全体を消すより速い）
+  void clearMarks(const std::vector<uint16_t>& pixels) {
+    for (uint16_t p : pixels) {
+      int index = ((int8_t)(p >> 8) + CENTER_Y) * SCREEN_WIDTH + (int8_t)(p & 0xFF) + CENTER_X;
+      mark[index >> 5] &= ~(1u << (index & 31));
+    }
+  }
+
+  template <typename Gfx>
+  void plot(Gfx& gfx, uint16_t* buf, int width, const std::vector<uint16_t>& pixels, int offset,
+            uint16_t color) const {
+    const uint16_t stored = (uint16_t)((color >> 8) | (color << 8));
+    for (uint16_t p : pixels) {
+      int dx = (int8_t)(p & 0xFF) + offset;
+      int y = (int8_t)(p >> 8) + CENTER_Y;
+      int half = clipHalfWidth[y];
+      if (dx < -half || dx > half) continue;   // half = -1 の行は必ず外
+      buf[y * width + CENTER_X + dx] = stored;
+      countSpan(gfx, CENTER_X + dx, y, 1);
+    }
+  }
+
+  // 奥の深さ depth（1 = すぐ後ろ）の暗さにした RGB565
+  static uint16_t shade(int r, int g, int b, int depth) {
+    r /= depth + 1;
+    g /= depth + 1;
+    b /= depth + 1;
+    return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+  }
+};
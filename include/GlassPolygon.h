@@ -0,0 +1,423 @@
+/**
+ * GlassPolygon - 破片の多角形をアンチエイリアスつきで塗る
+ *
+ * 凸・凹どちらの多角形も、三角形に分けずにそのまま走査線で塗る。
+ * 画素ごとの被覆率は近似ではなく、辺が画素（セル）を横切る部分の
+ * 符号つき面積を積算して求める（FreeType のグレースケールラスタライザと同じ
+ * cover / area の考え方）。
+ *
+ *   cover  セルの中で辺が進んだ縦の量（下向き正、1画素 = 256）
+ *   area   その縦の量 × セル内の辺の横位置の和（セルの左側の台形の面積の2倍）
+ *
+ * 行を左から掃き、cover の累計 × 512 - area がその画素の被覆（1画素 = 131072）。
+ * 座標は 24.8 の固定小数点の整数演算だけなので、ホストと端末で同じ画素になる。
+ *
+ * 描画はタイル（POLYGON_BAND_ROWS 行の帯）ごと。add() で積んだ多角形を
+ * flush() で帯の順に塗るので、セルのバッファは1帯分（約 30KB）で済み、
+ * フレームバッファも帯の範囲だけを続けて触る。帯の中では積んだ順に重ねる。
+ * セルに触れた列はビットで覚えておき、触れていない列の間は被覆が一定なので
+ * まとめて塗る（内部は単色の連続書き込み）。
+ *
+ * 塗るのは clipRadius の円の内側だけ（縁のゲージを上書きしないため）。
+ * フレームバッファへ直接書くので、Gfx は getBuffer / width / height を持ち、
+ * 画素をビッグエンディアンで持つこと（M5Canvas / SoftCanvas）。
+ * countSpan() はまだ呼ばないので OverdrawGfx の書き込み回数には数えられない。
+ *
+ * まだ renderShatter() では使っていない（破片は fillCircle のまま）。
+ * 端末の M5GFX fillTriangle との比較（env m5stack-dial-polybench）で
+ * 速いと分かってから描画に組み込む。ホストの tools/polygon_bench.cpp では
+ * 整数の fillTriangle の約 0.35 倍の速さ。
+ */
+#pragma once
+
+#include "GlassEngine.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+const int POLYGON_SUBPIXEL_BITS = 8;                          // 24.8 固定小数点
+const int POLYGON_ONE = 1 << POLYGON_SUBPIXEL_BITS;
+const int POLYGON_BAND_ROWS = 16;                             // タイル（帯）の行数
+const int POLYGON_CELL_STRIDE = SCREEN_WIDTH + 1;             // 右端の外側（クリップした辺）用に1列多い
+const int POLYGON_MASK_WORDS = (POLYGON_CELL_STRIDE + 31) / 32;
+
+// 重なった部分の扱い
+enum PolygonFill {
+  FILL_NONZERO,   // 巻き数が 0 でなければ内側
+  FILL_EVENODD    // 奇数回囲まれたところだけ内側
+};
+
+struct PolygonPoint {
+  float x, y;
+};
+
+class PolygonRaster {
+public:
+  PolygonRaster(int clipRadius, int maxPolygons = 256, int maxPoints = 2048) {
+    cells.assign(POLYGON_BAND_ROWS * POLYGON_CELL_STRIDE, Cell());
+    memset(touched, 0, sizeof(touched));
+    shapes.reserve(maxPolygons);
+    points.reserve(maxPoints);
+    shapeLimit = maxPolygons;
+    pointLimit = maxPoints;
+    const int r = clipRadius;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+      int dy = y - CENTER_Y;
+      clipHalfWidth[y] = dy * dy <= r * r ? (int16_t)sqrtf((float)(r * r - dy * dy)) : -1;
+    }
+  }
+
+  // 多角形を1つ積む（color は RGB565、opacity は 0〜255）。
+  // 頂点の順は時計回り・反時計回りどちらでもよく、最後の頂点は先頭へ閉じる。
+  // 積める数を超えたら false
+  bool add(const PolygonPoint* pts, int count, uint16_t color, uint8_t opacity = 255,
+           PolygonFill rule = FILL_NONZERO) {
+    if (count < 3 || opacity == 0) return true;
+    if ((int)shapes.size() >= shapeLimit || (int)points.size() + count > pointLimit) return false;
+
+    Shape s;
+    s.first = (int)points.size();
+    s.count = count;
+    s.color = color;
+    s.opacity = opacity + 1;
+    s.rule = rule;
+    s.minX = s.minY = INT32_MAX;
+    s.maxX = s.maxY = INT32_MIN;
+    for (int i = 0; i < count; i++) {
+      FixedPoint p = {toFixed(pts[i].x), toFixed(pts[i].y)};
+      points.push_back(p);
+      if (p.x < s.minX) s.minX = p.x;
+      if (p.x > s.maxX) s.maxX = p.x;
+      if (p.y < s.minY) s.minY = p.y;
+      if (p.y > s.maxY) s.maxY = p.y;
+    }
+    // 画面の外なら積まない
+    if (s.maxX <= 0 || s.maxY <= 0 || s.minX >= (SCREEN_WIDTH << POLYGON_SUBPIXEL_BITS) ||
+        s.minY >= (SCREEN_HEIGHT << POLYGON_SUBPIXEL_BITS) || s.minY == s.maxY) {
+      points.resize(s.first);
+      return true;
+    }
+    shapes.push_back(s);
+    return true;
+  }
+
+  // 積んだ多角形を帯の順に塗り、積んだものを捨てる
+  template <typename Gfx>
+  void flush(Gfx& gfx) {
+    uint16_t* buf = (uint16_t*)gfx.getBuffer();
+    int width = gfx.width();
+    for (int top = 0; top < SCREEN_HEIGHT; top += POLYGON_BAND_ROWS) {
+      const int32_t bandTop = top << POLYGON_SUBPIXEL_BITS;
+      const int32_t bandBottom = (top + POLYGON_BAND_ROWS) << POLYGON_SUBPIXEL_BITS;
+      for (const Shape& s : shapes) {
+        if (s.maxY <= bandTop || s.minY >= bandBottom) continue;
+        bool inside = s.minY >= bandTop && s.maxY <= bandBottom;   // 小さな破片はたいてい帯1つに収まる
+        for (int i = 0; i < s.count; i++) {
+          const FixedPoint& a = points[s.first + i];
+          const FixedPoint& b = points[s.first + (i + 1 < s.count ? i + 1 : 0)];
+          if (inside) clipEdgeX(a.x, a.y - bandTop, b.x, b.y - bandTop);
+          else clipEdgeY(a.x, a.y, b.x, b.y, bandTop, bandBottom);
+        }
+        resolve(s, top, buf, width);
+      }
+    }
+    clear();
+  }
+
+  // 積んだ多角形を塗らずに捨てる
+  void clear() {
+    shapes.clear();
+    points.clear();
+  }
+
+  int pending() const { return (int)shapes.size(); }
+
+private:
+  struct FixedPoint {
+    int32_t x, y;
+  };
+
+  struct Shape {
+    int first, count;
+    uint16_t color;
+    uint16_t opacity;     // 1〜256
+    PolygonFill rule;
+    int32_t minX, minY, maxX, maxY;   // 24.8
+  };
+
+  struct Cell {
+    int32_t cover = 0;
+    int32_t area = 0;
+  };
+
+  std::vector<Cell> cells;   // [帯の行][列]
+  uint32_t touched[POLYGON_BAND_ROWS][POLYGON_MASK_WORDS];   // セルに触れた列
+  std::vector<Shape> shapes;
+  std::vector<FixedPoint> points;
+  int shapeLimit, pointLimit;
+  int16_t clipHalfWidth[SCREEN_HEIGHT];   // 描画範囲の行ごとの半幅（なければ -1）
+
+  static int32_t toFixed(float v) { return (int32_t)floorf(v * POLYGON_ONE + 0.5f); }
+
+  // 切り捨ての商と 0 以上の余り
+  static void divMod(int32_t p, int32_t d, int32_t& q, int32_t& r) {
+    q = p / d;
+    r = p % d;
+    if (r < 0) {
+      q--;
+      r += d;
+    }
+  }
+
+  void addCell(int row, int ex, int32_t a, int32_t c) {
+    Cell& cell = cells[row * POLYGON_CELL_STRIDE + ex];
+    cell.area += a;
+    cell.cover += c;
+    touched[row][ex >> 5] |= 1u << (ex & 31);
+  }
+
+  // ========================================
+  // 辺のクリップ
+  // ========================================
+  // 帯の上下で切る（帯の外の部分はどの行の被覆にも効かない）
+  void clipEdgeY(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t top, int32_t bottom) {
+    if (y1 == y2) return;
+    if ((y1 <= top && y2 <= top) || (y1 >= bottom && y2 >= bottom)) return;
+    int32_t cx1 = x1, cy1 = y1, cx2 = x2, cy2 = y2;
+    if (y1 < top) {
+      cx1 = x1 + (int32_t)((int64_t)(x2 - x1) * (top - y1) / (y2 - y1));
+      cy1 = top;
+    } else if (y1 > bottom) {
+      cx1 = x1 + (int32_t)((int64_t)(x2 - x1) * (bottom - y1) / (y2 - y1));
+      cy1 = bottom;
+    }
+    if (y2 < top) {
+      cx2 = x1 + (int32_t)((int64_t)(x2 - x1) * (top - y1) / (y2 - y1));
+      cy2 = top;
+    } else if (y2 > bottom) {
+      cx2 = x1 + (int32_t)((int64_t)(x2 - x1) * (bottom - y1) / (y2 - y1));
+      cy2 = bottom;
+    }
+    clipEdgeX(cx1, cy1 - top, cx2, cy2 - top);
+  }
+
+  // 画面の左右で切る。外へ出た部分は縁に沿った縦の辺に置き換える
+  // （左へ出た辺は右側の被覆に効くので捨てられない）
+  void clipEdgeX(int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    const int32_t left = 0, right = SCREEN_WIDTH << POLYGON_SUBPIXEL_BITS;
+    if ((x1 < left && x2 > left) || (x1 > left && x2 < left)) {
+      int32_t y = y1 + (int32_t)((int64_t)(y2 - y1) * (left - x1) / (x2 - x1));
+      clipEdgeX(x1, y1, left, y);
+      clipEdgeX(left, y, x2, y2);
+      return;
+    }
+    if ((x1 < right && x2 > right) || (x1 > right && x2 < right)) {
+      int32_t y = y1 + (int32_t)((int64_t)(y2 - y1) * (right - x1) / (x2 - x1));
+      clipEdgeX(x1, y1, right, y);
+      clipEdgeX(right, y, x2, y2);
+      return;
+    }
+    x1 = x1 < left ? left : (x1 > right ? right : x1);
+    x2 = x2 < left ? left : (x2 > right ? right : x2);
+    renderLine(x1, y1, x2, y2);
+  }
+
+  // ========================================
+  // 辺 → セル
+  // ========================================
+  // 帯の中の辺（y は帯の上端からの 24.8）を行ごとに分ける
+  void renderLine(int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    int ey1 = y1 >> POLYGON_SUBPIXEL_BITS;
+    int ey2 = y2 >> POLYGON_SUBPIXEL_BITS;
+    int32_t fy1 = y1 & (POLYGON_ONE - 1);
+    int32_t fy2 = y2 & (POLYGON_ONE - 1);
+
+    if (ey1 == ey2) {
+      renderScanline(ey1, x1, fy1, x2, fy2);
+      return;
+    }
+
+    int32_t dx = x2 - x1, dy = y2 - y1;
+    int32_t p, first, delta, mod;
+    int incr;
+    if (dy > 0) {
+      p = (POLYGON_ONE - fy1) * dx;
+      first = POLYGON_ONE;
+      incr = 1;
+    } else {
+      p = fy1 * dx;
+      first = 0;
+      incr = -1;
+      dy = -dy;
+    }
+    divMod(p, dy, delta, mod);
+    int32_t x = x1 + delta;
+    renderScanline(ey1, x1, fy1, x, first);
+    ey1 += incr;
+
+    if (ey1 != ey2) {
+      int32_t lift, rem;
+      divMod(POLYGON_ONE * dx, dy, lift, rem);
+      mod -= dy;
+      do {
+        delta = lift;
+        mod += rem;
+        if (mod >= 0) {
+          mod -= dy;
+          delta++;
+        }
+        int32_t xNext = x + delta;
+        renderScanline(ey1, x, POLYGON_ONE - first, xNext, first);
+        x = xNext;
+        ey1 += incr;
+      } while (ey1 != ey2);
+    }
+    renderScanline(ey1, x, POLYGON_ONE - first, x2, fy2);
+  }
+
+  // 1行の中の辺（fy は行の中の 0〜256）をセルごとに分ける
+  void renderScanline(int row, int32_t x1, int32_t fy1, int32_t x2, int32_t fy2) {
+    if (fy1 == fy2) return;
+    int ex1 = x1 >> POLYGON_SUBPIXEL_BITS;
+    int ex2 = x2 >> POLYGON_SUBPIXEL_BITS;
+    int32_t fx1 = x1 & (POLYGON_ONE - 1);
+    int32_t fx2 = x2 & (POLYGON_ONE - 1);
+
+    if (ex1 == ex2) {
+      addCell(row, ex1, (fx1 + fx2) * (fy2 - fy1), fy2 - fy1);
+      return;
+    }
+
+    int32_t dx = x2 - x1, dy = fy2 - fy1;
+    int32_t p, first, delta, mod;
+    int incr;
+    if (dx > 0) {
+      p = (POLYGON_ONE - fx1) * dy;
+      first = POLYGON_ONE;
+      incr = 1;
+    } else {
+      p = fx1 * dy;
+      first = 0;
+      incr = -1;
+      dx = -dx;
+    }
+    divMod(p, dx, delta, mod);
+    addCell(row, ex1, (fx1 + first) * delta, delta);
+    fy1 += delta;
+    ex1 += incr;
+
+    if (ex1 != ex2) {
+      int32_t lift, rem;
+      divMod(POLYGON_ONE * dy, dx, lift, rem);
+      mod -= dx;
+      do {
+        delta = lift;
+        mod += rem;
+        if (mod >= 0) {
+          mod -= dx;
+          delta++;
+        }
+        addCell(row, ex1, POLYGON_ONE * delta, delta);
+        fy1 += delta;
+        ex1 += incr;
+      } while (ex1 != ex2);
+    }
+    fx1 = POLYGON_ONE - first;
+    addCell(row, ex2, (fx1 + fx2) * (fy2 - fy1), fy2 - fy1);
+  }
+
+  // ========================================
+  // セル → 画素
+  // ========================================
+  // 被覆（1画素 = 131072）→ 0〜256
+  static int coverageAlpha(int32_t c, PolygonFill rule) {
+    c >>= POLYGON_SUBPIXEL_BITS + 1;
+    if (rule == FILL_NONZERO) {
+      if (c < 0) c = -c;
+      return c > POLYGON_ONE ? POLYGON_ONE : c;
+    }
+    c &= 2 * POLYGON_ONE - 1;
+    return c > POLYGON_ONE ? 2 * POLYGON_ONE - c : c;
+  }
+
+  // RGB565 の3成分を 32bit に離して置く（アルファ 0〜32 を掛けても重ならない）
+  static uint32_t spread565(uint16_t c) { return (c | ((uint32_t)c << 16)) & 0x07E0F81F; }
+
+  static void blendSpan(uint16_t* dst, int from, int to, uint16_t color, uint32_t spread, int alpha) {
+    int a = (alpha + 4) >> 3;   // 0〜32
+    if (a <= 0) return;
+    if (a >= 32) {
+      uint16_t stored = (uint16_t)((color >> 8) | (color << 8));
+      for (int x = from; x < to; x++) dst[x] = stored;
+      return;
+    }
+    for (int x = from; x < to; x++) {
+      uint16_t bg = (uint16_t)((dst[x] >> 8) | (dst[x] << 8));
+      uint32_t mixed = ((spread * a + spread565(bg) * (32 - a) + 0x02008010) >> 5) & 0x07E0F81F;   // 各成分を四捨五入
+      uint16_t out = (uint16_t)(mixed | (mixed >> 16));
+      dst[x] = (uint16_t)((out >> 8) | (out << 8));
+    }
+  }
+
+  // 帯の中の s の行を掃いて塗り、触れたセルを 0 に戻す
+  void resolve(const Shape& s, int top, uint16_t* buf, int width) {
+    const uint32_t spread = spread565(s.color);
+    int rowFirst = (s.minY >> POLYGON_SUBPIXEL_BITS) - top;
+    int rowLast = ((s.maxY - 1) >> POLYGON_SUBPIXEL_BITS) - top;
+    if (rowFirst < 0) rowFirst = 0;
+    if (rowLast >= POLYGON_BAND_ROWS) rowLast = POLYGON_BAND_ROWS - 1;
+    int wordFirst = s.minX > 0 ? (s.minX >> POLYGON_SUBPIXEL_BITS) >> 5 : 0;
+    int wordLast = s.maxX < (SCREEN_WIDTH << POLYGON_SUBPIXEL_BITS) ? (s.maxX >> POLYGON_SUBPIXEL_BITS) >> 5
+                                                                   : POLYGON_MASK_WORDS - 1;
+
+    for (int row = rowFirst; row <= rowLast; row++) {
+      int y = top + row;
+      int half = y < SCREEN_HEIGHT ? clipHalfWidth[y] : -1;
+      int clipLeft = CENTER_X - half, clipRight = CENTER_X + half + 1;   // [clipLeft, clipRight)
+      if (clipRight > width) clipRight = width;
+      Cell* rowCells = cells.data() + row * POLYGON_CELL_STRIDE;
+      uint16_t* dst = buf + y * width;
+
+      int32_t acc = 0;
+      int x = 0;   // ここから次のセルの手前までは被覆が acc で一定
+      for (int w = wordFirst; w <= wordLast; w++) {
+        uint32_t bits = touched[row][w];
+        touched[row][w] = 0;
+        while (bits) {
+          // 続けて触れた列（辺の横切ったセルの並び）をまとめて処理する
+          int start = __builtin_ctz(bits);
+          uint32_t rest = ~(bits >> start);
+          int run = rest ? __builtin_ctz(rest) : 32 - start;
+          bits &= run + start >= 32 ? 0 : ~0u << (run + start);
+          int cx = (w << 5) + start;
+
+          // セルのない区間
+          if (acc != 0 && half >= 0) {
+            int from = x > clipLeft ? x : clipLeft;
+            int to = cx < clipRight ? cx : clipRight;
+            if (from < to) {
+              int alpha = coverageAlpha(acc << (POLYGON_SUBPIXEL_BITS + 1), s.rule);
+              blendSpan(dst, from, to, s.color, spread, (alpha * s.opacity) >> 8);
+            }
+          }
+
+          // セルのある画素
+          for (int end = cx + run; cx < end; cx++) {
+            Cell& cell = rowCells[cx];
+            acc += cell.cover;
+            int32_t c = (acc << (POLYGON_SUBPIXEL_BITS + 1)) - cell.area;
+            cell.cover = 0;
+            cell.area = 0;
+            if (half >= 0 && cx >= clipLeft && cx < clipRight) {
+              int alpha = coverageAlpha(c, s.rule);
+              blendSpan(dst, cx, cx + 1, s.color, spread, (alpha * s.opacity) >> 8);
+            }
+          }
+          x = cx;
+        }
+      }
+    }
+  }
+};
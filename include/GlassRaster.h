@@ -0,0 +1,96 @@
+/**
+ * GlassRaster - LovyanGFX と同じ整数アルゴリズムの直線・円
+ *
+ * 画素の書き先は関数オブジェクトで受け取る（plot(x, y) / hline(x, y, len) /
+ * vline(x, y, len)）。tools/SoftCanvas.h の描画と、OverdrawGfx.h の
+ * 書き込み回数の計測が同じ画素集合を使うためのもの。クリップは書き先の仕事。
+ */
+#pragma once
+
+#include <stdlib.h>
+#include <algorithm>
+
+template <typename Plot>
+void rasterLine(int x0, int y0, int x1, int y1, Plot plot) {
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    std::swap(x0, y0);
+    std::swap(x1, y1);
+  }
+  if (x0 > x1) {
+    std::swap(x0, x1);
+    std::swap(y0, y1);
+  }
+  int dx = x1 - x0;
+  int dy = abs(y1 - y0);
+  int err = dx >> 1;
+  int ystep = (y0 < y1) ? 1 : -1;
+  for (; x0 <= x1; x0++) {
+    if (steep) plot(y0, x0);
+    else plot(x0, y0);
+    err -= dy;
+    if (err < 0) {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+template <typename HLine, typename VLine>
+void rasterCircle(int x, int y, int r, HLine hline, VLine vline) {
+  if (r <= 0) {
+    hline(x, y, 1);
+    return;
+  }
+  int f = 1 - r;
+  int ddF_y = -(r << 1);
+  int ddF_x = 1;
+  int i = 0;
+  int j = -1;
+  do {
+    while (f < 0) {
+      ++i;
+      f += (ddF_x += 2);
+    }
+    f += (ddF_y += 2);
+
+    hline(x - i, y + r, i - j);
+    hline(x - i, y - r, i - j);
+    hline(x + j + 1, y - r, i - j);
+    hline(x + j + 1, y + r, i - j);
+
+    vline(x + r, y + j + 1, i - j);
+    vline(x + r, y - i, i - j);
+    vline(x - r, y - i, i - j);
+    vline(x - r, y + j + 1, i - j);
+    j = i;
+  } while (i < --r);
+}
+
+template <typename HLine>
+void rasterFillCircle(int x, int y, int r, HLine hline) {
+  hline(x - r, y, (r << 1) + 1);
+  if (r <= 0) return;
+  int f = 1 - r;
+  int ddF_y = -(r << 1);
+  int ddF_x = 1;
+  int i = 0;
+  int j = -1;
+  do {
+    while (f < 0) {
+      ++i;
+      f += (ddF_x += 2);
+    }
+    f += (ddF_y += 2);
+
+    // 外周と同じ i/j の進み方で行ごとに塗る
+    hline(x - i, y + r, (i << 1) + 1);
+    hline(x - i, y - r, (i << 1) + 1);
+    for (int k = j + 1; k <= i; k++) {
+      if (k == 0) continue;
+      hline(x - r, y + k, (r << 1) + 1);
+      hline(x - r, y - k, (r << 1) + 1);
+    }
+    j = i;
+  } while (i < --r);
+}
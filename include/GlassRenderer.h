@@ -0,0 +1,280 @@
+/**
+ * GlassRenderer - 状態ごとの描画
+ *
+ * 描画先（Gfx）はテンプレート引数。端末では M5Canvas、ホストでは
+ * tools/SoftCanvas.h を渡すので、同じ描画コードで同じ画が得られる。
+ * Gfx に必要なのは drawLine / drawCircle / fillCircle / color565 のみ
+ * （粉塵を描くときは getBuffer / width / height も）。
+ *
+ * 描画は GlassEngine を読むだけで、シミュレーションの状態は変えない。
+ *
+ * 粉塵は DustField.h の密度グリッドで描く。呼び出し側がこのフレームの
+ * 粉塵を splat 済みの DustField を渡す（nullptr なら粉塵は描かない）。
+ *
+ * 衝撃の跡の画像（CrackDecal.h）は DecalLayer を渡したときだけ、
+ * 線のひびの下に型押しする（nullptr なら線のひびだけ）。
+ * 重ねたガラスの奥の板（GlassPanes.h）も PaneStack を渡したときだけ、
+ * 消去の直後に一番奥に描く。
+ *
+ * 最初の円の消去は、呼び出し側が CircleClear.h で済ませていれば
+ * cleared = true で飛ばせる（端末ではシミュレーション中に DMA で消しておく）。
+ *
+ * markStage() は描画の工程の区切り。通常は何もしないが、計測用の
+ * OverdrawGfx.h を渡したときは工程ごとの書き込み画素数を数える。
+ */
+#pragma once
+
+#include "CrackDecal.h"
+#include "DustField.h"
+#include "GlassEngine.h"
+#include "GlassPanes.h"
+
+#include <math.h>
+
+const uint16_t GLASS_COLOR_BLACK = 0x0000;
+const uint16_t GLASS_COLOR_DARKGREY = 0x7BEF;  // TFT_DARKGREY
+
+// 毎フレーム消去する範囲。外側の縁は GlassGauge が差分で描くので残す
+// （破片の中心は GLASS_RIM_RADIUS - サイズ で跳ね返るので、描くのは縁 + 丸め誤差の内側まで。
+//  test/test_clear_disc で確かめている）
+const int GLASS_CLEAR_RADIUS = 116;
+
+// 粉塵の描画範囲（双一次の広がりが消去円からはみ出さないように）
+const int GLASS_DUST_RADIUS = GLASS_CLEAR_RADIUS - 1;
+
+// ========================================
+// 描画の工程（計測用の区切り）
+// ========================================
+enum RenderStage {
+  STAGE_CLEAR,       // 消去
+  STAGE_GLASS,       // ガラスの縁
+  STAGE_CRACKS,      // ひび割れ
+  STAGE_DUST,        // 粉塵（密度グリッドの合成）
+  STAGE_PARTICLES,   // 粒子
+  STAGE_TRAILS,      // 修復中の軌跡
+  STAGE_LIGHT,       // フラッシュ・中央の光
+  STAGE_OVERLAY,     // ゲージ・HUD など
+  STAGE_COUNT
+};
+
+inline const char* renderStageName(int stage) {
+  static const char* NAMES[STAGE_COUNT] = {"clear", "glass", "cracks", "dust", "particles",
+                                           "trails", "light", "overlay"};
+  return NAMES[stage];
+}
+
+template <typename Gfx>
+void markStage(Gfx&, RenderStage) {}
+
+// 粉塵（破片より奥に描く）
+template <typename Gfx>
+void renderDust(Gfx& gfx, const GlassEngine& engine, DustField* dust) {
+  if (!dust || engine.dustLevel <= 0.0f) return;
+  markStage(gfx, STAGE_DUST);
+  dust->composite(gfx, engine.dustLevel);
+}
+
+// 衝撃の跡の画像（線のひびより奥に描く）
+template <typename Gfx>
+void renderDecals(Gfx& gfx, const GlassEngine& engine, DecalLayer* decals, uint16_t color, uint8_t opacity) {
+  if (!decals || engine.decals.empty()) return;
+  markStage(gfx, STAGE_CRACKS);
+  decals->draw(gfx, engine.decals, color, opacity);
+}
+
+// ========================================
+// NORMAL状態の描画
+// ========================================
+template <typename Gfx>
+void renderNormal(Gfx& gfx, const GlassEngine& engine, unsigned long now) {
+  // 完全透明な静止画面
+  // 中央に薄く円を描画（ガラスの存在を示唆）
+  markStage(gfx, STAGE_GLASS);
+  gfx.drawCircle(CENTER_X, CENTER_Y, 80, GLASS_COLOR_DARKGREY);
+  gfx.drawCircle(CENTER_X, CENTER_Y, 81, GLASS_COLOR_DARKGREY);
+
+  // 呼吸するような光（自動修復後の余韻）
+  if (now - engine.stateStartTime < 2000) {
+    markStage(gfx, STAGE_LIGHT);
+    float breathe = sin((now - engine.stateStartTime) * 0.003f) * 0.5f + 0.5f;
+    uint8_t brightness = (uint8_t)(breathe * 30);
+    uint32_t color = gfx.color565(brightness, brightness, brightness + 20);
+    gfx.fillCircle(CENTER_X, CENTER_Y, 5, color);
+  }
+}
+
+// ========================================
+// CRACK状態の描画（ひび割れ）
+// ========================================
+template <typename Gfx>
+void renderCrack(Gfx& gfx, const GlassEngine& engine, unsigned long /* now */, DecalLayer* decals) {
+  // ベースガラス
+  markStage(gfx, STAGE_GLASS);
+  gfx.drawCircle(CENTER_X, CENTER_Y, 80, GLASS_COLOR_DARKGREY);
+
+  renderDecals(gfx, engine, decals, (uint16_t)gfx.color565(200, 210, 255), 255);
+
+  // ひび割れ描画（生成・分岐は GlassEngine 側）
+  markStage(gfx, STAGE_CRACKS);
+  for (auto& crack : engine.cracks) {
+    if (crack.active) {
+      uint32_t color = gfx.color565(200, 200, 255);
+      gfx.drawLine((int)crack.startX, (int)crack.startY,
+                   (int)crack.endX, (int)crack.endY, color);
+    }
+  }
+}
+
+// ========================================
+// SHATTER状態の描画（粉砕）
+// ========================================
+template <typename Gfx>
+void renderShatter(Gfx& gfx, const GlassEngine& engine, unsigned long now, DustField* dust, DecalLayer* decals) {
+  renderDecals(gfx, engine, decals, (uint16_t)gfx.color565(180, 180, 220), 220);
+
+  // 全てのひび割れを描画
+  markStage(gfx, STAGE_CRACKS);
+  for (auto& crack : engine.cracks) {
+    uint32_t color = gfx.color565(180, 180, 220);
+    gfx.drawLine((int)crack.startX, (int)crack.startY,
+                 (int)crack.endX, (int)crack.endY, color);
+  }
+
+  // 粒子描画
+  renderDust(gfx, engine, dust);
+  markStage(gfx, STAGE_PARTICLES);
+  for (auto& p : engine.particles) {
+    if (p.active) {
+      uint8_t alpha = (uint8_t)(p.alpha * 255);
+      uint32_t color = gfx.color565(alpha, alpha, alpha);
+      gfx.fillCircle((int)p.x, (int)p.y, (int)p.size, color);
+    }
+  }
+
+  // フラッシュ効果（粉砕直後）
+  if (now - engine.stateStartTime < 200) {
+    markStage(gfx, STAGE_LIGHT);
+    float flash = 1.0f - (now - engine.stateStartTime) / 200.0f;
+    uint8_t brightness = (uint8_t)(flash * 100);
+    gfx.fillCircle(CENTER_X, CENTER_Y, 50,
+                   gfx.color565(brightness, brightness, brightness));
+  }
+}
+
+// ========================================
+// SILENCE状態の描画（余韻）
+// ========================================
+template <typename Gfx>
+void renderSilence(Gfx& gfx, const GlassEngine& engine, unsigned long /* now */, DustField* dust) {
+  // 残光の粒子と漂う粉塵のみ
+  renderDust(gfx, engine, dust);
+  markStage(gfx, STAGE_PARTICLES);
+  for (auto& p : engine.particles) {
+    if (p.active && p.alpha > 0.3f) {
+      uint8_t brightness = (uint8_t)(p.alpha * 150);
+      uint32_t color = gfx.color565(brightness, brightness, brightness + 50);
+      gfx.fillCircle((int)p.x, (int)p.y, (int)p.size, color);
+    }
+  }
+}
+
+// ========================================
+// REBUILD状態の描画（修復）
+// ========================================
+template <typename Gfx>
+void renderRebuild(Gfx& gfx, const GlassEngine& engine, unsigned long /* now */, DustField* dust, DecalLayer* decals) {
+  // ひび割れが徐々に消える（減衰は GlassEngine 側）
+  renderDecals(gfx, engine, decals, (uint16_t)gfx.color565(200, 200, 255), 255);
+  markStage(gfx, STAGE_CRACKS);
+  for (auto& crack : engine.cracks) {
+    if (crack.alpha > 0.1f) {
+      uint8_t brightness = (uint8_t)(crack.alpha * 200);
+      uint32_t color = gfx.color565(brightness, brightness, 255);
+      gfx.drawLine((int)crack.startX, (int)crack.startY,
+                   (int)crack.endX, (int)crack.endY, color);
+    }
+  }
+
+  // 粒子が中央に集まる
+  renderDust(gfx, engine, dust);
+  for (auto& p : engine.particles) {
+    if (p.active) {
+      markStage(gfx, STAGE_PARTICLES);
+      uint32_t color = gfx.color565(180, 200, 255);
+      gfx.fillCircle((int)p.x, (int)p.y, (int)p.size, color);
+
+      // トレイル効果
+      markStage(gfx, STAGE_TRAILS);
+      gfx.drawLine((int)p.x, (int)p.y, CENTER_X, CENTER_Y,
+                   gfx.color565(50, 50, 100));
+    }
+  }
+
+  // 中央の光
+  markStage(gfx, STAGE_LIGHT);
+  float intensity = 1.0f - engine.destructionLevel;
+  uint8_t brightness = (uint8_t)(intensity * 100);
+  gfx.fillCircle(CENTER_X, CENTER_Y, 10,
+                 gfx.color565(brightness, brightness, brightness + 50));
+}
+
+// ========================================
+// RECOVERY状態の描画（完全修復）
+// ========================================
+template <typename Gfx>
+void renderRecovery(Gfx& gfx, const GlassEngine& engine, unsigned long now) {
+  // フェードイン効果で透明ガラスに戻る
+  float progress = (now - engine.stateStartTime) / (float)engine.config.recoveryDuration;
+  uint8_t brightness = (uint8_t)((1.0f - progress) * 150);
+
+  // 中央の光が広がる
+  markStage(gfx, STAGE_LIGHT);
+  int radius = (int)(progress * 80);
+  gfx.drawCircle(CENTER_X, CENTER_Y, radius,
+                 gfx.color565(brightness, brightness, brightness + 30));
+
+  // 最終的な光の明滅
+  if (progress > 0.7f) {
+    float pulse = sin((now - engine.stateStartTime) * 0.01f) * 0.5f + 0.5f;
+    uint8_t pulseBright = (uint8_t)(pulse * 80);
+    gfx.fillCircle(CENTER_X, CENTER_Y, 5,
+                   gfx.color565(pulseBright, pulseBright, pulseBright + 50));
+  }
+}
+
+// ========================================
+// 1フレーム分の描画
+// ========================================
+template <typename Gfx>
+void renderGlass(Gfx& gfx, const GlassEngine& engine, unsigned long now, DustField* dust = nullptr,
+                 DecalLayer* decals = nullptr, PaneStack* panes = nullptr, bool cleared = false) {
+  markStage(gfx, STAGE_CLEAR);
+  if (!cleared) gfx.fillCircle(CENTER_X, CENTER_Y, GLASS_CLEAR_RADIUS, GLASS_COLOR_BLACK);
+
+  // 奥の板（手前の板の状態によらず見えている）
+  if (panes && engine.activePane + 1 < engine.config.paneCount) {
+    markStage(gfx, STAGE_GLASS);
+    panes->draw(gfx, engine);
+  }
+
+  switch (engine.currentState) {
+    case NORMAL:
+      renderNormal(gfx, engine, now);
+      break;
+    case CRACK:
+      renderCrack(gfx, engine, now, decals);
+      break;
+    case SHATTER:
+      renderShatter(gfx, engine, now, dust, decals);
+      break;
+    case SILENCE:
+      renderSilence(gfx, engine, now, dust);
+      break;
+    case REBUILD:
+      renderRebuild(gfx, engine, now, dust, decals);
+      break;
+    case RECOVERY:
+      renderRecovery(gfx, engine, now);
+      break;
+  }
+}
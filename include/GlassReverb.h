@@ -0,0 +1,70 @@
+/**
+ * GlassReverb - 粒状音の響き（固定小数点のフィードバック遅延ネットワーク）
+ *
+ * 長さの違う REVERB_LINES 本の遅延線の出力を、高域の減衰（1次ローパス）と
+ * 残響時間に合わせた減衰をかけてから Hadamard 行列で混ぜ、入力と足して
+ * 遅延線へ戻す。ひびや粉砕の音が小さな硬い部屋のように尾を引く。
+ *
+ * 遅延線はどれもブロック長（GRAIN_BLOCK_SAMPLES）より長いので、1ブロック分の
+ * 遅延線の出力は処理の前にすべて揃っている。そのため処理は
+ *   読み出し・減衰（遅延線ごと）→ Hadamard（ブロック全体へ加減算）→ 書き戻し
+ * の順に、サンプルではなくブロック単位の配列演算で進める。
+ * 値は Q15（int16 の遅延線、int32 の作業領域）で、浮動小数点は使わない。
+ *
+ * 遅延線の記憶領域（storageSamples() 個の int16）は呼び出し側が渡す
+ * （端末では PSRAM）。Arduino に依存しないので、ホストでも同じ音を作れる。
+ */
+#pragma once
+
+#include "GrainSynth.h"
+
+#include <stdint.h>
+
+// ========================================
+// 定数
+// ========================================
+const int REVERB_LINES = 8;
+const float REVERB_RT60 = 1.6f;             // 残響時間（-60dB まで）[s]
+const float REVERB_DAMPING_HZ = 6000.0f;    // 遅延線ごとのローパスの遮断周波数
+const float REVERB_SEND = 0.5f;             // 入力を遅延線へ送る量
+const float REVERB_WET = 0.35f;             // 響きを元の音へ足す量
+const int REVERB_SILENT = 4;                // 遅延線の値がこれ未満のまま1周したら止める [LSB]
+
+class GlassReverb {
+public:
+  GlassReverb();
+
+  // 遅延線の合計サンプル数
+  static int storageSamples();
+
+  // 遅延線の記憶領域（storageSamples() 個）を渡して無音から始める
+  void begin(int16_t* storage);
+
+  // 遅延線を無音に戻す
+  void clear();
+
+  // samples 個（GRAIN_BLOCK_SAMPLES 以下ずつに分ける）の out に響きを足す
+  void process(int16_t* out, int samples);
+
+  // 響きがまだ残っているか（false なら process() を呼ばなくてよい）
+  bool ringing() const { return active; }
+
+private:
+  int16_t* lines[REVERB_LINES];
+  int length[REVERB_LINES];
+  int position[REVERB_LINES];        // 次に読む（= 書く）位置
+  int32_t gain[REVERB_LINES];        // 1周分の減衰 / sqrt(N)（Q15）
+  int32_t lowpass[REVERB_LINES];     // ローパスの状態
+  int32_t damping;                   // ローパスの係数（Q15）
+  int32_t send;                      // Q15
+  int32_t wet;                       // Q15（/ sqrt(N) 込み）
+  bool active;
+  int quietSamples;                  // 遅延線へ小さな値だけを書き続けたサンプル数
+
+  // ブロック分の作業領域（遅延線ごと・配列の構造体）
+  int32_t work[REVERB_LINES][GRAIN_BLOCK_SAMPLES];
+  int32_t tap[GRAIN_BLOCK_SAMPLES];   // 遅延線の出力の和（響き）
+  int32_t sent[GRAIN_BLOCK_SAMPLES];  // 遅延線へ送る入力
+
+  void processBlock(int16_t* out, int samples);
+};
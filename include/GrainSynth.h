@@ -0,0 +1,112 @@
+/**
+ * GrainSynth - 衝突から作る粒状音（ガラス片の「チリン」）
+ *
+ * GlassEngine が積んだ ImpactEvent を GrainScheduler が1フレームごとに
+ * 破片サイズの帯域でまとめ、上限つきの GrainRequest に減らす。
+ * GrainMixer は減衰する部分音（正弦）の集まりとして粒を合成する。
+ *
+ *   破片が小さい → 高い音、衝突が速い → 大きい音
+ *   衝突が1000回あっても、1フレームに鳴らす粒は GRAIN_MAX_PER_FRAME 個まで
+ *
+ * Arduino に依存しないので、ホストでも同じ音を作れる。
+ */
+#pragma once
+
+#include "GlassEngine.h"
+
+#include <stdint.h>
+#include <vector>
+
+// ========================================
+// 定数
+// ========================================
+const int GRAIN_SAMPLE_RATE = 44100;
+const int GRAIN_BLOCK_SAMPLES = 256;          // 約5.8ms
+const int GRAIN_MAX_VOICES = 16;              // 同時発音数
+const int GRAIN_PARTIALS = 3;                 // 1粒あたりの部分音
+const int GRAIN_MAX_PER_FRAME = 6;            // 1フレームで鳴らす粒の上限
+const int GRAIN_SIZE_BANDS = 8;               // サイズ帯域（まとめる単位）
+const float GRAIN_RATE_PER_SEC = 90.0f;       // 粒の平均発生レートの上限
+const float GRAIN_BURST = 12.0f;              // 一度に使える発生枠
+const int GRAIN_MAX_PENDING = 16;             // 1回の render() の途中から鳴らす粒の上限
+
+// 粒を鳴らす声の種類
+enum GrainVoice : uint8_t {
+  GRAIN_VOICE_SYNTH,    // GrainMixer（減衰する部分音）
+  GRAIN_VOICE_SAMPLE,   // SamplePlayer（ガラス音の音程を変えて再生）
+};
+
+// ========================================
+// 1粒分の発音要求
+// ========================================
+struct GrainRequest {
+  float frequency;      // 基音 [Hz]
+  float amplitude;      // 0.0 ~ 1.0
+  float decay;          // 基音の減衰時間 [s]
+  uint32_t eventMicros; // 衝突が起きた時刻（遅延計測用）
+  uint32_t startMicros; // 鳴らし始める時刻（対応するフレームの表示の見込み）
+  uint32_t frame;       // 対応する描画フレーム（表示とのずれの計測用）
+  GrainVoice voice;     // どの声で鳴らすか
+};
+
+// ========================================
+// 衝突 → 粒のまとめ役
+// ========================================
+class GrainScheduler {
+public:
+  GrainScheduler();
+
+  // 1フレーム分の衝突をまとめて out に書き、粒の数を返す（最大 GRAIN_MAX_PER_FRAME）
+  int schedule(const std::vector<ImpactEvent>& impacts, unsigned long nowMs,
+               uint32_t eventMicros, GrainRequest* out);
+
+  // 統計（累計）
+  uint32_t impactsSeen;
+  uint32_t grainsScheduled;
+  uint32_t grainsLimited;   // レート制限・フレーム上限で捨てた粒
+
+private:
+  float tokens;
+  unsigned long lastMs;
+  GlassRandom rng;
+};
+
+// ========================================
+// 粒の合成とミックス
+// ========================================
+class GrainMixer {
+public:
+  GrainMixer();
+
+  // 粒を1つ鳴らし始める。空きがなければ一番小さい声を置き換える
+  void start(const GrainRequest& grain);
+
+  // 次の render() の offset サンプル目から鳴らし始める（4サンプル単位に切り下げ）。
+  // 予約が一杯なら先頭から鳴らす
+  void startAt(const GrainRequest& grain, int offset);
+
+  // samples 個（4の倍数）を out に書く。無音でも 0 を書く
+  void render(int16_t* out, int samples);
+
+  int activeVoices() const;   // startAt() の予約を含む
+
+  uint32_t voiceSteals;
+
+private:
+  // 部分音ごとの状態を構造体の配列ではなく配列の構造体で持つ
+  // （レーン = 声 * GRAIN_PARTIALS + 部分音）
+  static const int LANES = GRAIN_MAX_VOICES * GRAIN_PARTIALS;
+  float stateRe[LANES];
+  float stateIm[LANES];
+  float step4Re[4][LANES];  // 1〜4サンプル先への回転（減衰込み）
+  float step4Im[4][LANES];
+  float mix[GRAIN_BLOCK_SAMPLES];
+
+  // startAt() の予約（offset の小さい順）
+  GrainRequest pending[GRAIN_MAX_PENDING];
+  int pendingOffset[GRAIN_MAX_PENDING];
+  int pendingCount;
+
+  float voiceLevel(int voice) const;
+  void renderLanes(int from, int to);
+};
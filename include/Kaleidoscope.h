@@ -0,0 +1,101 @@
+/**
+ * Kaleidoscope - 扇形1つの描画を6方向へ映す（万華鏡モード）
+ *
+ * GlassConfig::kaleidoscope のとき、GlassEngine はひび・破片・粉塵を
+ * +x から時計回りに 60度の扇形の中だけで動かす。renderGlass() の後で
+ * apply() を呼ぶと、扇形の画素を残りの5つの扇形へ回転・鏡映しして写す。
+ * 奇数番目の扇形は鏡像なので、境目の辺で模様がつながる。
+ *
+ * 画素ごとの写し元は起動時に表（uint16_t の画素番号）にしておき、
+ * 毎フレームは行ごとに表を引いて写すだけ（三角関数も条件分岐もない）。
+ * 写し元はすべて扇形の中の画素に丸めてあるので、同じバッファの上で写せる。
+ * 表は半径 radius の円の中の、扇形の外の画素の数だけ（半径 116 で約 35,000 個、70KB）。
+ *
+ * フレームバッファへ直接書くので、Gfx は getBuffer / width を持つこと
+ * （M5Canvas / SoftCanvas / OverdrawGfx。OverdrawGfx には写した区間を countSpan で知らせる）。
+ */
+#pragma once
+
+#include "GlassEngine.h"
+#include "OverdrawHook.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+
+class KaleidoscopeMirror {
+public:
+  explicit KaleidoscopeMirror(int radius) {
+    const float sectorAngle = 6.2831853f / KALEIDOSCOPE_SECTORS;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+      Row& row = rows[y];
+      int dy = y - CENTER_Y;
+      row.x0 = 0;
+      row.count = 0;
+      row.first = (uint32_t)source.size();
+      if (dy * dy > radius * radius) continue;
+      int half = (int)sqrtf((float)(radius * radius - dy * dy));
+      row.x0 = (int16_t)(CENTER_X - half);
+      int x1 = CENTER_X + half;
+      // 扇形は行の右端までの1区間なので、その手前までを写す
+      while (x1 >= row.x0 && inSector(x1 - CENTER_X, dy)) x1--;
+      row.count = (int16_t)(x1 - row.x0 + 1);
+
+      for (int x = row.x0; x <= x1; x++) {
+        int dx = x - CENTER_X;
+        float r = sqrtf((float)(dx * dx + dy * dy));
+        float theta = atan2f((float)dy, (float)dx);
+        if (theta < 0) theta += 6.2831853f;
+        int sector = (int)(theta / sectorAngle);
+        if (sector >= KALEIDOSCOPE_SECTORS) sector = KALEIDOSCOPE_SECTORS - 1;
+        float phi = theta - sector * sectorAngle;
+        if (sector & 1) phi = sectorAngle - phi;
+
+        // 丸めで扇形（または円）の外に出たら、少し内側・扇形の中ほど寄りに取り直す
+        int sx = 0, sy = 0;
+        for (int attempt = 0; attempt < 16; attempt++) {
+          float pull = attempt * 0.5f / (r > 1.0f ? r : 1.0f);
+          float a = phi + (phi < sectorAngle / 2 ? pull : -pull);
+          float rr = r - attempt * 0.25f;
+          sx = (int)lroundf(rr * cosf(a));
+          sy = (int)lroundf(rr * sinf(a));
+          if (inSector(sx, sy) && sx <= maxHalf(sy, radius)) break;
+        }
+        source.push_back((uint16_t)((CENTER_Y + sy) * SCREEN_WIDTH + CENTER_X + sx));
+      }
+    }
+  }
+
+  // 扇形の画素を残りの扇形へ写す
+  template <typename Gfx>
+  void apply(Gfx& gfx) const {
+    uint16_t* buf = (uint16_t*)gfx.getBuffer();
+    const int width = gfx.width();
+    const uint16_t* from = source.data();
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+      const Row& row = rows[y];
+      uint16_t* dst = buf + y * width + row.x0;
+      const uint16_t* src = from + row.first;
+      for (int i = 0; i < row.count; i++) dst[i] = buf[src[i]];
+      countSpan(gfx, row.x0, y, row.count);
+    }
+  }
+
+  size_t tableBytes() const { return source.size() * sizeof(uint16_t) + sizeof(rows); }
+
+private:
+  struct Row {
+    int16_t x0;       // 写す区間の左端
+    int16_t count;    // 写す画素数（0 = 写さない）
+    uint32_t first;   // source の先頭
+  };
+  Row rows[SCREEN_HEIGHT];
+  std::vector<uint16_t> source;   // 写し元の画素番号（y * SCREEN_WIDTH + x）
+
+  // 扇形（+x から 0 ~ 60度、y は下向き）の中か
+  static bool inSector(int dx, int dy) { return dy >= 0 && dy <= dx * 1.7320508f; }
+
+  static int maxHalf(int dy, int radius) {
+    return dy * dy <= radius * radius ? (int)sqrtf((float)(radius * radius - dy * dy)) : -1;
+  }
+};
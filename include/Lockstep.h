@@ -0,0 +1,343 @@
+/**
+ * Lockstep - 2台のダイヤルで同じガラスを動かすロックステップ通信
+ *
+ * 状態は送らず、入力と乱数の種だけを交換する。両方が同じ種・同じ入力列・
+ * 同じ時刻列（フレーム番号 × LOCKSTEP_FRAME_MS）で GlassEngine を進めるので、
+ * 片方の回転でもう片方のガラスも同じように割れる（同じ機種どうしのときに限る。
+ * sinf などの実装が違う端末とホストの間では一致しない）。
+ *
+ * フレーム f の入力 = 両方の f 番目の入力の和（ボタンは種の小さい側を優先）。
+ * 手元の入力は inputDelay フレーム後の分として送り、相手の分が届くまで進めない。
+ * 相手が遅れているときは手元の入力を先へ送りすぎず、溜めて次に送る
+ * （入力の遅れは inputDelay フレーム + 相手の遅れ）。
+ *
+ * パケット: [0x7E][長さ][本体][CRC-8]。本体の先頭1バイトのビット:
+ *   0-2 ボタン  3 回転量あり（zigzag の LEB128）  4 チェックあり  5 HELLO
+ *   6 PING（u16 送信時刻 ms）  7 PONG（受け取った PING の時刻をそのまま返す）
+ * 入力のパケットはフレーム番号を持たず、届いた順に 1フレームずつ進む。
+ * HELLO は入力を持たず、u32 の種と、相手の HELLO を受け取ったかの1バイトを持つ。
+ * チェックは checkInterval フレームごとの状態のハッシュ（GlassEngine::stateHash）を
+ * 16ビットに畳んだものと、前のチェックからのフレーム数（LEB128、ふつう1バイト）。
+ * 何もない1フレームは4バイト（60fps で 240 バイト/秒）。
+ *
+ * UART は順序を保つが、化けたパケット（CRC 不一致）は数えて捨てるだけで再送しない。
+ * 入力が抜けるとフレームがずれ、次のチェックで不一致（desyncFrame）として分かる。
+ * 通信路には依らない（端末は Serial1、ホストは疑似端末 tools/lockstep_sim.cpp）。
+ */
+#pragma once
+
+#include "GlassEngine.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <deque>
+#include <vector>
+
+const uint8_t LOCKSTEP_SYNC = 0x7E;
+const int LOCKSTEP_FRAME_MS = 16;            // ロックステップの1フレームの時刻の進み
+const unsigned long LOCKSTEP_START_TIME = 1000;  // フレーム 0 の時刻（両方で同じ）
+const int LOCKSTEP_MAX_BODY = 24;
+
+const uint8_t LOCKSTEP_BUTTON_MASK = 0x07;
+const uint8_t LOCKSTEP_HAS_DELTA = 0x08;
+const uint8_t LOCKSTEP_HAS_CHECK = 0x10;
+const uint8_t LOCKSTEP_HELLO = 0x20;
+const uint8_t LOCKSTEP_PING = 0x40;
+const uint8_t LOCKSTEP_PONG = 0x80;
+
+struct LockstepStats {
+  uint32_t bytesSent = 0;
+  uint32_t bytesReceived = 0;
+  uint32_t packetsSent = 0;
+  uint32_t packetsReceived = 0;
+  uint32_t badPackets = 0;       // CRC・長さの不一致
+  uint32_t stalls = 0;           // 相手の入力待ちで進めなかった回数
+  uint32_t checksMatched = 0;
+  int32_t desyncFrame = -1;      // 最初に状態が食い違ったフレーム（-1 = なし）
+  uint32_t rttSumMs = 0;
+  uint32_t rttCount = 0;
+  uint32_t rttMaxMs = 0;
+};
+
+class LockstepLink {
+public:
+  LockstepLink(uint32_t localSeed, int inputDelay = 4, int checkInterval = 30)
+      : frame(0), localSeed(localSeed), peerSeed(0), inputDelay(inputDelay), checkInterval(checkInterval),
+        gotPeerHello(false), started(false), localNext(inputDelay), pending({0, BUTTON_NONE}),
+        lastCheckSent(0), checkQueued(false), queuedCheckFold(0), queuedCheckFrame(0), lastCheckReceived(0),
+        pongPending(false), pongValue(0), parse(PARSE_SYNC), parseLength(0) {}
+
+  uint32_t frame;        // 次に進めるフレーム
+  LockstepStats stats;
+
+  bool connected() const { return started; }
+
+  // 両方の種から作る、このセッションの種（connected() の後）
+  uint32_t sessionSeed() const { return localSeed ^ peerSeed ^ 0x5A17D1A1u; }
+
+  // 次に送る手元の入力のフレーム（送った分は frame から localFrame() - 1 まで）
+  uint32_t localFrame() const { return localNext; }
+
+  unsigned long frameTime(uint32_t f) const { return LOCKSTEP_START_TIME + (unsigned long)f * LOCKSTEP_FRAME_MS; }
+
+  // 受け取ったバイト列（パケットの途中で切れていてよい）
+  void receive(const uint8_t* data, size_t length, uint32_t nowMs) {
+    stats.bytesReceived += (uint32_t)length;
+    for (size_t i = 0; i < length; i++) parseByte(data[i], nowMs);
+  }
+
+  // 1フレームに1回。つながる前は HELLO を、つながった後は手元の入力を送る
+  void sendLocal(const GlassInput& input, uint32_t nowMs) {
+    if (!started) {
+      sendHello();
+      return;
+    }
+    pending.encoderDelta += input.encoderDelta;
+    if (input.button != BUTTON_NONE) pending.button = input.button;
+    // 相手が遅れていたら、遅れの上限を超えて先の分は送らない
+    if (localNext > frame + (uint32_t)inputDelay) return;
+
+    uint8_t body[LOCKSTEP_MAX_BODY];
+    int n = 1;
+    body[0] = (uint8_t)(pending.button & LOCKSTEP_BUTTON_MASK);
+    if (pending.encoderDelta != 0) {
+      body[0] |= LOCKSTEP_HAS_DELTA;
+      n += putVarint(body + n, zigzag(pending.encoderDelta));
+    }
+    if (checkQueued) {
+      body[0] |= LOCKSTEP_HAS_CHECK;
+      n += putVarint(body + n, queuedCheckFrame - lastCheckSent);
+      body[n++] = (uint8_t)queuedCheckFold;
+      body[n++] = (uint8_t)(queuedCheckFold >> 8);
+      lastCheckSent = queuedCheckFrame;
+      checkQueued = false;
+    }
+    if (stats.packetsSent % 30 == 0) {
+      body[0] |= LOCKSTEP_PING;
+      body[n++] = (uint8_t)nowMs;
+      body[n++] = (uint8_t)(nowMs >> 8);
+    }
+    if (pongPending) {
+      body[0] |= LOCKSTEP_PONG;
+      body[n++] = (uint8_t)pongValue;
+      body[n++] = (uint8_t)(pongValue >> 8);
+      pongPending = false;
+    }
+    local.push_back(pending);
+    localNext++;
+    pending = {0, BUTTON_NONE};
+    emit(body, n);
+  }
+
+  // frame の入力が両方そろっていれば合成して返し、frame を進める
+  bool nextInput(GlassInput& combined) {
+    if (!started) return false;
+    if (frame < (uint32_t)inputDelay) {
+      combined = {0, BUTTON_NONE};
+      frame++;
+      return true;
+    }
+    if (local.empty() || remote.empty()) {
+      stats.stalls++;
+      return false;
+    }
+    const GlassInput& mine = local.front();
+    const GlassInput& theirs = remote.front();
+    const GlassInput& first = localSeed <= peerSeed ? mine : theirs;
+    const GlassInput& second = localSeed <= peerSeed ? theirs : mine;
+    combined.encoderDelta = mine.encoderDelta + theirs.encoderDelta;
+    combined.button = first.button != BUTTON_NONE ? first.button : second.button;
+    local.pop_front();
+    remote.pop_front();
+    frame++;
+    return true;
+  }
+
+  // 進めたフレーム（frame - 1）の状態のハッシュ。checkInterval ごとに相手と比べる
+  void checkState(uint32_t hash) {
+    uint32_t f = frame - 1;
+    if (f % (uint32_t)checkInterval != 0) return;
+    uint16_t fold = (uint16_t)(hash ^ (hash >> 16));
+    localChecks.push_back({f, fold});
+    if (localChecks.size() > 16) localChecks.pop_front();
+    queuedCheckFrame = f;
+    queuedCheckFold = fold;
+    checkQueued = true;
+    compareChecks();
+  }
+
+  // 送るバイト列（呼び出し側が書き出したら clear する）
+  std::vector<uint8_t> outgoing;
+
+private:
+  struct Check {
+    uint32_t frame;
+    uint16_t fold;
+  };
+
+  uint32_t localSeed, peerSeed;
+  int inputDelay, checkInterval;
+  bool gotPeerHello, started;
+  uint32_t localNext;               // 次に送る手元の入力のフレーム
+  std::deque<GlassInput> local, remote;  // frame からの入力
+  GlassInput pending;               // まだ送っていない手元の入力（溜めた分）
+  uint32_t lastCheckSent;
+  bool checkQueued;
+  uint16_t queuedCheckFold;
+  uint32_t queuedCheckFrame;
+  uint32_t lastCheckReceived;
+  std::deque<Check> localChecks, remoteChecks;
+  bool pongPending;
+  uint16_t pongValue;
+
+  enum ParseState { PARSE_SYNC, PARSE_LENGTH, PARSE_BODY, PARSE_CRC };
+  ParseState parse;
+  int parseLength;
+  std::vector<uint8_t> parseBody;
+
+  void sendHello() {
+    uint8_t body[6] = {LOCKSTEP_HELLO, (uint8_t)localSeed, (uint8_t)(localSeed >> 8), (uint8_t)(localSeed >> 16),
+                       (uint8_t)(localSeed >> 24), (uint8_t)(gotPeerHello ? 1 : 0)};
+    emit(body, sizeof(body));
+  }
+
+  void emit(const uint8_t* body, int length) {
+    size_t start = outgoing.size();
+    outgoing.push_back(LOCKSTEP_SYNC);
+    outgoing.push_back((uint8_t)length);
+    outgoing.insert(outgoing.end(), body, body + length);
+    outgoing.push_back(crc8(outgoing.data() + start + 1, length + 1));
+    stats.bytesSent += (uint32_t)(outgoing.size() - start);
+    stats.packetsSent++;
+  }
+
+  void parseByte(uint8_t b, uint32_t nowMs) {
+    switch (parse) {
+      case PARSE_SYNC:
+        if (b == LOCKSTEP_SYNC) parse = PARSE_LENGTH;
+        break;
+      case PARSE_LENGTH:
+        if (b == 0 || b > LOCKSTEP_MAX_BODY) {
+          stats.badPackets++;
+          parse = b == LOCKSTEP_SYNC ? PARSE_LENGTH : PARSE_SYNC;
+          break;
+        }
+        parseLength = b;
+        parseBody.clear();
+        parse = PARSE_BODY;
+        break;
+      case PARSE_BODY:
+        parseBody.push_back(b);
+        if ((int)parseBody.size() == parseLength) parse = PARSE_CRC;
+        break;
+      case PARSE_CRC: {
+        parse = PARSE_SYNC;
+        uint8_t check[LOCKSTEP_MAX_BODY + 1];
+        check[0] = (uint8_t)parseLength;
+        for (int i = 0; i < parseLength; i++) check[i + 1] = parseBody[i];
+        if (crc8(check, parseLength + 1) != b) {
+          stats.badPackets++;
+          break;
+        }
+        stats.packetsReceived++;
+        handlePacket(parseBody.data(), parseLength, nowMs);
+        break;
+      }
+    }
+  }
+
+  void handlePacket(const uint8_t* body, int length, uint32_t nowMs) {
+    uint8_t head = body[0];
+    int p = 1;
+    if (head & LOCKSTEP_HELLO) {
+      if (length < 6) return;
+      peerSeed = body[1] | (body[2] << 8) | (body[3] << 16) | ((uint32_t)body[4] << 24);
+      gotPeerHello = true;
+      // 相手がこちらの HELLO を受け取っていれば始める（最後にもう一度 HELLO を返す）
+      if (body[5] && !started) {
+        sendHello();
+        started = true;
+      }
+      return;
+    }
+    if (!started) return;
+
+    GlassInput input = {0, (ButtonInput)(head & LOCKSTEP_BUTTON_MASK)};
+    if (head & LOCKSTEP_HAS_DELTA) input.encoderDelta = unzigzag(getVarint(body, length, p));
+    if (head & LOCKSTEP_HAS_CHECK) {
+      lastCheckReceived += getVarint(body, length, p);
+      uint16_t fold = getU16(body, length, p);
+      remoteChecks.push_back({lastCheckReceived, fold});
+      if (remoteChecks.size() > 16) remoteChecks.pop_front();
+      compareChecks();
+    }
+    if (head & LOCKSTEP_PING) {
+      pongValue = getU16(body, length, p);
+      pongPending = true;
+    }
+    if (head & LOCKSTEP_PONG) {
+      uint32_t rtt = (uint16_t)((uint16_t)nowMs - getU16(body, length, p));
+      stats.rttSumMs += rtt;
+      stats.rttCount++;
+      if (rtt > stats.rttMaxMs) stats.rttMaxMs = rtt;
+    }
+    remote.push_back(input);
+  }
+
+  // 同じフレームのチェックが両方にあれば比べて捨てる
+  void compareChecks() {
+    while (!localChecks.empty() && !remoteChecks.empty()) {
+      const Check& mine = localChecks.front();
+      const Check& theirs = remoteChecks.front();
+      if (mine.frame < theirs.frame) {
+        localChecks.pop_front();
+      } else if (theirs.frame < mine.frame) {
+        remoteChecks.pop_front();
+      } else {
+        if (mine.fold == theirs.fold) stats.checksMatched++;
+        else if (stats.desyncFrame < 0) stats.desyncFrame = (int32_t)mine.frame;
+        localChecks.pop_front();
+        remoteChecks.pop_front();
+      }
+    }
+  }
+
+  static uint32_t zigzag(int32_t v) { return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31); }
+  static int32_t unzigzag(uint32_t v) { return (int32_t)(v >> 1) ^ -(int32_t)(v & 1); }
+
+  static int putVarint(uint8_t* out, uint32_t v) {
+    int n = 0;
+    while (v >= 0x80) {
+      out[n++] = (uint8_t)(v | 0x80);
+      v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+  }
+
+  static uint16_t getU16(const uint8_t* body, int length, int& p) {
+    uint16_t v = p + 2 <= length ? (uint16_t)(body[p] | (body[p + 1] << 8)) : 0;
+    p += 2;
+    return v;
+  }
+
+  static uint32_t getVarint(const uint8_t* body, int length, int& p) {
+    uint32_t v = 0;
+    for (int shift = 0; p < length && shift < 35; shift += 7) {
+      uint8_t b = body[p++];
+      v |= (uint32_t)(b & 0x7F) << shift;
+      if (!(b & 0x80)) break;
+    }
+    return v;
+  }
+
+  // CRC-8（多項式 0x07）
+  static uint8_t crc8(const uint8_t* data, int length) {
+    uint8_t crc = 0;
+    for (int i = 0; i < length; i++) {
+      crc ^= data[i];
+      for (int k = 0; k < 8; k++) crc = (uint8_t)(crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1);
+    }
+    return crc;
+  }
+};
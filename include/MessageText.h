@@ -0,0 +1,125 @@
+/**
+ * MessageText - 事前ラスタライズした日本語メッセージの描画
+ *
+ * 決まった文だけを tools/message_atlas_gen.cpp でオフラインに
+ * 4bpp（16階調）のアンチエイリアス済みグリフへ変換し、フラッシュに置く。
+ * 端末側はフォントを持たず、グリフの画素をフレームバッファへ
+ * 不透明度つきで合成するだけ。実行時のRAM消費はない。
+ *
+ * 生成されたヘッダ（src/message_atlas.h、コミット済み。作り直しは tools/message_atlas.py）が
+ * MESSAGE_FONT と MessageId を定義する。
+ */
+#pragma once
+
+#include "OverdrawHook.h"
+
+#include <stdint.h>
+
+// ========================================
+// フォントデータの形式（生成ヘッダと共通）
+// ========================================
+struct MessageGlyph {
+  int8_t left;        // 原点からビットマップ左端まで
+  int8_t top;         // ベースラインからビットマップ上端まで（上が正）
+  uint8_t width;
+  uint8_t height;
+  uint8_t advance;    // 次の文字までの送り
+  uint32_t offset;    // bitmap 内の先頭（行ごとに (width + 1) / 2 バイト、上位ニブルが左）
+};
+
+struct MessageFont {
+  int ascent;
+  int lineHeight;
+  const MessageGlyph* glyphs;
+  const uint8_t* bitmap;
+  const uint8_t* text;      // グリフ番号の列。MESSAGE_NEWLINE で改行
+  const uint16_t* offsets;  // メッセージ i は text[offsets[i]] ~ text[offsets[i + 1]]
+  int count;
+};
+
+const uint8_t MESSAGE_NEWLINE = 0xFF;
+
+// ========================================
+// RGB565 の合成（alpha は 0 ~ 32）
+// ========================================
+inline uint16_t blendMessage565(uint16_t bg, uint32_t fgExpanded, uint32_t alpha) {
+  uint32_t bgExpanded = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+  uint32_t mixed = ((((fgExpanded - bgExpanded) * alpha) >> 5) + bgExpanded) & 0x07E0F81F;
+  return (uint16_t)(mixed | (mixed >> 16));
+}
+
+inline int messageLineWidth(const MessageFont& font, const uint8_t* p, const uint8_t* end) {
+  int width = 0;
+  for (; p < end && *p != MESSAGE_NEWLINE; p++) {
+    width += font.glyphs[*p].advance;
+  }
+  return width;
+}
+
+// ========================================
+// メッセージ描画（行ごとに中央揃え）
+// ========================================
+// color は RGB565、opacity は 0 ~ 255。Gfx は getBuffer / width / height を持ち、
+// 画素をビッグエンディアンで持つこと（M5Canvas / SoftCanvas）。
+template <typename Gfx>
+void drawMessage(Gfx& gfx, const MessageFont& font, int id, int centerX, int centerY,
+                 uint16_t color, uint8_t opacity) {
+  if (id < 0 || id >= font.count || opacity == 0) return;
+
+  const uint8_t* begin = font.text + font.offsets[id];
+  const uint8_t* end = font.text + font.offsets[id + 1];
+
+  int lines = 1;
+  for (const uint8_t* p = begin; p < end; p++) {
+    if (*p == MESSAGE_NEWLINE) lines++;
+  }
+
+  // 16階調ごとの合成率をこの呼び出しの不透明度で先に求めておく
+  uint32_t alphaFor[16];
+  for (int a = 0; a < 16; a++) {
+    alphaFor[a] = (a * opacity * 32 + (15 * 255) / 2) / (15 * 255);
+  }
+  uint32_t fgExpanded = (color | ((uint32_t)color << 16)) & 0x07E0F81F;
+
+  uint16_t* buf = (uint16_t*)gfx.getBuffer();
+  int bufWidth = gfx.width();
+  int bufHeight = gfx.height();
+
+  int baseline = centerY - lines * font.lineHeight / 2 + font.ascent;
+  const uint8_t* p = begin;
+  while (p <= end) {
+    int penX = centerX - messageLineWidth(font, p, end) / 2;
+
+    for (; p < end && *p != MESSAGE_NEWLINE; p++) {
+      const MessageGlyph& g = font.glyphs[*p];
+      const uint8_t* rows = font.bitmap + g.offset;
+      int stride = (g.width + 1) / 2;
+      int x0 = penX + g.left;
+      int y0 = baseline - g.top;
+
+      for (int gy = 0; gy < g.height; gy++) {
+        int y = y0 + gy;
+        if ((unsigned)y >= (unsigned)bufHeight) continue;
+        const uint8_t* row = rows + gy * stride;
+        uint16_t* dst = buf + y * bufWidth;
+
+        for (int gx = 0; gx < g.width; gx++) {
+          uint8_t coverage = (gx & 1) ? (row[gx >> 1] & 0x0F) : (row[gx >> 1] >> 4);
+          if (coverage == 0) continue;
+          int x = x0 + gx;
+          if ((unsigned)x >= (unsigned)bufWidth) continue;
+
+          uint16_t stored = dst[x];
+          uint16_t bg = (uint16_t)((stored >> 8) | (stored << 8));
+          uint16_t out = blendMessage565(bg, fgExpanded, alphaFor[coverage]);
+          dst[x] = (uint16_t)((out >> 8) | (out << 8));
+          countSpan(gfx, x, y, 1);
+        }
+      }
+      penX += g.advance;
+    }
+
+    p++;  // 改行（または終端）を飛ばす
+    baseline += font.lineHeight;
+  }
+}
@@ -0,0 +1,207 @@
+/**
+ * OverdrawGfx - 画素の書き込み回数とプリミティブ数を数える描画ラッパー
+ *
+ * 描画先 Gfx（M5Canvas / SoftCanvas）の前に挟み、描画はそのまま渡しつつ、
+ * 同じ画素集合（GlassRaster.h）を8bitのカウンタバッファにも数える。
+ * GlassRenderer.h の markStage() で区切った工程ごとに、
+ * プリミティブの種類別の数と書き込み画素数も集計する。
+ *
+ * getBuffer() 越しにフレームバッファへ直接書く処理（粉塵の合成・ひびの画像・奥の板・
+ * メッセージ・万華鏡）は、書いた区間を countSpan()（OverdrawHook.h）で知らせてもらい、
+ * 同じように数える。
+ *
+ * 計測用のビルド（-DGLASSDIAL_OVERDRAW）と tools/overdraw_report.cpp で使う。
+ */
+#pragma once
+
+#include "GlassEngine.h"
+#include "GlassRaster.h"
+#include "GlassRenderer.h"
+#include "OverdrawHook.h"
+
+#include <stdint.h>
+#include <string.h>
+
+enum OverdrawPrimitive {
+  PRIM_HLINE,        // fillScreen / fillRect / drawFastHLine
+  PRIM_LINE,
+  PRIM_CIRCLE,
+  PRIM_FILL_CIRCLE,
+  PRIM_PIXEL,
+  PRIM_COUNT
+};
+
+inline const char* overdrawPrimitiveName(int p) {
+  static const char* NAMES[PRIM_COUNT] = {"hline", "line", "circle", "fillCircle", "pixel"};
+  return NAMES[p];
+}
+
+// ========================================
+// 1フレーム分の計測結果
+// ========================================
+struct OverdrawFrame {
+  uint32_t primitives[STAGE_COUNT][PRIM_COUNT];
+  uint32_t pixels[STAGE_COUNT];
+
+  void clear() { memset(this, 0, sizeof(*this)); }
+
+  uint32_t totalPixels() const {
+    uint32_t total = 0;
+    for (int s = 0; s < STAGE_COUNT; s++) total += pixels[s];
+    return total;
+  }
+};
+
+// ========================================
+// 状態ごとの平均
+// ========================================
+struct OverdrawStateStats {
+  uint32_t frames;
+  uint64_t pixels[STAGE_COUNT];
+  uint64_t primitives[STAGE_COUNT][PRIM_COUNT];
+
+  void add(const OverdrawFrame& f) {
+    frames++;
+    for (int s = 0; s < STAGE_COUNT; s++) {
+      pixels[s] += f.pixels[s];
+      for (int p = 0; p < PRIM_COUNT; p++) primitives[s][p] += f.primitives[s][p];
+    }
+  }
+
+  uint64_t totalPixels() const {
+    uint64_t total = 0;
+    for (int s = 0; s < STAGE_COUNT; s++) total += pixels[s];
+    return total;
+  }
+};
+
+// ========================================
+// 描画ラッパー
+// ========================================
+template <typename Gfx>
+class OverdrawGfx {
+public:
+  // counts は width * height バイト。beginFrame() で0に戻す
+  OverdrawGfx(Gfx& inner, uint8_t* counts) : inner(inner), counts(counts), stage(STAGE_CLEAR) {
+    frame.clear();
+  }
+
+  Gfx& inner;
+  uint8_t* counts;
+  RenderStage stage;
+  OverdrawFrame frame;
+
+  void beginFrame() {
+    memset(counts, 0, width() * height());
+    frame.clear();
+    stage = STAGE_CLEAR;
+  }
+
+  int width() { return inner.width(); }
+  int height() { return inner.height(); }
+  void* getBuffer() { return inner.getBuffer(); }
+
+  template <typename... A>
+  auto color565(A... a) -> decltype(inner.color565(a...)) { return inner.color565(a...); }
+
+  template <typename T>
+  void fillScreen(T color) {
+    inner.fillScreen(color);
+    count(PRIM_HLINE);
+    for (int y = 0; y < height(); y++) hline(0, y, width());
+  }
+
+  template <typename T>
+  void fillRect(int x, int y, int w, int h, T color) {
+    inner.fillRect(x, y, w, h, color);
+    count(PRIM_HLINE);
+    for (int j = 0; j < h; j++) hline(x, y + j, w);
+  }
+
+  template <typename T>
+  void drawFastHLine(int x, int y, int len, T color) {
+    inner.drawFastHLine(x, y, len, color);
+    count(PRIM_HLINE);
+    hline(x, y, len);
+  }
+
+  template <typename T>
+  void drawPixel(int x, int y, T color) {
+    inner.drawPixel(x, y, color);
+    count(PRIM_PIXEL);
+    plot(x, y);
+  }
+
+  template <typename T>
+  void drawLine(int x0, int y0, int x1, int y1, T color) {
+    inner.drawLine(x0, y0, x1, y1, color);
+    count(PRIM_LINE);
+    rasterLine(x0, y0, x1, y1, [this](int x, int y) { plot(x, y); });
+  }
+
+  template <typename T>
+  void drawCircle(int x, int y, int r, T color) {
+    inner.drawCircle(x, y, r, color);
+    count(PRIM_CIRCLE);
+    rasterCircle(x, y, r, [this](int hx, int hy, int len) { hline(hx, hy, len); },
+                 [this](int vx, int vy, int len) { vline(vx, vy, len); });
+  }
+
+  template <typename T>
+  void fillCircle(int x, int y, int r, T color) {
+    inner.fillCircle(x, y, r, color);
+    count(PRIM_FILL_CIRCLE);
+    rasterFillCircle(x, y, r, [this](int hx, int hy, int len) { hline(hx, hy, len); });
+  }
+
+  // getBuffer() 越しに書いた区間（プリミティブとしては数えない）
+  void countSpan(int x, int y, int len) { hline(x, y, len); }
+
+private:
+  void count(OverdrawPrimitive p) { frame.primitives[stage][p]++; }
+
+  void plot(int x, int y) {
+    if ((unsigned)x >= (unsigned)width() || (unsigned)y >= (unsigned)height()) return;
+    uint8_t& c = counts[y * width() + x];
+    if (c < 255) c++;
+    frame.pixels[stage]++;
+  }
+
+  void hline(int x, int y, int len) {
+    if ((unsigned)y >= (unsigned)height() || len <= 0) return;
+    int x0 = x < 0 ? 0 : x;
+    int x1 = x + len > width() ? width() : x + len;
+    for (int i = x0; i < x1; i++) {
+      uint8_t& c = counts[y * width() + i];
+      if (c < 255) c++;
+    }
+    if (x1 > x0) frame.pixels[stage] += x1 - x0;
+  }
+
+  void vline(int x, int y, int len) {
+    for (int i = 0; i < len; i++) plot(x, y + i);
+  }
+};
+
+template <typename Gfx>
+void markStage(OverdrawGfx<Gfx>& gfx, RenderStage stage) {
+  gfx.stage = stage;
+}
+
+template <typename Gfx>
+void countSpan(OverdrawGfx<Gfx>& gfx, int x, int y, int len) {
+  gfx.countSpan(x, y, len);
+}
+
+// ========================================
+// ヒートマップ（書き込み回数 → 色）
+// ========================================
+// 0 = 黒, 1 = 暗い青, 2 = 緑, 3 = 黄, 4 = 赤, 5以上 = 白
+inline void overdrawHeatColor(uint8_t count, uint8_t* rgb) {
+  static const uint8_t RAMP[6][3] = {
+    {0, 0, 0}, {20, 40, 120}, {40, 170, 60}, {230, 210, 40}, {230, 60, 30}, {255, 255, 255}};
+  const uint8_t* c = RAMP[count < 5 ? count : 5];
+  rgb[0] = c[0];
+  rgb[1] = c[1];
+  rgb[2] = c[2];
+}
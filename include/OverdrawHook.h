@@ -0,0 +1,15 @@
+/**
+ * OverdrawHook - getBuffer() 越しの直接書き込みを重ね塗りの計測に知らせる口
+ *
+ * 粉塵の合成・ひびの画像・奥の板・メッセージ・万華鏡の写しは、描画関数を通らず
+ * フレームバッファへ直接書くので、OverdrawGfx からは見えない。これらは
+ * 書いた画素の行ごとの区間を countSpan() で知らせる。
+ * 通常の描画先では何もせず（インライン展開で消える）、計測用のビルド
+ * （-DGLASSDIAL_OVERDRAW）や tools/overdraw_report.cpp で OverdrawGfx 越しに
+ * 描くときだけ、OverdrawGfx.h の版が工程ごとの書き込み画素数に足す。
+ */
+#pragma once
+
+// 行 y の x から len 画素に書いた
+template <typename Gfx>
+inline void countSpan(Gfx&, int, int, int) {}
@@ -0,0 +1,106 @@
+/**
+ * PanelPack444 - RGB565 のフレームを 12ビット（4-4-4）に詰める
+ *
+ * パネル（GC9A01）は COLMOD = 0x03 で 1画素 12ビットの入力を受け付ける。
+ * 2画素が3バイト（R0G0 B0R1 G1B1、各4ビット、上位ニブルが先）になるので、
+ * 全画面の転送は RGB565 の 3/4（115,200 → 86,400 バイト）で済む。
+ * ガラスの画は暗く彩度が低いので、各4ビットでも見た目はほとんど変わらない。
+ *
+ * 入力は M5Canvas のバッファ形式（ビッグエンディアンの RGB565）。
+ * ディザなしでは 32ビット読み1回で2画素を、バイト入れ替えと各色の切り捨てまで
+ * 1つのレジスタの中で同時に処理する（SWAR）。ディザありでは 4x4 の組織的ディザの
+ * しきい値を色ごとに足してから切り捨てる（飽和つき）。Arduino非依存。
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+const uint8_t PANEL_COLMOD_RGB444 = 0x03;   // COLMOD（0x3A）の値
+const uint8_t PANEL_COLMOD_RGB565 = 0x55;
+
+// count 画素を詰めたバイト数（count は偶数）
+inline size_t panelPack444Bytes(size_t count) {
+  return count / 2 * 3;
+}
+
+// 4x4 ベイヤー行列（0 ~ 15）
+const uint8_t PANEL_BAYER4[4][4] = {
+  {0, 8, 2, 10},
+  {12, 4, 14, 6},
+  {3, 11, 1, 9},
+  {15, 7, 13, 5},
+};
+
+// ネイティブの RGB565 1画素を 4-4-4（下位12ビット）に切り捨てる
+inline uint32_t panelRgb444(uint16_t c) {
+  return ((c >> 4) & 0xF00) | ((c >> 3) & 0x0F0) | ((c >> 1) & 0x00F);
+}
+
+// ========================================
+// ディザなし
+// ========================================
+// src はビッグエンディアンの RGB565（4バイト境界）、count は4の倍数
+inline void panelPack444Row(const uint16_t* src, uint8_t* dst, int count) {
+  const uint32_t* words = (const uint32_t*)src;
+  for (int i = 0; i < count; i += 4) {
+    uint32_t w0 = words[0];
+    uint32_t w1 = words[1];
+    words += 2;
+    // 16ビットずつバイトを入れ替え、2画素まとめて各色の上位4ビットを取る
+    w0 = ((w0 >> 8) & 0x00FF00FF) | ((w0 << 8) & 0xFF00FF00);
+    w1 = ((w1 >> 8) & 0x00FF00FF) | ((w1 << 8) & 0xFF00FF00);
+    w0 = ((w0 >> 4) & 0x0F000F00) | ((w0 >> 3) & 0x00F000F0) | ((w0 >> 1) & 0x000F000F);
+    w1 = ((w1 >> 4) & 0x0F000F00) | ((w1 >> 3) & 0x00F000F0) | ((w1 >> 1) & 0x000F000F);
+    // 下位16ビットが先の画素。宛先は3バイト境界なのでバイトで書く
+    dst[0] = (uint8_t)(w0 >> 4);
+    dst[1] = (uint8_t)((w0 << 4) | (w0 >> 24));
+    dst[2] = (uint8_t)(w0 >> 16);
+    dst[3] = (uint8_t)(w1 >> 4);
+    dst[4] = (uint8_t)((w1 << 4) | (w1 >> 24));
+    dst[5] = (uint8_t)(w1 >> 16);
+    dst += 6;
+  }
+}
+
+// ========================================
+// ディザあり
+// ========================================
+// 各色の切り捨てる分（R/B 1ビット、G 2ビット）のしきい値を、
+// 画素を (c | c << 16) & 0x07E0F81F に広げた形（色の間に空きビット）で持つ
+struct PanelDither444 {
+  uint32_t offsets[4][4];
+
+  PanelDither444() {
+    for (int y = 0; y < 4; y++) {
+      for (int x = 0; x < 4; x++) {
+        uint32_t b = PANEL_BAYER4[y][x];
+        offsets[y][x] = ((b >> 3) << 11) | ((b >> 2) << 21) | (b >> 3);
+      }
+    }
+  }
+};
+
+// y は画面の行（ディザの模様の位置）。count は偶数
+inline void panelPack444RowDither(const uint16_t* src, uint8_t* dst, int count, int y,
+                                  const PanelDither444& dither) {
+  const uint32_t* offsets = dither.offsets[y & 3];
+  for (int i = 0; i < count; i += 2) {
+    uint32_t packed[2];
+    for (int k = 0; k < 2; k++) {
+      uint16_t c = src[i + k];
+      c = (uint16_t)((c >> 8) | (c << 8));
+      uint32_t s = ((c | ((uint32_t)c << 16)) & 0x07E0F81F) + offsets[(i + k) & 3];
+      // あふれた色（R → bit16、B → bit5、G → bit27）は最大値に飽和させる
+      uint32_t over = s & 0x00010020;
+      uint32_t overG = s & 0x08000000;
+      s = (s | (over - (over >> 5)) | (overG - (overG >> 6))) & 0x07E0F81F;
+      packed[k] = ((s >> 4) & 0xF00) | ((s >> 19) & 0x0F0) | ((s >> 1) & 0x00F);
+    }
+    dst[0] = (uint8_t)(packed[0] >> 4);
+    dst[1] = (uint8_t)((packed[0] << 4) | (packed[1] >> 8));
+    dst[2] = (uint8_t)packed[1];
+    dst += 3;
+  }
+}
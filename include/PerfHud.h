@@ -0,0 +1,246 @@
+/**
+ * PerfHud - 画面上の性能表示（FPS・フレーム時間・p99・粒子数・消費電力の見積もりなど）
+ *
+ * 文字は 5x7 のビットマップを起動時にフレームバッファと同じ画素形式へ
+ * 展開した「グリフアトラス」から行単位のコピーで並べる。printf も
+ * フォント描画も使わない。
+ *
+ * 文字列の組み直しは HUD_REFRESH_MS ごと（4Hz）に HUD 用の小さな
+ * バッファ（HUD_WIDTH x HUD_HEIGHT）へ行い、毎フレームはその矩形を
+ * フレームバッファへ写すだけにする。
+ */
+#pragma once
+
+#include "GlassEngine.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+
+const int HUD_GLYPH_W = 6;        // 5px + 字間1px
+const int HUD_GLYPH_H = 8;        // 7px + 行間1px
+const int HUD_COLUMNS = 16;
+const int HUD_LINES = 6;
+const int HUD_WIDTH = HUD_COLUMNS * HUD_GLYPH_W;
+const int HUD_HEIGHT = HUD_LINES * HUD_GLYPH_H;
+const int HUD_X = CENTER_X - HUD_WIDTH / 2;   // 下寄せ（丸い画面の内側）
+const int HUD_Y = 140;
+const unsigned long HUD_REFRESH_MS = 250;
+const int HUD_SAMPLES = 256;                  // p99 を求めるフレーム数
+
+// 4Hz ごとに呼び出し側が渡す値
+struct HudCounters {
+  int particles;
+  int cracks;
+  uint32_t freeHeap;
+  uint32_t spiBytes;      // 起動からの累計
+  uint32_t hudMicros;     // HUD 自体のコスト（1フレームあたり）
+  uint32_t powerMw;       // 見積もりの消費電力（EnergyModel.h）
+};
+
+class PerfHud {
+public:
+  PerfHud() : visible(false), sampleCount(0), sampleNext(0), lastRefresh(0),
+              lastSpiBytes(0), framesSinceRefresh(0), workSinceRefresh(0) {
+    buildAtlas();
+    memset(pixels, 0, sizeof(pixels));
+  }
+
+  bool visible;
+
+  void toggle() { visible = !visible; }
+
+  // 毎フレーム: そのフレームの処理時間 [us]
+  void recordFrame(uint32_t workMicros) {
+    samples[sampleNext] = workMicros;
+    sampleNext = (sampleNext + 1) % HUD_SAMPLES;
+    if (sampleCount < HUD_SAMPLES) sampleCount++;
+    framesSinceRefresh++;
+    workSinceRefresh += workMicros;
+  }
+
+  bool due(unsigned long nowMs) const { return nowMs - lastRefresh >= HUD_REFRESH_MS; }
+
+  // 4Hz: 表示内容を組み直す
+  void refresh(unsigned long nowMs, const HudCounters& c) {
+    float seconds = (nowMs - lastRefresh) / 1000.0f;
+    if (seconds <= 0) seconds = HUD_REFRESH_MS / 1000.0f;
+
+    float fps = framesSinceRefresh / seconds;
+    float avgMs = framesSinceRefresh ? workSinceRefresh / 1000.0f / framesSinceRefresh : 0;
+    float p99Ms = percentile99() / 1000.0f;
+    uint32_t spiKBps = (uint32_t)((c.spiBytes - lastSpiBytes) / 1024.0f / seconds);
+
+    char line[32];  // 長い行は putText で切り詰める
+    clearLines();
+    format(line, "FPS ", fps, 1);
+    putLine(0, line);
+    format(line, "MS  ", avgMs, 1);
+    putLine(1, line);
+    format(line, "P99 ", p99Ms, 1);
+    putLine(2, line);
+    formatPair(line, "PT ", (uint32_t)c.particles, " CR ", c.cracks);
+    putLine(3, line);
+    formatPair(line, "HEAP ", c.freeHeap / 1024, "K", -1);
+    putLine(4, line);
+    formatPair(line, "", c.powerMw, "MW", -1);
+    putText(4, HUD_COLUMNS - (int)strlen(line), line);
+    formatPair(line, "SPI ", spiKBps, "K/S ", -1);
+    putText(5, 0, line);
+    formatPair(line, "", c.hudMicros, "US", -1);
+    putText(5, HUD_COLUMNS - (int)strlen(line), line);
+
+    lastRefresh = nowMs;
+    lastSpiBytes = c.spiBytes;
+    framesSinceRefresh = 0;
+    workSinceRefresh = 0;
+  }
+
+  // 毎フレーム: HUD の矩形をフレームバッファへ写す
+  template <typename Gfx>
+  void draw(Gfx& gfx) {
+    uint16_t* dst = (uint16_t*)gfx.getBuffer() + HUD_Y * gfx.width() + HUD_X;
+    for (int y = 0; y < HUD_HEIGHT; y++) {
+      memcpy(dst + y * gfx.width(), pixels + y * HUD_WIDTH, HUD_WIDTH * sizeof(uint16_t));
+    }
+  }
+
+private:
+  static const int GLYPH_COUNT = 29;
+
+  // 5x7 ビットマップ（各行の下位5bit、左が上位）
+  static const char* glyphChars() { return "0123456789. %/ACDEFHIKMPRSTUW"; }
+
+  static const uint8_t* glyphBits(int index) {
+    static const uint8_t BITS[][7] = {
+      {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E},  // 0
+      {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E},  // 1
+      {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F},  // 2
+      {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E},  // 3
+      {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02},  // 4
+      {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E},  // 5
+      {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E},  // 6
+      {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08},  // 7
+      {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E},  // 8
+      {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C},  // 9
+      {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C},  // .
+      {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},  // (space)
+      {0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03},  // %
+      {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00},  // /
+      {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},  // A
+      {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E},  // C
+      {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C},  // D
+      {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F},  // E
+      {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10},  // F
+      {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},  // H
+      {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E},  // I
+      {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11},  // K
+      {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11},  // M
+      {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10},  // P
+      {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11},  // R
+      {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E},  // S
+      {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04},  // T
+      {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},  // U
+      {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A},  // W
+    };
+    return BITS[index];
+  }
+
+  // フレームバッファと同じビッグエンディアンRGB565で展開済みのグリフ
+  uint16_t atlas[GLYPH_COUNT][HUD_GLYPH_H][HUD_GLYPH_W];
+  uint8_t glyphIndex[128];
+  uint16_t pixels[HUD_WIDTH * HUD_HEIGHT];
+
+  uint32_t samples[HUD_SAMPLES];
+  int sampleCount;
+  int sampleNext;
+  unsigned long lastRefresh;
+  uint32_t lastSpiBytes;
+  uint32_t framesSinceRefresh;
+  uint64_t workSinceRefresh;
+
+  void buildAtlas() {
+    const uint16_t fg = 0xFFFF;
+    const uint16_t bg = 0x0000;
+    const char* chars = glyphChars();
+    int count = (int)strlen(chars);
+
+    memset(glyphIndex, 11, sizeof(glyphIndex));  // 未定義の文字は空白
+    for (int g = 0; g < count; g++) {
+      glyphIndex[(uint8_t)chars[g]] = (uint8_t)g;
+      const uint8_t* bits = glyphBits(g);
+      for (int y = 0; y < HUD_GLYPH_H; y++) {
+        for (int x = 0; x < HUD_GLYPH_W; x++) {
+          bool on = y < 7 && x < 5 && (bits[y] & (0x10 >> x));
+          atlas[g][y][x] = on ? fg : bg;
+        }
+      }
+    }
+  }
+
+  void clearLines() { memset(pixels, 0, sizeof(pixels)); }
+
+  void putText(int line, int column, const char* text) {
+    for (; *text && column < HUD_COLUMNS; text++, column++) {
+      if (column < 0) continue;
+      uint8_t c = (uint8_t)*text;
+      const uint16_t(*glyph)[HUD_GLYPH_W] = atlas[c < 128 ? glyphIndex[c] : 11];
+      uint16_t* dst = pixels + line * HUD_GLYPH_H * HUD_WIDTH + column * HUD_GLYPH_W;
+      for (int y = 0; y < HUD_GLYPH_H; y++) {
+        memcpy(dst + y * HUD_WIDTH, glyph[y], sizeof(glyph[y]));
+      }
+    }
+  }
+
+  void putLine(int line, const char* text) { putText(line, 0, text); }
+
+  uint32_t percentile99() {
+    if (sampleCount == 0) return 0;
+    uint32_t sorted[HUD_SAMPLES];
+    memcpy(sorted, samples, sampleCount * sizeof(uint32_t));
+    int k = (sampleCount * 99) / 100;
+    if (k >= sampleCount) k = sampleCount - 1;
+    std::nth_element(sorted, sorted + k, sorted + sampleCount);
+    return sorted[k];
+  }
+
+  // 数値の整形（printf 系は使わない）
+  static char* appendUint(char* p, uint32_t value) {
+    char digits[10];
+    int n = 0;
+    do {
+      digits[n++] = (char)('0' + value % 10);
+      value /= 10;
+    } while (value && n < 10);
+    while (n) *p++ = digits[--n];
+    return p;
+  }
+
+  static char* appendText(char* p, const char* text) {
+    while (*text) *p++ = *text++;
+    return p;
+  }
+
+  static void format(char* out, const char* label, float value, int decimals) {
+    if (value < 0) value = 0;
+    uint32_t scale = decimals ? 10 : 1;
+    uint32_t fixed = (uint32_t)(value * scale + 0.5f);
+    char* p = appendText(out, label);
+    p = appendUint(p, fixed / scale);
+    if (decimals) {
+      *p++ = '.';
+      *p++ = (char)('0' + fixed % 10);
+    }
+    *p = '\0';
+  }
+
+  // label1 + value1 + label2 (+ value2 が 0 以上なら続ける)
+  static void formatPair(char* out, const char* label1, uint32_t value1,
+                         const char* label2, int value2) {
+    char* p = appendText(out, label1);
+    p = appendUint(p, value1);
+    p = appendText(p, label2);
+    if (value2 >= 0) p = appendUint(p, (uint32_t)value2);
+    *p = '\0';
+  }
+};
@@ -0,0 +1,106 @@
+/**
+ * PresentClock - 描画フレームの表示時刻の見込みと、音・振動とのずれの計測
+ *
+ * 遷移の音は engine.step() の直後に分かるが、同じ遷移の画が見えるのは
+ * 描画と SPI 転送のあと。そこで音・振動・画を同じ時間軸（micros）に並べ、
+ * 音と振動は「このフレームが表示される見込みの時刻」に鳴らし始める。
+ *
+ *   表示時刻 = 転送完了 + パネルの走査待ち（PRESENT_PANEL_MICROS、平均）
+ *   見込み   = フレーム開始 + （フレーム開始 → 表示時刻）の指数移動平均
+ *
+ * 音声側は実際に鳴り始めた時刻を recordStart() で返し、そのフレームの
+ * 実際の表示時刻との差（正 = 音が遅い）を集計する。
+ * Arduino に依存しないので、時刻は呼び出し側が渡す。
+ */
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+const uint32_t PRESENT_PANEL_MICROS = 8000;   // 書き込みから走査で画素が光るまで（60Hz の半周期）
+const uint32_t PRESENT_INITIAL_MICROS = 20000; // 計測前の見込み（描画 + 転送 + 走査）
+const int PRESENT_HISTORY = 32;               // 表示時刻を覚えておくフレーム数
+const int PRESENT_SMOOTHING_SHIFT = 3;        // 移動平均の重み 1/8
+
+// 音声タスクから返す、実際に鳴り始めた時刻
+struct PresentStart {
+  uint32_t frame;
+  uint32_t micros;
+};
+
+class PresentClock {
+public:
+  PresentClock() : latency(PRESENT_INITIAL_MICROS), frame(0), frameStart(0) {
+    memset(historyFrame, 0xFF, sizeof(historyFrame));
+    memset(historyMicros, 0, sizeof(historyMicros));
+    resetStats();
+  }
+
+  // フレームの処理を始めた（frame はこれから表示するフレームの番号）
+  void beginFrame(uint32_t frameNumber, uint32_t nowMicros) {
+    frame = frameNumber;
+    frameStart = nowMicros;
+  }
+
+  // このフレームが表示される見込みの時刻
+  uint32_t target() const { return frameStart + latency; }
+  uint32_t currentFrame() const { return frame; }
+
+  // このフレームの転送が終わった
+  void presented(uint32_t nowMicros) {
+    uint32_t displayOut = nowMicros + PRESENT_PANEL_MICROS;
+    int32_t error = (int32_t)(target() - displayOut);
+    estimateErrorSum += error < 0 ? -error : error;
+    frames++;
+
+    uint32_t measured = displayOut - frameStart;
+    latency += ((int32_t)(measured - latency)) >> PRESENT_SMOOTHING_SHIFT;
+
+    int slot = frame % PRESENT_HISTORY;
+    historyFrame[slot] = frame;
+    historyMicros[slot] = displayOut;
+  }
+
+  // frameNumber のフレームに合わせた音・振動が startMicros に鳴り始めた。
+  // そのフレームがまだ表示されていない・古すぎるときは数えない
+  void recordStart(uint32_t frameNumber, uint32_t startMicros) {
+    int slot = frameNumber % PRESENT_HISTORY;
+    if (historyFrame[slot] != frameNumber) {
+      unmatched++;
+      return;
+    }
+    int32_t skew = (int32_t)(startMicros - historyMicros[slot]);
+    skewSum += skew;
+    skewAbsSum += skew < 0 ? -skew : skew;
+    if (skewCount == 0 || skew < skewMin) skewMin = skew;
+    if (skewCount == 0 || skew > skewMax) skewMax = skew;
+    skewCount++;
+  }
+
+  void resetStats() {
+    frames = 0;
+    estimateErrorSum = 0;
+    skewCount = 0;
+    skewSum = 0;
+    skewAbsSum = 0;
+    skewMin = skewMax = 0;
+    unmatched = 0;
+  }
+
+  uint32_t latency;           // フレーム開始 → 表示時刻の見込み [us]
+
+  // 統計（resetStats() まで）
+  uint32_t frames;
+  uint64_t estimateErrorSum;  // |見込み - 実際の表示時刻| の合計
+  uint32_t skewCount;
+  int64_t skewSum;            // 音の開始 - 表示時刻（正 = 音が遅い）
+  uint64_t skewAbsSum;
+  int32_t skewMin, skewMax;
+  uint32_t unmatched;
+
+private:
+  uint32_t frame;
+  uint32_t frameStart;
+  uint32_t historyFrame[PRESENT_HISTORY];
+  uint32_t historyMicros[PRESENT_HISTORY];
+};
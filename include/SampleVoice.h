@@ -0,0 +1,89 @@
+/**
+ * SampleVoice - 録音したガラス音を音程を変えて鳴らす声（ポリフェーズ再標本化）
+ *
+ * ガラスの「チリン」を1つだけフラッシュに置き、破片の大きさに合わせた
+ * 任意の音程比で鳴らす。再標本化は窓つき sinc のポリフェーズフィルタで、
+ * 係数表（src/resample_table.h、tools/glass_sample_gen.cpp が生成）もフラッシュに置く。
+ *
+ *   音程比 <= 1（下げる）  16 タップ、遮断は元の標本化周波数のナイキスト付近
+ *   音程比 <= 2（上げる）  24〜32 タップ、帯域ごとに遮断を音程比の上限に合わせて
+ *                          下げ、折り返しを防ぐ
+ *
+ * 位置は 16.16 の固定小数点で、小数部を RESAMPLE_PHASE_BITS ビットに丸めて
+ * 係数の行を選ぶ（行は RESAMPLE_PHASES + 1 本、最後は小数部 1.0）。
+ * 内側の積和はタップ数を定数にして展開する。
+ *
+ * 音素材（SampleClip）の data は前後に RESAMPLE_PAD 個の 0 を持つこと
+ * （境界の判定を内側のループに入れない）。
+ * Arduino に依存しないので、ホストでも同じ音を作れる。
+ */
+#pragma once
+
+#include "GrainSynth.h"
+
+#include <stdint.h>
+
+// ========================================
+// 定数
+// ========================================
+const int RESAMPLE_PHASE_BITS = 8;
+const int RESAMPLE_PHASES = 1 << RESAMPLE_PHASE_BITS;
+const int RESAMPLE_BANDS = 4;
+const int RESAMPLE_TAPS[RESAMPLE_BANDS] = {16, 24, 24, 32};
+const float RESAMPLE_BAND_RATIO[RESAMPLE_BANDS] = {1.0f, 1.25f, 1.5f, 2.0f};  // 帯域ごとの音程比の上限
+const float RESAMPLE_MIN_RATIO = 0.125f;
+const int RESAMPLE_PAD = 32;                 // 音素材の前後の 0 の数（最長のタップ数）
+const int SAMPLE_MAX_VOICES = 20;            // 同時発音数
+const float SAMPLE_VOICE_GAIN = 0.5f;        // 粒の amplitude 1.0 のときの音量（重なっても割れにくく）
+
+// ========================================
+// 音素材
+// ========================================
+struct SampleClip {
+  const int16_t* data;   // 先頭の RESAMPLE_PAD 個の 0 のあとが本体
+  int length;            // 本体の長さ（前後の 0 を含まない）
+  float pitch;           // 音程比 1 で鳴らしたときの基音 [Hz]
+};
+
+// ========================================
+// 声の集まり
+// ========================================
+class SamplePlayer {
+public:
+  explicit SamplePlayer(const SampleClip& clip);
+
+  // grain.frequency の音程で、次の render() の offset サンプル目から鳴らす。
+  // 空きがなければ一番古い声を置き換える
+  void startAt(const GrainRequest& grain, int offset);
+
+  // samples 個を out に足す（飽和つき）
+  void render(int16_t* out, int samples);
+
+  int activeVoices() const;
+
+  uint32_t voiceSteals;
+
+  // 1声分の再標本化（ホストの計測用にも公開）。position（16.16）から step ずつ進めて
+  // out[0, samples) に gain（Q15）倍して足す。音素材の終わりに達したら false
+  static bool resample(const SampleClip& clip, int band, uint32_t& position, uint32_t step,
+                       int32_t gain, int32_t* out, int samples);
+
+  // 音程比に使う係数の帯域
+  static int bandFor(float ratio);
+
+private:
+  struct Voice {
+    uint32_t position;   // 16.16（音素材の本体の先頭が 0）
+    uint32_t step;       // 16.16
+    int32_t gain;        // Q15
+    int band;
+    int delay;           // 鳴り始めるまでのサンプル数
+    uint32_t age;        // 鳴らし始めた順
+    bool active;
+  };
+
+  SampleClip clip;
+  Voice voices[SAMPLE_MAX_VOICES];
+  uint32_t started;
+  int32_t mix[GRAIN_BLOCK_SAMPLES];
+};
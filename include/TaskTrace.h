@@ -0,0 +1,233 @@
+/**
+ * TaskTrace - どのタスク・割り込みが描画フレームの時間を奪っているかの記録
+ *
+ * 出来事（TraceEvent、8バイト）をリングバッファに積む。
+ *   TRACE_RUN          core で動いているタスクが id に替わった
+ *   TRACE_ISR_ENTER/EXIT  記録している割り込み（registerIsr した id）の出入り
+ *   TRACE_FRAME_BEGIN/END 描画フレームの区切り（id = フレーム番号の下位16ビット）
+ *
+ * タスクの切り替えは、短い周期のタイマー割り込みから sample() で両コアの
+ * 実行中のタスクを見て、替わったときだけ積む（Arduino の FreeRTOS は
+ * ビルド済みなので traceTASK_SWITCHED_IN などのフックは差し込めない）。
+ * 切り替えの時刻は標本化の周期の精度で、周期より短い実行は見えないことがある。
+ * 同じ標本からタスクごとの実行時間（標本数 × 周期）も数える。
+ *
+ * フレームごとに「描画タスク以外が動いていた時間」を traceSteal() で出す。
+ * 端末では直前のフレームの分をその場で、ホスト（tools/trace_export.cpp）では
+ * 書き出した記録から全フレームの分を、同じ関数で求める。Arduino非依存。
+ */
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+const int TRACE_MAX_TASKS = 32;
+const int TRACE_MAX_ISRS = 8;
+const int TRACE_CORES = 2;
+const int TRACE_NAME_LENGTH = 16;
+
+enum TraceEventType : uint8_t {
+  TRACE_RUN,
+  TRACE_ISR_ENTER,
+  TRACE_ISR_EXIT,
+  TRACE_FRAME_BEGIN,
+  TRACE_FRAME_END,
+  TRACE_EVENT_TYPES
+};
+
+struct TraceEvent {
+  uint32_t micros;
+  uint8_t type;
+  uint8_t core;
+  uint16_t id;
+};
+
+// 1フレームの間に描画タスクから奪われた時間
+struct TraceSteal {
+  uint32_t frameMicros;    // FRAME_BEGIN → FRAME_END
+  uint32_t stolenMicros;   // 描画タスク以外（割り込みを含む）が動いていた時間
+  uint32_t isrMicros;      // そのうち記録している割り込みの時間
+  int preemptions;         // 描画タスクから他のタスクへ替わった回数
+  int topTask;             // いちばん長く奪ったタスク（なければ -1）
+  uint32_t topMicros;
+};
+
+// ========================================
+// 1フレームぶんの出来事からの集計
+// ========================================
+// events は FRAME_BEGIN から FRAME_END まで（他のコアの出来事が混じっていてよい）。
+// フレームは描画タスク自身が区切るので、始めは描画タスクが動いているとみなす
+inline TraceSteal traceSteal(const TraceEvent* events, size_t count, int core, int renderTask) {
+  TraceSteal steal = {0, 0, 0, 0, -1, 0};
+  uint32_t perTask[TRACE_MAX_TASKS] = {0};
+  if (count == 0) return steal;
+
+  int running = renderTask;
+  int isrDepth = 0;
+  uint32_t begin = events[0].micros;
+  uint32_t last = begin;
+  for (size_t i = 0; i < count; i++) {
+    const TraceEvent& e = events[i];
+    if (e.core != core) continue;
+    uint32_t span = e.micros - last;
+    if (isrDepth > 0) {
+      steal.stolenMicros += span;
+      steal.isrMicros += span;
+    } else if (running != renderTask) {
+      steal.stolenMicros += span;
+      if (running >= 0 && running < TRACE_MAX_TASKS) perTask[running] += span;
+    }
+    last = e.micros;
+
+    switch (e.type) {
+      case TRACE_RUN:
+        if (running == renderTask && (int)e.id != renderTask) steal.preemptions++;
+        running = e.id;
+        break;
+      case TRACE_ISR_ENTER:
+        isrDepth++;
+        break;
+      case TRACE_ISR_EXIT:
+        if (isrDepth > 0) isrDepth--;
+        break;
+      case TRACE_FRAME_END:
+        steal.frameMicros = e.micros - begin;
+        break;
+    }
+  }
+  for (int t = 0; t < TRACE_MAX_TASKS; t++) {
+    if (perTask[t] > steal.topMicros) {
+      steal.topMicros = perTask[t];
+      steal.topTask = t;
+    }
+  }
+  return steal;
+}
+
+// ========================================
+// 記録
+// ========================================
+class TaskTrace {
+public:
+  // capacity は2の累乗。buffer は呼び出し側が確保する（端末では PSRAM）
+  TaskTrace(TraceEvent* buffer, uint32_t capacity)
+      : enabled(true), events(buffer), capacity(capacity), head(0), taskCount(0), isrCount(0) {
+    for (int c = 0; c < TRACE_CORES; c++) {
+      lastTask[c] = -1;
+      for (int t = 0; t < TRACE_MAX_TASKS; t++) samples[c][t] = 0;
+    }
+  }
+
+  volatile bool enabled;   // 書き出しの間は止める
+
+  // 割り込みからも呼べる（head を原子的に進めるので、割り込まれても枠は重ならない）
+  void record(uint32_t micros, TraceEventType type, int core, int id) {
+    if (!enabled) return;
+    uint32_t index = head.fetch_add(1, std::memory_order_relaxed);
+    TraceEvent& e = events[index & (capacity - 1)];
+    e.micros = micros;
+    e.type = type;
+    e.core = (uint8_t)core;
+    e.id = (uint16_t)id;
+  }
+
+  // 標本化の割り込みから、コアごとに実行中のタスクを渡す（タスクの登録もここだけでする）
+  void sample(uint32_t micros, int core, const void* handle, const char* name) {
+    int id = findTask(handle);
+    if (id < 0) id = addTask(handle, name);
+    if (id < 0) return;
+    samples[core][id]++;
+    if (id != lastTask[core]) {
+      lastTask[core] = id;
+      record(micros, TRACE_RUN, core, id);
+    }
+  }
+
+  // 割り込みの名前を登録する（割り込みを有効にする前に呼ぶ）
+  int registerIsr(const char* name) {
+    if (isrCount >= TRACE_MAX_ISRS) return -1;
+    copyName(isrNames[isrCount], name);
+    return isrCount++;
+  }
+
+  int findTask(const void* handle) const {
+    int count = taskCount;
+    for (int t = 0; t < count; t++) {
+      if (taskHandles[t] == handle) return t;
+    }
+    return -1;
+  }
+
+  int tasks() const { return taskCount; }
+  int isrs() const { return isrCount; }
+  const char* taskName(int id) const { return taskNames[id]; }
+  const char* isrName(int id) const { return isrNames[id]; }
+
+  // 標本数（周期を掛けると実行時間）。読んだら takeSamples で 0 に戻す
+  uint32_t takeSamples(int core, int id) {
+    uint32_t n = samples[core][id];
+    samples[core][id] = 0;
+    return n;
+  }
+
+  // 積んだ出来事の数（古いものは上書きされている）
+  uint32_t recorded() const { return head.load(std::memory_order_relaxed); }
+  uint32_t size() const {
+    uint32_t n = recorded();
+    return n < capacity ? n : capacity;
+  }
+
+  // 古い方から i 番目（i < size()）
+  const TraceEvent& at(uint32_t i) const { return events[(recorded() - size() + i) & (capacity - 1)]; }
+
+  // 直前の FRAME_END までの1フレームを古い順に out へ写す（写した数、見つからなければ 0）
+  size_t copyLastFrame(int core, TraceEvent* out, size_t maxCount) const {
+    uint32_t end = recorded();
+    uint32_t available = size();
+    uint32_t endIndex = 0;
+    bool foundEnd = false;
+    for (uint32_t back = 1; back <= available && back <= maxCount; back++) {
+      const TraceEvent& e = events[(end - back) & (capacity - 1)];
+      if (e.core != core) continue;
+      if (!foundEnd) {
+        if (e.type != TRACE_FRAME_END) continue;
+        foundEnd = true;
+        endIndex = end - back;
+      } else if (e.type == TRACE_FRAME_BEGIN) {
+        uint32_t first = end - back;
+        size_t n = endIndex - first + 1;
+        if (n > maxCount) return 0;
+        for (size_t i = 0; i < n; i++) out[i] = events[(first + i) & (capacity - 1)];
+        return n;
+      }
+    }
+    return 0;
+  }
+
+private:
+  TraceEvent* events;
+  uint32_t capacity;
+  std::atomic<uint32_t> head;
+
+  const void* taskHandles[TRACE_MAX_TASKS];
+  char taskNames[TRACE_MAX_TASKS][TRACE_NAME_LENGTH];
+  volatile int taskCount;
+  char isrNames[TRACE_MAX_ISRS][TRACE_NAME_LENGTH];
+  int isrCount;
+  int lastTask[TRACE_CORES];
+  volatile uint32_t samples[TRACE_CORES][TRACE_MAX_TASKS];
+
+  int addTask(const void* handle, const char* name) {
+    if (taskCount >= TRACE_MAX_TASKS) return -1;
+    taskHandles[taskCount] = handle;
+    copyName(taskNames[taskCount], name);
+    return taskCount++;
+  }
+
+  static void copyName(char* dst, const char* name) {
+    strncpy(dst, name ? name : "?", TRACE_NAME_LENGTH - 1);
+    dst[TRACE_NAME_LENGTH - 1] = '\0';
+  }
+};
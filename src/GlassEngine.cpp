@@ -0,0 +1,887 @@
+#include "GlassEngine.h"
+
+#include <cmath>
+
+static const float ENGINE_DEG_TO_RAD = 0.017453292519943295f;
+static const float ENGINE_TWO_PI = 6.283185307179586f;
+
+// 8bit の座標を1ビットおきに広げる（Morton 符号 = spread(x) | spread(y) << 1）
+struct MortonTable {
+  uint16_t spread[256];
+  MortonTable() {
+    for (int i = 0; i < 256; i++) {
+      uint16_t v = 0;
+      for (int b = 0; b < 8; b++) v |= ((i >> b) & 1) << (2 * b);
+      spread[i] = v;
+    }
+  }
+};
+static const MortonTable MORTON;
+
+template <typename T>
+static T clampValue(T value, T low, T high) {
+  return value < low ? low : (value > high ? high : value);
+}
+
+GlassEngine::GlassEngine(const GlassConfig& config, uint32_t seed)
+    : config(config), rng(seed), fluid(SCREEN_WIDTH, GLASS_RIM_RADIUS) {
+  for (int i = 0; i < DIRECTION_STEPS; i++) {
+    directionCos[i] = cosf(i * ENGINE_DEG_TO_RAD);
+    directionSin[i] = sinf(i * ENGINE_DEG_TO_RAD);
+  }
+  reset(0);
+}
+
+void GlassEngine::reset(unsigned long now) {
+  currentState = NORMAL;
+  previousState = NORMAL;
+  encoderDelta = 0;
+  rotationSpeed = 0.0f;
+  spinVelocity = 0.0f;
+  spinBucket = 0;
+  shatterBucket = 0;
+  lastStepTime = now;
+  stepInterval = 0;
+  destructionLevel = 0.0f;
+  clearCracks();
+  particles.clear();
+  clearDust();
+  clearPanes();
+  parallax = 0.0f;
+  fluidSteps = 0;
+  dustSortCountdown = 0;
+  cracks.reserve(config.maxCracks);
+  decals.reserve(config.maxDecals);
+  particles.reserve(config.maxParticles);
+  dust.reserve(config.maxDust);
+  stateStartTime = now;
+  lastInteractionTime = now;
+  events.clear();
+  impacts.clear();
+  droppedImpacts = 0;
+  buildProfiles();
+}
+
+// ========================================
+// 回転の激しさごとの破壊の仕方
+// ========================================
+// 段階の中央の激しさ t（0 = ゆっくり, 1 = 激しい）で両端の値を補間する。
+// 毎フレームの処理は spinBucket で表を引くだけ。
+void GlassEngine::buildProfiles() {
+  for (int b = 0; b < SPIN_BUCKETS; b++) {
+    float t = (b + 0.5f) / SPIN_BUCKETS;
+    auto lerp = [t](float slow, float fast) { return slow + (fast - slow) * t; };
+
+    DestructionProfile& pr = profiles[b];
+    pr.destructionGain = lerp(config.slowDestructionGain, config.fastDestructionGain);
+    pr.crackLengthMin = (int)lerp(30, 10);
+    pr.crackLengthMax = (int)lerp(60, 25);
+    pr.branchChance = clampValue((int)(config.crackBranchChance * lerp(0.3f, 1.7f)), 0, 100);
+    pr.branchDepth = 1 + (int)(t * 3);
+    pr.branchSpread = (int)lerp(15, 50);
+    pr.particleCount = (int)(config.maxParticles * lerp(0.5f, 1.0f));
+    pr.particleSpeedMin = lerp(0.5f, 2.0f);
+    pr.particleSpeedMax = lerp(2.0f, 6.0f);
+    pr.spawnRadiusMax = (int)lerp(40, 70);
+    pr.particleSizeMin = (int)(lerp(2.0f, 1.0f) + 0.5f);
+    pr.particleSizeMax = (int)(lerp(5.0f, 2.0f) + 0.5f);
+    pr.shatterHaptic = (int)lerp(150, 450);
+    pr.dustCount = (int)(config.maxDust * lerp(0.4f, 1.0f));
+  }
+}
+
+void GlassEngine::step(const GlassInput& input, unsigned long now) {
+  fluidSteps = 0;
+  events.clear();
+  impacts.clear();
+  droppedImpacts = 0;
+
+  applyEncoder(input.encoderDelta, now);
+  applyButton(input.button, now);
+  updateState(now);
+  updateCracks();
+  autoRecover(now);
+}
+
+int GlassEngine::activeParticleCount() const {
+  int count = 0;
+  for (const auto& p : particles) {
+    if (p.active) count++;
+  }
+  return count;
+}
+
+// 状態・乱数・ひびの端点・破片と粉塵の位置を、浮動小数点のビット列のまま混ぜる
+template <typename T>
+static void hashValue(uint32_t& h, T value) {
+  const uint8_t* bytes = (const uint8_t*)&value;
+  for (size_t i = 0; i < sizeof(value); i++) h = (h ^ bytes[i]) * 16777619u;
+}
+
+uint32_t GlassEngine::stateHash() const {
+  uint32_t h = 2166136261u;
+  GlassRandom probe = rng;   // 乱数の内部状態は次の値で代える
+  hashValue(h, probe.next());
+  hashValue(h, (int32_t)currentState);
+  hashValue(h, destructionLevel);
+  hashValue(h, dustLevel);
+  hashValue(h, parallax);
+  hashValue(h, (int32_t)activePane);
+  hashValue(h, (uint32_t)stateStartTime);
+  hashValue(h, (uint32_t)lastInteractionTime);
+  hashValue(h, (uint32_t)cracks.size());
+  for (const Crack& c : cracks) {
+    hashValue(h, c.endX);
+    hashValue(h, c.endY);
+    hashValue(h, c.alpha);
+  }
+  hashValue(h, (uint32_t)particles.size());
+  for (const Particle& p : particles) {
+    hashValue(h, p.x);
+    hashValue(h, p.y);
+  }
+  hashValue(h, (uint32_t)dust.size());
+  for (const DustMote& d : dust) {
+    hashValue(h, d.x);
+    hashValue(h, d.y);
+  }
+  return h;
+}
+
+// ========================================
+// エンコーダー入力
+// ========================================
+void GlassEngine::applyEncoder(int32_t delta, unsigned long now) {
+  encoderDelta = delta;
+
+  // 時刻から回転速度を求めて平滑化する（フレーム間隔が揺れても同じ回し方なら同じ値）
+  unsigned long dt = now - lastStepTime;
+  lastStepTime = now;
+  stepInterval = dt;
+  if (dt > 0) {
+    float instant = encoderDelta * 1000.0f / dt;
+    spinVelocity += (instant - spinVelocity) * (dt / (config.spinSmoothing + dt));
+  }
+  spinBucket = clampValue((int)(fabsf(spinVelocity) / config.spinVelocityFast * SPIN_BUCKETS),
+                          0, SPIN_BUCKETS - 1);
+
+  if (encoderDelta != 0) {
+    lastInteractionTime = now;
+
+    // 回転速度計算（-1.0 ~ 1.0）
+    rotationSpeed = clampValue(encoderDelta / 10.0f, -1.0f, 1.0f);
+
+    // 破壊進行度更新
+    updateDestruction();
+  } else {
+    rotationSpeed *= config.rotationDecay; // 減衰
+  }
+
+  // 視差（回すと傾き、止めると正面に戻る）
+  parallax = clampValue(parallax * config.parallaxDecay + encoderDelta * config.parallaxPerCount, -1.0f, 1.0f);
+}
+
+// ========================================
+// 破壊進行度更新
+// ========================================
+void GlassEngine::updateDestruction() {
+  // 正回転で破壊（速く回すほど大きく進む）、逆回転で修復
+  float gain = encoderDelta > 0 ? profiles[spinBucket].destructionGain : 1.0f;
+  destructionLevel += encoderDelta * config.destructionRate * gain;
+  destructionLevel = clampValue(destructionLevel, 0.0f, 1.0f);
+}
+
+// ========================================
+// ボタン入力
+// ========================================
+void GlassEngine::applyButton(ButtonInput button, unsigned long now) {
+  if (button == BUTTON_PRESS) {
+    // 短押し: 一段階戻る
+    lastInteractionTime = now;
+
+    switch (currentState) {
+      case CRACK:
+        currentState = NORMAL;
+        clearCracks();
+        destructionLevel = 0.0f;
+        break;
+      case SHATTER:
+      case SILENCE:
+        currentState = CRACK;
+        particles.clear();
+        clearDust();
+        destructionLevel = config.crackThreshold + 0.1f;
+        break;
+      case REBUILD:
+      case RECOVERY:
+        currentState = NORMAL;
+        particles.clear();
+        clearDust();
+        clearCracks();
+        clearPanes();
+        destructionLevel = 0.0f;
+        break;
+      default:
+        break;
+    }
+
+    emitSound(FREQ_BUTTON, 50);
+    emitLog("Button: Step back");
+  } else if (button == BUTTON_HOLD) {
+    // 長押し: 完全リセット
+    currentState = NORMAL;
+    clearAll();
+    lastInteractionTime = now;
+
+    emitSound(FREQ_RECOVERY, 200);
+    emitLog("Button: Full reset");
+  }
+}
+
+// ========================================
+// 状態更新ロジック
+// ========================================
+void GlassEngine::changeState(State next, unsigned long now, const char* message) {
+  currentState = next;
+  stateStartTime = now;
+  emitLog(message);
+}
+
+void GlassEngine::updateState(unsigned long now) {
+  previousState = currentState;
+
+  switch (currentState) {
+    case NORMAL:
+      if (destructionLevel > config.crackThreshold) {
+        changeState(CRACK, now, "State: NORMAL -> CRACK");
+        emitSound(FREQ_CRACK, 50);
+        emitHaptic(60, 30);
+      }
+      break;
+
+    case CRACK:
+      if (destructionLevel > config.shatterThreshold) {
+        changeState(SHATTER, now, "State: CRACK -> SHATTER");
+        shatterBucket = spinBucket;
+        generateParticles();
+        generateDust();
+        transmitCracks();
+        emitSound(FREQ_SHATTER, 200);
+        emitHaptic(profiles[shatterBucket].shatterHaptic, 10);
+      } else if (destructionLevel < config.crackThreshold) {
+        clearCracks();
+        changeState(NORMAL, now, "State: CRACK -> NORMAL");
+      }
+      break;
+
+    case SHATTER:
+      // 粒子更新
+      updateParticles();
+      updateDust(now);
+
+      // 逆回転で修復開始
+      if (encoderDelta < -2) {
+        changeState(REBUILD, now, "State: SHATTER -> REBUILD");
+        emitSound(FREQ_REBUILD, 100);
+        emitHaptic(500, 15);
+      }
+
+      // 静止で余韻
+      if (now - lastInteractionTime > config.silenceDelay && fabsf(rotationSpeed) < 0.01f) {
+        changeState(SILENCE, now, "State: SHATTER -> SILENCE");
+      }
+      break;
+
+    case SILENCE:
+      // 粉塵だけが漂い続ける
+      updateDust(now);
+
+      // 奥に板が残っていれば、正回転で次の板へ
+      if (encoderDelta > 0 && activePane + 1 < config.paneCount) {
+        breakThrough(now);
+        break;
+      }
+
+      // 逆回転で修復
+      if (encoderDelta < 0) {
+        changeState(REBUILD, now, "State: SILENCE -> REBUILD");
+        emitSound(FREQ_REBUILD, 100);
+      }
+      break;
+
+    case REBUILD:
+      // 修復進行
+      updateParticles();
+      updateDust(now);
+
+      if (destructionLevel < 0.05f) {
+        changeState(RECOVERY, now, "State: REBUILD -> RECOVERY");
+        emitSound(FREQ_RECOVERY, 150);
+        emitHaptic(40, 20);
+      }
+      break;
+
+    case RECOVERY:
+      // 完全修復後、NORMALへ
+      if (now - stateStartTime > config.recoveryDuration) {
+        clearAll();
+        changeState(NORMAL, now, "State: RECOVERY -> NORMAL");
+      }
+      break;
+  }
+}
+
+// ========================================
+// ひび割れの成長と消失
+// ========================================
+void GlassEngine::updateCracks() {
+  if (currentState == CRACK) {
+    const DestructionProfile& profile = profiles[spinBucket];
+
+    // ひび割れ生成（破壊進行度に応じて）
+    const int maxCracks = sectorCount(config.maxCracks);
+    int targetCracks = (int)((destructionLevel - config.crackThreshold) /
+                             (config.shatterThreshold - config.crackThreshold) * maxCracks);
+
+    while ((int)cracks.size() < targetCracks && (int)cracks.size() < maxCracks) {
+      float angle = rng.uniform(0, config.kaleidoscope ? 360 / KALEIDOSCOPE_SECTORS : 360) * ENGINE_DEG_TO_RAD;
+      if (cracks.empty()) addDecal(CENTER_X, CENTER_Y, DECAL_STAR, angle);  // 最初のひびの向きに合わせる
+      generateCrack(CENTER_X, CENTER_Y, angle, 0);
+    }
+
+    // 分岐ひび（フラクタル）。このフレームで増えた分は次フレームから対象
+    size_t count = cracks.size();
+    for (size_t i = 0; i < count; i++) {
+      const Crack crack = cracks[i];
+      if (crack.active && crack.generation < profile.branchDepth && rng.uniform(100) < profile.branchChance) {
+        float newAngle = crack.angle + rng.uniform(-profile.branchSpread, profile.branchSpread) * ENGINE_DEG_TO_RAD;
+        generateCrack(crack.endX, crack.endY, newAngle, crack.generation + 1);
+      }
+    }
+  } else if (currentState == REBUILD) {
+    // ひび割れが徐々に消える
+    for (auto& crack : cracks) {
+      crack.alpha *= config.crackFade;
+    }
+    for (auto& decal : decals) {
+      decal.alpha *= config.crackFade;
+    }
+  }
+}
+
+// ========================================
+// ひび割れ生成
+// ========================================
+void GlassEngine::generateCrack(float centerX, float centerY, float angle, int generation) {
+  if ((int)cracks.size() >= sectorCount(config.maxCracks)) return;
+
+  Crack crack;
+  crack.startX = centerX;
+  crack.startY = centerY;
+  const DestructionProfile& profile = profiles[spinBucket];
+  crack.length = rng.uniform(profile.crackLengthMin, profile.crackLengthMax) / (generation + 1.0f);
+  crack.angle = angle;
+  crack.endX = centerX + cosf(angle) * crack.length;
+  crack.endY = centerY + sinf(angle) * crack.length;
+  crack.generation = generation;
+  crack.alpha = 1.0f;
+  crack.active = true;
+
+  cracks.push_back(crack);
+}
+
+// ========================================
+// ひびの画像
+// ========================================
+// 上限に達したら増やさない（古い跡を消して置き換えると跡がちらつく）
+void GlassEngine::addDecal(float x, float y, DecalKind kind, float angle) {
+  if ((int)decals.size() >= config.maxDecals) return;
+  int index = (int)lroundf(angle * (DECAL_ANGLES / ENGINE_TWO_PI)) % DECAL_ANGLES;
+  if (index < 0) index += DECAL_ANGLES;
+
+  CrackDecal decal;
+  decal.x = x;
+  decal.y = y;
+  decal.kind = (uint8_t)kind;
+  decal.angle = (uint8_t)index;
+  decal.alpha = 1.0f;
+  decals.push_back(decal);
+}
+
+void GlassEngine::clearCracks() {
+  cracks.clear();
+  decals.clear();
+}
+
+// ========================================
+// 重ねたガラス
+// ========================================
+// 粉砕の衝撃で次の板に中心からのひびが入る（割れた板の激しさで長さが決まる）
+void GlassEngine::transmitCracks() {
+  int next = activePane + 1;
+  if (next >= config.paneCount) return;
+  GlassPane& pane = panes[next];
+  const DestructionProfile& profile = profiles[shatterBucket];
+  for (int i = 0; i < config.paneTransmittedCracks; i++) {
+    Crack crack;
+    crack.startX = CENTER_X;
+    crack.startY = CENTER_Y;
+    crack.length = rng.uniform(profile.crackLengthMin, profile.crackLengthMax);
+    crack.angle = rng.uniform(0, 360) * ENGINE_DEG_TO_RAD;
+    crack.endX = CENTER_X + cosf(crack.angle) * crack.length;
+    crack.endY = CENTER_Y + sinf(crack.angle) * crack.length;
+    crack.generation = 0;
+    crack.alpha = 1.0f;
+    crack.active = true;
+    pane.cracks.push_back(crack);
+  }
+  pane.revision++;
+}
+
+// 割れた板の破片と粉塵は落ちきったものとして消し、次の板を手前にする。
+// 伝わっていたひびがあればそこから CRACK で続ける
+void GlassEngine::breakThrough(unsigned long now) {
+  GlassPane& pane = panes[++activePane];
+  clearCracks();
+  cracks.swap(pane.cracks);
+  pane.revision++;
+  particles.clear();
+  clearDust();
+  if (cracks.empty()) {
+    destructionLevel = 0.0f;
+    changeState(NORMAL, now, "State: SILENCE -> NORMAL (next pane)");
+  } else {
+    destructionLevel = config.crackThreshold + 0.01f;
+    changeState(CRACK, now, "State: SILENCE -> CRACK (next pane)");
+  }
+  emitSound(FREQ_CRACK, 50);
+  emitHaptic(80, 40);
+}
+
+void GlassEngine::clearPanes() {
+  activePane = 0;
+  for (GlassPane& pane : panes) {
+    pane.cracks.clear();
+    pane.revision++;
+  }
+}
+
+// ========================================
+// 粒子生成
+// ========================================
+// 粉砕した瞬間の回転の激しさで数・初速・大きさが決まる
+void GlassEngine::generateParticles() {
+  particles.clear();
+  const DestructionProfile& profile = profiles[shatterBucket];
+  const int count = sectorCount(profile.particleCount);
+  const int directions = config.kaleidoscope ? DIRECTION_STEPS / KALEIDOSCOPE_SECTORS : DIRECTION_STEPS;
+
+  for (int i = 0; i < count; i++) {
+    Particle p;
+
+    // 中心からランダムな位置
+    int direction = rng.uniform(directions);
+    float distance = rng.uniform(10, profile.spawnRadiusMax);
+    p.x = CENTER_X + directionCos[direction] * distance;
+    p.y = CENTER_Y + directionSin[direction] * distance;
+
+    // 外向きの速度
+    float speed = rng.uniformFloat(profile.particleSpeedMin, profile.particleSpeedMax);
+    p.vx = directionCos[direction] * speed;
+    p.vy = directionSin[direction] * speed;
+
+    p.size = rng.uniform(profile.particleSizeMin, profile.particleSizeMax);
+    p.alpha = 1.0f;
+    p.active = true;
+
+    particles.push_back(p);
+  }
+}
+
+// ========================================
+// 万華鏡
+// ========================================
+// 全体の数を扇形1つ分（に密度を掛けたもの）に減らす
+int GlassEngine::sectorCount(int count) const {
+  if (!config.kaleidoscope) return count;
+  return (int)(count * config.kaleidoscopeDensity / KALEIDOSCOPE_SECTORS + 0.5f);
+}
+
+// 扇形の辺は鏡。外に出た点を辺で折り返して扇形に戻す（速度も折り返す）
+static void foldIntoSector(float& x, float& y, float& vx, float& vy) {
+  const float ux = 0.5f, uy = 0.8660254f;   // 扇形のもう一方の辺（60度）の向き
+  float dx = x - CENTER_X, dy = y - CENTER_Y;
+  for (int i = 0; i < KALEIDOSCOPE_SECTORS; i++) {
+    if (dy < 0.0f) {
+      dy = -dy;
+      vy = -vy;
+    } else if (dy * ux - dx * uy > 0.0f) {
+      // 2(p・u)u - p
+      float pu = dx * ux + dy * uy, vu = vx * ux + vy * uy;
+      dx = 2 * pu * ux - dx;
+      dy = 2 * pu * uy - dy;
+      vx = 2 * vu * ux - vx;
+      vy = 2 * vu * uy - vy;
+    } else {
+      break;
+    }
+  }
+  x = CENTER_X + dx;
+  y = CENTER_Y + dy;
+}
+
+// 流れに乗る粉塵は鏡で折り返すと辺に溜まる（向こう岸の辺は薄くなる）ので、
+// 扇形の外に出たら 60度回して反対側の辺から戻す
+static void wrapIntoSector(float& x, float& y, float& vx, float& vy) {
+  const float c = 0.5f, s = 0.8660254f;
+  float dx = x - CENTER_X, dy = y - CENTER_Y;
+  for (int i = 0; i < KALEIDOSCOPE_SECTORS / 2; i++) {
+    float turn;
+    if (dy < 0.0f) turn = s;                          // +60度
+    else if (dy * c - dx * s > 0.0f) turn = -s;       // -60度
+    else break;
+    float nx = dx * c - dy * turn, ny = dx * turn + dy * c;
+    float nvx = vx * c - vy * turn, nvy = vx * turn + vy * c;
+    dx = nx;
+    dy = ny;
+    vx = nvx;
+    vy = nvy;
+  }
+  x = CENTER_X + dx;
+  y = CENTER_Y + dy;
+}
+
+// 扇形 sector に映した点（奇数番目は鏡像）
+static void sectorImage(int sector, float x, float y, float& outX, float& outY) {
+  float dx = x - CENTER_X, dy = y - CENTER_Y;
+  if (sector & 1) dy = -dy;
+  float angle = (sector + (sector & 1)) * (ENGINE_TWO_PI / KALEIDOSCOPE_SECTORS);
+  float c = cosf(angle), s = sinf(angle);
+  outX = CENTER_X + dx * c - dy * s;
+  outY = CENTER_Y + dx * s + dy * c;
+}
+
+// ========================================
+// 粒子更新
+// ========================================
+void GlassEngine::updateParticles() {
+  for (auto& p : particles) {
+    if (!p.active) continue;
+
+    if (currentState == SHATTER || currentState == SILENCE) {
+      // 拡散
+      p.x += p.vx;
+      p.y += p.vy;
+      p.vx *= config.particleDrag; // 減衰
+      p.vy *= config.particleDrag;
+      p.alpha *= config.particleFade;
+
+      // ガラスの縁で跳ね返る（画面外には出ない）。破片の外周が縁に触れたところで
+      // 跳ね返すので、大きな破片も描画の消去円（GlassRenderer.h）からはみ出さない
+      float dx = p.x - CENTER_X;
+      float dy = p.y - CENTER_Y;
+      float r2 = dx * dx + dy * dy;
+      float rim = GLASS_RIM_RADIUS - p.size;
+      if (r2 > rim * rim) {
+        float r = sqrtf(r2);
+        float nx = dx / r;
+        float ny = dy / r;
+        float vn = p.vx * nx + p.vy * ny;
+        if (vn > 0) {
+          p.vx -= (1.0f + config.rimRestitution) * vn * nx;
+          p.vy -= (1.0f + config.rimRestitution) * vn * ny;
+          emitImpact(p.x, p.y, vn, p.size, true);
+          // 速く当たった破片は縁に欠けの跡を残す（画像の向きは縁の外向き）
+          if (vn >= config.chipMinSpeed) {
+            addDecal(CENTER_X + nx * GLASS_RIM_RADIUS, CENTER_Y + ny * GLASS_RIM_RADIUS, DECAL_CHIP, atan2f(ny, nx));
+          }
+        }
+        p.x = CENTER_X + nx * rim;
+        p.y = CENTER_Y + ny * rim;
+      }
+      if (config.kaleidoscope) foldIntoSector(p.x, p.y, p.vx, p.vy);
+
+      if (p.alpha < 0.1f) {
+        p.active = false;
+      }
+
+    } else if (currentState == REBUILD) {
+      // 中央に収束
+      float dx = CENTER_X - p.x;
+      float dy = CENTER_Y - p.y;
+      float distance = sqrtf(dx * dx + dy * dy);
+
+      if (distance > 5) {
+        p.vx = dx * 0.05f;
+        p.vy = dy * 0.05f;
+        p.x += p.vx;
+        p.y += p.vy;
+      } else {
+        p.active = false;
+      }
+    }
+  }
+
+  if (currentState == SHATTER) {
+    collideParticles();
+  }
+}
+
+// ========================================
+// 粉塵
+// ========================================
+// 破片より遅く広がり、SILENCE の間も漂い続ける。数が多いので衝突も
+// 個別の明るさも持たず、縁では止まるだけ。最も細かい粉（fluidDustShare）は
+// 粒にせず流体の密度に置き、ダイヤルの回転が起こす流れで運ぶ。
+void GlassEngine::generateDust() {
+  clearDust();
+  const DestructionProfile& profile = profiles[shatterBucket];
+  const int count = sectorCount(profile.dustCount);
+  const int directions = config.kaleidoscope ? DIRECTION_STEPS / KALEIDOSCOPE_SECTORS : DIRECTION_STEPS;
+  int fineCount = (int)(count * config.fluidDustShare);
+
+  for (int i = 0; i < count; i++) {
+    int direction = rng.uniform(directions);
+    float distance = rng.uniformFloat(0.0f, (float)profile.spawnRadiusMax);
+    float speed = rng.uniformFloat(0.1f, profile.particleSpeedMax * 0.5f);
+
+    DustMote d;
+    d.x = CENTER_X + directionCos[direction] * distance;
+    d.y = CENTER_Y + directionSin[direction] * distance;
+    d.vx = directionCos[direction] * speed;
+    d.vy = directionSin[direction] * speed;
+    if (i < fineCount) {
+      if (config.kaleidoscope) {
+        // 流体は格子全体で動くので、細かい粉は6つの扇形すべてに置く（回転で扇形の外へ流れても減らない）
+        for (int s = 0; s < KALEIDOSCOPE_SECTORS; s++) {
+          float fx, fy;
+          sectorImage(s, d.x, d.y, fx, fy);
+          fluid.deposit(fx, fy, 1.0f);
+        }
+      } else {
+        fluid.deposit(d.x, d.y, 1.0f);
+      }
+    } else {
+      dust.push_back(d);
+    }
+  }
+  dustLevel = count > 0 ? 1.0f : 0.0f;   // maxDust = 0 なら粉塵の更新ごと止まる
+  fluidActive = fineCount > 0;
+  lastFluidTime = stateStartTime;
+}
+
+void GlassEngine::clearDust() {
+  dust.clear();
+  dustLevel = 0.0f;
+  fluid.clear();
+  fluidActive = false;
+}
+
+// 流体は fluidInterval ごとの固定刻みで進める（フレーム間隔が揺れても
+// 同じ時刻には同じ回数だけ進む）。遅れが大きいときは追いつかずに捨てる。
+void GlassEngine::updateFluid(unsigned long now) {
+  if (!fluidActive) return;
+  if (now - lastFluidTime > config.fluidInterval * 4) {
+    lastFluidTime = now - config.fluidInterval;
+  }
+
+  float swirl = clampValue(spinVelocity / config.spinVelocityFast, -1.0f, 1.0f) * config.fluidSpinForce;
+  float inward = currentState == REBUILD ? config.fluidInwardForce : 0.0f;
+  while (now - lastFluidTime >= config.fluidInterval) {
+    fluid.step(swirl, inward);
+    lastFluidTime += config.fluidInterval;
+    fluidSteps++;
+  }
+}
+
+void GlassEngine::updateDust(unsigned long now) {
+  if (dustLevel <= 0.0f) return;
+  updateFluid(now);
+
+  if (currentState == REBUILD) {
+    // 破片と一緒に中央へ吸い込まれて消える
+    for (auto& d : dust) {
+      d.x += (CENTER_X - d.x) * 0.05f;
+      d.y += (CENTER_Y - d.y) * 0.05f;
+    }
+    dustLevel *= 0.97f;
+  } else {
+    // 粒も流れに少しずつ乗る（流体の速度は1流体ステップあたりなので1フレーム分に直す）
+    const float rim2 = GLASS_RIM_RADIUS * GLASS_RIM_RADIUS;
+    const float flowScale = fluidActive ? (float)stepInterval / config.fluidInterval : 0.0f;
+    for (auto& d : dust) {
+      if (flowScale > 0.0f) {
+        float fu, fv;
+        fluid.velocityAt(d.x, d.y, fu, fv);
+        d.vx += (fu * flowScale - d.vx) * config.fluidCoupling;
+        d.vy += (fv * flowScale - d.vy) * config.fluidCoupling;
+      }
+      d.x += d.vx;
+      d.y += d.vy;
+      d.vx *= config.dustDrag;
+      d.vy *= config.dustDrag;
+
+      float dx = d.x - CENTER_X;
+      float dy = d.y - CENTER_Y;
+      if (dx * dx + dy * dy > rim2) {
+        d.x -= d.vx;
+        d.y -= d.vy;
+        d.vx = 0.0f;
+        d.vy = 0.0f;
+      }
+      if (config.kaleidoscope) wrapIntoSector(d.x, d.y, d.vx, d.vy);
+    }
+    dustLevel *= config.dustFade;
+  }
+
+  if (dustLevel < 0.02f) {
+    clearDust();
+  } else if (config.dustSortInterval > 0 && --dustSortCountdown <= 0) {
+    sortDust();
+    dustSortCountdown = config.dustSortInterval;
+  }
+}
+
+// ========================================
+// 粉塵の Z 順ソート
+// ========================================
+// 生成順のままだと、続けて splat する粒が密度グリッドの離れた場所
+// （PSRAM では別のキャッシュライン）に散る。画面座標の Morton 符号で
+// 並べ直すと、近い粒が配列でも近くに並ぶ。粒は少しずつしか動かないので
+// 数フレームおきで十分。16bit の符号を8bitずつ2回の安定な基数ソートで並べる。
+// 粒ごとの更新も splat も順序に依らないので、描画結果は変わらない。
+void GlassEngine::sortDust() {
+  const size_t n = dust.size();
+  if (n < 2) return;
+  dustScratch.resize(n);
+  dustKeys.resize(n);
+  dustKeysScratch.resize(n);
+
+  for (size_t i = 0; i < n; i++) {
+    int x = clampValue((int)dust[i].x, 0, 255);
+    int y = clampValue((int)dust[i].y, 0, 255);
+    dustKeys[i] = (uint16_t)(MORTON.spread[x] | (MORTON.spread[y] << 1));
+  }
+
+  for (int shift = 0; shift < 16; shift += 8) {
+    size_t offsets[256] = {0};
+    for (size_t i = 0; i < n; i++) offsets[(dustKeys[i] >> shift) & 0xFF]++;
+    size_t sum = 0;
+    for (int b = 0; b < 256; b++) {
+      size_t count = offsets[b];
+      offsets[b] = sum;
+      sum += count;
+    }
+    for (size_t i = 0; i < n; i++) {
+      size_t to = offsets[(dustKeys[i] >> shift) & 0xFF]++;
+      dustScratch[to] = dust[i];
+      dustKeysScratch[to] = dustKeys[i];
+    }
+    dust.swap(dustScratch);
+    dustKeys.swap(dustKeysScratch);
+  }
+}
+
+// ========================================
+// 破片同士の衝突
+// ========================================
+void GlassEngine::collideParticles() {
+  // 一様グリッドに振り分け、同じセルと右・下側の隣接セルだけを調べる
+  cellHead.assign(COLLISION_GRID * COLLISION_GRID, -1);
+  cellNext.resize(particles.size());
+
+  for (size_t i = 0; i < particles.size(); i++) {
+    const Particle& p = particles[i];
+    if (!p.active) continue;
+    int cx = clampValue((int)p.x / COLLISION_CELL, 0, COLLISION_GRID - 1);
+    int cy = clampValue((int)p.y / COLLISION_CELL, 0, COLLISION_GRID - 1);
+    int cell = cy * COLLISION_GRID + cx;
+    cellNext[i] = cellHead[cell];
+    cellHead[cell] = (int)i;
+  }
+
+  static const int NEIGHBORS[5][2] = {{0, 0}, {1, 0}, {-1, 1}, {0, 1}, {1, 1}};
+
+  for (int cy = 0; cy < COLLISION_GRID; cy++) {
+    for (int cx = 0; cx < COLLISION_GRID; cx++) {
+      for (int a = cellHead[cy * COLLISION_GRID + cx]; a >= 0; a = cellNext[a]) {
+        for (const auto& n : NEIGHBORS) {
+          int nx = cx + n[0];
+          int ny = cy + n[1];
+          if (nx < 0 || nx >= COLLISION_GRID || ny >= COLLISION_GRID) continue;
+
+          // 同じセル内は a より後ろの粒子だけ（重複を避ける）
+          int b = (n[0] == 0 && n[1] == 0) ? cellNext[a] : cellHead[ny * COLLISION_GRID + nx];
+          for (; b >= 0; b = cellNext[b]) {
+            Particle& p = particles[a];
+            Particle& q = particles[b];
+            float dx = q.x - p.x;
+            float dy = q.y - p.y;
+            float minDist = p.size + q.size;
+            float d2 = dx * dx + dy * dy;
+            if (d2 >= minDist * minDist || d2 < 1e-6f) continue;
+
+            float d = sqrtf(d2);
+            float ux = dx / d;
+            float uy = dy / d;
+            float approach = (p.vx - q.vx) * ux + (p.vy - q.vy) * uy;
+            if (approach <= 0) continue;  // 離れつつある
+
+            // 質量は面積に比例
+            float mp = p.size * p.size;
+            float mq = q.size * q.size;
+            float impulse = (1.0f + config.collisionRestitution) * approach / (mp + mq);
+            p.vx -= impulse * mq * ux;
+            p.vy -= impulse * mq * uy;
+            q.vx += impulse * mp * ux;
+            q.vy += impulse * mp * uy;
+
+            emitImpact((p.x + q.x) * 0.5f, (p.y + q.y) * 0.5f, approach,
+                       p.size < q.size ? p.size : q.size, false);
+          }
+        }
+      }
+    }
+  }
+}
+
+void GlassEngine::emitImpact(float x, float y, float speed, float size, bool rim) {
+  if (speed < config.impactMinSpeed) return;
+  if ((int)impacts.size() >= config.maxImpactsPerStep) {
+    droppedImpacts++;
+    return;
+  }
+  impacts.push_back({x, y, speed, size, rim});
+}
+
+// ========================================
+// 自動修復
+// ========================================
+void GlassEngine::autoRecover(unsigned long now) {
+  // 一定時間操作がない場合、自動的にNORMALに戻る
+  if (currentState != NORMAL && now - lastInteractionTime > config.autoRecoverTime) {
+    emitLog("Auto-recovery triggered");
+
+    // ゆっくりと修復
+    if (destructionLevel > 0) {
+      destructionLevel -= 0.01f;
+
+      if (destructionLevel <= 0) {
+        destructionLevel = 0;
+        clearAll();
+        changeState(RECOVERY, now, "State: -> RECOVERY (auto)");
+        emitSound(FREQ_RECOVERY, 150);
+      }
+    }
+
+    lastInteractionTime = now; // 連続実行を防ぐ
+  }
+}
+
+void GlassEngine::clearAll() {
+  particles.clear();
+  clearDust();
+  clearCracks();
+  clearPanes();
+  destructionLevel = 0.0f;
+}
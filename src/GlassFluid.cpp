@@ -0,0 +1,187 @@
+#include "GlassFluid.h"
+
+#include <algorithm>
+#include <cmath>
+
+static const float FLUID_DAMPING = 0.97f;   // 1ステップごとの速度の減衰
+
+static inline int fluidIndex(int x, int y) { return y * FLUID_N + x; }
+
+GlassFluid::GlassFluid(float size, float rimRadius) : cellSize(size / FLUID_N) {
+  const int cells = FLUID_N * FLUID_N;
+  density.assign(cells, 0.0f);
+  u.assign(cells, 0.0f);
+  v.assign(cells, 0.0f);
+  u0.assign(cells, 0.0f);
+  v0.assign(cells, 0.0f);
+  density0.assign(cells, 0.0f);
+  pressure.assign(cells, 0.0f);
+  pressure0.assign(cells, 0.0f);
+  divergence.assign(cells, 0.0f);
+  solid.assign(cells, 0);
+  swirlX.assign(cells, 0.0f);
+  swirlY.assign(cells, 0.0f);
+  inwardX.assign(cells, 0.0f);
+  inwardY.assign(cells, 0.0f);
+
+  // 縁の外側は壁。外力の向きはセルごとに一度だけ求めておく
+  const float center = FLUID_N * 0.5f;
+  const float rim = rimRadius / cellSize;
+  for (int y = 0; y < FLUID_N; y++) {
+    for (int x = 0; x < FLUID_N; x++) {
+      int i = fluidIndex(x, y);
+      float dx = x + 0.5f - center;
+      float dy = y + 0.5f - center;
+      float r = sqrtf(dx * dx + dy * dy);
+      solid[i] = (r > rim || x == 0 || y == 0 || x == FLUID_N - 1 || y == FLUID_N - 1) ? 1 : 0;
+      if (r > 1e-3f) {
+        swirlX[i] = -dy / r;
+        swirlY[i] = dx / r;
+        inwardX[i] = -dx / r;
+        inwardY[i] = -dy / r;
+      }
+    }
+  }
+
+  // 行ごとの流体セルの範囲（円なので1行に1区間）。壁のセルは以後触らない
+  for (int y = 0; y < FLUID_N; y++) {
+    spanBegin[y] = FLUID_N;
+    spanEnd[y] = 0;
+    for (int x = 0; x < FLUID_N; x++) {
+      if (solid[fluidIndex(x, y)]) continue;
+      if (spanBegin[y] > x) spanBegin[y] = x;
+      spanEnd[y] = x + 1;
+    }
+  }
+}
+
+void GlassFluid::clear() {
+  std::fill(density.begin(), density.end(), 0.0f);
+  std::fill(u.begin(), u.end(), 0.0f);
+  std::fill(v.begin(), v.end(), 0.0f);
+  std::fill(pressure.begin(), pressure.end(), 0.0f);
+  std::fill(pressure0.begin(), pressure0.end(), 0.0f);
+}
+
+void GlassFluid::deposit(float x, float y, float amount) {
+  float gx = x / cellSize - 0.5f;
+  float gy = y / cellSize - 0.5f;
+  int x0 = (int)floorf(gx);
+  int y0 = (int)floorf(gy);
+  if (x0 < 0 || y0 < 0 || x0 >= FLUID_N - 1 || y0 >= FLUID_N - 1) return;
+  float fx = gx - x0;
+  float fy = gy - y0;
+  const float weights[4] = {(1 - fx) * (1 - fy), fx * (1 - fy), (1 - fx) * fy, fx * fy};
+  const int cells[4] = {fluidIndex(x0, y0), fluidIndex(x0 + 1, y0), fluidIndex(x0, y0 + 1),
+                        fluidIndex(x0 + 1, y0 + 1)};
+  for (int k = 0; k < 4; k++) {
+    if (!solid[cells[k]]) density[cells[k]] += amount * weights[k];
+  }
+}
+
+void GlassFluid::velocityAt(float x, float y, float& vx, float& vy) const {
+  int cx = (int)(x / cellSize);
+  int cy = (int)(y / cellSize);
+  if (cx < 0 || cy < 0 || cx >= FLUID_N || cy >= FLUID_N) {
+    vx = vy = 0.0f;
+    return;
+  }
+  vx = u[fluidIndex(cx, cy)] * cellSize;
+  vy = v[fluidIndex(cx, cy)] * cellSize;
+}
+
+float GlassFluid::totalDensity() const {
+  float total = 0.0f;
+  for (float d : density) total += d;
+  return total;
+}
+
+// ========================================
+// 1ステップ
+// ========================================
+void GlassFluid::step(float swirl, float inward) {
+  // 外力と減衰
+  for (int y = 0; y < FLUID_N; y++) {
+    for (int i = fluidIndex(spanBegin[y], y), end = fluidIndex(spanEnd[y], y); i < end; i++) {
+      u[i] = (u[i] + swirl * swirlX[i] + inward * inwardX[i]) * FLUID_DAMPING;
+      v[i] = (v[i] + swirl * swirlY[i] + inward * inwardY[i]) * FLUID_DAMPING;
+    }
+  }
+
+  // 速度の移流
+  u0 = u;
+  v0 = v;
+  advect(u0, u, u0, v0);
+  advect(v0, v, u0, v0);
+  project();
+
+  // 密度は発散のない速度で運ぶ
+  density0 = density;
+  advect(density0, density, u, v);
+}
+
+// 各セルの中心から速度を逆にたどった位置の値を取る
+void GlassFluid::advect(const std::vector<float>& src, std::vector<float>& dst,
+                        const std::vector<float>& velU, const std::vector<float>& velV) {
+  for (int y = 0; y < FLUID_N; y++) {
+    for (int x = spanBegin[y]; x < spanEnd[y]; x++) {
+      int i = fluidIndex(x, y);
+      dst[i] = sample(src, x - velU[i], y - velV[i]);
+    }
+  }
+}
+
+float GlassFluid::sample(const std::vector<float>& field, float x, float y) const {
+  if (x < 0.5f) x = 0.5f;
+  if (y < 0.5f) y = 0.5f;
+  if (x > FLUID_N - 1.5f) x = FLUID_N - 1.5f;
+  if (y > FLUID_N - 1.5f) y = FLUID_N - 1.5f;
+  int x0 = (int)x;
+  int y0 = (int)y;
+  float fx = x - x0;
+  float fy = y - y0;
+  const float* row0 = field.data() + fluidIndex(x0, y0);
+  const float* row1 = row0 + FLUID_N;
+  return (row0[0] * (1 - fx) + row0[1] * fx) * (1 - fy) + (row1[0] * (1 - fx) + row1[1] * fx) * fy;
+}
+
+// ========================================
+// 圧力投影（発散をなくす）
+// ========================================
+// 壁のセルの速度は0、圧力は隣の流体セルと同じ（法線方向の勾配0）として扱う。
+// 反復は前回の圧力から始めるので、少ない回数でも落ち着く。
+void GlassFluid::project() {
+  for (int y = 0; y < FLUID_N; y++) {
+    for (int x = spanBegin[y]; x < spanEnd[y]; x++) {
+      int i = fluidIndex(x, y);
+      divergence[i] = 0.5f * (u[i + 1] - u[i - 1] + v[i + FLUID_N] - v[i - FLUID_N]);
+    }
+  }
+
+  for (int iter = 0; iter < FLUID_JACOBI_ITERATIONS; iter++) {
+    pressure.swap(pressure0);
+    for (int y = 0; y < FLUID_N; y++) {
+      for (int x = spanBegin[y]; x < spanEnd[y]; x++) {
+        int i = fluidIndex(x, y);
+        float p = pressure0[i];
+        float sum = (solid[i - 1] ? p : pressure0[i - 1]) + (solid[i + 1] ? p : pressure0[i + 1]) +
+                    (solid[i - FLUID_N] ? p : pressure0[i - FLUID_N]) +
+                    (solid[i + FLUID_N] ? p : pressure0[i + FLUID_N]);
+        pressure[i] = (sum - divergence[i]) * 0.25f;
+      }
+    }
+  }
+
+  for (int y = 0; y < FLUID_N; y++) {
+    for (int x = spanBegin[y]; x < spanEnd[y]; x++) {
+      int i = fluidIndex(x, y);
+      float p = pressure[i];
+      float left = solid[i - 1] ? p : pressure[i - 1];
+      float right = solid[i + 1] ? p : pressure[i + 1];
+      float up = solid[i - FLUID_N] ? p : pressure[i - FLUID_N];
+      float down = solid[i + FLUID_N] ? p : pressure[i + FLUID_N];
+      u[i] -= 0.5f * (right - left);
+      v[i] -= 0.5f * (down - up);
+    }
+  }
+}
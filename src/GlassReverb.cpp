@@ -0,0 +1,159 @@
+#include "GlassReverb.h"
+
+#include <math.h>
+#include <string.h>
+
+// 遅延線の長さ [サンプル]（互いに素、27〜71ms）
+static const int REVERB_LENGTHS[REVERB_LINES] = {1187, 1451, 1723, 1949, 2269, 2579, 2843, 3137};
+
+// 入力を遅延線へ送るときの符号（線ごとに変えて相関を減らす）
+static const int REVERB_SIGN[REVERB_LINES] = {1, -1, 1, -1, -1, 1, -1, 1};
+
+static inline int32_t toQ15(float x) { return (int32_t)lrintf(x * 32768.0f); }
+
+static inline int32_t mulQ15(int32_t a, int32_t b) { return (a * b + (1 << 14)) >> 15; }
+
+static inline int16_t saturate16(int32_t x) {
+  if (x > 32767) return 32767;
+  if (x < -32768) return -32768;
+  return (int16_t)x;
+}
+
+GlassReverb::GlassReverb() : active(false), quietSamples(0) {
+  const float norm = 1.0f / sqrtf((float)REVERB_LINES);
+  for (int l = 0; l < REVERB_LINES; l++) {
+    lines[l] = nullptr;
+    length[l] = REVERB_LENGTHS[l];
+    position[l] = 0;
+    lowpass[l] = 0;
+    // 1周（length サンプル）で RT60 に見合う分だけ小さくする
+    float g = powf(10.0f, -3.0f * length[l] / (REVERB_RT60 * GRAIN_SAMPLE_RATE));
+    gain[l] = toQ15(g * norm);
+  }
+  damping = toQ15(1.0f - expf(-6.2831853f * REVERB_DAMPING_HZ / GRAIN_SAMPLE_RATE));
+  send = toQ15(REVERB_SEND);
+  wet = toQ15(REVERB_WET * norm);
+}
+
+int GlassReverb::storageSamples() {
+  int total = 0;
+  for (int l = 0; l < REVERB_LINES; l++) total += REVERB_LENGTHS[l];
+  return total;
+}
+
+void GlassReverb::begin(int16_t* storage) {
+  for (int l = 0; l < REVERB_LINES; l++) {
+    lines[l] = storage;
+    storage += length[l];
+  }
+  clear();
+}
+
+void GlassReverb::clear() {
+  for (int l = 0; l < REVERB_LINES; l++) {
+    if (lines[l]) memset(lines[l], 0, length[l] * sizeof(int16_t));
+    position[l] = 0;
+    lowpass[l] = 0;
+  }
+  quietSamples = 0;
+  active = false;
+}
+
+void GlassReverb::process(int16_t* out, int samples) {
+  if (!lines[0]) return;
+  while (samples > 0) {
+    int block = samples < GRAIN_BLOCK_SAMPLES ? samples : GRAIN_BLOCK_SAMPLES;
+    processBlock(out, block);
+    out += block;
+    samples -= block;
+  }
+}
+
+// ========================================
+// 1ブロック
+// ========================================
+void GlassReverb::processBlock(int16_t* out, int samples) {
+  // 入力が無音で響きも止まっていれば何もしない
+  if (!active) {
+    bool silent = true;
+    for (int i = 0; i < samples && silent; i++) silent = out[i] == 0;
+    if (silent) return;
+    active = true;
+  }
+
+  // 遅延線の出力を読み、高域を落とす（ローパスの出力が響きとして聞こえる）
+  // 遅延線の端をまたぐときは2区間に分ける（内側のループに分岐を入れない）
+  memset(tap, 0, sizeof(int32_t) * samples);
+  for (int l = 0; l < REVERB_LINES; l++) {
+    int32_t* w = work[l];
+    int32_t y = lowpass[l];
+    int first = length[l] - position[l];
+    if (first > samples) first = samples;
+    const int16_t* src = lines[l] + position[l];
+    for (int i = 0; i < first; i++) {
+      y += mulQ15(src[i] - y, damping);
+      w[i] = y;
+    }
+    src = lines[l] - first;
+    for (int i = first; i < samples; i++) {
+      y += mulQ15(src[i] - y, damping);
+      w[i] = y;
+    }
+    lowpass[l] = y;
+    const int32_t g = gain[l];
+    for (int i = 0; i < samples; i++) {
+      tap[i] += w[i];
+      w[i] = mulQ15(w[i], g);
+    }
+  }
+
+  // Hadamard 行列（高速 Walsh-Hadamard 変換、加減算のみ）
+  for (int h = 1; h < REVERB_LINES; h <<= 1) {
+    for (int l = 0; l < REVERB_LINES; l += h * 2) {
+      for (int k = l; k < l + h; k++) {
+        int32_t* a = work[k];
+        int32_t* b = work[k + h];
+        for (int i = 0; i < samples; i++) {
+          int32_t x = a[i];
+          int32_t y = b[i];
+          a[i] = x + y;
+          b[i] = x - y;
+        }
+      }
+    }
+  }
+
+  // 入力を足して遅延線へ書き戻し、響きを出力へ足す
+  int32_t peak = 0;
+  for (int i = 0; i < samples; i++) tap[i] = mulQ15(tap[i], wet);
+  for (int i = 0; i < samples; i++) sent[i] = mulQ15(out[i], send);
+  for (int l = 0; l < REVERB_LINES; l++) {
+    int32_t* w = work[l];
+    if (REVERB_SIGN[l] > 0) {
+      for (int i = 0; i < samples; i++) w[i] += sent[i];
+    } else {
+      for (int i = 0; i < samples; i++) w[i] -= sent[i];
+    }
+    int first = length[l] - position[l];
+    if (first > samples) first = samples;
+    int16_t* dst = lines[l] + position[l];
+    for (int i = 0; i < first; i++) {
+      int16_t v = saturate16(w[i]);
+      dst[i] = v;
+      peak |= v < 0 ? -v : v;
+    }
+    dst = lines[l] - first;
+    for (int i = first; i < samples; i++) {
+      int16_t v = saturate16(w[i]);
+      dst[i] = v;
+      peak |= v < 0 ? -v : v;
+    }
+    position[l] = (position[l] + samples) % length[l];
+  }
+  for (int i = 0; i < samples; i++) out[i] = saturate16(out[i] + tap[i]);
+
+  // 書き込んだ値が一番長い遅延線の1周分ずっと小さければ、遅延線の中身は
+  // すべて小さいので止める（丸めによる小さな振動を残さない）
+  quietSamples = peak < REVERB_SILENT ? quietSamples + samples : 0;
+  if (quietSamples >= length[REVERB_LINES - 1]) clear();
+}
@@ -0,0 +1,247 @@
+#include "GrainSynth.h"
+
+#include <math.h>
+#include <string.h>
+
+static const float GRAIN_TWO_PI = 6.283185307179586f;
+
+// ガラス片の部分音（基音比・相対音量・減衰時間の比）
+static const float PARTIAL_RATIO[GRAIN_PARTIALS] = {1.0f, 2.32f, 4.25f};
+static const float PARTIAL_GAIN[GRAIN_PARTIALS] = {1.0f, 0.5f, 0.25f};
+static const float PARTIAL_DECAY[GRAIN_PARTIALS] = {1.0f, 0.6f, 0.35f};
+
+// これより小さくなった部分音は止まったとみなす
+static const float GRAIN_SILENT = 1e-3f;  // 約 -60dB
+
+// ========================================
+// GrainScheduler
+// ========================================
+GrainScheduler::GrainScheduler()
+    : impactsSeen(0), grainsScheduled(0), grainsLimited(0),
+      tokens(GRAIN_BURST), lastMs(0), rng(0x6A1A55) {}
+
+int GrainScheduler::schedule(const std::vector<ImpactEvent>& impacts, unsigned long nowMs,
+                             uint32_t eventMicros, GrainRequest* out) {
+  // 発生枠を補充（トークンバケット）
+  tokens += (nowMs - lastMs) * (GRAIN_RATE_PER_SEC / 1000.0f);
+  if (tokens > GRAIN_BURST) tokens = GRAIN_BURST;
+  lastMs = nowMs;
+
+  if (impacts.empty()) return 0;
+  impactsSeen += impacts.size();
+
+  // サイズ帯域ごとに、最大速度・件数・平均サイズをまとめる
+  float maxSpeed[GRAIN_SIZE_BANDS] = {};
+  float sizeSum[GRAIN_SIZE_BANDS] = {};
+  int count[GRAIN_SIZE_BANDS] = {};
+
+  for (const auto& impact : impacts) {
+    // 0.5px 刻みの対数帯域
+    int band = (int)log2f(impact.size * 2.0f + 1.0f);
+    if (band < 0) band = 0;
+    if (band >= GRAIN_SIZE_BANDS) band = GRAIN_SIZE_BANDS - 1;
+    if (impact.speed > maxSpeed[band]) maxSpeed[band] = impact.speed;
+    sizeSum[band] += impact.size;
+    count[band]++;
+  }
+
+  // 帯域ごとに1粒。件数が多いほど少し大きく
+  GrainRequest candidates[GRAIN_SIZE_BANDS];
+  int candidateCount = 0;
+  for (int band = 0; band < GRAIN_SIZE_BANDS; band++) {
+    if (count[band] == 0) continue;
+
+    float size = sizeSum[band] / count[band];
+    float loud = maxSpeed[band] / 4.0f;
+    if (loud > 1.0f) loud = 1.0f;
+    loud = loud * sqrtf(loud) * (1.0f + 0.15f * log2f((float)count[band]));
+    if (loud > 1.0f) loud = 1.0f;
+    if (loud < 0.05f) loud = 0.05f;
+
+    // ±4% ずらして同じ高さが並ばないようにする
+    float detune = 1.0f + (rng.uniform(-40, 41) / 1000.0f);
+
+    GrainRequest& g = candidates[candidateCount++];
+    g.frequency = 6600.0f / (size + 0.5f) * detune;
+    if (g.frequency > 9000.0f) g.frequency = 9000.0f;
+    if (g.frequency < 300.0f) g.frequency = 300.0f;
+    g.amplitude = loud;
+    g.decay = 0.02f + 0.03f * size;   // 大きい破片ほど長く鳴る
+    g.eventMicros = eventMicros;
+    g.startMicros = eventMicros;
+    g.frame = 0;
+    g.voice = GRAIN_VOICE_SYNTH;
+  }
+
+  // 大きい順に、フレーム上限と発生枠の範囲で出す
+  for (int i = 1; i < candidateCount; i++) {
+    GrainRequest key = candidates[i];
+    int j = i - 1;
+    while (j >= 0 && candidates[j].amplitude < key.amplitude) {
+      candidates[j + 1] = candidates[j];
+      j--;
+    }
+    candidates[j + 1] = key;
+  }
+
+  int emitted = 0;
+  for (int i = 0; i < candidateCount; i++) {
+    if (emitted >= GRAIN_MAX_PER_FRAME || tokens < 1.0f) {
+      grainsLimited++;
+      continue;
+    }
+    out[emitted++] = candidates[i];
+    tokens -= 1.0f;
+  }
+
+  grainsScheduled += emitted;
+  return emitted;
+}
+
+// ========================================
+// GrainMixer
+// ========================================
+GrainMixer::GrainMixer() : voiceSteals(0), pendingCount(0) {
+  memset(stateRe, 0, sizeof(stateRe));
+  memset(stateIm, 0, sizeof(stateIm));
+  memset(step4Re, 0, sizeof(step4Re));
+  memset(step4Im, 0, sizeof(step4Im));
+}
+
+float GrainMixer::voiceLevel(int voice) const {
+  float level = 0.0f;
+  for (int k = 0; k < GRAIN_PARTIALS; k++) {
+    int lane = voice * GRAIN_PARTIALS + k;
+    level += fabsf(stateRe[lane]) + fabsf(stateIm[lane]);
+  }
+  return level;
+}
+
+int GrainMixer::activeVoices() const {
+  int active = 0;
+  for (int v = 0; v < GRAIN_MAX_VOICES; v++) {
+    if (voiceLevel(v) > GRAIN_SILENT) active++;
+  }
+  return active + pendingCount;  // 予約中の粒も鳴っているものとして数える
+}
+
+void GrainMixer::start(const GrainRequest& grain) {
+  // 空いている声、なければ一番小さい声
+  int target = 0;
+  float quietest = 1e9f;
+  for (int v = 0; v < GRAIN_MAX_VOICES; v++) {
+    float level = voiceLevel(v);
+    if (level < quietest) {
+      quietest = level;
+      target = v;
+    }
+  }
+  if (quietest > GRAIN_SILENT) voiceSteals++;
+
+  for (int k = 0; k < GRAIN_PARTIALS; k++) {
+    int lane = target * GRAIN_PARTIALS + k;
+    float freq = grain.frequency * PARTIAL_RATIO[k];
+    float amp = grain.amplitude * PARTIAL_GAIN[k];
+
+    // ナイキスト付近の部分音は鳴らさない
+    if (freq > GRAIN_SAMPLE_RATE * 0.45f) amp = 0.0f;
+
+    float omega = GRAIN_TWO_PI * freq / GRAIN_SAMPLE_RATE;
+    float tau = grain.decay * PARTIAL_DECAY[k] * GRAIN_SAMPLE_RATE;
+    float damp = expf(-1.0f / tau);
+
+    // 位相0から（虚部が出力）
+    stateRe[lane] = amp;
+    stateIm[lane] = 0.0f;
+
+    // n サンプル先への回転 r^n（大きさ damp^n）
+    for (int n = 0; n < 4; n++) {
+      float mag = powf(damp, (float)(n + 1));
+      step4Re[n][lane] = mag * cosf(omega * (n + 1));
+      step4Im[n][lane] = mag * sinf(omega * (n + 1));
+    }
+  }
+}
+
+void GrainMixer::startAt(const GrainRequest& grain, int offset) {
+  offset &= ~3;
+  if (offset <= 0 || pendingCount >= GRAIN_MAX_PENDING) {
+    start(grain);
+    return;
+  }
+  int i = pendingCount++;
+  while (i > 0 && pendingOffset[i - 1] > offset) {
+    pending[i] = pending[i - 1];
+    pendingOffset[i] = pendingOffset[i - 1];
+    i--;
+  }
+  pending[i] = grain;
+  pendingOffset[i] = offset;
+}
+
+// mix[from, to) に全レーンを加える（from, to は4の倍数）
+void GrainMixer::renderLanes(int from, int to) {
+  for (int lane = 0; lane < LANES; lane++) {
+    float re = stateRe[lane];
+    float im = stateIm[lane];
+    if (fabsf(re) + fabsf(im) < GRAIN_SILENT) {
+      stateRe[lane] = stateIm[lane] = 0.0f;
+      continue;
+    }
+
+    const float r1 = step4Re[0][lane], i1 = step4Im[0][lane];
+    const float r2 = step4Re[1][lane], i2 = step4Im[1][lane];
+    const float r3 = step4Re[2][lane], i3 = step4Im[2][lane];
+    const float r4 = step4Re[3][lane], i4 = step4Im[3][lane];
+
+    // 4サンプルずつ、同じ状態から独立に求める（依存のない4レーン）
+    for (int i = from; i < to; i += 4) {
+      mix[i + 0] += im;
+      mix[i + 1] += re * i1 + im * r1;
+      mix[i + 2] += re * i2 + im * r2;
+      mix[i + 3] += re * i3 + im * r3;
+      float nr = re * r4 - im * i4;
+      im = re * i4 + im * r4;
+      re = nr;
+    }
+
+    stateRe[lane] = re;
+    stateIm[lane] = im;
+  }
+}
+
+void GrainMixer::render(int16_t* out, int samples) {
+  while (samples > 0) {
+    int block = samples < GRAIN_BLOCK_SAMPLES ? samples : GRAIN_BLOCK_SAMPLES;
+    memset(mix, 0, sizeof(float) * block);
+
+    // 予約の位置でブロックを区切り、区切りごとに声を鳴らし始める
+    int from = 0;
+    int used = 0;
+    while (used < pendingCount && pendingOffset[used] < block) {
+      renderLanes(from, pendingOffset[used]);
+      from = pendingOffset[used];
+      start(pending[used]);
+      used++;
+    }
+    renderLanes(from, block);
+
+    // 残った予約は次のブロック基準に
+    for (int i = used; i < pendingCount; i++) {
+      pending[i - used] = pending[i];
+      pendingOffset[i - used] = pendingOffset[i] - block;
+    }
+    pendingCount -= used;
+
+    // 音量を合わせてクリップし16bitへ
+    for (int i = 0; i < block; i++) {
+      float x = mix[i] * 0.35f;
+      if (x > 1.0f) x = 1.0f;
+      if (x < -1.0f) x = -1.0f;
+      out[i] = (int16_t)(x * 32767.0f);
+    }
+
+    out += block;
+    samples -= block;
+  }
+}
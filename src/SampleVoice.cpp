@@ -0,0 +1,124 @@
+#include "SampleVoice.h"
+#include "resample_table.h"
+
+#include <string.h>
+
+// タップ数を定数にした積和（コンパイラが展開する）。
+// x は出力位置の整数部から TAPS/2 - 1 個前の標本を指す
+template <int TAPS>
+static inline bool resampleTaps(const int16_t* table, const SampleClip& clip, uint32_t& position,
+                                uint32_t step, int32_t gain, int32_t* out, int samples) {
+  const int16_t* base = clip.data + RESAMPLE_PAD - (TAPS / 2 - 1);
+  const uint32_t end = (uint32_t)(clip.length + TAPS / 2) << 16;  // 後ろの余韻まで
+  uint32_t pos = position;
+  for (int i = 0; i < samples; i++) {
+    if (pos >= end) {
+      position = pos;
+      return false;
+    }
+    const int16_t* x = base + (pos >> 16);
+    const int16_t* c = table + (((pos & 0xFFFF) + (1 << (15 - RESAMPLE_PHASE_BITS))) >> (16 - RESAMPLE_PHASE_BITS)) * TAPS;
+    int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+    for (int k = 0; k < TAPS; k += 4) {
+      acc0 += x[k + 0] * c[k + 0];
+      acc1 += x[k + 1] * c[k + 1];
+      acc2 += x[k + 2] * c[k + 2];
+      acc3 += x[k + 3] * c[k + 3];
+    }
+    int32_t y = (acc0 + acc1 + acc2 + acc3 + (1 << 14)) >> 15;
+    out[i] += (y * gain + (1 << 14)) >> 15;
+    pos += step;
+  }
+  position = pos;
+  return true;
+}
+
+bool SamplePlayer::resample(const SampleClip& clip, int band, uint32_t& position, uint32_t step,
+                            int32_t gain, int32_t* out, int samples) {
+  const int16_t* table = RESAMPLE_TABLES[band];
+  switch (RESAMPLE_TAPS[band]) {
+    case 16: return resampleTaps<16>(table, clip, position, step, gain, out, samples);
+    case 24: return resampleTaps<24>(table, clip, position, step, gain, out, samples);
+    default: return resampleTaps<32>(table, clip, position, step, gain, out, samples);
+  }
+}
+
+int SamplePlayer::bandFor(float ratio) {
+  for (int b = 0; b < RESAMPLE_BANDS; b++) {
+    if (ratio <= RESAMPLE_BAND_RATIO[b]) return b;
+  }
+  return RESAMPLE_BANDS - 1;
+}
+
+// ========================================
+// SamplePlayer
+// ========================================
+SamplePlayer::SamplePlayer(const SampleClip& sampleClip) : voiceSteals(0), clip(sampleClip), started(0) {
+  memset(voices, 0, sizeof(voices));
+}
+
+int SamplePlayer::activeVoices() const {
+  int active = 0;
+  for (int v = 0; v < SAMPLE_MAX_VOICES; v++) active += voices[v].active;
+  return active;
+}
+
+void SamplePlayer::startAt(const GrainRequest& grain, int offset) {
+  // 空いている声、なければ一番古い声
+  int target = 0;
+  for (int v = 0; v < SAMPLE_MAX_VOICES; v++) {
+    if (!voices[v].active) {
+      target = v;
+      break;
+    }
+    if (voices[v].age < voices[target].age) target = v;
+  }
+  if (voices[target].active) voiceSteals++;
+
+  float ratio = grain.frequency / clip.pitch;
+  float maxRatio = RESAMPLE_BAND_RATIO[RESAMPLE_BANDS - 1];
+  if (ratio < RESAMPLE_MIN_RATIO) ratio = RESAMPLE_MIN_RATIO;
+  if (ratio > maxRatio) ratio = maxRatio;
+
+  Voice& v = voices[target];
+  v.position = 0;
+  v.step = (uint32_t)(ratio * 65536.0f + 0.5f);
+  v.gain = (int32_t)(grain.amplitude * SAMPLE_VOICE_GAIN * 32767.0f);
+  v.band = bandFor(ratio);
+  v.delay = offset > 0 ? offset : 0;
+  v.age = started++;
+  v.active = true;
+}
+
+void SamplePlayer::render(int16_t* out, int samples) {
+  while (samples > 0) {
+    int block = samples < GRAIN_BLOCK_SAMPLES ? samples : GRAIN_BLOCK_SAMPLES;
+    bool any = false;
+    for (int v = 0; v < SAMPLE_MAX_VOICES; v++) {
+      Voice& voice = voices[v];
+      if (!voice.active) continue;
+      if (voice.delay >= block) {
+        voice.delay -= block;
+        continue;
+      }
+      if (!any) {
+        memset(mix, 0, sizeof(int32_t) * block);
+        any = true;
+      }
+      int from = voice.delay;
+      voice.delay = 0;
+      voice.active = resample(clip, voice.band, voice.position, voice.step, voice.gain, mix + from, block - from);
+    }
+
+    if (any) {
+      for (int i = 0; i < block; i++) {
+        int32_t x = out[i] + mix[i];
+        if (x > 32767) x = 32767;
+        if (x < -32768) x = -32768;
+        out[i] = (int16_t)x;
+      }
+    }
+    out += block;
+    samples -= block;
+  }
+}
@@ -0,0 +1,4476 @@
+// 自動生成ファイル: tools/attract_gen.cpp が出力。手で編集しないこと。
+#pragma once
+
+#include <stdint.h>
+
+const int ATTRACT_WIDTH = 240;
+const int ATTRACT_HEIGHT = 240;
+const int ATTRACT_FPS = 30;
+const int ATTRACT_FRAME_COUNT = 90;
+
+// RGB565（ビッグエンディアンへの変換は再生側で行う）
+const uint16_t ATTRACT_PALETTE[16] = {
+  0x0000, 0x8410, 0x0882, 0x1904, 0x2986, 0x3A09, 0x4A8B, 0x5B0D, 0x6B8F, 0x7C12, 0x8C94, 0x9D16, 0xAD99, 0xBE1B, 0xCE9D, 0xDF1F,
+};
+
+// [0] = 黒からのキーフレーム, [1..N-1] = 前フレームからの差分, [N] = 最終 → 先頭の差分
+const uint32_t ATTRACT_FRAME_OFFSETS[92] = {
+  0, 1508, 1512, 1516, 1576, 1580, 1584, 1588, 1592, 1596,
+  1600, 2481, 2553, 2627, 2731, 2863, 3017, 3221, 3539, 3840,
+  4243, 4678, 5087, 5611, 5991, 6483, 6940, 7474, 7975, 8449,
+  8909, 9320, 9724, 10094, 10409, 10721, 12902, 15032, 17201, 19502,
+  23380, 25657, 27899, 30042, 33840, 36052, 38199, 40251, 44281, 46335,
+  48566, 50512, 54160, 56384, 57961, 59744, 63755, 65341, 66685, 68777,
+  72131, 74147, 75125, 76195, 78189, 79214, 80065, 82005, 83750, 84765,
+  85756, 86719, 87659, 88564, 89476, 90287, 91045, 91774, 92554, 93389,
+  94200, 95043, 95854, 96719, 97634, 98589, 99628, 100782, 102030, 103397,
+  104886, 106677,
+};
+
+const uint8_t ATTRACT_DATA[106677] = {
+  63,192,73,80,1,63,152,1,94,1,63,141,1,74,1,16,74,1,63,133,1,71,1,30,
+  71,1,63,126,70,1,38,70,1,63,120,69,1,46,69,1,63,115,68,1,52,68,1,63,
+  110,68,1,58,68,1,63,105,129,17,0,129,17,62,129,17,0,129,17,63,101,129,17,0,
+  129,17,63,3,129,17,0,129,17,63,98,128,1,0,129,17,63,7,129,17,0,128,1,63,
+  95,67,1,63,11,67,1,63,91,67,1,63,15,67,1,63,88,128,1,0,128,1,63,19,
+  128,1,0,128,1,63,85,67,1,63,21,67,1,63,82,128,1,0,128,1,63,25,128,1,
+  0,128,1,63,80,66,1,63,27,66,1,63,77,66,1,63,31,66,1,63,74,128,1,0,
+  128,1,63,33,128,1,0,128,1,63,72,66,1,63,35,66,1,63,70,129,17,63,39,129,
+  17,63,68,129,17,63,41,129,17,63,65,66,1,63,43,66,1,63,62,128,1,0,128,1,
+  63,45,128,1,0,128,1,63,60,128,1,0,128,1,63,47,128,1,0,128,1,63,58,128,
+  1,0,128,1,63,49,128,1,0,128,1,63,57,129,17,63,51,129,17,63,56,129,17,63,
+  53,129,17,63,54,129,17,63,55,129,17,63,52,129,17,63,57,129,17,63,50,129,17,63,
+  59,129,17,63,48,128,1,0,128,1,63,59,128,1,0,128,1,63,47,129,17,63,61,129,
+  17,63,46,129,17,63,63,129,17,63,44,129,17,63,65,129,17,63,42,128,1,0,128,1,
+  63,65,128,1,0,128,1,63,41,129,17,63,67,129,17,63,40,129,17,63,69,129,17,63,
+  38,128,1,0,128,1,63,69,128,1,0,128,1,63,37,129,17,63,71,129,17,63,36,129,
+  17,63,73,129,17,63,35,129,17,63,73,129,17,63,34,129,17,63,75,129,17,63,32,128,
+  1,0,128,1,63,75,128,1,0,128,1,63,31,129,17,63,77,129,17,63,30,128,1,0,
+  128,1,63,77,128,1,0,128,1,63,29,129,17,63,79,129,17,63,28,128,1,0,128,1,
+  63,79,128,1,0,128,1,63,27,129,17,63,81,129,17,63,27,129,17,63,81,129,17,63,
+  26,129,17,63,83,129,17,63,25,129,17,63,83,129,17,63,24,129,17,63,85,129,17,63,
+  23,129,17,63,85,129,17,63,23,129,17,63,85,129,17,63,22,129,17,63,87,129,17,63,
+  21,129,17,63,87,129,17,63,21,129,17,63,87,129,17,63,20,129,17,63,89,129,17,63,
+  19,129,17,63,89,129,17,63,19,129,17,63,89,129,17,63,19,129,17,63,89,129,17,63,
+  18,129,17,63,91,129,17,63,17,129,17,63,91,129,17,63,17,129,17,63,91,129,17,63,
+  17,129,17,63,91,129,17,63,16,129,17,63,93,129,17,63,15,129,17,63,93,129,17,63,
+  15,129,17,63,93,129,17,63,15,129,17,63,93,129,17,63,15,129,17,63,93,129,17,63,
+  15,129,17,63,93,129,17,63,15,129,17,63,93,129,17,63,14,129,17,63,95,129,17,63,
+  13,129,17,63,95,129,17,63,13,129,17,63,95,129,17,63,13,129,17,63,13,68,4,63,
+  13,129,17,63,13,129,17,63,12,70,4,63,12,129,17,63,13,129,17,63,11,72,4,63,
+  11,129,17,63,13,129,17,63,10,74,4,63,10,129,17,63,13,129,17,63,10,74,4,63,
+  10,129,17,63,13,129,17,63,10,74,4,63,10,129,17,63,13,129,17,63,10,74,4,63,
+  10,129,17,63,13,129,17,63,10,74,4,63,10,129,17,63,13,129,17,63,11,72,4,63,
+  11,129,17,63,13,129,17,63,12,70,4,63,12,129,17,63,13,129,17,63,13,68,4,63,
+  13,129,17,63,13,129,17,63,95,129,17,63,13,129,17,63,95,129,17,63,13,129,17,63,
+  95,129,17,63,14,129,17,63,93,129,17,63,15,129,17,63,93,129,17,63,15,129,17,63,
+  93,129,17,63,15,129,17,63,93,129,17,63,15,129,17,63,93,129,17,63,15,129,17,63,
+  93,129,17,63,15,129,17,63,93,129,17,63,16,129,17,63,91,129,17,63,17,129,17,63,
+  91,129,17,63,17,129,17,63,91,129,17,63,17,129,17,63,91,129,17,63,18,129,17,63,
+  89,129,17,63,19,129,17,63,89,129,17,63,19,129,17,63,89,129,17,63,19,129,17,63,
+  89,129,17,63,20,129,17,63,87,129,17,63,21,129,17,63,87,129,17,63,21,129,17,63,
+  87,129,17,63,22,129,17,63,85,129,17,63,23,129,17,63,85,129,17,63,23,129,17,63,
+  85,129,17,63,24,129,17,63,83,129,17,63,25,129,17,63,83,129,17,63,26,129,17,63,
+  81,129,17,63,27,129,17,63,81,129,17,63,27,128,1,0,128,1,63,79,128,1,0,128,
+  1,63,28,129,17,63,79,129,17,63,29,128,1,0,128,1,63,77,128,1,0,128,1,63,
+  30,129,17,63,77,129,17,63,31,128,1,0,128,1,63,75,128,1,0,128,1,63,32,129,
+  17,63,75,129,17,63,34,129,17,63,73,129,17,63,35,129,17,63,73,129,17,63,36,129,
+  17,63,71,129,17,63,37,128,1,0,128,1,63,69,128,1,0,128,1,63,38,129,17,63,
+  69,129,17,63,40,129,17,63,67,129,17,63,41,128,1,0,128,1,63,65,128,1,0,128,
+  1,63,42,129,17,63,65,129,17,63,44,129,17,63,63,129,17,63,46,129,17,63,61,129,
+  17,63,47,128,1,0,128,1,63,59,128,1,0,128,1,63,48,129,17,63,59,129,17,63,
+  50,129,17,63,57,129,17,63,52,129,17,63,55,129,17,63,54,129,17,63,53,129,17,63,
+  56,129,17,63,51,129,17,63,57,128,1,0,128,1,63,49,128,1,0,128,1,63,58,128,
+  1,0,128,1,63,47,128,1,0,128,1,63,60,128,1,0,128,1,63,45,128,1,0,128,
+  1,63,62,66,1,63,43,66,1,63,65,129,17,63,41,129,17,63,68,129,17,63,39,129,
+  17,63,70,66,1,63,35,66,1,63,72,128,1,0,128,1,63,33,128,1,0,128,1,63,
+  74,66,1,63,31,66,1,63,77,66,1,63,27,66,1,63,80,128,1,0,128,1,63,25,
+  128,1,0,128,1,63,82,67,1,63,21,67,1,63,85,128,1,0,128,1,63,19,128,1,
+  0,128,1,63,88,67,1,63,15,67,1,63,91,67,1,63,11,67,1,63,95,128,1,0,
+  129,17,63,7,129,17,0,128,1,63,98,129,17,0,129,17,63,3,129,17,0,129,17,63,
+  101,129,17,0,129,17,62,129,17,0,129,17,63,105,68,1,58,68,1,63,110,68,1,52,
+  68,1,63,115,69,1,46,69,1,63,120,70,1,38,70,1,63,126,71,1,30,71,1,63,
+  133,1,74,1,16,74,1,63,141,1,94,1,63,152,1,80,1,63,207,71,63,192,193,3,
+  63,192,193,3,63,134,216,1,68,5,63,170,1,70,5,63,168,1,72,5,63,166,1,74,
+  5,63,165,1,74,5,63,165,1,74,5,63,165,1,74,5,63,165,1,74,5,63,166,1,
+  72,5,63,168,1,70,5,63,170,1,68,5,63,149,214,1,63,192,193,3,63,192,193,3,
+  63,192,193,3,63,192,193,3,63,192,193,3,63,192,193,3,63,192,73,127,176,1,0,16,
+  127,152,1,0,30,127,141,1,0,38,127,133,1,0,46,127,126,0,52,127,120,0,58,127,
+  115,0,62,127,111,0,63,4,127,106,0,63,8,127,102,0,63,12,127,98,0,63,15,127,
+  95,0,63,19,127,92,0,63,22,127,88,0,63,25,127,86,0,63,28,127,82,0,63,31,
+  127,80,0,63,33,127,78,0,63,36,127,74,0,63,39,127,72,0,63,41,127,70,0,63,
+  43,127,68,0,63,45,127,66,0,63,48,127,63,0,63,50,127,61,0,63,52,127,59,0,
+  63,53,127,58,0,63,55,127,56,0,63,57,127,54,0,63,59,127,52,0,63,61,127,51,
+  0,63,62,127,49,0,63,63,127,48,0,63,65,127,46,0,63,67,127,45,0,63,68,127,
+  43,0,63,69,127,42,0,63,71,127,41,0,63,72,127,39,0,63,73,127,38,0,63,75,
+  127,37,0,63,75,127,36,0,63,77,127,35,0,63,78,127,33,0,63,79,127,33,0,63,
+  80,127,31,0,63,81,127,31,0,63,82,127,29,0,63,83,127,29,0,63,83,127,28,0,
+  63,85,127,27,0,63,85,127,26,0,63,87,127,25,0,63,87,127,25,0,63,87,127,24,
+  0,63,89,127,23,0,63,89,127,23,0,63,89,127,22,0,63,91,127,21,0,63,91,127,
+  21,0,63,91,127,21,0,63,91,127,20,0,63,93,127,19,0,63,93,127,19,0,63,93,
+  127,19,0,63,93,127,18,0,63,95,127,17,0,63,95,127,17,0,63,95,127,17,0,63,
+  19,68,15,63,7,127,17,0,63,18,70,15,63,6,127,17,0,63,17,72,15,63,5,127,
+  17,0,63,17,72,15,63,5,127,16,0,63,18,72,15,63,6,127,15,0,63,18,72,15,
+  63,6,127,15,0,63,18,72,15,63,6,127,15,0,63,14,68,0,70,15,63,7,127,15,
+  0,63,13,70,0,68,15,63,8,127,15,0,63,12,127,20,0,0,127,15,0,63,11,127,
+  21,0,0,127,15,0,63,11,127,21,0,0,127,15,0,63,11,127,21,0,0,127,15,0,
+  63,11,127,21,0,0,127,15,0,63,11,127,21,0,0,127,15,0,63,12,127,20,0,0,
+  127,15,0,63,13,127,19,0,0,127,15,0,63,14,127,18,0,0,127,15,0,63,97,127,
+  15,0,63,97,127,15,0,63,97,127,16,0,63,95,127,17,0,63,95,127,17,0,63,95,
+  127,17,0,63,95,127,17,0,63,95,127,17,0,63,95,127,17,0,63,95,127,18,0,63,
+  93,127,19,0,63,93,127,19,0,63,93,127,19,0,63,93,127,20,0,63,91,127,21,0,
+  63,91,127,21,0,63,91,127,21,0,63,91,127,22,0,63,89,127,23,0,63,89,127,23,
+  0,63,89,127,24,0,63,87,127,25,0,63,87,127,25,0,63,87,127,26,0,63,85,127,
+  27,0,63,85,127,28,0,63,83,127,29,0,63,83,127,30,0,63,82,127,30,0,63,81,
+  127,32,0,63,80,127,32,0,63,79,127,34,0,63,78,127,34,0,63,77,127,36,0,63,
+  75,127,37,0,63,75,127,38,0,63,73,127,40,0,63,72,127,40,0,63,71,127,42,0,
+  63,69,127,44,0,63,68,127,44,0,63,67,127,46,0,63,65,127,48,0,63,63,127,50,
+  0,63,62,127,50,0,63,61,127,52,0,63,59,127,54,0,63,57,127,56,0,63,55,127,
+  58,0,63,53,127,60,0,63,52,127,61,0,63,50,127,63,0,63,48,127,65,0,63,45,
+  127,68,0,63,43,127,70,0,63,41,127,72,0,63,39,127,75,0,63,36,127,77,0,63,
+  33,127,80,0,63,31,127,83,0,63,28,127,85,0,63,25,127,89,0,63,22,127,91,0,
+  63,19,127,95,0,63,15,127,99,0,63,12,127,102,0,63,8,127,106,0,63,4,127,110,
+  0,62,127,115,0,58,127,120,0,52,127,126,0,46,127,133,1,0,38,127,141,1,0,30,
+  127,152,1,0,16,127,191,73,0,63,252,202,1,127,11,0,63,100,129,0,2,127,7,0,
+  63,99,129,0,4,127,6,0,63,99,128,0,6,127,5,0,63,99,128,0,6,127,6,0,
+  63,98,128,0,6,127,6,0,63,98,129,0,4,127,7,0,63,99,129,0,2,127,8,0,
+  63,100,127,12,0,63,184,230,1,63,139,201,1,128,13,63,176,1,128,13,63,175,1,128,
+  13,127,10,0,63,101,128,0,2,129,208,63,169,1,128,0,4,127,6,0,63,100,128,13,
+  4,127,7,0,63,99,128,13,4,127,7,0,63,100,128,0,2,127,8,0,63,101,129,208,
+  127,9,0,63,102,128,13,63,129,231,1,63,186,195,1,128,13,63,175,1,128,13,63,176,
+  1,128,13,63,169,3,128,13,63,173,1,129,221,63,168,1,128,13,66,0,0,128,13,63,
+  169,1,132,208,208,13,63,167,1,71,13,127,8,0,63,100,66,13,127,9,0,63,96,66,
+  13,1,129,221,127,9,0,63,94,129,221,3,128,13,63,161,3,128,13,63,175,1,128,13,
+  63,175,1,128,13,63,175,1,128,13,63,175,1,128,13,63,209,221,1,63,232,189,1,128,
+  13,63,176,1,128,13,63,175,1,128,13,63,159,5,129,221,63,172,1,129,221,63,173,1,
+  128,13,63,167,1,128,13,63,175,1,128,13,63,175,1,66,13,63,163,1,78,13,63,170,
+  1,128,0,1,129,221,63,147,3,66,13,3,129,208,63,165,1,129,221,6,128,13,63,164,
+  1,129,221,8,128,13,63,174,1,128,13,63,175,1,128,13,63,174,1,128,13,63,175,1,
+  128,13,63,179,1,128,13,63,175,1,128,13,63,175,1,128,13,63,175,1,128,13,63,175,
+  1,128,13,63,161,212,1,63,151,184,1,128,13,63,175,1,128,13,63,176,1,128,13,63,
+  148,7,129,221,63,172,1,129,221,63,161,1,128,13,63,175,1,128,13,63,175,1,128,13,
+  63,171,1,128,13,63,176,1,68,13,63,145,3,80,13,127,6,0,63,103,70,13,63,170,
+  1,128,13,1,129,221,63,160,1,128,0,9,128,13,63,164,1,128,13,10,128,13,63,158,
+  1,66,13,63,171,1,129,221,63,172,1,129,221,63,155,5,128,13,63,175,1,128,13,63,
+  174,1,128,13,63,175,1,128,13,63,174,1,128,13,63,175,1,128,13,5,128,13,63,175,
+  1,128,13,63,175,1,128,13,63,175,1,128,13,63,225,204,1,63,197,178,1,128,13,63,
+  176,1,128,13,63,175,1,128,13,63,138,9,129,221,63,155,1,128,13,15,129,221,63,157,
+  1,128,13,63,175,1,128,13,2,128,13,63,163,1,128,13,9,128,13,63,165,1,129,221,
+  7,128,13,63,167,1,128,13,5,128,13,63,175,1,128,13,63,253,4,84,13,63,179,1,
+  66,13,63,172,1,128,13,63,176,1,129,221,63,154,3,128,13,63,176,1,128,13,63,151,
+  1,66,13,21,128,13,63,148,1,129,221,14,129,208,7,128,13,63,146,1,129,221,27,128,
+  13,63,163,1,129,208,10,128,13,63,145,3,129,208,63,157,3,129,208,63,174,1,129,208,
+  63,174,1,128,13,63,175,1,128,13,63,174,1,128,13,63,175,1,128,13,6,128,13,63,
+  166,1,128,13,7,128,13,63,166,1,128,13,7,128,13,63,175,1,128,13,63,175,1,128,
+  13,63,177,195,1,63,225,159,1,128,13,63,175,1,128,13,63,226,10,128,13,63,175,1,
+  128,13,63,176,1,128,13,63,232,10,128,13,6,128,13,14,129,221,63,150,1,128,13,5,
+  128,13,13,129,221,63,152,1,128,13,5,128,13,10,128,0,0,128,13,63,143,1,128,13,
+  15,128,13,9,128,0,0,128,13,63,146,1,128,13,13,128,13,8,128,0,0,128,13,63,
+  149,1,129,221,10,129,208,6,128,0,0,128,13,63,152,1,129,208,8,129,208,5,128,0,
+  0,128,13,63,155,1,128,0,14,128,0,0,128,13,63,166,1,129,208,2,128,0,0,128,
+  13,63,171,1,128,0,0,128,13,63,171,1,128,0,0,128,13,63,173,1,128,13,63,153,
+  1,86,13,127,6,0,63,112,127,0,0,63,112,67,13,63,172,1,128,13,63,176,1,129,
+  221,63,149,1,128,0,63,175,1,128,13,63,194,1,128,13,127,4,0,63,98,128,13,66,
+  0,63,152,1,66,13,63,171,1,129,221,63,172,1,129,221,33,128,13,63,176,1,128,13,
+  63,176,1,128,13,63,176,1,128,13,63,157,1,128,13,69,0,10,128,13,63,176,1,128,
+  13,63,155,1,128,13,70,0,63,230,8,128,13,63,175,1,128,13,63,174,1,128,13,9,
+  128,13,63,164,1,128,13,9,128,13,63,163,1,128,13,10,128,13,63,163,1,128,13,10,
+  128,13,63,175,1,128,13,63,129,186,1,63,144,154,1,128,13,63,175,1,128,13,63,175,
+  1,128,13,63,241,8,128,13,63,176,1,128,13,63,175,1,128,13,63,149,7,128,13,23,
+  66,13,63,147,1,128,13,63,165,1,128,13,8,128,13,63,165,1,128,13,7,128,13,17,
+  129,221,63,146,1,128,13,6,128,13,16,129,221,63,134,1,128,13,63,176,1,128,13,63,
+  176,1,128,13,16,128,13,76,0,63,146,1,128,13,63,175,1,129,208,63,175,1,128,0,
+  63,133,7,128,13,63,175,1,128,0,63,143,3,72,0,63,160,1,128,13,2,75,13,19,
+  129,221,63,136,1,129,221,35,129,0,1,66,13,63,156,3,128,13,63,176,1,129,221,63,
+  252,4,129,208,63,245,4,66,13,63,171,1,129,221,63,172,1,129,221,63,184,3,129,208,
+  63,249,2,129,221,33,129,208,18,128,13,63,118,128,13,56,128,13,63,175,1,128,13,63,
+  152,1,129,208,21,128,13,63,176,1,128,13,63,149,1,129,208,63,157,3,129,208,63,157,
+  3,129,208,63,174,1,129,208,63,174,1,128,13,63,175,1,128,13,10,128,13,63,162,1,
+  128,13,11,128,13,63,162,1,128,13,11,128,13,63,161,1,128,13,12,128,13,63,161,1,
+  128,13,12,128,13,63,207,12,128,13,63,176,1,128,13,63,175,1,128,13,63,224,159,1,
+  63,176,150,1,128,13,63,175,1,128,13,63,143,5,129,208,63,143,5,128,13,63,176,1,
+  128,13,63,186,3,128,13,63,174,1,128,13,63,175,1,128,13,63,174,1,128,13,63,162,
+  1,128,13,10,128,13,63,163,1,128,13,9,129,208,25,129,221,63,135,1,128,13,8,129,
+  208,19,129,221,63,172,1,129,221,63,126,128,13,25,129,208,63,148,1,128,13,23,129,208,
+  63,150,1,129,221,71,0,63,168,1,128,13,70,0,12,129,208,63,154,1,128,13,70,0,
+  10,129,208,63,156,1,128,13,0,68,0,63,171,1,128,13,68,0,63,171,1,128,13,67,
+  0,63,172,1,128,13,67,0,63,172,1,128,13,63,163,3,128,0,63,175,1,68,13,63,
+  146,3,79,13,63,145,1,78,13,72,0,12,127,0,0,63,73,128,13,0,84,0,15,69,
+  13,121,0,63,71,129,221,44,67,13,63,182,1,128,13,63,165,1,128,13,63,176,1,129,
+  221,63,138,1,128,0,63,175,1,128,13,63,218,1,129,221,63,142,3,129,208,63,244,2,
+  66,13,63,171,1,129,221,63,172,1,129,221,28,128,13,69,0,10,129,208,63,213,4,66,
+  13,63,174,1,128,13,57,129,208,63,151,1,128,13,71,0,14,129,208,63,133,3,128,13,
+  72,0,16,128,13,63,176,1,128,13,63,176,1,128,13,63,175,1,128,13,63,176,1,128,
+  13,63,143,1,128,13,74,0,20,128,13,63,253,2,128,13,75,0,63,146,3,128,13,76,
+  0,63,129,5,128,13,13,128,13,63,160,1,128,13,13,128,13,63,159,1,128,13,14,128,
+  13,63,159,1,128,13,14,128,13,63,158,1,128,13,63,175,1,128,13,63,146,7,128,13,
+  63,175,1,128,13,63,200,10,128,13,63,174,1,129,221,63,134,143,1,63,224,144,1,128,
+  13,63,175,1,128,13,63,175,1,128,13,63,144,5,128,13,63,174,1,129,208,12,128,13,
+  63,174,1,129,221,63,174,1,128,13,16,128,13,63,157,1,128,13,15,128,13,63,175,1,
+  128,13,63,129,1,128,13,43,128,13,63,174,1,128,13,63,144,3,128,13,63,175,1,128,
+  13,11,128,13,118,0,63,107,128,13,63,138,3,128,13,30,128,13,86,0,67,13,94,0,
+  63,86,128,13,50,128,0,0,128,13,3,67,13,63,114,129,221,46,128,0,0,128,13,63,
+  125,129,208,24,128,13,82,0,0,128,13,63,128,1,129,208,40,128,0,0,128,13,63,131,
+  1,128,0,38,128,0,0,128,13,63,136,1,128,13,18,128,13,78,0,0,128,13,63,138,
+  1,129,208,30,128,0,0,128,13,63,141,1,128,0,30,128,13,63,244,4,128,13,63,175,
+  1,128,0,63,240,10,128,13,63,175,1,128,0,4,66,13,63,167,1,72,0,0,66,13,
+  4,129,221,63,113,129,221,40,66,13,76,0,0,128,13,63,161,1,66,13,74,0,129,221,
+  63,163,1,66,13,63,176,1,129,221,63,181,1,129,221,63,206,8,129,208,63,253,2,66,
+  13,28,129,208,63,140,1,129,221,50,129,208,63,120,128,13,63,170,1,67,13,63,173,1,
+  128,13,63,174,1,128,13,36,129,208,63,157,3,129,208,63,171,5,129,208,63,255,2,129,
+  208,63,208,1,128,13,63,140,1,129,208,33,128,13,63,175,1,128,13,63,138,1,129,208,
+  35,128,13,63,176,1,128,13,63,247,2,129,208,63,157,3,129,208,63,157,3,129,208,14,
+  128,13,63,158,1,129,208,14,128,13,63,158,1,128,13,63,175,1,128,13,63,174,1,128,
+  13,63,175,1,128,13,63,174,1,128,13,19,129,208,63,153,1,128,13,20,128,13,63,176,
+  1,128,13,63,197,10,128,13,63,174,1,129,221,63,174,1,128,13,63,184,137,1,63,156,
+  128,1,128,13,63,174,1,128,13,63,196,8,128,13,63,175,1,128,13,63,175,1,128,13,
+  63,174,1,128,13,63,175,1,128,13,63,175,1,128,13,63,191,1,128,13,19,128,13,63,
+  140,1,128,13,12,128,13,18,128,13,63,155,1,128,13,18,128,13,63,140,1,128,13,32,
+  128,13,63,174,1,128,13,63,174,1,129,208,63,125,128,13,46,129,208,63,126,129,221,63,
+  205,1,128,13,14,129,208,63,158,1,128,13,13,129,208,63,159,1,128,13,63,134,3,128,
+  13,36,129,208,63,137,1,128,13,63,176,1,129,221,63,208,1,129,208,25,129,221,63,174,
+  1,129,0,1,66,13,63,112,73,0,63,166,1,128,13,25,129,208,63,248,4,70,0,12,
+  129,208,63,154,1,128,13,63,177,3,129,208,63,179,16,127,0,0,63,112,70,13,76,0,
+  129,221,63,112,66,13,38,128,13,5,69,13,63,119,128,13,0,84,0,20,128,0,11,68,
+  13,63,112,129,221,63,239,1,129,221,63,166,1,128,13,5,129,221,63,168,1,129,221,63,
+  128,5,128,13,127,1,0,63,193,6,128,13,125,0,63,114,128,13,124,0,63,149,4,129,
+  221,0,128,0,63,174,1,129,208,59,128,13,120,0,63,56,128,13,63,174,1,128,13,63,
+  225,3,128,13,116,0,63,123,128,13,115,0,63,221,4,128,13,112,0,63,127,128,13,111,
+  0,63,187,4,129,208,35,128,13,108,0,63,131,1,128,13,63,176,1,128,13,63,176,1,
+  128,13,63,175,1,128,13,63,176,1,128,13,63,176,1,128,13,63,175,10,129,208,63,158,
+  3,128,13,53,128,13,63,119,128,13,22,128,13,31,128,13,63,118,128,13,23,128,13,63,
+  149,1,128,13,63,236,8,128,13,63,175,1,129,221,63,173,1,128,13,63,218,133,1,63,
+  205,122,128,13,63,175,1,128,13,63,174,1,128,13,63,194,8,128,13,63,175,1,128,13,
+  63,175,1,128,13,127,9,0,63,102,128,13,102,0,128,13,63,135,1,128,13,37,128,13,
+  63,153,1,128,13,20,128,13,63,136,1,128,0,15,128,13,19,128,13,63,137,1,128,0,
+  15,128,13,18,128,13,63,252,2,77,0,63,162,1,77,0,18,128,13,106,0,63,80,128,
+  13,63,176,1,128,13,30,81,0,63,125,129,221,47,128,13,110,0,63,80,128,13,63,174,
+  1,128,0,29,128,13,63,191,1,128,13,113,0,63,81,128,13,63,176,1,128,13,63,176,
+  1,129,221,63,175,1,129,208,63,175,1,129,208,63,175,1,128,0,63,209,1,128,13,86,
+  0,5,128,13,63,115,128,13,58,128,0,3,129,221,63,109,129,208,63,175,1,128,0,25,
+  128,13,82,0,63,245,2,128,13,63,175,1,129,208,18,128,13,78,0,63,140,1,128,0,
+  63,177,3,128,13,73,0,63,152,1,128,13,63,175,1,128,0,63,188,12,128,0,57,129,
+  221,63,113,128,0,0,128,13,29,66,13,66,0,63,134,1,129,0,0,128,13,34,66,13,
+  70,0,63,125,131,0,221,39,128,13,0,74,0,63,117,131,0,221,43,66,13,75,0,63,
+  113,129,221,48,66,13,74,0,63,109,129,221,40,129,208,10,128,13,0,73,0,66,13,63,
+  163,1,66,13,66,0,1,129,221,63,169,1,66,13,63,142,3,129,208,63,129,7,129,208,
+  63,175,1,129,208,63,227,2,128,0,63,175,1,128,13,63,171,1,129,221,1,128,13,60,
+  129,208,63,111,128,13,101,0,24,129,208,63,109,128,13,102,0,63,135,1,128,13,63,243,
+  1,129,208,63,175,1,129,208,63,175,1,129,208,63,159,3,129,208,63,175,1,129,208,63,
+  175,1,129,208,63,175,1,129,208,63,174,1,129,208,63,175,1,129,208,63,175,1,129,208,
+  63,175,1,129,208,63,174,1,129,208,63,175,1,129,208,63,175,1,129,208,63,176,1,128,
+  13,63,176,1,128,13,63,175,1,128,13,63,176,1,128,13,63,176,1,128,13,63,143,1,
+  128,13,125,0,63,245,4,128,13,63,176,1,128,13,63,141,1,128,13,63,176,1,128,13,
+  63,193,10,128,13,63,174,1,129,221,63,173,1,128,13,63,251,129,1,63,255,116,128,13,
+  63,174,1,129,221,63,126,129,221,45,128,13,63,175,1,128,13,63,207,6,129,221,63,174,
+  1,129,221,42,128,13,63,131,1,128,13,41,128,13,63,175,1,128,13,63,174,1,128,13,
+  63,134,1,128,13,14,128,13,22,128,13,63,135,1,128,13,14,128,13,21,129,208,63,151,
+  1,128,13,20,129,208,63,135,1,128,0,63,191,1,128,13,84,0,63,154,1,128,13,84,
+  0,128,13,63,231,2,128,13,63,176,1,128,13,17,128,13,31,129,208,63,140,1,128,0,
+  63,155,1,128,13,63,176,1,129,13,48,129,208,63,124,66,13,63,205,3,129,208,63,244,
+  2,128,13,63,175,1,128,0,38,129,208,63,220,6,128,13,29,129,208,28,128,13,63,113,
+  128,0,60,128,0,4,129,221,63,247,2,129,208,63,140,5,129,208,63,140,5,129,208,63,
+  219,14,129,221,63,221,10,129,221,63,146,1,128,13,75,0,10,67,13,63,103,129,221,63,
+  3,67,0,128,13,63,207,17,67,13,63,168,1,67,13,128,0,63,169,1,129,221,68,0,
+  63,174,1,129,208,61,128,13,119,0,63,54,129,208,63,173,1,129,208,63,174,1,128,13,
+  63,174,1,128,13,63,246,1,128,13,114,0,63,207,6,128,13,110,0,63,129,1,128,13,
+  109,0,63,212,6,128,13,104,0,63,202,8,128,13,98,0,63,223,6,128,13,63,176,1,
+  128,13,63,148,5,128,13,63,176,1,128,13,63,252,2,128,13,63,176,1,128,13,63,129,
+  3,129,208,63,157,3,129,208,63,174,1,129,208,63,174,1,128,13,63,172,1,128,13,1,
+  128,13,63,172,1,128,13,63,174,1,128,13,63,173,124,63,176,111,128,13,63,175,1,128,
+  13,63,174,1,128,13,0,128,13,63,174,1,128,13,63,125,128,13,47,129,208,63,125,128,
+  0,47,128,13,63,221,4,128,13,0,128,13,44,128,13,63,127,128,13,0,128,13,63,173,
+  1,66,13,63,218,1,128,13,90,0,63,104,128,13,17,128,13,63,156,1,130,13,13,15,
+  128,13,22,128,13,93,0,63,102,130,13,13,15,128,13,21,128,13,95,0,63,254,2,128,
+  13,97,0,63,140,1,128,13,99,0,63,100,128,13,63,155,1,128,13,18,128,13,15,128,
+  13,63,139,1,128,13,54,128,13,103,0,63,79,128,13,63,158,3,128,13,0,128,13,81,
+  0,33,128,13,106,0,63,78,128,13,18,128,13,12,128,13,63,141,1,129,208,63,175,1,
+  129,208,48,128,13,110,0,63,78,128,0,63,207,3,128,13,113,0,63,219,4,128,13,117,
+  0,63,120,128,13,118,0,63,214,4,128,13,86,0,4,93,0,63,146,1,71,13,85,0,
+  63,154,1,67,13,2,129,221,63,128,1,128,13,82,0,63,250,4,128,13,78,0,63,254,
+  4,128,13,73,0,63,228,12,129,221,63,223,2,78,13,63,159,1,128,13,0,84,0,63,
+  151,1,128,13,0,84,0,63,151,1,128,13,0,83,0,63,152,1,128,13,0,83,0,63,
+  152,1,128,13,0,82,0,48,129,0,66,13,63,99,128,13,0,82,0,46,129,0,1,129,
+  221,63,100,128,13,0,81,0,46,128,0,1,129,221,2,128,13,63,98,129,221,63,3,128,
+  13,7,128,13,63,205,2,129,221,63,174,1,128,13,63,203,12,128,0,63,175,1,128,13,
+  63,171,1,129,221,63,171,1,128,13,7,128,13,63,165,1,128,13,7,128,13,102,0,63,
+  135,1,128,13,103,0,63,134,1,128,13,103,0,63,134,1,128,13,63,139,5,129,221,63,
+  234,31,128,13,95,0,63,164,3,86,0,63,153,1,128,13,63,177,1,128,13,63,236,4,
+  128,13,63,144,1,129,208,29,128,13,63,239,4,128,13,127,16,0,63,129,1,128,13,63,
+  176,1,128,13,63,139,1,128,13,63,175,1,128,13,63,172,1,128,13,63,174,1,128,13,
+  63,206,120,63,226,105,128,13,63,174,1,128,13,63,175,1,129,221,63,174,1,128,13,63,
+  175,1,128,13,63,174,1,128,13,76,0,63,112,128,13,48,78,0,63,160,1,128,13,79,
+  0,63,159,1,81,0,63,107,128,13,1,128,13,63,172,1,128,13,1,128,13,63,221,1,
+  86,0,63,125,128,13,63,155,1,128,0,18,128,13,63,157,1,129,208,15,128,13,63,157,
+  1,129,208,63,191,1,128,13,87,0,63,133,1,129,208,15,128,13,86,0,63,210,4,128,
+  13,63,176,1,128,13,34,128,13,63,176,1,84,0,63,212,4,128,13,22,128,13,63,152,
+  1,129,13,33,128,13,63,140,1,129,13,63,175,1,128,13,63,217,20,128,13,63,175,1,
+  128,0,6,129,221,63,174,1,129,0,1,67,13,78,0,63,161,1,129,221,63,130,20,129,
+  221,63,150,3,131,0,221,63,170,1,131,0,221,63,170,1,128,0,0,129,221,63,172,1,
+  128,13,63,171,3,129,221,63,168,1,129,221,63,170,1,67,13,63,168,1,67,13,103,0,
+  63,128,1,67,13,66,0,63,169,1,72,0,0,128,13,63,94,129,221,63,171,1,66,13,
+  63,21,128,13,63,175,1,128,13,63,87,128,13,63,174,1,128,13,63,128,7,68,13,63,
+  168,1,66,13,66,0,63,166,1,67,13,68,0,63,165,1,129,221,71,0,63,174,1,128,
+  0,63,174,1,129,208,63,164,1,128,13,7,129,208,63,173,1,129,208,63,173,1,129,208,
+  63,174,1,128,13,63,174,1,128,13,63,154,3,129,221,63,221,33,128,13,97,0,63,254,
+  2,128,13,99,0,0,128,13,63,176,1,128,13,63,137,1,128,13,117,0,63,203,2,128,
+  13,0,92,0,128,13,114,0,63,125,128,13,63,175,1,128,13,63,176,1,128,13,63,146,
+  5,128,13,63,246,2,129,13,0,128,13,63,175,1,128,13,63,171,1,128,13,63,175,1,
+  128,13,63,174,1,128,13,2,128,13,63,174,1,128,13,63,137,5,128,13,63,175,1,128,
+  13,63,211,105,63,148,100,128,13,63,174,1,128,13,63,175,1,129,221,63,174,1,128,13,
+  63,173,1,130,208,13,63,142,1,128,13,63,175,1,128,13,28,128,0,63,124,128,13,19,
+  128,13,63,154,1,128,13,48,128,0,63,176,1,128,13,63,123,128,13,63,175,1,128,13,
+  63,175,1,129,208,19,128,13,63,153,1,129,208,19,128,13,63,131,1,128,13,42,128,13,
+  63,253,6,128,13,63,176,1,128,13,63,135,1,128,13,63,176,1,128,13,63,175,1,128,
+  13,35,128,13,63,132,1,128,13,4,129,208,34,128,13,63,251,2,129,208,34,128,13,63,
+  135,1,128,13,63,176,1,128,13,1,129,208,63,171,1,129,208,34,128,13,63,139,1,129,
+  208,0,129,208,63,172,1,129,208,63,175,1,128,0,63,211,22,128,13,63,175,1,128,0,
+  4,128,13,63,175,1,128,0,0,128,13,63,131,20,129,221,63,169,1,129,221,63,173,1,
+  128,13,63,220,2,128,0,63,173,1,128,0,0,128,13,63,171,1,128,0,0,128,13,63,
+  9,129,221,63,96,128,0,0,128,13,63,12,129,221,63,93,128,0,0,128,13,63,6,128,
+  0,0,129,221,63,97,128,0,0,128,13,63,4,128,0,2,128,13,63,98,128,0,0,128,
+  13,63,2,128,0,2,128,13,63,100,128,0,0,128,13,63,0,128,0,2,128,13,63,102,
+  128,0,0,128,13,63,2,128,13,63,104,128,0,0,128,13,63,15,129,221,63,88,68,13,
+  63,132,2,129,208,63,175,1,128,13,63,196,2,128,13,63,145,5,128,0,63,172,1,128,
+  0,1,128,13,63,168,1,129,0,1,128,13,63,169,1,128,0,0,129,221,63,172,1,128,
+  13,63,172,1,128,13,8,128,13,63,164,1,128,13,72,0,128,13,103,0,63,134,1,128,
+  13,103,0,63,134,1,128,13,104,0,63,133,1,128,13,105,0,63,132,1,128,13,105,0,
+  63,130,1,66,13,63,170,1,66,13,108,0,63,213,33,128,13,63,175,1,128,0,63,140,
+  1,129,208,63,214,1,128,13,63,136,1,129,208,37,128,13,63,217,2,128,0,29,129,208,
+  63,159,3,129,208,63,237,4,128,13,98,0,63,162,3,128,13,63,133,1,129,208,63,160,
+  3,128,13,63,175,1,128,13,63,155,3,128,13,63,174,1,128,13,1,129,221,63,174,1,
+  128,13,63,138,5,128,13,63,227,103,63,168,83,128,13,63,144,5,128,13,63,139,5,128,
+  13,63,174,1,128,13,63,175,1,128,13,63,174,1,129,29,0,128,13,63,174,1,128,13,
+  63,172,1,131,13,208,63,139,1,128,13,32,129,208,63,140,1,128,13,30,129,13,63,142,
+  1,128,13,94,0,0,129,208,63,121,128,13,49,130,13,13,63,234,2,129,208,47,130,13,
+  13,63,121,128,13,21,128,13,63,152,1,128,13,66,0,128,13,17,128,13,63,175,1,128,
+  13,63,153,1,129,13,63,151,1,128,13,21,129,13,18,128,13,90,0,63,148,1,128,13,
+  89,0,63,246,4,128,13,63,132,1,128,13,39,128,0,63,135,1,128,13,63,175,1,128,
+  13,85,0,63,148,1,128,13,4,128,13,84,0,63,148,1,128,13,4,128,13,84,0,15,
+  128,0,63,138,1,128,13,83,0,15,128,0,63,175,1,128,0,63,134,1,128,13,3,128,
+  13,82,0,16,84,0,63,114,128,13,67,0,63,172,1,128,13,66,0,128,13,82,0,63,
+  153,1,128,13,66,0,32,128,0,63,139,1,129,13,0,128,13,81,0,13,128,0,63,140,
+  1,128,13,33,128,0,63,138,28,128,13,63,255,19,70,13,63,129,5,66,13,63,173,1,
+  102,0,63,149,1,129,221,63,153,3,68,13,90,0,63,140,1,67,13,4,66,13,63,160,
+  1,67,13,99,0,63,132,1,67,13,103,0,63,128,1,67,13,66,0,63,169,1,72,0,
+  63,203,2,69,13,63,19,128,13,63,176,1,128,13,63,177,1,128,13,63,174,1,128,13,
+  63,84,129,208,63,174,1,128,13,63,174,1,128,13,63,214,10,128,0,63,175,1,128,13,
+  63,173,1,128,13,63,131,7,128,0,63,175,1,128,13,63,169,1,66,13,63,149,32,86,
+  0,63,153,1,128,13,63,164,3,79,0,63,160,1,128,13,63,177,1,128,13,63,104,128,
+  13,63,249,1,66,13,63,174,1,128,13,63,98,129,13,63,159,3,129,208,63,171,1,129,
+  13,63,157,3,129,13,40,128,13,63,246,2,129,208,63,170,1,128,13,66,0,63,155,3,
+  129,13,0,128,13,63,171,1,129,13,0,129,13,63,171,1,128,13,63,179,1,128,13,63,
+  138,5,128,13,63,243,101,63,217,77,128,13,63,175,1,128,13,63,174,1,128,13,63,177,
+  1,128,13,63,175,1,128,13,63,174,1,66,13,63,155,3,128,13,63,174,1,128,13,63,
+  174,1,130,208,13,63,172,1,130,208,13,63,173,1,130,208,13,63,172,1,130,209,13,127,
+  85,0,53,128,13,32,130,208,1,63,139,1,128,13,31,131,208,13,63,173,1,128,13,67,
+  0,63,169,1,129,208,63,121,128,13,19,129,208,30,128,13,70,0,63,114,128,13,84,0,
+  29,129,208,73,0,63,110,128,13,63,175,1,128,13,1,128,13,83,0,128,13,27,129,208,
+  76,0,63,162,1,78,0,63,111,128,13,82,0,63,131,1,128,13,42,128,13,91,0,63,
+  103,128,13,42,128,13,90,0,63,104,129,208,21,128,13,63,196,1,128,13,63,131,1,128,
+  13,42,128,13,0,128,13,63,130,1,128,13,42,128,13,63,131,1,128,13,39,66,13,63,
+  132,1,129,208,38,66,13,63,238,2,128,13,0,128,13,3,129,208,63,168,1,128,13,63,
+  177,1,128,13,3,129,208,63,170,1,128,13,63,176,1,128,13,39,128,13,85,0,63,112,
+  129,208,63,175,1,129,208,63,175,1,129,208,1,129,208,63,171,1,129,208,63,175,1,129,
+  208,0,129,208,63,172,1,128,0,33,128,13,82,0,63,133,26,128,13,63,175,1,128,0,
+  1,128,13,63,147,18,67,13,63,172,1,88,0,63,232,6,129,221,63,140,5,128,13,63,
+  175,1,128,0,1,66,13,63,249,9,129,0,63,173,1,66,13,63,24,128,0,63,160,3,
+  129,208,63,83,128,13,73,0,63,17,128,13,63,82,128,13,72,0,63,165,1,128,13,70,
+  0,63,167,1,128,13,63,181,14,128,13,63,148,5,66,13,63,168,1,68,13,108,0,63,
+  123,67,13,112,0,63,229,31,128,13,63,175,1,128,0,63,135,7,128,13,63,176,1,128,
+  13,63,179,1,129,221,63,156,3,128,13,63,176,1,128,13,63,202,8,128,13,63,211,6,
+  128,0,63,175,1,128,13,63,173,1,128,13,63,160,3,128,13,63,139,5,128,13,63,131,
+  100,63,249,73,128,13,63,175,1,128,13,63,158,3,130,13,13,63,175,1,128,13,63,157,
+  3,130,221,0,0,128,13,63,170,1,128,13,63,175,1,128,13,63,174,1,130,13,13,63,
+  175,1,128,13,63,172,1,129,13,63,137,1,128,13,63,175,1,128,13,34,129,13,63,138,
+  1,128,13,63,210,1,130,13,13,63,214,4,128,13,63,173,1,128,13,63,175,1,128,13,
+  0,129,208,49,128,13,63,121,129,208,63,174,1,129,208,0,129,208,47,128,13,63,213,2,
+  128,13,21,128,13,0,129,208,63,171,1,128,13,63,199,1,128,13,63,175,1,128,13,0,
+  128,13,63,174,1,128,13,63,129,1,129,208,63,218,1,128,13,63,132,1,129,208,63,217,
+  1,87,0,63,101,128,13,1,128,13,4,129,208,63,166,1,130,13,13,69,0,63,168,1,
+  66,13,4,129,208,63,169,1,69,0,63,171,1,69,0,128,13,63,169,1,128,13,68,0,
+  63,171,1,128,13,68,0,128,13,63,170,1,128,13,67,0,63,172,1,128,13,67,0,63,
+  172,1,128,13,66,0,63,173,1,128,13,63,172,28,77,0,63,162,1,66,13,74,0,63,
+  165,1,129,221,63,162,16,128,0,2,129,221,63,170,1,128,13,63,146,5,128,13,63,252,
+  6,128,13,63,175,1,128,0,3,129,221,63,229,11,67,13,63,24,128,13,63,160,3,130,
+  13,13,63,193,2,129,208,63,27,128,13,63,81,129,208,63,173,1,129,208,63,174,1,128,
+  13,63,174,1,67,13,63,245,6,128,0,63,175,1,128,13,63,156,3,128,13,63,165,3,
+  128,0,63,170,1,129,0,2,128,13,63,167,1,128,0,2,128,13,63,169,1,66,13,63,
+  169,30,86,0,63,153,1,128,13,63,178,1,82,0,63,157,1,128,13,63,164,3,75,0,
+  63,164,1,128,13,63,182,1,129,221,63,251,6,128,13,63,176,1,128,13,63,218,6,128,
+  13,63,175,10,128,13,63,161,3,128,13,63,174,1,128,13,63,156,3,128,13,63,175,1,
+  128,13,63,163,96,63,153,70,128,13,63,175,1,128,13,63,161,3,128,13,63,172,1,129,
+  13,0,128,13,63,145,5,128,13,63,169,1,130,13,0,66,13,63,174,1,127,92,0,63,
+  15,129,13,63,248,2,128,13,35,129,13,63,137,1,128,13,63,211,1,129,13,63,138,1,
+  129,208,63,174,1,129,208,32,129,29,63,157,3,129,13,63,117,128,13,0,128,13,63,173,
+  1,128,13,0,128,13,84,0,31,129,13,63,233,2,128,13,84,0,63,152,1,129,13,63,
+  152,1,128,13,23,128,13,83,0,63,130,1,128,13,63,199,1,128,0,0,128,13,82,0,
+  63,177,1,128,13,2,128,13,63,174,1,128,13,63,171,1,129,13,63,176,1,129,208,63,
+  156,3,128,0,63,126,128,13,63,172,1,128,13,1,128,13,47,128,13,63,238,2,128,13,
+  63,175,1,128,0,63,168,45,128,13,63,175,1,128,0,0,128,13,63,162,16,128,0,3,
+  129,221,63,169,1,128,13,63,163,3,128,13,63,174,1,128,13,63,250,6,90,0,63,149,
+  1,69,13,84,0,63,155,1,67,13,63,134,8,68,13,63,167,1,67,13,128,0,63,24,
+  128,0,63,160,3,129,208,63,177,1,128,13,63,80,128,13,72,0,63,19,129,208,63,175,
+  1,128,13,63,214,13,128,0,63,174,1,129,208,63,173,1,129,208,63,174,1,128,13,63,
+  181,1,66,13,63,169,1,68,13,63,166,1,70,13,63,166,1,69,13,63,171,1,129,221,
+  63,220,41,129,221,63,218,10,128,13,63,176,1,128,13,63,234,4,128,13,63,241,2,128,
+  13,63,175,1,128,0,63,172,1,128,13,63,174,1,129,13,0,128,13,127,9,0,63,213,
+  2,128,13,127,8,0,63,211,2,128,13,1,128,13,63,172,1,128,13,63,175,1,128,13,
+  63,175,1,129,221,63,179,94,63,201,64,128,13,63,175,1,128,13,63,175,1,128,13,63,
+  178,1,128,13,63,175,1,128,13,63,174,1,128,13,63,172,1,129,13,63,160,3,129,208,
+  63,178,1,128,13,63,208,6,128,13,63,175,1,128,13,63,175,1,128,13,91,0,63,244,
+  4,128,13,96,0,63,142,1,128,13,97,0,63,229,2,128,13,1,128,13,63,172,1,129,
+  13,63,177,1,129,208,63,172,1,129,13,63,177,1,129,208,63,150,1,128,13,63,197,1,
+  128,13,66,0,128,13,63,149,1,129,208,19,128,13,24,128,13,63,149,1,128,13,2,129,
+  208,19,128,13,2,128,13,63,130,3,128,13,63,177,1,128,0,19,129,208,0,129,208,63,
+  149,1,128,13,63,255,2,128,13,2,128,13,27,66,13,63,141,1,128,13,63,162,3,128,
+  13,63,175,1,128,0,63,140,49,128,13,63,162,16,128,0,4,129,221,63,168,1,128,13,
+  63,180,1,128,13,63,174,1,128,13,63,232,8,128,13,63,175,1,128,0,4,66,13,63,
+  173,1,66,0,0,66,13,63,238,9,68,13,63,140,2,128,13,63,175,1,129,208,63,81,
+  129,208,63,28,129,208,63,79,129,208,63,253,3,128,13,63,156,6,128,13,63,174,1,128,
+  13,63,214,10,128,13,5,128,0,63,171,1,128,0,63,170,1,129,0,3,111,0,63,119,
+  128,0,3,115,0,63,117,66,13,118,0,63,165,41,67,0,63,172,1,69,13,63,135,5,
+  129,208,63,159,3,129,208,63,175,1,129,208,63,175,1,128,13,63,176,1,128,13,63,249,
+  2,128,13,63,128,1,128,0,63,174,1,129,208,63,172,1,128,0,0,128,13,63,172,1,
+  129,208,63,174,1,128,13,63,160,3,128,13,127,7,0,63,215,2,128,13,63,141,5,129,
+  221,63,195,92,63,233,60,128,13,63,175,1,128,13,63,162,3,128,13,63,175,1,128,13,
+  63,158,3,128,13,127,172,1,0,129,13,63,144,5,128,13,67,0,128,13,63,156,3,128,
+  13,63,130,1,128,13,43,127,93,0,37,128,13,63,159,3,129,208,63,174,1,129,208,63,
+  255,6,129,208,63,194,8,128,13,63,175,1,128,13,63,224,1,128,13,63,126,129,208,46,
+  128,13,2,128,13,63,174,1,128,13,63,220,4,129,208,63,222,1,128,13,86,0,63,205,
+  2,128,13,3,128,13,63,171,1,128,13,67,0,49,128,13,63,121,128,13,2,128,13,70,
+  0,63,152,3,129,208,70,0,63,167,1,129,13,63,175,1,66,13,63,253,63,128,0,5,
+  129,221,63,167,1,128,13,63,180,1,128,13,63,215,10,128,13,63,175,1,128,0,6,128,
+  13,63,175,1,128,0,2,129,221,63,189,12,94,0,63,145,1,128,13,63,162,3,128,13,
+  63,141,5,128,13,63,138,8,128,13,63,238,8,66,13,63,165,1,128,13,2,68,13,63,
+  166,1,70,13,63,165,1,71,13,63,165,1,66,13,128,0,0,129,221,63,171,1,129,221,
+  63,237,39,128,13,63,175,1,128,0,4,129,221,63,215,10,128,13,127,57,0,63,14,128,
+  13,100,0,63,139,1,128,13,98,0,63,141,1,128,13,96,0,5,128,13,63,136,1,128,
+  13,94,0,7,128,13,63,136,1,128,13,63,223,4,129,208,63,157,3,129,208,63,173,1,
+  129,208,63,171,1,128,0,1,129,208,63,173,1,129,208,63,175,1,128,13,63,174,1,128,
+  13,63,157,3,129,221,63,174,1,129,221,63,227,88,63,137,57,128,13,63,175,1,128,13,
+  63,163,3,128,13,63,175,1,128,13,63,250,6,128,13,66,0,128,13,63,130,7,129,208,
+  63,125,128,13,47,128,13,63,126,128,13,44,128,0,63,129,1,128,13,83,0,23,129,208,
+  63,174,1,128,13,63,243,2,128,13,89,0,63,149,1,128,13,91,0,63,228,6,128,13,
+  97,0,63,176,6,128,13,63,175,1,128,13,84,0,28,128,13,63,175,1,128,13,3,128,
+  13,63,174,1,128,13,63,121,128,13,84,0,63,154,1,128,13,84,0,29,129,208,63,153,
+  3,129,208,63,128,1,128,13,84,0,63,147,1,128,13,53,129,208,63,114,128,13,4,128,
+  13,63,156,3,128,13,63,175,1,128,0,63,164,3,129,208,63,223,67,128,0,6,129,221,
+  63,166,1,128,13,3,129,221,63,197,12,89,0,63,150,1,69,13,83,0,63,156,1,69,
+  13,77,0,63,162,1,67,13,63,188,12,93,0,63,146,1,128,13,92,0,63,147,1,128,
+  13,91,0,63,148,1,128,13,63,142,5,128,13,63,154,65,128,13,63,175,1,128,0,5,
+  128,13,63,132,5,128,13,66,0,63,193,14,128,13,63,88,66,13,63,21,128,13,63,87,
+  128,0,63,138,5,128,13,2,128,13,127,8,0,63,214,2,128,13,127,6,0,63,102,128,
+  0,63,177,1,128,13,127,4,0,63,169,8,129,221,63,243,86,63,185,51,128,13,63,175,
+  1,128,13,63,175,1,128,13,63,179,1,128,13,63,175,1,128,13,63,175,1,128,13,63,
+  174,1,128,13,127,172,1,0,2,128,13,127,172,1,0,63,175,1,128,13,66,0,63,172,
+  1,129,13,0,128,13,127,172,1,0,2,128,13,127,172,1,0,63,246,2,128,13,42,128,
+  13,69,0,128,13,63,124,128,13,47,128,13,63,175,1,127,95,0,31,129,208,63,174,1,
+  129,208,40,130,13,13,63,175,1,127,92,0,63,200,3,129,208,63,255,6,129,208,63,241,
+  2,128,13,63,175,1,128,13,49,128,13,63,175,1,128,13,63,124,129,208,47,128,13,69,
+  0,128,13,63,168,1,128,13,68,0,63,153,3,128,13,68,0,128,13,63,121,129,208,63,
+  205,3,128,13,66,0,63,118,128,13,63,169,1,128,13,57,128,13,66,0,63,114,128,13,
+  68,0,128,13,70,0,63,163,1,128,13,63,178,1,67,0,49,128,0,63,121,128,13,66,
+  0,63,173,1,128,13,63,179,1,128,13,70,0,63,205,69,128,13,0,78,0,63,157,1,
+  128,13,0,80,0,63,155,1,128,13,0,82,0,63,155,1,85,0,63,210,10,128,13,63,
+  175,1,128,0,2,128,13,63,184,89,128,13,63,175,1,128,0,5,129,221,63,181,14,128,
+  13,127,58,0,63,248,7,128,13,63,176,1,128,13,63,230,106,63,218,47,128,11,63,175,
+  1,128,11,63,174,1,129,176,63,174,1,129,176,2,128,11,63,170,1,129,176,0,66,15,
+  63,170,1,128,11,1,66,15,63,170,1,128,11,1,66,15,63,170,1,128,11,2,128,11,
+  63,171,1,128,11,1,129,176,63,171,1,128,11,1,128,11,63,172,1,128,11,1,128,11,
+  63,171,1,129,176,1,128,11,63,171,1,66,15,129,176,63,170,1,68,15,63,171,1,69,
+  15,1,66,15,63,165,1,69,15,0,68,15,63,123,128,11,39,69,15,0,68,15,63,123,
+  128,11,39,68,15,1,68,15,63,123,128,11,40,67,15,1,67,15,63,125,128,11,39,128,
+  11,66,15,0,128,11,63,129,1,128,11,38,128,11,0,66,15,128,11,63,129,1,66,15,
+  37,128,11,0,66,15,63,130,1,66,15,36,128,11,1,128,11,63,132,1,66,15,36,128,
+  11,0,128,11,63,135,1,128,11,35,128,11,1,128,11,63,135,1,128,11,35,66,15,63,
+  136,1,128,11,34,68,15,63,135,1,66,15,31,69,15,63,134,1,68,15,30,69,15,63,
+  134,1,68,15,30,68,15,63,90,66,15,18,128,11,1,128,11,18,68,15,29,128,11,0,
+  66,15,63,90,68,15,17,128,11,1,66,15,17,66,15,2,128,11,26,129,187,63,93,68,
+  15,18,128,11,0,66,15,18,128,11,3,128,11,25,128,11,0,128,11,63,93,68,15,18,
+  128,11,0,66,15,19,128,11,1,128,11,4,66,15,18,129,187,63,95,66,15,20,128,11,
+  66,15,19,128,11,1,128,11,4,66,15,17,129,187,63,98,128,11,20,128,11,1,128,11,
+  19,128,11,66,15,3,128,11,66,15,15,68,15,63,97,128,11,20,128,11,2,128,11,18,
+  128,11,66,15,3,128,11,17,69,15,63,98,128,11,19,66,15,0,128,11,18,128,11,69,
+  15,128,11,18,69,15,63,98,128,11,19,67,15,0,128,11,17,66,15,0,66,15,19,68,
+  15,63,99,128,11,19,70,15,15,128,11,66,15,0,66,15,20,66,15,63,85,128,11,5,
+  128,11,6,128,11,20,70,15,14,128,11,69,15,20,129,187,63,88,128,11,5,128,11,5,
+  66,15,19,69,15,13,66,15,1,66,15,20,128,11,63,90,128,11,66,15,1,128,11,5,
+  66,15,19,69,15,13,66,15,1,66,15,19,128,11,63,92,69,15,128,11,4,66,15,19,
+  68,15,14,66,15,0,128,11,22,128,11,63,92,70,15,128,11,3,66,15,20,66,15,15,
+  67,15,22,128,11,63,95,71,15,4,128,11,19,66,15,128,11,77,8,68,15,21,128,11,
+  63,96,71,15,4,128,11,18,128,8,66,15,77,8,69,15,128,8,20,128,11,63,97,70,
+  15,5,128,11,14,84,8,68,15,68,8,16,128,11,63,101,67,15,5,128,11,11,71,8,
+  66,15,76,8,68,15,71,8,12,128,11,63,103,68,15,4,128,11,8,73,8,66,15,77,
+  8,66,15,74,8,10,128,11,63,105,69,15,1,128,11,6,75,8,66,15,77,8,66,15,
+  76,8,6,66,15,63,105,70,15,1,128,11,3,112,8,4,66,15,63,107,68,15,1,66,
+  15,116,8,2,66,15,63,107,68,15,0,68,15,79,8,66,15,98,8,128,11,63,111,66,
+  15,1,68,15,79,8,66,15,99,8,63,114,128,11,0,68,15,79,8,66,15,100,8,63,
+  113,66,8,66,15,122,8,63,110,127,3,8,63,108,69,8,66,15,80,8,66,15,103,8,
+  63,106,70,8,66,15,79,8,68,15,103,8,63,104,71,8,66,15,79,8,68,15,104,8,
+  63,102,91,8,68,15,105,8,63,100,93,8,66,15,107,8,63,98,107,8,66,15,95,8,
+  63,97,107,8,66,15,95,8,63,96,108,8,66,15,96,8,63,94,127,19,8,63,92,127,
+  21,8,63,91,127,20,8,66,15,63,88,102,8,66,15,105,8,68,15,1,66,15,63,82,
+  102,8,66,15,105,8,68,15,128,11,70,15,63,78,103,8,66,15,69,8,66,15,96,8,
+  68,15,0,70,15,66,11,63,75,96,8,66,15,76,8,66,15,88,8,66,15,69,8,66,
+  15,1,70,15,2,69,11,67,15,63,64,96,8,68,15,69,8,66,15,66,8,66,15,87,
+  8,68,15,72,8,1,66,15,11,67,15,0,66,15,63,60,96,8,68,15,68,8,68,15,
+  92,8,68,15,72,8,16,67,15,128,11,66,15,63,59,97,8,68,15,68,8,68,15,92,
+  8,68,15,73,8,20,66,15,63,59,98,8,69,15,66,8,68,15,93,8,66,15,74,8,
+  63,82,102,8,66,15,67,8,66,15,84,8,66,15,85,8,63,81,102,8,66,15,73,8,
+  66,15,78,8,66,15,85,8,63,81,106,8,66,15,68,8,68,15,77,8,66,15,85,8,
+  63,80,107,8,66,15,68,8,68,15,103,8,63,79,107,8,66,15,68,8,68,15,103,8,
+  63,79,116,8,66,15,104,8,0,66,15,0,66,15,5,66,15,63,61,113,8,66,15,108,
+  8,72,15,0,66,11,68,15,128,11,63,59,113,8,66,15,128,8,66,15,104,8,72,15,
+  128,11,2,68,15,63,60,112,8,72,15,103,8,75,15,128,11,68,15,63,60,111,8,74,
+  15,103,8,66,15,0,66,15,0,66,15,1,66,15,63,61,111,8,74,15,90,8,66,15,
+  73,8,6,128,11,66,15,63,65,87,8,66,15,85,8,68,15,128,8,68,15,89,8,68,
+  15,73,8,3,129,187,0,66,15,63,65,86,8,68,15,85,8,66,15,96,8,68,15,71,
+  8,67,15,129,187,63,71,86,8,68,15,116,8,67,15,128,8,68,15,66,8,66,15,128,
+  8,69,15,63,72,86,8,68,15,116,8,68,15,128,8,66,15,66,8,74,15,63,72,79,
+  8,66,15,68,8,66,15,117,8,68,15,66,8,66,15,128,8,74,15,69,11,0,71,15,
+  63,57,78,8,68,15,79,8,66,15,99,8,66,15,68,8,66,15,66,8,66,15,128,8,
+  68,15,128,8,67,15,6,128,11,71,15,63,57,78,8,68,15,78,8,67,15,99,8,66,
+  15,74,8,66,15,129,136,66,15,67,8,9,71,15,129,187,63,55,74,8,66,15,128,8,
+  68,15,78,8,67,15,99,8,66,15,86,8,63,75,74,8,66,15,129,136,66,15,79,8,
+  66,15,126,8,63,75,69,8,71,15,127,23,8,63,75,69,8,69,15,127,19,8,67,15,
+  129,136,63,75,69,8,69,15,127,19,8,67,15,129,136,63,75,70,8,66,15,102,8,66,
+  15,106,8,67,15,129,136,63,75,69,8,67,15,102,8,66,15,107,8,66,15,129,136,63,
+  75,69,8,66,15,103,8,66,15,112,8,63,76,68,8,66,15,127,27,8,0,128,11,63,
+  75,68,8,66,15,127,26,8,66,15,128,11,63,74,67,8,68,15,108,8,66,15,103,8,
+  68,15,63,72,66,15,66,8,68,15,108,8,66,15,103,8,68,15,63,71,68,15,129,136,
+  68,15,108,8,66,15,103,8,68,15,63,71,68,15,66,8,66,15,127,26,8,66,15,63,
+  72,68,15,127,32,8,63,74,128,11,0,66,15,127,33,8,63,73,128,11,1,128,11,2,
+  66,15,127,28,8,63,73,128,11,6,66,15,127,28,8,63,72,128,11,7,66,15,127,28,
+  8,63,71,128,11,7,128,11,0,127,29,8,63,71,128,11,7,128,11,1,127,29,8,63,
+  70,128,11,1,68,15,129,187,3,127,9,8,66,15,78,8,63,70,128,11,2,68,15,5,
+  127,9,8,66,15,78,8,63,69,68,11,68,15,6,127,8,8,66,15,77,8,63,66,71,
+  11,12,127,25,8,63,63,66,11,0,66,11,17,127,23,8,63,66,129,187,20,127,23,8,
+  63,90,127,21,8,63,91,127,21,8,63,92,127,19,8,63,94,127,17,8,63,96,127,15,
+  8,63,97,127,15,8,63,98,127,13,8,63,100,127,11,8,0,128,11,63,100,127,9,8,
+  2,128,11,63,100,106,8,66,15,88,8,3,128,11,63,101,105,8,66,15,87,8,5,128,
+  11,63,101,104,8,66,15,86,8,7,128,11,63,101,127,1,8,9,67,15,63,99,124,8,
+  11,67,15,63,100,75,8,66,15,107,8,12,67,15,128,11,63,100,73,8,68,15,105,8,
+  18,128,11,63,101,71,8,68,15,103,8,21,129,187,63,101,69,8,68,15,101,8,25,129,
+  187,63,101,68,8,66,15,100,8,29,128,11,66,15,63,99,104,8,32,67,15,8,66,15,
+  0,66,15,63,84,95,8,66,15,129,136,34,67,15,69,11,1,72,15,63,82,128,11,0,
+  128,11,0,92,8,66,15,37,66,15,5,129,187,72,15,63,81,128,11,0,128,11,4,88,
+  8,0,67,15,38,128,11,7,72,15,63,81,128,11,0,128,11,9,78,8,6,67,15,38,
+  128,11,7,66,15,0,66,15,63,81,128,11,66,15,31,67,15,38,129,176,63,94,128,11,
+  0,66,15,32,66,15,39,128,11,63,94,128,11,0,66,15,35,66,15,37,128,11,63,92,
+  128,11,1,66,15,35,66,15,37,128,11,63,92,128,11,0,66,15,36,66,15,38,128,11,
+  63,90,128,11,0,67,15,38,128,11,38,129,176,63,88,128,11,1,67,15,39,128,11,66,
+  15,35,66,15,63,86,128,11,0,67,15,40,68,15,34,66,15,63,83,66,15,1,66,15,
+  41,68,15,34,66,15,63,82,68,15,128,11,66,15,41,68,15,36,66,15,63,80,68,15,
+  0,128,11,44,66,15,37,66,15,63,80,70,15,63,22,66,15,63,79,71,15,63,22,66,
+  15,63,79,71,15,63,168,1,68,15,128,11,63,170,1,68,15,63,172,1,66,15,128,11,
+  63,172,1,66,11,63,173,1,66,11,63,173,1,66,15,63,172,1,68,15,63,171,1,68,
+  15,63,171,1,68,15,63,172,1,66,15,63,130,85,63,190,51,66,15,63,173,1,66,15,
+  63,171,1,129,0,0,129,255,63,171,1,129,176,127,171,1,0,2,129,176,127,171,1,0,
+  63,144,5,66,15,63,172,1,70,15,63,172,1,67,15,1,66,15,63,163,1,128,0,3,
+  66,15,0,68,15,63,162,1,128,0,4,128,15,3,66,15,63,162,1,129,176,3,129,15,
+  3,129,255,63,162,1,131,176,0,1,129,15,3,128,15,63,163,1,130,176,0,1,128,15,
+  0,128,0,2,127,95,0,28,66,15,38,129,11,1,128,15,0,128,11,127,95,0,31,66,
+  15,39,128,0,1,128,15,63,129,1,66,15,39,128,0,66,11,63,129,1,129,176,85,0,
+  18,129,187,127,92,0,38,129,176,87,0,63,150,1,129,176,0,129,255,34,66,15,63,134,
+  1,68,15,32,68,15,63,133,1,68,15,35,129,255,63,133,1,68,15,31,128,11,3,128,
+  15,63,87,66,15,63,15,129,176,3,128,15,63,86,68,15,41,130,0,11,96,0,130,27,
+  11,63,90,68,15,41,130,0,11,96,0,130,11,11,127,83,0,6,68,15,21,66,15,16,
+  130,0,11,95,0,1,130,11,1,63,93,83,0,23,129,176,67,0,4,66,15,63,115,130,
+  0,11,84,0,26,66,15,3,66,15,17,66,15,63,94,66,0,128,11,83,0,66,15,128,
+  11,84,0,1,66,15,23,68,15,63,94,130,0,11,19,66,15,129,176,21,66,15,3,128,
+  11,82,0,68,15,63,117,67,15,21,130,0,11,0,66,15,0,83,0,3,128,15,63,118,
+  66,15,21,130,176,0,0,66,15,18,130,0,11,63,125,66,15,16,67,15,129,0,1,128,
+  15,18,130,0,11,78,0,63,107,129,187,1,66,15,15,70,15,128,11,19,130,176,11,79,
+  0,63,106,128,0,21,70,15,85,0,128,11,81,0,63,69,69,15,6,67,15,25,79,0,
+  70,15,63,110,70,15,5,67,15,83,0,68,15,80,0,1,131,255,176,85,0,63,89,70,
+  15,5,67,15,84,0,2,128,11,80,0,1,130,255,11,85,0,63,92,69,15,128,0,5,
+  130,0,11,23,78,0,67,15,63,125,129,255,2,130,0,11,37,68,15,128,11,63,117,72,
+  15,69,0,24,76,6,68,15,86,0,63,96,71,15,69,0,19,128,6,2,77,6,4,129,
+  102,63,119,129,0,2,128,11,70,0,15,67,6,66,15,78,6,2,69,6,63,118,71,15,
+  15,70,6,66,15,90,6,63,117,128,0,3,129,255,12,72,6,66,15,92,6,8,66,15,
+  63,104,69,15,128,0,0,66,15,5,74,6,66,15,94,6,63,120,128,0,0,67,15,2,
+  76,6,66,15,96,6,63,114,66,15,129,0,0,67,15,128,0,116,6,2,128,11,99,0,
+  63,73,131,0,11,0,67,15,119,6,63,112,130,0,11,0,66,15,121,6,63,116,124,6,
+  63,113,85,6,66,15,103,6,63,110,66,6,66,15,79,6,68,15,103,6,63,108,67,6,
+  66,15,79,6,68,15,104,6,63,106,68,6,66,15,79,6,68,15,74,6,66,15,91,6,
+  63,104,89,6,66,15,75,6,66,15,92,6,63,102,105,6,66,15,93,6,63,100,127,13,
+  6,63,98,127,15,6,63,97,127,15,6,63,96,98,6,66,15,106,6,63,94,99,6,66,
+  15,107,6,63,92,100,6,66,15,108,6,0,66,15,63,87,110,6,66,15,98,6,1,66,
+  15,3,66,15,63,78,111,6,66,15,98,6,2,129,255,66,0,69,15,63,76,92,6,66,
+  15,79,6,66,15,91,6,66,15,67,6,2,128,15,0,66,0,2,66,15,63,75,92,6,
+  68,15,71,6,0,129,255,97,6,68,15,67,6,1,128,15,67,11,2,66,15,7,69,15,
+  63,61,92,6,68,15,70,6,68,15,96,6,0,67,15,68,6,1,68,0,1,128,15,7,
+  129,0,1,67,15,63,60,93,6,68,15,70,6,68,15,96,6,1,66,15,69,6,1,78,
+  0,129,187,1,69,15,63,58,94,6,66,15,128,6,2,67,6,68,15,97,6,0,129,255,
+  70,6,16,67,0,0,129,187,0,129,255,63,57,99,6,2,68,6,2,67,6,66,15,102,
+  6,20,129,0,0,129,255,63,57,99,6,2,74,6,68,15,80,6,66,15,81,6,63,82,
+  114,6,68,15,80,6,66,15,82,6,63,81,105,6,66,15,69,6,68,15,80,6,66,15,
+  82,6,63,81,105,6,66,15,70,6,2,103,6,63,80,106,6,66,15,114,6,63,79,110,
+  6,66,15,110,6,7,66,15,5,66,15,63,59,110,6,66,15,110,6,0,129,0,0,128,
+  15,0,128,0,0,67,15,1,129,0,0,67,15,63,57,111,6,66,15,67,6,66,15,104,
+  6,128,0,6,66,15,0,66,11,1,66,15,63,57,117,6,2,129,255,103,6,128,11,6,
+  66,15,0,130,187,0,1,66,15,63,57,109,6,66,15,68,6,3,128,15,103,6,128,0,
+  4,128,0,3,128,15,0,66,0,0,129,255,63,58,108,6,68,15,67,6,4,128,15,102,
+  6,129,0,0,128,15,0,66,0,129,187,0,66,15,78,0,63,48,108,6,68,15,68,6,
+  3,128,15,91,6,0,129,255,71,6,7,129,0,0,66,15,63,62,85,6,66,15,84,6,
+  68,15,68,6,3,128,15,90,6,2,129,255,71,6,6,66,0,66,15,63,62,84,6,68,
+  15,84,6,66,15,69,6,66,15,92,6,2,129,255,71,6,1,129,255,63,71,84,6,68,
+  15,92,6,66,15,93,6,2,129,255,70,6,3,129,255,63,70,84,6,68,15,92,6,66,
+  15,88,6,2,130,111,6,0,129,255,67,6,2,128,6,3,129,255,63,70,77,6,66,15,
+  68,6,66,15,93,6,66,15,88,6,2,128,15,71,6,8,129,255,4,66,0,3,75,0,
+  63,46,76,6,68,15,127,1,6,2,128,15,68,6,76,15,5,66,11,4,129,255,63,55,
+  76,6,68,15,79,6,66,15,104,6,66,15,74,6,72,15,9,66,0,4,129,255,63,55,
+  76,6,0,67,15,76,6,69,15,104,6,66,15,74,6,66,15,128,6,66,15,129,102,16,
+  66,15,63,55,71,6,66,15,66,6,66,15,77,6,69,15,104,6,66,15,83,6,63,75,
+  71,6,2,83,6,66,15,127,3,6,63,75,67,6,70,15,127,26,6,63,75,67,6,68,
+  15,127,26,6,66,15,63,74,67,6,68,15,127,26,6,66,15,63,74,67,6,66,15,127,
+  28,6,67,15,63,73,67,6,66,15,104,6,66,15,112,6,66,15,63,74,66,6,66,15,
+  104,6,66,15,112,6,66,15,63,74,110,6,66,15,112,6,129,0,63,75,110,6,66,15,
+  112,6,129,11,0,129,255,63,70,130,0,6,66,15,127,31,6,128,11,1,66,15,63,66,
+  66,15,129,0,1,66,15,112,6,2,105,6,128,0,1,66,15,63,65,68,15,128,11,1,
+  66,15,112,6,66,15,104,6,129,0,0,67,15,63,65,68,15,128,0,1,66,15,112,6,
+  66,15,104,6,2,66,15,63,66,68,15,129,11,66,15,127,30,6,63,73,67,15,2,127,
+  31,6,63,81,127,31,6,63,78,66,15,127,31,6,63,78,66,15,0,127,29,6,63,79,
+  66,15,0,127,29,6,63,73,67,0,66,11,3,127,27,6,63,71,69,15,129,187,5,127,
+  10,6,1,128,15,77,6,63,71,69,15,72,0,127,9,6,1,128,15,76,6,63,72,69,
+  15,8,127,9,6,66,15,76,6,63,88,127,23,6,63,89,127,23,6,63,90,127,21,6,
+  63,91,127,21,6,63,92,127,19,6,63,94,127,17,6,63,96,127,15,6,63,97,127,15,
+  6,63,98,127,13,6,63,100,127,11,6,63,102,127,9,6,63,104,127,7,6,63,106,127,
+  5,6,63,108,104,6,2,86,6,63,110,103,6,66,15,85,6,9,129,187,88,0,63,76,
+  101,6,66,15,83,6,11,130,0,11,86,0,63,78,122,6,12,66,0,128,11,63,101,120,
+  6,15,67,15,63,101,71,6,2,105,6,17,67,15,63,103,68,6,68,15,102,6,19,67,
+  15,63,105,66,6,68,15,100,6,30,75,0,63,90,128,6,68,15,98,6,32,129,187,72,
+  0,1,127,44,0,46,66,15,97,6,34,129,0,1,128,15,6,127,46,0,48,94,6,103,
+  0,1,128,15,6,66,11,2,128,11,127,40,0,50,88,6,0,129,176,103,0,66,15,6,
+  129,0,6,128,15,63,93,78,6,9,101,0,66,15,7,128,0,1,70,15,63,79,130,0,
+  11,34,104,0,8,72,15,63,79,129,176,96,0,67,15,49,71,15,63,115,66,15,128,11,
+  103,0,12,66,15,63,116,69,15,63,133,1,128,0,1,128,15,63,174,1,101,0,66,15,
+  63,135,1,104,0,0,96,0,5,128,11,127,58,0,31,128,0,43,129,176,37,129,176,127,
+  58,0,25,130,0,11,1,129,176,107,0,3,128,15,33,128,0,1,128,15,63,81,132,0,
+  11,0,45,128,0,3,128,15,34,66,15,127,58,0,25,129,176,67,15,45,129,255,34,68,
+  15,63,78,68,15,128,0,1,129,255,43,66,15,36,128,0,1,128,15,63,83,128,0,1,
+  128,15,63,21,128,0,1,128,15,63,85,127,7,0,17,66,15,63,82,129,255,63,25,66,
+  15,63,76,71,15,63,25,66,15,63,76,68,15,63,171,1,68,15,63,171,1,68,15,63,
+  172,1,66,15,127,1,0,63,108,130,176,11,126,0,63,110,130,176,11,124,0,63,112,130,
+  176,11,122,0,63,113,66,15,121,0,63,114,68,15,63,171,1,68,15,63,171,1,68,15,
+  63,172,1,66,15,63,196,77,63,239,45,66,15,63,173,1,66,15,63,173,1,66,15,63,
+  172,1,127,172,1,0,3,128,11,127,171,1,0,3,128,11,127,170,1,0,63,145,5,67,
+  15,63,171,1,70,15,63,172,1,67,15,63,168,1,128,0,5,128,15,1,66,15,63,163,
+  1,129,176,4,128,15,3,129,255,63,162,1,132,176,176,0,1,129,15,3,128,15,63,162,
+  1,131,176,176,67,0,4,128,15,63,163,1,129,0,3,128,0,63,126,66,15,45,128,0,
+  2,127,98,0,24,66,15,40,128,11,1,128,15,0,129,187,127,96,0,63,9,128,11,66,
+  0,63,128,1,129,176,0,129,255,38,130,11,0,63,129,1,128,0,1,66,15,63,171,1,
+  68,15,35,66,15,63,132,1,68,15,34,68,15,63,173,1,66,15,63,131,1,129,176,90,
+  0,8,128,11,3,129,255,63,83,66,15,44,129,176,92,0,6,128,11,3,128,15,63,83,
+  68,15,43,129,176,94,0,4,129,176,63,87,68,15,108,0,128,11,96,0,2,129,176,127,
+  85,0,1,68,15,109,0,36,127,85,0,3,66,15,87,0,66,15,29,66,15,19,66,15,
+  63,91,66,0,128,11,82,0,69,15,83,0,2,66,15,3,66,15,18,68,15,63,91,130,
+  0,11,18,69,15,83,0,2,66,15,25,68,15,63,113,66,15,0,129,176,83,0,9,85,
+  0,1,66,15,63,139,1,66,15,129,176,69,0,128,11,83,0,2,128,15,63,119,66,15,
+  17,66,15,130,176,0,66,15,20,129,176,63,124,66,15,16,67,15,25,129,176,63,121,128,
+  11,1,66,15,17,66,15,26,128,11,76,0,63,108,128,11,21,128,0,2,66,15,129,176,
+  63,107,67,15,33,67,15,128,11,80,0,63,116,68,15,7,67,15,23,129,176,80,0,63,
+  116,70,15,5,67,15,84,0,2,129,176,78,0,68,15,130,0,11,85,0,63,88,71,15,
+  4,67,15,128,11,22,129,176,13,68,15,66,0,63,125,66,0,128,11,38,68,15,129,0,
+  63,120,128,0,66,15,29,128,11,13,68,15,63,126,69,0,20,66,15,128,11,13,128,0,
+  63,122,66,0,4,70,0,19,66,15,128,0,0,77,5,63,123,129,0,2,128,0,1,128,
+  15,24,66,15,85,5,63,121,128,0,1,66,15,20,66,5,66,15,88,5,63,118,128,0,
+  4,68,0,12,69,5,66,15,91,5,11,66,15,63,101,68,15,67,0,66,15,8,104,5,
+  8,128,0,1,128,15,63,102,66,15,128,11,66,0,68,15,5,108,5,6,128,0,1,128,
+  15,63,104,132,0,11,0,68,15,67,0,112,5,4,128,11,99,0,63,72,130,0,11,0,
+  68,15,128,0,0,116,5,63,120,128,0,80,5,66,15,100,5,63,116,129,0,80,5,68,
+  15,100,5,63,116,81,5,68,15,101,5,63,113,128,5,66,15,79,5,68,15,75,5,66,
+  15,88,5,63,110,129,85,66,15,80,5,2,76,5,66,15,89,5,63,108,66,5,66,15,
+  96,5,66,15,90,5,63,106,127,7,5,63,104,127,9,5,63,102,127,11,5,63,100,94,
+  5,66,15,106,5,63,98,95,5,66,15,107,5,63,97,95,5,66,15,107,5,63,96,108,
+  5,66,15,96,5,63,94,109,5,66,15,97,5,2,66,15,6,66,15,63,76,110,5,66,
+  15,98,5,3,129,255,4,68,15,63,75,89,5,66,15,119,5,128,0,3,128,15,2,129,
+  0,0,68,15,63,73,89,5,68,15,113,5,66,15,66,5,3,128,15,1,66,0,2,66,
+  15,63,73,89,5,68,15,72,5,66,15,100,5,1,66,15,130,85,11,5,67,0,1,66,
+  15,11,66,15,63,57,90,5,68,15,71,5,68,15,99,5,2,129,255,66,5,129,0,3,
+  69,11,7,128,0,2,66,0,66,15,63,57,91,5,66,15,128,5,1,128,15,68,5,68,
+  15,67,5,66,15,92,5,2,129,255,66,5,6,68,0,7,128,0,2,66,0,66,15,63,
+  56,96,5,1,128,15,68,5,68,15,66,5,68,15,92,5,1,128,15,68,5,18,128,11,
+  2,129,0,1,128,15,63,57,96,5,0,128,15,0,69,5,2,67,5,68,15,83,5,66,
+  15,77,5,23,128,0,1,128,15,63,56,113,5,68,15,83,5,66,15,78,5,22,128,0,
+  1,128,15,63,56,102,5,66,15,72,5,2,84,5,66,15,78,5,63,82,103,5,66,15,
+  115,5,63,81,103,5,66,15,115,5,63,81,127,31,5,63,80,109,5,66,15,111,5,63,
+  79,109,5,66,15,111,5,7,66,0,66,15,2,129,0,0,129,255,63,57,109,5,66,15,
+  68,5,66,15,103,5,2,66,0,66,15,128,0,1,66,15,0,129,0,2,129,255,63,55,
+  117,5,68,15,103,5,0,66,0,6,66,15,0,129,187,2,129,255,63,55,117,5,4,103,
+  5,0,66,11,6,66,15,0,129,0,2,129,255,63,55,106,5,66,15,71,5,4,103,5,
+  0,66,0,1,66,15,128,0,2,128,15,1,129,0,0,129,255,63,56,105,5,70,15,69,
+  5,4,129,255,100,5,1,66,0,66,15,1,128,0,3,66,15,63,59,105,5,70,15,72,
+  5,1,129,255,91,5,0,129,255,69,5,9,128,0,3,66,15,63,58,106,5,70,15,72,
+  5,1,129,255,90,5,2,129,255,69,5,9,67,0,66,15,63,58,83,5,66,15,84,5,
+  66,15,73,5,1,128,15,93,5,2,129,255,69,5,128,0,63,74,82,5,68,15,96,5,
+  0,129,255,93,5,2,129,255,69,5,4,128,15,63,69,82,5,68,15,96,5,0,129,255,
+  87,5,2,66,15,128,5,0,129,255,68,5,72,15,63,68,82,5,68,15,123,5,2,66,
+  15,71,5,7,129,255,5,66,0,0,66,15,63,55,75,5,66,15,68,5,66,15,95,5,
+  66,15,89,5,2,66,15,71,5,6,66,15,5,66,11,3,129,255,63,53,74,5,68,15,
+  102,5,66,15,91,5,66,15,69,5,5,69,15,6,66,0,3,129,255,63,53,74,5,68,
+  15,79,5,2,83,5,66,15,86,5,66,15,74,5,66,15,128,5,66,15,15,129,0,0,
+  129,255,63,53,74,5,68,15,75,5,66,15,128,5,2,109,5,66,15,74,5,66,15,66,
+  5,63,75,69,5,66,15,66,5,66,15,76,5,66,15,128,5,1,128,15,109,5,66,15,
+  80,5,63,75,128,5,71,15,82,5,66,15,127,6,5,63,75,128,5,71,15,127,28,5,
+  92,0,63,46,128,5,68,15,127,31,5,0,66,15,63,71,129,85,67,15,127,31,5,1,
+  129,255,63,71,129,85,67,15,127,31,5,1,66,15,63,71,129,85,66,15,127,30,5,130,
+  176,0,66,15,63,71,109,5,66,15,113,5,2,66,15,63,71,109,5,66,15,113,5,1,
+  90,0,63,48,108,5,67,15,113,5,0,66,0,1,128,15,63,65,66,0,66,15,107,5,
+  66,15,114,5,0,129,11,2,129,255,63,62,66,15,128,0,1,66,15,106,5,66,15,69,
+  5,2,104,5,1,129,0,2,129,255,63,61,73,15,115,5,2,104,5,2,128,0,1,66,
+  15,63,61,73,15,115,5,66,15,104,5,4,66,15,63,62,68,15,128,0,0,129,255,0,
+  127,31,5,63,72,67,15,4,127,31,5,63,78,66,0,127,31,5,63,76,66,15,129,176,
+  0,127,29,5,63,77,66,15,129,11,0,127,29,5,63,77,66,15,3,127,27,5,63,71,
+  66,0,68,11,5,127,27,5,63,69,69,15,128,11,73,0,127,10,5,1,128,15,75,5,
+  63,70,69,15,74,0,127,10,5,1,128,15,75,5,63,70,69,15,11,127,9,5,66,15,
+  74,5,63,89,127,23,5,63,90,127,21,5,63,91,127,21,5,63,92,127,19,5,63,94,
+  127,17,5,63,96,127,15,5,63,97,127,15,5,63,98,127,13,5,63,100,127,11,5,63,
+  102,127,9,5,63,104,127,7,5,63,106,127,5,5,63,108,127,3,5,63,110,103,5,2,
+  85,5,63,113,101,5,2,83,5,63,116,100,5,66,15,82,5,63,118,120,5,15,66,0,
+  128,11,63,101,116,5,17,67,0,63,103,112,5,19,66,0,0,129,255,63,103,67,5,2,
+  101,5,24,66,15,63,105,128,5,4,98,5,26,66,15,63,106,68,15,96,5,28,66,15,
+  4,71,11,63,93,68,15,93,5,39,128,0,1,128,15,8,67,11,63,85,66,15,2,88,
+  5,42,128,0,1,128,15,7,127,46,0,54,78,5,6,129,176,103,0,1,66,15,5,66,
+  0,2,127,40,0,63,57,66,15,5,129,0,4,128,0,0,129,255,63,115,128,11,39,66,
+  15,6,128,0,6,66,15,63,76,129,176,96,0,66,15,128,0,50,73,15,63,75,66,15,
+  96,0,66,15,130,0,11,101,0,11,66,15,0,68,15,63,75,66,15,96,0,70,15,53,
+  66,15,63,75,128,0,1,128,15,34,68,15,63,171,1,68,15,63,178,1,94,0,63,98,
+  67,15,41,128,0,2,90,0,8,129,176,127,58,0,63,52,128,0,1,128,15,63,80,130,
+  0,11,1,128,0,63,22,128,0,2,127,58,0,20,132,0,11,11,0,129,176,108,0,68,
+  15,35,66,15,127,60,0,21,129,11,48,66,15,37,128,0,1,128,15,63,76,68,15,128,
+  0,1,129,255,63,166,1,73,15,63,174,1,128,15,63,24,129,0,0,129,255,63,78,128,
+  0,66,15,63,27,66,15,63,73,68,15,128,11,63,30,66,15,63,73,68,15,128,11,63,
+  169,1,69,15,63,170,1,68,15,63,171,1,68,15,63,172,1,66,15,63,174,1,129,17,
+  122,0,63,114,66,0,66,1,63,170,1,69,0,63,173,1,69,0,63,166,1,68,15,63,
+  171,1,68,15,63,171,1,68,15,63,172,1,66,15,63,245,71,63,145,42,66,14,63,173,
+  1,66,14,63,171,1,129,0,66,14,63,171,1,127,171,1,0,4,127,171,1,0,63,147,
+  5,66,14,63,172,1,68,14,63,170,1,69,14,63,169,1,70,14,63,168,1,128,11,70,
+  14,1,66,14,63,163,1,128,11,70,14,0,68,14,63,162,1,129,11,69,14,0,68,14,
+  63,163,1,130,0,11,68,0,68,14,63,119,66,14,42,66,14,128,0,69,14,63,120,66,
+  14,42,66,14,0,66,14,127,109,0,13,66,14,41,128,11,66,14,0,66,14,127,102,0,
+  20,130,11,0,66,14,38,128,11,68,0,128,11,127,99,0,24,129,11,68,14,37,67,0,
+  63,127,129,11,68,14,63,171,1,68,14,63,170,1,129,11,66,14,36,66,14,63,131,1,
+  128,11,85,0,17,68,14,63,130,1,128,11,87,0,14,128,0,68,14,63,81,66,14,46,
+  89,0,11,129,11,68,14,63,80,68,14,63,20,130,0,11,66,14,63,81,68,14,63,20,
+  129,176,127,85,0,68,14,109,0,35,66,14,127,87,0,66,14,84,0,66,14,0,66,14,
+  22,66,14,27,68,14,63,86,87,0,66,14,0,66,14,22,66,14,4,66,14,19,68,14,
+  63,87,86,0,66,14,0,66,14,22,66,14,3,128,0,66,14,18,128,0,68,14,63,111,
+  128,0,68,14,19,66,14,71,0,66,14,17,130,176,0,66,14,63,112,128,0,68,14,19,
+  66,14,130,0,11,3,86,0,129,187,67,0,63,111,128,0,66,14,0,66,14,17,66,14,
+  130,0,11,0,66,14,21,128,11,66,14,67,0,63,112,129,11,68,14,16,130,176,0,3,
+  66,14,21,128,11,66,14,63,116,129,176,68,14,16,128,0,67,14,0,128,0,66,14,21,
+  128,11,66,14,63,116,128,0,69,14,16,128,0,67,14,0,66,0,22,128,11,74,0,63,
+  71,66,14,34,68,14,82,0,69,14,129,0,63,105,68,14,8,66,14,21,66,14,129,176,
+  81,0,66,14,128,11,66,14,63,107,68,14,72,0,67,14,20,66,14,129,0,16,67,14,
+  128,11,66,14,63,107,70,14,6,67,14,128,11,19,66,14,128,0,16,68,14,66,0,128,
+  11,63,108,70,14,128,0,5,66,14,128,11,20,130,187,0,16,68,14,63,113,128,0,68,
+  14,66,0,3,67,0,20,128,0,66,14,14,128,0,68,14,63,114,73,14,26,67,14,14,
+  128,0,67,14,63,116,72,14,70,0,18,68,14,14,128,0,67,14,63,118,129,0,68,14,
+  128,11,24,67,14,128,11,15,128,0,66,14,63,121,130,187,0,66,14,23,66,14,129,176,
+  1,78,3,66,11,63,121,129,0,68,14,24,88,3,63,121,68,14,69,0,15,94,3,14,
+  66,14,63,100,68,14,67,0,66,14,11,100,3,11,66,14,63,101,66,14,129,187,1,68,
+  14,8,104,3,9,66,14,63,102,66,0,2,68,14,70,0,108,3,7,128,11,97,0,63,
+  76,68,14,128,11,3,75,3,66,14,97,3,63,118,66,14,129,176,1,76,3,68,14,77,
+  3,66,14,81,3,63,117,67,0,78,3,68,14,77,3,66,14,83,3,63,118,79,3,68,
+  14,77,3,66,14,84,3,63,114,66,14,80,3,66,14,103,3,63,113,66,14,125,3,63,
+  110,128,3,66,14,126,3,63,108,127,5,3,63,106,127,7,3,63,104,91,3,66,14,105,
+  3,63,102,92,3,66,14,106,3,63,100,93,3,66,14,107,3,63,98,107,3,66,14,95,
+  3,63,97,107,3,66,14,95,3,63,96,108,3,66,14,96,3,16,66,14,63,74,85,3,
+  66,14,121,3,2,129,0,66,14,4,129,0,68,14,63,72,85,3,68,14,121,3,0,129,
+  0,68,14,2,66,0,69,14,63,71,85,3,68,14,74,3,66,14,105,3,66,14,129,0,
+  68,14,2,66,0,69,14,63,70,86,3,68,14,73,3,68,14,103,3,68,14,128,0,68,
+  14,2,67,0,68,14,63,70,87,3,66,14,74,3,68,14,68,3,66,14,95,3,68,14,
+  129,187,66,14,4,83,0,66,14,63,54,93,3,66,14,69,3,68,14,67,3,68,14,94,
+  3,68,14,20,129,0,66,14,0,66,0,66,14,63,54,93,3,66,14,70,3,66,14,68,
+  3,68,14,95,3,66,14,128,3,20,129,0,66,14,0,69,14,63,53,94,3,66,14,78,
+  3,68,14,86,3,66,14,74,3,19,129,11,66,14,128,0,66,14,63,56,113,3,66,14,
+  87,3,66,14,74,3,24,128,0,66,14,63,55,101,3,66,14,100,3,66,14,75,3,23,
+  69,0,63,53,101,3,66,14,115,3,63,82,102,3,66,14,116,3,63,81,127,31,3,63,
+  81,107,3,66,14,111,3,63,80,108,3,66,14,112,3,63,79,108,3,66,14,70,3,66,
+  14,102,3,10,66,0,66,14,1,129,0,66,14,63,55,117,3,68,14,101,3,5,129,0,
+  66,14,129,0,68,14,129,0,68,14,63,53,118,3,68,14,102,3,3,129,0,68,14,128,
+  11,68,14,129,11,68,14,63,53,118,3,68,14,102,3,3,129,187,68,14,128,0,68,14,
+  129,0,68,14,63,53,103,3,66,14,76,3,66,14,103,3,3,129,0,68,14,128,11,67,
+  14,1,129,0,66,14,63,54,102,3,71,14,75,3,66,14,100,3,4,129,0,66,14,0,
+  128,0,66,14,66,0,66,14,63,56,102,3,71,14,75,3,68,14,92,3,66,14,66,3,
+  10,128,0,66,14,66,0,66,14,63,55,103,3,71,14,75,3,68,14,91,3,68,14,66,
+  3,13,66,0,66,14,63,55,82,3,66,14,82,3,66,14,81,3,66,14,91,3,68,14,
+  66,3,0,128,0,66,14,63,70,81,3,68,14,98,3,66,14,95,3,68,14,66,3,128,
+  11,70,14,63,67,81,3,68,14,98,3,66,14,86,3,67,14,69,3,66,14,67,3,128,
+  11,71,14,63,66,81,3,68,14,98,3,66,14,86,3,72,14,71,3,128,0,71,14,6,
+  76,0,63,46,74,3,66,14,68,3,66,14,125,3,72,14,71,3,72,14,6,129,0,68,
+  14,63,52,73,3,68,14,127,8,3,69,14,67,3,66,14,128,3,71,14,7,129,187,68,
+  14,63,52,73,3,68,14,78,3,66,14,127,0,3,66,14,128,3,69,14,11,68,14,63,
+  52,73,3,68,14,78,3,66,14,85,3,66,14,89,3,66,14,73,3,66,14,128,3,0,
+  66,14,63,71,66,3,66,14,68,3,66,14,79,3,66,14,85,3,66,14,89,3,66,14,
+  77,3,63,75,66,3,66,14,82,3,66,14,90,3,66,14,89,3,66,14,77,3,63,73,
+  71,14,82,3,66,14,127,9,3,63,73,69,14,84,3,66,14,127,9,3,129,0,67,14,
+  63,67,69,14,127,33,3,129,0,67,14,63,69,67,14,127,33,3,129,0,67,14,63,69,
+  67,14,127,32,3,2,66,0,66,14,63,68,66,14,127,32,3,2,66,0,66,14,63,68,
+  108,3,66,14,114,3,5,66,14,63,68,108,3,66,14,114,3,3,88,0,63,46,129,0,
+  108,3,66,14,114,3,2,66,0,66,14,63,61,128,0,66,14,131,0,187,106,3,66,14,
+  114,3,3,129,0,68,14,63,58,70,14,130,11,11,106,3,66,14,70,3,66,14,104,3,
+  3,129,0,68,14,63,57,71,14,130,176,0,106,3,66,14,70,3,66,14,104,3,4,128,
+  0,68,14,63,57,71,14,128,11,66,0,115,3,66,14,103,3,7,66,14,63,58,70,14,
+  4,127,31,3,63,70,66,14,7,127,31,3,63,76,67,0,1,127,29,3,63,75,66,14,
+  129,0,2,127,29,3,63,75,66,14,129,187,3,127,27,3,63,76,66,14,5,127,27,3,
+  63,69,128,11,66,14,66,11,9,127,25,3,63,70,128,11,66,14,76,0,127,25,3,63,
+  68,69,14,77,0,127,10,3,66,14,73,3,63,69,69,14,13,127,10,3,66,14,73,3,
+  63,69,66,14,17,127,9,3,66,14,72,3,63,91,127,21,3,63,92,127,19,3,63,94,
+  127,17,3,63,96,127,15,3,63,97,127,15,3,63,98,127,13,3,63,100,127,11,3,63,
+  102,127,9,3,63,104,127,7,3,63,106,127,5,3,63,108,127,3,3,63,110,127,1,3,
+  63,113,101,3,66,14,83,3,63,116,100,3,66,14,82,3,63,118,99,3,66,14,81,3,
+  63,121,116,3,63,125,112,3,22,66,0,63,103,108,3,24,68,0,63,103,104,3,26,129,
+  0,66,14,63,104,66,14,98,3,28,129,0,66,14,63,103,68,14,94,3,33,66,14,3,
+  128,11,69,0,63,92,68,14,2,88,3,36,66,14,3,128,11,66,14,63,95,68,14,7,
+  78,3,48,128,0,66,14,128,0,8,127,43,0,42,66,14,30,130,0,11,39,66,14,128,
+  0,7,127,45,0,63,12,128,0,66,14,39,130,11,1,7,66,0,66,14,127,40,0,63,
+  11,128,0,66,14,41,66,14,5,129,0,68,14,128,0,66,14,63,74,129,176,98,0,66,
+  14,41,66,14,6,128,0,73,14,63,73,129,176,97,0,66,14,130,0,11,100,0,2,66,
+  14,7,73,14,63,72,66,14,97,0,66,14,129,0,66,14,49,66,14,0,68,14,63,72,
+  66,14,33,71,14,54,66,14,63,72,67,14,35,69,14,63,130,1,66,14,100,0,66,14,
+  3,128,11,92,0,63,99,66,14,42,128,0,66,14,89,0,10,128,11,127,59,0,27,66,
+  14,107,0,68,14,35,128,0,66,14,63,84,66,14,43,68,14,35,128,0,66,14,63,78,
+  130,0,11,2,66,14,43,68,14,36,66,14,127,60,0,16,132,0,187,0,0,128,11,111,
+  0,66,14,38,128,0,66,14,63,75,66,14,131,11,176,127,6,0,19,128,0,66,14,63,
+  74,72,14,127,4,0,21,66,14,127,62,0,11,72,14,63,27,127,66,0,9,72,14,63,
+  27,129,0,66,14,63,71,128,0,66,14,128,11,0,66,14,63,29,66,14,63,70,66,14,
+  130,176,11,63,33,66,14,63,69,68,14,128,11,63,170,1,68,14,128,11,63,170,1,68,
+  14,63,171,1,68,14,63,171,1,68,14,63,172,1,66,14,63,174,1,72,0,63,166,1,
+  77,0,63,162,1,81,0,63,157,1,66,14,86,0,63,149,1,68,14,127,171,1,0,68,
+  14,63,171,1,68,14,63,172,1,66,14,63,167,66,63,178,38,66,14,63,173,1,66,14,
+  63,172,1,128,0,1,128,14,63,172,1,127,153,3,0,128,9,63,175,1,128,9,63,175,
+  1,128,9,63,175,1,128,9,2,66,14,63,169,1,128,9,1,68,14,63,167,1,128,9,
+  1,70,14,63,166,1,128,9,0,71,14,63,166,1,128,9,6,129,238,63,166,1,129,9,
+  5,128,14,1,66,14,63,162,1,130,9,0,4,128,14,3,129,238,63,161,1,131,9,144,
+  69,0,3,128,14,63,118,66,14,39,128,9,0,129,144,69,0,3,128,14,63,118,66,14,
+  39,128,9,1,128,9,66,14,0,69,14,63,122,66,14,36,128,9,0,129,9,1,129,14,
+  2,127,124,0,0,67,14,35,128,9,0,129,9,1,129,14,1,128,14,63,122,129,17,0,
+  67,14,34,128,9,1,128,9,69,0,128,9,63,123,128,9,0,68,14,34,128,9,1,128,
+  9,4,128,9,63,124,128,9,0,128,0,2,67,0,31,128,9,0,128,9,3,129,153,63,
+  125,128,9,0,75,0,27,128,9,0,66,14,0,128,9,63,128,1,128,9,79,0,23,128,
+  9,68,14,63,129,1,128,9,0,81,0,19,128,9,3,129,238,63,129,1,128,9,38,129,
+  9,3,128,14,63,78,66,14,47,128,9,37,128,9,0,129,144,63,81,68,14,68,0,41,
+  128,9,37,66,14,127,82,0,68,14,66,0,17,66,14,23,128,9,35,68,14,127,81,0,
+  68,14,129,16,18,66,14,23,128,9,3,66,14,28,68,14,63,82,66,14,129,17,83,0,
+  66,14,0,66,14,19,128,9,3,66,14,3,66,14,20,128,9,1,66,14,63,84,128,1,
+  89,0,66,14,83,0,128,9,66,14,128,0,1,128,14,3,66,14,19,130,144,0,1,128,
+  14,63,109,128,0,1,67,14,19,66,14,71,0,22,130,25,9,127,85,0,26,128,0,1,
+  67,14,19,66,14,94,0,130,9,9,127,83,0,9,128,9,18,70,14,18,128,9,69,0,
+  66,14,0,85,0,128,9,0,130,9,1,63,92,128,9,19,129,9,2,129,238,17,129,9,
+  0,130,238,9,0,66,14,22,66,14,63,94,128,9,19,129,144,0,67,14,17,129,9,0,
+  130,238,9,25,128,9,63,98,128,9,19,69,14,82,0,128,9,66,14,1,67,0,128,9,
+  19,128,9,63,79,66,14,15,128,9,19,68,14,83,0,128,9,4,66,0,128,9,19,129,
+  153,73,0,63,68,68,14,14,128,9,19,67,14,128,9,81,0,71,14,1,128,9,20,129,
+  153,63,78,68,14,73,0,66,14,1,128,9,23,129,144,15,68,14,128,9,4,128,9,19,
+  129,153,63,79,68,14,73,0,68,14,0,128,9,23,128,9,15,68,14,128,9,3,128,9,
+  20,128,9,63,81,66,14,129,0,1,128,14,5,68,14,129,144,19,129,153,66,0,128,9,
+  14,68,14,128,9,66,0,128,9,20,129,153,63,83,129,0,14,129,144,19,130,144,9,1,
+  128,9,18,128,9,2,128,9,21,128,9,63,85,128,0,4,66,0,128,9,3,66,0,128,
+  9,18,69,14,128,9,18,128,9,1,128,9,21,129,153,63,86,73,14,6,128,9,17,69,
+  14,128,9,18,66,0,128,9,21,128,9,63,97,70,0,128,9,17,69,14,128,9,14,128,
+  0,4,128,9,21,128,9,63,90,129,0,13,128,9,17,66,0,130,9,9,14,131,0,153,
+  0,128,9,22,128,9,63,94,128,9,3,128,14,5,128,9,17,66,0,66,9,15,131,144,
+  144,22,128,9,63,96,68,14,70,0,128,9,16,67,0,128,9,0,128,9,78,0,66,9,
+  22,128,9,63,97,68,14,128,9,69,0,128,9,18,132,0,9,9,78,0,66,9,86,0,
+  128,9,63,98,67,14,128,9,66,0,66,14,0,128,9,14,68,0,130,9,9,78,0,129,
+  153,85,0,1,128,14,63,99,132,0,9,9,0,68,14,128,9,11,72,0,129,153,78,0,
+  128,9,86,0,1,128,14,63,100,129,0,66,9,68,14,129,144,8,70,0,66,14,130,144,
+  9,78,0,128,9,86,0,1,128,14,63,104,128,9,68,14,129,144,6,71,0,68,14,129,
+  153,76,0,66,14,85,0,128,9,63,108,128,9,66,14,66,0,128,9,3,73,0,68,14,
+  129,153,76,0,66,14,84,0,128,9,63,110,128,9,0,67,0,128,9,1,75,0,68,14,
+  129,153,76,0,2,84,0,128,9,63,111,128,9,4,128,9,77,0,2,130,144,9,77,0,
+  128,9,84,0,128,9,63,113,66,14,0,129,144,82,0,128,9,77,0,128,9,83,0,128,
+  9,103,0,63,74,66,14,66,0,128,9,81,0,128,9,77,0,128,9,83,0,128,9,103,
+  0,63,74,66,14,66,0,128,9,81,0,129,153,76,0,128,9,82,0,128,9,105,0,63,
+  73,66,0,132,153,0,9,78,0,66,14,128,9,76,0,128,9,81,0,128,9,106,0,63,
+  72,69,0,130,9,9,78,0,66,14,128,9,75,0,128,9,82,0,128,9,107,0,63,70,
+  71,0,130,9,9,77,0,66,14,128,9,75,0,128,9,81,0,128,9,108,0,63,69,73,
+  0,129,153,80,0,128,9,74,0,66,14,79,0,128,9,110,0,63,67,75,0,129,153,79,
+  0,128,9,74,0,66,14,79,0,128,9,110,0,63,66,77,0,128,9,79,0,128,9,74,
+  0,66,14,78,0,128,9,112,0,63,64,79,0,128,9,79,0,128,9,74,0,128,9,78,
+  0,128,9,113,0,63,64,80,0,128,9,66,14,75,0,128,9,74,0,128,9,78,0,128,
+  9,101,0,66,14,63,72,81,0,68,14,75,0,128,9,73,0,128,9,77,0,128,9,90,
+  0,66,14,5,129,0,0,67,14,63,70,82,0,68,14,75,0,128,9,73,0,128,9,76,
+  0,128,9,90,0,1,66,14,3,66,0,1,66,14,63,69,83,0,68,14,76,0,66,14,
+  69,0,66,14,74,0,128,9,86,0,66,14,129,0,2,129,238,3,66,0,2,129,238,63,
+  69,84,0,66,14,129,144,74,0,68,14,67,0,68,14,73,0,128,9,85,0,1,66,14,
+  128,0,2,129,238,3,67,0,1,129,238,63,68,90,0,128,9,73,0,4,67,0,68,14,
+  72,0,128,9,86,0,2,128,14,0,129,0,1,128,14,5,67,0,0,129,238,12,66,14,
+  63,52,91,0,66,14,70,0,4,67,0,68,14,71,0,128,9,86,0,128,9,2,129,238,
+  85,0,66,14,2,130,16,0,66,14,63,51,92,0,66,14,71,0,2,69,0,2,72,0,
+  128,9,84,0,131,153,0,1,128,14,0,73,9,10,128,0,1,128,14,2,130,16,0,66,
+  14,63,51,92,0,66,14,128,9,72,0,128,9,70,0,128,9,72,0,128,9,81,0,66,
+  14,128,9,81,0,69,9,4,128,0,1,130,14,0,2,128,1,63,53,97,0,128,9,72,
+  0,128,9,69,0,128,9,71,0,128,9,82,0,66,14,88,0,67,9,0,69,0,0,129,
+  238,63,54,98,0,66,14,69,0,128,9,69,0,128,9,71,0,128,9,80,0,129,153,66,
+  14,92,0,66,9,1,129,0,0,129,238,63,53,99,0,66,14,70,0,128,9,68,0,128,
+  9,70,0,128,9,79,0,129,153,107,0,63,53,99,0,66,14,128,9,69,0,128,9,68,
+  0,128,9,69,0,128,9,78,0,129,153,110,0,63,51,104,0,128,9,69,0,128,9,67,
+  0,128,9,69,0,128,9,76,0,129,153,112,0,63,51,105,0,128,9,66,14,130,0,9,
+  67,0,128,9,68,0,128,9,74,0,66,9,114,0,63,51,106,0,66,14,66,0,128,9,
+  66,0,128,9,67,0,128,9,73,0,129,153,117,0,63,50,107,0,66,14,66,0,128,9,
+  66,0,129,9,66,14,128,9,71,0,129,153,120,0,63,49,110,0,128,9,66,0,131,9,
+  144,2,129,238,69,0,129,153,102,0,66,14,0,129,0,0,129,238,1,129,0,0,129,238,
+  63,53,111,0,134,9,144,0,9,3,128,14,67,0,129,153,103,0,1,66,14,128,0,2,
+  131,238,0,2,129,238,63,51,113,0,133,9,144,144,3,132,14,144,9,105,0,2,128,14,
+  0,128,9,2,131,238,0,2,129,238,63,51,114,0,133,9,9,9,2,130,144,9,98,0,
+  72,9,2,128,14,0,128,9,2,131,238,0,2,129,238,63,51,101,0,66,14,74,0,68,
+  9,131,0,153,98,0,129,153,73,0,1,130,14,0,1,129,238,1,129,0,0,129,238,63,
+  52,100,0,68,14,128,0,2,71,0,68,9,97,0,66,9,74,0,129,153,1,129,0,0,
+  129,238,0,66,0,66,14,63,53,100,0,68,14,128,0,2,76,9,128,0,3,129,238,87,
+  0,66,9,129,0,0,129,238,71,0,128,9,3,129,0,0,129,238,0,66,0,66,14,63,
+  52,93,0,71,9,68,14,128,9,2,69,0,130,153,0,68,9,3,129,238,85,0,129,153,
+  67,0,2,129,238,68,0,129,153,10,66,0,66,14,63,52,81,0,66,14,70,0,129,153,
+  72,0,66,14,71,0,66,9,135,0,153,144,144,69,14,69,9,76,0,66,9,69,0,2,
+  129,238,66,0,128,9,1,128,14,63,69,80,0,68,14,67,0,129,153,83,0,129,153,68,
+  0,130,153,0,2,129,0,66,9,70,0,69,9,68,0,129,153,72,0,2,132,238,144,9,
+  4,128,0,66,14,63,64,80,0,68,14,131,0,153,82,0,66,9,69,0,131,9,9,2,
+  68,0,129,153,74,0,68,9,128,0,2,128,14,70,0,0,129,238,67,9,6,66,14,63,
+  63,80,0,68,14,129,153,82,0,129,153,72,0,131,9,9,2,70,0,66,9,75,0,129,
+  153,5,129,0,66,14,129,153,68,0,6,66,14,63,63,72,0,66,14,69,0,66,14,128,
+  9,81,0,66,9,73,0,131,9,144,67,0,128,9,72,0,66,9,74,0,5,129,153,66,
+  14,70,0,6,66,14,67,9,1,129,0,2,129,238,63,50,71,0,68,14,68,0,129,153,
+  81,0,129,153,76,0,131,9,144,67,0,128,9,75,0,129,153,73,0,129,153,2,129,0,
+  66,14,70,0,5,66,14,4,67,9,2,129,238,63,50,71,0,68,14,66,0,129,153,80,
+  0,66,9,78,0,131,9,144,68,0,128,9,76,0,66,9,66,0,67,9,66,0,129,153,
+  72,0,73,14,8,129,0,2,129,238,63,50,71,0,68,14,130,144,9,76,0,66,14,66,
+  9,80,0,128,9,66,0,128,9,69,0,128,9,78,0,66,9,72,0,129,153,70,0,66,
+  14,128,0,0,129,238,63,69,72,0,66,14,129,153,78,0,66,14,83,0,128,9,66,0,
+  128,9,70,0,128,9,84,0,0,129,238,67,0,129,153,68,0,66,14,63,73,128,0,66,
+  14,66,0,68,9,78,0,129,153,66,14,82,0,128,9,67,0,128,9,71,0,128,9,83,
+  0,0,129,238,69,0,129,153,96,0,63,43,70,14,66,9,130,0,9,75,0,66,14,129,
+  153,87,0,128,9,66,0,66,14,70,0,128,9,83,0,66,14,71,0,128,9,95,0,63,
+  42,71,14,67,0,128,9,76,0,66,14,89,0,128,9,66,0,66,14,71,0,128,9,93,
+  0,129,153,94,0,63,42,68,14,69,0,128,9,75,0,129,153,66,14,88,0,128,9,67,
+  0,66,14,72,0,128,9,93,0,129,153,68,0,1,66,14,63,62,70,14,67,0,128,9,
+  72,0,66,9,93,0,128,9,68,0,128,9,74,0,128,9,92,0,130,9,9,1,129,0,
+  1,66,14,63,64,68,14,66,0,128,9,71,0,129,153,95,0,128,9,69,0,128,9,75,
+  0,128,9,92,0,128,9,0,128,9,2,68,14,63,64,68,14,130,0,9,69,0,66,9,
+  97,0,128,9,69,0,128,9,75,0,128,9,92,0,128,9,1,128,9,2,66,0,66,14,
+  63,65,66,0,128,9,67,0,67,9,98,0,128,9,70,0,128,9,76,0,128,9,92,0,
+  128,9,4,66,0,66,14,63,65,132,0,9,0,66,9,130,0,9,99,0,128,9,70,0,
+  128,9,77,0,128,9,91,0,128,9,7,66,14,63,65,128,0,67,9,67,0,128,9,98,
+  0,2,70,0,128,9,78,0,128,9,91,0,128,9,3,86,0,63,42,68,0,66,9,69,
+  0,128,9,99,0,1,128,14,70,0,128,9,78,0,128,9,97,0,63,64,66,0,129,153,
+  0,128,9,69,0,128,9,100,0,1,128,14,70,0,128,9,79,0,128,9,95,0,3,128,
+  14,63,55,69,14,130,144,0,0,128,9,0,67,0,129,153,101,0,128,9,72,0,128,9,
+  80,0,128,9,94,0,3,128,14,63,54,70,14,131,9,144,2,130,0,9,101,0,66,14,
+  71,0,2,80,0,128,9,93,0,2,129,238,63,54,70,14,71,0,128,9,102,0,66,14,
+  71,0,66,14,81,0,128,9,93,0,66,14,63,55,69,14,7,128,9,103,0,66,14,71,
+  0,66,14,81,0,128,9,114,0,63,38,66,14,128,9,7,128,9,0,104,0,128,9,73,
+  0,128,9,83,0,128,9,113,0,63,40,128,9,2,68,0,128,9,1,103,0,128,9,74,
+  0,128,9,84,0,128,9,111,0,63,40,128,9,1,66,14,128,0,66,9,3,102,0,128,
+  9,74,0,128,9,85,0,128,9,110,0,63,39,128,9,2,66,14,129,153,5,101,0,128,
+  9,75,0,128,9,85,0,128,9,110,0,63,38,68,9,66,14,8,100,0,128,9,75,0,
+  128,9,86,0,128,9,109,0,63,34,67,9,66,14,128,9,12,100,0,128,9,75,0,128,
+  9,87,0,128,9,107,0,63,32,66,9,0,129,153,3,113,0,128,9,76,0,128,9,88,
+  0,128,9,106,0,63,34,128,9,70,14,113,0,128,9,76,0,128,9,88,0,1,128,14,
+  104,0,63,35,69,14,16,96,0,128,9,77,0,128,9,88,0,1,128,14,103,0,63,36,
+  66,14,19,96,0,128,9,77,0,128,9,88,0,66,14,103,0,63,60,94,0,128,9,78,
+  0,128,9,91,0,128,9,102,0,63,61,93,0,128,9,78,0,128,9,92,0,128,9,100,
+  0,63,63,92,0,128,9,78,0,128,9,93,0,128,9,99,0,63,63,91,0,128,9,79,
+  0,128,9,93,0,128,9,98,0,63,65,90,0,128,9,80,0,128,9,93,0,128,9,63,
+  100,88,0,128,9,81,0,128,9,94,0,128,9,63,100,87,0,128,9,82,0,128,9,94,
+  0,128,9,63,100,86,0,128,9,82,0,128,9,94,0,128,9,63,101,84,0,128,9,84,
+  0,128,9,94,0,128,9,63,101,83,0,128,9,84,0,128,9,95,0,128,9,63,101,81,
+  0,128,9,86,0,128,9,95,0,129,153,63,101,79,0,128,9,86,0,128,9,97,0,128,
+  9,63,101,77,0,128,9,88,0,128,9,97,0,129,153,63,100,76,0,128,9,86,0,1,
+  129,158,98,0,128,9,63,101,73,0,129,153,86,0,66,14,128,9,99,0,129,153,63,101,
+  71,0,128,9,87,0,66,14,129,144,100,0,129,153,63,101,68,0,129,153,91,0,128,9,
+  102,0,128,9,63,102,131,0,153,93,0,128,9,102,0,129,153,63,101,130,144,9,93,0,
+  128,9,104,0,71,9,63,92,131,144,144,94,0,128,9,33,128,0,1,128,14,2,128,9,
+  5,72,9,63,86,95,0,128,9,33,128,0,1,128,14,2,128,9,63,97,68,14,95,0,
+  128,9,33,67,14,63,100,68,14,32,128,9,33,66,14,63,99,128,9,68,14,31,130,0,
+  9,32,66,14,3,128,9,12,127,43,0,37,128,9,0,66,14,35,128,9,39,128,9,77,
+  0,1,128,14,127,39,0,35,128,9,1,128,9,38,128,9,38,128,9,76,0,4,127,39,
+  0,34,128,9,1,128,9,33,128,0,1,128,14,0,128,9,39,129,9,0,129,238,5,129,
+  0,4,129,0,0,129,238,63,68,128,9,0,130,0,9,33,69,0,128,9,98,0,4,128,
+  9,66,14,6,128,0,1,66,14,128,0,1,66,14,63,66,128,9,38,128,0,2,128,0,
+  41,128,9,66,14,8,66,14,129,0,0,67,14,63,66,128,9,0,128,0,37,66,14,128,
+  0,2,128,9,38,128,9,15,68,14,63,65,128,9,4,128,14,34,70,14,0,128,9,38,
+  128,9,15,66,14,63,65,128,9,1,128,9,40,66,14,2,92,0,10,128,9,63,84,128,
+  9,0,129,9,1,128,14,37,66,14,1,128,0,2,88,0,12,128,9,127,59,0,22,128,
+  9,0,128,9,0,129,144,108,0,41,128,9,1,128,14,63,79,129,153,1,128,9,109,0,
+  41,128,0,1,128,14,63,78,129,153,1,66,14,44,68,14,37,66,14,127,60,0,15,66,
+  0,128,9,1,66,14,45,66,14,39,128,0,1,128,14,63,73,128,0,2,130,9,9,1,
+  128,14,63,25,128,0,1,128,14,63,81,127,3,0,24,66,14,63,81,127,2,0,27,127,
+  65,0,8,71,14,127,0,0,29,127,67,0,5,129,0,0,130,238,9,66,14,63,30,129,
+  0,0,129,238,63,67,68,0,129,153,66,14,63,32,66,14,63,70,131,0,153,66,14,63,
+  32,66,14,63,66,68,14,130,144,9,63,168,1,68,14,128,1,63,170,1,68,14,128,0,
+  63,170,1,68,14,63,171,1,68,14,63,172,1,66,14,63,157,3,89,0,63,149,1,127,
+  160,3,0,2,127,172,1,0,68,14,63,171,1,68,14,63,171,1,68,14,63,172,1,66,
+  14,63,216,60,63,227,32,66,14,63,173,1,66,14,63,173,1,66,14,63,172,1,127,232,
+  8,0,5,66,14,63,172,1,68,14,63,171,1,68,14,63,169,1,70,14,63,168,1,71,
+  14,63,175,1,128,14,63,167,1,128,0,8,66,14,63,163,1,129,0,7,66,14,63,163,
+  1,130,0,9,69,0,2,129,238,63,117,66,14,42,128,9,70,0,3,128,14,63,117,69,
+  14,46,128,0,3,128,14,63,120,67,14,40,66,14,0,69,14,63,118,129,0,0,67,14,
+  39,128,0,1,129,14,2,127,123,0,3,128,14,39,128,0,1,129,14,1,128,14,63,123,
+  128,0,2,100,0,3,127,115,0,15,128,1,102,0,63,136,1,128,0,70,1,34,66,14,
+  63,131,1,70,0,33,68,14,63,174,1,129,238,63,170,1,128,0,3,128,14,63,76,66,
+  14,63,27,128,0,3,128,14,63,75,68,14,20,66,14,63,1,69,14,63,76,68,14,20,
+  66,14,29,66,14,30,68,14,127,78,0,68,14,69,0,14,66,14,29,66,14,29,128,9,
+  1,66,14,63,82,68,0,17,90,0,1,69,14,28,129,9,2,129,238,63,79,69,0,19,
+  67,0,66,14,21,66,14,71,0,66,14,20,130,9,9,1,128,14,63,81,66,0,21,129,
+  0,0,67,14,21,66,14,71,0,1,128,14,20,129,144,127,87,0,24,69,14,19,75,0,
+  1,128,14,21,128,9,127,85,0,52,129,9,0,129,238,5,86,0,63,116,66,0,22,129,
+  9,0,129,238,1,66,14,63,140,1,129,144,25,66,14,63,146,1,69,14,82,0,1,66,
+  0,27,128,9,1,128,14,63,73,66,14,37,69,14,82,0,6,88,0,0,128,0,1,128,
+  14,63,72,68,14,36,68,14,82,0,69,14,27,128,9,1,128,14,63,72,68,14,128,0,
+  9,66,14,26,129,144,16,73,14,63,101,68,14,128,1,73,0,66,14,26,128,0,17,68,
+  14,129,144,1,128,14,63,102,67,14,74,0,68,14,22,128,9,66,0,22,128,0,1,128,
+  14,63,103,131,16,0,0,66,14,6,128,0,2,128,0,19,66,14,129,9,21,128,0,0,
+  67,0,63,104,66,0,68,14,5,128,0,2,128,0,19,66,14,23,128,0,63,112,68,14,
+  75,0,18,69,14,63,134,1,69,14,0,66,14,26,128,0,3,128,0,15,128,0,63,122,
+  128,0,2,128,9,25,128,0,3,128,0,15,128,0,63,118,128,0,2,128,0,2,128,9,
+  25,66,0,130,153,0,16,130,144,9,63,118,128,0,4,128,9,63,170,1,69,14,128,9,
+  63,169,1,69,14,128,9,63,170,1,68,14,128,0,2,66,14,18,66,14,42,66,14,63,
+  98,131,0,9,1,68,14,16,68,14,15,66,14,63,130,1,68,14,128,0,15,68,14,15,
+  66,14,63,130,1,68,14,128,0,15,68,14,15,66,14,22,128,9,95,0,63,78,66,0,
+  18,129,0,14,130,0,9,63,132,1,69,0,14,68,0,14,130,0,9,63,153,1,68,0,
+  14,129,144,85,0,63,112,66,14,17,67,0,63,151,1,66,14,66,0,63,170,1,66,14,
+  67,0,15,66,14,63,151,1,130,0,9,18,66,14,63,173,1,66,14,128,9,63,173,1,
+  130,0,9,11,66,14,63,158,1,66,0,11,66,14,63,157,3,129,144,80,0,63,128,1,
+  66,14,25,129,144,79,0,63,128,1,68,14,63,20,66,14,63,84,68,14,77,0,55,66,
+  14,7,129,0,0,67,14,63,83,68,14,128,9,77,0,9,66,14,43,129,238,5,66,0,
+  1,66,14,63,84,66,14,130,0,9,76,0,66,14,5,68,14,35,66,14,128,0,3,128,
+  14,5,66,0,1,66,14,63,86,67,0,128,9,10,68,14,4,68,14,33,128,0,1,71,
+  14,5,67,0,0,129,238,63,88,67,0,66,14,7,68,14,68,0,37,129,0,2,128,14,
+  0,128,0,10,66,0,0,129,238,13,66,14,63,75,66,14,7,68,14,69,0,2,73,0,
+  23,129,0,2,129,238,90,0,1,66,0,66,14,63,75,66,14,128,9,71,0,2,71,0,
+  128,9,73,0,24,66,9,1,128,14,20,129,0,0,129,238,3,66,0,66,14,63,77,130,
+  0,9,7,130,0,9,5,129,144,73,0,19,66,14,2,67,0,21,129,0,0,129,238,3,
+  127,21,0,61,66,0,46,129,0,0,129,238,28,129,0,0,130,238,0,1,128,14,63,87,
+  66,14,42,129,153,0,129,238,33,128,0,1,128,14,63,87,66,14,70,0,35,95,0,6,
+  128,0,1,128,14,63,87,66,14,128,9,63,173,1,66,0,63,162,3,66,14,66,0,63,
+  170,1,66,14,67,0,5,66,14,63,160,1,66,14,128,9,7,68,14,63,223,1,129,0,
+  0,129,238,0,66,0,66,14,0,129,0,0,129,238,63,157,1,129,0,2,128,14,0,129,
+  0,1,66,14,128,0,2,129,238,63,105,128,0,2,66,0,43,129,144,2,128,14,0,129,
+  153,1,66,14,128,0,2,129,238,63,106,128,9,66,0,45,129,9,2,128,14,0,129,0,
+  1,66,14,128,0,2,129,238,63,85,66,14,76,0,55,129,144,0,130,238,0,2,66,14,
+  0,129,0,0,129,238,63,85,68,14,129,0,66,14,72,0,58,128,0,1,128,14,2,66,
+  0,66,14,63,85,68,14,129,0,66,14,77,9,3,128,0,1,128,14,27,128,0,1,128,
+  14,13,128,0,1,128,14,2,66,0,66,14,63,85,68,14,129,153,66,14,70,0,10,128,
+  9,1,128,14,26,128,0,3,128,14,19,66,0,66,14,63,65,66,14,72,0,8,66,14,
+  73,0,13,128,0,1,128,14,26,128,0,3,128,14,2,128,9,1,128,14,63,83,68,14,
+  69,0,31,128,9,67,0,31,128,0,3,128,14,1,128,0,3,130,14,0,0,129,238,63,
+  77,68,14,67,0,33,128,0,1,128,14,22,128,0,2,128,14,5,128,0,1,128,14,2,
+  128,9,4,128,0,2,129,238,63,76,68,14,129,0,35,128,0,1,128,14,22,128,0,4,
+  128,14,0,128,0,67,9,4,128,0,4,128,9,2,129,238,63,70,70,0,66,14,129,144,
+  37,66,14,22,128,9,4,128,14,0,129,9,0,129,238,4,129,0,7,129,238,5,129,0,
+  2,128,14,63,56,66,14,71,0,63,6,128,9,1,128,14,0,129,0,0,129,238,4,129,
+  0,6,129,238,6,129,0,2,128,14,63,55,68,14,68,0,63,15,66,14,1,129,0,7,
+  66,14,7,129,0,2,128,14,63,55,68,14,66,0,14,66,0,63,4,129,0,0,128,14,
+  0,128,0,0,129,238,63,73,68,14,128,0,14,66,14,129,153,53,70,0,6,129,0,0,
+  129,238,63,70,66,14,68,0,66,14,16,66,14,84,0,34,66,0,66,14,63,81,129,0,
+  2,68,9,14,66,0,1,66,14,24,129,144,71,0,20,66,0,66,14,63,77,72,14,69,
+  0,10,66,14,66,9,29,129,144,72,0,22,66,14,63,77,69,14,71,0,11,66,14,91,
+  0,4,129,144,73,0,37,88,0,63,39,69,14,71,0,11,66,14,32,66,14,46,129,0,
+  2,129,238,63,60,69,14,67,0,48,66,14,46,129,0,2,129,238,63,60,69,14,66,0,
+  49,66,14,48,68,14,63,63,66,14,63,43,66,0,66,14,63,170,1,66,0,66,14,63,
+  107,130,0,9,62,66,14,63,106,66,14,71,0,50,129,0,0,129,238,63,56,69,0,46,
+  66,14,71,0,49,129,0,2,129,238,63,53,70,0,47,66,14,57,129,0,2,129,238,63,
+  51,68,14,66,0,47,130,0,9,7,129,144,81,0,30,129,0,2,129,238,63,50,70,14,
+  129,144,47,129,144,72,0,51,129,0,0,129,238,63,51,70,14,128,9,47,66,14,72,0,
+  63,108,70,14,48,66,14,8,66,14,63,106,68,14,49,66,14,63,124,67,0,63,170,1,
+  66,14,67,9,63,169,1,66,14,128,9,110,0,63,122,66,9,66,14,63,172,1,114,0,
+  63,117,66,14,128,0,3,114,0,39,129,144,105,0,63,33,66,14,128,0,63,31,128,0,
+  1,128,14,63,73,66,14,128,0,0,129,238,63,28,128,0,1,128,14,63,173,1,66,14,
+  63,213,23,66,0,63,141,5,66,14,63,183,5,69,0,63,99,130,9,9,63,4,69,0,
+  0,68,0,63,92,131,144,144,96,0,34,129,0,1,128,14,1,128,9,1,128,14,63,96,
+  128,9,97,0,34,128,0,1,128,14,1,128,0,1,128,14,63,92,68,14,98,0,33,128,
+  0,1,129,238,1,66,14,63,92,68,14,63,7,66,14,17,127,42,0,36,68,14,63,7,
+  66,14,16,127,44,0,36,66,14,63,17,77,0,1,128,14,0,127,38,0,63,56,76,0,
+  2,128,14,0,127,39,0,33,129,144,105,0,128,9,39,129,0,0,129,238,6,128,0,1,
+  66,14,129,0,1,128,14,63,68,129,144,103,0,44,66,14,7,68,14,128,0,2,129,238,
+  63,69,99,0,2,128,0,44,66,14,8,66,14,0,128,0,1,66,14,63,65,67,14,35,
+  66,14,128,0,0,129,238,58,68,14,63,65,67,14,35,68,14,2,91,0,30,66,14,63,
+  66,66,14,38,66,14,1,129,0,40,127,61,0,63,3,66,14,1,128,0,3,128,14,36,
+  128,9,1,128,14,63,81,128,9,111,0,3,128,14,36,128,0,1,128,14,63,81,128,9,
+  111,0,2,129,238,37,66,14,127,61,0,13,66,0,1,66,14,111,0,66,14,39,128,0,
+  1,128,14,63,72,67,0,129,9,1,128,14,63,27,128,0,1,128,14,63,75,128,9,3,
+  128,14,63,28,66,14,63,71,71,14,127,1,0,63,103,71,14,126,0,33,127,67,0,3,
+  71,14,124,0,35,127,69,0,0,129,1,0,129,238,0,66,14,122,0,37,129,0,0,129,
+  238,63,64,132,0,17,0,1,66,14,63,35,66,14,63,64,67,0,128,1,1,66,14,63,
+  35,66,14,63,68,128,0,63,170,1,68,14,68,0,63,166,1,68,14,71,0,63,163,1,
+  68,14,63,171,1,68,14,63,171,1,68,14,63,172,1,66,14,63,157,3,127,143,5,0,
+  2,127,172,1,0,68,14,63,171,1,68,14,63,171,1,68,14,63,172,1,66,14,63,137,
+  55,63,245,30,66,13,63,171,1,129,0,66,13,63,171,1,129,0,66,13,63,171,1,127,
+  254,6,0,66,13,63,172,1,68,13,63,171,1,68,13,63,170,1,128,0,68,13,63,169,
+  1,70,13,63,168,1,71,13,63,167,1,128,0,71,13,0,66,13,63,163,1,128,0,71,
+  13,0,66,13,63,163,1,129,144,66,13,67,0,68,13,63,117,66,13,42,128,9,70,0,
+  68,13,63,117,68,13,47,128,0,68,13,63,116,128,0,69,13,41,66,13,1,129,0,66,
+  13,63,117,129,0,68,13,41,69,13,127,123,0,68,13,40,128,0,69,13,127,124,0,66,
+  13,100,0,4,67,0,66,13,63,123,104,0,4,127,171,1,0,63,179,1,66,13,63,172,
+  1,68,13,63,170,1,128,9,68,13,63,99,66,13,63,4,128,9,68,13,63,74,66,13,
+  21,66,13,63,3,69,13,63,74,68,13,20,66,13,30,66,13,31,68,13,127,76,0,68,
+  13,74,0,10,90,0,2,69,13,31,68,13,127,76,0,68,13,72,0,12,90,0,2,69,
+  13,30,128,0,68,13,63,77,66,13,71,0,14,67,0,66,13,22,66,13,84,0,12,129,
+  144,66,13,63,79,71,0,18,68,13,22,74,0,66,13,22,129,144,127,88,0,20,68,13,
+  84,0,1,74,0,66,13,23,127,87,0,22,66,13,86,0,1,128,0,66,13,6,66,13,
+  63,135,1,129,0,67,13,21,66,13,2,66,13,0,84,0,63,117,129,0,68,13,20,66,
+  13,2,66,13,63,141,1,68,13,20,69,0,66,13,63,97,66,13,39,69,13,20,94,0,
+  0,66,13,63,70,68,13,38,68,13,82,0,69,13,1,89,0,0,66,13,63,70,68,13,
+  69,0,32,67,13,128,9,81,0,70,13,28,66,13,63,70,68,13,67,0,7,66,13,23,
+  128,0,66,13,128,9,17,73,13,25,70,0,63,67,67,13,66,0,8,66,13,67,0,20,
+  66,13,18,68,13,129,144,66,13,63,101,66,13,129,0,9,68,13,20,66,13,129,9,18,
+  67,13,128,0,1,66,13,63,102,66,0,128,1,67,13,6,128,0,66,13,128,0,19,66,
+  13,20,67,13,128,0,1,67,0,63,105,68,13,6,66,13,66,0,17,69,13,17,67,13,
+  63,112,68,13,76,0,18,129,0,67,13,16,128,0,66,13,63,112,69,13,0,66,13,26,
+  129,0,67,13,16,128,0,66,13,63,113,72,13,128,9,27,128,0,66,13,17,130,144,0,
+  63,114,128,0,70,13,128,0,27,131,0,9,17,130,144,9,63,116,128,0,68,13,128,0,
+  63,170,1,70,13,63,170,1,69,13,128,0,45,66,13,63,121,129,0,66,13,128,0,2,
+  66,13,18,66,13,17,66,13,23,66,13,63,95,66,0,129,9,1,68,13,16,68,13,16,
+  66,13,22,128,0,66,13,63,102,68,13,128,0,15,68,13,128,0,15,130,0,9,22,128,
+  0,66,13,63,102,68,13,128,0,15,68,13,128,0,15,130,0,9,22,128,9,95,0,63,
+  74,66,13,67,0,14,66,13,66,0,14,130,0,9,63,131,1,69,0,15,68,0,63,134,
+  3,66,13,63,173,1,66,13,67,0,15,66,13,63,150,1,66,13,67,0,15,66,13,63,
+  151,1,130,0,9,18,66,13,128,0,63,173,1,66,0,12,66,13,63,157,1,66,0,12,
+  66,13,63,173,1,66,13,63,173,1,129,144,81,0,63,125,66,13,27,129,144,80,0,63,
+  125,68,13,63,171,1,68,13,78,0,63,9,66,13,63,80,68,13,79,0,10,66,13,55,
+  128,0,68,13,63,80,66,13,129,144,78,0,9,68,13,40,129,0,66,13,7,129,0,68,
+  13,63,81,67,0,128,9,14,66,13,5,68,13,37,66,13,128,0,68,13,6,129,0,68,
+  13,63,82,68,0,12,68,13,4,68,13,35,128,0,73,13,6,66,0,66,13,63,89,66,
+  13,8,68,13,4,128,0,66,13,74,0,24,129,0,73,13,7,129,0,66,13,63,89,66,
+  13,72,0,68,13,4,130,0,9,75,0,24,129,0,68,13,128,0,66,13,8,74,0,5,
+  66,0,66,13,63,71,66,13,73,0,66,13,71,0,128,9,74,0,25,66,0,66,13,30,
+  66,0,66,13,63,72,130,0,9,8,130,0,9,40,66,13,2,129,153,88,0,66,13,5,
+  66,0,66,13,63,126,129,0,66,13,28,128,0,66,13,63,89,66,13,45,129,153,66,13,
+  28,128,0,66,13,128,0,66,13,63,85,66,13,71,0,37,89,0,11,128,0,66,13,63,
+  85,66,13,71,0,63,12,128,0,66,13,63,86,130,0,9,63,162,3,66,13,63,173,1,
+  66,13,67,0,7,66,13,63,158,1,66,13,68,0,5,68,13,63,158,1,130,0,9,8,
+  128,0,68,13,63,170,1,128,0,68,13,47,129,0,66,13,1,129,0,66,13,0,129,0,
+  66,13,63,104,129,0,66,13,47,129,0,68,13,129,0,68,13,128,0,68,13,63,104,129,
+  144,67,0,45,129,153,68,13,129,9,68,13,128,0,68,13,63,156,1,129,0,68,13,129,
+  0,68,13,128,0,68,13,63,80,66,13,79,0,57,129,9,69,13,128,0,66,13,0,129,
+  0,66,13,63,80,68,13,66,0,66,13,74,0,59,128,0,66,13,4,129,0,66,13,63,
+  80,68,13,66,0,66,13,79,9,0,128,0,66,13,89,0,5,129,0,66,13,12,128,0,
+  66,13,4,129,0,66,13,63,80,68,13,66,9,66,13,72,0,7,128,9,66,13,129,9,
+  66,13,25,129,0,68,13,20,129,0,66,13,63,62,66,13,73,0,5,66,13,76,0,10,
+  128,9,66,13,129,144,66,13,25,129,0,68,13,1,88,0,63,60,68,13,70,0,40,66,
+  13,25,129,0,68,13,0,128,0,66,13,67,0,66,13,63,75,68,13,68,0,34,128,9,
+  69,0,19,128,0,66,13,6,129,144,66,13,1,68,13,0,128,0,68,13,63,74,68,13,
+  66,0,36,128,0,66,13,22,128,0,66,13,67,0,9,68,13,0,128,0,68,13,63,75,
+  66,13,128,0,39,128,0,66,13,22,128,9,66,13,128,9,66,13,0,129,0,66,13,3,
+  75,13,6,128,0,68,13,63,53,66,13,72,0,41,66,13,25,129,9,66,13,0,129,0,
+  66,13,4,73,13,7,128,0,68,13,63,52,68,13,69,0,63,11,66,13,0,129,0,66,
+  13,1,129,0,74,13,7,128,0,68,13,63,52,68,13,67,0,63,24,129,0,74,13,63,
+  66,68,13,128,0,14,66,13,128,0,63,8,129,0,66,13,0,66,13,63,64,70,0,66,
+  13,66,9,13,66,13,128,9,58,69,0,63,78,66,13,129,0,23,66,13,85,0,37,129,
+  0,66,13,63,75,128,0,69,13,71,0,10,66,0,63,3,129,0,66,13,63,72,66,13,
+  128,0,69,13,16,66,13,129,153,63,5,66,13,63,72,66,13,128,0,66,13,73,0,9,
+  66,13,93,0,4,129,144,74,0,38,129,0,66,13,63,54,66,13,0,66,13,128,0,66,
+  13,68,0,10,66,13,34,129,144,75,0,37,129,0,69,13,63,55,66,13,128,0,66,13,
+  67,0,49,66,13,48,129,0,69,13,63,55,66,13,0,66,13,66,0,50,66,13,53,66,
+  13,63,116,66,13,53,129,0,66,13,63,171,1,129,0,66,13,63,104,130,0,9,60,68,
+  0,66,13,63,104,66,13,59,66,0,66,13,63,107,66,13,59,129,0,68,13,63,48,66,
+  13,69,0,48,66,13,59,129,0,68,13,63,47,69,13,66,0,59,129,144,82,0,32,128,
+  0,68,13,63,47,69,13,129,0,48,130,0,9,8,66,13,52,66,13,63,48,69,13,129,
+  144,48,130,0,9,8,66,13,63,104,68,13,129,144,49,66,13,8,66,13,63,105,66,13,
+  52,66,13,63,122,129,0,68,9,43,66,13,63,120,66,13,66,9,63,170,1,66,13,113,
+  0,63,120,69,13,63,166,1,129,144,68,13,115,0,63,116,71,13,114,0,41,128,9,104,
+  0,63,33,69,13,116,0,41,66,13,63,72,66,13,63,34,66,13,63,173,1,66,13,63,
+  213,23,66,0,63,173,1,66,13,63,173,1,66,13,63,173,1,66,13,63,169,7,68,0,
+  0,66,0,63,93,130,9,0,63,7,128,0,66,13,1,128,9,66,13,63,91,131,9,144,
+  99,0,34,128,0,66,13,1,128,9,66,13,63,91,128,9,66,13,100,0,34,66,13,2,
+  66,13,63,91,68,13,32,66,13,34,128,0,66,13,63,96,68,13,32,66,13,35,66,13,
+  18,127,42,0,34,68,13,32,66,13,35,66,13,17,127,44,0,34,66,13,63,19,77,0,
+  66,13,0,127,38,0,63,11,66,0,41,76,0,68,13,128,0,66,13,63,66,129,144,104,
+  0,66,13,41,129,0,66,13,6,128,0,73,13,63,64,128,9,66,13,35,67,0,66,13,
+  43,66,13,7,73,13,63,64,67,13,35,128,0,69,13,43,66,13,8,66,13,0,68,13,
+  63,64,67,13,36,66,13,93,0,33,66,13,63,65,66,13,37,67,13,2,128,0,66,13,
+  84,0,17,127,61,0,63,2,66,13,2,68,13,37,128,0,66,13,63,123,66,13,2,68,
+  13,37,128,0,66,13,63,79,128,9,112,0,68,13,38,66,13,127,61,0,17,128,9,113,
+  0,66,13,40,128,0,66,13,63,71,66,0,0,128,9,66,13,127,2,0,26,128,0,66,
+  13,63,70,66,13,129,144,67,13,63,30,66,13,63,69,68,13,128,9,67,13,63,166,1,
+  68,13,128,9,66,13,63,167,1,68,13,0,128,9,124,0,39,127,69,0,66,13,0,66,
+  13,121,0,41,127,71,0,1,66,13,119,0,43,128,0,66,13,63,63,69,0,66,13,63,
+  37,66,13,63,62,70,0,66,13,63,37,66,13,63,62,68,13,63,170,1,69,13,63,170,
+  1,69,13,63,170,1,68,13,87,0,63,147,1,68,13,63,171,1,68,13,63,172,1,66,
+  13,63,141,5,127,159,3,0,66,13,127,172,1,0,68,13,127,171,1,0,68,13,63,171,
+  1,68,13,63,172,1,66,13,63,170,51,63,150,27,66,13,63,173,1,66,13,63,172,1,
+  128,0,1,128,13,63,172,1,127,253,6,0,66,13,63,172,1,68,13,63,174,1,129,221,
+  63,170,1,128,0,3,128,13,63,170,1,129,0,2,128,13,63,169,1,66,13,128,0,1,
+  128,13,63,175,1,128,13,63,167,1,128,0,6,128,13,0,66,13,63,163,1,128,0,6,
+  68,13,63,117,68,13,40,129,9,2,66,0,68,13,63,117,69,13,40,70,0,63,125,66,
+  13,63,170,1,128,0,3,128,13,42,66,13,1,128,0,2,127,120,0,2,100,0,5,128,
+  0,1,67,13,127,163,1,0,5,128,0,4,128,13,63,122,104,0,5,67,0,1,128,13,
+  63,123,103,0,8,127,167,1,0,63,180,1,66,13,63,175,1,129,221,63,97,66,13,63,
+  6,128,9,3,128,13,63,72,66,13,21,66,13,63,11,128,13,63,71,68,13,20,66,13,
+  88,0,3,69,13,33,69,13,63,72,68,13,21,91,0,2,69,13,32,128,0,63,78,68,
+  13,77,0,7,91,0,2,69,13,31,129,0,2,129,221,63,77,76,0,40,83,0,17,130,
+  144,9,1,128,13,63,75,77,0,16,66,13,22,85,0,15,129,144,127,91,0,15,69,13,
+  22,74,0,66,13,24,127,90,0,17,69,13,23,66,13,63,143,1,66,13,128,0,1,128,
+  13,22,66,13,63,144,1,129,0,0,67,13,27,66,13,0,82,0,63,120,68,13,21,69,
+  0,63,142,1,69,13,83,0,1,69,0,63,97,67,13,40,68,13,84,0,7,89,0,66,
+  13,63,68,68,13,73,0,29,67,13,128,9,83,0,66,13,63,103,68,13,72,0,34,128,
+  9,82,0,70,13,63,100,69,13,70,0,4,66,13,22,68,13,128,0,25,66,13,25,128,
+  9,68,0,63,66,68,13,68,0,6,66,13,68,0,17,66,13,130,9,0,63,132,1,128,
+  0,66,13,7,66,13,68,0,17,66,13,130,144,0,22,128,0,63,106,66,0,68,13,6,
+  129,0,23,66,0,27,67,0,63,103,69,13,31,129,0,0,129,221,63,134,1,69,13,30,
+  129,0,2,128,0,17,128,0,63,114,69,13,32,68,13,63,139,1,67,13,28,128,0,20,
+  130,144,0,63,113,130,0,9,63,175,1,128,0,63,176,1,68,13,128,0,48,66,13,63,
+  125,128,0,24,66,13,18,66,13,63,120,129,0,2,128,0,2,66,13,17,68,13,63,143,
+  1,66,13,128,0,1,68,13,16,68,13,17,129,0,66,9,63,126,68,13,128,0,15,68,
+  13,128,0,16,129,0,66,9,63,126,68,13,66,0,17,66,0,63,151,1,67,0,14,70,
+  0,63,148,1,128,9,69,0,14,69,0,63,156,3,66,13,63,150,1,66,13,67,0,15,
+  66,13,63,150,1,66,13,68,0,14,66,13,128,0,63,149,1,66,13,128,9,19,67,0,
+  13,66,13,63,155,1,67,0,13,66,13,63,172,1,128,0,1,128,13,63,172,1,130,0,
+  9,63,173,1,129,144,82,0,63,122,66,13,63,172,1,68,13,80,0,63,154,1,68,13,
+  128,9,79,0,11,66,13,63,139,1,68,13,128,9,79,0,10,68,13,56,66,0,66,13,
+  63,76,66,13,130,0,9,15,66,13,6,68,13,43,66,13,8,66,0,1,66,13,63,77,
+  67,0,14,68,13,50,71,13,7,66,0,1,66,13,63,96,68,13,5,128,0,2,76,0,
+  25,128,0,1,70,13,7,66,0,1,66,13,63,83,66,13,9,68,13,71,0,128,9,76,
+  0,25,129,0,7,128,13,8,129,0,0,66,13,63,84,66,13,74,0,2,72,0,128,9,
+  75,0,26,129,0,17,72,0,10,66,13,63,67,66,13,128,9,75,0,128,9,72,0,39,
+  66,0,1,128,13,86,0,8,129,0,0,129,221,63,69,130,0,9,9,130,0,9,42,66,
+  13,2,89,0,66,13,7,129,0,0,129,221,63,126,129,0,0,129,221,27,128,0,1,128,
+  13,7,127,16,0,62,66,13,48,129,153,0,129,221,27,128,0,1,128,13,63,87,66,13,
+  71,0,40,81,0,14,68,0,1,128,13,63,83,66,13,72,0,63,13,128,0,1,128,13,
+  63,84,130,0,9,63,21,128,0,1,128,13,63,201,2,66,13,63,173,1,66,13,68,0,
+  8,66,13,63,156,1,66,13,68,0,10,129,221,63,156,1,130,0,9,10,128,0,3,128,
+  13,63,170,1,128,0,3,128,13,57,66,13,63,109,129,0,52,128,0,1,128,13,2,128,
+  0,1,70,13,63,105,128,9,69,0,45,128,0,3,128,13,0,129,0,2,70,13,63,157,
+  1,128,9,3,128,13,0,129,0,2,70,13,63,157,1,128,9,3,128,13,0,66,0,1,
+  129,13,3,128,13,63,79,82,0,59,128,0,4,128,13,70,0,1,128,13,63,82,67,0,
+  66,13,75,0,60,128,0,1,128,13,5,66,0,66,13,63,76,68,13,66,0,66,13,128,
+  0,17,128,0,1,128,13,32,129,0,0,129,221,11,128,0,1,128,13,5,66,0,66,13,
+  63,76,68,13,66,9,66,13,128,9,17,128,9,1,128,13,0,128,0,1,128,13,26,129,
+  0,2,129,221,20,66,0,66,13,63,58,66,13,74,0,3,68,13,24,128,9,1,128,13,
+  0,128,9,1,128,13,26,129,0,2,129,221,63,84,68,13,71,0,6,66,13,30,128,0,
+  1,128,13,26,129,0,2,130,221,0,1,128,13,2,81,0,63,59,68,13,69,0,63,2,
+  128,13,7,129,153,0,130,221,0,3,128,13,0,66,0,1,128,13,63,72,68,13,67,0,
+  37,128,9,70,0,21,128,13,12,128,9,3,128,13,0,129,0,2,129,221,63,72,66,13,
+  66,0,63,6,67,13,2,129,0,0,129,221,1,128,0,10,129,221,5,129,0,2,129,221,
+  63,49,66,13,74,0,63,15,129,0,0,129,221,2,128,0,8,66,13,5,129,0,2,129,
+  221,63,48,68,13,71,0,43,66,13,33,129,0,0,129,221,1,68,0,5,66,13,5,129,
+  0,2,129,221,63,48,68,13,69,0,63,26,129,0,7,128,0,66,13,63,61,68,13,67,
+  0,13,67,0,63,10,129,0,0,128,13,0,128,0,0,129,221,63,67,66,13,68,9,12,
+  66,13,128,9,63,13,66,13,63,62,66,13,67,0,22,66,13,86,0,39,69,0,63,73,
+  128,0,2,73,0,16,66,13,62,129,0,0,129,221,63,70,129,0,0,68,13,72,0,9,
+  66,0,63,7,129,0,0,129,221,63,68,66,13,128,0,0,128,13,0,75,0,7,66,13,
+  129,153,63,9,66,13,12,84,0,63,34,66,13,128,0,0,128,13,0,129,0,66,13,69,
+  0,8,66,13,94,0,59,129,0,3,129,221,63,47,66,13,0,66,13,129,0,66,13,68,
+  0,9,66,13,36,129,144,75,0,39,129,0,3,129,221,63,51,66,13,129,0,66,13,67,
+  0,50,129,144,76,0,40,69,13,63,173,1,66,0,66,13,63,111,66,13,55,66,0,66,
+  13,63,111,66,13,55,66,0,66,13,63,101,130,0,9,62,81,0,63,92,129,144,72,0,
+  53,129,0,63,51,72,0,47,66,13,72,0,53,128,0,3,128,13,63,45,66,13,70,0,
+  48,66,13,62,128,0,3,128,13,63,44,69,13,67,0,49,66,13,7,129,144,82,0,37,
+  129,221,63,44,69,13,66,0,63,55,66,13,63,45,69,13,128,0,51,129,144,73,0,63,
+  105,68,13,128,0,52,129,144,73,0,66,13,63,103,66,13,53,66,13,74,0,63,110,69,
+  9,45,66,13,63,119,66,13,129,153,48,66,13,63,118,128,9,2,114,0,63,119,128,9,
+  3,128,13,63,167,1,129,0,4,115,0,63,115,66,13,128,0,3,128,13,63,30,129,144,
+  103,0,63,31,66,13,128,0,0,129,221,63,32,128,0,1,128,13,63,69,66,13,63,36,
+  128,0,1,128,13,63,173,1,66,13,63,212,23,67,0,63,140,5,66,13,63,170,7,68,
+  0,0,130,0,1,63,167,1,68,0,63,96,130,0,9,63,8,128,0,1,128,13,63,99,
+  102,0,39,66,13,63,90,68,13,97,0,63,137,1,68,13,97,0,38,129,0,0,129,221,
+  63,93,68,13,33,66,13,37,66,13,18,127,42,0,32,66,13,63,12,66,13,17,129,0,
+  3,127,38,0,63,10,67,0,42,75,0,4,127,39,0,29,129,153,105,0,1,128,13,42,
+  75,0,4,129,0,1,128,13,63,66,105,0,1,128,13,42,128,0,1,128,13,10,128,13,
+  0,128,0,2,129,221,63,65,105,0,66,13,43,66,13,8,66,13,0,128,0,1,66,13,
+  63,106,68,0,42,66,13,13,68,13,63,62,66,13,37,68,13,45,81,0,66,13,63,104,
+  68,13,45,128,0,1,128,13,63,123,66,13,45,128,0,1,128,13,63,173,1,66,13,127,
+  62,0,14,128,9,127,4,0,27,128,0,1,128,13,63,69,67,0,0,129,153,127,2,0,
+  29,128,0,1,128,13,63,68,68,0,67,13,126,0,32,66,13,63,68,128,0,2,128,0,
+  67,13,63,172,1,67,13,63,167,1,68,13,129,153,122,0,63,110,68,13,122,0,44,127,
+  68,0,66,13,0,66,1,63,37,127,71,0,66,13,128,0,63,37,129,0,0,129,221,63,
+  60,69,0,66,13,63,40,66,13,63,64,128,0,0,66,13,63,40,66,13,63,58,69,13,
+  80,0,63,153,1,69,13,63,170,1,68,13,127,171,1,0,68,13,127,171,1,0,68,13,
+  63,171,1,68,13,63,172,1,66,13,63,141,5,127,143,5,0,2,127,172,1,0,68,13,
+  63,171,1,68,13,63,171,1,68,13,63,172,1,66,13,63,219,45,63,183,23,66,13,63,
+  173,1,66,13,63,172,1,128,0,1,128,13,63,172,1,127,253,6,0,66,13,63,172,1,
+  68,13,63,174,1,129,221,63,170,1,128,0,3,128,13,63,170,1,129,0,2,128,13,63,
+  170,1,66,0,1,128,13,63,163,1,128,7,3,66,13,129,0,1,128,13,63,163,1,128,
+  7,2,68,13,128,0,1,128,13,0,66,13,63,159,1,128,7,7,128,0,1,128,13,0,
+  66,13,63,118,66,13,37,128,7,7,67,0,2,128,13,63,116,69,13,36,128,7,2,128,
+  7,2,67,0,3,128,13,63,121,128,13,35,128,7,2,128,7,0,70,0,3,128,13,63,
+  158,1,128,7,2,128,7,6,128,0,3,128,13,63,116,129,0,2,100,0,128,7,2,128,
+  7,2,66,13,0,129,0,63,121,104,0,128,7,2,128,7,1,128,0,1,66,13,127,163,
+  1,0,128,7,1,128,7,2,128,0,63,168,1,128,7,1,128,7,2,66,0,63,166,1,
+  128,7,1,128,7,5,127,166,1,0,128,7,1,128,7,0,66,13,63,168,1,128,7,0,
+  128,7,0,68,13,63,95,66,13,63,5,128,7,0,128,7,3,129,221,63,95,66,13,63,
+  4,128,7,1,128,7,4,129,125,63,69,66,13,21,66,13,68,0,20,128,7,2,66,13,
+  34,128,7,1,69,13,128,7,63,69,68,13,21,66,0,24,128,7,2,66,13,0,66,13,
+  30,128,7,0,128,7,4,128,7,63,70,68,13,84,0,0,66,1,24,128,7,5,128,0,
+  1,128,13,30,128,7,0,128,7,63,76,68,13,81,0,32,128,7,1,67,0,1,128,13,
+  30,128,7,0,129,7,63,79,79,0,35,128,7,1,80,0,19,128,7,1,66,7,127,92,
+  0,11,69,13,19,128,7,3,66,13,31,128,7,0,129,119,127,92,0,13,69,13,19,128,
+  7,3,66,13,5,66,13,21,128,7,1,128,7,63,133,1,128,7,3,66,13,30,128,7,
+  0,128,7,63,108,67,0,1,128,13,19,128,7,1,73,0,23,128,7,1,128,7,63,108,
+  66,0,68,13,18,128,7,1,69,0,66,13,0,80,0,6,128,7,0,128,7,63,136,1,
+  128,7,1,69,0,26,128,7,0,128,7,63,66,66,13,42,69,13,18,128,7,34,128,7,
+  0,128,7,63,65,68,13,46,83,0,66,13,5,89,0,128,7,0,128,7,63,66,68,13,
+  77,0,31,83,0,69,13,29,128,7,1,128,13,63,65,69,13,74,0,9,128,7,16,69,
+  13,128,7,18,70,13,27,129,7,1,128,13,63,66,68,13,73,0,2,66,13,4,128,7,
+  16,69,13,128,7,25,66,13,24,129,119,1,128,13,63,67,128,0,2,72,0,3,66,13,
+  68,0,128,7,16,66,13,130,112,0,0,128,7,17,128,0,32,128,7,0,128,7,63,71,
+  68,0,66,13,7,66,13,69,0,128,7,16,66,0,128,7,1,128,7,17,128,0,2,130,
+  0,7,5,128,7,19,129,119,63,74,66,0,66,13,128,0,7,129,0,0,129,221,2,128,
+  7,16,67,0,128,7,1,128,7,16,128,0,4,128,7,68,0,128,7,19,129,119,63,78,
+  68,13,72,0,66,13,66,0,128,7,19,66,13,0,128,7,16,128,0,4,128,7,3,128,
+  7,20,129,119,63,84,71,0,66,13,66,0,128,7,24,128,7,15,128,0,3,128,7,4,
+  128,7,19,129,119,63,80,68,13,78,0,128,7,21,128,13,0,128,7,20,128,7,3,128,
+  7,20,128,7,63,81,68,13,128,0,0,67,13,8,128,7,18,128,0,2,128,0,0,128,
+  7,15,130,0,7,0,128,7,2,128,7,20,129,119,63,82,66,13,128,0,5,72,0,128,
+  7,19,66,13,128,0,0,128,7,16,128,7,0,128,7,2,128,7,21,128,7,63,87,69,
+  13,129,112,6,128,7,20,130,119,0,0,128,7,13,66,13,128,7,0,128,7,1,128,7,
+  21,129,119,63,87,68,13,66,0,128,7,6,128,7,16,66,13,0,128,7,1,128,7,13,
+  66,13,129,119,2,128,7,21,128,7,63,94,128,13,0,128,7,6,128,7,15,68,13,129,
+  119,0,128,7,16,129,119,1,128,7,21,128,7,63,91,129,0,2,128,0,0,128,7,0,
+  66,13,2,128,7,14,68,13,0,128,7,0,128,7,13,66,0,129,119,0,128,7,22,128,
+  7,63,93,66,13,66,0,68,13,1,128,7,20,66,7,13,66,0,128,7,0,128,7,21,
+  66,13,63,94,130,112,7,1,68,13,66,0,128,7,13,128,0,2,66,0,128,7,0,128,
+  7,14,66,7,21,128,0,1,128,13,63,97,128,7,0,68,13,66,0,128,7,13,70,0,
+  128,7,0,128,7,14,66,7,21,128,0,1,128,13,63,98,128,7,3,68,0,128,7,13,
+  69,0,128,7,0,128,7,14,129,119,22,128,7,93,0,63,72,128,7,0,128,7,69,0,
+  128,7,20,129,119,14,128,7,22,128,7,63,104,66,7,5,128,7,14,66,13,1,129,119,
+  14,128,7,22,128,7,63,106,128,7,5,128,7,14,66,13,1,129,119,14,128,7,21,128,
+  7,63,107,66,13,4,128,7,13,66,13,128,0,0,129,119,14,128,7,20,128,7,63,108,
+  66,13,68,0,128,7,14,67,0,129,119,13,128,7,21,128,7,63,108,66,13,128,7,4,
+  128,7,13,67,0,129,119,12,66,13,19,128,7,63,110,66,0,128,7,3,128,7,18,128,
+  7,34,128,7,63,115,128,7,3,128,7,17,128,7,34,128,7,63,116,128,7,2,128,7,
+  17,129,119,11,129,112,82,0,128,7,63,118,66,13,0,128,7,16,129,119,12,128,7,17,
+  128,7,63,118,68,13,128,7,16,129,119,11,128,7,18,128,7,63,118,68,13,129,112,16,
+  128,7,10,66,13,16,128,7,63,119,68,13,129,119,16,128,7,9,68,13,14,128,7,63,
+  121,66,13,131,0,119,15,128,7,9,68,13,14,128,7,45,66,13,63,73,68,0,128,7,
+  15,128,7,66,13,25,128,7,44,128,0,1,66,13,63,73,68,0,128,7,14,68,13,5,
+  128,0,2,77,0,128,7,27,69,13,10,129,0,2,129,221,63,79,128,7,24,130,0,7,
+  78,0,128,7,25,128,0,6,128,13,9,129,0,2,129,221,63,80,66,13,22,129,112,77,
+  0,128,7,25,129,0,6,128,13,9,129,0,2,128,13,63,81,66,13,75,0,2,72,0,
+  128,7,12,128,7,26,129,0,6,128,13,9,129,0,1,128,13,63,82,66,13,128,7,10,
+  130,0,7,8,128,7,11,128,7,27,66,0,4,128,13,28,66,0,66,13,63,64,66,0,
+  128,7,11,128,7,8,128,7,11,128,7,22,66,13,2,89,0,10,66,0,66,13,63,68,
+  128,7,11,128,7,7,128,7,10,128,7,21,129,0,0,129,221,26,128,0,1,128,13,8,
+  66,0,66,13,63,69,128,7,66,13,7,128,7,7,128,7,9,128,7,22,129,119,0,130,
+  221,7,25,128,0,1,128,13,63,85,66,13,72,0,128,7,6,128,7,9,128,7,20,129,
+  119,69,0,73,7,15,128,0,1,67,13,63,82,66,13,72,0,128,7,6,128,7,8,128,
+  7,19,129,119,17,69,7,63,100,130,0,7,8,128,7,5,128,7,7,128,7,18,129,119,
+  25,67,7,63,99,128,7,7,128,7,5,128,7,7,128,7,16,129,119,31,66,7,6,128,
+  1,127,21,0,63,4,128,7,66,13,4,128,7,4,128,7,6,128,7,15,129,119,63,135,
+  1,66,13,68,0,128,7,4,128,7,5,128,7,14,129,119,63,137,1,66,13,69,0,128,
+  7,3,128,7,5,128,7,12,129,119,63,140,1,130,0,7,4,128,7,3,128,7,16,66,
+  7,63,145,1,128,7,4,128,7,2,128,7,14,129,119,63,149,1,129,119,2,128,7,2,
+  128,7,12,129,119,49,129,0,0,129,221,63,98,128,7,2,128,7,1,128,7,10,129,119,
+  43,129,0,0,129,221,1,129,0,6,129,221,63,94,128,7,1,128,7,1,128,7,1,128,
+  7,5,129,119,44,129,0,2,129,221,0,129,0,7,129,221,63,94,128,7,1,128,7,0,
+  128,7,1,128,7,3,129,119,42,69,7,2,129,221,0,129,0,7,129,221,63,95,128,7,
+  0,128,7,0,128,7,0,128,7,2,129,119,34,73,7,2,130,119,0,2,129,221,1,129,
+  0,0,128,13,0,128,0,2,129,221,63,96,68,7,1,129,119,34,129,119,10,129,119,1,
+  129,0,3,128,13,5,129,0,0,129,221,63,75,66,13,68,0,66,13,76,0,68,7,33,
+  66,7,10,129,119,6,128,0,1,128,13,7,129,1,0,129,221,63,72,68,13,67,0,66,
+  13,128,0,0,79,7,30,66,7,6,69,0,128,7,8,128,0,1,128,13,7,129,16,0,
+  129,221,63,72,68,13,67,7,66,13,129,119,8,129,119,0,70,7,4,129,0,0,129,221,
+  15,129,119,8,129,0,2,129,119,21,129,16,0,129,221,63,56,77,0,129,119,68,13,78,
+  0,66,7,1,129,119,0,128,7,0,66,7,2,67,7,0,129,221,12,66,7,10,128,0,
+  3,128,13,63,86,73,0,129,119,2,66,13,77,0,129,119,4,129,119,0,128,7,3,66,
+  7,1,129,0,0,129,221,69,7,4,129,119,13,128,0,3,129,13,1,128,13,63,78,68,
+  13,70,0,129,119,18,66,7,5,128,7,0,128,7,1,128,7,5,129,119,10,68,7,2,
+  74,0,66,7,2,70,13,2,129,0,0,129,221,63,69,68,13,68,0,129,119,18,129,119,
+  8,128,7,0,128,7,2,128,7,6,66,7,11,129,119,1,128,0,2,128,13,1,67,7,
+  3,66,13,128,7,3,128,13,1,129,0,2,129,221,63,68,68,13,2,129,119,17,66,7,
+  9,128,7,1,128,7,2,129,112,72,0,66,7,10,130,119,0,5,128,13,3,70,0,4,
+  128,7,5,129,221,5,128,0,2,128,1,63,48,66,13,70,0,66,13,1,129,119,17,129,
+  119,12,128,7,1,128,7,2,128,0,1,128,13,9,129,119,9,129,119,70,13,3,129,0,
+  0,129,221,1,128,0,2,128,0,6,130,221,7,4,128,0,3,129,221,63,45,68,13,72,
+  0,129,119,16,66,7,14,128,7,1,128,7,2,128,0,1,128,13,11,66,7,2,67,7,
+  2,130,119,0,1,128,13,3,129,0,0,129,221,4,129,0,6,129,221,5,128,0,3,129,
+  221,63,45,68,13,70,0,129,119,15,66,7,16,128,7,2,128,7,3,66,13,14,66,7,
+  8,129,119,7,66,13,1,129,0,5,128,13,0,128,0,0,129,221,6,69,13,63,45,68,
+  13,68,0,129,119,15,129,119,19,128,7,2,128,7,6,128,7,27,129,119,10,129,0,0,
+  128,13,0,128,0,0,129,221,63,64,66,13,128,0,68,7,11,66,13,66,7,20,128,7,
+  3,128,7,7,128,7,28,129,119,8,129,0,0,129,221,63,59,66,13,68,0,68,7,1,
+  128,7,13,66,13,87,0,128,7,3,128,7,7,128,7,30,128,7,63,72,66,13,74,0,
+  128,7,12,129,119,66,13,87,0,128,7,3,128,7,8,128,7,25,67,0,129,119,63,67,
+  70,13,73,0,128,7,11,129,119,27,128,7,4,128,7,9,128,7,24,129,0,0,131,221,
+  119,63,62,66,13,128,0,0,66,13,76,0,128,7,6,129,0,66,7,29,128,7,4,128,
+  7,10,128,7,23,129,0,0,130,221,7,0,128,7,63,61,66,13,128,0,0,66,13,128,
+  0,0,66,13,70,0,128,7,5,66,13,128,7,95,0,128,7,5,128,7,11,128,7,24,
+  66,13,0,128,7,0,128,7,8,128,0,2,78,0,63,32,66,13,129,0,66,13,128,0,
+  0,66,13,69,0,128,7,5,128,7,66,13,96,0,128,7,5,128,7,11,128,7,28,128,
+  7,1,128,7,7,128,0,2,128,0,0,129,221,63,48,66,13,128,0,0,66,13,68,0,
+  128,7,3,67,7,66,13,31,128,7,6,128,7,12,128,7,28,128,7,9,128,0,2,128,
+  0,0,129,221,63,60,128,7,1,66,7,1,128,7,35,128,7,5,129,112,77,0,128,7,
+  27,128,7,14,66,13,73,0,63,49,67,7,3,128,7,36,128,7,5,129,112,78,0,128,
+  7,27,128,7,14,129,0,0,129,221,63,54,66,7,5,128,7,36,128,7,23,128,7,43,
+  129,0,0,129,221,63,52,129,119,0,128,7,5,128,7,37,128,7,6,66,13,14,128,7,
+  44,66,13,63,51,128,7,1,128,7,4,129,119,37,128,7,7,66,13,15,128,7,36,129,
+  0,0,129,221,63,55,128,7,1,128,7,4,128,7,37,130,0,7,8,128,7,17,128,7,
+  34,129,0,2,129,221,63,42,66,13,71,0,128,7,7,128,7,50,128,7,18,128,7,33,
+  129,0,2,129,221,63,40,69,13,69,0,128,7,7,128,7,51,128,7,18,128,7,33,129,
+  0,2,129,221,63,39,71,13,67,0,128,7,7,128,7,40,66,13,7,129,112,83,0,128,
+  7,33,129,0,0,129,221,63,40,71,13,66,0,128,7,7,128,7,41,128,7,32,128,7,
+  63,78,71,13,1,128,7,5,66,7,42,128,7,33,128,7,63,78,66,13,68,0,128,7,
+  2,68,7,42,129,112,74,0,66,13,20,128,7,63,85,70,7,45,129,112,75,0,128,7,
+  22,128,7,63,80,71,7,47,66,13,75,0,128,7,23,128,7,63,76,66,7,0,66,13,
+  115,0,66,13,11,128,7,24,128,7,63,77,128,7,67,13,115,0,66,13,11,128,7,25,
+  128,7,63,76,128,0,55,128,7,13,128,7,25,128,7,63,72,129,0,0,68,13,116,0,
+  128,7,13,128,7,26,128,7,63,70,69,13,118,0,128,7,14,128,7,26,129,112,102,0,
+  63,30,69,13,54,128,7,14,128,7,26,128,0,1,128,13,63,67,66,13,57,128,7,14,
+  128,7,26,128,0,1,128,13,63,127,128,7,15,128,7,27,66,13,63,127,128,7,16,128,
+  7,29,128,7,63,125,128,7,17,128,7,30,128,7,63,124,128,7,18,128,7,30,128,7,
+  63,123,128,7,18,128,7,30,128,7,63,122,128,7,20,128,7,30,128,7,63,121,128,7,
+  20,128,7,31,128,7,63,119,128,7,22,128,7,31,129,119,63,117,128,7,22,128,7,33,
+  128,7,63,115,128,7,24,128,7,33,129,119,63,113,128,7,25,128,7,34,128,7,63,111,
+  129,119,25,128,7,35,129,119,63,109,128,7,27,128,7,36,129,119,63,106,129,119,23,67,
+  0,128,7,38,128,7,63,104,129,119,29,128,7,38,129,119,63,102,129,119,29,128,7,40,
+  71,7,63,93,128,7,0,128,7,24,66,13,2,128,7,40,128,7,5,72,7,63,83,128,
+  7,0,128,7,31,128,7,40,128,7,63,98,128,7,0,128,7,32,128,7,40,128,7,63,
+  96,128,7,1,128,7,33,128,7,40,128,7,63,94,128,7,1,128,7,35,128,7,39,129,
+  7,1,128,13,63,90,128,7,1,128,7,36,128,7,34,68,0,128,7,1,128,13,63,89,
+  131,7,112,38,128,7,33,128,0,1,128,13,0,128,7,1,128,13,63,89,131,7,112,102,
+  0,128,7,33,128,0,1,128,13,1,128,7,63,90,128,7,2,128,7,98,0,4,128,7,
+  33,66,13,66,0,128,7,63,88,128,7,68,13,98,0,5,128,7,33,68,0,128,7,63,
+  88,128,7,68,13,34,66,13,3,128,7,32,129,0,0,129,221,0,128,7,15,127,42,0,
+  27,128,7,0,68,13,42,128,7,33,66,13,1,128,7,13,66,0,1,128,13,63,64,128,
+  7,1,128,7,66,13,40,95,0,5,66,13,1,128,7,13,129,0,2,129,221,127,38,0,
+  24,128,7,0,130,7,7,106,0,43,128,7,1,76,0,2,128,13,0,129,0,1,128,13,
+  63,57,128,7,0,128,7,63,26,128,7,1,76,0,1,66,13,128,0,2,129,221,63,56,
+  129,119,0,67,13,37,67,0,66,13,0,87,0,16,128,7,0,129,0,0,129,221,8,66,
+  13,129,0,2,129,221,63,55,129,119,1,67,13,37,71,0,2,83,0,21,66,13,12,128,
+  0,1,66,13,63,56,128,7,1,66,13,41,67,0,44,128,0,1,128,13,14,66,13,63,
+  57,128,7,0,128,7,41,68,13,63,126,128,7,0,128,7,41,68,13,1,68,13,63,118,
+  66,7,44,66,13,2,66,13,40,66,13,127,63,0,11,66,7,63,173,1,129,119,127,1,
+  0,63,105,67,0,2,125,0,34,66,13,63,71,129,0,63,170,1,68,13,128,0,67,13,
+  63,166,1,68,13,128,1,0,66,13,63,166,1,68,13,63,172,1,66,13,0,67,0,63,
+  39,127,76,0,63,36,127,68,0,67,13,63,40,128,0,1,128,13,63,57,70,0,67,13,
+  63,41,66,13,63,57,128,0,3,128,0,0,67,13,63,41,66,13,63,136,6,68,13,127,
+  171,1,0,68,13,63,171,1,68,13,63,172,1,66,13,63,253,6,127,159,3,0,2,127,
+  172,1,0,68,13,127,171,1,0,68,13,63,171,1,68,13,63,172,1,66,13,63,252,41,
+  63,215,19,66,12,63,173,1,66,12,63,173,1,66,12,63,173,1,127,237,8,0,66,12,
+  63,172,1,68,12,63,170,1,128,0,68,12,63,170,1,128,0,68,12,63,170,1,129,0,
+  67,12,63,168,1,66,12,129,0,66,12,63,167,1,72,12,63,167,1,71,12,1,66,12,
+  63,117,66,12,41,128,0,71,12,0,128,0,66,12,63,115,69,12,40,129,0,66,12,0,
+  67,0,67,12,63,115,69,12,40,128,7,71,0,68,12,63,115,69,12,41,71,0,68,12,
+  63,115,129,0,66,12,100,0,12,128,0,68,12,63,115,105,0,7,66,12,1,129,0,66,
+  12,63,118,103,0,7,66,12,2,127,162,1,0,7,69,12,63,170,1,66,0,66,12,63,
+  172,1,128,0,66,12,63,168,1,66,12,63,94,66,12,63,11,68,12,63,93,66,12,63,
+  10,69,12,63,93,66,12,95,0,66,12,37,70,12,63,68,66,12,22,78,0,18,69,12,
+  34,69,12,63,68,68,12,21,71,0,24,128,1,69,12,33,128,7,68,12,63,69,68,12,
+  89,0,28,67,0,66,12,33,129,0,66,12,63,70,68,12,85,0,32,73,0,30,66,0,
+  128,7,127,72,0,66,12,83,0,5,66,12,28,66,12,72,0,27,129,112,127,93,0,8,
+  69,12,25,66,12,63,141,1,69,12,84,0,4,66,12,6,66,12,63,132,1,129,0,66,
+  12,84,0,4,73,0,66,12,63,132,1,66,0,66,12,24,73,0,66,12,63,134,1,68,
+  12,28,66,12,0,78,0,63,123,68,12,83,0,8,66,12,63,91,67,12,42,69,12,83,
+  0,8,66,12,63,91,68,12,41,69,12,83,0,66,12,5,88,0,63,69,68,12,79,0,
+  23,69,12,84,0,69,12,30,66,12,63,64,69,12,38,69,12,84,0,70,12,29,66,12,
+  63,65,68,12,75,0,0,66,12,22,69,12,128,0,19,70,12,29,66,12,63,66,128,0,
+  66,12,74,0,1,66,12,69,0,17,66,0,130,7,0,19,128,0,72,12,26,67,0,63,
+  67,66,0,66,12,8,66,12,69,0,17,67,0,22,66,12,66,0,66,12,63,101,66,12,
+  67,0,5,66,0,66,12,22,66,12,20,66,12,2,66,12,63,101,69,12,9,66,12,22,
+  66,12,20,66,12,63,109,68,12,8,66,12,22,66,12,128,0,19,66,12,63,109,68,12,
+  78,0,20,128,0,66,12,18,66,12,63,109,74,12,29,128,0,66,12,18,130,0,7,63,
+  110,73,12,73,0,20,66,12,16,66,12,63,113,129,0,70,12,73,0,20,130,112,7,16,
+  66,12,63,115,68,12,67,0,25,66,12,19,66,12,63,116,66,12,129,0,66,12,24,68,
+  12,18,66,0,63,118,130,112,7,66,12,3,66,12,17,68,12,128,0,17,66,0,63,121,
+  66,12,2,68,12,16,68,12,128,0,63,142,1,129,112,67,0,68,12,17,66,12,66,0,
+  44,66,12,63,99,68,12,18,69,0,43,66,12,63,99,128,0,66,12,67,0,63,2,66,
+  12,63,100,128,7,70,0,15,66,12,63,173,1,66,12,63,173,1,66,12,66,0,63,147,
+  1,66,12,20,68,0,63,147,1,66,12,69,0,14,68,0,14,66,12,63,129,1,66,12,
+  128,7,39,66,12,63,130,1,66,0,39,66,12,63,173,1,129,112,83,0,63,154,1,129,
+  112,83,0,63,117,66,12,63,172,1,68,12,31,66,12,63,136,1,68,12,128,0,29,68,
+  12,63,135,1,68,12,128,7,29,68,12,63,136,1,66,12,129,0,29,68,12,63,0,66,
+  12,63,70,68,0,17,66,12,7,128,0,66,12,79,0,46,128,0,68,12,63,91,68,12,
+  6,130,0,7,79,0,31,66,12,11,129,0,68,12,63,91,68,12,72,0,128,7,78,0,
+  28,129,0,69,12,10,129,0,68,12,63,77,66,12,10,68,12,72,0,43,129,0,70,12,
+  10,129,0,67,12,63,78,66,12,75,0,66,12,73,0,43,129,0,70,12,10,129,0,66,
+  12,63,79,66,12,128,7,11,129,112,73,0,43,129,0,69,12,11,68,0,15,66,12,63,
+  61,66,0,62,66,12,2,129,0,66,12,82,0,13,129,0,66,12,63,125,129,0,66,12,
+  40,129,0,66,12,63,125,129,0,66,12,25,128,0,66,12,10,127,11,0,60,66,12,72,
+  0,45,67,7,26,128,0,66,12,63,83,66,12,73,0,63,12,128,0,69,12,63,80,66,
+  12,128,7,63,24,128,1,66,12,63,172,1,128,1,66,12,63,198,2,66,12,69,0,63,
+  167,1,66,12,69,0,9,66,12,63,154,1,66,12,128,7,13,68,12,63,171,1,68,12,
+  63,171,1,68,12,63,171,1,128,0,66,12,70,0,53,129,0,66,12,63,107,128,7,70,
+  0,47,128,0,66,12,2,129,0,71,12,63,158,1,128,0,68,12,1,129,0,72,12,63,
+  157,1,128,7,68,12,1,129,0,72,12,63,157,1,128,0,68,12,2,129,0,71,12,63,
+  158,1,128,0,67,12,7,128,1,66,12,63,72,66,12,69,0,66,12,77,0,62,66,12,
+  9,129,0,66,12,63,68,68,12,68,0,66,12,66,0,18,128,0,66,12,50,66,12,9,
+  129,0,66,12,63,68,68,12,68,7,66,12,66,7,18,128,7,66,12,2,128,0,66,12,
+  27,129,0,66,12,23,129,0,66,12,63,68,68,12,80,0,12,128,0,66,12,2,128,7,
+  66,12,26,129,0,68,12,63,80,66,12,74,0,2,66,12,79,0,21,128,0,66,12,26,
+  129,119,70,12,63,77,68,12,71,0,63,13,129,119,71,12,4,128,0,66,12,63,67,68,
+  12,69,0,63,2,67,12,9,129,0,70,12,3,128,0,68,12,63,66,68,12,67,0,63,
+  4,67,12,128,7,66,12,9,68,12,0,128,7,71,12,5,66,0,63,49,72,0,66,12,
+  66,0,42,66,12,23,67,12,128,0,66,12,4,129,0,66,12,0,66,12,0,128,0,72,
+  12,5,128,0,69,12,63,44,66,12,74,0,44,66,12,27,128,0,66,12,4,129,0,66,
+  12,4,128,0,73,12,4,128,0,69,12,63,43,68,12,71,0,46,66,12,36,129,0,66,
+  12,1,129,0,70,12,129,0,66,12,4,128,0,69,12,63,43,68,12,69,0,63,32,129,
+  0,69,12,2,66,12,63,55,68,12,17,66,0,63,17,129,0,66,12,63,57,71,0,66,
+  12,17,66,12,128,7,63,141,1,66,12,76,0,14,66,12,88,0,63,114,69,12,75,0,
+  15,66,12,63,5,129,0,66,12,63,62,66,0,69,12,63,36,129,0,66,12,63,60,66,
+  12,129,0,66,12,77,0,6,130,0,7,63,15,129,0,66,12,11,81,0,63,30,66,12,
+  129,0,66,12,66,0,66,12,70,0,5,66,12,128,7,97,0,62,129,0,69,12,63,40,
+  66,12,1,66,12,66,0,66,12,69,0,6,66,12,97,0,63,0,129,0,69,12,63,45,
+  66,12,2,66,12,12,66,12,63,36,69,12,63,175,1,73,0,63,102,129,112,78,0,46,
+  129,0,66,12,63,107,129,112,79,0,45,129,0,66,12,63,107,66,12,55,70,0,66,12,
+  63,107,66,12,54,129,0,66,12,63,42,74,0,48,129,112,72,0,66,12,54,128,0,68,
+  12,63,39,66,12,72,0,48,66,12,73,0,56,128,0,68,12,63,37,71,12,68,0,49,
+  66,12,73,0,57,68,12,63,36,72,12,67,0,50,66,12,8,66,12,56,66,12,63,37,
+  72,12,66,0,63,0,66,12,63,97,69,12,63,6,66,12,63,98,66,12,63,234,1,130,
+  0,7,63,117,66,12,128,7,51,129,112,76,0,63,104,67,12,115,0,66,12,76,0,63,
+  104,67,12,115,0,66,12,63,114,69,12,116,0,66,12,63,112,129,0,66,12,119,0,63,
+  113,66,12,128,0,66,12,119,0,44,66,12,63,65,66,12,123,0,44,66,12,63,65,66,
+  12,63,41,66,12,63,195,25,68,0,63,171,1,66,12,63,173,1,66,12,63,173,1,66,
+  12,63,193,5,128,1,127,54,0,63,57,66,12,63,168,1,66,0,1,66,12,63,168,1,
+  130,0,1,1,66,12,63,89,66,0,35,66,12,36,128,0,66,12,63,92,128,0,66,12,
+  99,0,66,12,37,66,12,63,92,68,12,34,66,12,37,66,12,66,0,63,89,68,12,63,
+  14,68,0,17,127,41,0,28,68,12,63,14,128,0,66,12,17,129,0,66,12,63,67,66,
+  12,40,66,12,35,66,12,17,128,0,68,12,0,127,37,0,26,129,112,106,0,66,12,35,
+  66,12,17,128,0,68,12,129,0,66,12,63,59,66,12,106,0,66,12,45,75,0,68,12,
+  128,0,68,12,63,58,66,12,127,6,0,21,128,0,66,12,8,66,12,0,128,0,68,12,
+  63,58,66,12,38,71,0,66,12,81,0,23,128,0,66,12,13,68,12,63,58,66,12,38,
+  70,0,68,12,39,128,0,67,12,14,66,12,63,101,66,12,67,0,68,12,39,128,0,66,
+  12,63,120,68,12,1,68,12,39,128,0,66,12,63,120,68,12,2,66,12,42,127,66,0,
+  57,66,12,48,128,0,66,12,63,72,129,119,126,0,34,128,0,66,12,63,67,128,1,67,
+  0,66,12,123,0,37,66,12,63,66,66,12,129,1,0,66,12,121,0,63,108,68,12,128,
+  1,0,66,12,119,0,63,110,68,12,128,0,0,66,12,63,166,1,68,12,1,66,12,63,
+  167,1,66,12,63,177,1,75,0,63,33,127,83,0,63,29,128,0,66,12,63,57,68,0,
+  67,12,83,0,63,22,128,0,66,12,63,56,129,0,66,12,0,67,12,63,43,66,12,63,
+  56,68,12,0,67,12,63,165,1,69,12,63,170,1,68,12,63,171,1,68,12,63,170,1,
+  68,12,127,171,1,0,68,12,63,171,1,68,12,63,172,1,66,12,63,253,6,127,159,3,
+  0,66,12,127,172,1,0,68,12,127,171,1,0,68,12,63,171,1,68,12,63,172,1,66,
+  12,63,157,38,63,232,17,66,12,63,172,1,128,0,1,128,12,63,172,1,128,0,1,128,
+  12,63,172,1,127,254,6,0,66,12,63,172,1,68,12,63,174,1,129,204,63,170,1,128,
+  0,3,128,12,63,170,1,129,0,2,128,12,63,170,1,66,0,1,128,12,63,168,1,66,
+  12,129,0,1,128,12,63,170,1,68,12,63,122,66,12,41,128,0,9,66,12,63,116,68,
+  12,40,128,0,6,128,12,0,128,0,1,128,12,63,114,70,12,40,129,0,2,67,0,68,
+  12,63,120,128,12,41,70,0,68,12,63,227,2,106,0,63,135,1,103,0,8,66,12,1,
+  128,0,2,127,158,1,0,7,128,0,1,128,12,2,127,161,1,0,7,128,0,1,66,12,
+  63,170,1,66,0,63,204,2,66,12,63,12,67,12,0,127,92,0,66,12,63,11,69,12,
+  63,127,66,12,38,70,12,63,66,66,12,22,98,0,66,12,44,128,12,63,65,68,12,21,
+  98,0,2,66,12,34,128,0,63,72,68,12,56,66,0,37,129,0,2,128,0,63,67,68,
+  12,94,0,25,66,1,37,68,0,63,72,91,0,32,129,0,67,1,32,130,0,7,63,70,
+  90,0,2,66,12,28,66,12,63,112,86,0,63,224,1,66,12,63,131,1,66,0,2,128,
+  12,24,73,0,63,140,1,129,204,63,171,1,68,12,28,66,12,1,75,0,63,76,66,12,
+  63,172,1,68,12,43,69,12,19,66,12,63,98,68,12,84,0,19,72,12,18,68,12,4,
+  86,0,63,69,68,12,83,0,20,70,12,84,0,69,12,63,97,66,12,82,0,22,66,12,
+  128,0,29,128,12,63,97,129,0,2,76,0,66,12,23,66,0,23,128,0,63,104,128,0,
+  2,76,0,66,12,70,0,16,67,0,129,7,20,128,0,5,66,12,63,96,66,12,128,0,
+  66,12,8,66,12,70,0,47,66,0,63,103,66,12,70,0,2,72,0,20,66,12,63,130,
+  1,69,12,9,66,12,67,0,49,69,0,63,98,128,0,13,66,12,67,0,63,155,1,68,
+  12,72,0,66,12,67,0,19,130,0,7,63,132,1,71,12,54,66,12,129,112,63,171,1,
+  66,12,63,112,129,0,34,66,12,63,138,1,71,12,25,68,12,19,66,0,63,118,69,0,
+  23,68,12,19,66,0,63,116,130,0,7,0,66,12,128,0,2,66,12,17,68,12,128,0,
+  63,142,1,66,12,128,0,1,68,12,20,66,0,63,141,1,66,12,66,0,68,12,66,0,
+  14,70,0,44,66,12,63,98,68,12,66,0,15,69,0,63,150,1,68,0,16,66,12,63,
+  149,1,128,7,69,0,16,66,12,45,128,7,91,0,63,210,2,69,0,63,170,1,69,0,
+  63,146,1,66,12,69,0,35,66,12,63,128,1,66,12,128,7,63,172,1,66,12,128,0,
+  63,217,1,129,112,84,0,63,114,66,12,63,172,1,68,12,63,171,1,68,12,128,0,32,
+  66,12,63,134,1,68,12,129,7,30,68,12,63,134,1,66,12,130,0,7,63,171,1,68,
+  0,63,38,66,12,63,67,68,0,29,128,0,2,79,0,48,128,0,1,66,12,63,102,129,
+  112,80,0,47,129,1,2,129,204,63,151,1,68,12,12,129,16,2,129,204,63,74,66,12,
+  63,15,128,12,11,128,0,3,128,12,63,75,66,12,75,0,59,128,0,5,128,12,11,128,
+  0,63,80,66,12,128,7,63,7,128,0,5,128,12,11,128,0,1,128,12,63,78,66,0,
+  63,2,66,12,1,129,0,3,128,12,31,129,0,0,129,204,63,125,129,0,0,129,204,2,
+  85,0,15,129,0,0,129,204,63,125,129,0,0,129,204,40,129,0,0,129,204,63,64,66,
+  12,57,94,0,1,128,12,63,81,66,12,73,0,63,14,128,0,1,128,12,63,81,66,12,
+  128,7,63,23,128,0,4,128,12,63,79,66,0,63,26,128,0,1,128,12,63,172,1,128,
+  0,1,128,12,63,84,66,12,63,173,1,66,12,70,0,10,66,12,63,152,1,66,12,128,
+  7,18,129,204,63,152,1,66,0,14,128,0,3,128,12,63,170,1,128,0,3,128,12,63,
+  170,1,129,0,63,175,1,129,112,71,0,55,129,0,0,129,204,63,162,1,129,0,0,129,
+  204,2,129,0,5,129,204,63,157,1,129,0,2,129,204,1,129,0,6,129,204,63,156,1,
+  129,119,2,129,204,1,129,0,6,129,204,63,156,1,129,0,2,129,204,2,129,0,5,129,
+  204,63,157,1,129,0,1,128,12,7,129,0,0,129,204,63,68,66,12,70,0,66,12,78,
+  0,62,128,0,1,128,12,10,129,0,0,129,204,63,64,68,12,69,0,66,12,67,0,63,
+  10,128,0,1,128,12,10,129,0,0,129,204,63,64,68,12,69,7,66,12,67,7,26,128,
+  0,1,128,12,28,128,0,1,128,12,24,129,0,0,129,204,63,64,68,12,82,0,20,128,
+  7,1,128,12,27,128,7,3,128,12,63,78,66,12,75,0,0,66,12,81,0,22,128,0,
+  1,128,12,27,128,0,5,128,12,63,75,68,12,72,0,63,15,128,7,6,128,12,4,129,
+  0,0,129,204,63,64,68,12,70,0,63,2,128,0,2,128,12,10,128,7,5,128,12,3,
+  129,0,2,129,204,63,63,68,12,68,0,63,4,128,0,2,129,124,1,128,12,8,128,0,
+  3,128,12,0,67,7,128,0,2,129,204,63,64,66,12,67,0,42,128,7,75,0,13,128,
+  7,2,129,12,1,128,12,5,129,0,0,68,12,0,66,0,5,129,204,4,128,0,4,129,
+  204,63,41,66,12,75,0,44,128,0,1,128,12,27,128,0,1,128,12,5,129,0,0,129,
+  204,3,129,0,7,129,204,3,128,0,4,129,204,63,40,68,12,72,0,46,128,0,1,128,
+  12,37,129,0,0,129,204,1,67,0,2,131,204,0,0,129,204,3,128,0,4,129,204,63,
+  40,68,12,70,0,49,66,12,44,128,0,4,66,12,129,0,0,129,204,63,52,68,12,128,
+  0,63,40,128,0,1,128,12,0,66,12,63,59,66,12,66,7,14,66,12,128,7,63,21,
+  66,12,63,53,66,12,77,0,13,66,12,89,0,63,114,129,0,2,76,0,14,66,12,88,
+  0,46,130,112,7,63,63,70,12,76,0,63,26,129,112,0,129,204,63,56,66,12,129,0,
+  67,12,78,0,63,27,129,0,0,129,204,63,56,66,12,129,0,67,12,66,0,66,12,71,
+  0,3,66,12,66,7,63,20,66,12,11,128,0,2,74,0,63,29,66,12,66,0,66,12,
+  66,0,66,12,70,0,4,66,12,128,7,98,0,63,2,128,0,2,128,0,0,129,204,63,
+  42,66,12,66,0,66,12,69,0,5,66,12,99,0,63,2,128,0,2,128,0,0,129,204,
+  63,173,1,66,12,63,175,1,129,0,0,129,204,63,171,1,129,0,0,129,204,63,105,129,
+  112,80,0,46,129,0,0,129,204,63,105,129,112,81,0,39,128,0,1,128,12,63,171,1,
+  128,0,3,128,12,63,37,66,12,73,0,48,130,0,7,8,66,12,55,128,0,3,128,12,
+  63,43,69,0,61,66,12,55,128,0,3,128,12,63,34,72,12,68,0,62,129,112,84,0,
+  36,128,0,1,128,12,63,34,73,12,67,0,51,66,12,63,107,70,12,69,0,63,163,1,
+  68,12,70,0,63,2,66,12,63,96,66,12,63,180,1,128,0,66,7,63,174,1,118,0,
+  128,7,63,116,67,12,116,0,63,117,129,0,63,173,1,69,12,53,66,12,63,109,66,12,
+  128,0,66,12,120,0,44,129,112,100,0,63,28,66,12,128,0,66,12,63,38,128,0,1,
+  128,12,63,63,66,12,123,0,45,128,0,1,128,12,63,173,1,66,12,63,194,25,68,0,
+  63,139,5,66,12,63,193,5,128,0,1,128,12,63,172,1,128,0,1,128,12,63,172,1,
+  128,7,1,128,12,63,127,68,0,35,128,1,67,0,63,91,130,0,7,35,128,0,1,128,
+  12,36,128,0,1,128,12,63,94,128,7,100,0,1,128,12,36,128,0,1,128,12,63,90,
+  68,12,100,0,66,12,37,66,12,63,90,68,12,127,9,0,6,67,0,18,127,41,0,26,
+  68,12,40,94,0,7,128,0,1,128,12,17,129,0,63,68,66,12,63,17,128,0,1,128,
+  12,17,128,0,3,128,12,0,127,38,0,23,129,112,107,0,39,66,12,17,128,0,3,128,
+  12,127,40,0,63,5,66,12,46,75,0,2,129,204,66,0,1,128,12,63,107,128,0,1,
+  128,12,41,76,0,66,12,0,129,0,2,129,204,63,105,128,0,3,128,12,39,66,0,0,
+  129,204,12,128,0,1,66,12,63,56,66,12,38,71,0,3,128,12,42,66,12,13,68,12,
+  63,98,128,0,2,67,0,3,128,12,42,66,12,14,66,12,63,99,128,0,3,128,12,1,
+  128,0,1,128,12,40,66,12,63,121,68,12,48,127,67,0,56,66,12,48,128,0,1,128,
+  12,63,71,129,119,124,0,37,128,0,1,128,12,63,65,130,0,1,1,66,12,122,0,40,
+  66,12,63,64,128,0,2,128,0,0,66,12,120,0,63,116,66,12,128,1,63,172,1,66,
+  12,128,0,63,166,1,68,12,0,66,12,63,168,1,66,12,1,66,12,63,154,2,127,89,
+  0,63,23,129,0,0,129,204,63,56,67,0,2,127,46,0,0,129,204,63,54,128,0,2,
+  128,0,3,127,46,0,66,12,63,58,128,0,0,66,12,63,165,1,69,12,1,66,12,63,
+  165,1,68,12,127,171,1,0,63,175,1,68,12,127,171,1,0,68,12,127,171,1,0,68,
+  12,63,172,1,66,12,63,237,8,127,159,3,0,2,127,172,1,0,68,12,127,171,1,0,
+  68,12,63,171,1,68,12,63,172,1,66,12,63,190,34,63,249,15,66,12,63,172,1,128,
+  0,1,128,12,63,172,1,128,0,1,128,12,63,172,1,127,254,6,0,66,12,63,175,1,
+  129,204,63,170,1,128,0,3,128,12,63,170,1,128,0,3,128,12,63,170,1,129,0,63,
+  175,1,128,0,63,171,1,66,12,63,126,66,12,42,68,12,63,124,68,12,46,128,0,1,
+  128,12,1,66,12,63,115,68,12,46,69,0,1,128,12,63,113,70,12,41,128,0,2,70,
+  0,1,128,12,63,119,100,0,6,71,0,2,127,115,0,2,103,0,12,128,0,3,128,12,
+  63,114,106,0,12,128,0,3,128,12,63,165,1,66,12,1,128,0,3,128,12,63,171,1,
+  128,0,1,128,12,63,169,1,66,12,63,170,1,66,0,1,128,12,63,87,66,12,63,18,
+  128,0,1,128,12,63,87,66,12,63,14,66,12,0,127,91,0,66,12,96,0,66,12,44,
+  128,12,63,92,98,0,66,12,63,111,66,12,23,98,0,2,66,12,35,128,0,63,70,68,
+  12,57,66,0,66,12,35,128,0,4,127,65,0,68,12,124,0,38,129,0,2,127,66,0,
+  68,12,102,0,21,97,0,5,67,0,63,70,96,0,26,66,12,128,1,95,0,63,78,92,
+  0,66,12,29,66,12,63,140,1,66,12,87,0,63,149,1,66,12,128,0,66,12,25,73,
+  0,66,12,63,131,1,66,0,2,128,12,24,73,0,63,141,1,128,12,63,206,1,66,12,
+  0,73,0,63,77,66,12,45,69,12,28,128,0,1,128,12,63,87,68,12,44,69,12,19,
+  67,12,4,128,0,1,128,12,63,87,68,12,87,0,17,72,12,22,129,204,3,84,0,63,
+  70,68,12,85,0,47,128,0,3,128,12,63,99,85,0,26,86,0,36,66,12,63,62,129,
+  0,0,129,204,12,66,12,23,93,0,34,128,1,1,128,12,63,64,66,12,76,0,66,12,
+  128,1,26,88,0,5,66,12,26,128,0,1,128,12,63,64,66,12,128,0,66,12,8,66,
+  12,71,0,63,17,130,7,1,63,66,66,0,66,12,72,0,0,73,0,19,66,12,24,128,
+  12,63,104,66,12,71,0,5,66,12,22,66,12,128,0,26,128,7,89,0,63,76,66,0,
+  38,66,12,128,0,63,173,1,130,0,7,18,68,12,63,113,129,204,6,70,0,21,66,12,
+  16,66,12,129,112,63,116,66,12,63,176,1,74,0,16,66,12,20,67,0,63,112,71,12,
+  74,0,15,68,12,129,119,66,0,14,67,0,63,116,78,0,63,159,1,130,0,7,0,66,
+  12,63,173,1,66,12,66,0,0,66,12,67,0,14,128,0,2,66,0,63,140,1,66,12,
+  66,0,68,12,66,0,15,69,0,63,141,1,129,112,66,0,68,12,67,0,63,3,128,0,
+  1,128,12,63,96,68,12,67,0,16,66,12,46,128,0,1,128,12,63,97,66,12,69,0,
+  15,66,12,66,0,43,128,7,1,128,12,63,122,66,12,66,0,63,171,1,68,0,63,192,
+  1,66,12,63,128,1,66,12,41,66,12,63,157,3,130,0,7,63,128,1,67,0,40,129,
+  112,85,0,63,112,66,12,63,172,1,68,12,34,66,12,63,133,1,68,12,66,0,30,68,
+  12,63,132,1,68,12,66,0,30,68,12,63,136,1,129,112,63,172,1,68,0,31,128,0,
+  2,81,0,63,154,1,130,0,7,81,0,49,128,0,1,128,12,63,89,66,12,9,129,112,
+  80,0,49,128,0,3,128,12,63,87,68,12,59,67,12,13,128,0,3,128,12,63,87,68,
+  12,73,0,47,128,0,3,129,204,12,128,0,3,128,12,63,72,66,12,75,0,68,12,73,
+  0,46,129,0,4,128,12,11,129,1,2,128,12,63,73,66,12,76,0,2,74,0,46,129,
+  0,4,128,12,11,129,16,0,129,204,63,74,66,12,128,7,12,130,0,7,56,66,0,16,
+  129,16,83,0,66,12,63,125,128,0,1,128,12,2,84,0,17,129,0,0,129,204,63,125,
+  128,0,1,128,12,41,129,0,0,129,204,63,61,66,12,60,128,0,1,128,12,25,66,12,
+  12,127,7,0,58,66,12,74,0,63,15,128,1,1,128,12,63,79,66,12,128,7,63,25,
+  128,1,1,128,12,63,80,66,0,63,25,128,1,66,0,1,128,12,63,172,1,128,0,1,
+  128,12,63,172,1,128,0,1,128,12,63,203,12,128,0,1,128,12,63,163,1,128,0,1,
+  128,12,3,128,0,6,128,12,63,158,1,128,0,3,128,12,2,128,0,7,128,12,63,157,
+  1,128,0,3,128,12,2,128,0,7,128,12,63,157,1,128,0,3,128,12,3,128,0,6,
+  128,12,63,158,1,128,0,1,128,12,8,128,0,1,128,12,63,66,66,12,71,0,63,18,
+  128,0,1,128,12,11,129,0,0,129,204,63,61,68,12,70,0,26,128,0,1,128,12,50,
+  128,0,1,128,12,11,129,0,0,129,204,63,61,68,12,70,7,26,128,7,1,128,12,3,
+  80,0,15,128,7,1,128,12,25,129,0,0,129,204,63,61,68,12,83,0,13,128,0,1,
+  128,12,3,128,7,1,128,12,27,128,7,3,128,12,63,76,66,12,76,0,66,12,82,0,
+  23,128,0,1,128,12,27,128,0,63,80,68,12,73,0,48,66,12,27,128,0,13,128,0,
+  1,128,12,63,62,68,12,71,0,63,7,128,12,10,128,7,11,128,0,3,128,12,63,61,
+  68,12,69,0,63,9,129,12,1,128,12,19,128,0,3,128,12,63,62,66,12,68,0,63,
+  11,129,12,1,128,12,6,66,0,6,128,0,6,128,12,4,128,0,5,128,12,63,39,66,
+  12,76,0,45,128,7,76,0,17,128,0,1,128,12,6,128,0,1,128,12,4,128,0,8,
+  129,204,2,128,0,5,128,12,63,38,68,12,73,0,63,27,128,0,1,128,12,4,128,0,
+  3,128,12,0,129,0,0,129,204,2,128,0,5,128,12,63,38,68,12,71,0,63,30,66,
+  12,1,129,0,5,128,12,0,129,0,0,129,204,63,49,68,12,66,0,54,66,12,45,129,
+  0,0,68,12,63,57,66,12,67,7,13,66,12,128,0,63,22,129,0,0,129,204,63,50,
+  66,12,78,0,12,66,12,128,7,63,141,1,66,12,77,0,13,66,12,89,0,63,112,66,
+  12,128,0,2,77,0,63,28,128,0,1,128,12,63,54,66,12,128,0,0,66,12,80,0,
+  63,29,128,7,1,128,12,63,54,66,12,128,0,0,66,12,68,0,14,66,0,63,23,128,
+  7,1,128,12,11,128,0,1,128,12,63,38,66,12,66,0,66,12,67,0,12,66,12,66,
+  7,63,38,128,0,1,130,12,0,0,129,204,63,39,66,12,67,0,12,66,12,129,112,63,
+  39,128,0,1,130,12,0,0,129,204,63,39,66,12,16,66,12,63,45,129,0,0,129,204,
+  63,175,1,69,0,63,170,1,129,0,0,129,204,63,171,1,129,0,0,129,204,63,164,1,
+  72,0,66,12,63,103,129,112,82,0,38,129,0,63,40,76,0,60,129,112,82,0,38,128,
+  0,3,128,12,63,38,73,0,49,130,0,7,63,5,128,0,3,128,12,63,33,128,0,6,
+  69,0,62,66,12,60,129,204,63,41,68,0,63,62,66,12,63,32,73,12,56,66,12,63,
+  106,70,12,63,169,1,68,12,63,10,66,12,63,95,66,12,63,180,1,129,119,119,0,63,
+  116,66,12,119,0,128,7,77,0,63,102,66,12,119,0,128,7,77,0,63,100,129,0,2,
+  117,0,66,12,77,0,63,96,130,1,0,66,12,120,0,66,12,63,109,66,12,128,0,66,
+  12,120,0,66,12,43,129,112,99,0,63,27,66,12,128,0,66,12,63,40,128,0,1,128,
+  12,63,61,66,12,63,44,128,0,1,128,12,63,173,1,66,12,63,193,25,69,0,63,138,
+  5,66,12,63,210,3,127,55,0,63,153,4,66,12,63,169,1,67,0,63,90,66,0,63,
+  15,128,0,1,128,12,63,89,128,0,2,101,0,40,128,0,1,128,12,63,173,1,66,12,
+  63,175,1,67,0,18,127,41,0,25,68,12,40,92,0,10,67,0,17,129,0,63,67,66,
+  12,63,18,128,0,1,128,12,17,128,0,3,128,12,63,62,128,7,108,0,40,66,12,17,
+  128,0,3,128,12,1,127,38,0,20,67,12,42,66,12,1,83,0,15,66,12,21,129,204,
+  0,129,0,63,58,67,12,46,128,0,2,79,0,27,75,0,66,12,1,128,0,3,128,12,
+  63,54,67,12,63,28,67,0,1,128,12,12,128,0,3,128,12,63,98,70,0,44,128,0,
+  4,128,12,16,129,204,63,98,70,0,68,12,39,128,0,1,67,12,14,66,12,63,107,66,
+  12,41,66,12,63,120,68,12,63,171,1,68,12,63,230,2,67,0,63,171,1,69,0,63,
+  173,1,70,0,63,165,1,68,12,128,0,63,170,1,68,12,63,171,1,68,12,1,66,12,
+  63,167,1,66,12,63,50,127,161,3,0,1,128,12,63,52,129,0,3,66,12,127,48,0,
+  66,12,63,51,66,0,3,66,12,127,48,0,66,12,63,56,128,12,0,66,12,63,165,1,
+  68,12,127,171,1,0,63,144,5,68,12,63,171,1,68,12,63,172,1,66,12,63,236,8,
+  127,160,3,0,2,127,172,1,0,63,176,1,68,12,63,171,1,68,12,63,172,1,66,12,
+  63,222,30,63,154,12,66,11,63,173,1,66,11,63,172,1,128,0,66,11,63,172,1,127,
+  254,6,0,66,11,63,172,1,68,11,63,171,1,68,11,63,170,1,128,0,68,11,63,170,
+  1,129,0,66,11,63,171,1,129,0,66,11,63,172,1,128,0,66,11,63,120,66,11,48,
+  128,0,66,11,63,119,68,11,42,128,0,66,11,0,128,0,66,11,63,119,68,11,41,128,
+  0,68,11,128,0,66,11,1,66,11,63,112,70,11,41,128,0,68,11,69,0,66,11,63,
+  112,69,11,107,0,68,11,4,128,0,66,11,63,112,66,11,103,0,128,5,5,128,0,66,
+  11,4,66,11,127,157,1,0,128,5,13,68,11,63,113,106,0,128,5,12,128,0,68,11,
+  63,156,1,128,5,2,128,5,3,66,11,1,128,0,68,11,63,156,1,128,5,2,128,5,
+  2,128,0,66,11,1,129,0,66,11,63,156,1,128,5,2,128,5,3,128,0,66,11,2,
+  127,160,1,0,128,5,2,128,5,3,66,0,66,11,63,86,66,11,63,8,128,5,2,128,
+  5,6,66,11,63,86,66,11,97,0,66,11,34,128,5,2,128,5,1,67,11,0,66,11,
+  63,86,66,11,97,0,66,11,34,128,5,1,128,5,1,69,11,63,90,99,0,66,11,34,
+  128,5,1,128,5,1,69,11,63,63,66,11,59,66,0,66,11,31,128,5,1,128,5,0,
+  128,0,69,11,63,62,68,11,58,66,0,66,11,31,128,5,1,128,5,0,129,0,67,11,
+  63,63,68,11,125,0,66,11,31,128,5,0,128,5,1,127,69,0,68,11,124,0,66,11,
+  96,0,128,5,0,128,5,2,127,69,0,66,11,91,0,66,11,30,66,11,31,128,5,1,
+  128,5,5,128,5,63,66,93,0,66,11,23,128,5,4,128,1,66,11,31,128,5,1,128,
+  5,4,128,5,63,97,66,11,23,128,5,4,67,0,31,128,5,0,128,5,3,129,85,63,
+  98,130,17,0,0,66,11,19,128,5,4,71,0,1,66,11,22,128,5,0,128,5,2,128,
+  5,63,100,67,0,66,11,20,128,5,13,66,11,22,128,5,0,128,5,1,128,5,63,104,
+  68,11,19,128,5,13,66,11,21,128,5,1,66,5,63,105,68,11,83,0,128,5,9,66,
+  11,0,71,0,16,128,5,0,129,85,63,56,66,11,46,69,11,83,0,128,5,66,11,6,
+  66,11,24,128,5,1,128,5,63,56,68,11,93,0,12,72,11,83,0,128,5,67,11,5,
+  66,11,24,128,5,0,128,5,63,57,68,11,91,0,14,72,11,84,0,68,11,4,81,0,
+  8,128,5,1,128,5,63,57,68,11,89,0,16,66,11,128,0,68,11,84,0,68,11,31,
+  128,5,0,128,5,63,59,66,11,88,0,19,66,0,66,11,86,0,68,11,30,128,5,0,
+  128,5,63,62,129,0,66,11,13,66,11,23,92,0,128,5,68,11,29,128,5,66,11,63,
+  63,66,11,77,0,66,11,52,69,11,28,128,5,0,66,11,63,63,66,11,128,0,66,11,
+  9,66,11,52,72,11,25,128,5,0,66,11,63,64,66,0,66,11,74,0,129,17,7,128,
+  5,18,66,11,0,128,5,19,67,11,129,0,66,11,24,128,5,0,128,5,63,70,66,11,
+  73,0,10,128,5,18,66,11,0,128,5,19,128,0,66,11,1,66,11,24,129,85,63,72,
+  66,0,66,11,9,66,11,67,0,128,5,18,66,11,1,128,5,18,128,0,66,11,1,128,
+  5,25,128,5,0,128,5,63,74,68,11,8,66,11,68,0,128,5,17,130,0,5,1,128,
+  5,16,69,11,0,128,5,5,128,5,19,129,85,63,75,70,11,6,66,11,68,0,128,5,
+  20,128,5,1,128,5,15,66,11,129,80,1,128,5,4,128,5,19,129,85,63,76,71,11,
+  13,128,5,20,66,11,128,5,15,66,11,0,128,5,1,128,5,3,128,5,20,129,85,63,
+  77,70,11,128,0,66,11,9,128,5,15,66,11,1,66,11,0,128,5,14,67,0,128,5,
+  0,128,5,4,128,5,19,129,85,63,79,128,0,68,11,128,0,66,11,10,128,5,13,68,
+  11,0,66,11,0,128,5,18,128,5,0,128,5,3,128,5,20,128,5,63,82,66,11,129,
+  0,66,11,10,128,5,13,68,11,130,80,5,2,128,5,17,128,5,0,128,5,2,128,5,
+  20,129,85,63,83,81,0,128,5,13,68,11,128,0,0,129,85,1,128,5,16,128,5,0,
+  128,5,2,128,5,21,128,5,63,87,128,5,0,66,11,1,128,5,0,66,11,2,128,5,
+  14,66,11,66,0,129,85,1,128,5,16,128,5,0,128,5,1,128,5,21,129,85,63,88,
+  128,5,66,11,2,68,11,2,128,5,14,69,0,128,5,1,128,5,16,129,85,2,128,5,
+  21,128,5,63,90,66,11,2,68,11,2,128,5,15,66,11,1,129,85,0,128,5,16,129,
+  85,1,128,5,21,128,5,63,93,128,5,2,68,11,3,128,5,14,66,11,2,128,5,0,
+  128,5,16,129,85,0,128,5,21,66,11,63,93,128,5,1,128,0,66,11,68,0,128,5,
+  14,66,11,66,0,66,5,16,128,5,0,128,5,22,66,11,63,94,129,85,0,129,80,70,
+  0,128,5,14,69,0,128,5,0,128,5,14,66,5,22,128,5,66,11,63,96,128,5,1,
+  128,5,5,128,5,14,69,0,128,5,0,128,5,14,66,5,22,128,5,63,100,128,5,0,
+  128,5,6,128,5,19,128,5,0,128,5,12,66,11,128,5,22,128,5,63,102,66,11,5,
+  128,5,20,129,85,12,66,11,22,128,5,63,103,66,11,128,5,5,128,5,19,129,85,12,
+  66,11,22,128,5,63,103,66,11,128,5,5,128,5,19,129,85,12,130,0,5,21,128,5,
+  63,105,66,0,128,5,5,128,5,18,129,85,14,128,5,20,128,5,63,109,66,11,3,128,
+  5,18,129,85,13,128,5,21,128,5,63,108,68,11,67,0,128,5,17,129,85,12,66,11,
+  19,128,5,63,109,68,11,67,0,128,5,18,128,5,11,68,11,17,128,5,63,110,68,11,
+  128,5,67,0,128,5,17,128,5,10,128,0,68,11,17,128,5,63,111,66,11,130,0,5,
+  2,128,5,17,129,85,9,128,0,68,11,16,128,5,63,114,67,0,129,85,1,128,5,16,
+  129,85,9,129,0,66,11,16,128,5,63,121,128,5,0,128,5,16,129,85,10,129,80,82,
+  0,128,5,50,66,11,63,68,128,5,0,128,5,15,66,11,10,128,5,17,128,5,49,128,
+  0,68,11,63,68,129,85,14,68,11,9,128,5,16,128,5,49,129,0,68,11,63,69,129,
+  85,13,68,11,9,128,5,16,128,5,30,128,0,67,11,13,129,0,68,11,63,69,66,11,
+  12,68,11,9,128,5,15,128,5,30,128,0,69,11,12,128,0,68,11,63,70,66,11,77,
+  0,66,11,74,0,128,5,14,128,5,31,128,0,69,11,12,128,0,66,11,63,72,66,11,
+  128,5,12,130,0,5,10,128,5,14,128,5,31,128,0,69,11,12,128,0,66,11,63,73,
+  66,0,129,85,13,128,5,9,128,5,13,128,5,27,66,11,2,128,0,67,11,33,128,0,
+  66,11,63,58,128,5,12,128,5,9,128,5,12,128,5,26,129,0,66,11,41,128,0,66,
+  11,63,59,128,5,12,128,5,8,128,5,11,128,5,27,129,0,66,11,41,128,0,66,11,
+  63,59,66,11,74,0,128,5,8,128,5,11,128,5,27,90,0,1,128,0,66,11,63,77,
+  66,11,75,0,128,5,7,128,5,10,128,5,57,128,0,66,11,63,77,66,11,129,85,9,
+  128,5,7,128,5,9,128,5,22,69,5,29,128,0,66,11,63,82,128,5,9,128,5,6,
+  128,5,9,128,5,20,129,85,5,73,5,22,66,11,63,81,128,5,8,128,5,6,128,5,
+  8,128,5,19,129,85,17,69,5,16,66,11,63,82,66,11,6,128,5,5,128,5,7,128,
+  5,18,129,85,25,67,5,12,66,11,63,82,66,11,70,0,128,5,5,128,5,4,66,11,
+  128,5,16,129,85,31,66,5,63,95,66,11,128,5,6,128,5,4,128,5,3,68,11,14,
+  129,85,63,133,1,66,0,128,5,5,128,5,4,128,5,2,128,0,68,11,12,129,85,63,
+  139,1,128,5,5,128,5,3,128,5,2,128,0,68,11,10,129,85,63,142,1,128,5,4,
+  128,5,3,128,5,2,129,0,66,11,8,66,5,63,145,1,128,5,4,128,5,2,128,5,
+  3,128,5,73,0,129,85,63,149,1,129,85,2,128,5,2,128,5,3,128,5,7,129,85,
+  56,129,1,69,11,63,88,128,5,2,128,5,1,128,5,2,128,5,6,129,85,49,128,0,
+  66,11,3,129,16,71,11,63,88,128,5,1,128,5,1,128,5,1,128,5,5,129,85,50,
+  128,0,68,11,2,129,16,71,11,63,89,128,5,1,128,5,0,128,5,1,128,5,3,129,
+  85,42,72,5,0,128,0,68,11,2,129,16,71,11,63,90,128,5,0,128,5,0,128,5,
+  0,128,5,2,129,85,34,73,5,2,129,85,4,128,0,68,11,3,129,1,69,11,63,92,
+  68,5,1,129,85,34,129,85,10,129,85,7,67,11,8,127,14,0,53,66,11,71,0,66,
+  11,79,0,68,5,33,66,5,10,129,85,9,66,11,13,129,0,66,11,63,58,68,11,70,
+  0,66,11,68,0,79,5,4,66,11,22,66,5,12,128,5,11,66,11,13,129,0,66,11,
+  63,58,68,11,128,0,69,5,66,11,68,5,8,129,85,0,72,5,66,11,20,129,85,13,
+  129,85,66,11,26,129,0,66,11,63,58,68,11,128,5,19,66,5,1,129,85,0,128,5,
+  0,66,5,1,66,11,68,5,128,0,66,11,8,66,5,13,130,85,0,68,11,63,74,66,
+  11,76,0,66,11,83,0,129,85,4,129,85,0,128,5,3,66,5,6,128,5,66,11,129,
+  85,4,129,85,14,129,85,1,128,0,69,11,63,72,68,11,74,0,129,85,18,66,5,5,
+  128,5,0,128,5,1,128,5,5,129,85,4,128,0,66,11,1,68,5,13,69,5,0,128,
+  0,70,11,6,128,0,66,11,63,60,68,11,72,0,129,85,18,129,85,8,128,5,0,128,
+  5,2,128,5,6,66,5,11,129,85,3,128,0,67,11,67,5,5,66,5,69,11,5,128,
+  0,68,11,63,59,68,11,70,0,129,85,17,66,5,9,128,5,1,128,5,3,128,5,8,
+  66,5,10,129,85,1,128,0,67,11,0,76,0,68,11,67,5,1,128,0,68,11,63,60,
+  66,11,69,0,129,85,17,129,85,12,128,5,1,128,5,3,128,5,11,129,85,9,67,5,
+  67,11,0,66,11,9,128,0,66,11,3,129,80,70,11,4,128,1,67,11,128,0,66,11,
+  63,36,66,11,77,0,129,85,16,66,5,14,128,5,1,128,5,4,128,5,12,66,5,2,
+  67,5,2,129,85,3,66,11,7,129,0,66,11,3,129,0,73,11,2,128,1,67,11,128,
+  0,66,11,63,35,68,11,74,0,129,85,15,66,5,16,128,5,2,128,5,4,128,0,66,
+  11,12,66,5,8,129,85,1,66,11,7,129,0,66,11,3,129,0,68,11,0,128,0,66,
+  11,2,128,1,67,11,128,0,66,11,63,35,68,11,72,0,129,85,15,129,85,19,128,5,
+  2,128,5,4,128,0,66,11,26,129,85,10,129,0,66,11,1,128,0,71,11,0,128,0,
+  66,11,63,47,68,11,67,0,68,5,14,66,5,20,128,5,3,128,5,4,128,0,66,11,
+  28,129,85,15,128,0,66,11,128,0,66,11,63,54,66,11,68,5,1,128,5,10,67,0,
+  129,85,23,128,5,3,128,5,7,128,5,30,128,5,14,128,0,66,11,63,49,81,0,128,
+  5,10,66,11,129,85,25,128,5,3,128,5,8,128,5,29,129,85,63,65,66,11,79,0,
+  128,5,11,66,11,90,0,128,5,4,128,5,9,128,5,29,129,85,63,61,69,11,79,0,
+  128,5,8,66,5,66,11,26,128,5,4,128,5,10,128,5,28,128,5,0,128,5,92,0,
+  63,27,67,0,69,11,14,128,5,7,129,85,31,128,5,5,128,5,11,128,5,28,130,5,
+  5,66,11,63,50,66,11,66,0,66,11,68,0,66,11,72,0,128,5,5,66,5,33,128,
+  5,5,128,5,11,128,5,28,130,5,0,66,11,10,76,0,63,26,66,11,66,0,66,11,
+  68,0,66,11,71,0,128,5,1,129,0,67,5,34,128,5,6,128,5,12,128,5,28,128,
+  5,0,66,11,10,128,0,66,11,0,71,0,63,26,66,11,2,66,11,68,0,66,11,70,
+  0,128,5,1,66,11,128,0,0,128,5,35,128,5,6,128,5,13,128,5,27,128,5,14,
+  128,0,66,11,0,128,0,66,11,63,36,66,11,77,0,67,5,66,11,129,80,36,128,5,
+  6,128,5,14,128,5,27,128,5,14,66,11,0,128,0,66,11,63,51,66,5,2,66,11,
+  128,5,36,128,5,7,128,5,14,128,5,48,66,11,63,49,129,85,0,128,5,5,128,5,
+  37,128,5,7,128,5,15,128,5,50,67,0,63,44,128,5,1,128,5,4,129,85,37,128,
+  5,8,128,5,16,128,5,49,128,0,66,11,63,43,128,5,1,128,5,4,128,5,39,128,
+  5,8,128,5,17,128,5,48,128,0,66,11,63,42,128,5,7,128,5,39,128,5,9,128,
+  5,18,128,5,39,128,0,66,11,4,66,11,63,41,128,5,7,128,5,40,128,5,9,128,
+  5,18,128,5,38,128,0,68,11,63,33,66,11,74,0,128,5,7,128,5,41,128,5,8,
+  129,80,83,0,128,5,37,128,0,68,11,63,32,70,11,70,0,128,5,7,128,5,39,66,
+  11,73,0,66,11,19,128,5,36,128,0,68,11,63,29,73,11,69,0,128,5,5,66,5,
+  40,66,11,73,0,66,11,20,128,5,36,128,0,66,11,63,29,74,11,68,0,128,5,2,
+  68,5,42,66,11,73,0,66,11,20,128,5,63,70,71,11,70,0,70,5,46,128,5,10,
+  66,11,21,128,5,63,69,68,11,69,0,71,5,49,128,5,10,66,11,22,128,5,63,69,
+  66,11,67,0,66,5,0,66,5,52,128,5,11,66,11,23,128,5,63,77,129,85,55,128,
+  5,12,128,5,25,128,5,63,73,66,11,120,0,128,5,13,128,5,25,128,5,63,73,67,
+  11,55,128,5,13,128,5,26,128,5,63,72,67,11,53,129,80,78,0,128,5,27,128,5,
+  63,68,66,11,128,0,66,11,52,66,11,78,0,128,5,28,128,5,63,63,66,11,128,0,
+  66,11,120,0,66,11,78,0,128,5,29,128,5,63,62,66,11,128,1,66,11,120,0,66,
+  11,14,128,5,29,128,5,98,0,63,27,66,11,128,1,60,128,5,16,128,5,28,66,11,
+  63,124,128,5,17,128,5,28,66,11,63,124,128,5,18,128,5,27,66,11,128,5,63,123,
+  128,5,18,128,5,30,128,5,63,122,128,5,20,128,5,30,128,5,63,121,128,5,20,128,
+  5,31,128,5,63,119,128,5,22,128,5,31,129,85,63,117,128,5,22,128,5,33,128,5,
+  63,115,128,5,24,128,5,33,129,85,63,113,128,5,25,128,5,34,128,5,63,111,129,85,
+  25,128,5,35,129,85,63,109,128,5,27,128,5,36,129,85,63,106,129,85,27,128,5,38,
+  128,5,63,104,129,85,29,128,5,38,129,85,63,102,129,85,29,128,5,40,71,5,63,93,
+  128,5,0,128,5,30,128,5,40,128,5,5,72,5,63,83,128,5,0,128,5,25,69,0,
+  128,5,40,128,5,63,98,128,5,0,128,5,25,66,11,3,128,5,40,128,5,63,96,128,
+  5,1,128,5,25,66,11,4,128,5,40,128,5,63,94,128,5,1,128,5,26,66,11,5,
+  128,5,39,128,5,63,94,128,5,1,128,5,36,128,5,39,128,5,63,92,128,5,1,128,
+  5,38,128,5,38,128,5,0,128,0,66,11,63,87,128,5,1,128,5,38,128,5,39,129,
+  5,66,11,63,86,128,5,2,128,5,39,128,5,39,128,5,66,11,63,85,128,5,2,128,
+  5,36,68,0,128,5,38,128,5,63,88,128,5,2,128,5,36,66,11,2,128,5,34,67,
+  0,128,5,63,86,128,5,0,130,0,5,37,66,11,3,128,5,33,128,0,66,11,0,128,
+  5,63,84,128,5,0,66,11,128,5,101,0,66,11,38,128,0,66,11,0,128,5,63,84,
+  128,5,68,11,127,9,0,7,66,11,1,128,5,63,82,128,5,0,68,11,127,7,0,14,
+  128,5,18,127,42,0,20,129,85,68,11,41,66,11,37,67,0,128,5,16,129,0,66,11,
+  63,58,129,85,1,66,11,42,66,11,37,129,0,66,11,16,128,0,68,11,63,58,128,5,
+  0,129,80,108,0,66,11,37,129,0,66,11,16,128,0,68,11,1,127,39,0,16,128,5,
+  0,66,11,127,4,0,18,66,11,17,68,11,0,129,0,66,11,63,52,128,5,0,66,11,
+  112,0,66,11,77,0,30,75,0,66,11,1,128,0,68,11,63,50,66,5,66,11,47,68,
+  11,40,128,0,69,11,12,128,0,68,11,63,50,66,5,50,68,11,40,128,0,69,11,13,
+  68,11,63,50,129,85,44,70,0,68,11,40,128,0,69,11,14,66,11,63,51,129,85,44,
+  68,11,2,66,11,43,127,68,0,5,129,85,44,68,11,49,128,0,66,11,63,69,130,80,
+  5,44,68,11,49,128,0,66,11,63,69,66,11,63,37,66,11,63,69,66,11,63,167,1,
+  69,0,66,11,63,166,1,128,0,66,11,73,0,63,162,1,68,11,0,66,11,72,0,63,
+  158,1,68,11,0,66,11,76,0,63,154,1,68,11,0,66,11,63,168,1,66,11,63,163,
+  2,127,177,1,0,66,11,63,52,66,11,128,0,0,66,11,63,48,128,0,66,11,63,50,
+  129,0,66,11,128,0,0,66,11,63,49,66,11,63,49,128,0,68,11,1,66,11,63,165,
+  1,68,11,2,66,11,63,165,1,68,11,63,171,1,68,11,63,170,1,68,11,127,171,1,
+  0,68,11,127,171,1,0,68,11,63,172,1,66,11,63,221,10,127,175,1,0,66,11,127,
+  172,1,0,68,11,127,171,1,0,68,11,127,171,1,0,68,11,63,172,1,66,11,63,239,
+  28,63,171,10,66,11,63,172,1,128,0,1,128,11,63,172,1,128,0,1,128,11,63,172,
+  1,127,254,6,0,66,11,63,175,1,129,187,63,170,1,128,0,3,128,11,63,170,1,128,
+  0,3,128,11,63,170,1,129,0,63,175,1,128,0,1,128,11,63,172,1,128,0,1,128,
+  11,63,119,66,11,52,128,11,63,118,68,11,43,66,11,63,172,1,68,11,5,66,11,63,
+  112,70,11,48,68,0,63,121,107,0,63,129,1,111,0,2,68,0,66,11,127,157,1,0,
+  7,70,0,68,11,63,150,3,66,11,63,172,1,128,0,1,128,11,1,128,0,2,127,157,
+  1,0,8,128,0,1,128,11,2,127,84,0,66,11,63,18,66,0,66,11,63,85,66,11,
+  63,20,128,0,1,128,11,63,122,66,11,42,67,11,128,0,1,128,11,63,85,100,0,48,
+  128,11,0,127,125,0,43,128,0,4,128,11,63,62,66,11,59,67,0,66,11,36,128,0,
+  4,128,11,63,61,68,11,61,128,0,1,128,11,36,129,0,63,133,1,128,0,1,128,11,
+  37,127,67,0,63,2,66,11,96,0,63,74,128,0,2,90,0,66,11,63,143,1,93,0,
+  66,11,74,0,63,162,1,66,11,67,0,27,66,1,63,139,1,130,0,1,66,11,63,173,
+  1,67,11,35,128,1,1,128,11,63,132,1,68,11,34,128,0,1,128,11,63,168,1,66,
+  11,0,128,0,1,128,11,63,80,66,11,47,69,11,20,67,11,63,93,68,11,42,66,11,
+  5,84,0,3,129,187,63,92,68,11,94,0,11,66,11,128,0,30,128,11,4,79,0,63,
+  71,68,11,92,0,13,66,11,129,0,63,127,91,0,16,67,0,25,128,5,63,98,66,0,
+  66,11,13,66,11,53,129,5,63,100,66,11,77,0,66,11,67,0,49,69,11,63,96,66,
+  11,128,0,66,11,9,66,11,128,0,59,66,11,63,93,66,0,66,11,77,0,27,66,11,
+  27,128,0,1,128,11,63,96,66,11,75,0,54,128,0,4,128,0,1,128,11,63,97,66,
+  0,66,11,10,66,11,46,69,11,1,128,5,90,0,63,75,68,11,36,130,0,5,19,69,
+  11,63,105,70,11,60,130,80,0,63,105,71,11,6,71,0,20,66,11,17,67,0,63,115,
+  128,0,66,11,26,66,11,1,66,11,128,0,16,67,0,63,109,128,0,4,128,0,66,11,
+  74,0,14,68,11,0,66,11,128,0,63,135,1,129,0,66,11,75,0,13,68,11,128,0,
+  0,130,85,0,63,133,1,82,0,13,68,11,128,0,63,142,1,66,11,3,66,11,21,67,
+  0,63,140,1,66,11,66,0,68,11,18,69,0,63,140,1,66,11,66,0,68,11,67,0,
+  15,66,11,63,143,1,129,85,66,0,68,11,67,0,15,66,11,66,0,46,66,11,63,99,
+  69,0,14,66,11,67,0,63,146,1,129,80,69,0,15,69,0,63,222,1,90,0,63,120,
+  66,11,63,238,2,66,11,128,5,63,172,1,66,11,128,5,42,130,0,5,63,126,66,11,
+  128,0,63,176,1,66,11,63,172,1,68,11,38,66,11,63,129,1,68,11,68,0,32,68,
+  11,63,128,1,68,11,128,5,63,174,1,129,0,63,172,1,68,0,35,128,0,2,81,0,
+  63,155,1,129,80,81,0,63,141,1,66,11,63,20,129,0,0,129,187,63,83,68,11,63,
+  18,129,0,2,129,187,63,82,68,11,74,0,51,66,11,15,129,0,2,129,187,63,66,66,
+  11,12,68,11,74,0,54,128,11,19,129,187,63,66,66,11,77,0,2,75,0,49,128,0,
+  4,128,11,12,128,0,3,129,187,63,67,66,11,128,5,13,130,0,5,60,128,0,4,128,
+  11,12,128,0,1,128,11,63,71,66,0,63,9,66,11,1,129,0,3,128,11,12,85,0,
+  66,11,63,125,128,0,1,128,11,2,129,0,1,128,11,33,129,0,0,129,187,63,125,128,
+  0,1,128,11,41,129,0,0,129,187,63,56,66,11,63,2,88,0,20,127,5,0,55,66,
+  11,75,0,63,18,128,0,1,128,11,63,75,66,11,128,5,63,29,128,0,1,128,11,63,
+  76,66,0,63,29,128,0,1,128,11,63,174,1,128,0,1,128,11,63,172,1,128,0,1,
+  128,11,63,80,66,11,71,0,63,17,128,0,1,128,11,63,80,66,11,71,0,63,165,1,
+  66,11,128,5,63,201,9,128,0,4,128,11,63,159,1,128,0,1,128,11,4,128,0,6,
+  128,11,63,157,1,128,0,3,128,11,3,128,0,6,128,11,63,157,1,128,0,3,128,11,
+  3,128,0,6,128,11,63,157,1,128,0,3,128,11,4,128,0,4,128,11,63,158,1,128,
+  0,2,128,11,63,74,66,11,72,0,66,11,80,0,63,1,128,0,1,128,11,14,128,0,
+  1,128,11,63,55,68,11,71,0,66,11,69,0,20,128,0,1,128,11,50,128,0,1,128,
+  11,14,128,0,1,128,11,63,55,68,11,66,0,4,66,11,69,5,20,128,5,1,128,11,
+  37,128,0,1,128,11,27,128,0,1,128,11,63,55,68,11,129,80,35,128,0,1,128,11,
+  4,128,0,1,128,11,27,128,0,3,128,11,63,87,66,11,129,85,45,128,5,1,128,11,
+  27,128,0,63,143,1,128,0,1,128,11,27,128,0,13,128,0,1,128,11,63,145,1,128,
+  11,11,128,5,11,128,0,3,128,11,63,144,1,128,11,24,128,0,3,128,11,63,144,1,
+  129,11,1,128,11,18,128,5,5,128,11,4,128,0,2,129,11,1,128,11,63,34,66,11,
+  78,0,63,15,128,0,1,128,11,8,128,0,1,128,11,4,128,0,6,68,0,0,128,0,
+  2,129,11,1,128,11,63,33,68,11,75,0,48,128,5,78,0,15,128,0,1,128,11,8,
+  128,0,1,128,11,4,128,0,3,128,11,0,129,0,0,129,187,1,128,0,2,129,11,1,
+  128,11,63,33,68,11,73,0,63,32,128,0,1,128,11,1,67,0,3,128,11,0,129,0,
+  0,129,187,63,44,68,11,68,0,63,43,128,0,1,129,11,1,128,11,3,66,11,63,45,
+  66,11,128,0,60,66,11,47,128,0,1,128,11,63,77,66,11,66,5,63,26,66,11,63,
+  45,66,11,80,0,11,66,11,91,0,63,110,69,11,80,0,11,66,11,91,0,63,110,69,
+  11,79,0,63,32,128,0,1,128,11,63,47,66,11,67,0,66,11,81,0,63,33,128,5,
+  1,128,11,63,47,66,11,67,0,66,11,68,0,66,11,72,0,63,34,128,0,1,128,11,
+  10,128,0,1,128,11,63,32,66,11,67,0,66,11,68,0,66,11,71,0,0,66,11,129,
+  85,63,44,128,0,1,128,11,0,128,0,1,128,11,63,34,66,11,68,0,66,11,8,66,
+  11,66,0,63,43,128,0,1,128,11,0,128,0,1,128,11,63,54,66,11,129,0,63,49,
+  128,0,1,128,11,63,160,3,129,0,0,129,187,63,171,1,129,0,0,129,187,63,163,1,
+  73,0,0,129,187,63,162,1,129,0,63,36,77,0,63,60,128,0,3,128,11,63,34,74,
+  0,49,130,0,5,9,129,80,84,0,38,128,0,3,128,11,63,28,129,0,6,70,0,63,
+  0,129,80,85,0,41,129,187,63,26,66,11,128,0,6,69,0,63,65,66,11,63,26,75,
+  11,57,66,11,63,103,68,11,128,0,0,129,187,63,167,1,68,11,68,0,63,167,1,66,
+  11,63,181,1,123,0,63,115,67,11,120,0,63,115,67,11,119,0,63,114,129,0,0,66,
+  11,119,0,128,5,63,109,130,0,1,66,11,121,0,63,111,66,11,128,0,66,11,121,0,
+  63,111,66,11,128,0,66,11,57,66,11,45,128,0,1,128,11,63,58,66,11,63,47,128,
+  0,1,128,11,63,172,1,128,0,1,128,11,63,166,35,127,55,0,63,153,4,66,11,63,
+  154,3,67,0,63,87,128,0,66,5,63,17,128,0,1,128,11,63,86,128,0,2,127,10,
+  0,7,128,0,1,128,11,63,173,1,66,11,63,133,1,91,0,36,127,42,0,21,68,11,
+  63,21,86,0,63,64,66,11,63,22,85,0,3,128,11,63,106,66,11,39,128,0,1,128,
+  11,16,128,0,3,128,11,1,127,39,0,63,45,66,11,20,129,187,0,66,0,1,128,11,
+  63,143,1,66,11,3,78,0,66,11,1,129,0,2,129,187,63,51,66,11,63,34,82,0,
+  2,129,187,63,152,1,128,0,1,128,11,13,128,0,1,66,11,63,95,71,0,45,66,11,
+  0,66,11,15,66,11,63,152,1,129,0,0,129,187,63,179,2,128,1,110,0,68,11,63,
+  227,1,66,11,63,174,2,66,11,67,0,66,11,63,165,1,68,11,77,0,63,157,1,68,
+  11,81,0,63,153,1,68,11,128,0,63,171,1,66,11,66,0,66,11,63,173,1,66,11,
+  63,159,2,127,177,1,0,1,128,11,63,56,127,53,0,1,128,11,63,49,129,0,3,66,
+  11,127,51,0,66,11,63,53,128,11,0,66,11,127,165,1,0,68,11,66,0,66,11,63,
+  165,1,68,11,127,171,1,0,63,175,1,68,11,127,171,1,0,68,11,127,171,1,0,68,
+  11,63,172,1,66,11,63,221,10,127,159,3,0,2,127,172,1,0,68,11,127,171,1,0,
+  68,11,63,171,1,68,11,63,172,1,66,11,63,144,25,63,187,8,66,10,63,173,1,66,
+  10,63,173,1,66,10,63,173,1,127,254,6,0,66,10,63,172,1,68,10,63,170,1,128,
+  0,68,10,63,170,1,128,0,68,10,63,170,1,129,0,66,10,63,172,1,66,10,63,119,
+  66,10,50,66,10,63,118,68,10,49,66,10,63,118,68,10,44,66,10,0,128,0,66,10,
+  63,118,68,10,43,68,10,128,0,66,10,1,66,10,63,111,69,10,108,0,68,10,69,0,
+  66,10,63,111,66,10,111,0,68,10,4,128,0,66,10,63,111,66,10,112,0,66,10,4,
+  66,10,127,172,1,0,68,10,63,170,1,128,0,68,10,63,170,1,128,0,68,10,63,165,
+  1,66,10,1,129,0,66,10,63,166,1,66,10,2,127,83,0,66,10,63,20,66,10,63,
+  86,66,10,98,0,66,10,47,66,10,63,84,66,10,98,0,66,10,43,66,10,0,66,10,
+  63,85,100,0,66,10,42,71,10,63,122,67,0,66,10,37,128,0,68,10,63,125,67,0,
+  66,10,37,128,0,68,10,63,61,66,10,127,1,0,66,10,37,128,0,68,10,63,60,68,
+  10,125,0,66,10,96,0,7,128,0,66,10,63,61,68,10,125,0,66,10,96,0,63,73,
+  68,10,90,0,66,10,31,66,10,63,107,66,10,91,0,66,10,31,99,0,63,105,66,10,
+  31,98,0,63,106,70,0,63,173,1,67,10,36,66,10,63,132,1,68,10,35,66,10,63,
+  132,1,68,10,30,66,10,1,66,10,63,79,66,10,44,66,10,1,68,10,20,67,10,5,
+  66,10,1,67,0,63,77,68,10,43,72,10,84,0,0,68,10,4,66,10,63,83,68,10,
+  97,0,9,69,10,87,0,0,68,10,4,77,0,63,72,68,10,95,0,11,66,0,70,10,
+  20,68,10,63,92,66,10,94,0,13,67,0,69,10,20,128,5,67,10,63,93,67,0,66,
+  10,43,69,10,21,128,0,66,10,63,97,66,10,12,66,10,69,0,22,89,0,70,10,30,
+  66,10,63,61,69,10,9,66,10,68,0,49,70,10,29,128,0,66,10,63,61,66,0,66,
+  10,73,0,66,10,66,0,51,73,10,26,128,5,66,10,63,64,66,10,78,0,26,66,10,
+  87,0,66,10,66,0,66,10,26,128,5,127,83,0,28,66,10,128,0,19,69,10,2,66,
+  10,63,100,66,10,9,66,10,68,0,18,66,10,128,0,19,69,10,63,105,69,10,7,66,
+  10,68,0,42,66,10,128,5,67,0,63,103,70,10,6,66,10,69,0,41,67,0,63,107,
+  70,10,128,1,30,66,10,1,66,10,63,130,1,69,10,128,0,0,66,10,25,68,10,0,
+  66,10,63,132,1,66,10,66,0,66,10,25,68,10,0,66,10,63,133,1,128,1,67,0,
+  66,10,25,68,10,63,171,1,128,0,66,10,66,0,63,141,1,66,10,2,66,10,68,0,
+  14,70,0,63,140,1,66,10,1,68,10,67,0,16,66,10,63,142,1,66,10,1,68,10,
+  68,0,15,66,10,63,147,1,68,10,68,0,15,66,10,49,66,10,63,95,66,10,70,0,
+  14,70,0,45,66,10,63,173,1,66,10,63,144,1,66,10,63,173,1,66,10,63,173,1,
+  66,10,63,126,66,10,43,130,0,5,63,126,66,10,63,173,1,69,10,63,172,1,68,10,
+  39,66,10,63,128,1,68,10,68,0,33,68,10,63,127,68,10,128,5,37,68,10,63,128,
+  1,66,10,129,0,37,68,10,63,129,1,68,0,36,128,0,66,10,82,0,63,154,1,129,
+  80,82,0,63,230,1,66,10,63,83,66,10,63,22,68,10,63,81,68,10,63,20,128,0,
+  68,10,63,81,68,10,62,128,0,66,10,16,128,0,68,10,63,64,66,10,128,5,12,68,
+  10,61,128,0,68,10,13,128,0,69,10,63,65,66,10,128,5,13,66,10,62,128,0,68,
+  10,13,128,0,66,10,127,22,0,45,66,10,128,0,63,16,128,0,68,10,13,128,0,66,
+  10,63,146,1,128,0,66,10,2,128,0,66,10,75,0,23,129,0,66,10,63,124,128,0,
+  66,10,3,78,0,23,129,0,66,10,63,54,66,10,63,3,128,0,66,10,42,129,0,66,
+  10,63,54,66,10,63,173,1,66,10,63,31,66,10,63,75,66,0,63,31,66,10,63,173,
+  1,66,10,63,175,1,128,0,66,10,63,79,66,10,63,26,128,0,66,10,63,79,66,10,
+  20,66,10,63,2,128,0,66,10,63,79,66,10,19,68,10,63,148,1,66,0,19,68,10,
+  63,171,1,68,10,63,171,1,128,0,66,10,75,0,63,161,1,128,5,74,0,63,218,3,
+  129,0,68,10,63,159,1,128,0,66,10,4,129,0,70,10,63,157,1,128,0,68,10,3,
+  129,0,70,10,63,157,1,128,0,68,10,3,129,0,70,10,63,157,1,128,0,68,10,4,
+  129,0,68,10,63,158,1,128,0,67,10,63,72,66,10,73,0,66,10,63,19,128,0,66,
+  10,14,129,0,66,10,63,52,68,10,72,0,66,10,27,66,10,51,128,0,66,10,14,129,
+  0,66,10,63,52,68,10,67,0,4,66,10,27,66,10,38,128,0,66,10,27,129,0,66,
+  10,63,52,68,10,128,0,38,66,10,5,128,0,66,10,27,128,0,68,10,63,71,66,10,
+  74,0,66,10,128,0,48,128,5,66,10,27,128,0,68,10,63,70,68,10,75,0,50,128,
+  0,66,10,27,128,0,69,10,7,71,0,63,53,68,10,73,0,63,4,128,0,67,10,12,
+  128,5,68,10,6,129,0,66,10,63,57,68,10,71,0,63,6,128,5,67,10,12,128,0,
+  68,10,6,128,0,68,10,63,57,66,10,70,0,63,8,128,0,67,10,0,128,0,66,10,
+  8,128,0,66,10,5,128,5,70,10,4,68,10,127,9,0,27,81,0,63,16,128,0,66,
+  10,8,128,0,66,10,4,128,0,71,10,4,68,10,128,0,66,10,63,32,66,10,77,0,
+  63,18,128,0,66,10,8,128,0,66,10,4,128,0,70,10,128,0,66,10,1,68,10,128,
+  0,66,10,63,31,68,10,74,0,50,66,10,42,128,0,66,10,4,128,0,68,10,1,128,
+  0,66,10,7,66,10,63,31,68,10,69,0,55,66,10,48,129,0,69,10,2,128,0,66,
+  10,63,42,68,10,61,66,10,48,129,0,66,10,63,53,66,10,17,66,10,128,0,63,29,
+  129,0,66,10,63,42,66,10,81,0,10,66,10,128,5,63,138,1,129,0,66,10,81,0,
+  10,66,10,92,0,63,109,69,10,80,0,63,33,90,0,63,22,66,10,67,0,66,10,82,
+  0,63,34,128,0,66,10,63,45,66,10,67,0,66,10,69,0,66,10,63,44,128,0,66,
+  10,10,128,0,66,10,63,30,66,10,67,0,66,10,69,0,66,10,8,129,0,66,5,63,
+  31,66,10,10,128,0,66,10,0,129,0,66,10,63,31,66,10,69,0,66,10,7,66,10,
+  67,0,63,44,128,0,66,10,0,129,0,66,10,63,31,66,10,16,66,10,66,0,63,50,
+  129,0,66,10,63,51,66,10,63,170,2,129,16,127,18,0,63,92,128,1,66,10,63,172,
+  1,128,1,66,10,63,163,1,128,0,66,10,5,66,10,63,162,1,128,0,68,10,63,29,
+  66,10,75,0,63,62,128,0,68,10,63,28,70,10,71,0,50,130,0,5,63,9,128,0,
+  68,10,63,25,130,1,0,70,10,70,0,51,66,10,9,129,80,85,0,39,128,0,66,10,
+  63,25,66,10,128,0,70,10,69,0,52,66,10,9,66,10,63,89,68,10,128,0,66,10,
+  68,0,56,66,10,9,66,10,63,89,68,10,69,0,63,9,66,10,63,89,68,10,63,15,
+  66,10,63,90,66,10,63,180,1,68,10,63,171,1,68,10,63,171,1,68,10,63,168,1,
+  66,10,124,0,128,5,63,107,66,10,128,0,66,10,123,0,128,5,79,0,63,92,66,10,
+  128,0,66,10,121,0,66,10,80,0,30,128,5,97,0,63,25,66,10,66,0,58,66,10,
+  47,66,10,63,122,66,10,47,66,10,63,173,1,66,10,63,192,25,70,0,63,169,1,66,
+  10,63,173,1,66,10,63,173,1,66,10,63,211,3,66,10,63,173,1,66,10,63,173,1,
+  66,10,63,127,69,0,63,170,1,66,10,63,173,1,66,10,40,66,0,63,87,130,5,5,
+  38,66,10,40,128,0,66,10,63,85,128,5,66,10,127,8,0,10,128,0,66,10,63,85,
+  68,10,63,19,66,10,63,85,68,10,41,128,0,66,10,61,127,42,0,20,68,10,41,128,
+  0,66,10,60,129,0,66,10,63,59,128,5,66,10,42,128,0,66,10,39,85,0,68,10,
+  63,58,66,10,48,66,10,35,128,0,66,10,16,128,0,68,10,2,127,39,0,14,67,10,
+  47,68,10,34,128,0,66,10,17,68,10,1,129,0,66,10,63,50,67,10,47,68,10,35,
+  66,10,2,79,0,66,10,2,128,0,68,10,63,49,66,10,48,68,10,41,66,10,0,82,
+  0,68,10,63,102,66,10,42,66,10,0,128,0,66,10,14,68,10,63,94,79,0,37,66,
+  10,0,128,0,66,10,15,66,10,63,95,128,0,67,10,50,128,0,68,10,63,114,128,0,
+  67,10,50,128,0,66,10,63,67,66,10,128,1,45,67,10,50,128,0,66,10,63,67,66,
+  10,128,0,63,166,1,69,0,66,10,68,0,63,161,1,128,0,66,10,78,0,63,157,1,
+  68,10,63,171,1,68,10,1,86,0,63,146,1,68,10,0,66,10,127,168,1,0,66,10,
+  1,66,10,127,173,1,0,66,10,63,161,2,127,176,1,0,66,10,63,50,66,10,127,56,
+  0,66,10,63,48,129,0,66,10,128,0,0,66,10,63,51,66,10,63,47,66,0,66,10,
+  1,66,10,63,165,1,128,0,66,10,67,0,66,10,63,165,1,68,10,63,170,1,128,0,
+  68,10,63,170,1,128,0,68,10,63,170,1,68,10,63,171,1,68,10,63,171,1,68,10,
+  63,172,1,66,10,63,220,10,127,176,1,0,66,10,127,172,1,0,68,10,63,171,1,68,
+  10,63,171,1,68,10,63,172,1,66,10,63,160,23,63,204,6,66,10,63,172,1,128,0,
+  1,128,10,63,172,1,128,0,1,128,10,63,172,1,127,254,6,0,66,10,63,172,1,68,
+  10,63,139,5,128,0,2,127,173,1,0,63,121,66,10,50,128,0,1,128,10,63,117,68,
+  10,49,128,0,1,128,10,63,167,1,66,10,1,128,0,1,128,10,63,166,1,68,10,0,
+  128,0,1,128,10,1,66,10,63,110,69,10,108,0,5,69,0,1,128,10,63,113,111,0,
+  10,128,0,1,128,10,63,161,1,128,0,2,127,181,1,0,63,137,5,66,10,63,86,66,
+  10,63,173,1,66,10,63,211,1,66,10,45,129,0,0,129,170,63,84,101,0,47,69,10,
+  63,84,101,0,49,67,10,63,122,67,0,66,10,44,127,128,1,0,46,128,10,63,59,66,
+  10,63,172,1,68,10,62,66,10,96,0,7,128,0,2,127,60,0,68,10,126,0,44,127,
+  63,0,68,10,90,0,66,10,63,145,1,91,0,66,10,127,5,0,63,74,93,0,66,10,
+  127,5,0,63,105,77,0,63,166,1,66,10,37,66,10,63,131,1,68,10,63,171,1,68,
+  10,83,0,63,98,66,10,44,66,10,1,68,10,84,0,0,67,10,10,128,0,66,1,63,
+  76,68,10,43,66,10,128,0,68,10,85,0,4,128,10,63,90,68,10,100,0,6,66,10,
+  128,0,2,87,0,63,96,68,10,98,0,9,66,0,2,67,10,63,120,97,0,14,128,0,
+  26,128,0,63,96,97,0,45,128,0,63,99,66,10,77,0,66,10,27,90,0,68,10,63,
+  96,69,10,63,170,1,69,10,74,0,63,1,66,10,63,94,66,10,80,0,25,66,10,20,
+  75,10,63,95,81,0,50,69,10,63,105,66,10,10,66,10,56,90,0,63,74,68,10,36,
+  130,0,5,20,66,0,128,5,67,0,63,102,70,10,58,66,0,63,107,71,10,6,72,0,
+  14,66,10,2,66,10,63,166,1,68,10,63,135,1,128,0,5,66,10,75,0,13,68,10,
+  128,0,63,141,1,66,10,75,0,13,68,10,66,0,128,5,66,0,63,135,1,66,10,76,
+  0,16,67,0,63,147,1,66,10,19,69,0,63,140,1,66,10,66,0,68,10,19,66,10,
+  63,142,1,66,10,66,0,24,66,10,66,0,63,139,1,66,10,66,0,24,66,10,67,0,
+  63,144,1,128,0,2,69,0,15,69,0,46,128,0,1,128,10,63,94,130,0,5,63,11,
+  128,0,1,128,10,63,143,1,66,10,25,128,5,1,128,10,63,191,4,66,10,44,130,0,
+  5,63,125,66,10,128,0,63,172,1,69,10,41,66,10,63,126,128,0,44,68,10,63,126,
+  68,10,69,0,33,68,10,63,126,68,10,128,5,63,174,1,129,0,38,128,0,2,83,0,
+  63,109,68,0,37,130,0,5,83,0,63,154,1,129,80,83,0,63,251,2,66,10,63,23,
+  128,0,1,128,10,63,81,68,10,63,21,128,0,3,128,10,63,150,1,66,10,16,128,0,
+  3,128,10,63,63,66,10,63,22,129,170,15,128,0,3,128,10,63,80,128,0,2,75,0,
+  51,128,0,3,128,10,13,129,0,3,128,10,63,82,130,0,5,63,0,128,0,3,128,10,
+  13,129,0,0,129,170,63,66,67,0,63,12,66,10,1,128,0,3,128,10,13,129,0,0,
+  129,170,63,145,1,128,0,1,128,10,2,128,0,1,128,10,36,128,0,1,128,10,63,124,
+  128,0,1,128,10,43,128,0,1,128,10,63,52,66,10,75,0,56,86,0,24,128,0,1,
+  128,10,63,52,66,10,76,0,63,160,1,66,10,128,5,63,31,128,0,1,128,10,63,172,
+  1,128,0,1,128,10,63,172,1,128,0,1,128,10,63,192,2,66,10,71,0,63,165,1,
+  66,10,72,0,12,128,0,1,128,10,63,147,1,66,10,128,5,19,128,0,3,128,10,63,
+  170,1,128,0,3,128,10,63,170,1,128,0,3,128,10,63,171,1,128,0,1,128,10,63,
+  212,5,128,0,3,128,10,63,159,1,128,0,1,128,10,5,128,0,5,128,10,63,157,1,
+  128,0,3,128,10,4,128,0,5,128,10,63,157,1,128,0,3,128,10,4,128,0,5,128,
+  10,63,157,1,128,0,3,128,10,5,128,0,3,128,10,63,162,1,128,10,63,70,66,10,
+  94,0,63,23,128,0,1,128,10,63,50,68,10,72,0,66,10,70,0,21,88,0,50,128,
+  0,1,128,10,63,50,68,10,68,0,3,66,10,70,5,21,128,0,1,128,10,38,128,0,
+  1,128,10,28,128,0,1,128,10,63,50,68,10,66,0,5,66,10,28,128,5,1,128,10,
+  5,128,0,1,128,10,27,128,0,3,128,10,63,69,66,10,74,0,66,10,128,0,41,66,
+  10,5,128,5,1,128,10,27,128,0,3,128,10,63,68,68,10,76,0,51,128,0,1,128,
+  10,27,128,0,63,73,68,10,74,0,63,37,128,0,1,128,10,63,55,68,10,72,0,63,
+  38,128,0,3,128,10,63,55,66,10,71,0,63,38,128,5,5,128,10,3,128,0,63,153,
+  1,129,0,0,129,170,3,128,0,6,128,10,3,128,0,4,128,0,1,128,10,63,30,66,
+  10,78,0,63,32,129,0,0,129,170,3,128,0,5,129,10,1,128,10,0,128,0,4,128,
+  0,1,128,10,63,29,68,10,75,0,50,128,0,1,128,10,42,129,0,0,129,170,3,128,
+  0,3,128,10,1,128,0,1,128,10,6,128,0,1,128,10,63,29,68,10,70,0,55,128,
+  0,1,128,10,49,128,0,4,128,10,2,128,0,1,128,10,63,40,68,10,128,0,61,128,
+  0,1,128,10,49,128,0,1,128,10,63,51,66,10,72,0,9,67,0,63,31,128,0,1,
+  128,10,63,40,66,10,82,0,63,154,1,66,10,82,0,63,151,1,69,10,81,0,11,66,
+  10,63,131,1,68,0,67,10,83,0,63,35,129,0,0,129,170,63,42,66,10,66,0,67,
+  10,69,0,66,10,73,0,63,36,129,0,0,129,170,9,73,0,63,22,66,10,66,0,67,
+  10,69,0,66,10,72,0,63,37,129,0,0,129,170,9,128,0,1,128,10,1,67,0,63,
+  22,66,10,3,66,10,69,0,66,10,70,0,66,10,129,85,63,49,128,0,1,128,10,1,
+  128,0,1,128,10,63,29,66,10,78,0,0,66,10,68,0,63,47,66,10,1,128,0,1,
+  128,10,63,48,66,10,67,0,63,54,66,10,63,160,3,129,0,0,129,170,63,171,1,129,
+  0,0,129,170,63,162,1,128,0,1,128,10,4,129,0,0,129,170,63,161,1,128,0,3,
+  128,10,63,27,66,10,76,0,63,63,128,0,3,128,10,63,26,70,10,72,0,63,64,128,
+  0,3,128,10,63,26,70,10,71,0,63,66,128,0,1,128,10,63,23,66,10,128,0,70,
+  10,70,0,63,2,129,80,86,0,63,66,68,10,128,0,66,10,69,0,63,161,1,68,10,
+  70,0,63,164,1,68,10,72,0,63,163,1,66,10,128,0,63,180,1,128,0,2,121,0,
+  63,113,68,10,120,0,63,114,68,10,120,0,63,111,69,10,63,167,1,66,0,66,10,124,
+  0,63,108,66,10,128,0,66,10,124,0,128,5,63,107,66,10,67,0,63,169,1,66,10,
+  63,239,1,66,10,63,217,35,128,0,1,128,10,63,172,1,128,0,1,128,10,63,172,1,
+  128,0,1,128,10,63,251,6,66,0,63,86,130,0,5,63,175,1,127,8,0,63,100,68,
+  10,127,6,0,13,66,10,63,84,68,10,107,0,63,2,127,43,0,17,68,10,63,45,129,
+  0,63,109,66,10,0,80,0,22,85,0,3,128,10,63,108,128,0,2,76,0,44,128,0,
+  3,128,10,2,127,39,0,63,68,129,170,1,129,0,63,145,1,66,10,2,128,0,1,128,
+  10,12,66,10,2,128,0,3,128,10,63,100,68,10,41,128,0,1,128,10,0,82,0,3,
+  128,10,63,101,66,10,42,128,0,1,128,10,0,128,0,1,128,10,17,129,170,63,94,76,
+  0,42,66,0,1,128,10,15,66,10,63,99,128,10,53,66,10,63,64,129,0,66,1,48,
+  128,10,63,171,1,68,10,50,66,10,63,173,2,69,0,66,10,63,166,1,128,0,2,82,
+  0,63,143,3,127,170,1,0,68,10,63,172,1,66,10,63,178,1,66,10,63,161,2,127,
+  177,1,0,1,128,10,63,54,127,55,0,1,128,10,63,53,66,10,127,53,0,66,10,63,
+  47,129,0,0,129,170,0,66,10,127,166,1,0,2,67,0,66,10,63,165,1,68,10,127,
+  171,1,0,68,10,127,171,1,0,63,175,1,68,10,127,171,1,0,68,10,127,171,1,0,
+  68,10,63,172,1,66,10,63,221,10,127,159,3,0,2,127,172,1,0,68,10,127,171,1,
+  0,68,10,63,171,1,68,10,63,172,1,66,10,63,193,19,63,220,4,66,10,63,141,5,
+  127,254,6,0,66,10,63,175,1,129,170,63,170,1,128,0,3,128,10,63,170,1,128,0,
+  3,128,10,63,170,1,129,0,63,232,2,66,10,63,172,1,68,10,63,221,1,66,10,63,
+  172,1,68,10,6,66,10,63,110,69,10,108,0,63,128,1,111,0,63,176,1,128,0,2,
+  127,181,1,0,66,10,63,172,1,68,10,63,139,3,128,4,9,66,10,63,84,66,10,63,
+  11,128,4,8,128,0,1,128,10,1,128,0,2,127,78,0,66,10,100,0,66,10,34,128,
+  4,8,128,0,1,128,10,2,127,81,0,66,10,100,0,66,10,34,128,4,2,128,4,4,
+  127,128,1,0,1,128,10,34,128,4,2,128,4,3,66,10,128,0,1,128,10,63,121,101,
+  0,128,4,2,128,4,3,71,10,63,121,67,0,66,10,30,128,4,2,128,4,10,128,10,
+  63,159,1,128,4,2,128,4,2,128,0,63,64,66,10,63,36,128,4,2,128,4,2,128,
+  0,63,63,68,10,62,66,10,96,0,128,4,1,128,4,3,129,0,63,166,1,128,4,1,
+  128,4,4,127,63,0,31,66,10,63,5,128,4,1,128,4,63,68,128,0,2,91,0,35,
+  99,0,128,4,1,128,4,63,69,94,0,63,8,128,4,0,128,4,63,101,127,8,0,128,
+  4,0,128,4,63,172,1,128,4,1,128,4,5,128,4,63,123,128,4,40,128,4,1,128,
+  4,4,128,4,63,124,128,4,40,128,4,0,128,4,3,129,68,63,46,66,10,45,66,10,
+  26,128,4,0,67,10,5,66,10,26,128,4,0,128,4,2,128,4,63,47,68,10,48,69,
+  10,20,128,4,3,128,10,34,128,4,0,128,4,1,128,4,63,48,68,10,103,0,35,128,
+  4,38,128,4,1,66,4,63,49,68,10,101,0,6,67,0,2,128,10,22,128,4,9,75,
+  0,16,128,4,0,129,68,63,55,100,0,12,128,0,25,129,4,36,128,4,1,128,4,63,
+  54,100,0,41,128,4,0,128,0,35,128,4,0,128,4,63,59,66,10,45,66,0,23,68,
+  10,31,128,4,1,128,4,63,59,66,10,77,0,66,10,72,0,51,129,170,29,128,4,0,
+  128,4,63,60,69,10,74,0,66,10,70,0,63,21,128,4,63,64,129,0,2,74,0,66,
+  10,69,0,23,66,10,20,75,10,25,128,4,63,66,66,10,81,0,55,66,0,27,128,4,
+  0,128,4,63,173,1,128,4,0,128,4,63,70,66,10,73,0,9,128,4,17,130,0,4,
+  1,128,4,17,66,0,32,128,4,0,128,4,63,70,70,10,16,128,4,19,128,4,1,128,
+  4,20,128,4,3,128,4,26,129,68,63,71,71,10,15,128,4,14,66,10,2,128,4,1,
+  128,4,19,128,4,3,128,4,25,128,4,0,128,4,63,71,71,10,128,0,15,128,4,12,
+  68,10,4,128,4,20,128,4,1,128,4,5,128,4,19,129,68,63,73,70,10,128,0,0,
+  66,10,11,128,4,23,128,4,19,128,4,1,128,4,4,128,4,19,129,68,63,80,129,16,
+  15,128,4,23,128,4,19,128,4,1,128,4,3,128,4,20,129,68,63,78,130,0,1,16,
+  128,4,12,128,0,2,67,0,128,4,2,128,4,18,128,4,0,128,4,4,128,4,19,129,
+  68,63,84,79,0,128,4,12,70,0,129,68,1,128,4,18,128,4,0,128,4,3,128,4,
+  20,128,4,63,86,66,10,2,66,10,69,0,128,4,14,66,10,1,129,68,2,128,4,17,
+  128,4,0,128,4,2,128,4,20,129,68,63,91,68,10,68,0,128,4,20,129,68,1,128,
+  4,16,128,4,0,128,4,2,128,4,21,128,4,63,92,68,10,68,0,128,4,20,129,68,
+  1,128,4,16,128,4,0,128,4,1,128,4,21,129,68,63,87,129,64,66,0,68,10,69,
+  0,128,4,13,70,0,128,4,1,128,4,16,129,68,2,128,4,20,66,10,63,89,129,68,
+  1,66,10,70,0,128,4,20,129,68,0,128,4,16,129,68,1,128,4,63,116,128,4,3,
+  128,4,6,128,4,20,128,4,0,128,4,13,66,10,129,68,0,128,4,63,118,128,4,3,
+  128,4,5,128,4,20,66,4,16,128,4,0,128,4,22,128,4,89,0,63,70,129,68,1,
+  128,4,6,128,4,20,128,4,0,128,4,15,129,68,22,128,4,63,99,128,4,1,128,4,
+  5,128,4,20,128,4,0,128,4,12,129,0,66,4,22,128,4,63,102,128,4,6,128,4,
+  19,128,4,0,128,4,14,129,68,22,128,4,63,103,129,170,5,128,4,20,129,68,12,66,
+  10,22,128,4,63,113,128,4,19,129,68,11,68,10,21,128,4,63,102,68,10,69,0,128,
+  4,19,129,68,37,128,4,63,103,68,10,128,4,5,128,4,18,129,68,36,128,4,63,108,
+  130,0,4,4,128,4,18,129,68,11,128,0,2,84,0,128,4,63,106,68,0,128,4,4,
+  128,4,17,129,68,12,129,64,84,0,128,4,63,113,128,4,3,128,4,18,128,4,13,128,
+  4,19,128,4,63,115,128,4,3,128,4,17,128,4,13,128,4,19,128,4,63,116,128,4,
+  2,128,4,16,66,10,12,128,4,18,128,4,54,66,10,63,60,129,68,1,128,4,14,68,
+  10,11,128,4,17,128,4,57,129,170,63,61,128,4,0,128,4,30,128,4,18,128,4,53,
+  128,0,3,128,10,63,61,66,10,128,4,29,128,4,17,128,4,33,128,0,1,128,10,16,
+  128,0,3,128,10,63,61,66,10,128,4,13,128,0,2,75,0,128,4,16,128,4,33,128,
+  0,3,128,10,63,83,66,10,129,68,13,130,0,4,11,128,4,16,128,4,33,128,0,3,
+  128,10,14,128,0,2,127,19,0,45,66,0,128,4,15,128,4,11,128,4,15,128,4,34,
+  128,0,3,128,10,14,128,0,1,128,10,63,69,128,4,15,128,4,10,128,4,14,128,4,
+  29,128,0,1,128,10,1,128,0,3,128,10,14,85,0,66,10,63,49,128,4,14,128,4,
+  10,128,4,14,128,4,29,128,0,1,128,10,2,128,0,1,128,10,36,128,0,1,128,10,
+  63,50,128,4,66,10,11,128,4,9,128,4,13,128,4,30,128,0,1,128,10,43,128,0,
+  1,128,10,63,66,128,4,9,128,4,12,128,4,63,16,127,0,0,63,7,128,4,8,128,
+  4,11,128,4,63,136,1,66,0,128,4,11,128,4,8,128,4,11,128,4,63,140,1,128,
+  4,11,128,4,7,128,4,10,128,4,63,142,1,129,68,9,128,4,7,128,4,9,128,4,
+  22,69,4,35,66,10,63,77,66,10,7,128,4,6,128,4,9,128,4,20,129,68,5,73,
+  4,24,128,0,1,128,10,63,88,128,4,6,128,4,8,128,4,19,129,68,17,69,4,18,
+  128,0,1,128,10,63,89,128,4,5,128,4,27,129,68,25,67,4,14,127,17,0,63,0,
+  66,0,128,4,7,128,4,5,128,4,25,129,68,31,66,4,63,97,129,68,6,128,4,4,
+  128,4,23,129,68,63,136,1,128,4,5,128,4,4,128,4,21,129,68,63,139,1,128,4,
+  5,128,4,3,128,4,19,129,68,63,142,1,128,4,4,128,4,3,128,4,4,128,4,10,
+  66,4,63,145,1,128,4,4,128,4,2,128,4,3,128,4,9,129,68,63,149,1,129,68,
+  2,128,4,2,128,4,3,128,4,7,129,68,52,66,10,6,128,0,3,128,10,63,84,128,
+  4,2,128,4,1,128,4,2,128,4,6,129,68,56,129,170,4,128,0,5,128,10,63,84,
+  128,4,1,128,4,1,128,4,1,128,4,5,129,68,54,128,0,3,128,10,4,128,0,5,
+  128,10,63,85,128,4,1,128,4,0,128,4,1,128,4,3,129,68,42,72,4,4,128,0,
+  3,128,10,4,128,0,5,128,10,63,86,128,4,0,128,4,0,128,4,0,128,4,2,129,
+  68,34,73,4,2,129,68,8,129,0,9,128,0,3,128,10,63,88,68,4,1,129,68,34,
+  129,68,10,129,68,9,128,0,2,66,0,63,67,66,10,95,0,68,4,33,66,4,10,129,
+  68,11,128,0,1,128,10,16,128,0,1,128,10,63,48,68,10,72,0,66,10,71,0,79,
+  4,30,66,4,12,128,4,13,128,0,1,128,10,16,128,0,1,128,10,63,48,68,10,69,
+  0,66,4,66,10,71,4,8,129,68,0,73,4,22,129,68,13,129,68,2,128,0,1,128,
+  10,28,128,0,1,128,10,63,48,68,10,67,0,129,68,2,66,10,77,0,66,4,1,129,
+  68,0,128,4,0,66,4,2,128,4,2,66,4,3,128,0,1,128,10,4,66,4,13,129,
+  68,3,128,0,3,128,10,63,81,66,10,66,0,129,68,19,129,68,4,129,68,0,128,4,
+  3,66,4,6,68,4,1,128,10,2,129,68,14,129,68,5,128,0,3,128,10,63,85,129,
+  68,18,66,4,5,128,4,0,128,4,1,128,4,5,129,68,8,128,0,1,128,10,66,4,
+  13,69,4,9,128,10,63,83,129,68,18,129,68,8,128,4,0,128,4,2,128,4,6,66,
+  4,11,129,68,9,130,74,4,5,68,4,14,128,0,1,128,10,63,68,129,68,17,66,4,
+  9,128,4,1,128,4,3,128,4,8,66,4,10,129,68,2,128,4,3,128,10,17,66,4,
+  5,128,0,3,128,10,63,65,129,68,17,129,68,12,128,4,1,128,4,3,128,4,11,129,
+  68,9,67,4,4,128,10,0,128,0,1,128,10,15,67,4,66,0,3,128,10,7,128,10,
+  63,54,129,68,16,66,4,14,128,4,1,128,4,4,128,4,12,66,4,2,67,4,2,129,
+  68,5,128,0,1,128,10,10,73,0,5,128,10,7,128,10,0,128,0,1,128,10,63,47,
+  129,68,15,66,4,16,128,4,2,128,4,5,128,4,14,66,4,8,129,68,3,128,0,1,
+  128,10,10,128,0,1,128,10,3,128,0,5,130,10,0,0,70,10,0,128,0,1,128,10,
+  63,45,129,68,15,129,68,19,128,4,2,128,4,6,128,4,91,0,129,68,16,128,0,1,
+  128,10,3,128,0,3,128,10,1,129,0,0,129,170,5,128,0,1,128,10,63,40,68,4,
+  14,66,4,20,128,4,3,128,4,37,129,68,15,66,10,1,128,0,4,129,170,1,129,0,
+  0,129,170,63,45,68,4,1,128,4,14,129,68,23,128,4,3,128,4,39,128,4,19,128,
+  0,1,67,10,63,59,128,4,12,66,4,25,128,4,3,128,4,6,66,10,29,129,68,18,
+  128,0,1,128,10,63,39,85,0,128,4,8,66,10,129,68,27,128,4,4,128,4,9,128,
+  4,29,129,68,63,60,66,10,83,0,128,4,8,66,10,93,0,128,4,4,128,4,10,128,
+  4,28,128,4,0,128,4,63,56,69,10,82,0,128,4,7,129,68,66,10,92,0,128,4,
+  5,128,4,11,128,4,28,128,4,0,128,4,63,59,129,170,17,128,4,5,66,4,33,128,
+  4,5,128,4,11,128,4,28,128,4,1,128,4,2,86,0,63,21,66,10,67,0,2,70,
+  0,12,128,4,3,67,4,34,128,4,6,128,4,12,128,4,28,128,4,4,128,0,1,128,
+  10,63,40,66,10,67,0,21,128,4,1,66,4,1,128,4,35,128,4,6,128,4,13,128,
+  4,27,128,4,4,128,0,1,128,10,9,128,0,1,128,10,63,26,66,10,68,0,18,128,
+  0,67,4,3,128,4,36,128,4,6,128,4,14,128,4,27,128,4,4,66,10,9,128,0,
+  1,128,10,1,128,0,1,128,10,63,46,66,10,69,0,128,4,36,128,4,7,128,4,14,
+  128,4,46,128,0,1,128,10,1,128,0,1,128,10,63,44,129,68,66,10,68,0,128,4,
+  37,128,4,7,128,4,15,128,4,51,128,0,1,128,10,63,43,128,4,1,66,10,2,129,
+  68,37,128,4,8,128,4,16,128,4,63,97,128,4,1,128,4,4,128,4,39,128,4,8,
+  128,4,17,128,4,54,128,0,1,128,10,63,36,128,4,7,128,4,39,128,4,9,128,4,
+  18,128,4,53,128,0,1,128,10,63,35,128,4,7,128,4,40,128,4,9,128,4,18,128,
+  4,43,70,0,2,128,0,1,128,10,63,34,128,4,7,128,4,41,128,4,9,128,4,19,
+  128,4,41,129,0,63,30,79,0,128,4,7,128,4,41,128,4,10,128,4,20,128,4,40,
+  128,0,3,128,10,63,28,76,0,128,4,5,66,4,42,128,4,10,128,4,21,128,4,39,
+  128,0,3,128,10,63,24,70,10,72,0,128,4,2,68,4,42,129,64,75,0,128,4,21,
+  128,4,43,129,170,63,21,130,0,1,70,10,71,0,70,4,44,66,10,75,0,128,4,22,
+  128,4,40,66,10,63,20,66,10,129,0,0,69,10,3,71,4,47,66,10,75,0,128,4,
+  87,0,128,4,63,62,68,10,129,16,66,10,3,66,4,0,66,4,51,66,10,37,128,4,
+  63,61,68,10,129,16,8,129,68,55,128,4,39,128,4,63,60,68,10,128,0,63,3,128,
+  4,12,66,10,24,128,4,63,61,66,10,7,124,0,128,4,12,66,10,25,128,4,63,68,
+  69,10,56,128,4,14,128,4,27,128,4,63,67,69,10,56,128,4,14,128,4,28,128,4,
+  63,64,129,16,3,129,170,56,128,4,14,128,4,29,128,4,63,62,66,10,128,1,60,128,
+  4,15,128,4,29,128,4,63,58,66,10,128,0,66,10,128,1,60,128,4,16,128,4,29,
+  128,4,63,57,66,10,128,0,66,10,59,129,64,81,0,128,4,29,129,64,95,0,63,24,
+  66,10,68,0,63,16,128,4,28,128,0,1,128,10,63,142,1,128,4,28,128,0,1,128,
+  10,63,121,66,10,18,128,4,28,66,10,63,121,128,4,20,128,4,31,128,4,63,119,128,
+  4,22,128,4,31,129,68,63,117,128,4,22,128,4,33,128,4,63,115,128,4,24,128,4,
+  33,129,68,63,113,128,4,25,128,4,34,128,4,63,111,129,68,25,128,4,35,129,68,63,
+  109,128,4,27,128,4,36,129,68,63,106,129,68,27,128,4,38,128,4,63,104,129,68,29,
+  128,4,38,129,68,63,102,129,68,29,128,4,40,71,4,63,93,128,4,0,128,4,30,128,
+  4,40,128,4,5,72,4,63,83,128,4,0,128,4,31,128,4,40,128,4,63,98,128,4,
+  0,128,4,32,128,4,40,128,4,63,96,128,4,1,128,4,25,71,0,128,4,40,128,4,
+  63,94,128,4,1,128,4,35,128,4,39,128,4,63,94,128,4,1,128,4,36,128,4,39,
+  128,4,63,92,128,4,1,128,4,27,66,10,7,128,4,38,128,4,63,92,128,4,1,128,
+  4,38,128,4,39,128,4,1,127,55,0,32,128,4,2,128,4,39,128,4,39,128,4,63,
+  88,128,4,2,128,4,41,128,4,38,128,4,63,88,128,4,2,128,4,42,128,4,38,128,
+  4,66,10,63,83,128,4,2,128,4,44,128,4,38,128,4,63,84,128,4,1,66,4,63,
+  21,128,4,63,84,128,4,0,128,4,0,128,4,63,23,128,4,63,82,128,4,0,128,4,
+  1,128,4,63,20,66,0,128,4,63,82,132,68,0,4,63,21,128,0,1,129,74,63,80,
+  130,68,0,2,127,7,0,13,128,0,1,128,10,63,82,128,4,63,26,66,10,63,82,128,
+  4,63,52,127,43,0,15,128,4,68,10,63,46,129,0,63,57,129,68,63,29,86,0,3,
+  128,10,63,53,129,68,2,112,0,40,128,0,1,128,10,17,128,0,3,128,10,2,128,0,
+  1,128,10,63,46,129,68,63,29,128,0,1,128,10,21,129,170,1,128,0,3,128,10,63,
+  45,129,68,66,10,63,27,66,10,19,66,10,2,128,0,3,128,10,63,45,129,68,63,41,
+  82,0,3,128,10,63,45,129,68,63,41,128,0,1,128,10,14,128,0,1,128,10,63,94,
+  74,0,44,128,0,4,128,10,63,169,1,128,0,1,67,10,63,169,1,128,0,1,128,10,
+  63,116,68,10,63,227,2,85,0,63,156,1,90,0,63,145,1,68,10,127,171,1,0,68,
+  10,127,171,1,0,68,10,0,66,10,127,168,1,0,66,10,1,66,10,127,173,1,0,66,
+  10,63,163,2,127,177,1,0,1,128,10,63,52,127,57,0,1,128,10,63,173,1,66,10,
+  63,45,66,0,66,10,63,169,1,128,0,2,67,0,66,10,63,173,1,66,10,63,148,3,
+  128,0,3,128,10,63,138,5,68,10,63,172,1,66,10,63,204,12,127,176,1,0,2,127,
+  172,1,0,63,160,3,68,10,63,172,1,66,10,63,209,17,63,237,2,66,9,63,172,1,
+  128,0,66,9,63,172,1,128,0,66,9,63,172,1,127,255,6,0,66,9,63,172,1,68,
+  9,63,170,1,128,0,68,9,63,170,1,128,0,68,9,63,170,1,129,0,66,9,63,172,
+  1,127,120,0,66,9,51,128,0,66,9,63,116,68,9,50,128,0,66,9,63,116,68,9,
+  50,128,0,66,9,63,116,68,9,44,128,0,66,9,1,128,0,66,9,1,66,9,63,109,
+  69,9,109,0,68,9,0,128,0,66,9,0,128,0,66,9,63,109,66,9,112,0,68,9,
+  0,69,0,66,9,63,109,66,9,47,128,0,68,9,5,127,166,1,0,66,9,63,180,1,
+  128,0,66,9,63,171,1,128,0,68,9,63,170,1,128,0,68,9,63,76,66,9,63,22,
+  66,9,1,128,0,68,9,63,76,66,9,36,66,9,45,66,9,2,128,0,66,9,63,77,
+  66,9,36,66,9,45,66,9,63,84,103,0,66,9,44,66,9,63,125,101,0,8,70,9,
+  63,125,66,9,39,128,0,70,9,63,125,66,9,39,71,9,63,55,66,9,63,3,66,9,
+  39,69,9,63,56,68,9,63,0,66,9,96,0,8,68,9,63,57,68,9,127,0,0,66,
+  9,42,66,9,63,58,68,9,127,0,0,66,9,63,105,66,9,92,0,66,9,32,99,0,
+  63,73,94,0,66,9,63,173,1,66,9,63,162,3,66,9,37,66,9,63,131,1,68,9,
+  36,66,9,63,125,66,9,2,68,9,21,66,9,7,66,9,0,66,9,63,75,67,9,109,
+  0,66,9,128,1,0,69,9,21,67,9,5,128,0,66,9,0,128,1,87,0,63,53,68,
+  9,107,0,0,66,9,128,0,0,68,9,85,0,0,68,9,4,128,0,66,9,63,79,68,
+  9,104,0,4,67,0,66,9,87,0,0,68,9,4,72,0,63,74,68,9,102,0,10,66,
+  9,87,0,0,68,9,63,89,66,9,101,0,12,66,9,128,0,66,9,21,67,9,63,144,
+  1,66,0,66,9,20,68,9,63,94,66,9,78,0,66,9,31,66,9,20,67,9,87,0,
+  63,71,69,9,11,66,9,55,70,9,30,66,9,63,58,69,9,75,0,66,9,53,75,9,
+  27,66,9,63,61,66,9,84,0,22,66,9,85,0,75,9,27,66,9,63,62,84,0,24,
+  66,9,85,0,69,9,2,66,9,27,127,70,0,66,9,37,66,9,88,0,66,9,2,91,
+  0,63,72,68,9,9,66,9,69,0,45,128,4,95,0,63,73,69,9,70,0,1,66,9,
+  69,0,15,66,9,63,133,1,70,9,68,0,2,66,9,69,0,14,68,9,63,132,1,128,
+  0,69,9,66,0,28,68,9,1,66,9,63,128,1,128,0,68,9,128,0,0,66,9,76,
+  0,13,68,9,1,66,9,63,130,1,66,9,128,0,1,66,9,76,0,13,128,0,66,9,
+  66,0,66,9,63,136,1,66,9,76,0,14,70,0,63,146,1,66,9,20,66,9,63,143,
+  1,66,9,1,68,9,19,66,9,66,0,63,140,1,66,9,1,68,9,19,66,9,67,0,
+  63,139,1,66,9,1,68,9,20,69,0,63,144,1,128,0,66,9,70,0,63,6,66,9,
+  63,93,130,0,4,46,66,9,26,66,9,63,143,1,66,9,26,66,9,63,143,1,66,9,
+  63,173,1,129,0,66,4,63,122,66,9,63,173,1,66,9,128,0,44,66,9,63,124,68,
+  9,128,4,41,68,9,63,124,68,9,128,4,40,68,9,63,124,68,9,128,4,40,68,9,
+  63,124,68,9,128,0,40,128,0,66,9,84,0,63,105,66,9,66,0,40,129,64,85,0,
+  63,216,6,66,9,128,4,63,25,129,0,66,9,63,77,68,9,76,0,63,11,129,0,68,
+  9,63,76,68,9,75,0,55,66,9,16,129,0,68,9,63,58,66,9,128,0,13,68,9,
+  75,0,54,68,9,15,129,0,68,9,63,58,66,9,128,4,14,66,9,128,4,63,2,69,
+  9,14,128,0,69,9,63,59,66,9,128,0,63,21,69,9,14,128,0,66,9,63,146,1,
+  66,9,1,68,9,15,128,0,66,9,63,145,1,128,0,66,9,1,128,0,66,9,72,0,
+  28,128,0,66,9,63,124,128,0,66,9,2,76,0,27,128,0,66,9,63,49,66,9,76,
+  0,58,83,0,27,128,0,66,9,63,49,66,9,76,0,63,160,1,66,9,128,4,63,34,
+  66,9,63,172,1,128,0,66,9,63,172,1,128,0,66,9,63,172,1,66,0,66,9,63,
+  76,66,9,72,0,63,21,66,9,63,76,66,9,72,0,14,66,9,63,3,66,9,63,76,
+  66,9,128,4,21,68,9,63,171,1,68,9,63,171,1,68,9,63,171,1,128,0,66,9,
+  76,0,63,160,1,128,4,76,0,63,192,5,128,0,66,9,6,128,0,69,9,63,157,1,
+  128,0,68,9,4,128,0,70,9,63,157,1,128,0,68,9,4,128,0,70,9,63,157,1,
+  128,0,68,9,4,128,0,69,9,63,159,1,128,0,66,9,6,128,0,67,9,63,158,1,
+  66,9,63,69,66,9,96,0,63,4,66,9,17,128,0,66,9,63,46,68,9,73,0,66,
+  9,63,23,66,9,17,128,0,66,9,63,46,68,9,70,0,2,66,9,30,66,9,40,128,
+  0,66,9,28,128,0,66,9,63,46,68,9,68,0,4,66,9,30,66,9,7,128,0,66,
+  9,27,128,0,68,9,63,66,66,9,73,0,66,9,67,0,40,66,9,7,128,4,66,9,
+  27,128,0,68,9,63,65,68,9,77,0,53,128,0,66,9,26,128,0,69,9,63,65,68,
+  9,75,0,63,5,128,0,67,9,12,128,4,68,9,9,128,0,66,9,63,52,68,9,73,
+  0,63,7,128,4,67,9,12,128,0,68,9,8,128,0,68,9,63,52,66,9,72,0,63,
+  9,128,0,67,9,1,66,9,8,128,0,66,9,9,128,0,68,9,2,128,0,68,9,63,
+  135,1,66,9,20,128,0,70,9,2,128,0,68,9,0,128,0,66,9,63,27,66,9,79,
+  0,63,20,66,9,11,128,0,66,9,3,128,0,70,9,0,128,1,71,9,0,128,0,66,
+  9,63,26,68,9,76,0,63,37,128,0,66,9,3,128,0,68,9,2,128,1,66,9,5,
+  128,0,66,9,63,26,68,9,71,0,56,66,9,45,128,0,66,9,1,128,0,70,9,2,
+  128,1,66,9,63,36,68,9,66,0,61,66,9,51,128,0,69,9,63,45,66,9,73,0,
+  55,66,9,51,128,0,66,9,63,69,66,9,128,0,63,139,1,66,9,84,0,8,66,9,
+  128,4,63,137,1,68,9,83,0,9,66,9,93,0,63,107,69,9,82,0,63,143,1,66,
+  9,68,0,67,9,5,66,9,74,0,63,39,128,0,66,9,63,37,66,9,68,0,67,9,
+  69,0,66,9,73,0,63,40,128,0,66,9,9,128,0,66,9,63,23,66,9,69,0,66,
+  9,69,0,66,9,72,0,63,41,128,0,66,9,9,128,0,66,9,1,128,0,66,9,63,
+  26,66,9,78,0,66,9,128,4,63,54,128,0,66,9,1,128,0,66,9,63,44,66,9,
+  69,0,63,55,128,0,66,9,63,44,66,9,67,0,63,174,2,127,16,0,63,96,128,0,
+  66,9,63,172,1,128,0,66,9,63,162,1,66,9,7,66,9,63,161,1,68,9,63,24,
+  66,9,77,0,63,66,68,9,63,23,71,9,63,76,68,9,63,23,71,9,59,130,0,4,
+  63,14,66,9,63,19,66,9,128,0,0,71,9,59,66,9,63,99,68,9,128,0,0,66,
+  9,68,0,58,66,9,10,66,9,63,85,68,9,128,0,63,4,66,9,10,66,9,63,85,
+  68,9,66,0,63,16,66,9,63,86,66,9,67,0,63,16,66,9,63,95,129,0,66,9,
+  121,0,14,66,9,63,94,69,9,121,0,63,112,69,9,121,0,63,110,68,9,63,167,1,
+  67,0,66,9,63,168,1,66,9,128,0,0,66,9,63,168,1,66,9,69,0,58,129,64,
+  82,0,30,66,9,63,53,66,9,63,0,66,9,82,0,30,66,9,63,120,66,9,83,0,
+  29,66,9,63,120,66,9,63,244,25,72,0,63,167,1,66,9,63,173,1,66,9,63,173,
+  1,66,9,63,228,1,66,9,63,173,1,66,9,63,173,1,66,9,63,126,70,0,63,169,
+  1,66,9,63,173,1,66,9,63,173,1,66,9,63,219,1,128,0,66,9,63,83,129,64,
+  127,8,0,14,128,0,66,9,63,82,128,0,66,9,108,0,66,9,37,128,0,66,9,63,
+  82,68,9,43,66,9,63,124,68,9,43,66,9,63,1,66,9,63,56,68,9,47,79,0,
+  46,68,9,63,55,67,9,47,129,0,66,9,36,85,0,68,9,3,127,39,0,11,66,9,
+  48,128,0,68,9,35,128,0,66,9,1,79,0,68,9,2,128,0,66,9,127,38,0,9,
+  66,9,48,128,0,68,9,35,128,0,66,9,1,128,0,66,9,12,66,9,3,68,9,63,
+  47,66,9,49,68,9,36,66,9,1,128,0,66,9,19,68,9,63,101,66,9,43,66,9,
+  1,81,0,68,9,63,150,1,67,0,66,9,14,66,9,63,94,71,0,48,66,9,128,0,
+  66,9,63,62,66,9,46,68,9,51,66,9,0,66,9,63,62,66,9,46,68,9,51,66,
+  9,63,66,66,9,46,68,9,63,226,2,66,9,63,172,1,68,9,63,171,1,68,9,63,
+  171,1,68,9,0,127,171,1,0,66,9,1,66,9,63,173,1,66,9,63,173,1,66,9,
+  63,164,2,127,177,1,0,66,9,63,46,66,9,127,60,0,66,9,63,46,66,9,128,0,
+  66,9,127,56,0,66,9,63,44,129,0,66,9,0,66,9,127,166,1,0,66,9,67,0,
+  66,9,127,165,1,0,68,9,66,0,66,9,63,165,1,68,9,127,171,1,0,68,9,63,
+  170,1,68,9,127,171,1,0,68,9,127,171,1,0,68,9,63,172,1,66,9,63,205,12,
+  127,175,1,0,66,9,127,172,1,0,68,9,127,171,1,0,68,9,127,171,1,0,68,9,
+  63,172,1,66,9,63,226,15,63,139,14,66,9,63,172,1,68,9,63,139,5,128,0,2,
+  127,116,0,66,9,53,127,118,0,68,9,51,66,9,63,116,68,9,63,155,3,128,0,2,
+  110,0,66,9,63,122,113,0,68,9,63,122,112,0,6,68,0,63,148,3,128,0,2,127,
+  181,1,0,66,9,63,172,1,68,9,63,187,2,66,9,63,24,66,9,63,82,66,9,101,
+  0,66,9,45,128,0,1,128,9,1,128,0,2,127,76,0,66,9,101,0,48,128,0,1,
+  128,9,2,127,120,0,63,176,1,101,0,12,66,9,63,152,3,71,9,63,174,1,127,57,
+  0,63,4,68,9,44,127,57,0,63,50,128,0,2,127,58,0,63,51,127,61,0,31,66,
+  9,33,99,0,63,103,66,9,127,6,0,63,103,66,9,127,6,0,63,104,127,8,0,63,
+  109,66,9,63,172,1,68,9,63,165,1,66,9,29,66,9,63,90,66,9,63,19,128,9,
+  63,88,68,9,49,69,9,84,0,5,128,9,63,87,68,9,108,0,0,130,17,0,0,66,
+  9,88,0,63,93,68,9,105,0,7,67,9,63,121,104,0,14,66,9,20,128,0,63,93,
+  104,0,41,128,0,63,97,66,9,63,176,1,129,153,11,66,9,75,0,20,87,0,63,104,
+  75,0,66,9,73,0,45,71,9,63,92,129,0,2,75,0,66,9,71,0,21,66,9,21,
+  128,0,63,103,87,0,47,128,0,63,175,1,66,0,63,106,66,9,75,0,66,9,23,91,
+  0,128,4,96,0,63,71,69,9,33,66,9,63,133,1,70,9,31,68,9,63,132,1,70,
+  9,69,0,2,72,0,13,68,9,66,0,66,9,63,127,69,9,67,0,27,68,9,66,0,
+  63,135,1,67,0,32,67,0,63,133,1,68,0,31,70,0,129,4,63,168,1,66,9,63,
+  148,1,66,9,70,0,63,160,1,66,9,128,0,0,68,9,69,0,63,160,1,66,9,128,
+  0,0,68,9,69,0,14,70,0,63,138,1,66,9,128,0,0,68,9,69,0,63,166,1,
+  66,9,128,4,46,66,9,63,141,5,66,0,63,223,4,128,9,63,156,3,68,9,128,4,
+  63,170,1,68,9,128,0,63,174,1,66,0,63,171,1,69,0,63,169,5,66,9,63,172,
+  1,68,9,63,27,128,0,1,128,9,63,171,1,128,0,3,128,9,63,57,66,9,63,24,
+  128,0,1,128,9,17,128,0,3,128,9,63,75,128,0,2,128,4,63,3,128,0,3,128,
+  9,16,128,0,3,128,9,63,76,66,0,63,3,128,0,4,128,9,17,128,0,1,128,9,
+  63,58,67,0,63,21,128,0,4,128,9,63,164,1,128,0,1,128,9,0,128,0,3,128,
+  9,63,165,1,128,0,1,128,9,1,128,0,1,128,9,37,129,0,0,129,153,63,123,128,
+  0,1,128,9,43,129,0,0,129,153,63,171,1,129,0,0,129,153,63,133,3,128,0,1,
+  128,9,63,172,1,128,0,1,128,9,63,172,1,128,0,1,128,9,63,174,1,128,0,1,
+  128,9,63,172,1,128,0,1,128,9,63,172,1,128,0,1,128,9,63,192,14,128,0,4,
+  128,9,63,168,1,128,0,5,128,9,63,168,1,128,0,5,128,9,63,168,1,128,0,4,
+  128,9,63,170,1,128,0,2,128,9,63,164,2,66,9,97,0,63,26,129,0,0,129,153,
+  63,43,68,9,73,0,66,9,72,0,63,37,129,0,0,129,153,63,43,68,9,71,0,1,
+  66,9,72,4,63,4,128,0,1,128,9,28,129,0,0,129,153,63,43,68,9,69,0,3,
+  66,9,78,0,28,70,0,24,128,0,3,128,9,63,77,66,9,68,0,63,26,128,9,63,
+  175,1,128,9,63,138,1,66,9,13,128,9,17,128,9,9,128,0,1,128,9,63,142,1,
+  128,9,27,128,0,3,128,9,63,141,1,128,9,0,128,0,1,128,9,22,128,0,3,128,
+  9,7,128,9,63,134,1,128,0,1,128,9,20,128,0,5,128,9,7,128,9,0,128,0,
+  1,128,9,63,25,66,9,80,0,63,20,128,0,1,128,9,11,128,0,1,128,9,3,128,
+  0,5,128,9,0,66,0,4,128,9,0,128,0,1,128,9,63,24,68,9,77,0,63,38,
+  128,0,1,128,9,3,128,0,3,128,9,2,128,0,1,128,9,5,128,0,1,128,9,63,
+  24,68,9,72,0,56,129,64,92,0,18,128,0,1,128,9,1,66,0,3,128,9,2,128,
+  0,1,128,9,63,34,68,9,67,0,61,128,0,1,128,9,54,128,0,1,128,9,4,66,
+  9,63,35,66,9,74,0,55,128,0,1,128,9,63,173,1,66,9,51,66,9,63,145,2,
+  69,9,63,169,1,70,9,63,162,1,70,0,67,9,70,0,63,54,84,0,63,18,66,9,
+  68,0,67,9,70,0,63,54,128,0,1,128,9,9,128,0,1,128,9,63,21,66,9,69,
+  0,66,9,70,0,63,54,128,0,1,128,9,9,128,0,1,128,9,1,129,16,127,17,0,
+  66,9,5,66,9,80,0,66,4,63,42,66,9,9,128,0,1,128,9,1,128,0,1,128,
+  9,63,42,66,9,128,4,63,62,128,0,1,128,9,63,42,66,9,68,0,63,59,66,9,
+  63,42,66,9,63,180,2,128,0,1,128,9,63,172,1,128,0,1,128,9,63,161,1,128,
+  0,1,128,9,6,128,0,1,128,9,63,160,1,128,0,3,128,9,63,170,1,128,0,3,
+  128,9,63,29,73,0,63,67,128,0,3,128,9,63,29,72,0,63,69,128,0,1,128,9,
+  63,18,68,0,6,68,0,63,161,1,67,0,63,17,129,64,88,0,63,60,68,9,66,0,
+  63,168,1,68,9,67,0,63,167,1,68,9,63,172,1,66,9,63,181,1,66,9,128,0,
+  63,12,66,9,63,93,66,9,128,0,63,171,1,128,0,2,124,0,63,110,66,9,128,0,
+  63,172,1,66,9,128,0,63,172,1,66,9,63,49,129,64,94,0,63,90,130,0,4,63,
+  210,3,66,9,63,120,66,9,63,251,31,128,0,1,128,9,63,172,1,128,0,1,128,9,
+  63,172,1,128,0,1,128,9,63,236,8,130,0,4,63,194,2,66,9,127,6,0,63,102,
+  68,9,108,0,41,66,9,63,81,68,9,108,0,63,4,127,44,0,13,68,9,108,0,66,
+  9,63,0,129,0,63,61,114,0,61,128,0,3,128,9,63,149,1,85,0,3,128,9,2,
+  127,41,0,63,41,128,0,1,128,9,20,129,153,1,129,0,63,145,1,128,0,1,128,9,
+  18,66,9,2,128,0,3,128,9,63,142,1,66,9,24,128,0,3,128,9,63,153,1,128,
+  0,1,128,9,16,129,153,63,153,1,128,0,1,128,9,14,66,9,63,43,68,0,44,68,
+  0,55,128,0,1,128,9,63,157,4,66,9,46,68,9,63,114,93,0,63,145,1,128,0,
+  2,127,172,1,0,63,160,3,68,9,0,127,171,1,0,66,9,63,162,3,66,9,63,138,
+  5,127,59,0,63,133,6,66,9,63,148,3,128,0,63,143,5,68,9,63,172,1,66,9,
+  63,204,12,127,176,1,0,2,127,172,1,0,63,160,3,68,9,63,172,1,66,9,63,242,
+  13,63,126,66,9,63,172,1,128,0,1,128,9,63,172,1,128,0,1,128,9,63,172,1,
+  127,143,5,0,66,9,63,175,1,129,153,63,170,1,128,0,3,128,9,63,170,1,128,0,
+  3,128,9,63,170,1,129,0,63,118,66,9,53,127,118,0,68,9,52,66,9,63,172,1,
+  128,0,1,128,9,63,172,1,128,0,1,128,9,63,115,128,0,2,117,0,1,128,9,63,
+  116,113,0,5,128,0,1,128,9,1,66,9,63,108,66,9,55,69,0,1,128,9,63,172,
+  1,128,0,1,128,9,63,172,1,127,165,1,0,63,184,1,128,0,1,128,9,63,171,1,
+  128,0,3,128,9,63,74,66,9,63,29,128,0,3,128,9,63,115,66,9,51,128,0,3,
+  128,9,63,171,1,128,0,1,128,9,63,75,104,0,48,67,9,63,123,101,0,9,68,9,
+  63,238,2,66,9,63,216,1,128,0,63,61,66,9,63,2,68,9,39,128,0,4,128,9,
+  63,54,68,9,63,4,96,0,8,129,0,2,128,9,63,55,68,9,127,1,0,45,127,60,
+  0,68,9,91,0,66,9,33,99,0,63,74,92,0,63,145,1,94,0,63,176,1,127,9,
+  0,63,108,66,9,63,172,1,68,9,37,66,9,63,124,66,9,2,68,9,70,0,15,66,
+  9,63,89,66,9,46,66,9,66,0,68,9,70,1,18,128,9,6,66,9,63,77,68,9,
+  45,66,9,128,0,0,68,9,128,1,84,0,5,128,9,9,88,0,63,51,68,9,112,0,
+  128,1,3,87,0,63,93,68,9,109,0,7,128,9,35,68,0,63,79,107,0,7,128,0,
+  27,128,0,63,92,107,0,39,128,0,63,146,1,67,0,23,68,9,63,93,66,9,78,0,
+  66,9,60,85,0,63,72,69,9,63,7,71,9,63,91,69,9,44,66,9,61,128,0,1,
+  128,9,63,74,74,0,63,23,128,4,1,128,9,63,133,1,129,64,2,66,0,30,128,4,
+  1,128,9,63,107,91,0,63,109,129,153,33,66,9,63,139,1,128,9,31,68,9,63,234,
+  4,67,0,66,9,25,128,0,2,67,0,63,132,1,70,0,29,70,0,63,170,1,66,9,
+  63,142,1,79,0,14,66,9,67,0,63,139,1,66,9,26,66,9,67,0,63,170,1,69,
+  0,63,251,2,129,64,66,0,51,66,9,63,141,5,66,0,63,141,5,66,9,63,123,68,
+  9,43,68,9,63,122,68,9,128,0,63,170,1,68,9,66,4,63,172,1,66,0,41,128,
+  0,2,85,0,63,103,69,0,41,130,0,4,63,206,7,66,9,63,175,1,129,153,63,170,
+  1,128,0,3,128,9,63,55,66,9,128,0,63,25,128,0,1,128,9,17,128,0,3,128,
+  9,63,55,66,9,128,4,63,24,128,0,3,128,9,14,66,9,128,0,63,59,66,9,128,
+  0,63,23,128,0,4,128,9,13,128,0,1,128,9,127,18,0,63,69,128,0,4,128,9,
+  13,128,0,1,128,9,63,146,1,128,0,1,128,9,0,128,0,3,128,9,14,127,21,0,
+  63,65,128,0,1,128,9,1,128,0,1,128,9,38,128,0,1,128,9,63,45,66,9,63,
+  11,128,0,1,128,9,44,128,0,1,128,9,63,45,66,9,77,0,63,46,128,0,1,128,
+  9,63,45,66,9,128,4,63,173,1,66,0,63,148,5,66,9,63,201,1,66,9,63,175,
+  1,129,153,63,144,1,66,0,22,128,0,3,128,9,63,170,1,128,0,3,128,9,63,170,
+  1,129,0,63,175,1,128,4,78,0,63,175,7,128,0,1,128,9,7,128,0,4,128,9,
+  63,156,1,128,0,3,128,9,5,128,0,5,128,9,63,156,1,128,0,3,128,9,5,128,
+  0,5,128,9,63,156,1,128,0,3,128,9,5,128,0,4,128,9,63,158,1,128,0,1,
+  128,9,7,128,0,2,128,9,63,156,1,128,0,1,128,9,63,66,66,9,98,0,63,4,
+  128,0,1,128,9,19,128,0,1,128,9,63,41,68,9,74,0,63,27,128,0,1,128,9,
+  19,128,0,1,128,9,63,41,68,9,72,0,36,128,0,1,128,9,63,12,128,0,1,128,
+  9,63,41,68,9,70,0,38,128,4,1,128,9,63,110,66,9,72,0,66,9,69,0,40,
+  128,0,1,128,9,7,128,0,1,128,9,63,97,68,9,78,0,54,128,4,1,128,9,63,
+  97,68,9,76,0,56,128,0,1,128,9,11,66,4,63,82,68,9,74,0,63,161,1,66,
+  9,73,0,63,52,128,0,2,127,8,0,63,60,66,9,26,128,0,8,128,0,6,128,0,
+  1,128,9,63,145,1,128,0,1,128,9,3,128,0,9,128,0,6,128,0,1,128,9,63,
+  145,1,128,0,1,128,9,3,128,0,3,128,9,2,128,0,1,128,9,0,66,9,1,128,
+  0,1,128,9,63,145,1,128,0,1,128,9,3,128,0,3,128,9,2,128,0,1,128,9,
+  63,160,1,128,0,1,129,9,1,128,9,3,128,0,1,128,9,63,160,1,128,0,1,128,
+  9,63,68,67,0,63,36,128,0,1,128,9,63,34,66,9,85,0,7,66,9,128,4,63,
+  137,1,129,0,2,84,0,8,66,9,94,0,63,105,70,9,83,0,9,66,9,63,136,1,
+  67,9,85,0,63,142,1,66,9,68,0,67,9,70,0,66,9,74,0,63,42,128,0,1,
+  128,9,9,69,0,63,17,66,9,69,0,66,9,70,0,66,9,73,0,63,43,128,0,1,
+  128,9,63,33,66,9,69,0,66,9,70,0,66,9,63,53,128,0,1,128,9,15,128,1,
+  1,128,9,63,22,66,9,14,66,9,128,0,63,58,66,9,2,128,1,1,128,9,63,40,
+  66,9,128,4,63,64,128,1,1,128,9,63,40,66,9,68,0,63,177,2,127,14,0,63,
+  98,128,0,1,128,9,63,161,1,68,0,5,128,0,1,128,9,63,160,1,129,0,10,66,
+  9,63,12,80,0,63,67,128,0,3,128,9,63,24,128,0,63,81,128,0,3,128,9,63,
+  20,71,9,63,82,129,153,63,20,71,9,60,130,0,4,63,16,66,9,63,15,66,9,66,
+  0,68,9,63,164,1,68,9,66,0,66,9,63,165,1,68,9,68,0,63,2,66,9,63,
+  97,68,9,68,0,63,167,1,66,9,69,0,2,66,9,122,0,63,114,66,9,122,0,63,
+  114,66,9,122,0,14,66,9,63,202,2,66,9,128,0,63,168,1,66,9,128,0,66,9,
+  66,0,63,166,1,66,9,128,0,66,9,66,0,63,166,1,66,9,71,0,63,46,128,0,
+  1,128,9,63,118,66,9,84,0,29,128,0,1,128,9,63,118,66,9,84,0,29,128,0,
+  1,128,9,63,118,66,9,85,0,63,230,46,127,65,0,19,130,0,4,63,24,128,0,1,
+  128,9,63,80,128,4,2,109,0,41,128,0,1,128,9,63,173,1,66,9,63,199,1,128,
+  0,1,128,9,63,53,68,9,63,49,128,0,3,128,9,63,170,1,128,0,3,128,9,63,
+  52,67,9,63,29,85,0,3,128,9,2,128,0,1,128,9,63,45,66,9,114,0,63,1,
+  128,0,1,128,9,2,128,0,3,128,9,63,44,66,9,63,59,128,0,3,128,9,63,141,
+  1,66,9,1,66,9,3,81,0,3,128,9,63,148,1,68,0,17,128,0,1,128,9,63,
+  149,1,128,0,1,128,9,63,115,128,0,67,1,51,128,0,1,128,9,0,66,9,63,169,
+  1,66,9,63,227,2,68,9,63,114,127,175,1,0,2,127,172,1,0,68,9,127,171,1,
+  0,68,9,127,171,1,0,68,9,1,127,170,1,0,66,9,1,66,9,127,173,1,0,66,
+  9,127,173,1,0,66,9,63,54,127,177,1,0,1,128,9,63,172,1,128,0,1,128,9,
+  63,49,127,60,0,66,9,63,42,66,0,66,9,63,169,1,128,0,2,67,0,63,160,3,
+  66,9,63,169,1,128,9,63,170,1,128,0,63,143,5,68,9,63,172,1,66,9,63,204,
+  12,127,175,1,0,2,127,172,1,0,68,9,127,171,1,0,68,9,127,171,1,0,68,9,
+  63,172,1,66,9,63,131,12,63,126,66,8,63,173,1,66,8,63,173,1,127,142,5,0,
+  66,8,63,172,1,68,8,63,171,1,68,8,63,171,1,68,8,63,171,1,128,0,66,8,
+  127,115,0,66,8,54,127,117,0,68,8,63,171,1,68,8,52,66,8,63,115,68,8,52,
+  66,8,63,115,128,0,66,8,117,0,66,8,63,116,114,0,66,8,2,66,8,1,66,8,
+  63,108,66,8,49,68,8,1,66,8,1,66,8,63,108,66,8,48,128,0,68,8,6,66,
+  8,63,108,66,8,48,128,0,68,8,6,127,165,1,0,66,8,63,172,1,72,0,66,8,
+  63,172,1,68,8,63,74,66,8,63,30,68,8,63,74,66,8,37,66,8,46,66,8,2,
+  68,8,63,74,66,8,37,66,8,46,66,8,2,128,0,66,8,127,116,0,66,8,34,128,
+  3,10,66,8,3,127,157,1,0,128,3,9,68,8,63,160,1,128,3,8,128,0,68,8,
+  63,125,66,8,31,128,3,2,128,3,4,70,8,63,124,66,8,31,128,3,2,128,3,3,
+  71,8,63,123,67,8,30,128,3,2,128,3,4,71,8,63,53,66,8,63,2,128,0,66,
+  8,95,0,128,3,2,128,3,4,68,8,127,55,0,68,8,63,1,128,0,66,8,31,128,
+  3,2,128,3,5,66,8,127,56,0,68,8,27,66,8,33,99,0,128,3,2,128,3,63,
+  65,68,8,27,66,8,63,6,128,3,1,128,3,63,67,66,8,28,66,8,63,6,128,3,
+  1,128,3,63,99,127,9,0,128,3,1,128,3,63,172,1,128,3,1,128,3,63,104,66,
+  8,63,1,128,3,0,128,3,63,98,66,8,2,68,8,22,66,8,11,128,0,66,8,21,
+  128,3,0,128,3,63,98,66,8,2,68,8,22,67,8,10,128,0,66,8,20,128,3,1,
+  128,3,5,128,3,63,40,67,8,46,66,8,1,69,8,20,128,3,0,68,8,5,66,8,
+  0,128,0,66,8,20,128,3,1,128,3,4,128,3,63,41,68,8,45,68,0,68,8,21,
+  128,3,0,68,8,5,66,8,25,128,3,0,128,3,3,129,51,63,42,68,8,50,66,8,
+  23,128,3,0,68,8,5,66,8,25,128,3,0,128,3,2,128,3,63,44,68,8,50,128,
+  0,66,8,23,129,3,66,8,75,0,23,128,3,0,128,3,1,128,3,63,46,66,8,52,
+  66,8,23,128,3,0,128,0,66,8,33,128,3,1,66,3,63,103,66,8,0,66,8,19,
+  128,3,1,66,8,33,128,3,0,129,51,63,55,66,8,50,66,8,19,128,3,68,8,32,
+  128,3,1,128,3,63,56,68,8,11,66,8,78,0,18,66,8,19,68,8,33,128,3,0,
+  128,3,63,57,68,8,75,0,66,8,76,0,43,71,8,29,128,3,0,66,8,63,56,129,
+  0,66,8,75,0,66,8,74,0,19,66,8,22,74,8,26,128,3,0,66,8,63,59,89,
+  0,21,66,8,22,129,48,72,8,25,128,3,0,128,3,66,8,63,107,66,8,23,128,3,
+  66,8,2,66,8,25,128,3,0,128,3,127,67,0,67,8,63,3,128,3,96,0,128,3,
+  0,128,3,63,68,68,8,74,0,66,8,20,66,8,27,128,3,32,128,3,0,128,3,63,
+  68,69,8,72,0,0,66,8,5,128,3,12,68,8,1,128,3,1,128,3,20,128,3,31,
+  128,3,0,128,3,63,69,69,8,71,0,1,66,8,5,128,3,12,68,8,1,128,3,1,
+  128,3,20,128,3,3,128,3,26,129,51,63,70,128,0,68,8,70,0,11,128,3,12,68,
+  8,2,66,8,128,3,19,128,3,3,128,3,25,128,3,0,128,3,63,71,128,0,66,8,
+  68,0,66,8,12,128,3,12,66,8,3,66,8,128,3,20,128,3,1,128,3,5,128,3,
+  19,129,51,63,81,66,8,12,128,3,13,66,8,2,66,8,0,128,3,19,128,3,1,128,
+  3,4,128,3,19,129,51,63,82,66,8,12,128,3,13,66,8,3,128,3,1,128,3,19,
+  128,3,1,128,3,3,128,3,20,129,51,63,89,66,8,5,128,3,13,66,8,3,128,3,
+  2,128,3,18,128,3,0,128,3,4,128,3,19,129,51,63,84,66,8,1,68,8,5,128,
+  3,12,70,0,129,51,1,128,3,18,128,3,0,128,3,3,128,3,20,128,3,63,85,66,
+  8,1,68,8,5,128,3,19,129,51,2,128,3,17,128,3,0,128,3,2,128,3,20,129,
+  51,63,85,66,8,1,68,8,5,128,3,20,129,51,1,128,3,13,66,8,128,3,0,128,
+  3,2,128,3,21,128,3,63,87,128,3,2,128,0,66,8,70,0,128,3,20,129,51,1,
+  128,3,13,66,8,128,3,0,128,3,1,128,3,20,66,8,63,88,128,3,2,66,0,128,
+  3,6,128,3,20,128,3,1,128,3,13,66,8,129,51,2,128,3,20,66,8,63,89,129,
+  51,3,128,3,6,128,3,20,129,51,0,128,3,13,66,0,129,51,1,128,3,21,66,8,
+  63,91,128,3,3,128,3,6,128,3,20,128,3,0,128,3,16,129,51,0,128,3,22,128,
+  3,87,0,63,70,128,3,3,128,3,5,128,3,20,66,3,16,128,3,0,128,3,22,128,
+  3,63,96,66,8,0,128,3,6,128,3,20,128,3,0,128,3,12,66,8,129,51,22,128,
+  3,63,97,66,8,128,0,0,128,3,5,128,3,20,128,3,0,128,3,11,68,8,128,3,
+  22,128,3,63,96,68,8,129,48,6,128,3,19,128,3,0,128,3,11,68,8,22,128,3,
+  63,97,68,8,128,3,0,128,3,5,128,3,20,129,51,11,68,8,21,128,3,63,98,68,
+  8,128,0,66,3,5,128,3,19,129,51,11,128,0,66,8,86,0,128,3,63,99,66,8,
+  67,0,128,3,5,128,3,19,129,51,12,130,0,3,21,128,3,63,108,128,3,5,128,3,
+  18,129,51,14,128,3,20,128,3,63,110,128,3,4,128,3,18,129,51,13,128,3,21,128,
+  3,63,111,128,3,4,128,3,17,129,51,13,128,3,20,128,3,63,113,128,3,3,128,3,
+  16,66,8,13,128,3,19,128,3,63,115,128,3,3,128,3,14,68,8,12,128,3,19,128,
+  3,57,66,8,63,55,128,3,2,128,3,14,68,8,12,128,3,18,128,3,57,68,8,63,
+  55,66,8,0,128,3,13,68,8,12,128,3,17,128,3,37,66,8,17,68,8,63,55,66,
+  8,0,128,3,13,128,0,66,8,128,3,11,128,3,18,128,3,36,68,8,16,68,8,63,
+  55,66,8,128,3,0,128,3,13,66,0,128,3,11,128,3,17,128,3,36,69,8,13,128,
+  0,69,8,63,56,67,0,129,51,16,128,3,11,128,3,16,128,3,36,70,8,13,128,0,
+  66,8,63,64,129,51,15,128,3,11,128,3,16,128,3,32,66,8,0,69,8,14,128,0,
+  66,8,63,65,128,3,15,128,3,11,128,3,15,128,3,32,128,0,66,8,0,68,8,63,
+  86,128,3,15,128,3,10,128,3,14,128,3,33,128,0,66,8,1,66,8,39,128,0,66,
+  8,63,44,66,8,12,128,3,10,128,3,14,128,3,33,80,0,31,128,0,66,8,63,44,
+  66,8,13,128,3,9,128,3,13,128,3,63,20,128,0,66,8,63,44,66,8,128,3,12,
+  128,3,9,128,3,12,128,3,63,137,1,128,3,12,128,3,8,128,3,11,128,3,61,128,
+  0,66,8,63,73,128,3,11,128,3,8,128,3,11,128,3,61,128,0,66,8,63,74,128,
+  3,11,128,3,7,128,3,10,128,3,62,128,0,66,8,63,75,66,8,72,0,128,3,7,
+  128,3,9,128,3,22,69,3,36,66,8,63,74,66,8,73,0,128,3,6,128,3,6,66,
+  8,128,3,20,129,51,5,73,3,26,66,8,63,74,66,8,128,3,8,128,3,6,128,3,
+  5,68,8,18,129,51,17,69,3,20,66,8,63,78,128,3,8,128,3,5,128,3,5,68,
+  8,16,129,51,25,67,3,63,99,128,3,7,128,3,5,128,3,5,68,8,14,129,51,31,
+  66,3,63,97,129,51,6,128,3,4,128,3,6,66,8,13,129,51,63,136,1,128,3,5,
+  128,3,4,128,3,5,128,3,14,129,51,63,139,1,128,3,5,128,3,3,128,3,5,128,
+  3,12,129,51,63,142,1,128,3,4,128,3,3,128,3,4,128,3,10,66,3,63,145,1,
+  128,3,4,128,3,2,128,3,3,128,3,9,129,51,63,1,66,8,63,81,129,51,2,128,
+  3,2,128,3,3,128,3,7,129,51,54,128,0,66,8,6,71,8,63,79,128,3,2,128,
+  3,1,128,3,2,128,3,6,129,51,55,128,0,68,8,5,71,8,63,80,128,3,1,128,
+  3,1,128,3,1,128,3,5,129,51,57,128,0,68,8,5,71,8,63,81,128,3,1,128,
+  3,0,128,3,1,128,3,3,129,51,42,72,3,7,128,0,68,8,5,128,0,68,8,63,
+  84,128,3,0,128,3,0,128,3,0,128,3,2,129,51,34,73,3,2,129,51,12,128,0,
+  66,8,7,128,0,66,8,63,86,68,3,1,129,51,34,129,51,10,129,51,11,66,8,63,
+  66,66,8,34,68,3,33,66,3,10,129,51,13,66,8,20,66,8,63,41,68,8,9,66,
+  8,73,0,79,3,30,66,3,12,128,3,15,66,8,20,66,8,63,41,68,8,8,128,3,
+  66,8,73,3,8,129,51,0,73,3,1,66,8,17,129,51,13,129,51,5,128,0,66,8,
+  30,66,8,63,41,68,8,6,129,51,0,66,8,79,0,66,3,1,129,51,0,128,3,0,
+  66,3,2,129,51,66,8,129,51,12,66,3,13,129,51,6,128,0,68,8,63,63,75,0,
+  66,8,5,129,51,19,129,51,4,129,51,0,128,3,3,66,3,1,66,8,1,69,3,0,
+  66,8,0,129,51,14,129,51,7,128,0,69,8,63,62,128,0,66,8,79,0,129,51,18,
+  66,3,5,128,3,0,128,3,1,128,3,5,129,51,10,128,3,66,8,128,3,13,69,3,
+  5,128,0,70,8,63,62,68,8,12,129,51,18,129,51,8,128,3,0,128,3,2,128,3,
+  6,66,3,8,66,8,129,51,6,128,0,66,8,129,51,5,69,3,128,0,69,8,9,128,
+  0,66,8,63,49,68,8,10,129,51,17,66,3,9,128,3,1,128,3,3,128,3,8,66,
+  3,10,129,51,2,66,3,67,8,12,128,3,68,8,128,3,8,128,0,68,8,63,48,68,
+  8,8,129,51,17,129,51,12,128,3,1,128,3,3,128,3,11,129,51,9,67,3,1,128,
+  0,67,8,1,66,8,8,128,0,66,8,1,67,3,4,128,0,68,8,2,66,8,63,43,
+  66,8,7,129,51,16,66,3,14,128,3,1,128,3,4,128,3,12,66,3,2,67,3,2,
+  129,51,2,66,8,1,66,8,22,70,8,2,69,8,1,66,8,63,23,66,8,81,0,129,
+  51,15,66,3,16,128,3,2,128,3,5,128,3,14,66,3,8,129,51,5,66,8,13,66,
+  8,4,70,8,3,69,8,1,66,8,63,22,68,8,78,0,129,51,15,129,51,19,128,3,
+  2,128,3,6,128,3,27,129,51,20,66,8,4,68,8,3,128,0,66,8,128,0,66,8,
+  1,66,8,63,22,68,8,73,0,68,3,14,66,3,20,128,3,3,128,3,7,128,3,28,
+  129,51,18,66,8,4,68,8,3,128,0,66,8,63,31,68,8,68,0,68,3,1,128,3,
+  14,129,51,23,128,3,3,128,3,7,66,8,28,128,3,22,128,0,69,8,4,128,0,66,
+  8,63,32,66,8,75,0,128,3,12,66,3,25,128,3,3,128,3,7,66,8,28,129,51,
+  21,128,0,66,8,63,58,128,3,11,129,51,27,128,3,4,128,3,7,66,8,29,129,51,
+  20,128,0,66,8,63,32,66,8,86,0,128,3,6,66,8,129,51,29,128,3,4,128,3,
+  10,128,3,28,128,3,0,128,3,63,56,66,8,85,0,128,3,7,66,8,30,128,3,5,
+  128,3,11,128,3,28,128,3,0,128,3,63,52,128,0,68,8,84,0,128,3,5,66,3,
+  66,8,30,128,3,5,128,3,11,128,3,28,128,3,1,128,3,63,50,68,8,21,128,3,
+  3,67,3,34,128,3,6,128,3,12,128,3,28,128,3,63,45,66,8,3,68,8,6,66,
+  8,10,128,3,1,66,3,1,128,3,35,128,3,6,128,3,13,128,3,27,128,3,8,66,
+  8,63,33,66,8,3,68,8,6,66,8,9,67,3,3,128,3,36,128,3,6,128,3,14,
+  128,3,27,128,3,7,66,8,9,128,0,66,8,63,19,66,8,5,66,8,6,66,8,7,
+  66,3,5,128,3,36,128,3,7,128,3,14,128,3,36,66,8,9,128,0,66,8,2,128,
+  0,66,8,63,21,66,8,13,66,8,128,3,0,128,3,5,128,3,37,128,3,7,128,3,
+  15,128,3,48,128,0,66,8,2,128,0,66,8,63,38,66,8,129,48,4,129,51,37,128,
+  3,8,128,3,16,128,3,54,128,0,66,8,63,38,66,8,128,3,4,128,3,39,128,3,
+  8,128,3,17,128,3,63,95,128,3,7,128,3,39,128,3,9,128,3,18,128,3,63,93,
+  128,3,7,128,3,40,128,3,9,128,3,18,128,3,57,128,0,66,8,63,30,128,3,7,
+  128,3,41,128,3,9,128,3,19,128,3,56,128,0,66,8,63,29,128,3,7,128,3,41,
+  128,3,10,128,3,20,128,3,44,66,8,7,128,0,66,8,63,28,128,3,5,66,3,42,
+  128,3,10,128,3,21,128,3,42,68,8,63,20,66,8,78,0,128,3,2,68,3,43,128,
+  3,11,128,3,21,128,3,42,68,8,63,19,71,8,73,0,70,3,46,128,3,11,128,3,
+  22,128,3,41,68,8,63,19,71,8,69,0,71,3,49,128,3,11,128,3,23,128,3,41,
+  66,8,63,14,66,8,66,0,71,8,2,66,3,0,66,3,50,66,8,76,0,128,3,24,
+  128,3,63,57,68,8,66,0,66,8,72,0,129,51,53,66,8,75,0,66,8,24,128,3,
+  63,56,68,8,69,0,63,1,66,8,75,0,66,8,24,128,3,63,56,68,8,69,0,63,
+  2,128,3,12,66,8,25,128,3,63,56,66,8,70,0,2,125,0,128,3,13,129,48,91,
+  0,128,3,63,65,130,16,0,66,8,58,128,3,13,66,8,27,128,3,63,63,66,8,128,
+  0,66,8,58,128,3,13,66,8,28,128,3,63,62,66,8,128,1,66,8,57,128,3,14,
+  66,8,28,128,3,63,60,68,8,61,128,3,16,128,3,29,128,3,63,55,67,0,66,8,
+  62,128,3,17,128,3,30,128,3,63,53,66,8,128,0,0,66,8,62,128,3,18,128,3,
+  30,128,3,63,52,66,8,72,0,58,128,3,18,128,3,30,66,8,63,50,66,8,63,1,
+  130,0,3,20,128,3,29,66,8,63,118,66,8,20,128,3,29,66,8,63,118,66,8,21,
+  128,3,31,129,51,63,116,66,8,21,128,3,33,128,3,63,115,128,3,24,128,3,33,129,
+  51,63,113,128,3,25,128,3,34,128,3,63,111,129,51,25,128,3,35,129,51,63,109,128,
+  3,27,128,3,36,129,51,63,106,129,51,27,128,3,38,128,3,63,104,129,51,29,128,3,
+  38,129,51,63,102,129,51,29,128,3,40,71,3,63,93,128,3,0,128,3,30,128,3,40,
+  128,3,5,72,3,63,83,128,3,0,128,3,31,128,3,40,128,3,63,98,128,3,0,128,
+  3,32,128,3,40,128,3,63,96,128,3,1,128,3,33,128,3,40,128,3,63,94,128,3,
+  1,128,3,35,128,3,39,128,3,63,94,128,3,1,128,3,26,73,0,128,3,39,128,3,
+  63,92,128,3,1,128,3,27,128,0,66,8,6,128,3,38,128,3,63,92,128,3,1,128,
+  3,27,128,0,66,8,6,128,3,39,128,3,63,90,128,3,2,128,3,28,66,8,7,128,
+  3,39,128,3,1,127,55,0,30,128,3,2,128,3,41,128,3,38,128,3,1,66,8,63,
+  83,128,3,2,128,3,42,128,3,38,128,3,0,66,8,63,82,128,3,2,128,3,44,128,
+  3,38,128,3,66,8,63,81,128,3,1,66,3,37,99,0,10,128,3,63,84,128,3,0,
+  128,3,0,128,3,38,66,8,44,128,3,63,82,128,3,0,128,3,1,128,3,38,66,8,
+  44,128,3,63,82,129,51,1,128,3,39,66,8,45,128,3,63,80,129,51,1,128,3,63,
+  172,1,128,3,1,128,3,63,25,66,8,63,80,130,3,3,110,0,66,8,39,66,8,63,
+  80,128,3,66,8,109,0,66,8,39,66,8,63,79,128,3,68,8,44,66,8,63,3,127,
+  43,0,11,128,3,68,8,49,76,0,50,128,0,66,8,127,42,0,9,128,3,68,8,48,
+  128,0,66,8,71,0,52,68,8,63,51,128,3,67,8,49,68,8,59,68,8,3,127,41,
+  0,5,128,3,66,8,50,68,8,37,128,0,66,8,0,128,0,66,8,12,68,8,2,129,
+  0,66,8,63,43,128,3,66,8,50,68,8,37,128,0,66,8,0,128,0,66,8,13,66,
+  8,3,128,0,68,8,63,98,66,8,38,128,0,66,8,0,128,0,66,8,20,128,0,68,
+  8,63,152,1,82,0,68,8,63,148,1,66,8,0,128,0,66,8,15,66,8,63,41,71,
+  0,63,36,66,8,0,128,0,66,8,63,59,66,8,73,0,37,68,8,52,66,8,1,66,
+  8,63,59,66,8,77,0,33,68,8,63,120,66,8,47,68,8,63,225,2,66,8,63,172,
+  1,68,8,63,171,1,68,8,63,171,1,68,8,63,172,1,66,8,1,127,176,1,0,66,
+  8,63,173,1,66,8,63,173,1,66,8,63,55,127,177,1,0,66,8,63,43,66,8,127,
+  63,0,66,8,63,43,66,8,127,63,0,66,8,63,41,129,0,66,8,0,66,8,127,166,
+  1,0,66,8,67,0,66,8,127,165,1,0,68,8,66,0,66,8,127,165,1,0,68,8,
+  127,171,1,0,68,8,63,170,1,68,8,127,171,1,0,68,8,127,171,1,0,68,8,127,
+  172,1,0,66,8,127,172,16,0,66,8,127,172,1,0,68,8,63,171,1,68,8,63,171,
+  1,68,8,63,172,1,66,8,63,147,10,63,126,128,0,1,128,8,63,172,1,128,0,1,
+  128,8,63,138,5,66,8,63,172,1,68,8,63,139,5,128,0,2,127,227,2,0,63,234,
+  1,66,8,63,172,1,128,0,1,128,8,63,175,1,128,8,63,161,3,128,0,1,128,8,
+  63,167,1,69,0,1,128,8,63,172,1,128,0,1,128,8,63,150,6,66,8,63,173,1,
+  66,8,102,0,66,8,63,131,1,66,8,102,0,49,128,0,1,128,8,63,81,104,0,52,
+  128,8,63,122,101,0,10,68,8,63,238,2,66,8,40,70,8,63,124,128,0,1,128,8,
+  63,171,1,68,8,39,128,0,63,59,66,8,63,7,95,0,9,128,0,4,127,53,0,68,
+  8,63,48,128,0,3,128,8,63,53,68,8,127,38,0,10,128,0,1,128,8,63,54,68,
+  8,92,0,63,146,1,93,0,63,144,1,95,0,63,165,3,66,8,63,166,1,66,8,2,
+  68,8,23,66,8,11,66,8,63,157,1,128,0,1,128,8,63,87,66,8,63,18,128,1,
+  9,66,8,63,76,68,8,46,68,0,4,128,0,38,87,0,63,50,68,8,115,0,2,66,
+  1,63,113,68,8,113,0,41,128,0,67,1,63,78,111,0,4,66,8,88,0,4,128,8,
+  63,87,110,0,7,66,8,88,0,63,149,1,66,0,66,8,84,0,0,68,8,63,92,66,
+  8,78,0,66,8,32,66,8,84,0,68,8,83,0,63,73,69,8,47,66,8,84,0,63,
+  98,69,8,45,66,8,63,139,1,77,0,45,129,48,63,132,3,90,0,63,110,128,8,9,
+  66,8,20,66,8,63,133,1,70,8,8,66,8,83,0,68,8,63,132,1,70,8,8,66,
+  8,70,0,12,68,8,66,0,63,129,1,70,8,9,72,0,12,68,8,66,0,63,130,1,
+  68,8,71,0,28,67,0,66,8,128,0,63,128,1,70,0,66,8,128,1,26,128,0,1,
+  128,8,1,66,8,128,0,63,135,1,66,8,77,0,19,66,8,128,0,63,135,1,66,8,
+  77,0,63,166,1,66,8,70,0,14,70,0,63,138,1,66,8,128,0,0,68,8,70,0,
+  63,159,1,66,8,128,0,0,68,8,70,0,63,159,1,66,8,128,0,0,68,8,70,0,
+  63,165,1,66,8,128,3,63,14,128,0,1,128,8,63,172,1,128,0,1,128,8,63,172,
+  1,128,3,1,128,8,63,254,2,66,8,63,172,1,68,8,63,121,68,8,63,205,3,128,
+  0,2,86,0,63,99,128,0,2,128,0,45,130,0,3,63,123,70,0,63,154,7,66,8,
+  128,3,63,171,1,68,8,77,0,63,16,128,0,1,128,8,63,73,68,8,128,3,63,28,
+  128,0,3,128,8,63,53,66,8,128,0,14,68,8,128,3,63,28,128,0,3,128,8,63,
+  53,66,8,128,3,15,66,8,128,3,63,29,128,0,3,128,8,63,53,66,8,128,0,63,
+  47,128,0,4,128,8,63,169,1,128,0,1,128,8,63,146,1,128,0,1,70,8,15,128,
+  0,1,128,8,63,146,1,128,0,1,69,8,40,66,8,63,123,128,0,1,128,8,44,128,
+  0,1,128,8,63,42,66,8,77,0,63,49,128,0,1,128,8,63,42,66,8,128,3,63,
+  62,121,0,51,66,8,128,0,63,231,7,128,0,1,128,8,63,172,1,128,0,1,128,8,
+  63,172,1,128,0,1,128,8,63,209,12,128,0,1,128,8,63,171,1,128,0,6,128,8,
+  63,167,1,128,0,6,128,8,63,167,1,128,0,6,128,8,63,168,1,128,0,3,128,8,
+  63,171,1,128,0,1,128,8,63,156,1,128,0,1,128,8,63,64,66,8,99,0,63,5,
+  128,0,1,128,8,19,128,0,1,128,8,63,39,68,8,74,0,63,29,128,0,1,128,8,
+  19,128,0,1,128,8,63,39,68,8,73,0,63,54,128,0,1,128,8,63,39,68,8,71,
+  0,63,164,1,66,8,70,0,53,128,0,1,128,8,63,96,66,8,80,0,55,128,3,1,
+  128,8,63,95,68,8,77,0,57,128,0,1,128,8,43,128,0,1,128,8,63,47,68,8,
+  75,0,63,43,128,0,3,128,8,63,46,68,8,73,0,63,17,128,0,1,128,8,23,128,
+  0,3,128,8,1,128,0,1,128,8,63,41,66,8,72,0,63,19,128,0,1,128,8,21,
+  128,0,5,128,8,1,128,0,6,128,0,1,128,8,63,128,1,128,0,1,128,8,12,128,
+  0,1,128,8,3,128,0,5,128,8,2,128,0,6,128,0,1,128,8,63,145,1,128,0,
+  1,128,8,3,128,0,3,128,8,3,128,0,1,67,8,1,128,0,1,128,8,63,145,1,
+  128,0,1,128,8,3,128,0,3,128,8,3,128,0,1,128,8,63,160,1,128,0,4,128,
+  8,4,128,0,1,128,8,63,160,1,128,0,1,128,8,63,172,1,128,0,1,128,8,63,
+  30,66,8,87,0,6,66,8,66,3,63,136,1,66,8,86,0,7,66,8,95,0,63,105,
+  68,8,85,0,8,66,8,95,0,63,108,86,0,63,141,1,66,8,68,0,3,70,0,66,
+  8,75,0,63,43,128,0,1,128,8,63,31,66,8,68,0,3,70,0,66,8,74,0,63,
+  44,128,0,1,128,8,63,31,66,8,69,0,66,8,70,0,66,8,72,0,63,46,128,0,
+  1,128,8,63,40,66,8,80,0,128,3,63,141,5,66,8,63,185,2,128,0,1,128,8,
+  63,172,1,128,0,1,128,8,63,160,1,128,0,1,128,8,7,128,0,1,128,8,63,159,
+  1,128,0,3,128,8,63,170,1,128,0,3,128,8,63,170,1,128,0,3,128,8,63,171,
+  1,128,0,1,128,8,63,13,69,0,63,5,130,0,3,63,100,68,0,63,19,129,48,89,
+  0,63,56,68,8,70,0,63,164,1,68,8,70,0,63,1,66,8,63,96,68,8,63,23,
+  66,8,63,82,66,8,63,182,1,66,8,128,1,63,172,1,66,8,128,0,63,170,1,68,
+  8,128,0,63,170,1,66,8,67,0,63,169,1,66,8,67,0,63,160,2,128,3,93,0,
+  63,202,2,130,0,3,63,228,1,66,8,63,230,2,66,8,63,141,45,127,66,0,63,3,
+  86,0,19,128,0,1,128,8,63,172,1,128,0,1,128,8,63,173,1,66,8,63,129,1,
+  66,8,63,3,128,0,1,128,8,63,171,1,128,0,3,128,8,63,170,1,128,0,3,128,
+  8,63,54,128,8,63,30,68,0,15,128,0,3,128,8,3,127,42,0,63,39,128,0,1,
+  128,8,17,128,0,1,128,8,3,128,0,2,127,41,0,63,37,128,0,1,128,8,63,173,
+  1,66,8,63,184,1,81,0,68,8,63,153,1,128,0,1,128,8,14,66,8,63,91,128,
+  1,120,0,4,128,0,1,128,8,63,109,128,0,62,66,8,63,109,128,0,63,176,1,67,
+  8,63,113,127,176,1,0,2,127,172,1,0,63,160,3,68,8,63,172,1,66,8,63,223,
+  10,127,176,1,0,63,168,1,128,0,2,67,0,63,176,1,66,8,63,148,3,128,0,3,
+  128,8,63,138,5,68,8,63,172,1,66,8,63,188,14,127,176,1,0,2,127,172,1,0,
+  63,160,3,68,8,63,172,1,66,8,63,163,8,63,188,8,128,0,1,128,8,63,171,1,
+  128,0,3,128,8,63,170,1,128,0,3,128,8,63,170,1,128,0,3,128,8,63,171,1,
+  128,0,1,128,8,63,114,66,8,63,172,1,68,8,53,66,8,63,210,4,128,0,2,118,
+  0,63,118,114,0,66,8,2,128,0,1,128,8,1,66,8,63,107,66,8,49,68,8,1,
+  128,0,1,128,8,63,162,3,127,164,1,0,2,127,181,1,0,66,8,63,74,66,8,63,
+  31,68,8,63,115,66,8,63,224,1,66,8,63,80,105,0,55,128,0,2,127,167,1,0,
+  5,127,157,1,0,10,128,0,3,128,8,63,170,1,128,0,3,128,8,63,169,1,128,0,
+  63,129,1,68,8,63,139,5,98,0,10,128,0,2,127,54,0,32,66,8,63,19,127,57,
+  0,32,66,8,127,7,0,63,102,66,8,127,7,0,63,103,127,9,0,63,212,2,66,8,
+  63,173,1,66,8,67,0,63,118,66,8,47,66,8,67,0,63,117,68,8,47,68,0,69,
+  8,22,68,8,63,84,68,8,116,0,63,118,68,8,116,0,63,122,115,0,30,128,0,2,
+  71,0,63,79,114,0,34,128,0,63,149,1,66,8,21,68,8,63,92,66,8,63,11,69,
+  8,63,95,129,136,63,176,1,76,0,35,87,0,4,66,8,63,90,129,0,2,76,0,32,
+  66,8,88,0,128,3,63,99,92,0,18,66,8,88,0,63,148,1,66,8,88,0,3,66,
+  0,63,98,66,8,63,173,1,68,8,74,0,63,166,1,73,0,63,166,1,73,0,63,166,
+  1,72,0,31,66,8,63,131,1,72,0,63,203,1,66,8,66,0,63,170,1,66,8,68,
+  0,128,3,63,167,1,66,8,68,0,63,164,5,66,8,63,141,5,66,0,63,202,6,67,
+  8,63,171,1,68,8,128,0,63,170,1,68,8,128,3,63,170,1,68,8,128,0,63,171,
+  1,66,8,66,0,63,240,9,66,8,63,175,1,129,136,63,170,1,128,0,3,128,8,63,
+  148,1,128,0,1,128,8,17,128,0,3,128,8,63,152,1,128,8,16,129,0,63,156,1,
+  128,8,17,127,16,0,63,70,128,0,5,128,8,63,168,1,128,0,4,128,8,63,169,1,
+  129,0,63,89,66,8,63,19,73,0,63,176,4,67,0,63,221,24,128,0,1,128,8,63,
+  160,1,128,0,1,128,8,6,128,0,6,128,8,63,155,1,128,0,3,128,8,5,128,0,
+  6,128,8,63,155,1,128,0,3,128,8,5,128,0,6,128,8,63,155,1,128,0,3,128,
+  8,6,128,0,3,128,8,63,158,1,128,0,1,128,8,8,128,0,1,128,8,63,158,2,
+  66,8,100,0,63,30,128,0,1,128,8,63,37,68,8,75,0,63,54,128,0,1,128,8,
+  63,37,68,8,74,0,63,20,128,0,1,128,8,30,128,0,1,128,8,63,37,68,8,72,
+  0,63,21,128,0,3,128,8,63,72,66,8,71,0,63,28,128,8,63,175,1,128,8,63,
+  174,1,128,8,63,155,1,128,8,63,175,1,128,8,37,127,10,0,63,60,128,0,1,128,
+  8,27,128,0,13,128,8,1,128,0,1,128,8,63,20,66,8,82,0,63,39,72,0,14,
+  128,8,1,128,0,1,128,8,63,19,68,8,79,0,63,41,128,0,1,128,8,3,128,0,
+  3,128,8,9,128,8,1,128,0,1,128,8,63,19,68,8,74,0,63,46,128,0,1,128,
+  8,3,128,0,3,128,8,63,36,68,8,69,0,62,128,3,94,0,20,66,8,4,128,0,
+  1,128,8,63,38,66,8,76,0,63,132,3,90,0,57,66,8,63,197,2,69,8,63,169,
+  1,70,8,63,161,1,66,8,128,1,3,67,8,71,0,63,59,81,0,63,15,66,8,128,
+  1,3,67,8,71,0,63,59,128,0,1,128,8,8,128,0,1,128,8,63,16,66,8,128,
+  1,4,66,8,71,0,63,59,128,0,1,128,8,8,128,0,1,128,8,2,127,16,0,5,
+  66,8,81,0,63,50,66,8,8,128,0,1,128,8,2,128,0,1,128,8,63,36,66,8,
+  128,0,63,68,128,0,1,128,8,63,36,66,8,128,0,63,69,66,8,63,36,66,8,69,
+  0,63,181,2,128,0,1,128,8,63,172,1,128,0,1,128,8,63,172,1,128,0,1,128,
+  8,63,246,1,66,8,79,0,63,156,1,71,8,74,0,63,157,1,71,8,70,0,63,161,
+  1,71,8,67,0,63,165,1,66,8,128,1,63,130,7,66,8,123,0,14,129,48,92,0,
+  63,67,66,8,123,0,63,113,66,8,122,0,63,108,129,0,63,18,66,8,63,196,2,66,
+  8,128,0,63,172,1,66,8,128,0,0,66,8,63,168,1,66,8,73,0,63,47,128,0,
+  1,128,8,63,172,1,128,0,1,128,8,63,117,129,48,86,0,29,128,0,1,128,8,63,
+  213,4,66,8,63,150,22,73,0,63,134,5,66,8,51,128,0,1,128,8,63,172,1,128,
+  0,1,128,8,63,172,1,128,0,1,128,8,63,224,13,129,48,110,0,63,129,1,110,0,
+  63,125,68,8,109,0,63,7,127,44,0,9,68,8,114,0,63,1,128,0,2,127,43,0,
+  7,68,8,63,147,2,80,0,63,155,1,67,0,16,68,8,3,128,0,1,128,8,63,43,
+  66,8,63,54,66,8,3,128,0,3,128,8,63,145,1,66,8,21,128,0,3,128,8,63,
+  141,1,66,8,2,87,0,3,128,8,63,147,1,128,0,1,128,8,19,128,0,1,128,8,
+  63,148,1,128,0,1,128,8,63,115,129,0,1,128,8,52,66,8,63,119,128,8,63,175,
+  1,128,8,63,171,1,66,8,63,183,8,127,175,1,0,66,8,127,173,1,0,66,8,127,
+  173,1,0,66,8,63,57,127,177,1,0,1,128,8,63,172,1,128,0,1,128,8,63,173,
+  1,66,8,63,42,66,8,63,145,5,66,8,63,148,3,128,0,63,143,5,68,8,63,172,
+  1,66,8,63,188,14,127,175,1,0,2,127,172,1,0,68,8,127,171,1,0,68,8,127,
+  171,1,0,68,8,63,172,1,66,8,63,180,6,63,127,66,7,63,173,1,127,158,3,0,
+  66,7,63,172,1,68,7,63,171,1,68,7,63,171,1,68,7,63,171,1,128,0,66,7,
+  127,114,0,66,7,55,127,116,0,68,7,63,171,1,68,7,53,66,7,63,114,68,7,53,
+  66,7,63,114,128,0,66,7,118,0,66,7,63,115,121,0,66,7,63,112,66,7,50,128,
+  0,66,7,2,66,7,1,66,7,63,107,66,7,49,128,0,68,7,1,68,0,66,7,63,
+  107,66,7,49,128,0,68,7,6,66,7,63,107,117,0,68,7,63,171,1,128,0,66,7,
+  63,81,66,7,63,32,128,0,66,7,63,73,66,7,38,66,7,52,128,0,68,7,63,72,
+  66,7,38,66,7,52,128,0,68,7,63,72,105,0,66,7,47,66,7,1,128,0,68,7,
+  63,114,114,0,66,7,2,128,0,66,7,63,165,1,68,7,63,171,1,68,7,63,125,66,
+  7,42,68,7,63,125,66,7,41,69,7,63,123,68,7,40,70,7,63,52,66,7,63,4,
+  66,7,96,0,9,70,7,63,51,68,7,63,3,66,7,42,68,7,63,53,68,7,63,50,
+  66,7,63,54,68,7,27,66,7,63,140,1,128,0,66,7,92,0,66,7,63,141,1,95,
+  0,66,7,63,155,3,66,7,4,66,7,63,165,1,66,7,3,68,7,23,66,7,63,137,
+  1,66,7,3,68,7,23,66,7,11,66,7,63,71,66,7,47,70,0,68,7,23,66,7,
+  6,66,7,1,66,7,63,70,68,7,51,69,7,71,0,15,68,7,5,66,7,1,66,7,
+  63,70,68,7,51,66,7,67,0,22,68,7,5,66,7,63,75,68,7,51,67,7,25,68,
+  7,5,128,1,91,0,63,50,66,7,53,66,7,26,68,7,63,141,1,66,7,27,128,0,
+  66,7,63,141,1,67,0,66,7,21,69,7,63,90,66,7,78,0,66,7,33,66,7,20,
+  68,7,81,0,63,74,68,7,76,0,66,7,81,0,15,66,7,20,68,7,63,92,68,7,
+  76,0,66,7,79,0,14,66,7,23,71,7,63,91,66,7,93,0,16,66,7,25,72,7,
+  28,66,7,63,106,66,7,25,72,7,28,66,7,63,106,91,0,0,66,7,2,66,7,28,
+  66,7,63,63,67,7,35,66,7,28,96,0,63,71,68,7,10,66,7,19,68,7,63,132,
+  1,69,7,9,66,7,19,68,7,63,132,1,69,7,9,66,7,19,68,7,63,132,1,128,
+  0,68,7,32,128,0,66,7,67,0,66,7,63,127,128,0,66,7,4,66,7,26,128,0,
+  66,7,2,66,7,63,136,1,66,7,27,66,7,2,66,7,63,136,1,66,7,27,66,7,
+  63,142,1,128,1,69,0,66,7,20,71,0,63,138,1,66,7,1,68,7,63,166,1,66,
+  7,1,68,7,63,166,1,66,7,1,68,7,47,66,7,63,115,69,0,66,7,71,0,40,
+  66,7,63,121,66,0,48,66,7,27,66,7,63,173,1,66,7,63,173,1,66,7,63,142,
+  1,66,7,63,121,66,7,47,68,7,63,119,68,7,128,0,45,68,7,63,119,68,7,128,
+  3,45,68,7,63,119,68,7,128,0,45,128,0,66,7,128,3,63,120,66,7,66,0,45,
+  130,0,3,63,122,69,0,63,156,7,66,7,63,172,1,68,7,63,32,128,0,66,7,63,
+  71,68,7,63,31,128,0,68,7,63,50,66,7,16,68,7,63,9,66,7,18,128,0,68,
+  7,63,50,66,7,128,3,15,128,0,66,7,128,3,63,8,68,7,17,128,0,68,7,63,
+  50,66,7,128,0,16,66,0,63,8,69,7,18,128,0,66,7,63,52,67,0,63,26,70,
+  7,14,128,0,66,7,63,147,1,72,7,66,0,12,128,0,66,7,63,146,1,128,0,71,
+  7,67,0,12,128,0,66,7,63,146,1,128,0,66,7,0,66,7,40,128,0,66,7,63,
+  41,66,7,63,15,77,0,34,128,0,66,7,63,41,66,7,63,64,128,0,66,7,63,41,
+  66,7,63,135,4,128,0,66,7,63,172,1,128,0,66,7,63,73,66,7,63,32,128,0,
+  66,7,63,73,66,7,73,0,16,66,7,63,4,66,7,63,72,66,7,128,3,24,68,7,
+  63,3,66,7,63,73,66,0,24,68,7,63,3,66,7,63,101,68,7,63,171,1,128,0,
+  66,7,79,0,63,157,1,128,3,79,0,63,188,7,128,0,66,7,63,160,1,66,7,7,
+  128,0,71,7,63,155,1,68,7,6,128,0,71,7,63,155,1,68,7,6,128,0,71,7,
+  63,155,1,68,7,7,68,7,63,159,1,66,7,9,66,7,63,156,1,66,7,63,63,66,
+  7,63,43,66,7,21,128,0,66,7,63,36,68,7,10,66,7,74,0,63,17,66,7,21,
+  128,0,66,7,63,36,68,7,10,66,7,74,3,23,128,0,66,7,42,66,7,31,128,0,
+  66,7,63,36,68,7,10,66,7,80,0,17,128,3,66,7,41,68,7,63,72,66,7,49,
+  128,0,66,7,8,128,0,66,7,26,70,7,63,61,66,7,63,10,128,3,66,7,25,71,
+  7,63,60,68,7,63,9,128,0,66,7,7,128,0,67,3,12,70,7,10,128,0,66,7,
+  63,46,68,7,63,21,68,7,12,68,7,11,128,0,68,7,63,45,68,7,63,21,68,7,
+  1,75,0,66,7,12,128,0,68,7,63,46,66,7,63,22,68,7,1,66,7,23,70,7,
+  1,128,0,68,7,2,66,7,63,20,85,0,63,22,66,7,22,70,7,2,128,0,68,7,
+  2,66,7,63,19,128,0,66,7,80,0,63,24,66,7,14,66,7,4,68,7,3,128,0,
+  69,7,2,66,7,63,19,68,7,63,58,66,7,4,68,7,3,128,0,66,7,63,28,68,
+  7,63,58,66,7,1,128,0,69,7,4,128,0,66,7,63,28,68,7,63,5,128,0,66,
+  7,53,128,0,66,7,63,41,66,7,63,6,128,0,66,7,53,128,0,66,7,63,62,66,
+  7,128,0,47,128,0,66,7,63,86,66,7,87,0,6,66,7,128,3,63,136,1,68,7,
+  86,0,7,66,7,96,0,63,102,70,7,85,0,63,140,1,66,0,3,68,7,7,66,7,
+  63,152,1,66,7,128,0,3,68,7,7,66,7,63,57,128,0,66,7,8,128,0,66,7,
+  63,14,66,7,128,0,5,66,7,7,66,7,63,57,128,0,66,7,8,128,0,66,7,63,
+  14,66,7,6,66,7,63,68,128,0,66,7,8,128,0,66,7,2,128,0,66,7,63,34,
+  66,7,128,3,63,70,128,0,66,7,63,34,66,7,128,0,63,70,128,0,66,7,63,34,
+  66,7,70,0,63,182,2,127,10,0,63,102,66,7,63,160,1,130,0,1,9,66,7,63,
+  159,1,129,0,66,7,8,66,7,63,6,66,7,63,86,128,0,68,7,63,16,71,7,63,
+  82,128,0,68,7,63,16,71,7,63,83,68,7,63,16,71,7,63,84,66,7,63,10,66,
+  7,68,0,66,7,63,2,66,7,63,95,68,7,71,0,63,1,66,7,11,66,7,63,80,
+  68,7,71,0,63,1,66,7,11,66,7,63,80,68,7,71,0,63,16,66,7,63,81,66,
+  7,73,0,0,66,7,63,169,1,66,0,0,66,7,63,11,129,48,93,0,63,61,66,7,
+  128,0,0,66,7,63,11,66,7,63,90,66,7,128,0,63,15,66,7,63,88,68,7,63,
+  16,66,7,63,84,66,7,0,66,7,68,0,63,164,1,66,7,0,66,7,69,0,63,163,
+  1,66,7,63,58,66,7,63,173,1,66,7,63,173,1,66,7,63,116,66,7,86,0,63,
+  150,1,66,7,87,0,63,149,1,66,7,88,0,63,238,23,66,7,63,173,1,66,7,63,
+  173,1,66,7,52,66,7,63,173,1,66,7,63,173,1,66,7,63,236,2,66,7,63,173,
+  1,66,7,63,173,1,66,7,63,190,5,127,66,0,63,2,66,7,40,128,0,66,7,63,
+  78,66,7,46,66,7,40,128,0,66,7,63,77,68,7,45,66,7,41,66,7,63,77,68,
+  7,50,66,7,62,128,0,66,7,63,50,68,7,49,68,7,60,128,0,68,7,63,50,66,
+  7,114,0,68,7,60,128,0,68,7,63,50,66,7,50,68,7,43,66,7,13,128,0,68,
+  7,3,127,43,0,2,66,7,51,66,7,40,67,0,66,7,14,128,0,66,7,3,128,0,
+  66,7,127,42,0,63,36,128,0,69,7,22,68,7,63,141,1,128,0,66,7,25,68,7,
+  63,142,1,66,7,2,66,7,1,81,0,68,7,63,38,76,0,63,33,66,7,1,128,0,
+  66,7,14,66,7,63,39,66,7,50,119,0,66,7,1,128,0,66,7,63,57,66,7,48,
+  68,7,58,66,7,63,57,66,7,48,68,7,63,171,1,68,7,63,112,127,176,1,0,66,
+  7,127,172,1,0,68,7,63,171,1,68,7,63,171,1,68,7,63,172,1,66,7,0,127,
+  176,1,0,66,7,63,173,1,66,7,63,173,1,66,7,63,58,127,45,0,66,7,63,64,
+  66,7,63,42,66,7,63,64,66,7,63,42,66,7,0,127,63,0,66,7,63,39,69,0,
+  66,7,127,166,1,0,66,7,67,0,66,7,127,165,1,0,68,7,66,0,66,7,127,165,
+  1,0,68,7,66,0,66,7,63,165,1,68,7,63,170,1,68,7,127,171,1,0,68,7,
+  127,171,1,0,68,7,127,172,1,0,66,7,127,172,16,0,66,7,63,172,1,68,7,63,
+  171,1,68,7,63,171,1,68,7,63,172,1,66,7,63,180,6,63,127,128,0,1,128,7,
+  63,138,5,128,0,1,128,7,63,171,1,128,0,3,128,7,63,170,1,128,0,3,128,7,
+  63,170,1,128,0,3,128,7,63,113,66,7,54,128,0,1,128,7,63,116,129,119,63,170,
+  1,128,0,3,128,7,52,66,7,63,114,128,0,3,128,7,63,170,1,129,0,63,175,1,
+  121,0,63,182,1,66,7,63,172,1,128,0,1,128,7,63,172,1,128,0,1,128,7,63,
+  172,1,127,164,1,0,63,239,2,66,7,63,141,5,114,0,2,128,7,63,175,1,129,119,
+  63,170,1,128,0,3,128,7,63,158,1,128,2,15,128,7,63,158,1,128,2,9,69,7,
+  63,123,68,7,30,128,2,8,70,7,63,159,1,128,2,2,128,2,63,63,66,7,127,5,
+  0,35,128,2,2,128,2,63,62,68,7,127,39,0,128,2,2,128,2,5,128,0,2,127,
+  53,0,68,7,92,0,66,7,63,7,128,2,2,128,2,6,127,56,0,68,7,92,0,63,
+  10,128,2,2,128,2,63,64,66,7,93,0,63,10,128,2,2,128,2,63,97,127,10,0,
+  128,2,1,128,2,63,172,1,128,2,1,128,2,63,172,1,128,2,1,128,2,63,147,1,
+  66,7,21,128,2,1,128,2,63,44,66,7,63,61,128,2,0,128,2,63,44,68,7,52,
+  70,7,22,68,7,35,128,2,0,128,2,63,44,68,7,116,0,45,87,0,128,2,1,128,
+  2,5,128,2,63,37,68,7,116,0,27,128,2,40,128,2,1,128,2,4,128,2,63,42,
+  118,0,26,128,2,0,128,0,2,67,0,31,128,2,0,128,2,3,129,34,63,41,118,0,
+  28,128,2,1,129,0,36,128,2,0,128,2,2,128,2,63,128,1,128,2,39,128,2,0,
+  128,2,1,128,2,63,129,1,70,7,32,128,2,1,66,2,63,54,129,119,63,50,128,2,
+  0,129,34,63,171,1,128,2,1,128,2,63,133,1,129,2,36,128,2,0,128,2,63,57,
+  96,0,44,128,2,35,128,2,63,138,1,128,2,35,128,2,63,106,66,7,28,128,2,34,
+  128,2,0,128,2,63,65,68,7,33,68,7,27,128,2,34,128,2,0,128,2,63,65,69,
+  7,32,68,7,92,0,128,2,32,128,2,0,128,2,63,66,69,7,74,0,21,68,7,92,
+  0,128,2,32,128,2,0,128,2,63,66,69,7,74,0,9,128,2,14,68,0,128,2,1,
+  128,2,20,128,2,31,128,2,0,128,2,63,68,67,7,74,0,10,128,2,12,128,0,1,
+  128,7,5,128,2,20,128,2,3,128,2,26,129,34,63,71,71,0,15,128,2,23,128,2,
+  19,128,2,3,128,2,25,128,2,0,128,2,63,96,128,2,22,128,2,20,128,2,1,128,
+  2,5,128,2,19,129,34,63,97,128,2,12,71,0,128,2,1,128,2,19,128,2,1,128,
+  2,4,128,2,19,129,34,63,87,66,7,71,0,128,2,20,128,2,1,128,2,19,128,2,
+  1,128,2,3,128,2,20,129,34,63,86,68,7,70,0,128,2,20,128,2,2,128,2,18,
+  128,2,0,128,2,4,128,2,19,129,34,63,87,68,7,71,0,128,2,19,129,34,1,128,
+  2,14,66,7,0,128,2,0,128,2,3,128,2,20,128,2,63,88,68,7,71,0,128,2,
+  19,129,34,2,128,2,17,128,2,0,128,2,2,128,2,20,129,34,63,89,66,7,72,0,
+  128,2,20,129,34,1,128,2,16,128,2,0,128,2,2,128,2,21,128,2,63,87,128,2,
+  5,128,2,6,128,2,20,129,34,1,128,2,13,66,0,128,2,0,128,2,1,128,2,63,
+  112,128,2,5,128,2,6,128,2,20,128,2,1,128,2,16,129,34,2,128,2,63,113,129,
+  34,3,128,2,6,128,2,20,129,34,0,128,2,13,66,7,129,34,1,128,2,21,128,2,
+  63,93,128,2,3,128,2,6,128,2,20,128,2,0,128,2,12,68,7,128,2,0,128,2,
+  22,128,2,63,96,128,7,1,128,2,5,128,2,20,66,2,18,128,2,22,128,2,63,100,
+  128,2,6,128,2,20,128,2,0,128,2,16,128,2,22,128,2,63,99,128,2,1,128,2,
+  5,128,2,20,128,2,0,128,2,11,128,0,2,129,34,22,128,2,63,100,128,2,0,128,
+  2,6,128,2,19,128,2,0,128,2,12,131,0,34,22,128,2,63,102,128,2,0,128,2,
+  5,128,2,20,129,34,14,128,2,22,128,2,63,104,66,2,5,128,2,19,129,34,14,128,
+  2,22,128,2,63,106,128,2,5,128,2,19,129,34,14,128,2,21,128,2,63,108,128,2,
+  5,128,2,18,129,34,14,128,2,20,128,2,63,110,128,2,4,128,2,18,129,34,13,128,
+  2,21,128,2,63,111,128,2,4,128,2,18,128,2,13,128,2,20,128,2,63,113,128,2,
+  3,128,2,33,128,2,19,128,2,63,115,128,2,3,128,2,32,128,2,19,128,2,63,120,
+  128,2,18,128,2,12,128,2,18,128,2,37,128,0,1,128,7,63,77,128,2,1,128,2,
+  16,129,34,12,128,2,17,128,2,37,128,0,3,128,7,63,77,128,2,0,128,2,16,129,
+  34,11,128,2,18,128,2,36,128,0,4,128,7,14,66,7,63,60,128,2,0,128,2,16,
+  128,2,11,128,2,17,128,2,36,128,0,5,128,7,63,79,129,34,16,128,2,11,128,2,
+  16,128,2,34,128,0,7,128,7,63,81,129,34,15,128,2,11,128,2,16,128,2,34,128,
+  0,6,128,7,16,127,17,0,48,128,2,15,128,2,11,128,2,15,128,2,35,128,0,1,
+  129,7,1,128,7,40,128,0,1,128,7,63,39,66,7,78,0,128,2,10,128,2,14,128,
+  2,63,22,128,0,1,128,7,63,39,66,7,78,0,128,2,10,128,2,14,128,2,63,22,
+  128,0,1,128,7,63,39,66,7,129,34,13,128,2,9,128,2,13,128,2,63,135,1,128,
+  2,12,128,2,9,128,2,12,128,2,63,137,1,128,2,12,128,2,8,128,2,11,128,2,
+  63,139,1,128,2,11,128,2,8,128,2,11,128,2,63,153,1,128,2,7,128,2,10,128,
+  2,63,154,1,128,2,7,128,2,6,128,0,1,128,7,22,69,2,37,128,0,1,128,7,
+  63,74,128,2,9,128,2,6,128,2,5,128,0,3,128,7,19,129,34,5,73,2,27,128,
+  0,1,128,7,63,75,128,2,8,128,2,6,128,2,5,128,0,3,128,7,17,129,34,17,
+  69,2,21,128,0,1,128,7,63,76,128,2,8,128,2,5,128,2,5,128,0,3,128,7,
+  15,129,34,25,67,2,63,99,128,2,7,128,2,5,128,2,6,128,0,1,128,7,14,129,
+  34,31,66,2,63,97,129,34,6,128,2,4,128,2,6,128,2,15,129,34,63,136,1,128,
+  2,5,128,2,4,128,2,5,128,2,14,129,34,63,139,1,128,2,5,128,2,3,128,2,
+  5,128,2,12,129,34,63,142,1,128,2,4,128,2,3,128,2,4,128,2,10,66,2,63,
+  145,1,128,2,4,128,2,2,128,2,3,128,2,9,129,34,63,149,1,129,34,2,128,2,
+  2,128,2,3,128,2,7,129,34,56,128,1,1,128,7,63,92,128,2,2,128,2,1,128,
+  2,2,128,2,6,129,34,57,128,0,3,128,7,63,92,128,2,1,128,2,1,128,2,1,
+  128,2,5,129,34,59,128,0,3,128,7,63,93,128,2,1,128,2,0,128,2,1,128,2,
+  3,129,34,42,72,2,9,128,0,3,128,7,63,94,128,2,0,128,2,0,128,2,0,128,
+  2,2,129,34,34,73,2,2,129,34,14,128,1,1,128,7,63,96,68,2,1,129,34,34,
+  129,34,10,129,34,63,78,66,7,101,0,68,2,33,66,2,10,129,34,40,128,0,1,128,
+  7,63,34,68,7,75,0,13,79,2,30,66,2,12,128,2,42,128,0,1,128,7,63,34,
+  68,7,75,0,2,74,2,8,129,34,0,73,2,22,129,34,13,129,34,7,128,0,1,128,
+  7,31,128,0,1,128,7,63,34,68,7,73,0,129,34,19,66,2,1,129,34,0,128,2,
+  0,66,2,2,66,2,2,128,2,12,66,2,13,129,34,8,128,0,3,128,7,63,70,66,
+  7,72,0,129,34,19,129,34,4,129,34,0,128,2,3,66,2,6,69,2,5,128,2,14,
+  129,34,15,128,7,63,59,66,7,81,0,129,34,18,66,2,5,128,2,0,128,2,1,128,
+  2,5,129,34,10,66,2,15,69,2,14,128,7,63,58,68,7,78,0,129,34,18,129,34,
+  8,128,2,0,128,2,2,128,2,6,66,2,22,67,2,5,69,2,7,128,7,63,59,68,
+  7,76,0,129,34,17,66,2,9,128,2,1,128,2,3,128,2,8,66,2,10,129,34,2,
+  66,2,16,128,2,4,128,2,63,61,68,7,74,0,129,34,17,129,34,12,128,2,1,128,
+  2,3,128,2,11,129,34,9,67,2,26,67,2,63,58,66,7,73,0,129,34,16,66,2,
+  14,128,2,1,128,2,4,128,2,12,66,2,2,67,2,2,129,34,8,128,0,1,128,7,
+  22,128,0,13,128,7,1,128,0,1,128,7,63,41,129,34,15,66,2,16,128,2,2,128,
+  2,5,128,2,14,66,2,8,129,34,6,128,0,1,128,7,21,128,0,14,128,7,1,128,
+  0,1,128,7,63,39,129,34,15,129,34,19,128,2,2,128,2,6,128,2,27,129,34,4,
+  128,0,1,128,7,13,128,0,1,128,7,3,128,0,3,128,7,3,128,0,4,128,7,1,
+  128,0,1,128,7,63,34,68,2,14,66,2,20,128,2,3,128,2,7,128,2,28,129,34,
+  20,128,0,1,128,7,3,128,0,3,128,7,3,128,0,1,128,7,63,38,68,2,1,128,
+  2,14,129,34,23,128,2,3,128,2,7,128,2,30,128,2,19,128,0,1,128,7,1,128,
+  0,4,128,7,4,128,0,1,128,7,63,44,128,2,12,66,2,25,128,2,3,128,2,39,
+  129,34,24,128,0,1,128,7,63,55,128,2,11,129,34,27,128,2,4,128,2,40,129,34,
+  23,128,0,1,128,7,63,55,128,2,4,67,0,66,2,29,128,2,4,128,2,40,128,2,
+  0,128,2,63,81,128,2,8,128,2,31,128,2,5,128,2,11,128,2,28,128,2,0,128,
+  2,63,50,69,7,22,128,2,5,128,2,35,128,2,5,128,2,11,128,2,28,128,2,1,
+  128,2,63,77,128,2,3,67,2,66,7,31,128,2,6,128,2,12,128,2,28,128,2,63,
+  54,72,0,14,128,2,1,66,2,1,128,2,35,128,2,6,128,2,13,128,2,27,128,2,
+  63,54,72,0,13,67,2,3,128,2,36,128,2,6,128,2,14,128,2,27,128,2,63,50,
+  66,7,72,0,11,66,2,5,128,2,36,128,2,7,128,2,14,128,2,63,79,66,7,82,
+  0,129,34,0,128,2,5,128,2,37,128,2,7,128,2,15,128,2,63,96,66,0,128,2,
+  1,128,2,4,129,34,37,128,2,8,128,2,16,128,2,63,94,66,7,128,2,1,128,2,
+  4,128,2,39,128,2,8,128,2,17,128,2,63,93,66,7,71,0,128,2,39,128,2,9,
+  128,2,18,128,2,63,92,66,7,6,128,2,40,128,2,9,128,2,18,128,2,63,92,128,
+  2,7,128,2,41,128,2,9,128,2,19,128,2,59,128,0,1,128,7,63,26,128,2,7,
+  128,2,41,128,2,10,128,2,20,128,2,58,128,0,1,128,7,63,25,128,2,5,66,2,
+  42,128,2,10,128,2,21,128,2,57,128,0,1,128,7,63,5,130,0,1,15,128,2,2,
+  68,2,43,128,2,11,128,2,21,128,2,63,69,128,1,2,75,0,70,2,46,128,2,11,
+  128,2,22,128,2,63,64,71,7,71,0,71,2,49,128,2,11,128,2,23,128,2,63,63,
+  71,7,68,0,66,2,0,66,2,52,128,2,12,128,2,24,128,2,63,56,69,0,68,7,
+  9,129,34,53,130,0,2,12,128,2,25,128,2,63,57,68,0,66,7,63,18,129,32,89,
+  0,128,2,63,53,68,7,72,0,63,45,128,2,63,52,68,7,72,0,63,1,66,7,41,
+  128,2,63,51,68,7,63,10,128,2,13,66,7,27,128,2,63,51,66,7,63,11,128,2,
+  14,128,2,29,128,2,63,127,128,2,14,129,32,93,0,128,2,63,127,128,2,47,128,2,
+  63,125,128,2,49,128,2,63,52,67,0,63,4,128,2,15,66,7,128,2,30,128,2,63,
+  50,66,7,128,0,63,5,128,2,18,128,2,30,128,2,63,50,66,7,74,0,57,128,2,
+  20,128,2,30,128,2,92,0,63,20,66,7,63,5,128,2,20,128,2,63,152,1,128,2,
+  22,128,2,32,128,2,63,115,130,0,2,22,128,2,29,66,7,0,128,2,63,141,1,128,
+  2,33,129,34,63,140,1,128,2,34,128,2,63,111,66,7,24,128,2,35,129,34,63,109,
+  128,2,27,128,2,36,129,34,63,106,129,34,27,128,2,38,128,2,63,104,129,34,29,128,
+  2,38,129,34,63,102,129,34,29,128,2,40,71,2,63,93,128,2,0,128,2,30,128,2,
+  40,128,2,5,72,2,63,83,128,2,0,128,2,31,128,2,40,128,2,63,98,128,2,0,
+  128,2,32,128,2,40,128,2,63,96,128,2,1,128,2,33,128,2,40,128,2,63,94,128,
+  2,1,128,2,35,128,2,39,128,2,63,94,128,2,1,128,2,36,128,2,39,128,2,63,
+  92,128,2,1,128,2,38,128,2,38,128,2,63,92,128,2,1,128,2,38,128,2,39,128,
+  2,63,90,128,2,2,128,2,39,128,2,39,128,2,63,88,128,2,2,128,2,41,128,2,
+  38,128,2,2,127,55,0,29,128,2,2,128,2,42,128,2,38,128,2,63,86,128,2,2,
+  128,2,44,128,2,38,128,2,63,84,128,2,1,66,2,63,21,128,2,0,66,7,63,80,
+  128,2,0,128,2,0,128,2,38,98,0,12,128,2,63,82,128,2,0,128,2,1,128,2,
+  63,23,128,2,63,82,129,34,1,128,2,63,25,128,2,63,80,129,34,1,128,2,40,66,
+  7,63,128,1,128,2,1,128,2,63,172,1,128,2,0,128,2,63,173,1,128,2,0,128,
+  2,63,172,1,66,2,111,0,63,125,128,2,2,110,0,63,181,1,74,0,55,127,45,0,
+  62,128,0,2,69,0,56,128,0,2,127,44,0,5,68,7,63,171,1,67,7,63,36,128,
+  0,1,128,7,63,68,66,7,115,0,68,7,43,128,0,1,128,7,13,68,7,3,128,0,
+  1,128,7,63,41,66,7,52,66,7,44,128,0,1,128,7,14,66,7,3,128,0,3,128,
+  7,63,170,1,128,0,3,128,7,63,170,1,128,0,3,128,7,63,171,1,128,0,1,128,
+  7,63,202,2,129,0,63,142,5,66,7,63,113,66,7,127,172,1,0,68,7,127,171,1,
+  0,68,7,127,171,1,0,68,7,127,172,1,0,66,7,127,178,1,0,63,138,5,127,67,
+  0,63,44,66,7,127,65,0,63,44,66,7,127,65,0,63,44,66,7,63,232,8,128,0,
+  63,143,5,68,7,63,172,1,66,7,63,188,14,127,176,1,0,2,127,172,1,0,63,160,
+  3,68,7,63,172,1,66,7,63,196,4,63,128,1,127,158,3,0,66,6,63,172,1,68,
+  6,63,171,1,68,6,63,171,1,68,6,63,171,1,128,0,66,6,127,114,0,66,6,55,
+  127,116,0,68,6,63,171,1,68,6,52,128,0,66,6,63,114,68,6,52,128,0,66,6,
+  63,115,66,6,53,128,0,66,6,63,172,1,128,0,66,6,63,166,1,66,6,2,128,0,
+  66,6,1,66,6,63,106,66,6,50,68,6,1,69,0,66,6,63,106,66,6,50,68,6,
+  7,66,6,63,106,66,6,50,68,6,63,171,1,128,0,66,6,127,80,0,66,6,63,26,
+  71,0,66,6,63,72,66,6,103,0,66,6,53,68,6,63,71,66,6,103,0,66,6,53,
+  68,6,63,72,105,0,66,6,48,66,6,1,68,6,63,165,1,128,0,66,6,1,128,0,
+  66,6,127,166,1,0,68,6,1,127,169,1,0,68,6,63,124,66,6,42,128,0,68,6,
+  63,122,68,6,41,128,0,69,6,63,122,68,6,40,128,0,70,6,63,50,66,6,63,5,
+  66,6,96,0,9,128,0,70,6,63,49,68,6,63,4,99,0,9,128,0,68,6,127,51,
+  0,68,6,63,51,128,0,66,6,63,52,68,6,28,66,6,63,139,1,128,0,66,6,93,
+  0,66,6,63,140,1,96,0,66,6,63,154,3,66,6,4,66,6,63,165,1,66,6,67,
+  0,68,6,24,66,6,63,136,1,66,6,67,0,68,6,88,0,66,6,11,66,6,63,70,
+  66,6,48,69,0,68,6,88,0,66,6,11,66,6,63,69,68,6,52,69,6,87,0,68,
+  6,5,66,6,1,66,6,63,69,68,6,52,66,6,74,0,15,68,6,5,66,6,63,74,
+  68,6,52,67,6,25,68,6,5,66,6,63,75,66,6,54,66,6,26,66,6,63,143,1,
+  66,6,28,66,6,63,141,1,91,0,70,6,63,90,66,6,51,66,6,20,70,6,63,90,
+  68,6,12,66,6,33,66,6,20,68,6,63,92,68,6,12,66,6,33,66,6,20,129,2,
+  66,6,63,92,129,0,66,6,12,66,6,30,66,6,25,69,6,63,141,1,66,6,25,72,
+  6,28,66,6,63,106,66,6,25,72,6,28,66,6,63,62,66,6,36,66,6,29,69,0,
+  66,6,28,66,6,63,62,68,6,10,66,6,19,68,6,63,132,1,69,6,9,66,6,128,
+  0,18,68,6,63,132,1,69,6,9,66,6,128,1,18,68,6,63,132,1,69,6,10,129,
+  17,71,0,12,66,6,63,134,1,67,6,35,66,6,67,0,66,6,63,135,1,66,6,128,
+  0,26,66,6,67,0,66,6,63,135,1,66,6,128,1,26,66,6,67,0,66,6,63,135,
+  1,66,6,78,0,63,165,1,66,6,63,167,1,66,6,128,0,0,68,6,63,166,1,66,
+  6,128,0,0,68,6,48,66,6,63,114,66,6,128,0,0,68,6,48,66,6,63,120,66,
+  6,49,66,6,27,66,6,63,173,1,66,6,63,173,1,66,6,63,142,1,66,6,27,86,
+  0,63,69,66,6,48,68,6,63,118,69,6,46,68,6,63,118,69,6,46,68,6,63,118,
+  69,6,47,66,6,63,120,66,6,66,0,63,171,1,69,0,63,141,9,66,6,63,172,1,
+  68,6,63,33,128,0,66,6,63,70,68,6,63,32,128,0,68,6,63,49,66,6,16,68,
+  6,63,10,128,0,66,6,17,128,0,68,6,63,49,66,6,17,66,6,63,10,128,0,68,
+  6,16,128,0,68,6,63,49,66,6,63,30,70,6,13,128,0,66,6,128,0,66,6,63,
+  146,1,71,6,13,128,0,66,6,63,147,1,73,6,14,128,0,66,6,63,147,1,71,6,
+  63,83,66,6,63,18,66,6,0,66,6,41,128,0,66,6,63,38,66,6,63,67,128,0,
+  66,6,63,38,66,6,63,67,128,0,66,6,63,38,66,0,63,137,4,66,6,63,173,1,
+  66,6,63,73,66,6,63,33,66,6,63,73,66,6,27,66,6,63,4,66,6,63,71,66,
+  6,26,68,6,63,3,66,6,63,101,68,6,63,3,66,6,63,101,68,6,63,172,1,66,
+  6,63,186,9,128,0,66,6,63,160,1,66,6,7,128,0,71,6,63,155,1,68,6,6,
+  128,0,71,6,63,155,1,68,6,6,128,0,71,6,63,155,1,68,6,6,128,0,68,6,
+  63,159,1,66,6,8,128,0,66,6,63,155,1,128,0,66,6,63,61,104,0,63,6,128,
+  0,66,6,22,66,6,63,34,128,0,66,6,76,0,66,6,63,28,128,0,66,6,22,66,
+  6,63,34,68,6,11,66,6,35,66,6,43,66,6,32,66,6,63,34,68,6,11,66,6,
+  35,66,6,42,68,6,63,69,68,6,50,66,6,9,128,0,66,6,25,128,0,70,6,63,
+  59,66,6,7,66,6,63,1,128,2,66,6,24,128,0,71,6,63,58,68,6,63,11,128,
+  0,66,6,24,128,0,70,6,10,128,1,66,6,63,44,68,6,63,22,128,2,67,6,12,
+  128,2,68,6,11,128,0,68,6,63,43,68,6,63,22,128,0,67,6,13,128,0,66,6,
+  12,128,0,68,6,63,44,66,6,63,23,128,0,67,6,2,66,6,23,129,0,68,6,1,
+  69,6,2,66,6,63,128,1,66,6,22,128,0,69,6,2,69,6,2,66,6,63,18,66,
+  6,81,0,63,25,66,6,14,128,0,66,6,3,68,6,4,69,6,2,66,6,63,17,68,
+  6,75,0,63,48,128,0,66,6,3,68,6,4,66,6,63,26,68,6,70,0,63,53,128,
+  0,66,6,1,129,0,68,6,4,66,6,63,26,68,6,76,0,57,66,6,55,69,6,63,
+  36,66,6,76,0,58,66,6,55,66,6,63,114,66,6,55,66,6,63,26,66,6,88,0,
+  6,66,6,63,136,1,68,6,87,0,7,66,6,63,134,1,70,6,86,0,8,66,6,63,
+  134,1,68,6,7,66,6,76,0,63,139,1,66,6,128,0,3,66,6,73,0,66,6,75,
+  0,63,47,128,0,66,6,8,66,0,63,13,66,6,128,0,5,66,6,7,66,6,73,0,
+  63,49,128,0,66,6,8,66,6,63,13,66,6,128,0,5,66,6,63,70,128,0,66,6,
+  8,66,6,3,128,0,66,6,63,15,66,6,63,83,66,6,3,128,0,66,6,63,32,66,
+  6,63,73,128,0,66,6,63,32,66,6,63,173,1,66,6,63,191,2,128,0,66,6,63,
+  172,1,128,0,66,6,63,159,1,66,6,9,128,0,66,6,63,158,1,68,6,63,16,66,
+  6,0,66,6,63,84,68,6,63,15,71,6,63,84,68,6,63,15,71,6,63,85,66,6,
+  63,16,68,6,63,163,1,66,6,69,0,66,6,63,3,66,6,63,93,68,6,73,0,63,
+  1,66,6,11,66,6,63,78,68,6,73,0,63,1,66,6,11,66,6,63,78,68,6,74,
+  0,66,6,124,0,14,66,6,63,79,66,6,75,0,66,6,124,0,63,107,66,6,128,0,
+  0,66,6,123,0,63,108,66,6,66,0,63,14,66,6,63,88,67,6,67,0,63,13,66,
+  6,63,88,66,6,63,18,66,6,63,83,66,6,1,66,6,63,168,1,66,6,63,173,1,
+  66,6,63,59,66,6,63,173,1,66,6,63,173,1,66,6,63,116,66,6,63,173,1,66,
+  6,63,173,1,66,6,63,151,22,73,0,63,166,1,66,6,63,173,1,66,6,63,173,1,
+  66,6,52,66,6,63,173,1,66,6,63,173,1,66,6,63,236,2,66,6,63,173,1,66,
+  6,63,173,1,66,6,63,146,5,84,0,23,127,67,0,63,0,66,6,41,66,6,63,78,
+  66,6,46,66,6,41,66,6,63,77,68,6,45,66,6,41,66,6,63,77,68,6,50,66,
+  6,63,0,128,0,66,6,63,49,68,6,49,68,6,61,128,0,68,6,63,48,67,6,50,
+  68,6,44,66,6,13,128,0,68,6,63,48,66,6,51,68,6,44,66,6,13,128,0,68,
+  6,3,66,6,63,41,66,6,52,66,6,41,67,0,66,6,14,128,0,66,6,3,68,6,
+  63,141,1,128,0,66,6,25,68,6,63,141,1,128,0,66,6,1,66,6,20,68,6,63,
+  142,1,66,6,1,66,6,2,82,0,66,6,63,38,66,6,63,43,66,6,2,128,0,66,
+  6,63,56,66,6,50,126,0,66,6,63,56,66,6,48,68,6,59,66,6,63,108,68,6,
+  63,171,1,68,6,63,111,66,6,63,172,1,68,6,63,171,1,68,6,63,171,1,68,6,
+  63,172,1,66,6,63,178,1,127,176,1,0,66,6,63,173,1,66,6,63,173,1,66,6,
+  63,58,128,0,66,6,63,40,66,6,63,65,128,0,66,6,63,40,66,6,63,65,128,0,
+  66,6,63,40,66,6,0,127,176,1,0,66,6,63,165,1,128,0,66,6,67,0,66,6,
+  63,165,1,68,6,2,66,6,63,165,1,68,6,2,66,6,63,165,1,68,6,63,170,1,
+  128,0,67,6,63,171,1,68,6,63,171,1,68,6,63,171,1,68,6,63,172,1,66,6,
+  63,188,14,127,175,1,0,66,6,127,172,1,0,68,6,127,171,1,0,68,6,127,171,1,
+  0,68,6,63,172,1,66,6,63,213,2,63,227,11,66,6,63,172,1,68,6,63,139,5,
+  128,0,2,118,0,63,118,121,0,63,226,2,66,6,63,141,5,117,0,63,239,2,66,6,
+  63,141,5,115,0,63,175,1,68,6,63,138,5,68,6,127,123,0,63,217,6,66,6,63,
+  141,5,127,10,0,63,99,66,6,63,141,5,70,0,63,117,66,6,119,0,28,68,6,5,
+  66,6,63,73,68,6,117,0,63,117,68,6,117,0,63,117,68,6,117,0,29,128,0,2,
+  67,1,2,92,0,63,48,66,6,119,0,29,129,0,0,129,102,63,185,4,66,6,79,0,
+  66,6,62,78,0,63,76,68,6,77,0,63,157,1,68,6,77,0,33,69,6,25,66,6,
+  63,90,66,6,96,0,63,19,66,6,63,172,1,128,0,1,128,6,63,105,91,0,3,66,
+  0,31,128,2,1,128,6,63,172,1,127,65,0,63,187,5,128,6,63,141,5,70,0,63,
+  166,5,66,6,63,141,5,66,0,63,157,3,66,6,63,172,1,68,6,63,235,2,66,0,
+  63,173,1,128,2,46,128,0,2,128,2,63,123,128,0,47,129,0,66,2,63,202,10,66,
+  6,63,172,1,68,6,63,35,66,6,63,175,1,129,102,63,170,1,128,0,3,128,6,63,
+  47,66,6,66,0,14,128,0,2,128,2,63,33,128,0,3,128,6,63,47,66,6,128,2,
+  17,66,0,63,34,129,0,63,51,66,6,128,0,63,52,128,0,1,128,6,127,14,0,63,
+  94,128,0,1,128,6,63,146,1,128,0,24,128,0,1,128,6,63,146,1,128,0,48,66,
+  6,63,123,128,0,1,67,6,63,203,3,118,0,63,190,4,128,0,1,128,6,63,172,1,
+  128,0,1,128,6,63,172,1,128,0,1,128,6,63,136,20,128,0,1,128,6,63,171,1,
+  128,1,3,128,6,63,170,1,128,1,3,128,6,63,170,1,128,1,3,128,6,63,171,1,
+  128,0,1,128,6,63,178,3,128,0,1,128,6,63,33,66,6,76,0,66,6,75,0,63,
+  44,128,0,1,128,6,63,32,68,6,75,0,66,6,75,2,63,8,77,0,21,128,0,1,
+  128,6,63,32,68,6,74,0,0,66,6,81,0,63,1,129,0,63,71,68,6,72,0,63,
+  30,128,6,63,68,66,6,71,0,63,32,128,6,63,174,1,129,102,63,153,1,128,6,17,
+  66,6,63,154,1,128,6,63,175,1,128,6,46,128,0,1,128,6,63,154,1,128,0,16,
+  128,0,1,128,6,63,153,1,128,0,3,128,6,12,128,0,1,128,6,63,153,1,128,0,
+  3,128,6,3,128,0,1,128,6,63,162,1,128,0,3,128,6,3,128,0,1,128,6,63,
+  101,128,2,93,0,27,128,0,4,128,6,63,169,1,128,0,1,128,6,63,172,1,128,0,
+  1,128,6,63,59,66,6,128,2,49,66,6,63,119,66,6,97,0,63,139,1,66,6,96,
+  0,63,205,2,66,6,66,0,63,79,78,0,63,12,66,6,66,0,63,91,128,0,1,128,
+  6,63,11,66,6,66,0,63,91,128,0,1,128,6,63,160,1,66,6,8,128,0,1,128,
+  6,63,38,66,6,128,0,63,172,1,66,6,128,2,63,172,1,66,6,71,0,63,139,6,
+  128,0,1,128,6,63,171,1,128,0,3,128,6,63,14,66,6,128,0,0,78,0,63,72,
+  128,0,3,128,6,63,13,68,6,128,0,63,87,128,0,3,128,6,63,13,68,6,128,0,
+  63,88,128,1,1,128,6,63,14,68,6,128,0,66,6,63,168,1,66,6,66,0,63,176,
+  11,130,0,2,63,88,128,0,63,174,1,66,6,69,0,63,162,1,66,6,128,0,0,66,
+  6,70,0,63,12,66,6,63,82,66,6,128,0,0,66,6,63,168,1,66,6,76,0,63,
+  198,5,129,32,88,0,63,245,4,66,6,63,144,45,128,0,1,128,6,63,172,1,128,0,
+  1,128,6,63,172,1,128,0,1,128,6,63,149,5,81,0,63,185,1,127,44,0,63,67,
+  129,0,63,148,1,66,6,22,128,0,3,128,6,63,146,1,88,0,3,128,6,63,174,1,
+  129,102,63,172,1,66,6,63,147,1,66,6,63,115,129,0,63,210,4,123,0,66,6,63,
+  112,128,0,2,127,172,1,0,63,160,3,68,6,63,172,1,66,6,63,177,1,66,6,127,
+  173,1,0,66,6,127,173,1,0,66,6,127,167,1,0,63,165,4,66,6,63,44,127,169,
+  1,0,63,133,42,63,239,2,66,6,63,175,1,129,102,63,170,1,128,0,3,128,6,63,
+  170,1,128,0,3,128,6,63,112,66,6,54,129,0,63,115,68,6,54,127,116,0,63,235,
+  1,66,6,63,114,128,0,2,118,0,63,118,121,0,63,165,3,66,6,63,141,5,127,163,
+  1,0,63,84,66,6,63,141,5,106,0,63,231,1,128,6,63,171,1,128,0,3,128,6,
+  63,170,1,128,0,3,128,6,63,123,66,6,48,128,6,63,121,68,6,47,128,6,63,169,
+  1,70,6,63,125,96,0,63,140,1,99,0,63,187,1,128,0,2,127,52,0,63,57,127,
+  55,0,63,196,7,66,6,63,188,1,66,6,63,69,66,6,63,172,1,68,6,53,69,6,
+  63,175,1,88,0,15,88,0,63,158,2,128,0,2,119,0,63,117,122,0,63,204,1,70,
+  6,63,204,2,129,102,12,66,6,86,0,63,150,1,66,6,84,0,37,129,2,63,112,66,
+  6,82,0,63,138,1,99,0,63,171,3,66,6,63,132,1,68,6,34,68,6,63,131,1,
+  69,6,63,170,1,69,6,74,0,63,165,1,74,0,22,128,0,2,93,0,63,108,75,0,
+  22,128,0,6,66,6,63,129,1,75,0,63,192,3,130,32,0,63,142,1,66,6,63,172,
+  1,68,6,63,139,5,128,0,2,72,0,63,164,1,75,0,63,131,5,66,6,63,172,1,
+  68,6,63,171,1,69,6,63,170,1,69,6,63,156,3,69,0,63,141,9,66,6,128,2,
+  63,171,1,68,6,128,2,63,170,1,68,6,128,2,63,150,1,66,6,16,68,6,128,2,
+  63,171,1,66,6,128,0,63,135,3,68,0,63,29,128,0,63,172,1,73,6,63,157,3,
+  128,6,40,128,0,1,128,6,63,36,66,6,78,0,63,5,67,0,1,128,6,41,128,0,
+  1,128,6,63,36,66,6,79,0,63,53,128,0,1,128,6,63,36,66,6,128,2,63,132,
+  7,66,6,63,173,1,66,6,74,0,63,162,1,66,6,128,2,63,173,1,66,0,63,170,
+  15,128,0,1,128,6,63,171,1,128,0,6,128,6,63,167,1,128,0,6,128,6,63,167,
+  1,128,0,6,128,6,63,167,1,128,0,3,128,6,63,171,1,128,0,1,128,6,63,191,
+  11,66,6,71,0,63,164,1,68,6,79,0,63,155,1,68,6,77,0,63,157,1,68,6,
+  75,0,63,160,1,66,6,74,0,63,57,128,0,4,128,6,2,126,0,63,103,128,0,4,
+  128,6,63,152,1,128,0,1,128,6,12,128,0,4,128,6,63,152,1,128,0,1,128,6,
+  13,128,0,1,128,6,4,66,6,63,146,1,128,0,1,128,6,13,128,0,1,128,6,63,
+  219,5,66,6,89,0,63,146,1,128,0,2,88,0,63,145,1,128,0,4,87,0,63,145,
+  1,68,6,72,0,63,162,1,68,6,63,171,1,68,6,72,0,63,63,128,0,1,128,6,
+  63,33,66,6,83,0,63,52,128,0,1,128,6,15,128,0,1,128,6,63,13,66,6,82,
+  0,63,53,128,0,1,128,6,15,128,0,1,128,6,63,172,1,128,0,1,128,6,63,146,
+  5,128,0,1,128,6,63,172,1,128,0,1,128,6,63,172,1,128,0,1,128,6,63,229,
+  3,66,6,72,0,63,164,1,66,6,69,0,63,167,1,66,6,71,0,63,152,1,66,6,
+  69,0,63,7,129,32,77,0,63,79,68,6,74,0,63,0,66,6,76,0,63,80,68,6,
+  74,0,63,0,66,6,76,0,63,80,68,6,75,0,128,1,125,0,66,6,63,94,66,6,
+  76,0,63,171,1,68,0,63,176,1,66,6,63,153,3,129,102,63,133,6,128,0,1,128,
+  6,63,172,1,128,0,1,128,6,63,172,1,128,0,1,128,6,63,196,40,128,0,1,128,
+  6,63,172,1,128,0,1,128,6,63,172,1,128,0,1,128,6,63,191,8,129,34,111,0,
+  63,125,128,2,2,110,0,63,249,1,127,46,0,63,65,128,0,2,127,45,0,7,128,6,
+  63,174,1,128,6,63,167,2,68,6,63,48,66,6,63,35,66,0,18,66,6,63,140,3,
+  128,0,1,128,6,63,167,1,66,6,1,128,0,1,128,6,2,82,0,63,150,1,128,0,
+  1,128,6,63,116,126,0,63,176,1,66,6,63,223,2,129,102,63,163,10,127,176,1,0,
+  63,154,3,69,0,66,6,63,60,128,0,1,128,6,63,172,1,128,0,1,128,6,63,172,
+  1,128,0,1,128,6,63,39,66,6,63,170,1,70,0,63,171,1,68,0,63,167,1,68,
+  6,67,0,63,167,1,68,6,67,0,66,6,63,164,1,68,6,63,175,1,127,171,1,0,
+  68,6,127,171,1,0,68,6,127,171,1,0,68,6,63,172,1,66,6,63,188,14,127,176,
+  1,0,2,127,172,1,0,63,160,3,68,6,63,172,1,66,6,63,101,63,239,2,66,5,
+  63,172,1,68,5,63,171,1,68,5,63,171,1,68,5,63,112,66,5,56,66,5,63,112,
+  68,5,63,171,1,68,5,63,171,1,68,5,53,66,5,63,115,66,5,54,66,5,63,173,
+  1,66,5,63,173,1,66,5,63,111,66,5,52,66,5,2,66,5,1,128,0,66,5,63,
+  105,66,5,51,68,5,1,69,0,66,5,63,105,66,5,50,128,0,68,5,6,128,0,66,
+  5,63,105,118,0,68,5,63,78,66,5,63,25,129,0,66,5,63,79,66,5,39,66,5,
+  46,127,83,0,66,5,39,66,5,54,128,0,66,5,63,71,106,0,66,5,53,128,0,68,
+  5,63,113,116,0,66,5,0,128,0,68,5,63,165,1,68,5,128,0,68,5,63,165,1,
+  68,5,0,128,0,66,5,63,166,1,68,5,63,123,66,5,43,68,5,127,122,0,68,5,
+  42,68,5,127,123,0,68,5,41,70,5,63,49,66,5,63,6,66,5,43,70,5,63,48,
+  68,5,63,52,70,5,63,48,68,5,92,0,66,5,63,21,66,5,63,51,68,5,92,0,
+  66,5,127,8,0,63,68,66,5,93,0,66,5,127,8,0,63,69,127,43,0,63,99,66,
+  5,63,173,1,66,5,4,66,5,63,165,1,66,5,3,68,5,24,66,5,63,136,1,70,
+  0,68,5,24,66,5,11,66,5,63,68,66,5,120,0,68,5,23,68,5,10,66,5,63,
+  67,68,5,118,0,68,5,88,0,68,5,5,128,0,66,5,0,66,5,63,67,68,5,118,
+  0,66,5,90,0,68,5,5,128,0,66,5,63,71,68,5,118,0,66,5,26,128,1,66,
+  5,71,0,66,5,63,72,66,5,119,0,66,5,67,0,23,70,1,63,138,1,66,5,67,
+  1,25,66,5,63,141,1,129,17,88,0,0,70,5,63,145,1,66,5,20,70,5,63,89,
+  67,5,77,0,66,5,34,66,5,20,68,5,63,91,67,5,77,0,66,5,34,66,5,22,
+  66,5,63,91,67,5,77,0,66,5,31,66,5,87,0,1,69,5,63,141,1,66,5,25,
+  72,5,29,66,5,63,105,66,5,25,72,5,29,66,5,63,101,66,5,29,66,5,2,66,
+  5,29,66,5,63,60,68,5,34,68,5,34,88,0,63,71,69,5,10,66,5,19,68,5,
+  63,131,1,69,5,10,66,5,19,68,5,63,131,1,69,5,10,66,5,20,67,5,63,132,
+  1,67,5,76,0,23,66,5,3,66,5,63,126,78,0,24,66,5,3,66,5,63,135,1,
+  66,5,27,70,0,66,5,63,135,1,66,5,63,173,1,66,5,3,66,5,63,172,1,68,
+  5,48,66,5,63,114,66,5,1,68,5,48,66,5,63,114,66,5,1,68,5,48,66,5,
+  63,114,66,5,2,66,5,49,67,0,63,203,1,66,5,63,173,1,66,5,63,142,1,66,
+  5,27,66,5,63,88,66,5,49,68,5,63,117,68,5,48,68,5,63,117,69,5,47,68,
+  5,63,117,69,5,48,66,5,63,119,68,5,63,255,10,66,5,63,172,1,68,5,63,36,
+  128,0,66,5,63,67,68,5,63,35,128,0,68,5,63,46,66,5,16,68,5,63,13,66,
+  5,18,128,0,68,5,63,46,66,5,17,66,5,63,13,68,5,17,128,0,68,5,63,46,
+  66,5,63,32,70,5,18,128,0,66,5,63,145,1,71,5,14,66,5,63,147,1,128,0,
+  72,5,15,66,5,63,147,1,128,0,70,5,128,0,16,66,5,63,147,1,128,0,69,5,
+  66,0,39,66,5,63,36,66,5,63,24,70,0,38,66,5,63,36,66,5,63,70,66,5,
+  63,36,66,5,63,139,4,66,5,63,173,1,66,5,63,71,66,5,63,35,66,5,63,71,
+  66,5,28,66,5,63,3,127,15,0,58,66,5,27,68,5,63,3,66,5,63,101,68,5,
+  63,3,66,5,63,101,68,5,63,3,66,5,63,101,128,0,66,5,80,0,63,156,1,128,
+  2,80,0,63,173,9,66,5,63,160,1,66,5,8,68,5,128,0,66,5,63,154,1,68,
+  5,7,68,5,128,0,66,5,63,154,1,68,5,7,68,5,128,0,66,5,63,154,1,68,
+  5,7,68,5,63,159,1,66,5,9,66,5,63,155,1,66,5,63,173,1,66,5,23,128,
+  0,66,5,63,31,66,5,77,0,66,5,63,30,66,5,23,128,0,66,5,63,30,68,5,
+  76,0,66,5,36,66,5,63,17,128,0,66,5,63,30,68,5,75,0,0,66,5,36,66,
+  5,44,128,0,66,5,63,66,68,5,73,0,42,66,5,10,128,0,66,5,25,66,5,128,
+  0,68,5,63,56,66,5,6,66,5,72,0,58,128,2,66,5,24,73,5,63,55,68,5,
+  63,13,128,2,66,5,24,73,5,8,128,0,66,5,63,42,68,5,63,24,68,5,12,68,
+  5,128,0,66,5,8,128,1,68,5,63,41,68,5,63,24,68,5,13,66,5,13,128,1,
+  68,5,63,42,66,5,63,25,68,5,1,66,5,25,128,1,68,5,1,69,5,63,133,1,
+  66,5,24,128,0,68,5,2,69,5,2,128,0,66,5,63,15,66,5,82,0,63,25,66,
+  5,16,66,5,3,128,0,68,5,3,69,5,2,128,0,66,5,63,14,68,5,76,0,63,
+  50,66,5,3,128,0,68,5,4,66,5,4,128,0,66,5,63,14,68,5,71,0,63,55,
+  66,5,3,128,0,68,5,4,66,5,63,23,68,5,77,0,63,54,66,5,128,0,66,5,
+  5,66,5,63,24,66,5,77,0,58,66,5,56,66,5,63,113,66,5,56,66,5,63,24,
+  66,5,31,66,5,50,66,5,63,84,66,5,31,66,5,63,136,1,68,5,31,66,5,63,
+  134,1,68,5,8,66,5,63,150,1,66,5,67,0,1,68,5,8,66,5,63,150,1,66,
+  5,67,0,1,68,5,8,66,5,63,61,66,5,8,128,0,66,5,63,9,66,5,67,0,
+  3,66,5,63,73,66,5,8,128,0,66,5,3,127,12,0,3,66,5,63,73,66,5,8,
+  128,0,66,5,3,66,5,63,30,67,0,63,75,66,5,63,29,66,5,128,0,63,76,66,
+  5,63,29,66,5,128,2,63,172,1,66,5,63,83,127,8,0,63,104,66,5,63,159,1,
+  128,1,66,5,9,66,5,63,158,1,128,0,68,5,8,66,5,63,1,66,5,63,90,128,
+  0,68,5,63,12,71,5,63,86,128,1,68,5,63,12,71,5,63,87,128,0,66,5,63,
+  13,71,5,63,160,1,72,0,66,5,63,163,1,128,0,66,5,75,0,63,0,66,5,12,
+  129,32,90,0,63,51,68,5,63,11,66,5,12,66,5,63,77,68,5,63,11,66,5,12,
+  66,5,63,77,68,5,11,66,5,63,12,66,5,63,78,66,5,12,66,5,63,167,1,66,
+  5,66,0,66,5,63,167,1,66,5,68,0,63,13,130,0,2,63,87,67,5,68,0,63,
+  13,66,5,63,82,66,5,1,66,5,63,19,66,5,63,82,66,5,1,66,5,63,19,66,
+  5,63,82,66,5,63,61,128,2,90,0,63,148,1,66,5,63,173,1,66,5,63,173,1,
+  66,5,63,115,129,32,89,0,63,147,1,66,5,89,0,63,147,1,66,5,90,0,63,146,
+  1,66,5,63,168,20,66,5,63,173,1,66,5,63,173,1,66,5,52,66,5,63,173,1,
+  66,5,63,173,1,66,5,63,237,2,66,5,63,173,1,66,5,63,173,1,66,5,63,129,
+  7,66,5,42,127,67,0,62,66,5,42,66,5,63,77,66,5,46,66,5,42,66,5,63,
+  76,68,5,50,66,5,37,66,5,63,76,68,5,49,68,5,63,0,128,0,66,5,63,48,
+  68,5,49,68,5,62,128,0,68,5,63,47,67,5,50,68,5,44,66,5,14,128,0,68,
+  5,63,47,66,5,52,66,5,45,66,5,14,128,0,68,5,3,127,43,0,66,5,63,38,
+  66,5,15,128,0,66,5,3,129,0,66,5,63,141,1,128,0,66,5,25,128,0,68,5,
+  63,140,1,128,0,66,5,1,66,5,20,128,0,68,5,63,35,80,0,63,24,128,0,66,
+  5,1,66,5,21,68,5,63,35,66,5,63,44,66,5,2,128,0,66,5,15,66,5,63,
+  36,66,5,63,50,128,0,66,5,63,55,66,5,48,129,0,66,5,59,128,0,66,5,63,
+  107,68,5,63,171,1,68,5,63,111,66,5,56,66,5,63,112,68,5,63,171,1,68,5,
+  63,171,1,68,5,63,172,1,66,5,63,161,3,66,5,63,173,1,66,5,63,173,1,66,
+  5,63,61,127,42,0,66,5,63,67,66,5,63,39,66,5,63,67,66,5,63,39,66,5,
+  63,67,66,5,63,42,66,5,127,166,1,0,66,5,3,66,5,127,165,1,0,68,5,2,
+  66,5,127,165,1,0,68,5,2,66,5,127,165,1,0,68,5,63,171,1,67,5,63,171,
+  1,68,5,63,171,1,68,5,63,171,1,68,5,63,172,1,66,5,63,172,16,66,5,63,
+  172,1,68,5,63,171,1,68,5,63,171,1,68,5,63,172,1,66,5,63,101,63,127,66,
+  5,63,172,1,68,5,63,208,4,66,5,55,128,0,2,127,112,0,68,5,55,127,115,0,
+  63,160,3,128,0,2,119,0,1,128,5,63,114,122,0,1,128,5,63,172,1,128,0,1,
+  128,5,63,172,1,128,0,1,128,5,63,172,1,128,0,1,128,5,63,195,6,66,5,63,
+  232,1,66,5,63,172,1,68,5,63,113,121,0,63,170,1,67,5,63,178,1,128,0,2,
+  127,166,1,0,6,127,121,0,66,5,43,69,5,63,121,68,5,42,69,5,63,237,2,96,
+  0,63,140,1,99,0,63,167,12,66,5,63,195,2,66,5,63,172,1,68,5,63,139,5,
+  128,0,2,119,0,63,117,122,0,32,66,5,63,169,1,66,5,63,204,2,66,5,63,19,
+  75,0,63,78,68,5,63,12,128,2,63,94,68,5,47,66,5,63,121,128,0,50,66,5,
+  88,0,63,148,1,66,5,88,0,63,144,1,66,5,1,91,0,63,103,66,5,35,68,5,
+  29,69,0,63,135,1,68,5,92,0,63,142,1,68,5,92,0,63,146,1,94,0,63,146,
+  1,93,0,63,143,1,66,5,68,0,63,138,1,66,5,26,66,5,68,0,63,234,4,130,
+  0,1,2,66,5,72,0,63,159,1,66,5,0,68,5,71,0,63,163,1,68,5,71,0,
+  63,163,1,68,5,72,0,63,158,1,68,0,66,5,73,0,63,201,3,66,5,63,172,1,
+  68,5,63,117,66,5,67,0,63,168,1,70,5,63,169,1,70,5,47,128,0,2,128,2,
+  63,116,70,5,48,129,0,66,2,63,116,66,5,67,0,63,184,16,66,5,67,0,63,169,
+  1,66,5,128,2,63,172,1,66,5,128,0,63,166,2,128,0,1,128,5,63,172,1,128,
+  0,1,128,5,63,172,1,128,0,1,128,5,63,196,1,128,0,1,128,5,63,172,1,128,
+  0,1,128,5,63,172,1,128,0,1,128,5,63,178,12,128,0,1,128,5,63,172,1,128,
+  0,1,128,5,63,172,1,128,0,1,128,5,63,212,12,128,0,1,128,5,63,159,1,128,
+  0,1,128,5,7,128,0,3,67,5,63,154,1,128,0,3,128,5,11,67,5,63,154,1,
+  128,0,3,128,5,11,67,5,63,154,1,128,0,3,128,5,63,171,1,128,0,1,128,5,
+  63,167,1,128,0,1,128,5,63,172,1,128,0,1,128,5,63,172,1,128,0,1,128,5,
+  63,115,128,0,1,128,5,63,172,1,128,2,1,128,5,63,172,1,128,0,1,128,5,63,
+  140,9,128,0,1,128,5,63,172,1,128,0,1,128,5,63,172,1,128,0,1,128,5,63,
+  210,1,128,0,1,128,5,63,172,1,128,0,1,128,5,63,159,1,128,0,1,67,5,5,
+  128,0,1,128,5,63,99,128,0,1,128,5,55,128,0,1,128,5,63,112,128,0,1,128,
+  5,55,128,0,1,128,5,63,112,128,0,1,128,5,63,192,2,69,5,63,173,1,72,0,
+  66,5,77,0,63,150,1,72,0,66,5,76,0,63,160,1,66,5,74,0,63,51,128,0,
+  1,128,5,63,172,1,128,0,1,128,5,63,172,1,128,0,1,128,5,15,128,0,1,128,
+  5,63,172,1,128,0,1,128,5,63,172,1,128,0,1,128,5,63,146,5,128,0,1,128,
+  5,63,159,1,77,0,1,128,5,63,158,1,128,1,2,74,0,1,128,5,62,66,5,128,
+  0,63,171,1,68,5,128,0,63,170,1,68,5,128,0,63,90,68,5,63,11,68,5,128,
+  0,63,91,66,5,63,13,66,5,67,0,63,160,1,66,5,76,0,63,159,1,68,5,75,
+  0,63,159,1,68,5,76,0,63,158,1,68,5,76,0,63,159,1,66,5,77,0,63,136,
+  5,68,5,63,167,1,67,0,66,5,71,0,63,160,1,66,5,128,0,0,66,5,71,0,
+  63,160,1,66,5,77,0,63,159,1,66,5,63,142,32,74,0,63,205,3,128,0,1,128,
+  5,63,116,66,5,52,128,0,1,128,5,63,172,1,128,0,1,128,5,63,189,17,66,5,
+  111,0,63,124,68,5,124,0,63,110,68,5,115,0,2,67,0,63,112,68,5,114,0,63,
+  160,3,68,5,63,172,1,66,5,63,193,6,66,5,85,0,63,151,1,66,5,127,52,0,
+  63,57,66,5,115,0,63,210,4,123,0,63,115,128,0,2,127,172,1,0,63,160,3,68,
+  5,63,172,1,66,5,63,177,1,127,176,1,0,63,160,3,66,5,63,138,5,127,176,1,
+  0,63,168,1,128,0,2,67,0,63,160,3,66,5,63,169,1,128,5,63,234,23,127,176,
+  1,0,2,127,172,1,0,63,160,3,68,5,63,100,63,142,14,66,5,63,130,7,66,5,
+  63,141,5,127,163,1,0,63,82,66,5,104,0,63,132,1,66,5,104,0,63,132,1,66,
+  5,104,0,63,230,1,66,5,63,175,1,70,5,63,170,1,128,5,63,175,1,128,5,63,
+  169,1,128,0,63,174,1,128,0,63,180,1,128,5,63,169,1,128,0,63,175,1,128,0,
+  63,175,1,129,0,2,127,50,0,63,58,127,54,0,63,191,3,66,5,63,173,1,66,5,
+  127,11,0,63,98,66,5,69,0,63,168,1,70,0,63,115,66,5,121,0,63,114,68,5,
+  118,0,70,5,35,66,5,63,70,68,5,118,0,69,5,63,110,68,5,118,0,66,5,91,
+  0,63,86,66,5,120,0,41,91,0,63,250,2,67,5,63,138,5,128,0,63,165,8,66,
+  5,87,0,63,149,1,68,5,83,0,63,151,1,69,5,75,0,63,164,1,75,0,63,164,
+  1,75,0,63,163,1,77,0,63,233,8,66,5,128,0,63,172,1,66,5,128,0,63,172,
+  1,66,5,128,0,63,129,7,66,5,63,172,1,68,5,63,139,5,128,0,63,176,1,70,
+  0,63,215,13,128,0,1,128,5,63,171,1,128,0,3,128,5,63,147,1,128,1,1,128,
+  5,18,128,0,3,128,5,63,146,1,128,0,3,128,5,17,128,0,3,128,5,63,151,1,
+  128,5,18,128,0,1,128,5,63,152,1,128,5,63,174,1,128,5,63,220,12,128,0,1,
+  128,5,63,172,1,128,0,1,128,5,63,172,1,128,0,1,128,5,63,244,23,128,0,63,
+  175,1,128,0,63,175,1,128,0,3,128,5,63,171,1,128,0,1,128,5,63,166,3,128,
+  0,1,128,5,63,29,66,5,78,0,63,61,128,0,1,128,5,63,28,68,5,77,0,63,
+  61,128,0,1,128,5,63,28,68,5,76,0,63,158,1,68,5,74,0,63,161,1,66,5,
+  73,0,63,245,7,128,0,1,128,5,63,172,1,128,0,1,128,5,2,128,0,1,128,5,
+  63,145,1,128,0,1,128,5,15,128,0,1,128,5,2,128,0,1,128,5,63,145,1,128,
+  0,1,128,5,22,128,0,1,128,5,63,145,1,128,0,1,128,5,63,235,5,66,5,90,
+  0,4,66,5,128,0,63,137,1,66,5,89,0,5,66,5,128,2,63,140,1,88,0,6,
+  66,5,97,0,63,100,68,5,63,162,1,66,5,68,0,0,68,5,63,162,1,66,5,68,
+  0,0,68,5,72,0,63,153,1,66,5,68,0,2,66,5,84,0,63,152,1,66,5,83,
+  0,63,153,3,66,5,128,0,63,172,1,66,5,128,0,63,172,1,66,5,128,2,63,218,
+  8,66,5,73,0,63,163,1,66,5,70,0,63,166,1,66,5,72,0,63,231,8,66,5,
+  125,0,63,111,66,5,124,0,63,112,66,5,124,0,63,176,3,66,0,63,141,5,66,5,
+  63,202,44,95,0,63,240,4,66,5,63,145,5,128,0,1,128,5,63,172,1,128,0,1,
+  128,5,41,128,0,1,128,5,63,75,129,34,113,0,1,128,5,41,128,0,1,128,5,63,
+  74,128,0,2,125,0,31,128,0,1,128,5,63,200,1,127,47,0,63,64,128,0,2,127,
+  46,0,0,68,5,63,37,128,0,1,128,5,63,172,1,128,0,1,128,5,63,172,1,128,
+  0,1,128,5,14,68,5,63,150,1,85,0,66,5,63,247,4,66,5,8,82,0,63,205,
+  2,127,0,0,63,176,1,66,5,63,222,2,129,85,63,110,66,5,127,172,1,0,68,5,
+  127,171,1,0,68,5,127,171,1,0,68,5,127,172,1,0,66,5,127,162,3,0,63,154,
+  3,69,0,63,138,5,66,5,63,215,10,128,0,63,143,5,68,5,63,172,1,66,5,63,
+  171,16,66,5,127,172,1,0,68,5,127,171,1,0,68,5,127,171,1,0,68,5,127,101,
+  0,63,126,68,4,63,171,1,68,4,63,171,1,68,4,63,171,1,128,0,66,4,127,113,
+  0,66,4,56,127,115,0,68,4,63,171,1,68,4,63,171,1,68,4,54,66,4,63,114,
+  66,4,55,66,4,63,173,1,66,4,63,173,1,66,4,63,110,66,4,59,66,4,1,66,
+  4,63,105,66,4,52,66,4,3,68,0,66,4,63,105,66,4,51,68,4,7,66,4,63,
+  105,118,0,68,4,63,77,66,4,63,27,68,4,63,77,66,4,40,128,0,66,4,46,66,
+  4,63,78,66,4,40,128,0,66,4,54,66,4,63,70,108,0,66,4,53,68,4,63,167,
+  1,66,4,0,68,4,63,165,1,128,0,73,4,63,165,1,128,0,68,4,0,66,4,63,
+  166,1,128,0,68,4,63,120,68,4,44,68,4,63,121,68,4,43,68,4,63,122,68,4,
+  42,69,4,63,122,99,0,11,69,4,63,49,66,4,63,54,69,4,63,48,68,4,28,66,
+  4,63,22,66,4,63,50,68,4,28,66,4,63,139,1,68,4,28,66,4,63,140,1,66,
+  4,29,127,11,0,63,98,66,4,63,173,1,66,4,5,66,4,25,66,4,63,135,1,66,
+  4,4,68,4,24,66,4,63,143,1,68,4,24,66,4,63,82,66,4,57,68,4,23,68,
+  4,10,66,4,63,66,68,4,54,69,4,88,0,68,4,6,66,4,0,66,4,63,66,68,
+  4,54,69,4,24,68,4,6,66,4,0,66,4,63,66,68,4,54,67,4,26,128,0,66,
+  4,71,0,66,4,63,71,66,4,56,66,4,27,102,0,63,106,66,4,25,66,4,0,66,
+  4,63,140,1,66,0,25,70,4,63,169,1,70,4,63,88,68,4,13,66,4,34,66,4,
+  20,128,2,67,4,63,90,68,4,13,66,4,34,66,4,22,66,4,63,90,68,4,13,66,
+  4,30,66,4,0,66,4,22,66,4,63,92,102,0,11,66,4,26,69,4,63,140,1,66,
+  4,26,72,4,29,66,4,63,100,66,4,30,72,4,29,66,4,63,59,68,4,34,68,4,
+  35,66,4,29,66,4,63,59,69,4,33,68,4,63,131,1,69,4,11,66,4,18,68,4,
+  63,132,1,68,4,11,66,4,19,67,4,63,132,1,68,4,11,66,4,20,66,4,63,133,
+  1,66,4,36,66,4,4,66,4,63,134,1,66,4,67,0,23,71,0,66,4,63,134,1,
+  66,4,66,0,32,66,4,63,134,1,66,4,128,0,63,179,1,66,4,50,66,4,63,113,
+  66,4,1,68,4,49,66,4,63,113,66,4,1,68,4,49,66,4,63,113,66,4,1,68,
+  4,49,67,0,63,118,66,4,63,227,1,66,4,27,128,0,66,4,63,140,1,68,4,26,
+  128,2,66,4,63,86,66,4,50,68,4,26,128,2,66,4,63,85,68,4,49,68,4,63,
+  116,70,4,47,128,0,66,4,128,2,63,116,70,4,48,66,0,63,118,69,4,63,255,10,
+  66,4,63,172,1,68,4,63,171,1,68,4,63,38,66,4,63,45,66,4,17,68,4,63,
+  37,68,4,63,44,66,4,17,128,0,66,4,128,0,63,14,66,4,19,68,4,63,44,66,
+  4,18,67,0,63,13,68,4,18,68,4,63,44,67,0,63,32,128,0,70,4,14,66,4,
+  1,66,4,63,144,1,128,0,71,4,14,66,4,63,147,1,128,0,72,4,15,66,4,63,
+  147,1,128,0,70,4,17,127,15,0,45,66,4,63,22,128,0,69,4,42,128,0,66,4,
+  63,33,66,4,79,0,63,56,128,0,66,4,63,33,66,4,128,2,63,71,128,0,66,4,
+  63,34,66,0,63,140,4,66,4,63,173,1,66,4,63,70,66,4,63,36,66,4,63,70,
+  66,4,28,66,4,63,141,1,66,4,27,68,4,63,4,66,4,63,100,68,4,63,4,66,
+  4,63,100,68,4,63,4,66,4,63,101,66,4,63,173,11,66,4,63,160,1,66,4,8,
+  68,4,128,0,66,4,63,154,1,68,4,7,68,4,128,0,66,4,63,154,1,68,4,7,
+  68,4,128,0,66,4,63,154,1,68,4,7,68,4,63,159,1,66,4,9,66,4,63,155,
+  1,66,4,63,173,1,66,4,24,66,4,63,29,66,4,13,66,4,76,0,63,19,66,4,
+  24,66,4,63,28,68,4,12,66,4,76,2,25,66,4,63,18,66,4,63,28,68,4,12,
+  66,4,82,0,19,66,4,44,66,4,63,65,68,4,54,66,4,10,129,34,78,0,11,66,
+  4,0,68,4,63,56,66,4,5,66,4,63,6,128,0,66,4,23,73,4,63,55,68,4,
+  63,14,128,2,66,4,23,73,4,9,128,0,66,4,63,41,68,4,63,15,66,4,5,68,
+  4,12,68,4,0,66,4,9,128,0,68,4,63,40,68,4,63,24,68,4,13,66,4,14,
+  128,0,68,4,63,41,66,4,63,25,68,4,2,66,4,25,128,0,68,4,0,128,0,69,
+  4,63,133,1,66,4,24,128,1,68,4,1,128,0,69,4,3,66,4,63,13,66,4,83,
+  0,63,26,66,4,16,66,4,3,128,0,68,4,2,128,0,69,4,3,66,4,63,12,68,
+  4,77,0,63,51,66,4,3,128,0,68,4,4,66,4,5,66,4,63,12,68,4,72,0,
+  63,56,66,4,3,128,0,68,4,4,66,4,63,21,68,4,78,0,63,55,128,0,69,4,
+  5,66,4,63,22,66,4,78,0,59,66,4,56,128,0,66,4,63,112,66,4,56,128,0,
+  66,4,63,21,93,0,4,66,4,52,66,4,63,82,66,4,31,66,4,63,136,1,68,4,
+  31,66,4,63,134,1,70,4,6,80,0,63,136,1,71,0,0,68,4,8,66,4,63,150,
+  1,66,4,5,68,4,8,66,4,63,63,66,4,8,128,0,66,4,63,7,66,4,7,66,
+  4,8,66,4,63,63,66,4,8,128,0,66,4,63,7,66,4,7,66,4,63,75,66,4,
+  8,128,0,66,4,3,66,4,63,173,1,66,4,63,27,66,4,63,79,66,4,63,27,66,
+  4,63,173,1,66,4,63,197,2,128,0,66,4,63,172,1,128,0,66,4,63,158,1,66,
+  4,10,128,0,66,4,61,68,0,63,90,68,4,63,11,128,0,66,4,128,0,66,4,63,
+  88,68,4,63,11,71,4,63,88,68,4,63,11,71,4,63,89,66,4,63,12,68,4,63,
+  162,1,66,4,70,0,66,4,63,4,66,4,63,91,68,4,76,0,63,0,66,4,12,66,
+  4,63,75,68,4,77,0,62,66,4,12,66,4,63,75,68,4,76,0,66,4,63,13,66,
+  4,63,76,66,4,77,0,66,4,63,167,1,66,4,66,0,66,4,63,167,1,66,4,69,
+  0,63,166,1,67,4,69,0,63,166,1,66,4,63,20,66,4,63,81,66,4,1,66,4,
+  63,20,66,4,63,81,66,4,63,25,66,4,63,81,66,4,63,62,66,4,63,173,1,66,
+  4,63,173,1,66,4,63,226,2,130,32,2,63,173,1,66,4,63,173,1,66,4,63,173,
+  1,66,4,63,168,20,66,4,63,173,1,66,4,53,127,55,0,63,0,66,4,53,66,4,
+  63,173,1,66,4,63,173,1,66,4,63,236,2,66,4,63,173,1,66,4,63,173,1,66,
+  4,63,146,5,82,0,63,157,1,66,4,42,127,68,0,61,66,4,42,66,4,63,75,66,
+  4,48,66,4,42,66,4,63,74,68,4,51,66,4,38,66,4,63,74,68,4,50,68,4,
+  63,1,128,0,66,4,63,46,68,4,50,68,4,45,66,4,14,128,0,68,4,63,46,66,
+  4,51,68,4,45,66,4,14,128,0,68,4,63,46,66,4,52,66,4,46,66,4,14,128,
+  0,68,4,3,128,0,66,4,63,163,1,128,0,66,4,3,128,0,68,4,63,140,1,128,
+  0,66,4,0,89,0,68,4,63,140,1,128,0,66,4,0,66,4,21,128,0,68,4,63,
+  33,66,4,63,40,128,0,66,4,0,66,4,22,128,0,66,4,63,34,66,4,63,45,66,
+  4,3,128,0,66,4,63,53,66,4,63,52,128,0,66,4,63,106,129,0,66,4,60,128,
+  0,66,4,63,106,68,4,63,171,1,68,4,63,110,66,4,57,66,4,63,111,68,4,63,
+  171,1,68,4,63,171,1,68,4,63,172,1,66,4,63,162,3,66,4,63,173,1,66,4,
+  63,173,1,66,4,63,61,127,41,0,66,4,127,69,0,66,4,63,37,66,4,127,69,0,
+  66,4,63,37,66,4,127,69,0,66,4,63,41,127,169,1,0,66,4,3,66,4,63,165,
+  1,68,4,2,66,4,63,165,1,68,4,2,66,4,63,165,1,68,4,2,66,4,63,165,
+  1,67,4,63,171,1,68,4,63,171,1,68,4,63,171,1,68,4,63,172,1,66,4,63,
+  171,16,127,176,1,0,66,4,127,172,1,0,68,4,63,171,1,68,4,63,101,63,126,127,
+  238,8,0,128,6,63,117,127,169,9,0,128,6,1,127,197,6,0,128,6,49,127,163,3,
+  0,128,6,4,127,154,3,0,128,6,127,229,2,0,128,6,56,68,0,128,6,127,164,1,
+  0,128,6,4,127,179,4,0,128,6,38,128,6,0,127,212,3,0,128,6,127,153,3,0,
+  129,102,63,54,127,252,1,0,128,6,31,127,141,1,0,128,6,33,127,187,1,0,128,6,
+  63,86,127,24,0,128,6,0,128,6,63,93,127,143,1,0,128,6,31,127,174,1,0,128,
+  6,127,140,5,0,128,6,2,77,0,55,127,113,0,20,66,0,128,6,0,68,1,31,127,
+  109,0,0,128,6,22,73,0,31,127,105,0,5,128,6,21,77,0,2,128,6,23,127,53,
+  0,128,6,111,0,8,90,0,128,6,76,0,23,127,54,0,128,6,107,0,8,128,6,1,
+  99,0,128,6,26,127,98,0,9,114,0,16,127,96,0,11,130,0,6,24,88,0,13,127,
+  95,0,13,95,0,128,6,85,0,11,127,93,0,11,95,0,130,6,6,89,0,8,127,92,
+  0,12,127,0,0,6,127,64,0,129,102,78,0,128,6,22,74,0,128,6,21,129,96,33,
+  127,90,0,15,127,4,0,1,127,88,0,18,70,0,128,6,25,66,0,128,6,29,128,1,
+  0,127,86,0,20,96,0,128,6,32,128,0,0,128,1,63,66,80,0,9,115,0,128,6,
+  25,66,0,128,6,63,75,70,0,10,78,0,128,6,4,127,0,0,63,69,128,6,2,69,
+  0,11,127,22,0,63,69,128,6,1,67,0,6,128,6,6,127,22,0,63,78,127,36,0,
+  63,70,129,16,94,0,128,6,5,127,3,0,63,69,128,1,102,0,128,6,2,127,0,0,
+  63,68,68,0,128,6,127,39,0,63,73,127,40,0,63,85,127,28,0,63,69,70,0,128,
+  6,6,105,0,128,6,113,0,63,69,129,96,127,42,0,63,67,127,46,0,63,66,127,47,
+  0,63,65,127,21,0,128,6,63,91,127,47,0,63,72,111,0,128,6,0,118,0,63,69,
+  128,6,1,127,41,0,63,70,128,6,0,127,41,0,63,72,127,40,0,63,74,127,39,0,
+  63,74,127,39,0,63,74,127,38,0,63,75,127,38,0,25,127,13,0,34,127,39,0,23,
+  127,14,0,34,127,39,0,0,127,36,0,35,127,40,0,128,1,127,35,0,39,83,0,128,
+  6,0,127,14,0,128,1,127,34,0,42,127,35,0,128,1,78,0,128,6,0,127,16,0,
+  40,128,6,1,127,34,0,128,1,127,32,0,45,127,27,0,128,6,69,0,63,78,127,34,
+  0,10,128,6,29,116,0,46,127,24,0,128,6,50,116,0,46,127,21,0,128,6,53,115,
+  0,51,127,32,0,63,79,128,6,0,127,31,0,30,128,6,63,51,127,30,0,10,127,15,
+  0,56,127,29,0,10,127,15,0,57,127,28,0,10,127,14,0,58,127,29,0,63,83,127,
+  29,0,3,128,6,5,127,13,0,60,128,6,0,127,25,0,10,127,12,0,63,1,127,25,
+  0,9,127,12,0,63,2,89,0,128,6,124,0,3,128,6,63,84,127,23,0,63,90,127,
+  22,0,63,92,127,21,0,63,92,127,20,0,63,93,127,19,0,63,94,127,18,0,16,127,
+  2,0,63,12,127,18,0,2,127,15,0,63,14,127,16,0,1,127,16,0,63,15,127,15,
+  0,1,71,0,128,6,2,128,6,127,3,0,63,16,127,11,0,128,6,3,70,0,128,6,
+  4,127,3,0,63,17,127,13,0,2,127,15,0,63,18,127,12,0,128,1,63,101,127,10,
+  0,128,1,24,118,0,40,127,46,0,128,6,4,66,0,17,128,6,5,118,0,39,84,0,
+  128,6,127,34,0,24,118,0,39,68,0,128,6,11,104,0,128,6,123,0,63,56,101,0,
+  68,6,1,127,11,0,63,48,108,0,70,6,123,0,128,6,78,0,63,47,108,0,72,6,
+  0,90,0,128,6,109,0,2,127,13,0,30,68,0,128,6,12,88,0,74,6,116,0,128,
+  6,83,0,1,127,14,0,30,107,0,74,6,99,0,129,102,96,0,128,6,3,127,14,0,
+  31,106,0,74,6,127,10,0,1,127,14,0,43,94,0,74,6,106,0,128,6,1,91,0,
+  0,132,96,0,6,2,127,7,0,18,119,0,74,6,127,10,0,128,1,74,0,128,6,127,
+  3,0,17,121,0,72,6,0,124,0,128,6,3,66,0,128,6,3,128,1,66,0,128,6,
+  4,127,6,0,17,70,0,128,6,5,108,0,70,6,1,127,10,0,128,1,127,15,0,17,
+  123,0,68,6,2,127,10,0,128,1,127,15,0,18,127,69,0,128,6,4,130,0,1,63,
+  52,122,0,128,6,126,0,128,1,63,51,127,60,0,63,22,70,0,128,6,20,73,0,128,
+  6,32,127,16,0,63,21,70,0,128,6,21,127,61,0,63,19,70,0,128,6,11,128,6,
+  9,127,62,0,63,18,128,6,127,93,0,63,10,71,0,0,72,0,128,6,3,127,62,0,
+  128,6,2,70,0,128,6,4,128,1,127,17,0,2,127,91,0,128,1,127,17,0,2,127,
+  91,0,129,97,127,17,0,23,127,68,0,7,127,12,0,17,69,0,128,6,6,127,60,0,
+  7,127,12,0,17,127,74,0,63,38,127,74,0,7,128,6,63,31,127,71,0,15,127,6,
+  0,17,127,72,0,15,127,6,0,16,127,69,0,128,6,3,127,21,0,1,128,6,2,128,
+  6,8,127,74,0,128,1,127,22,0,128,1,9,127,77,0,0,127,23,0,128,1,6,127,
+  80,0,0,127,23,0,128,1,8,127,78,0,1,127,23,0,63,2,128,6,13,127,5,0,
+  63,9,72,0,128,6,70,0,63,0,80,0,128,6,26,104,0,63,8,81,0,6,128,6,
+  55,127,22,0,63,8,82,0,62,127,21,0,63,9,82,0,129,97,61,127,20,0,63,10,
+  82,0,128,1,60,127,20,0,63,22,69,0,130,6,1,60,127,20,0,63,22,72,0,59,
+  81,0,128,6,127,1,0,63,22,66,0,128,6,63,2,127,20,0,63,22,74,0,58,127,
+  19,0,63,18,79,0,57,116,0,128,6,93,0,63,18,80,0,56,127,19,0,63,19,80,
+  0,55,127,20,0,63,92,127,19,0,63,92,128,6,24,121,0,63,92,127,19,0,63,92,
+  127,19,0,63,92,127,20,0,63,92,127,19,0,63,92,127,19,0,63,93,127,19,0,63,
+  92,127,19,0,128,1,127,48,0,42,127,19,0,63,93,127,18,0,63,93,127,19,0,63,
+  92,127,19,0,63,93,95,0,128,6,7,104,0,128,1,63,92,127,18,0,0,127,58,0,
+  34,127,17,0,2,129,96,63,89,127,17,0,4,127,58,0,30,127,17,0,5,127,59,0,
+  29,105,0,128,6,4,95,0,7,127,59,0,27,127,16,0,9,127,59,0,25,127,16,0,
+  10,127,60,0,24,127,15,0,12,127,60,0,22,127,14,0,14,127,62,0,20,127,13,0,
+  16,127,62,0,18,114,0,128,6,63,125,127,10,0,17,128,6,63,83,127,9,0,63,103,
+  128,0,0,129,102,63,171,1,118,0,128,6,63,120,66,0,128,6,47,80,0,30,128,6,
+  17,128,6,63,56,127,3,0,30,127,70,0,7,127,1,0,32,127,72,0,4,127,0,0,
+  34,92,0,128,6,63,47,125,0,36,128,6,3,128,6,21,127,48,0,0,128,1,122,0,
+  128,1,45,127,70,0,130,22,1,51,128,0,66,1,113,0,128,6,14,127,54,0,52,127,
+  126,0,43,128,6,63,11,127,60,0,38,128,6,53,127,86,0,63,26,127,93,0,63,19,
+  127,65,0,128,6,1,127,240,8,0,128,6,51,127,230,2,0,128,6,63,59,128,6,63,
+  47,127,167,3,0,128,6,63,174,1,129,96,127,168,1,0,128,6,4,127,249,6,0,128,
+  6,127,254,21,0,128,6,63,186,14,127,201,4,0,63,172,10,127,154,18,0,128,5,63,
+  162,3,127,140,5,0,128,5,63,121,127,147,5,0,128,5,63,137,1,127,136,2,0,128,
+  5,63,181,1,127,170,1,0,128,5,63,122,128,5,51,67,0,128,5,63,165,1,128,5,
+  63,137,1,127,246,2,0,128,5,35,128,5,47,127,161,3,0,128,5,63,60,127,157,2,
+  0,129,85,63,245,2,128,5,63,135,1,81,0,20,128,5,39,128,5,63,130,1,70,1,
+  37,128,5,0,128,5,63,101,66,1,63,142,1,128,5,30,100,0,2,128,1,63,77,112,
+  0,4,128,5,29,77,0,63,78,108,0,8,110,0,63,238,2,128,5,2,114,0,63,152,
+  1,128,5,1,86,0,63,126,128,5,21,92,0,63,124,128,5,23,128,5,10,128,5,63,
+  86,128,5,89,0,22,128,5,1,95,0,128,5,63,252,2,128,5,28,94,0,63,142,1,
+  129,80,63,171,1,128,5,0,128,5,5,94,0,63,108,127,6,0,63,66,128,5,0,128,
+  5,73,0,2,128,5,30,128,5,21,128,5,63,108,70,0,6,127,30,0,63,109,128,5,
+  23,128,5,1,128,5,63,143,1,98,0,128,5,25,128,5,63,120,127,4,0,63,68,128,
+  5,3,92,0,128,5,63,142,1,128,5,11,128,5,63,162,1,128,5,63,185,1,87,0,
+  128,5,24,114,0,63,70,98,0,128,5,63,143,1,128,5,63,239,3,90,0,63,70,128,
+  5,2,128,5,44,128,5,63,175,1,120,0,63,69,127,44,0,63,70,127,10,0,128,5,
+  63,133,3,128,5,63,128,1,128,5,63,178,1,128,5,63,139,9,127,16,0,63,193,1,
+  127,18,0,40,127,37,0,63,96,128,5,63,9,70,0,63,184,1,128,5,1,127,20,0,
+  44,128,5,63,25,74,0,63,162,1,129,80,63,191,1,128,5,63,76,127,13,0,128,5,
+  1,128,5,46,123,0,63,230,1,128,5,63,52,128,5,63,255,4,127,20,0,60,127,27,
+  0,63,173,1,128,5,63,88,128,5,27,125,0,3,127,18,0,63,87,128,5,63,115,128,
+  5,63,154,13,127,8,0,63,91,66,0,1,128,5,2,128,5,1,127,9,0,63,85,128,
+  5,9,128,5,63,255,4,128,5,4,72,0,17,125,0,60,127,35,0,8,128,5,63,51,
+  81,0,128,5,34,124,0,63,64,128,5,47,128,5,63,216,1,128,5,4,79,0,63,126,
+  128,5,1,110,0,63,52,67,0,128,5,63,29,128,5,3,84,0,63,134,1,128,5,0,
+  128,5,0,91,0,128,5,5,66,0,63,252,2,128,5,3,89,0,128,5,1,128,5,2,
+  128,0,0,128,5,127,11,0,63,85,128,5,21,127,4,0,29,128,5,63,46,128,5,4,
+  73,0,128,5,5,127,12,0,24,115,0,63,245,1,128,5,63,124,128,5,55,71,0,63,
+  112,127,0,0,63,35,128,5,27,128,5,63,140,1,67,0,128,5,26,127,50,0,63,28,
+  67,0,128,5,10,128,5,63,156,1,128,5,127,86,0,63,18,128,1,14,128,5,63,55,
+  128,5,8,128,5,63,39,127,78,0,128,5,63,164,2,128,5,63,65,127,18,0,63,200,
+  1,127,68,0,63,177,1,128,5,63,182,1,127,13,0,63,80,128,5,63,40,128,5,1,
+  128,5,63,185,2,67,0,63,24,127,88,0,63,135,2,128,5,63,3,128,5,11,128,5,
+  63,220,2,128,5,51,127,20,0,63,18,71,0,63,17,127,5,0,63,33,129,80,63,174,
+  1,128,5,63,170,1,127,14,0,128,5,63,98,128,5,63,172,1,128,0,63,128,2,93,
+  0,128,5,63,60,70,0,63,144,4,94,0,63,91,128,5,63,142,5,127,20,0,63,132,
+  14,128,5,63,223,1,128,5,63,224,4,69,0,128,5,63,205,3,127,57,0,63,234,3,
+  66,0,128,5,63,214,1,128,5,63,205,2,128,5,63,222,1,128,5,63,127,128,5,63,
+  24,128,5,15,128,5,63,115,89,0,63,192,1,127,67,0,63,44,128,5,25,128,5,63,
+  59,127,5,0,23,128,5,63,81,128,5,51,79,0,63,108,127,2,0,30,66,0,128,5,
+  14,127,47,0,63,233,1,128,5,0,128,5,63,253,1,127,45,0,63,38,127,74,0,128,
+  5,63,179,1,66,1,63,42,127,70,0,63,223,1,66,1,63,122,128,5,48,127,141,1,
+  0,63,156,1,128,5,63,49,128,5,63,60,127,148,5,0,128,5,63,169,1,128,5,63,
+  180,1,127,154,3,0,128,5,127,254,21,0,128,5,63,171,16,127,196,19,0,63,134,29,
+  127,171,16,0,128,5,63,162,3,127,139,5,0,128,5,7,127,217,4,0,128,5,63,140,
+  1,127,128,2,0,128,5,63,182,1,127,169,1,0,128,5,63,127,128,5,47,66,0,128,
+  5,63,166,1,128,5,63,140,1,127,138,1,0,128,5,35,127,148,1,0,24,128,5,42,
+  127,103,0,63,146,1,89,0,63,14,128,5,63,99,108,0,25,129,85,63,249,2,128,5,
+  63,139,1,98,0,128,5,36,128,5,63,133,1,89,0,14,128,5,0,128,5,63,108,115,
+  0,63,95,128,5,24,128,5,1,117,0,63,70,90,0,22,121,0,63,227,2,128,5,1,
+  124,0,63,140,1,128,5,1,98,0,63,116,128,5,19,103,0,63,116,128,5,31,128,5,
+  63,96,74,0,2,92,0,128,5,1,85,0,128,5,70,0,128,5,63,254,2,129,80,22,
+  107,0,63,133,1,128,5,3,102,0,63,129,1,129,85,63,112,128,5,0,125,0,128,5,
+  63,112,128,5,0,74,0,128,5,0,91,0,128,5,63,134,1,101,0,128,5,23,128,5,
+  63,146,1,90,0,128,5,2,128,5,23,128,5,63,125,127,8,0,63,67,128,5,3,90,
+  0,128,5,63,145,1,128,5,10,128,5,63,162,1,128,5,29,128,5,63,149,1,127,42,
+  0,63,102,128,5,63,146,1,128,5,63,248,1,96,0,63,75,128,5,39,128,5,63,130,
+  1,128,5,44,123,0,63,69,127,44,0,63,71,127,41,0,63,138,1,128,5,63,151,1,
+  128,5,63,133,1,128,5,63,177,1,128,5,63,153,7,127,17,0,63,184,1,127,23,0,
+  44,127,37,0,63,95,128,5,63,3,76,0,63,176,1,128,5,1,127,26,0,48,128,5,
+  63,14,83,0,63,156,1,128,5,63,100,127,9,0,128,5,15,128,5,25,127,5,0,63,
+  60,128,5,63,219,2,128,5,63,42,128,5,63,144,3,67,0,63,85,127,27,0,63,165,
+  1,128,5,6,66,0,63,86,128,5,25,126,0,63,166,1,128,5,63,120,128,5,63,164,
+  11,127,16,0,63,85,67,0,128,5,1,128,5,2,127,16,0,63,79,128,5,7,128,5,
+  63,151,3,78,0,63,156,1,128,5,19,128,5,6,127,7,0,62,129,80,63,159,1,66,
+  0,128,5,43,128,5,126,0,63,154,1,85,0,63,123,128,5,1,86,0,128,5,63,82,
+  67,0,128,5,63,20,128,5,3,89,0,63,131,1,129,85,0,89,0,128,5,4,73,0,
+  63,248,2,128,5,2,87,0,128,5,1,128,5,2,129,80,0,128,0,4,127,12,0,63,
+  72,128,5,4,128,5,5,74,0,63,46,67,0,128,5,63,42,72,0,128,5,5,66,0,
+  63,221,2,128,5,45,128,5,4,77,0,63,111,127,1,0,63,40,128,5,25,128,5,63,
+  143,1,66,0,128,5,24,127,48,0,63,33,67,0,128,5,9,128,5,63,157,1,128,5,
+  127,80,0,63,25,77,0,128,5,63,45,128,5,7,128,5,63,51,127,66,0,63,182,1,
+  69,0,63,52,128,5,63,170,1,127,65,0,63,169,1,128,5,63,148,3,128,5,16,127,
+  19,0,15,128,5,1,128,5,63,173,2,73,0,63,31,127,81,0,63,91,128,5,63,114,
+  128,5,63,9,128,5,63,113,128,5,63,156,1,128,1,63,3,127,20,0,63,39,128,5,
+  63,174,1,127,73,0,63,39,128,5,63,2,128,5,63,103,129,80,63,173,1,127,78,0,
+  63,107,91,0,128,5,63,70,127,81,0,63,203,2,128,5,46,99,0,63,170,6,127,20,
+  0,63,162,10,128,5,63,219,1,128,5,63,212,6,68,0,128,5,63,218,1,68,0,63,
+  226,4,128,0,0,128,5,63,210,1,128,5,63,213,2,128,5,41,128,5,63,228,1,128,
+  5,63,78,128,5,40,98,0,3,128,5,63,175,1,127,64,0,63,71,128,5,63,70,127,
+  11,0,5,128,5,1,128,5,63,90,128,5,46,89,0,63,102,127,9,0,15,128,0,0,
+  128,5,13,127,46,0,63,2,128,5,63,173,1,128,5,63,222,1,127,69,0,13,128,5,
+  63,32,127,67,0,14,127,5,0,63,208,1,127,63,0,63,188,1,128,5,43,81,0,63,
+  220,2,128,5,63,39,128,5,63,70,128,0,63,163,3,128,5,63,169,1,128,5,4,128,
+  5,63,174,1,74,0,63,143,3,128,5,90,0,63,23,127,156,19,0,128,5,63,172,16,
+  127,176,36,0,63,241,45,127,170,16,0,128,5,63,178,1,127,252,6,0,128,5,63,213,
+  2,79,0,15,128,5,63,177,1,69,1,63,209,1,128,5,63,181,1,127,95,0,63,11,
+  128,5,127,97,0,33,128,5,46,128,5,63,135,1,80,0,13,128,5,63,143,1,83,0,
+  17,127,91,0,12,128,5,29,128,5,38,127,90,0,63,168,1,69,0,19,120,0,11,128,
+  5,63,170,1,129,85,63,220,2,96,0,128,5,63,170,1,66,0,128,5,33,128,5,63,
+  115,122,0,128,5,0,128,5,63,88,128,5,25,125,0,63,66,76,0,56,104,0,63,220,
+  2,128,5,1,127,4,0,63,131,1,128,5,0,107,0,63,110,128,5,17,111,0,63,66,
+  128,0,41,128,5,18,128,5,72,0,128,5,63,101,129,85,103,0,128,5,1,89,0,128,
+  5,63,146,1,127,8,0,63,104,128,5,21,113,0,63,123,128,5,1,128,5,63,117,119,
+  0,128,5,63,118,129,85,0,73,0,128,5,0,88,0,128,5,16,128,5,63,119,98,0,
+  128,5,63,196,1,128,5,0,128,5,0,128,5,21,128,5,63,129,1,127,11,0,63,68,
+  128,5,2,87,0,128,5,63,148,1,128,5,9,128,5,63,172,1,83,0,128,5,19,123,
+  0,63,71,92,0,128,5,63,149,1,128,5,63,201,3,128,5,22,102,0,63,71,128,5,
+  2,128,5,36,127,0,0,63,70,127,42,0,63,72,125,0,128,5,63,137,3,128,5,63,
+  136,1,128,5,63,177,1,128,5,63,167,5,127,17,0,63,176,1,128,0,63,77,127,35,
+  0,63,94,128,5,60,84,0,63,78,128,5,63,10,77,0,128,5,1,69,0,63,148,3,
+  128,5,63,93,127,0,0,128,5,0,128,5,39,127,12,0,63,235,1,128,5,63,32,128,
+  5,63,145,3,74,0,63,86,127,26,0,63,159,1,128,5,5,74,0,63,86,128,5,22,
+  127,2,0,63,109,128,5,48,128,5,63,236,10,68,0,63,161,1,66,0,128,5,1,128,
+  5,1,69,0,63,155,1,128,5,6,128,5,63,153,3,83,0,0,127,15,0,63,0,127,
+  6,0,128,5,18,128,5,63,72,128,0,0,128,5,10,128,5,29,127,0,0,63,110,128,
+  5,63,186,1,128,5,0,84,0,128,5,3,90,0,63,60,66,0,128,5,63,13,128,5,
+  2,94,0,63,127,128,5,0,128,5,0,86,0,128,5,4,79,0,63,133,1,128,5,23,
+  128,5,63,153,1,87,0,128,5,2,129,80,0,72,0,63,147,1,128,5,3,129,80,3,
+  129,80,63,66,67,0,128,5,63,47,73,0,63,150,1,128,5,63,133,1,128,5,127,3,
+  0,63,45,128,5,23,128,5,63,145,1,67,0,128,5,21,127,45,0,63,38,67,0,128,
+  5,63,169,1,128,5,78,0,128,5,63,153,1,77,0,128,5,63,34,128,5,6,128,5,
+  63,62,127,55,0,63,74,128,5,63,43,75,0,63,164,2,127,46,0,128,5,63,149,3,
+  128,5,15,69,0,63,44,128,5,63,172,1,128,5,63,53,80,0,63,36,127,76,0,63,
+  91,128,5,63,119,128,5,63,2,128,5,63,120,128,5,41,127,21,0,63,30,127,82,0,
+  63,42,129,80,63,174,1,128,5,63,171,1,129,80,62,128,5,63,221,2,127,28,0,128,
+  5,63,79,127,77,0,63,202,2,128,5,42,104,0,63,186,4,127,20,0,63,159,10,128,
+  5,63,215,1,128,5,63,232,4,68,0,128,5,63,214,1,77,0,63,222,4,128,5,63,
+  173,1,97,0,128,5,63,108,128,5,63,214,1,128,5,63,135,1,128,5,63,9,128,5,
+  12,128,5,63,125,105,0,63,169,1,69,0,14,128,5,63,153,1,128,5,2,128,5,63,
+  97,128,5,127,14,0,63,180,1,128,5,12,127,46,0,32,101,0,128,5,41,127,63,0,
+  63,5,128,5,63,242,1,127,42,0,23,128,5,63,21,127,67,0,26,127,10,0,63,193,
+  1,127,61,0,63,2,93,0,63,103,128,5,39,93,0,63,101,128,5,63,29,128,5,63,
+  80,127,9,0,63,218,2,128,5,63,170,1,128,5,3,128,5,63,175,1,126,0,63,196,
+  3,127,73,0,63,162,3,66,0,63,167,1,75,0,63,131,5,91,0,63,135,3,128,5,
+  63,171,16,127,157,53,0,63,219,62,127,149,12,0,15,128,1,63,213,1,128,5,63,178,
+  1,127,104,0,63,248,1,127,98,0,33,85,0,25,127,92,0,63,11,129,80,63,220,2,
+  92,0,128,5,0,88,0,63,170,3,128,5,4,127,85,0,63,21,128,5,127,89,0,46,
+  128,5,41,128,5,63,139,1,91,0,128,5,63,145,1,98,0,128,1,63,110,128,5,26,
+  128,5,34,128,0,0,128,1,63,88,127,25,0,63,111,125,0,128,5,63,171,1,129,85,
+  63,114,93,0,128,5,63,171,1,128,0,0,128,5,29,128,5,63,122,116,0,129,85,63,
+  97,128,5,22,127,4,0,63,64,129,16,38,128,5,127,7,0,63,214,2,128,5,1,127,
+  9,0,63,123,129,80,0,114,0,63,105,128,5,16,117,0,63,66,101,0,128,5,80,0,
+  128,5,69,0,128,5,1,128,5,63,130,3,128,5,18,118,0,63,119,128,5,0,128,5,
+  63,123,114,0,128,5,63,123,129,85,73,0,128,5,86,0,128,5,14,128,5,63,153,1,
+  66,0,128,5,19,128,5,63,156,1,80,0,128,5,2,128,5,18,128,5,63,108,85,0,
+  128,5,63,149,1,129,85,63,175,1,128,5,8,128,5,33,126,0,63,71,85,0,128,5,
+  63,156,1,128,5,22,128,5,63,212,1,106,0,63,110,128,5,63,138,1,128,5,1,128,
+  5,33,127,2,0,63,71,127,41,0,63,73,119,0,128,5,63,155,1,128,5,63,141,1,
+  128,5,63,176,1,128,5,63,164,5,127,19,0,63,78,127,34,0,63,150,1,89,0,63,
+  94,128,5,63,1,128,5,2,76,0,63,79,128,5,63,1,94,0,63,144,1,128,5,63,
+  114,122,0,128,5,13,128,5,21,127,19,0,63,53,128,5,63,119,128,5,63,23,128,5,
+  63,147,3,81,0,63,86,127,2,0,128,5,63,111,128,5,19,127,3,0,63,220,2,128,
+  5,43,128,5,63,251,8,75,0,63,155,1,128,0,0,128,5,1,128,5,1,76,0,63,
+  149,1,128,5,6,128,5,63,148,3,128,5,3,89,0,63,69,77,0,128,5,63,14,128,
+  5,63,85,128,5,35,128,5,127,2,0,63,121,81,0,128,5,3,95,0,63,63,91,0,
+  26,128,5,16,128,5,3,98,0,63,66,128,5,56,129,85,0,84,0,128,5,4,85,0,
+  63,129,1,128,5,2,82,0,128,5,0,128,5,2,81,0,63,158,1,128,5,0,79,0,
+  63,58,128,5,63,19,128,5,15,80,0,63,54,101,0,63,191,1,128,5,36,128,5,3,
+  89,0,63,108,127,4,0,63,45,68,0,128,5,18,128,0,0,128,5,63,147,1,67,0,
+  129,85,63,182,1,128,5,63,155,1,76,0,128,5,1,127,22,0,128,5,6,128,5,63,
+  73,127,43,0,63,84,128,5,63,33,81,0,63,56,127,56,0,63,155,1,128,5,63,182,
+  1,77,0,63,147,1,128,5,63,74,128,5,1,128,5,63,38,86,0,63,44,127,68,0,
+  63,41,114,0,128,5,63,124,128,5,59,128,5,63,125,128,5,37,127,20,0,63,36,76,
+  0,128,5,52,127,9,0,63,48,127,64,0,63,48,128,5,53,128,5,63,115,128,0,0,
+  128,5,63,172,1,127,20,0,128,5,63,88,127,72,0,63,202,2,128,5,38,108,0,63,
+  186,4,127,21,0,63,173,8,128,5,63,210,1,128,5,63,236,4,67,0,128,5,63,211,
+  1,85,0,63,234,2,128,5,63,173,1,94,0,128,5,63,225,2,129,85,33,128,5,63,
+  139,1,128,5,63,2,128,5,10,128,5,63,130,1,111,0,63,159,1,128,5,78,0,3,
+  128,5,63,89,127,5,0,128,5,63,105,128,5,38,98,0,128,5,63,100,127,17,0,6,
+  127,48,0,63,9,129,85,63,235,1,127,44,0,32,128,5,63,12,69,0,63,96,127,15,
+  0,63,180,1,127,60,0,32,128,5,36,102,0,63,136,1,102,0,63,96,128,5,63,20,
+  128,5,63,88,127,16,0,63,100,128,5,63,170,1,128,5,3,128,5,63,158,3,127,7,
+  0,63,195,1,127,67,0,63,177,3,127,3,0,63,104,127,6,0,63,202,4,128,1,63,
+  177,1,128,5,63,188,14,127,137,70,0,63,214,77,127,111,0,63,192,7,127,98,0,63,
+  216,1,90,0,63,183,1,128,5,63,178,1,127,91,0,63,21,127,90,0,46,100,0,5,
+  127,84,0,63,20,129,80,63,226,2,89,0,128,5,0,101,0,63,154,3,128,5,3,67,
+  0,63,167,1,128,5,72,0,63,130,1,128,5,5,95,0,128,5,63,141,1,90,0,128,
+  5,2,76,0,63,105,128,5,56,77,0,63,85,107,0,128,5,63,152,1,119,0,128,5,
+  63,172,1,128,5,63,120,127,12,0,63,124,128,0,0,129,85,25,128,5,63,127,111,0,
+  129,85,63,87,81,0,128,5,19,127,9,0,63,214,2,127,11,0,63,98,128,5,19,121,
+  0,63,102,128,5,14,128,5,121,0,63,67,97,0,128,5,79,0,7,128,5,63,115,128,
+  5,31,129,80,18,66,0,128,5,63,152,1,128,5,16,123,0,63,95,82,0,128,5,0,
+  128,5,63,128,1,109,0,129,85,63,128,1,128,5,8,128,5,84,0,128,5,63,169,1,
+  67,0,128,5,14,128,5,0,128,5,63,134,1,106,0,128,5,16,128,5,63,111,128,5,
+  21,128,5,63,153,1,128,5,7,128,5,29,127,2,0,63,73,83,0,128,5,63,158,1,
+  128,5,19,128,5,63,208,1,111,0,63,77,128,5,63,157,3,127,38,0,63,124,128,5,
+  63,158,1,128,5,63,144,1,129,85,63,162,5,127,19,0,63,79,127,33,0,63,94,128,
+  5,48,95,0,63,142,1,74,0,128,5,2,83,0,63,80,128,5,63,178,1,127,3,0,
+  128,5,19,68,0,63,135,1,128,5,0,128,5,63,123,128,5,63,13,128,5,63,165,1,
+  87,0,63,88,127,24,0,63,147,1,128,5,63,117,128,5,17,127,5,0,63,106,128,5,
+  38,128,5,63,250,8,82,0,63,149,1,128,0,0,128,5,1,128,5,1,83,0,63,143,
+  1,128,5,63,177,1,94,0,63,83,74,0,45,128,5,14,128,5,4,77,0,63,72,128,
+  0,0,128,5,8,128,5,21,128,5,0,127,3,0,63,135,1,128,5,2,100,0,63,116,
+  128,5,0,77,0,128,5,2,103,0,63,66,66,0,128,5,50,129,85,0,82,0,128,5,
+  3,91,0,63,126,128,5,1,80,0,128,5,0,128,5,2,87,0,63,142,1,128,5,8,
+  128,5,4,81,0,63,58,67,0,128,5,63,10,128,5,3,68,0,5,86,0,63,140,1,
+  128,5,63,141,1,128,5,127,5,0,63,55,128,5,18,128,5,63,150,1,67,0,128,5,
+  16,127,40,0,63,47,128,5,67,0,128,5,6,128,5,63,157,1,75,0,128,5,0,127,
+  14,0,128,5,5,128,5,63,83,127,32,0,128,5,92,0,63,64,128,5,63,23,87,0,
+  63,60,127,52,0,63,149,1,128,5,63,167,1,128,5,12,84,0,63,51,128,5,1,128,
+  5,63,140,2,92,0,63,46,108,0,128,5,63,130,1,128,5,52,128,5,63,130,1,128,
+  5,34,127,20,0,63,41,75,0,128,5,47,127,10,0,63,160,2,129,80,50,128,5,63,
+  196,1,128,5,63,100,127,64,0,63,45,127,66,0,63,91,128,5,34,112,0,63,186,4,
+  127,21,0,63,187,6,128,5,63,207,1,128,5,63,240,4,66,0,128,5,63,207,1,92,
+  0,63,230,2,128,5,24,128,5,63,147,1,121,0,63,91,129,85,29,128,5,63,143,1,
+  128,5,58,128,5,9,128,5,63,135,1,115,0,63,151,1,128,5,0,79,0,128,5,63,
+  97,128,5,61,128,5,63,112,127,3,0,128,5,63,108,93,0,129,85,34,79,0,63,200,
+  2,128,5,63,5,79,0,3,127,47,0,63,48,75,0,63,94,127,18,0,63,94,128,5,
+  63,208,1,110,0,63,92,128,5,63,11,128,5,63,98,127,19,0,63,96,128,5,63,171,
+  1,128,5,63,179,1,127,13,0,63,95,128,5,63,175,1,127,15,0,5,127,65,0,63,
+  204,1,127,10,0,63,97,127,14,0,63,194,4,127,10,0,63,104,128,5,63,204,12,128,
+  1,63,133,85,63,209,92,127,96,0,63,224,5,128,0,63,252,2,103,0,63,151,3,128,
+  4,1,72,0,63,167,1,73,0,63,130,1,111,0,63,160,1,128,4,63,121,127,8,0,
+  63,128,1,128,4,111,0,63,161,1,79,0,63,155,1,128,4,0,83,0,63,154,1,128,
+  4,63,144,1,128,4,2,87,0,128,4,2,128,0,0,128,4,63,173,1,87,0,63,83,
+  80,0,128,4,21,128,4,63,154,1,113,0,128,4,63,172,1,128,4,63,126,87,0,128,
+  4,63,156,1,81,0,128,4,23,128,4,63,97,127,14,0,129,68,63,96,80,0,128,4,
+  14,128,4,127,13,0,63,99,127,14,0,63,96,128,4,16,126,0,63,99,128,4,13,128,
+  4,124,0,63,68,128,4,93,0,128,4,77,0,128,4,5,128,4,63,122,128,4,28,128,
+  4,14,68,0,128,4,63,154,1,128,4,18,123,0,63,70,104,0,128,4,0,128,4,63,
+  132,1,129,68,6,128,4,82,0,128,4,11,128,4,63,157,1,66,0,128,4,14,128,4,
+  63,139,1,98,0,128,4,1,128,4,14,128,4,63,118,128,4,19,128,4,63,155,1,128,
+  4,3,66,0,128,4,26,127,4,0,63,74,81,0,128,4,63,160,1,128,4,17,128,4,
+  63,204,1,116,0,63,75,128,4,1,128,4,25,128,4,127,6,0,63,75,127,38,0,63,
+  120,128,4,63,159,1,128,4,63,148,1,129,68,63,176,3,127,18,0,63,153,1,87,0,
+  63,80,127,32,0,63,93,128,4,51,128,4,2,89,0,63,82,128,4,51,104,0,63,85,
+  112,0,128,4,8,128,4,17,77,0,63,130,1,128,4,0,128,4,63,128,1,128,4,63,
+  5,128,4,63,167,1,92,0,63,89,127,24,0,63,106,97,0,128,4,4,93,0,63,89,
+  128,4,63,191,1,128,4,34,128,4,63,137,7,89,0,63,138,1,128,4,3,129,64,0,
+  128,4,63,235,2,68,5,35,128,4,3,99,0,63,74,74,0,128,4,6,70,5,6,105,
+  0,128,4,63,103,128,4,13,72,5,4,128,4,27,104,0,63,91,74,5,11,128,4,0,
+  75,0,128,4,1,128,4,107,0,63,69,66,0,128,4,17,74,5,16,128,4,0,80,0,
+  128,4,3,96,0,63,91,74,5,19,128,4,2,78,0,129,68,2,93,0,63,91,74,5,
+  29,128,4,3,128,4,3,67,0,128,4,4,87,0,63,62,67,0,128,4,23,74,5,34,
+  68,0,128,4,3,92,0,63,92,72,5,3,128,4,28,128,4,3,99,0,63,77,128,4,
+  14,70,5,5,127,6,0,63,55,66,0,129,68,14,82,0,68,5,63,131,1,66,0,128,
+  4,5,128,4,63,158,1,69,0,128,4,3,128,4,0,127,6,0,128,4,4,128,4,63,
+  93,127,22,0,128,4,98,0,63,66,128,4,63,14,93,0,63,64,127,16,0,128,4,63,
+  201,2,128,4,63,14,128,4,10,90,0,63,56,128,4,63,20,98,0,63,51,127,61,0,
+  63,51,128,4,39,128,4,6,128,4,63,135,1,128,4,29,127,20,0,63,47,74,0,128,
+  4,41,127,11,0,63,56,129,64,42,128,4,63,127,128,0,0,128,4,63,172,1,127,3,
+  0,128,4,63,105,127,62,0,63,91,128,4,30,116,0,63,186,4,127,21,0,63,185,6,
+  128,4,63,204,1,128,4,63,131,3,66,0,128,4,63,204,1,98,0,63,227,2,128,4,
+  21,128,4,63,126,128,4,22,124,0,63,119,128,4,33,128,4,63,112,128,4,51,128,4,
+  63,149,1,88,0,128,4,77,0,128,4,63,106,128,4,54,128,4,63,119,123,0,128,4,
+  63,115,89,0,129,68,31,87,0,63,200,2,128,4,60,88,0,63,91,127,20,0,63,159,
+  1,79,0,63,93,128,4,28,116,0,63,90,128,4,63,3,128,4,63,105,127,22,0,63,
+  94,128,4,63,171,1,128,4,63,178,1,127,17,0,63,92,128,4,63,174,1,127,19,0,
+  63,207,2,127,15,0,63,93,127,18,0,63,206,2,128,0,0,128,4,63,188,14,127,6,
+  0,63,205,97,63,205,107,75,0,63,131,5,80,0,63,241,2,112,0,63,138,3,128,4,
+  0,85,0,63,154,1,86,0,63,122,118,0,63,149,1,128,4,63,127,127,13,0,63,120,
+  128,4,29,89,0,63,145,1,128,4,0,92,0,63,122,86,0,128,4,63,147,1,128,4,
+  2,84,0,128,4,2,128,0,0,128,4,63,173,1,96,0,63,82,78,0,128,4,82,0,
+  128,4,63,201,1,128,4,63,129,1,106,0,128,4,63,136,1,80,0,128,4,20,128,4,
+  63,105,127,5,0,129,68,63,105,78,0,128,4,34,122,0,63,96,127,16,0,63,94,128,
+  4,15,127,2,0,63,69,91,0,128,4,75,0,128,4,127,1,0,63,70,128,4,25,128,
+  4,11,128,4,0,66,0,128,4,0,128,4,63,154,1,128,4,13,127,2,0,63,72,99,
+  0,128,4,0,128,4,63,137,1,128,4,88,0,128,4,9,128,4,63,139,1,128,4,6,
+  128,4,10,66,0,128,4,63,157,1,94,0,128,4,0,129,68,12,128,4,63,125,128,4,
+  16,128,4,63,158,1,128,4,69,0,128,4,9,128,4,11,127,7,0,63,95,128,4,63,
+  158,1,128,4,41,119,0,63,80,128,4,63,173,1,127,35,0,63,117,128,4,63,161,1,
+  128,4,63,150,1,128,4,0,128,4,63,173,3,127,19,0,63,82,127,30,0,63,94,128,
+  4,38,106,0,63,83,128,4,45,73,0,128,4,63,120,107,0,128,4,7,128,4,15,84,
+  0,63,126,128,4,0,128,4,63,134,1,128,4,60,128,4,63,167,1,99,0,63,89,109,
+  0,128,4,63,129,1,128,4,14,127,7,0,63,104,128,4,30,128,4,63,130,7,66,0,
+  128,4,1,95,0,63,133,1,128,4,3,129,68,63,171,1,104,0,63,85,71,0,36,128,
+  4,11,128,4,4,90,0,63,77,128,0,0,128,4,6,128,4,16,128,4,127,6,0,63,
+  112,128,4,0,76,0,128,4,111,0,63,72,66,0,128,4,39,129,68,0,68,0,128,4,
+  7,128,4,3,101,0,63,119,128,4,1,77,0,129,68,1,128,4,98,0,63,128,1,128,
+  4,6,128,4,102,0,63,66,66,0,128,4,60,128,4,9,97,0,63,104,128,4,127,7,
+  0,63,63,128,4,12,128,0,0,128,4,63,154,1,67,0,128,4,4,128,4,63,164,1,
+  129,64,2,128,4,0,125,0,128,4,3,128,4,63,97,127,18,0,128,4,103,0,63,69,
+  128,4,63,6,99,0,63,66,127,7,0,128,4,63,169,1,128,4,10,95,0,63,61,128,
+  4,0,128,4,63,170,1,127,54,0,63,92,128,4,5,128,4,63,140,1,128,4,63,162,
+  1,73,0,128,4,29,127,20,0,63,60,129,64,37,128,4,63,132,1,129,64,63,173,1,
+  123,0,128,4,63,113,127,57,0,63,91,128,4,26,119,0,63,203,2,127,21,0,63,200,
+  4,128,4,63,200,1,128,4,63,137,3,128,4,63,172,1,127,6,0,63,135,1,103,0,
+  63,112,128,4,19,128,4,63,131,1,129,68,19,127,0,0,63,90,128,4,23,128,4,20,
+  128,4,7,128,4,63,128,3,84,0,128,4,12,128,4,63,167,1,128,4,63,145,1,129,
+  68,2,120,0,63,91,127,20,0,63,88,128,4,54,95,0,63,90,127,21,0,63,91,128,
+  4,58,88,0,63,88,128,4,27,94,0,128,4,63,226,2,66,0,128,4,63,172,1,128,
+  4,63,174,1,128,4,63,178,1,127,19,0,63,90,127,21,0,63,205,2,127,17,0,63,
+  91,127,21,0,63,92,128,4,63,174,1,127,19,0,63,140,10,127,14,0,63,194,112,63,
+  217,120,87,0,63,247,4,91,0,63,233,2,120,0,63,145,1,94,0,63,143,1,128,4,
+  0,95,0,63,116,124,0,63,140,1,128,4,63,133,1,127,15,0,63,115,128,4,26,97,
+  0,63,137,1,128,4,0,101,0,63,116,83,0,128,4,0,129,64,63,148,1,128,4,20,
+  128,4,1,103,0,63,82,77,0,128,4,79,0,128,4,63,198,1,128,4,63,134,1,101,
+  0,129,68,63,140,1,78,0,128,4,63,133,1,124,0,129,68,63,126,128,4,63,201,1,
+  127,5,0,63,71,85,0,128,4,2,74,0,63,148,1,79,0,128,4,10,128,4,4,128,
+  4,63,133,1,128,4,21,128,4,11,67,0,128,4,11,115,0,63,74,84,0,128,4,9,
+  129,68,63,142,1,128,4,84,0,128,4,8,129,68,63,143,1,128,4,4,128,4,12,128,
+  4,74,0,129,68,63,146,1,93,0,128,4,11,128,4,63,130,1,129,68,2,128,0,0,
+  128,4,7,128,4,11,127,8,0,63,77,78,0,128,4,63,163,1,128,4,13,128,4,21,
+  122,0,63,190,2,131,64,64,63,209,1,128,4,63,141,1,128,4,19,128,4,63,155,1,
+  128,4,63,188,1,127,19,0,63,83,127,29,0,63,93,128,4,34,110,0,63,85,128,4,
+  39,72,0,128,4,63,127,101,0,128,4,6,128,4,14,91,0,63,122,129,68,63,139,1,
+  128,4,46,70,0,128,4,63,122,127,23,0,63,104,90,0,128,4,3,103,0,63,90,128,
+  4,11,128,4,26,128,4,63,154,5,98,0,63,135,1,128,4,1,101,0,63,128,1,128,
+  4,3,128,4,63,168,1,128,4,2,70,0,128,4,4,96,0,63,79,128,0,0,128,4,
+  4,129,64,14,128,4,127,7,0,63,110,128,4,0,74,0,128,4,2,112,0,63,75,128,
+  0,0,128,4,34,129,68,0,68,0,128,4,1,67,0,128,4,3,106,0,63,116,128,4,
+  1,75,0,129,68,1,128,4,103,0,63,72,128,4,50,128,4,5,128,4,107,0,63,69,
+  85,0,34,128,4,3,108,0,63,67,128,4,12,128,4,20,128,4,127,8,0,63,63,66,
+  0,128,4,11,77,0,63,149,1,128,4,0,66,0,128,4,49,128,4,3,128,4,63,106,
+  127,8,0,128,4,108,0,63,73,128,4,60,104,0,63,69,126,0,128,4,63,170,1,128,
+  4,8,101,0,63,65,128,4,0,128,4,63,0,107,0,63,63,93,0,128,4,4,128,4,
+  63,144,1,128,4,63,163,1,73,0,128,4,24,127,20,0,63,63,130,4,4,32,128,4,
+  63,137,1,116,0,128,4,63,122,127,50,0,63,59,95,0,128,4,63,201,1,122,0,63,
+  203,2,127,20,0,63,215,2,128,4,63,197,1,128,4,63,138,3,128,0,0,128,4,63,
+  198,1,109,0,63,109,128,4,16,128,4,63,137,1,128,4,17,127,3,0,63,90,128,4,
+  20,128,4,17,128,4,6,128,4,63,178,1,128,4,63,121,128,4,21,82,0,128,4,63,
+  133,1,110,0,128,4,63,128,1,84,0,129,68,1,124,0,63,87,128,4,63,224,1,102,
+  0,63,143,1,95,0,63,88,128,4,24,90,0,128,4,63,236,2,128,4,63,156,3,128,
+  4,0,127,21,0,63,88,127,23,0,63,203,2,127,20,0,63,89,127,22,0,63,89,128,
+  0,0,128,4,63,220,10,127,19,0,63,203,125,63,229,133,1,97,0,63,253,2,100,0,
+  63,227,2,125,0,63,137,1,103,0,63,134,1,128,4,0,103,0,63,112,127,1,0,63,
+  96,99,0,128,4,63,179,1,104,0,63,111,128,4,19,108,0,63,112,81,0,128,4,63,
+  153,1,128,4,17,128,4,2,128,0,63,127,75,0,128,4,77,0,128,4,63,195,1,128,
+  4,63,140,1,96,0,128,4,63,121,100,0,129,68,2,75,0,128,4,63,121,116,0,129,
+  68,63,133,1,128,4,9,128,4,127,18,0,63,73,82,0,128,4,1,127,17,0,63,74,
+  84,0,128,4,8,128,4,67,0,128,4,63,139,1,128,4,18,128,4,9,128,4,1,129,
+  64,10,119,0,63,75,82,0,128,4,7,128,4,0,128,4,63,146,1,128,4,4,128,4,
+  8,66,0,128,4,7,128,4,63,151,1,77,0,128,4,72,0,66,4,9,128,4,63,137,
+  1,128,4,12,128,4,9,127,9,0,63,78,128,4,68,0,128,4,6,128,4,63,164,1,
+  128,4,12,128,4,18,125,0,63,80,66,0,128,4,63,177,3,128,4,9,128,4,63,145,
+  1,129,68,63,186,1,127,19,0,63,85,127,27,0,63,94,128,4,29,115,0,63,85,128,
+  4,35,70,0,128,4,63,133,1,96,0,129,68,4,128,4,13,97,0,63,119,128,4,15,
+  128,4,63,127,128,4,41,108,0,63,90,99,0,128,4,3,108,0,63,91,128,4,34,128,
+  4,63,150,1,128,4,63,191,3,106,0,63,124,128,4,3,129,68,1,106,0,63,126,113,
+  0,63,81,71,0,128,4,13,81,0,128,4,8,128,4,63,126,128,4,18,128,4,3,128,
+  4,0,72,0,128,4,2,116,0,63,77,66,0,128,4,29,129,68,68,0,128,4,1,66,
+  0,128,4,2,111,0,63,114,128,4,0,73,0,129,68,1,128,4,108,0,63,72,66,0,
+  128,4,44,128,4,0,128,4,66,0,128,4,111,0,63,102,128,4,18,128,4,2,113,0,
+  63,67,66,0,129,68,8,128,0,0,128,4,18,127,9,0,63,69,129,68,2,128,4,63,
+  163,1,95,0,24,128,4,1,129,64,0,128,4,0,112,0,63,76,128,4,52,109,0,63,
+  73,118,0,128,4,63,115,128,4,0,128,4,51,128,4,7,107,0,63,127,111,0,63,65,
+  129,64,89,0,128,4,4,128,4,63,137,1,72,0,128,4,0,128,4,19,127,19,0,63,
+  68,129,64,28,128,4,63,142,1,129,64,42,128,4,63,127,127,49,0,63,91,128,4,21,
+  125,0,63,202,2,127,21,0,63,213,2,128,4,63,195,1,128,4,63,158,1,128,4,63,
+  173,1,127,9,0,63,107,128,4,16,114,0,63,89,128,4,31,128,4,63,142,1,128,4,
+  15,128,0,0,128,4,15,128,4,5,128,4,63,178,1,128,4,63,128,1,128,4,18,79,
+  0,128,4,63,139,1,81,0,129,68,19,128,4,63,135,1,127,22,0,63,87,128,4,53,
+  96,0,63,89,129,64,39,108,0,63,88,128,4,44,128,4,0,102,0,63,111,127,1,0,
+  63,90,128,4,63,172,1,128,4,63,177,1,127,21,0,63,88,127,24,0,63,199,2,127,
+  24,0,63,89,128,4,63,174,1,127,23,0,63,152,8,127,20,0,63,231,136,1,63,129,
+  145,1,105,0,63,245,2,108,0,63,223,2,127,2,0,63,130,1,109,0,63,108,82,0,
+  4,108,0,63,94,127,18,0,63,126,128,4,1,111,0,63,107,128,4,17,113,0,63,109,
+  78,0,128,4,0,114,0,63,105,128,4,14,128,4,1,128,0,63,134,1,74,0,12,128,
+  4,63,161,1,94,0,128,4,63,147,1,75,0,128,4,1,74,0,128,4,63,128,1,95,
+  0,128,4,1,74,0,129,68,63,139,1,128,4,7,128,4,127,18,0,63,76,80,0,128,
+  4,0,127,18,0,63,76,128,4,15,129,64,8,66,0,128,4,7,123,0,63,76,128,4,
+  0,78,0,129,68,10,128,4,63,147,1,87,0,129,68,63,150,1,129,68,0,66,0,128,
+  4,8,128,4,7,128,4,63,153,1,128,4,1,72,0,128,4,7,128,0,0,128,4,8,
+  128,4,63,142,1,128,4,67,0,128,4,5,128,4,63,166,1,128,4,9,128,4,5,127,
+  12,0,63,81,128,0,1,128,4,14,128,4,63,184,1,128,4,63,149,1,128,4,15,128,
+  4,63,159,1,128,4,8,127,19,0,63,85,127,27,0,63,93,128,4,25,119,0,63,87,
+  128,4,28,128,4,0,69,0,128,4,9,103,0,63,88,91,0,128,4,5,128,4,63,141,
+  1,128,4,35,67,0,128,4,63,136,1,127,21,0,63,92,128,4,8,83,0,128,4,63,
+  148,1,68,5,0,128,4,19,128,4,63,146,1,129,85,4,129,85,63,166,1,128,5,8,
+  128,5,21,115,0,63,90,128,5,10,128,5,16,128,4,2,129,68,63,139,1,129,80,10,
+  128,5,14,128,4,2,68,0,128,4,3,107,0,63,83,128,0,0,128,4,2,129,69,10,
+  129,84,3,71,0,128,4,1,120,0,63,80,128,0,0,128,4,5,128,5,12,128,5,1,
+  128,4,1,129,68,67,0,128,4,1,128,0,0,128,4,2,115,0,63,89,128,5,12,128,
+  5,6,128,4,1,71,0,129,68,0,128,4,113,0,63,75,66,0,128,4,9,128,5,12,
+  128,5,12,128,4,0,131,68,64,116,0,63,74,128,4,9,128,4,2,128,5,11,129,80,
+  17,117,0,63,70,66,0,129,68,1,128,4,4,70,0,128,5,10,128,5,63,139,1,67,
+  0,19,128,5,10,128,5,11,128,4,2,128,4,0,128,4,63,132,1,128,4,11,128,5,
+  8,128,5,16,120,0,63,76,79,0,129,85,4,129,85,21,128,4,63,124,129,68,19,68,
+  5,19,128,4,7,111,0,63,68,129,64,86,0,128,4,2,128,4,24,116,0,63,74,128,
+  4,63,166,1,70,0,128,4,18,127,19,0,63,70,129,64,90,0,128,4,8,128,4,63,
+  135,1,127,43,0,63,67,88,0,128,4,17,127,1,0,63,203,2,127,21,0,63,212,2,
+  128,4,15,128,4,63,160,1,128,4,63,173,1,127,11,0,63,105,128,4,11,128,4,1,
+  117,0,63,90,129,68,12,128,0,0,128,4,63,158,1,128,4,29,128,4,4,128,4,63,
+  137,1,128,4,16,77,0,129,68,6,128,4,63,134,1,79,0,128,4,15,128,0,0,128,
+  4,63,140,1,127,22,0,63,88,128,4,46,103,0,63,125,113,0,63,88,128,4,18,83,
+  0,128,4,0,109,0,63,87,128,4,0,128,4,63,173,1,127,24,0,63,88,128,4,0,
+  127,22,0,63,88,127,23,0,63,199,2,128,0,0,128,4,127,21,0,63,88,127,24,0,
+  63,151,8,127,22,0,63,131,148,1,63,157,156,1,113,0,63,238,2,114,0,63,107,127,
+  5,0,63,124,116,0,63,105,79,0,3,114,0,63,94,127,19,0,63,120,128,4,1,116,
+  0,63,105,128,4,0,127,6,0,63,105,76,0,128,4,120,0,63,84,82,0,128,4,12,
+  128,4,1,128,4,63,159,1,128,4,13,128,4,63,133,1,103,0,128,4,63,135,1,90,
+  0,129,68,0,73,0,128,4,63,144,1,128,4,6,128,4,7,127,11,0,63,77,78,0,
+  129,4,6,128,4,127,10,0,63,78,128,4,0,76,0,129,68,5,128,4,0,130,64,4,
+  6,126,0,63,80,76,0,128,4,6,129,68,63,153,1,129,68,0,128,0,0,128,4,8,
+  128,4,4,128,4,63,156,1,128,4,73,0,128,4,7,129,68,6,128,4,63,147,1,128,
+  4,2,128,4,4,128,4,15,127,3,0,63,83,129,64,8,128,4,4,127,12,0,63,86,
+  128,4,11,128,4,63,175,1,128,4,6,128,4,63,154,1,128,4,6,128,0,70,5,63,
+  162,1,67,0,66,5,6,66,5,12,122,0,63,90,128,5,2,128,4,8,128,5,10,123,
+  0,63,88,129,84,14,128,5,7,128,4,3,129,68,8,109,0,63,88,128,5,0,128,4,
+  14,128,5,5,129,68,9,128,4,63,137,1,128,5,3,78,0,128,5,13,118,0,63,85,
+  128,5,5,128,4,0,76,0,128,5,8,128,4,2,118,0,63,84,128,5,6,71,0,128,
+  4,6,128,5,8,128,4,63,141,1,128,5,5,66,0,6,70,0,128,5,63,151,1,128,
+  5,4,66,0,8,69,0,128,5,6,128,4,3,128,4,1,115,0,63,83,128,5,5,128,
+  0,10,70,0,128,5,4,128,4,1,121,0,63,83,128,5,0,129,64,1,128,0,11,70,
+  0,128,5,5,69,0,128,4,63,135,1,130,80,4,3,128,0,12,128,0,0,130,4,4,
+  0,129,5,0,129,68,0,128,0,0,128,4,1,119,0,63,83,128,5,4,128,0,12,69,
+  0,128,5,0,66,0,128,4,0,128,4,0,129,68,0,128,4,117,0,63,78,66,0,128,
+  4,0,128,5,4,128,0,12,69,0,128,5,4,128,4,0,129,64,120,0,63,74,66,0,
+  128,4,4,128,5,0,129,64,1,128,0,12,69,0,128,5,63,139,1,128,0,1,128,4,
+  2,128,4,1,128,5,5,128,0,10,70,0,128,5,1,128,4,2,128,4,63,129,1,74,
+  0,128,4,1,128,5,4,66,0,8,69,0,128,5,5,128,0,0,128,4,0,120,0,63,
+  78,69,0,128,5,5,66,0,6,70,0,128,5,9,128,4,63,131,1,129,68,6,128,5,
+  6,79,0,128,5,5,128,4,6,116,0,63,72,128,0,11,128,5,6,128,4,66,0,128,
+  4,72,0,128,5,10,120,0,63,69,70,0,129,68,7,128,5,5,76,0,128,5,63,144,
+  1,128,4,10,128,5,8,128,4,6,128,5,63,142,1,79,0,128,5,14,128,5,0,128,
+  4,63,139,1,82,0,128,5,1,128,4,4,68,0,128,5,3,127,3,0,63,91,66,5,
+  6,66,5,63,164,1,128,0,0,70,5,63,174,1,128,4,63,190,1,128,4,63,162,1,
+  128,4,63,174,1,66,0,128,4,9,128,4,1,121,0,63,91,128,4,10,128,0,0,128,
+  4,10,128,4,3,128,4,63,170,1,128,4,5,128,4,63,141,1,128,4,13,76,0,1,
+  128,4,63,144,1,77,0,128,4,1,127,5,0,63,89,128,4,127,22,0,63,89,129,64,
+  29,118,0,63,88,128,4,15,80,0,128,4,0,114,0,63,88,128,4,0,128,4,63,158,
+  3,127,22,0,63,88,127,24,0,63,87,128,0,63,159,3,127,24,0,63,184,4,127,22,
+  0,63,160,159,1,63,202,165,1,118,0,63,233,2,119,0,63,105,127,8,0,63,118,121,
+  0,63,103,76,0,128,3,122,0,63,93,127,20,0,63,115,128,3,123,0,63,102,128,3,
+  75,0,128,3,123,0,63,85,79,0,128,3,10,128,3,0,129,51,63,152,1,128,3,0,
+  70,0,128,3,11,128,3,63,139,1,87,0,128,3,0,71,0,129,51,63,148,1,128,3,
+  5,72,0,128,3,8,129,51,63,142,1,76,0,128,3,127,19,0,63,81,128,3,9,129,
+  48,72,5,128,3,5,127,2,0,63,82,72,0,66,5,4,129,51,1,66,5,63,152,1,
+  130,51,0,0,128,3,1,129,85,1,129,51,4,128,3,4,129,85,63,152,1,128,3,0,
+  128,0,0,128,5,3,128,3,4,128,0,0,128,3,5,128,5,63,151,1,128,3,0,129,
+  83,4,129,51,3,73,0,128,5,63,152,1,130,53,3,5,67,0,128,3,73,0,128,5,
+  63,150,1,128,5,5,70,0,128,3,1,67,0,128,3,3,128,5,63,148,1,128,5,1,
+  129,51,1,84,0,128,5,63,146,1,128,5,4,87,0,128,5,0,125,0,63,81,128,5,
+  5,128,0,0,128,3,2,128,3,10,70,0,128,5,66,0,128,3,6,114,0,63,81,128,
+  5,4,86,0,66,3,128,5,1,128,3,63,139,1,128,5,4,68,0,128,3,0,84,0,
+  128,5,2,66,0,128,3,63,134,1,128,5,3,71,0,128,3,6,76,0,129,53,2,121,
+  0,63,79,128,5,3,73,0,4,128,3,7,68,0,128,5,63,140,1,128,5,4,72,0,
+  14,69,0,128,5,0,123,0,63,78,128,5,3,72,0,16,67,0,132,83,48,3,63,136,
+  1,128,5,3,68,0,128,3,0,128,0,17,66,0,128,3,0,128,5,2,128,3,2,117,
+  0,63,78,128,5,3,66,0,128,3,15,128,3,0,130,51,0,0,129,51,0,130,48,5,
+  1,122,0,63,78,128,5,3,128,3,22,128,3,0,128,0,0,128,3,0,132,83,3,3,
+  121,0,63,78,128,5,1,73,0,17,66,0,128,3,0,128,5,124,0,63,77,131,80,51,
+  0,128,3,68,0,128,3,19,68,0,128,5,63,135,1,67,0,128,5,0,128,3,1,128,
+  3,24,129,48,0,128,3,0,128,5,0,123,0,63,78,128,5,1,75,0,14,69,0,129,
+  53,0,122,0,63,79,128,5,3,73,0,13,67,0,129,83,4,120,0,63,75,130,0,3,
+  0,129,53,2,73,0,128,3,1,128,3,9,68,0,128,5,0,124,0,63,73,69,0,128,
+  5,4,75,0,128,3,8,69,0,128,5,63,138,1,130,0,3,0,128,5,4,82,0,128,
+  3,69,0,128,5,63,137,1,69,0,128,5,5,68,0,128,3,3,78,0,128,5,63,144,
+  1,128,5,5,86,0,128,5,63,146,1,128,5,5,84,0,128,5,63,148,1,128,5,5,
+  71,0,128,3,0,72,0,129,53,63,149,1,128,5,7,70,0,128,3,6,128,5,63,152,
+  1,128,5,11,66,0,128,3,4,128,5,1,128,3,63,151,1,128,5,2,128,3,10,128,
+  3,2,128,5,4,128,3,66,0,128,3,63,146,1,129,85,10,67,0,129,85,4,129,51,
+  4,128,3,63,146,1,66,5,7,128,3,66,5,8,129,48,63,148,1,128,3,0,66,0,
+  72,5,1,127,7,0,63,90,128,3,25,122,0,63,89,128,3,90,0,128,3,120,0,63,
+  89,128,3,0,128,3,11,127,8,0,63,89,128,3,63,176,1,127,22,0,63,88,127,23,
+  0,63,88,128,0,0,128,3,63,173,1,127,24,0,63,184,4,127,23,0,63,205,168,1,
+  63,247,174,1,123,0,63,228,2,124,0,63,96,72,4,9,124,0,63,92,67,4,4,67,
+  0,67,4,3,127,0,0,63,89,129,68,0,79,0,129,68,0,128,3,1,125,0,63,87,
+  129,68,12,71,0,129,68,127,0,0,63,86,128,4,13,128,3,72,0,129,67,126,0,63,
+  84,129,68,6,70,0,128,3,8,66,3,129,68,63,143,1,129,64,8,128,3,70,0,128,
+  3,71,0,129,51,2,128,4,63,142,1,128,4,8,72,0,0,128,3,0,69,0,128,3,
+  4,128,4,63,140,1,128,4,0,68,0,128,3,0,67,0,0,85,0,128,4,63,138,1,
+  128,4,2,128,3,3,69,0,128,3,3,128,3,1,128,3,4,72,0,128,4,63,137,1,
+  128,4,3,73,0,4,129,51,7,71,0,128,4,63,136,1,128,4,5,130,3,0,5,129,
+  51,3,128,3,4,128,3,2,71,0,128,4,63,134,1,128,4,6,130,48,3,0,128,3,
+  2,66,3,2,83,0,128,4,63,133,1,128,4,5,67,0,0,128,3,8,128,3,11,70,
+  0,128,4,63,132,1,128,4,5,79,0,128,3,3,128,3,7,70,0,128,4,63,131,1,
+  128,4,4,70,0,129,51,92,0,128,4,63,130,1,128,4,5,77,0,128,3,13,73,0,
+  128,4,63,129,1,128,4,4,74,0,16,129,51,1,129,51,69,0,128,4,119,0,63,73,
+  128,4,4,75,0,128,3,87,0,128,3,1,128,4,63,129,1,128,4,4,77,0,128,3,
+  68,4,75,0,128,3,0,69,0,128,4,63,128,1,128,4,4,78,0,70,4,13,69,0,
+  128,4,63,127,128,4,4,77,0,72,4,8,128,3,0,128,3,0,69,0,128,4,63,127,
+  128,4,4,74,0,128,3,0,74,4,6,128,3,1,128,0,0,128,3,2,128,0,0,128,
+  4,63,127,128,4,4,72,0,128,3,2,74,4,66,3,132,0,51,0,2,70,0,128,4,
+  63,127,128,4,4,70,0,128,3,4,74,4,2,128,3,0,129,48,0,67,3,69,0,128,
+  4,63,127,128,4,4,68,0,128,3,4,128,3,0,74,4,6,128,3,1,71,0,128,4,
+  63,127,128,4,4,66,0,66,3,0,128,3,1,66,0,74,4,4,128,3,0,128,3,0,
+  128,3,1,69,0,128,4,63,127,128,4,4,70,0,128,3,5,72,4,8,128,0,2,69,
+  0,128,4,63,127,128,4,4,66,0,129,51,9,70,4,8,128,3,3,69,0,128,4,63,
+  128,1,128,4,4,129,48,1,128,3,9,68,4,12,70,0,128,4,63,129,1,128,4,2,
+  67,0,129,51,10,66,0,15,69,0,128,4,63,129,1,128,4,4,77,0,128,3,2,69,
+  0,128,3,8,69,0,128,4,63,129,1,128,4,3,104,0,128,4,63,130,1,128,4,4,
+  101,0,128,4,63,131,1,128,4,5,79,0,128,3,8,128,3,2,70,0,128,4,63,132,
+  1,128,4,5,80,0,128,3,9,70,0,128,4,63,133,1,128,4,6,71,0,128,3,5,
+  128,0,0,129,51,5,128,3,71,0,128,4,63,134,1,128,4,6,70,0,128,3,7,72,
+  0,129,51,1,129,51,0,128,4,63,136,1,128,4,6,68,0,128,3,7,129,51,73,0,
+  128,3,2,128,4,63,137,1,128,4,7,66,0,128,3,88,0,128,4,122,0,63,79,128,
+  4,7,130,48,3,13,71,0,1,128,4,2,119,0,63,81,128,4,7,129,51,86,0,128,
+  4,123,0,63,82,128,4,5,129,48,2,83,0,128,4,63,144,1,129,68,4,85,0,129,
+  68,63,147,1,128,4,24,128,4,4,121,0,63,87,129,68,84,0,129,68,63,153,1,129,
+  68,16,129,68,63,157,1,67,4,8,67,4,63,163,1,72,4,63,161,1,127,22,0,63,
+  140,176,1,63,131,171,1,74,4,63,161,1,67,4,10,67,4,63,155,1,129,68,18,129,
+  68,63,151,1,129,68,22,129,68,63,147,1,129,68,26,129,68,63,144,1,128,4,10,83,
+  0,128,4,63,141,1,129,68,7,88,0,129,68,63,138,1,128,4,7,92,0,128,4,63,
+  136,1,128,4,6,95,0,128,4,63,134,1,128,4,6,97,0,128,4,63,132,1,128,4,
+  5,100,0,128,4,63,130,1,128,4,5,89,0,128,3,75,0,128,4,63,129,1,128,4,
+  4,81,0,128,3,71,0,128,3,75,0,128,4,63,128,1,128,4,4,82,0,128,3,7,
+  128,3,6,69,0,128,4,63,126,128,4,4,77,0,128,3,68,0,1,69,0,129,51,7,
+  69,0,128,4,63,125,128,4,4,84,0,6,128,3,8,69,0,128,4,63,124,128,4,4,
+  74,0,128,3,4,92,0,128,4,63,123,128,4,3,72,0,0,71,0,3,66,3,16,68,
+  0,128,4,63,122,128,4,4,73,0,128,3,0,129,48,3,128,3,22,69,0,128,4,63,
+  121,128,4,3,75,0,129,51,0,128,3,1,128,3,3,129,48,18,68,0,128,4,63,120,
+  128,4,4,77,0,0,128,3,2,128,3,2,128,3,19,69,0,128,4,63,119,128,4,3,
+  79,0,128,3,3,66,0,128,3,2,128,3,16,68,0,128,4,63,119,128,4,3,114,0,
+  128,4,63,119,128,4,3,81,0,2,128,3,10,128,3,0,129,51,5,71,0,128,4,63,
+  118,128,4,4,82,0,129,3,10,128,3,4,129,48,5,69,0,128,4,63,117,128,4,3,
+  84,0,14,128,3,10,68,0,128,4,63,117,128,4,3,83,0,17,78,0,128,4,63,117,
+  128,4,3,82,0,15,128,3,1,129,51,1,74,0,128,4,63,117,128,4,3,80,0,129,
+  51,11,130,0,3,1,80,0,128,4,63,117,128,4,3,78,0,128,3,14,128,3,0,128,
+  0,68,3,77,0,128,4,63,117,128,4,3,74,0,1,128,3,0,128,3,0,129,48,17,
+  79,0,128,4,63,117,128,4,3,76,0,1,128,3,16,128,3,1,128,3,79,0,128,4,
+  63,117,128,4,3,75,0,128,3,21,128,3,0,128,3,1,76,0,128,4,63,117,128,4,
+  3,74,0,66,3,22,79,0,128,4,63,117,128,4,4,73,0,0,128,3,16,128,3,15,
+  69,0,128,4,63,118,128,4,3,83,0,128,3,2,90,0,128,4,63,119,128,4,3,114,
+  0,128,4,63,119,128,4,3,87,0,128,3,6,128,3,12,68,0,128,4,63,119,128,4,
+  4,87,0,129,51,4,128,3,11,69,0,128,4,63,120,128,4,3,81,0,128,3,3,66,
+  0,128,3,7,128,3,7,68,0,128,4,63,121,128,4,4,79,0,128,3,13,66,3,1,
+  128,3,4,69,0,128,4,63,122,128,4,3,78,0,128,3,94,0,128,4,63,123,128,4,
+  4,77,0,128,3,18,75,0,128,4,63,124,128,4,4,75,0,128,3,8,85,0,128,4,
+  63,125,128,4,4,107,0,128,4,63,126,128,4,4,74,0,22,71,0,128,4,63,128,1,
+  128,4,4,103,0,128,4,63,129,1,128,4,5,102,0,128,4,63,130,1,128,4,5,100,
+  0,128,4,63,132,1,128,4,6,97,0,128,4,63,134,1,128,4,6,95,0,128,4,63,
+  136,1,128,4,7,92,0,128,4,63,138,1,129,68,7,88,0,129,68,63,141,1,128,4,
+  10,83,0,128,4,63,144,1,129,68,26,129,68,63,147,1,129,68,22,129,68,63,151,1,
+  129,68,18,129,68,63,155,1,67,4,10,67,4,63,161,1,74,4,63,146,169,1,63,227,
+  159,1,74,4,63,160,1,68,4,10,68,4,63,153,1,129,68,20,129,68,63,148,1,66,
+  4,24,66,4,63,143,1,129,68,30,129,68,63,140,1,128,4,34,128,4,63,137,1,129,
+  68,12,87,0,129,68,63,134,1,128,4,10,93,0,128,4,63,132,1,128,4,9,96,0,
+  128,4,63,130,1,128,4,8,99,0,128,4,63,128,1,128,4,7,102,0,128,4,63,126,
+  128,4,7,104,0,128,4,63,124,128,4,6,107,0,128,4,63,122,128,4,6,109,0,128,
+  4,63,120,128,4,6,111,0,128,4,63,118,128,4,6,113,0,128,4,63,117,128,4,5,
+  114,0,128,4,63,116,128,4,5,116,0,128,4,63,114,128,4,6,117,0,128,4,63,113,
+  128,4,5,118,0,128,4,63,112,128,4,5,120,0,128,4,63,111,128,4,5,96,0,128,
+  3,86,0,128,4,63,111,128,4,4,90,0,128,3,4,128,3,17,69,0,128,4,63,110,
+  128,4,5,85,0,128,3,66,0,128,3,0,68,0,129,51,16,70,0,128,4,63,109,128,
+  4,4,83,0,128,3,12,128,3,18,69,0,128,4,63,108,128,4,5,81,0,1,66,0,
+  0,128,3,2,128,3,3,91,0,128,4,63,107,128,4,4,82,0,128,3,0,129,48,2,
+  128,3,0,128,3,26,69,0,128,4,63,107,128,4,4,83,0,66,3,1,129,51,28,69,
+  0,128,4,63,107,128,4,4,85,0,128,3,4,128,3,2,128,3,22,69,0,128,4,63,
+  107,128,4,4,85,0,128,3,2,128,0,0,128,3,8,87,0,128,4,63,106,128,4,4,
+  88,0,10,128,3,0,129,48,4,82,0,128,4,63,105,128,4,4,89,0,9,128,3,0,
+  128,3,18,69,0,128,4,63,105,128,4,4,88,0,12,128,3,18,69,0,128,4,63,105,
+  128,4,4,87,0,13,66,3,0,85,0,128,4,63,105,128,4,4,86,0,11,128,0,66,
+  3,18,69,0,128,4,63,105,128,4,4,85,0,128,3,12,128,0,67,3,86,0,128,4,
+  63,105,128,4,4,82,0,128,3,1,129,3,11,66,3,18,69,0,128,4,63,105,128,4,
+  4,83,0,1,128,3,13,130,3,3,87,0,128,4,63,105,128,4,4,81,0,1,128,3,
+  18,87,0,128,4,63,105,128,4,4,82,0,129,51,11,128,3,23,69,0,128,4,63,105,
+  128,4,4,90,0,7,92,0,128,4,63,106,128,4,4,92,0,128,3,4,128,3,19,69,
+  0,128,4,63,107,128,4,4,93,0,128,3,3,128,3,19,69,0,128,4,63,107,128,4,
+  4,87,0,129,51,2,128,0,0,128,3,3,131,3,51,15,69,0,128,4,63,107,128,4,
+  4,86,0,129,51,5,69,0,18,69,0,128,4,63,107,128,4,5,85,0,128,3,7,69,
+  0,128,3,86,0,128,4,63,108,128,4,4,84,0,128,3,7,93,0,128,4,63,109,128,
+  4,5,122,0,128,4,63,110,128,4,4,83,0,0,100,0,128,4,63,111,128,4,5,120,
+  0,128,4,63,111,128,4,5,120,0,128,4,63,112,128,4,5,118,0,128,4,63,113,128,
+  4,6,117,0,128,4,63,114,128,4,5,116,0,128,4,63,116,128,4,5,114,0,128,4,
+  63,117,128,4,6,113,0,128,4,63,118,128,4,6,111,0,128,4,63,120,128,4,6,109,
+  0,128,4,63,122,128,4,6,107,0,128,4,63,124,128,4,7,104,0,128,4,63,126,128,
+  4,7,102,0,128,4,63,128,1,128,4,8,99,0,128,4,63,130,1,128,4,9,96,0,
+  128,4,63,132,1,128,4,10,93,0,128,4,63,134,1,129,68,12,87,0,129,68,63,137,
+  1,128,4,34,128,4,63,140,1,129,68,30,129,68,63,143,1,66,4,24,66,4,63,148,
+  1,129,68,20,129,68,63,153,1,68,4,10,68,4,63,160,1,74,4,63,242,157,1,63,
+  194,148,1,76,4,63,159,1,67,4,12,67,4,63,151,1,67,4,20,67,4,63,145,1,
+  129,68,28,129,68,63,141,1,129,68,32,129,68,63,137,1,129,68,36,129,68,63,133,1,
+  129,68,14,89,0,129,68,63,130,1,128,4,11,96,0,128,4,63,128,1,128,4,10,99,
+  0,128,4,63,125,129,68,8,103,0,129,68,63,122,128,4,8,107,0,128,4,63,120,128,
+  4,8,109,0,128,4,63,118,128,4,7,112,0,128,4,63,116,128,4,7,114,0,128,4,
+  63,114,128,4,7,116,0,128,4,63,112,128,4,7,118,0,128,4,63,111,128,4,6,119,
+  0,128,4,63,110,128,4,6,121,0,128,4,63,108,128,4,6,123,0,128,4,63,106,128,
+  4,6,125,0,128,4,63,105,128,4,5,126,0,128,4,63,104,128,4,5,127,1,0,128,
+  4,63,103,128,4,5,127,1,0,128,4,63,102,128,4,5,127,3,0,128,4,63,101,128,
+  4,4,127,4,0,128,4,63,100,128,4,5,127,5,0,128,4,63,99,128,4,4,127,6,
+  0,128,4,63,98,128,4,5,127,7,0,128,4,63,97,128,4,5,127,7,0,128,4,63,
+  97,128,4,4,127,8,0,128,4,63,97,128,4,4,102,0,128,3,95,0,128,4,63,96,
+  128,4,4,97,0,128,3,0,66,0,129,51,26,69,0,128,4,63,95,128,4,4,94,0,
+  0,66,0,3,129,51,26,69,0,128,4,63,95,128,4,4,92,0,128,3,3,130,3,3,
+  30,69,0,128,4,63,95,128,4,4,90,0,130,3,3,1,128,3,1,128,3,31,69,0,
+  128,4,63,94,128,4,5,91,0,1,128,3,0,128,3,34,70,0,128,4,63,93,128,4,
+  4,93,0,128,3,6,128,3,2,97,0,128,4,63,93,128,4,4,95,0,7,67,3,95,
+  0,128,4,63,93,128,4,4,94,0,8,128,3,0,128,3,26,69,0,128,4,63,93,128,
+  4,4,93,0,11,129,51,95,0,128,4,63,93,128,4,4,93,0,10,128,3,0,128,0,
+  1,93,0,128,4,63,93,128,4,4,91,0,0,128,3,10,66,3,95,0,128,4,63,93,
+  128,4,4,90,0,66,3,10,66,3,95,0,128,4,63,93,128,4,4,90,0,128,3,12,
+  128,3,0,96,0,128,4,63,93,128,4,4,90,0,129,51,40,69,0,128,4,63,93,128,
+  4,4,95,0,6,100,0,128,4,63,93,128,4,4,96,0,6,128,3,28,69,0,128,4,
+  63,93,128,4,5,94,0,128,3,2,129,48,1,132,51,48,3,23,70,0,128,4,63,94,
+  128,4,4,93,0,129,51,2,128,3,31,69,0,128,4,63,95,128,4,4,93,0,0,74,
+  0,1,93,0,128,4,63,95,128,4,4,127,10,0,128,4,63,95,128,4,4,92,0,0,
+  107,0,128,4,63,96,128,4,4,127,8,0,128,4,63,97,128,4,4,127,8,0,128,4,
+  63,97,128,4,5,127,7,0,128,4,63,97,128,4,5,127,7,0,128,4,63,98,128,4,
+  4,127,6,0,128,4,63,99,128,4,5,127,5,0,128,4,63,100,128,4,4,127,4,0,
+  128,4,63,101,128,4,5,127,3,0,128,4,63,102,128,4,5,127,1,0,128,4,63,103,
+  128,4,5,127,1,0,128,4,63,104,128,4,5,126,0,128,4,63,105,128,4,6,125,0,
+  128,4,63,106,128,4,6,123,0,128,4,63,108,128,4,6,121,0,128,4,63,110,128,4,
+  6,119,0,128,4,63,111,128,4,7,118,0,128,4,63,112,128,4,7,116,0,128,4,63,
+  114,128,4,7,114,0,128,4,63,116,128,4,7,112,0,128,4,63,118,128,4,8,109,0,
+  128,4,63,120,128,4,8,107,0,128,4,63,122,129,68,8,103,0,129,68,63,125,128,4,
+  10,99,0,128,4,63,128,1,128,4,11,96,0,128,4,63,130,1,129,68,14,89,0,129,
+  68,63,133,1,129,68,36,129,68,63,137,1,129,68,32,129,68,63,141,1,129,68,28,129,
+  68,63,145,1,67,4,20,67,4,63,151,1,67,4,12,67,4,63,159,1,76,4,63,209,
+  146,1,63,146,139,1,76,3,63,158,1,68,3,12,68,3,63,150,1,66,3,22,66,3,
+  63,144,1,66,3,28,66,3,63,139,1,129,51,34,129,51,63,135,1,129,51,12,89,0,
+  129,51,63,131,1,129,51,10,95,0,129,51,63,127,129,51,8,101,0,129,51,63,124,128,
+  3,8,105,0,128,3,63,122,128,3,7,108,0,128,3,63,119,129,51,6,111,0,129,51,
+  63,116,128,3,6,115,0,128,3,63,114,128,3,6,117,0,128,3,63,112,128,3,6,119,
+  0,128,3,63,110,128,3,5,122,0,128,3,63,108,128,3,5,124,0,128,3,63,106,128,
+  3,5,126,0,128,3,63,104,128,3,5,127,1,0,128,3,63,103,128,3,4,127,2,0,
+  128,3,63,102,128,3,4,127,4,0,128,3,63,100,128,3,4,127,6,0,128,3,63,98,
+  128,3,5,127,7,0,128,3,63,97,128,3,4,127,8,0,128,3,63,96,128,3,4,127,
+  10,0,128,3,63,95,128,3,3,127,11,0,128,3,63,94,128,3,4,127,12,0,128,3,
+  63,93,128,3,3,127,13,0,128,3,63,92,128,3,4,127,14,0,128,3,63,91,128,3,
+  3,127,15,0,128,3,63,90,128,3,4,127,16,0,128,3,63,89,128,3,3,127,17,0,
+  128,3,63,89,128,3,3,127,17,0,128,3,63,88,128,3,3,127,19,0,128,3,63,87,
+  128,3,3,127,19,0,128,3,63,87,128,3,3,127,19,0,128,3,63,86,128,3,4,127,
+  20,0,128,3,63,85,128,3,3,127,21,0,128,3,63,85,128,3,3,127,21,0,128,3,
+  63,85,128,3,3,103,0,1,128,0,0,128,3,103,0,128,3,63,85,128,3,3,101,0,
+  2,66,0,35,68,0,128,3,63,84,128,3,3,98,0,0,128,0,4,128,3,1,128,3,
+  35,68,0,128,3,63,83,128,3,3,99,0,1,128,3,42,68,0,128,3,63,83,128,3,
+  3,100,0,128,3,7,104,0,128,3,63,83,128,3,3,100,0,12,100,0,128,3,63,83,
+  128,3,3,99,0,11,102,0,128,3,63,83,128,3,3,99,0,11,102,0,128,3,63,83,
+  128,3,3,98,0,12,102,0,128,3,63,83,128,3,3,98,0,11,103,0,128,3,63,83,
+  128,3,3,98,0,128,3,10,103,0,128,3,63,83,128,3,3,100,0,44,68,0,128,3,
+  63,83,128,3,3,101,0,6,128,3,0,128,3,33,68,0,128,3,63,83,128,3,3,101,
+  0,128,3,42,68,0,128,3,63,83,128,3,3,101,0,4,66,0,0,103,0,128,3,63,
+  84,128,3,3,100,0,3,107,0,128,3,63,85,128,3,3,127,21,0,128,3,63,85,128,
+  3,3,127,21,0,128,3,63,85,128,3,3,127,21,0,128,3,63,85,128,3,4,127,20,
+  0,128,3,63,86,128,3,3,127,19,0,128,3,63,87,128,3,3,127,19,0,128,3,63,
+  87,128,3,3,127,19,0,128,3,63,88,128,3,3,127,17,0,128,3,63,89,128,3,3,
+  127,17,0,128,3,63,89,128,3,4,127,16,0,128,3,63,90,128,3,3,127,15,0,128,
+  3,63,91,128,3,4,127,14,0,128,3,63,92,128,3,3,127,13,0,128,3,63,93,128,
+  3,4,127,12,0,128,3,63,94,128,3,3,127,11,0,128,3,63,95,128,3,4,127,10,
+  0,128,3,63,96,128,3,4,127,8,0,128,3,63,97,128,3,5,127,7,0,128,3,63,
+  98,128,3,4,127,6,0,128,3,63,100,128,3,4,127,4,0,128,3,63,102,128,3,4,
+  127,2,0,128,3,63,103,128,3,5,127,1,0,128,3,63,104,128,3,5,126,0,128,3,
+  63,106,128,3,5,124,0,128,3,63,108,128,3,5,122,0,128,3,63,110,128,3,6,119,
+  0,128,3,63,112,128,3,6,117,0,128,3,63,114,128,3,6,115,0,128,3,63,116,129,
+  51,6,111,0,129,51,63,119,128,3,7,108,0,128,3,63,122,128,3,8,105,0,128,3,
+  63,124,129,51,8,101,0,129,51,63,127,129,51,10,95,0,129,51,63,131,1,129,51,12,
+  89,0,129,51,63,135,1,129,51,34,129,51,63,139,1,66,3,28,66,3,63,144,1,66,
+  3,22,66,3,63,150,1,68,3,12,68,3,63,158,1,76,3,63,161,137,1,63,241,127,
+  78,3,63,156,1,68,3,14,68,3,63,148,1,66,3,24,66,3,63,142,1,66,3,30,
+  66,3,63,136,1,66,3,36,66,3,63,131,1,129,51,42,129,51,63,127,129,51,16,93,
+  0,129,51,63,124,128,3,13,100,0,128,3,63,121,129,51,11,104,0,129,51,63,118,128,
+  3,10,109,0,128,3,63,115,129,51,9,112,0,129,51,63,112,128,3,9,116,0,128,3,
+  63,110,128,3,8,119,0,128,3,63,108,128,3,7,122,0,128,3,63,105,129,51,7,124,
+  0,129,51,63,102,128,3,8,127,0,0,128,3,63,100,128,3,7,127,3,0,128,3,63,
+  99,128,3,6,127,4,0,128,3,63,98,128,3,6,127,6,0,128,3,63,96,128,3,6,
+  127,8,0,128,3,63,94,128,3,6,127,10,0,128,3,63,92,128,3,6,127,12,0,128,
+  3,63,91,128,3,5,127,13,0,128,3,63,90,128,3,5,127,15,0,128,3,63,88,128,
+  3,6,127,16,0,128,3,63,87,128,3,5,127,17,0,128,3,63,86,128,3,5,127,19,
+  0,128,3,63,84,128,3,5,127,21,0,128,3,63,83,128,3,5,127,21,0,128,3,63,
+  82,128,3,5,127,23,0,128,3,63,81,128,3,5,127,23,0,128,3,63,80,128,3,5,
+  127,25,0,128,3,63,79,128,3,5,127,25,0,128,3,63,79,128,3,4,127,26,0,128,
+  3,63,78,128,3,5,127,27,0,128,3,63,77,128,3,4,127,28,0,128,3,63,77,128,
+  3,4,127,28,0,128,3,63,76,128,3,5,127,29,0,128,3,63,75,128,3,4,127,30,
+  0,128,3,63,75,128,3,4,127,30,0,128,3,63,74,128,3,5,127,31,0,128,3,63,
+  73,128,3,4,127,32,0,128,3,63,73,128,3,4,127,32,0,128,3,63,73,128,3,4,
+  127,32,0,128,3,63,73,128,3,4,127,32,0,128,3,63,72,128,3,5,127,33,0,128,
+  3,63,71,128,3,4,112,0,128,2,111,0,128,3,63,71,128,3,4,107,0,4,128,2,
+  41,69,0,128,3,63,71,128,3,4,105,0,128,2,48,69,0,128,3,63,71,128,3,4,
+  105,0,8,110,0,128,3,63,71,128,3,4,104,0,50,69,0,128,3,63,71,128,3,4,
+  104,0,10,109,0,128,3,63,71,128,3,4,104,0,10,109,0,128,3,63,71,128,3,4,
+  104,0,50,69,0,128,3,63,71,128,3,4,104,0,50,69,0,128,3,63,71,128,3,4,
+  105,0,49,69,0,128,3,63,71,128,3,4,106,0,6,128,2,0,109,0,128,3,63,71,
+  128,3,4,106,0,128,2,6,110,0,128,3,63,71,128,3,4,127,34,0,128,3,63,71,
+  128,3,5,127,33,0,128,3,63,72,128,3,4,127,32,0,128,3,63,73,128,3,4,127,
+  32,0,128,3,63,73,128,3,4,127,32,0,128,3,63,73,128,3,4,127,32,0,128,3,
+  63,73,128,3,5,127,31,0,128,3,63,74,128,3,4,127,30,0,128,3,63,75,128,3,
+  4,127,30,0,128,3,63,75,128,3,5,127,29,0,128,3,63,76,128,3,4,127,28,0,
+  128,3,63,77,128,3,4,127,28,0,128,3,63,77,128,3,5,127,27,0,128,3,63,78,
+  128,3,4,127,26,0,128,3,63,79,128,3,5,127,25,0,128,3,63,79,128,3,5,127,
+  25,0,128,3,63,80,128,3,5,127,23,0,128,3,63,81,128,3,5,127,23,0,128,3,
+  63,82,128,3,5,127,21,0,128,3,63,83,128,3,5,127,21,0,128,3,63,84,128,3,
+  5,127,19,0,128,3,63,86,128,3,5,127,17,0,128,3,63,87,128,3,6,127,16,0,
+  128,3,63,88,128,3,5,127,15,0,128,3,63,90,128,3,5,127,13,0,128,3,63,91,
+  128,3,6,127,12,0,128,3,63,92,128,3,6,127,10,0,128,3,63,94,128,3,6,127,
+  8,0,128,3,63,96,128,3,6,127,6,0,128,3,63,98,128,3,6,127,4,0,128,3,
+  63,99,128,3,7,127,3,0,128,3,63,100,128,3,8,127,0,0,128,3,63,102,129,51,
+  7,124,0,129,51,63,105,128,3,7,122,0,128,3,63,108,128,3,8,119,0,128,3,63,
+  110,128,3,9,116,0,128,3,63,112,129,51,9,112,0,129,51,63,115,128,3,10,109,0,
+  128,3,63,118,129,51,11,104,0,129,51,63,121,128,3,13,100,0,128,3,63,124,129,51,
+  16,93,0,129,51,63,127,129,51,42,129,51,63,131,1,66,3,36,66,3,63,136,1,66,
+  3,30,66,3,63,142,1,66,3,24,66,3,63,148,1,68,3,14,68,3,63,156,1,78,
+  3,63,128,126,63,193,118,78,3,63,156,1,68,3,14,68,3,63,147,1,67,3,24,67,
+  3,63,140,1,66,3,32,66,3,63,134,1,66,3,38,66,3,63,129,1,129,51,14,93,
+  0,129,51,63,125,129,51,11,100,0,129,51,63,121,129,51,10,105,0,129,51,63,118,128,
+  3,9,110,0,128,3,63,115,129,51,7,114,0,129,51,63,112,128,3,7,118,0,128,3,
+  63,109,129,51,6,121,0,129,51,63,106,128,3,7,124,0,128,3,63,104,128,3,6,127,
+  0,0,128,3,63,102,128,3,6,127,2,0,128,3,63,99,129,51,5,127,5,0,129,51,
+  63,96,128,3,6,127,8,0,128,3,63,94,128,3,6,127,10,0,128,3,63,92,128,3,
+  6,127,12,0,128,3,63,91,128,3,4,127,14,0,128,3,63,90,128,3,4,127,16,0,
+  128,3,63,88,128,3,4,127,18,0,128,3,63,86,128,3,5,127,19,0,128,3,63,84,
+  128,3,5,127,21,0,128,3,63,83,128,3,4,127,22,0,128,3,63,82,128,3,4,127,
+  24,0,128,3,63,80,128,3,4,127,26,0,128,3,63,79,128,3,4,127,26,0,128,3,
+  63,78,128,3,4,127,28,0,128,3,63,76,128,3,4,127,30,0,128,3,63,75,128,3,
+  4,127,30,0,128,3,63,74,128,3,4,127,32,0,128,3,63,73,128,3,3,127,33,0,
+  128,3,63,72,128,3,4,127,34,0,128,3,63,71,128,3,3,127,35,0,128,3,63,70,
+  128,3,4,127,36,0,128,3,63,69,128,3,3,127,37,0,128,3,63,69,128,3,3,127,
+  37,0,128,3,63,68,128,3,4,127,38,0,128,3,63,67,128,3,3,127,39,0,128,3,
+  63,67,128,3,3,127,39,0,128,3,63,66,128,3,4,127,40,0,128,3,63,65,128,3,
+  3,127,41,0,128,3,63,65,128,3,3,127,41,0,128,3,63,65,128,3,3,127,41,0,
+  128,3,63,64,128,3,3,127,43,0,128,3,63,63,128,3,3,127,43,0,128,3,63,63,
+  128,3,3,127,43,0,128,3,63,63,128,3,3,127,43,0,128,3,63,63,128,3,3,127,
+  43,0,128,3,63,62,128,3,3,127,45,0,128,3,63,61,128,3,3,127,45,0,128,3,
+  63,61,128,3,3,113,0,68,3,117,0,128,3,63,61,128,3,3,112,0,70,3,47,68,
+  0,128,3,63,61,128,3,3,111,0,72,3,46,68,0,128,3,63,61,128,3,3,110,0,
+  74,3,45,68,0,128,3,63,61,128,3,3,110,0,74,3,45,68,0,128,3,63,61,128,
+  3,3,110,0,74,3,45,68,0,128,3,63,61,128,3,3,110,0,74,3,45,68,0,128,
+  3,63,61,128,3,3,110,0,74,3,45,68,0,128,3,63,61,128,3,3,111,0,72,3,
+  46,68,0,128,3,63,61,128,3,3,112,0,70,3,116,0,128,3,63,61,128,3,3,113,
+  0,68,3,48,68,0,128,3,63,61,128,3,3,127,45,0,128,3,63,61,128,3,3,127,
+  45,0,128,3,63,62,128,3,3,127,43,0,128,3,63,63,128,3,3,127,43,0,128,3,
+  63,63,128,3,3,127,43,0,128,3,63,63,128,3,3,127,43,0,128,3,63,63,128,3,
+  3,127,43,0,128,3,63,64,128,3,3,127,41,0,128,3,63,65,128,3,3,127,41,0,
+  128,3,63,65,128,3,3,127,41,0,128,3,63,65,128,3,4,127,40,0,128,3,63,66,
+  128,3,3,127,39,0,128,3,63,67,128,3,3,127,39,0,128,3,63,67,128,3,4,127,
+  38,0,128,3,63,68,128,3,3,127,37,0,128,3,63,69,128,3,3,127,37,0,128,3,
+  63,69,128,3,4,127,36,0,128,3,63,70,128,3,3,127,35,0,128,3,63,71,128,3,
+  4,127,34,0,128,3,63,72,128,3,3,127,33,0,128,3,63,73,128,3,4,127,32,0,
+  128,3,63,74,128,3,4,127,30,0,128,3,63,75,128,3,4,127,30,0,128,3,63,76,
+  128,3,4,127,28,0,128,3,63,78,128,3,4,127,26,0,128,3,63,79,128,3,4,127,
+  26,0,128,3,63,80,128,3,4,127,24,0,128,3,63,82,128,3,4,127,22,0,128,3,
+  63,83,128,3,5,127,21,0,128,3,63,84,128,3,5,127,19,0,128,3,63,86,128,3,
+  4,127,18,0,128,3,63,88,128,3,4,127,16,0,128,3,63,90,128,3,4,127,14,0,
+  128,3,63,91,128,3,6,127,12,0,128,3,63,92,128,3,6,127,10,0,128,3,63,94,
+  128,3,6,127,8,0,128,3,63,96,129,51,5,127,5,0,129,51,63,99,128,3,6,127,
+  2,0,128,3,63,102,128,3,6,127,0,0,128,3,63,104,128,3,7,124,0,128,3,63,
+  106,129,51,6,121,0,129,51,63,109,128,3,7,118,0,128,3,63,112,129,51,7,114,0,
+  129,51,63,115,128,3,9,110,0,128,3,63,118,129,51,10,105,0,129,51,63,121,129,51,
+  11,100,0,129,51,63,125,129,51,14,93,0,129,51,63,129,1,66,3,38,66,3,63,134,
+  1,66,3,32,66,3,63,140,1,67,3,24,67,3,63,147,1,68,3,14,68,3,63,156,
+  1,78,3,63,208,116,63,161,107,78,2,63,155,1,69,2,14,69,2,63,145,1,67,2,
+  26,67,2,63,138,1,66,2,34,66,2,63,132,1,66,2,40,66,2,63,127,129,34,46,
+  129,34,63,123,129,34,17,96,0,129,34,63,119,129,34,14,103,0,129,34,63,115,129,34,
+  12,109,0,129,34,63,111,129,34,11,114,0,129,34,63,108,128,2,10,119,0,128,2,63,
+  105,129,34,9,122,0,129,34,63,102,128,2,9,126,0,128,2,63,100,128,2,8,127,2,
+  0,128,2,63,97,129,34,8,127,4,0,129,34,63,94,128,2,8,127,8,0,128,2,63,
+  92,128,2,8,127,10,0,128,2,63,90,128,2,7,127,13,0,128,2,63,88,128,2,7,
+  127,15,0,128,2,63,86,128,2,7,127,17,0,128,2,63,84,128,2,7,127,19,0,128,
+  2,63,82,128,2,6,127,22,0,128,2,63,80,128,2,6,127,24,0,128,2,63,78,128,
+  2,6,127,26,0,128,2,63,77,128,2,5,127,27,0,128,2,63,76,128,2,6,127,28,
+  0,128,2,63,74,128,2,6,127,30,0,128,2,63,72,128,2,6,127,32,0,128,2,63,
+  71,128,2,5,127,33,0,128,2,63,70,128,2,5,127,35,0,128,2,63,68,128,2,6,
+  127,36,0,128,2,63,67,128,2,5,127,37,0,128,2,63,66,128,2,5,127,39,0,128,
+  2,63,65,128,2,5,127,39,0,128,2,63,64,128,2,5,127,41,0,128,2,63,63,128,
+  2,4,127,42,0,128,2,63,62,128,2,5,127,43,0,128,2,63,61,128,2,4,127,44,
+  0,128,2,63,60,128,2,5,127,45,0,128,2,63,59,128,2,4,127,46,0,128,2,63,
+  58,128,2,5,127,47,0,128,2,63,57,128,2,4,127,48,0,128,2,63,57,128,2,4,
+  127,48,0,128,2,63,56,128,2,5,127,49,0,128,2,63,55,128,2,4,127,50,0,128,
+  2,63,55,128,2,4,127,50,0,128,2,63,54,128,2,5,127,51,0,128,2,63,53,128,
+  2,4,127,52,0,128,2,63,53,128,2,4,127,52,0,128,2,63,53,128,2,4,127,52,
+  0,128,2,63,52,128,2,5,127,53,0,128,2,63,51,128,2,4,127,54,0,128,2,63,
+  51,128,2,4,127,54,0,128,2,63,51,128,2,4,127,54,0,128,2,63,51,128,2,4,
+  127,54,0,128,2,63,51,128,2,4,127,54,0,128,2,63,50,128,2,4,127,56,0,128,
+  2,63,49,128,2,4,127,56,0,128,2,63,49,128,2,4,118,0,58,69,0,128,2,63,
+  49,128,2,4,117,0,59,69,0,128,2,63,49,128,2,4,116,0,60,69,0,128,2,63,
+  49,128,2,4,115,0,61,69,0,128,2,63,49,128,2,4,115,0,61,69,0,128,2,63,
+  49,128,2,4,115,0,61,69,0,128,2,63,49,128,2,4,115,0,61,69,0,128,2,63,
+  49,128,2,4,115,0,61,69,0,128,2,63,49,128,2,4,116,0,60,69,0,128,2,63,
+  49,128,2,4,117,0,59,69,0,128,2,63,49,128,2,4,118,0,58,69,0,128,2,63,
+  49,128,2,4,127,56,0,128,2,63,49,128,2,4,127,56,0,128,2,63,50,128,2,4,
+  127,54,0,128,2,63,51,128,2,4,127,54,0,128,2,63,51,128,2,4,127,54,0,128,
+  2,63,51,128,2,4,127,54,0,128,2,63,51,128,2,4,127,54,0,128,2,63,51,128,
+  2,5,127,53,0,128,2,63,52,128,2,4,127,52,0,128,2,63,53,128,2,4,127,52,
+  0,128,2,63,53,128,2,4,127,52,0,128,2,63,53,128,2,5,127,51,0,128,2,63,
+  54,128,2,4,127,50,0,128,2,63,55,128,2,4,127,50,0,128,2,63,55,128,2,5,
+  127,49,0,128,2,63,56,128,2,4,127,48,0,128,2,63,57,128,2,4,127,48,0,128,
+  2,63,57,128,2,5,127,47,0,128,2,63,58,128,2,4,127,46,0,128,2,63,59,128,
+  2,5,127,45,0,128,2,63,60,128,2,4,127,44,0,128,2,63,61,128,2,5,127,43,
+  0,128,2,63,62,128,2,4,127,42,0,128,2,63,63,128,2,5,127,41,0,128,2,63,
+  64,128,2,5,127,39,0,128,2,63,65,128,2,5,127,39,0,128,2,63,66,128,2,5,
+  127,37,0,128,2,63,67,128,2,6,127,36,0,128,2,63,68,128,2,5,127,35,0,128,
+  2,63,70,128,2,5,127,33,0,128,2,63,71,128,2,6,127,32,0,128,2,63,72,128,
+  2,6,127,30,0,128,2,63,74,128,2,6,127,28,0,128,2,63,76,128,2,5,127,27,
+  0,128,2,63,77,128,2,6,127,26,0,128,2,63,78,128,2,6,127,24,0,128,2,63,
+  80,128,2,6,127,22,0,128,2,63,82,128,2,7,127,19,0,128,2,63,84,128,2,7,
+  127,17,0,128,2,63,86,128,2,7,127,15,0,128,2,63,88,128,2,7,127,13,0,128,
+  2,63,90,128,2,8,127,10,0,128,2,63,92,128,2,8,127,8,0,128,2,63,94,129,
+  34,8,127,4,0,129,34,63,97,128,2,8,127,2,0,128,2,63,100,128,2,9,126,0,
+  128,2,63,102,129,34,9,122,0,129,34,63,105,128,2,10,119,0,128,2,63,108,129,34,
+  11,114,0,129,34,63,111,129,34,12,109,0,129,34,63,115,129,34,14,103,0,129,34,63,
+  119,129,34,17,96,0,129,34,63,123,129,34,46,129,34,63,127,66,2,40,66,2,63,132,
+  1,66,2,34,66,2,63,138,1,67,2,26,67,2,63,145,1,69,2,14,69,2,63,155,
+  1,78,2,63,176,105,63,240,97,80,2,63,153,1,69,2,16,69,2,63,143,1,67,2,
+  28,67,2,63,136,1,66,2,36,66,2,63,130,1,66,2,42,66,2,63,125,129,34,16,
+  95,0,129,34,63,120,66,2,12,103,0,66,2,63,115,129,34,11,110,0,129,34,63,112,
+  128,2,10,115,0,128,2,63,109,129,34,8,119,0,129,34,63,105,129,34,8,123,0,129,
+  34,63,102,128,2,8,127,0,0,128,2,63,99,129,34,7,127,3,0,129,34,63,96,128,
+  2,7,127,7,0,128,2,63,94,128,2,6,127,10,0,128,2,63,91,129,34,6,127,12,
+  0,129,34,63,88,128,2,6,127,16,0,128,2,63,86,128,2,6,127,18,0,128,2,63,
+  84,128,2,6,127,20,0,128,2,63,82,128,2,5,127,23,0,128,2,63,80,128,2,5,
+  127,25,0,128,2,63,78,128,2,5,127,27,0,128,2,63,76,128,2,5,127,29,0,128,
+  2,63,74,128,2,5,127,31,0,128,2,63,72,128,2,5,127,33,0,128,2,63,70,128,
+  2,5,127,35,0,128,2,63,69,128,2,4,127,36,0,128,2,63,68,128,2,4,127,38,
+  0,128,2,63,66,128,2,4,127,40,0,128,2,63,64,128,2,5,127,41,0,128,2,63,
+  63,128,2,4,127,42,0,128,2,63,62,128,2,4,127,44,0,128,2,63,60,128,2,4,
+  127,46,0,128,2,63,59,128,2,4,127,46,0,128,2,63,58,128,2,4,127,48,0,128,
+  2,63,57,128,2,3,127,49,0,128,2,63,56,128,2,4,127,50,0,128,2,63,54,128,
+  2,4,127,52,0,128,2,63,53,128,2,4,127,52,0,128,2,63,52,128,2,4,127,54,
+  0,128,2,63,51,128,2,4,127,54,0,128,2,63,51,128,2,3,127,55,0,128,2,63,
+  50,128,2,4,127,56,0,128,2,63,49,128,2,3,127,57,0,128,2,63,48,128,2,4,
+  127,58,0,128,2,63,47,128,2,3,127,59,0,128,2,63,47,128,2,3,127,59,0,128,
+  2,63,46,128,2,4,127,60,0,128,2,63,45,128,2,3,127,61,0,128,2,63,45,128,
+  2,3,127,61,0,128,2,63,44,128,2,4,127,62,0,128,2,63,43,128,2,3,127,63,
+  0,128,2,63,43,128,2,3,127,63,0,128,2,63,43,128,2,3,127,63,0,128,2,63,
+  42,128,2,4,127,64,0,128,2,63,41,128,2,3,127,65,0,128,2,63,41,128,2,3,
+  127,65,0,128,2,63,41,128,2,3,127,65,0,128,2,63,41,128,2,3,127,65,0,128,
+  2,63,41,128,2,3,127,65,0,128,2,63,40,128,2,4,127,66,0,128,2,63,39,128,
+  2,3,127,67,0,128,2,63,39,128,2,3,127,67,0,128,2,63,39,128,2,3,124,0,
+  63,1,68,0,128,2,63,39,128,2,3,123,0,63,2,68,0,128,2,63,39,128,2,3,
+  122,0,63,3,68,0,128,2,63,39,128,2,3,121,0,63,4,68,0,128,2,63,39,128,
+  2,3,121,0,63,4,68,0,128,2,63,39,128,2,3,121,0,63,4,68,0,128,2,63,
+  39,128,2,3,121,0,63,4,68,0,128,2,63,39,128,2,3,121,0,63,4,68,0,128,
+  2,63,39,128,2,3,122,0,63,3,68,0,128,2,63,39,128,2,3,123,0,63,2,68,
+  0,128,2,63,39,128,2,3,124,0,63,1,68,0,128,2,63,39,128,2,3,127,67,0,
+  128,2,63,39,128,2,3,127,67,0,128,2,63,39,128,2,4,127,66,0,128,2,63,40,
+  128,2,3,127,65,0,128,2,63,41,128,2,3,127,65,0,128,2,63,41,128,2,3,127,
+  65,0,128,2,63,41,128,2,3,127,65,0,128,2,63,41,128,2,3,127,65,0,128,2,
+  63,41,128,2,4,127,64,0,128,2,63,42,128,2,3,127,63,0,128,2,63,43,128,2,
+  3,127,63,0,128,2,63,43,128,2,3,127,63,0,128,2,63,43,128,2,4,127,62,0,
+  128,2,63,44,128,2,3,127,61,0,128,2,63,45,128,2,3,127,61,0,128,2,63,45,
+  128,2,4,127,60,0,128,2,63,46,128,2,3,127,59,0,128,2,63,47,128,2,3,127,
+  59,0,128,2,63,47,128,2,4,127,58,0,128,2,63,48,128,2,3,127,57,0,128,2,
+  63,49,128,2,4,127,56,0,128,2,63,50,128,2,3,127,55,0,128,2,63,51,128,2,
+  4,127,54,0,128,2,63,51,128,2,4,127,54,0,128,2,63,52,128,2,4,127,52,0,
+  128,2,63,53,128,2,4,127,52,0,128,2,63,54,128,2,4,127,50,0,128,2,63,56,
+  128,2,3,127,49,0,128,2,63,57,128,2,4,127,48,0,128,2,63,58,128,2,4,127,
+  46,0,128,2,63,59,128,2,4,127,46,0,128,2,63,60,128,2,4,127,44,0,128,2,
+  63,62,128,2,4,127,42,0,128,2,63,63,128,2,5,127,41,0,128,2,63,64,128,2,
+  4,127,40,0,128,2,63,66,128,2,4,127,38,0,128,2,63,68,128,2,4,127,36,0,
+  128,2,63,69,128,2,5,127,35,0,128,2,63,70,128,2,5,127,33,0,128,2,63,72,
+  128,2,5,127,31,0,128,2,63,74,128,2,5,127,29,0,128,2,63,76,128,2,5,127,
+  27,0,128,2,63,78,128,2,5,127,25,0,128,2,63,80,128,2,5,127,23,0,128,2,
+  63,82,128,2,6,127,20,0,128,2,63,84,128,2,6,127,18,0,128,2,63,86,128,2,
+  6,127,16,0,128,2,63,88,129,34,6,127,12,0,129,34,63,91,128,2,6,127,10,0,
+  128,2,63,94,128,2,7,127,7,0,128,2,63,96,129,34,7,127,3,0,129,34,63,99,
+  128,2,8,127,0,0,128,2,63,102,129,34,8,123,0,129,34,63,105,129,34,8,119,0,
+  129,34,63,109,128,2,10,115,0,128,2,63,112,129,34,11,110,0,129,34,63,115,66,2,
+  12,103,0,66,2,63,120,129,34,16,95,0,129,34,63,125,66,2,42,66,2,63,130,1,
+  66,2,36,66,2,63,136,1,67,2,28,67,2,63,143,1,69,2,16,69,2,63,153,1,
+  80,2,63,255,95,63,208,86,80,2,63,153,1,69,2,16,69,2,63,142,1,68,2,28,
+  68,2,63,134,1,66,2,38,66,2,63,128,1,66,2,44,66,2,63,123,129,34,50,129,
+  34,63,118,66,2,18,99,0,66,2,63,113,129,34,15,108,0,129,34,63,109,129,34,13,
+  114,0,129,34,63,105,129,34,12,119,0,129,34,63,102,128,2,11,124,0,128,2,63,99,
+  129,34,10,127,0,0,129,34,63,95,129,34,9,127,5,0,129,34,63,92,128,2,9,127,
+  9,0,128,2,63,90,128,2,9,127,11,0,128,2,63,87,129,34,8,127,14,0,129,34,
+  63,84,128,2,8,127,18,0,128,2,63,82,128,2,8,127,20,0,128,2,63,80,128,2,
+  7,127,23,0,128,2,63,77,129,34,7,127,25,0,129,34,63,74,128,2,8,127,28,0,
+  128,2,63,72,128,2,7,127,31,0,128,2,63,70,128,2,7,127,33,0,128,2,63,68,
+  128,2,7,127,35,0,128,2,63,66,128,2,7,127,37,0,128,2,63,65,128,2,6,127,
+  38,0,128,2,63,64,128,2,6,127,40,0,128,2,63,62,128,2,6,127,42,0,128,2,
+  63,60,128,2,6,127,44,0,128,2,63,58,128,2,6,127,46,0,128,2,63,57,128,2,
+  5,127,47,0,128,2,63,56,128,2,5,127,49,0,128,2,63,54,128,2,6,127,50,0,
+  128,2,63,52,128,2,6,127,52,0,128,2,63,51,128,2,5,127,53,0,128,2,63,50,
+  128,2,5,127,55,0,128,2,63,49,128,2,5,127,55,0,128,2,63,48,128,2,5,127,
+  57,0,128,2,63,46,128,2,5,127,59,0,128,2,63,45,128,2,5,127,59,0,128,2,
+  63,44,128,2,5,127,61,0,128,2,63,43,128,2,5,127,61,0,128,2,63,42,128,2,
+  5,127,63,0,128,2,63,41,128,2,4,127,64,0,128,2,63,40,128,2,5,127,65,0,
+  128,2,63,39,128,2,4,127,66,0,128,2,63,39,128,2,4,127,66,0,128,2,63,38,
+  128,2,5,127,67,0,128,2,63,37,128,2,4,127,68,0,128,2,63,36,128,2,5,127,
+  69,0,128,2,63,35,128,2,4,127,70,0,128,2,63,35,128,2,4,127,70,0,128,2,
+  63,34,128,2,5,127,71,0,128,2,63,33,128,2,4,127,72,0,128,2,63,33,128,2,
+  4,127,72,0,128,2,63,32,128,2,5,127,73,0,128,2,63,31,128,2,4,127,74,0,
+  128,2,63,31,128,2,4,127,74,0,128,2,63,31,128,2,4,127,74,0,128,2,63,31,
+  128,2,4,127,74,0,128,2,63,30,128,2,4,127,76,0,128,2,63,29,128,2,4,127,
+  76,0,128,2,63,29,128,2,4,127,76,0,128,2,63,29,128,2,4,127,76,0,128,2,
+  63,29,128,2,4,127,76,0,128,2,63,29,128,2,4,127,76,0,128,2,63,28,128,2,
+  4,127,78,0,128,2,63,27,128,2,4,127,78,0,128,2,63,27,128,2,4,127,78,0,
+  128,2,63,27,128,2,4,127,2,0,63,6,69,0,128,2,63,27,128,2,4,127,1,0,
+  63,7,69,0,128,2,63,27,128,2,4,127,0,0,63,8,69,0,128,2,63,27,128,2,
+  4,126,0,63,9,69,0,128,2,63,27,128,2,4,126,0,63,9,69,0,128,2,63,27,
+  128,2,4,126,0,63,9,69,0,128,2,63,27,128,2,4,126,0,63,9,69,0,128,2,
+  63,27,128,2,4,126,0,63,9,69,0,128,2,63,27,128,2,4,127,0,0,63,8,69,
+  0,128,2,63,27,128,2,4,127,1,0,63,7,69,0,128,2,63,27,128,2,4,127,2,
+  0,63,6,69,0,128,2,63,27,128,2,4,127,78,0,128,2,63,27,128,2,4,127,78,
+  0,128,2,63,27,128,2,4,127,78,0,128,2,63,28,128,2,4,127,76,0,128,2,63,
+  29,128,2,4,127,76,0,128,2,63,29,128,2,4,127,76,0,128,2,63,29,128,2,4,
+  127,76,0,128,2,63,29,128,2,4,127,76,0,128,2,63,29,128,2,4,127,76,0,128,
+  2,63,30,128,2,4,127,74,0,128,2,63,31,128,2,4,127,74,0,128,2,63,31,128,
+  2,4,127,74,0,128,2,63,31,128,2,4,127,74,0,128,2,63,31,128,2,5,127,73,
+  0,128,2,63,32,128,2,4,127,72,0,128,2,63,33,128,2,4,127,72,0,128,2,63,
+  33,128,2,5,127,71,0,128,2,63,34,128,2,4,127,70,0,128,2,63,35,128,2,4,
+  127,70,0,128,2,63,35,128,2,5,127,69,0,128,2,63,36,128,2,4,127,68,0,128,
+  2,63,37,128,2,5,127,67,0,128,2,63,38,128,2,4,127,66,0,128,2,63,39,128,
+  2,4,127,66,0,128,2,63,39,128,2,5,127,65,0,128,2,63,40,128,2,4,127,64,
+  0,128,2,63,41,128,2,5,127,63,0,128,2,63,42,128,2,5,127,61,0,128,2,63,
+  43,128,2,5,127,61,0,128,2,63,44,128,2,5,127,59,0,128,2,63,45,128,2,5,
+  127,59,0,128,2,63,46,128,2,5,127,57,0,128,2,63,48,128,2,5,127,55,0,128,
+  2,63,49,128,2,5,127,55,0,128,2,63,50,128,2,5,127,53,0,128,2,63,51,128,
+  2,6,127,52,0,128,2,63,52,128,2,6,127,50,0,128,2,63,54,128,2,5,127,49,
+  0,128,2,63,56,128,2,5,127,47,0,128,2,63,57,128,2,6,127,46,0,128,2,63,
+  58,128,2,6,127,44,0,128,2,63,60,128,2,6,127,42,0,128,2,63,62,128,2,6,
+  127,40,0,128,2,63,64,128,2,6,127,38,0,128,2,63,65,128,2,7,127,37,0,128,
+  2,63,66,128,2,7,127,35,0,128,2,63,68,128,2,7,127,33,0,128,2,63,70,128,
+  2,7,127,31,0,128,2,63,72,128,2,8,127,28,0,128,2,63,74,129,34,7,127,25,
+  0,129,34,63,77,128,2,7,127,23,0,128,2,63,80,128,2,8,127,20,0,128,2,63,
+  82,128,2,8,127,18,0,128,2,63,84,129,34,8,127,14,0,129,34,63,87,128,2,9,
+  127,11,0,128,2,63,90,128,2,9,127,9,0,128,2,63,92,129,34,9,127,5,0,129,
+  34,63,95,129,34,10,127,0,0,129,34,63,99,128,2,11,124,0,128,2,63,102,129,34,
+  12,119,0,129,34,63,105,129,34,13,114,0,129,34,63,109,129,34,15,108,0,129,34,63,
+  113,66,2,18,99,0,66,2,63,118,129,34,50,129,34,63,123,66,2,44,66,2,63,128,
+  1,66,2,38,66,2,63,134,1,68,2,28,68,2,63,142,1,69,2,16,69,2,63,153,
+  1,80,2,63,223,84,63,192,73,80,1,63,152,1,94,1,63,141,1,74,1,23,67,1,
+  63,133,1,71,1,34,67,1,63,126,70,1,42,66,1,63,120,69,1,49,66,1,63,115,
+  68,1,55,129,17,63,110,68,1,20,101,0,1,66,1,63,105,129,17,19,109,0,2,129,
+  17,63,101,129,17,16,116,0,2,129,17,63,98,128,1,15,121,0,2,128,1,63,95,67,
+  1,11,126,0,1,129,17,63,91,67,1,11,127,3,0,1,129,17,63,88,128,1,12,127,
+  8,0,1,128,1,63,85,67,1,9,127,11,0,1,129,17,63,82,128,1,11,127,15,0,
+  1,128,1,63,80,66,1,8,127,18,0,1,128,1,63,77,66,1,9,127,21,0,0,129,
+  17,63,74,128,1,10,127,24,0,1,128,1,63,72,66,1,7,127,27,0,1,128,1,63,
+  70,128,1,9,127,30,0,0,128,1,63,68,128,1,9,127,32,0,0,128,1,63,65,66,
+  1,7,127,35,0,0,129,17,63,62,128,1,9,127,37,0,1,128,1,63,60,128,1,9,
+  127,39,0,1,128,1,63,58,128,1,9,127,41,0,1,128,1,63,57,128,1,7,127,44,
+  0,0,128,1,63,56,128,1,7,127,46,0,0,128,1,63,54,128,1,7,127,48,0,0,
+  128,1,63,52,128,1,7,127,50,0,0,128,1,63,50,128,1,7,127,52,0,0,128,1,
+  63,48,128,1,7,127,53,0,1,128,1,63,47,128,1,7,127,54,0,0,128,1,63,46,
+  128,1,7,127,56,0,0,128,1,63,44,128,1,7,127,58,0,0,128,1,63,42,128,1,
+  7,127,59,0,1,128,1,63,41,128,1,6,127,61,0,0,128,1,63,40,128,1,7,127,
+  62,0,0,128,1,63,38,128,1,7,127,63,0,1,128,1,63,37,128,1,6,127,65,0,
+  0,128,1,63,36,128,1,6,127,67,0,0,128,1,63,35,128,1,6,127,67,0,0,128,
+  1,63,34,128,1,6,127,69,0,0,128,1,63,32,128,1,7,127,69,0,1,128,1,63,
+  31,128,1,6,127,71,0,0,128,1,63,30,128,1,6,127,72,0,1,128,1,63,29,128,
+  1,6,127,73,0,0,128,1,63,28,128,1,6,127,74,0,1,128,1,63,27,128,1,6,
+  127,75,0,0,128,1,63,27,128,1,5,127,76,0,0,128,1,63,26,128,1,6,127,77,
+  0,0,128,1,63,25,128,1,5,127,78,0,0,128,1,63,24,128,1,6,127,79,0,0,
+  128,1,63,23,128,1,6,127,79,0,0,128,1,63,23,128,1,5,127,80,0,0,128,1,
+  63,22,128,1,6,127,81,0,0,128,1,63,21,128,1,5,127,82,0,0,128,1,63,21,
+  128,1,5,127,82,0,0,128,1,63,20,128,1,6,127,83,0,0,128,1,63,19,128,1,
+  5,127,84,0,0,128,1,63,19,128,1,5,127,84,0,0,128,1,63,19,128,1,5,127,
+  84,0,0,128,1,63,18,128,1,5,127,86,0,0,128,1,63,17,128,1,5,127,86,0,
+  0,128,1,63,17,128,1,5,127,86,0,0,128,1,63,17,128,1,5,127,86,0,0,128,
+  1,63,16,128,1,6,127,87,0,0,128,1,63,15,128,1,5,127,88,0,0,128,1,63,
+  15,128,1,5,127,88,0,0,128,1,63,15,128,1,5,127,88,0,0,128,1,63,15,128,
+  1,5,127,88,0,0,128,1,63,15,128,1,5,127,88,0,0,128,1,63,15,128,1,5,
+  127,88,0,0,128,1,63,14,128,1,5,127,90,0,0,128,1,63,13,128,1,5,127,90,
+  0,0,128,1,63,13,128,1,5,127,90,0,0,128,1,63,13,128,1,5,127,8,0,68,
+  4,63,7,69,0,0,128,1,63,13,128,1,5,127,7,0,70,4,63,6,69,0,0,128,
+  1,63,13,128,1,5,127,6,0,72,4,63,5,69,0,0,128,1,63,13,128,1,5,127,
+  5,0,74,4,63,4,69,0,0,128,1,63,13,128,1,5,127,5,0,74,4,63,4,69,
+  0,0,128,1,63,13,128,1,5,127,5,0,74,4,63,4,69,0,0,128,1,63,13,128,
+  1,5,127,5,0,74,4,63,4,69,0,0,128,1,63,13,128,1,5,127,5,0,74,4,
+  63,4,69,0,0,128,1,63,13,128,1,5,127,6,0,72,4,63,5,69,0,0,128,1,
+  63,13,128,1,5,127,7,0,70,4,63,6,69,0,0,128,1,63,13,128,1,5,127,8,
+  0,68,4,63,7,69,0,0,128,1,63,13,128,1,5,127,90,0,0,128,1,63,13,128,
+  1,5,127,90,0,0,128,1,63,13,128,1,5,127,90,0,0,128,1,63,14,128,1,5,
+  127,88,0,0,128,1,63,15,128,1,5,127,88,0,0,128,1,63,15,128,1,5,127,88,
+  0,0,128,1,63,15,128,1,5,127,88,0,0,128,1,63,15,128,1,5,127,88,0,0,
+  128,1,63,15,128,1,5,127,88,0,0,128,1,63,15,128,1,6,127,87,0,0,128,1,
+  63,16,128,1,5,127,86,0,0,128,1,63,17,128,1,5,127,86,0,0,128,1,63,17,
+  128,1,5,127,86,0,0,128,1,63,17,128,1,5,127,86,0,0,128,1,63,18,128,1,
+  5,127,84,0,0,128,1,63,19,128,1,5,127,84,0,0,128,1,63,19,128,1,5,127,
+  84,0,0,128,1,63,19,128,1,6,127,83,0,0,128,1,63,20,128,1,5,127,82,0,
+  0,128,1,63,21,128,1,5,127,82,0,0,128,1,63,21,128,1,6,127,81,0,0,128,
+  1,63,22,128,1,5,127,80,0,0,128,1,63,23,128,1,6,127,79,0,0,128,1,63,
+  23,128,1,6,127,79,0,0,128,1,63,24,128,1,5,127,78,0,0,128,1,63,25,128,
+  1,6,127,77,0,0,128,1,63,26,128,1,5,127,76,0,0,128,1,63,27,128,1,6,
+  127,75,0,0,128,1,63,27,128,1,6,127,74,0,1,128,1,63,28,128,1,6,127,73,
+  0,0,128,1,63,29,128,1,6,127,72,0,1,128,1,63,30,128,1,6,127,71,0,0,
+  128,1,63,31,128,1,7,127,69,0,1,128,1,63,32,128,1,6,127,69,0,0,128,1,
+  63,34,128,1,6,127,67,0,0,128,1,63,35,128,1,6,127,67,0,0,128,1,63,36,
+  128,1,6,127,65,0,0,128,1,63,37,128,1,7,127,63,0,1,128,1,63,38,128,1,
+  7,127,62,0,0,128,1,63,40,128,1,6,127,61,0,0,128,1,63,41,128,1,7,127,
+  59,0,1,128,1,63,42,128,1,7,127,58,0,0,128,1,63,44,128,1,7,127,56,0,
+  0,128,1,63,46,128,1,7,127,54,0,0,128,1,63,47,128,1,7,127,53,0,1,128,
+  1,63,48,128,1,7,127,52,0,0,128,1,63,50,128,1,7,127,50,0,0,128,1,63,
+  52,128,1,7,127,48,0,0,128,1,63,54,128,1,7,127,46,0,0,128,1,63,56,128,
+  1,7,127,44,0,0,128,1,63,57,128,1,9,127,41,0,1,128,1,63,58,128,1,9,
+  127,39,0,1,128,1,63,60,128,1,9,127,37,0,1,128,1,63,62,66,1,7,127,35,
+  0,0,129,17,63,65,128,1,9,127,32,0,0,128,1,63,68,128,1,9,127,30,0,0,
+  128,1,63,70,66,1,7,127,27,0,1,128,1,63,72,128,1,10,127,24,0,1,128,1,
+  63,74,66,1,9,127,21,0,0,129,17,63,77,66,1,8,127,18,0,1,128,1,63,80,
+  128,1,11,127,15,0,1,128,1,63,82,67,1,9,127,11,0,1,129,17,63,85,128,1,
+  12,127,8,0,1,128,1,63,88,67,1,11,127,3,0,1,129,17,63,91,67,1,11,126,
+  0,1,129,17,63,95,128,1,15,121,0,2,128,1,63,98,129,17,16,116,0,2,129,17,
+  63,101,129,17,19,109,0,2,129,17,63,105,68,1,20,101,0,1,66,1,63,110,68,1,
+  55,129,17,63,115,69,1,49,66,1,63,120,70,1,42,66,1,63,126,71,1,34,67,1,
+  63,133,1,74,1,23,67,1,63,141,1,94,1,63,152,1,80,1,63,207,71,
+};
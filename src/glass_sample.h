@@ -0,0 +1,984 @@
+// 自動生成ファイル: tools/glass_sample_gen.cpp が出力。手で編集しないこと。
+#pragma once
+
+#include "SampleVoice.h"
+
+#include <stdint.h>
+
+const int GLASS_SAMPLE_LENGTH = 15434;
+const float GLASS_SAMPLE_PITCH = 4500.0f;
+
+// 前後に RESAMPLE_PAD 個の 0
+const int16_t GLASS_SAMPLE_DATA[15498] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  401, 14418, 15261, 9110, 3231, 6001, -4957, -18291, -17261, -6817, 7173, 7005, 9022, 17874, 15027, -6153,
+  -22937, -10915, -8397, -1946, -5710, 13037, 19754, 16044, -3259, -5832, -6188, -12804, -16871, -5950, 10283, 18943,
+  7047, 6455, 3684, 1715, -16470, -19064, -11047, 4483, 8862, 6288, 15823, 12702, 5936, -15678, -19970, -4829,
+  -5468, -4738, 3520, 18630, 19924, 4153, -6586, -9569, -7205, -15939, -12029, 2573, 16808, 17999, 4022, 4655,
+  509, -6144, -21295, -15865, 152, 9476, 9044, 7374, 15977, 8445, -6739, -18733, -13922, -3684, -4020, 1667,
+  10678, 21692, 11624, -4249, -9683, -9339, -9039, -15734, -3711, 11486, 19277, 11043, 1960, 3400, -4727, -14081,
+  -20935, -6572, 7556, 9766, 9498, 10152, 14113, -1297, -14964, -18181, -8208, -869, -2116, 8073, 16428, 18578,
+  1714, -9862, -9641, -9910, -10722, -11376, 6348, 17177, 16162, 5588, -39, 322, -11434, -17554, -15108, 2831,
+  11283, 9381, 10430, 10543, 7723, -10999, -18058, -13546, -3307, 948, 1951, 14448, 17343, 10889, -6760, -11944,
+  -9140, -10871, -9469, -3457, 14870, 17687, 10650, 1381, -2024, -4556, -16774, -15827, -6325, 9890, 12033, 8981,
+  11013, 7475, -1045, -17692, -16261, -7739, 257, 3370, 7256, 18146, 13182, 1804, -12162, -11742, -8876, -10653,
+  -4666, 5389, 19331, 14044, 4993, -1726, -5004, -9764, -18408, -9687, 2351, 13619, 11233, 8723, 9650, 1257,
+  -9216, -19786, -11320, -2502, 3148, 6846, 11796, 17536, 5681, -5912, -14376, -10604, -8378, -7955, 2457, 12252,
+  19173, 8345, 274, -4612, -8738, -13114, -15633, -1505, 8758, 14576, 9881, 7695, 5625, -6151, -14328, -17680,
+  -5319, 1734, 6142, 10470, 13568, 12899, -2536, -10863, -14351, -9026, -6572, -2816, 9520, 15394, 15533, 2370,
+  -3583, -7692, -11828, -13112, -9599, 6212, 12271, 13793, 7965, 4975, -251, -12315, -15499, -12948, 439, 5316,
+  9153, 12627, 11807, 6011, -9374, -13058, -12944, -6621, -2952, 3319, 14379, 14767, 10106, -3092, -6933, -10375,
+  -12754, -9802, -2391, 11955, 13306, 11800, 4944, 630, -6148, -15645, -13357, -7134, 5587, 8383, 11203, 12181,
+  7297, -1061, -13947, -13069, -10333, -2942, 1810, 8542, 16133, 11427, 4114, -7912, -9567, -11516, -10964, -4508,
+  4210, 15370, 12371, 8517, 690, -4166, -10379, -15922, -9111, -1094, 10021, 10364, 11251, 9233, 1631, -6982,
+  -16248, -11202, -6355, 1677, 6252, 11616, 15120, 6506, -1883, -11825, -10658, -10421, -7155, 1184, 9349, 16585,
+  9546, 3908, -3985, -7928, -12278, -13830, -3672, 4757, 13206, 10371, 9114, 4903, -3845, -11302, -16358, -7398,
+  -1294, 6050, 9127, 12436, 12132, 655, -7433, -14033, -9492, -7474, -2622, 6309, 12820, 15524, 4797, -1314,
+  -7719, -9851, -12174, -10068, 2495, 9776, 14193, 8082, 5671, 407, -8564, -13861, -14040, -1842, 3715, 8895,
+  10161, 11562, 7656, -5697, -11619, -13626, -6277, -3865, 1704, 10602, 14351, 11890, -1302, -5712, -9554, -10156,
+  -10633, -4900, 8822, 12793, 12347, 4264, 2178, -3719, -12394, -14192, -9114, 4414, 7147, 9754, 9932, 9378,
+  1825, -11693, -13156, -10457, -2247, -666, 5674, 13872, 13292, 5823, -7245, -7934, -9610, -9557, -7756, 1501,
+  14094, 12628, 8138, 410, -680, -7598, -14919, -11588, -2211, 9553, 8078, 9270, 9046, 5714, -4948, -15800,
+  -11219, -5629, 1117, 1928, 9487, 15390, 9086, -1462, -11145, -7672, -8876, -8358, -3219, 8319, 16616, 9039,
+  3188, -2282, -3175, -11279, -15131, -5875, 4893, 11910, 6885, 8529, 7400, 291, -11364, -16409, -6300, -1053,
+  3122, 4511, 12848, 14015, 2145, -7782, -11845, -5925, -8263, -6056, 2974, 13805, 15150, 3282, -604, -3746,
+  -5989, -14016, -11982, 1826, 9877, 11056, 4998, 8031, 4225, -6395, -15383, -12925, -303, 1703, 4310, 7589,
+  14578, 9070, -5702, -11012, -9742, -4267, -7716, -1854, 9713, 15899, 9940, -2339, -2272, -4975, -9211, -14340,
+  -5426, 9130, 11141, 8162, 3814, 7158, -1025, -12623, -15252, -6495, 4403, 2433, 5867, 10678, 13167, 1310,
+  -11788, -10345, -6586, -3627, -6187, 4283, 14813, 13474, 2945, -5752, -2380, -7038, -11758, -11018, 2936, 13441,
+  8822, 5249, 3598, 4673, -7691, -16013, -10727, 350, 6368, 2331, 8444, 12211, 7970, -6927, -13972, -6852,
+  -4309, -3551, -2565, 10948, 16046, 7293, -3080, -6351, -2488, -9946, -11830, -4226, 10290, 13404, 4755, 3816,
+  3273, -87, -13715, -14860, -3536, 5030, 5899, 2985, 11326, 10489, 97, -12715, -11896, -2832, -3709, -2568,
+  3117, 15674, 12547, -148, -6112, -5263, -3858, -12323, -8179, 4035, 14005, 9717, 1318, 3831, 1301, -6264,
+  -16573, -9335, 3391, 6371, 4698, 5037, 12684, 5019, -7770, -14102, -7203, -345, -3960, 566, 9204, 16274,
+  5559, -5904, -5970, -4415, -6350, -12212, -1256, 10746, 13098, 4696, -77, 3863, -2955, -11596, -14781, -1615,
+  7516, 5155, 4538, 7556, 10809, -2770, -12693, -11213, -2499, 52, -3341, 5676, 13142, 12242, -2097, -8195,
+  -4206, -5079, -8389, -8503, 6670, 13469, 8760, 820, 229, 2272, -8452, -13631, -8928, 5234, 8039, 3385,
+  5941, 8609, 5453, -10061, -13080, -6091, 246, -529, -644, 10962, 12978, 5200, -7551, -7256, -2888, -6935,
+  -8050, -1926, 12623, 11670, 3543, -727, 616, -1441, -12892, -11241, -1448, 8932, 6113, 2811, 7821, 6655,
+  -1734, -14144, -9499, -1385, 758, -311, 3781, 13990, 8607, -1957, -9398, -4888, -3142, -8352, -4488, 5161,
+  14546, 6888, -212, -541, -478, -6107, -14101, -5369, 4724, 9089, 3820, 3764, 8326, 1732, -8022, -13890,
+  -4176, 1200, 304, 1733, 8127, 13200, 1876, -6669, -8226, -3071, -4492, -7624, 1345, 10062, 12357, 1660,
+  -1636, -250, -3338, -9580, -11386, 1516, 7734, 7069, 2704, 5109, 6231, -4427, -11138, -10211, 441, 1666,
+  518, 5096, 10278, 8868, -4500, -7983, -5863, -2683, -5411, -4243, 7202, 11236, 7756, -2009, -1480, -1162,
+  -6770, -10133, -5929, 6854, 7571, 4805, 2890, 5251, 1848, -9408, -10454, -5280, 3034, 1269, 2140, 8124,
+  9171, 2877, -8460, -6709, -4009, -3161, -4564, 710, 10872, 8986, 3020, -3591, -1189, -3332, -8970, -7520,
+  0, 9315, 5619, 3503, 3326, 3380, -3169, -11524, -7074, -1130, 3814, 1328, 4568, 9193, 5386, -2474,
+  -9505, -4492, -3237, -3244, -1809, 5296, 11398, 4968, -325, -3856, -1699, -5664, -8773, -3011, 4403, 9178,
+  3464, 3110, 2833, 23, -6918, -10616, -2885, 1362, 3852, 2245, 6459, 7775, 635, -5737, -8506, -2599,
+  -3000, -2086, 1781, 7945, 9353, 985, -2056, -3895, -2859, -6849, -6337, 1543, 6508, 7651, 1896, 2801,
+  1061, -3419, -8373, -7800, 646, 2507, 4019, 3416, 6797, 4634, -3386, -6805, -6732, -1305, -2446, 127,
+  4751, 8271, 6133, -1988, -2811, -4202, -3804, -6339, -2845, 4832, 6743, 5818, 759, 1922, -1345, -5700,
+  -7756, -4483, 3072, 3033, 4383, 3950, 5566, 1119, -5885, -6434, -4927, -194, -1271, 2464, 6254, 6961,
+  2925, -3951, -3198, -4485, -3836, -4600, 441, 6596, 5962, 4039, -419, 571, -3392, -6461, -6006, -1483,
+  4675, 3288, 4446, 3496, 3564, -1793, -7033, -5367, -3122, 1070, 83, 4088, 6404, 4973, 146, -5267,
+  -3256, -4235, -3009, -2552, 2944, 7260, 4655, 2156, -1708, -611, -4566, -6172, -3902, 1112, 5719, 3052,
+  3869, 2469, 1617, -3935, -7311, -3805, -1147, 2254, 968, 4881, 5834, 2791, -2306, -5986, -2646, -3411,
+  -1963, -760, 4813, 7185, 2794, 146, -2627, -1158, -5112, -5424, -1614, 3421, 6010, 2043, 2954, 1543,
+  -59, -5608, -6846, -1620, 764, 2769, 1236, 5331, 4930, 342, -4403, -5733, -1302, -2597, -1213, 902,
+  6315, 6245, 321, -1480, -2666, -1291, -5580, -4302, 1027, 5170, 5131, 521, 2420, 925, -1824, -6884,
+  -5337, 1023, 1901, 2360, 1428, 5854, 3473, -2456, -5621, -4227, 169, -2457, -590, 2851, 7231, 4110,
+  -2286, -1962, -1948, -1732, -6092, -2385, 3859, 5668, 3102, -638, 2681, 102, -3957, -7254, -2605, 3323,
+  1652, 1566, 2247, 6194, 1014, -5111, -5258, -1892, 784, -3003, 631, 5060, 6863, 920, -3996, -1029,
+  -1361, -2954, -6035, 608, 6061, 4403, 768, -561, 3287, -1660, -6032, -6006, 793, 4202, 218, 1460,
+  3765, 5504, -2386, -6570, -3183, 95, -3, -3372, 2971, 6717, 4695, -2347, -3904, 606, -1937, -4535,
+  -4527, 4166, 6535, 1748, -548, 801, 3110, -4476, -6961, -3017, 3553, 3144, -1246, 2790, 5087, 3101,
+  -5754, -5923, -301, 508, -1663, -2401, 6021, 6653, 1129, -4255, -2050, 1523, -3933, -5246, -1302, 6956,
+  4785, -940, 27, 2382, 1217, -7405, -5749, 759, 4363, 816, -1311, 5202, 4873, -717, -7607, -3257,
+  1774, -964, -2751, 378, 8420, 4291, -2413, -3878, 324, 566, -6383, -3902, 2741, 7608, 1546, -2060,
+  2126, 2606, -2235, -8883, -2414, 3624, 2896, -1142, 657, 7244, 2361, -4532, -6951, 102, 1744, -3281,
+  -1859, 4136, 8678, 323, -4237, -1602, 1451, -2207, -7580, -373, 5866, 5729, -1443, -876, 4177, 519,
+  -5831, -7780, 1730, 4188, 238, -1145, 3860, 7254, -1860, -6572, -4122, 2276, -394, -4590, 1300, 7076,
+  6268, -3490, -3517, 932, 223, -5352, -6220, 4079, 6569, 2375, -2482, 1838, 4363, -3392, -7683, -4313,
+  4745, 2366, -1672, 1207, 6425, 4543, -6021, -5879, -753, 2049, -3184, -3437, 5497, 7548, 2156, -5358,
+  -958, 1814, -2943, -6870, -2387, 7454, 4629, -498, -1073, 4166, 1867, -7334, -6673, -68, 5297, -441,
+  -1287, 4718, 6567, -8, -8220, -3027, 1200, -254, -4570, 188, 8656, 5168, -1698, -4638, 1566, 139,
+  -6248, -5505, 2363, 8261, 1331, -1269, 1673, 4267, -2486, -9284, -3231, 2946, 3554, -2201, 1480, 7276,
+  3784, -4409, -7628, 197, 734, -2907, -3238, 4740, 9138, 1115, -3568, -2282, 2213, -3332, -7614, -1600,
+  5928, 6470, -1337, 272, 3705, 1582, -6672, -8251, 913, 3564, 1084, -1579, 5138, 7175, -792, -6788,
+  -5003, 1946, -1535, -3882, 509, 8046, 6755, -2619, -3038, -199, 386, -6621, -5984, 3113, 6957, 3475,
+  -1982, 2797, 3355, -2775, -8714, -4857, 3840, 2170, -199, 1184, 7548, 4171, -5113, -6507, -2119, 1509,
+  -3800, -2152, 4935, 8627, 2804, -4502, -1187, 26, -2885, -7774, -1946, 6603, 5591, 1112, -678, 4335,
+  402, -6729, -7842, -834, 4634, 320, 696, 4452, 7252, -438, -7482, -4414, -551, -299, -4269, 1685,
+  7961, 6500, -855, -4346, 243, -1849, -5640, -6041, 2729, 7744, 3187, 439, 1190, 3570, -3855, -8519,
+  -4801, 2139, 3808, -383, 3242, 6269, 4290, -4709, -7469, -2095, -691, -1788, -2305, 5857, 8388, 2960,
+  -2981, -3211, 70, -4645, -6240, -2203, 6233, 6799, 1263, 1156, 1943, 625, -7474, -7640, -1175, 3420,
+  2728, 637, 5834, 5554, 7, -7231, -5900, -739, -1653, -1584, 1267, 8559, 6411, -409, -3561, -2485,
+  -1604, -6623, -4295, 2086, 7716, 4934, 495, 2002, 731, -3147, -9043, -4872, 1708, 3536, 2537, 2656,
+  6891, 2612, -3911, -7762, -4022, -441, -2065, 521, 4813, 8939, 3192, -2710, -3481, -2863, -3604, -6600,
+  -688, 5364, 7477, 3233, 452, 1766, -2019, -6109, -8323, -1513, 3457, 3495, 3380, 4287, 5787, -1296,
+  -6408, -6977, -2571, -398, -1097, 3585, 6942, 7309, -71, -4023, -3631, -3962, -4590, -4551, 3184, 7060,
+  6356, 1994, 175, 122, -5049, -7287, -6025, 1516, 4488, 3882, 4469, 4466, 3025, -4866, -7374, -5670,
+  -1425, 276, 1050, 6273, 7175, 4582, -2823, -4912, -4189, -4777, -3930, -1352, 6283, 7411, 4933, 786,
+  -954, -2283, -7169, -6672, -3059, 4018, 5316, 4463, 4802, 3046, -345, -7419, -7222, -4121, -19, 1807,
+  3446, 7703, 5858, 1502, -5129, -5679, -4602, -4513, -1914, 1973, 8285, 6830, 3189, -896, -2744, -4436,
+  -7883, -4804, 74, 6168, 5942, 4526, 3930, 634, -3479, -8898, -6229, -2097, 1930, 3656, 5190, 7748,
+  3559, -1670, -7113, -6024, -4189, -3113, 703, 4841, 9263, 5388, 831, -3013, -4446, -5688, -7343, -2143,
+  3280, 7908, 5848, 3593, 2144, -2040, -6053, -9363, -4268, 587, 4044, 5044, 5948, 6702, 560, -4875,
+  -8465, -5360, -2787, -1105, 3349, 7107, 9153, 2844, -2086, -4921, -5422, -6004, -5836, 1191, 6389, 8691,
+  4549, 1852, 54, -4625, -7976, -8573, -1128, 3557, 5557, 5594, 5889, 4731, -3095, -7723, -8500, -3457,
+  -881, 980, 5874, 8604, 7563, -824, -4871, -5904, -5604, -5616, -3359, 5102, 8748, 7846, 2170, -43,
+  -2004, -7089, -8908, -6088, 2899, 5899, 5963, 5509, 5170, 1695, -7120, -9332, -6736, -810, 867, 3049,
+  8234, 8786, 4160, -4947, -6543, -5783, -5358, -4503, 263, 9009, 9361, 5238, -496, -1583, -4150, -9233,
+  -8139, -1850, 6790, 6753, 5448, 5168, 3549, -2472, -10598, -8766, -3477, 1637, 2226, 5326, 9973, 6899,
+  -707, -8258, -6541, -5054, -4917, -2243, 4833, 11708, 7548, 1618, -2542, -2860, -6560, -10315, -5051, 3321,
+  9213, 5979, 4688, 4539, 546, -7190, -12176, -5781, 163, 3198, 3562, 7781, 10117, 2654, -5770, -9579,
+  -5187, -4397, -3938, 1530, 9340, 11894, 3611, -1708, -3646, -4396, -8869, -9262, 158, 7830, 9352, 4308,
+  4178, 3009, -3909, -11059, -10825, -1238, 2904, 3977, 5383, 9663, 7690, -3177, -9311, -8607, -3476, -3972,
+  -1666, 6441, 12134, 9024, -1114, -3704, -4304, -6485, -9985, -5422, 6148, 10084, 7483, 2789, 3672, -126,
+  -8914, -12401, -6634, 3231, 4135, 4736, 7601, 9672, 2566, -8800, -10107, -6157, -2289, -3146, 2335, 11080,
+  11770, 3870, -4941, -4285, -5348, -8574, -8611, 679, 10885, 9429, 4812, 1948, 2268, -4844, -12684, -10251,
+  -989, 6146, 4290, 6153, 9210, 6767, -4050, -12214, -8183, -3606, -1675, -950, 7462, 13508, 7956, -1744,
+  -6827, -4294, -7094, -9315, -4202, 7247, 12686, 6559, 2637, 1336, -830, -9940, -13401, -5088, 4098, 7049,
+  4423, 8043, 8727, 1076, -9974, -12299, -4777, -1934, -780, 3011, 12002, 12313, 1915, -5909, -6938, -4749,
+  -8821, -7355, 2365, 11984, 11153, 3043, 1446, -121, -5442, -13391, -10304, 1270, 7097, 6657, 5274, 9223,
+  5200, -5818, -13109, -9427, -1519, -1064, 1443, 7903, 13903, 7537, -4185, -7676, -6365, -5923, -9059, -2367,
+  8965, 13284, 7349, 297, 639, -3185, -10127, -13425, -4262, 6603, 7740, 6189, 6554, 8191, -940, -11512,
+  -12552, -5158, 612, -24, 5255, 11840, 11952, 779, -8377, -7438, -6192, -6981, -6563, 4444, 13234, 11054,
+  3065, -1271, -896, -7483, -12805, -9592, 2606, 9457, 6944, 6360, 7013, 4217, -7830, -14000, -8999, -1225,
+  1797, 2172, 9634, 12856, 6550, -5620, -9881, -6414, -6609, -6486, -1300, 10785, 13786, 6632, -284, -2330,
+  -3775, -11449, -11927, -3103, 8054, 9761, 5963, 6797, 5302, -1960, -13046, -12676, -4193, 1462, 3001, 5593,
+  12682, 10063, -444, -9790, -9255, -5639, -6755, -3448, 5276, 14424, 10837, 1883, -2377, -3894, -7446, -13138,
+  -7412, 3794, 10804, 8527, 5417, 6324, 1009, -8346, -14836, -8493, 163, 3134, 5030, 9111, 12706, 4203,
+  -6700, -11151, -7718, -5215, -5386, 1843, 10890, 14300, 5884, -1880, -3851, -6355, -10360, -11372, -718, 8989,
+  10949, 6921, 4910, 3893, -4870, -12691, -12928, -3232, 3274, 4622, 7747, 10996, 9225, -2755, -10573, -10343,
+  -6169, -4369, -1880, 7802, 13615, 10901, 714, -4401, -5496, -9035, -10884, -6441, 5952, 11449, 9476, 5437,
+  3482, -536, -10374, -13626, -8432, 1555, 5341, 6461, 10030, 9976, 3255, -8669, -11679, -8461, -4656, -2191,
+  3170, 12361, 12778, 5741, -3522, -6175, -7446, -10557, -8311, 72, 10771, 11370, 7367, 3739, 502, -5800,
+  -13607, -11198, -3018, 5188, 6950, 8333, 10487, 6012, -3291, -12201, -10642, -6217, -2608, 1507, 8193, 14039,
+  9061, 408, -6586, -7676, -8981, -9757, -3264, 6186, 12970, 9602, 4994, 1216, -3699, -10145, -13664, -6557,
+  1994, 7757, 8314, 9254, 8380, 286, -8604, -13135, -8332, -3659, 432, 5898, 11500, 12561, 3864, -4141,
+  -8731, -8787, -9049, -6442, 2702, 10452, 12775, 6880, 2176, -2277, -7915, -12173, -10859, -1135, 6017, 9510,
+  8999, 8314, 4085, -5504, -11699, -11973, -5264, -531, 4208, 9579, 12146, 8706, -1519, -7621, -10064, -8857,
+  -7060, -1485, 7968, 12358, 10799, 3487, -1250, -6086, -10758, -11464, -6255, 4021, 8945, 10336, 8295, 5357,
+  -1176, -9992, -12465, -9300, -1556, 3103, 7760, 11377, 10217, 3637, -6320, -9966, -10260, -7289, -3324, 3734,
+  11522, 12067, 7510, -505, -4922, -9097, -11419, -8518, -960, 8375, 10640, 9777, 5870, 1107, -6059, -12545,
+  -11203, -5452, 2638, 6583, 9999, 10917, 6479, -1694, -10140, -10907, -8856, -4118, 1148, 8062, 13062, 9902,
+  3163, -4752, -7958, -10419, -9941, -4203, 4261, 11558, 10707, 7510, 2148, -3311, -9694, -13086, -8184, -700,
+  6724, 8943, 10358, 8576, 1770, -6675, -12552, -9996, -5799, -97, 5283, 10933, 12620, 6075, -1844, -8423,
+  -9471, -9862, -6908, 753, 8863, 13041, 8768, 3832, -1907, -7006, -11768, -11660, -3617, 4344, 9721, 9527,
+  9005, 5003, -3310, -10735, -12948, -7063, -1743, 3758, 8452, 12188, 10199, 885, -6646, -10525, -9147, -7866,
+  -2911, 5838, 12180, 12223, 4974, -320, -5388, -9617, -12169, -8240, 2006, 8591, 10785, 8403, 6516, 663,
+  -8252, -13081, -10860, -2641, 2223, 6771, 10498, 11674, 5809, -4898, -10031, -10514, -7394, -4999, 1709, 10445,
+  13331, 8912, 236, -3866, -7914, -11083, -10659, -2976, 7605, 10860, 9775, 6216, 3335, -4166, -12280, -12850,
+  -6492, 2065, 5199, 8845, 11336, 9092, -139, -9929, -11026, -8681, -4947, -1521, 6638, 13606, 11613, 3769,
+  -4102, -6217, -9590, -11201, -6965, 3366, 11688, 10547, 7364, 3630, -450, -9020, -14278, -9658, -950, 5759,
+  6963, 10160, 10603, 4320, -6491, -12741, -9509, -5956, -2270, 2577, 11167, 14176, 7102, -1747, -6978, -7503,
+  -10530, -9470, -1258, 9282, 13013, 8053, 4565, 838, -4824, -12909, -13233, -4126, 4124, 7764, 7904, 10642,
+  7754, -2058, -11516, -12506, -6349, -3254, 711, 7113, 14067, 11459, 963, -6028, -8178, -8217, -10408, -5451,
+  5410, 13008, 11304, 4574, 2034, -2417, -9315, -14479, -8945, 2135, 7372, 8318, 8450, 9728, 2624, -8543,
+  -13638, -9562, -2878, -870, 4292, 11258, 14033, 5862, -4922, -8145, -8296, -8568, -8512, 596, 11200, 13374,
+  7479, 1364, -306, -6302, -12749, -12689, -2450, 7199, 8408, 8207, 8491, 6711, -4006, -13152, -12275, -5270,
+  -74, 1570, 8354, 13596, 10495, -1015, -8833, -8274, -8111, -8108, -4333, 7354, 14228, 10486, 3134, -1013,
+  -2983, -10302, -13644, -7591, 4253, 9778, 7886, 8012, 7306, 1464, -10365, -14347, -8213, -1224, 1965, 4560,
+  11958, 12799, 4199, -7017, -10068, -7384, -7862, -5992, 1734, 12777, 13523, 5698, -371, -2879, -6261, -13122,
+  -11057, -594, 9122, 9811, 6878, 7564, 4127, -5032, -14374, -11868, -3178, 1635, 3848, 7985, 13608, 8507,
+  -2925, -10468, -9160, -6426, -7001, -1739, 8164, 15021, 9573, 856, -2615, -4939, -9573, -13280, -5332, 6075,
+  11050, 8284, 6025, 6058, -1062, -10853, -14677, -6881, 1125, 3402, 6165, 10838, 12081, 1782, -8625, -10942,
+  -7335, -5618, -4656, 4094, 12856, 13405, 4053, -2700, -4107, -7478, -11589, -10043, 1847, 10422, 10287, 6426,
+  5105, 2772, -7120, -13990, -11358, -1327, 3872, 4828, 8771, 11665, 7292, -5261, -11404, -9260, -5606, -4371,
+  -459, 9875, 14162, 8758, -1106, -4708, -5624, -9888, -10966, -4039, 8195, 11602, 8038, 4867, 3319, -2156,
+  -12108, -13378, -5861, 3125, 5310, 6502, 10658, 9471, 547, -10452, -11122, -6771, -4150, -1891, 4882, 13609,
+  11739, 2926, -4685, -5785, -7409, -10917, -7253, 2896, 11917, 10124, 5561, 3363, 90, -7491, -14244, -9427,
+  -173, 5807, 6224, 8238, 10544, 4464, -6018, -12568, -8785, -4450, -2412, 2011, 9745, 13968, 6674, -2230,
+  -6564, -6673, -8855, -9482, -1325, 8595, 12464, 7275, 3428, 1225, -4277, -11432, -12828, -3729, 4189, 7053,
+  7129, 9115, 7752, -1910, -10473, -11728, -5730, -2443, 225, 6525, 12396, 10955, 825, -5678, -7368, -7538,
+  -8900, -5458, 4981, 11580, 10519, 4236, 1426, -1908, -8551, -12557, -8539, 1846, 6725, 7579, 7810, 8137,
+  2765, -7662, -11928, -9001, -2829, -312, 3737, 10165, 11916, 5801, -4152, -7399, -7717, -7839, -6818, 114,
+  9779, 11593, 7322, 1503, -933, -5580, -11211, -10554, -2963, 6022, 7777, 7770, 7527, 5003, -2956, -11227,
+  -10698, -5594, -224, 2303, 7278, 11593, 8615, 218, -7443, -7927, -7692, -6809, -2813, 5549, 11979, 9383,
+  3889, -1043, -3746, -8673, -11287, -6278, 2282, 8442, 7895, 7420, 5667, 412, -7724, -12066, -7787, -2238,
+  2323, 5168, 9632, 10336, 3735, -4439, -9067, -7695, -6890, -4141, 2017, 9365, 11569, 6026, 648, -3610,
+  -6455, -10067, -8842, -1163, 6206, 9366, 7312, 6061, 2318, -4297, -10420, -10596, -4185, 884, 4866, 7488,
+  9945, 6941, -1292, -7572, -9378, -6720, -4926, -325, 6278, 10892, 9256, 2320, -2355, -6021, -8166, -9294,
+  -4788, 3524, 8550, 9119, 5888, 3523, -1694, -7858, -10825, -7649, -468, 3743, 6991, 8425, 8186, 2529,
+  -5470, -9160, -8590, -4808, -1928, 3599, 8979, 10290, 5856, -1344, -5003, -7689, -8247, -6727, -286, 7094,
+  9414, 7783, 3498, 248, -5275, -9635, -9363, -3936, 3082, 6069, 8050, 7659, 5035, -1849, -8381, -9316,
+  -6696, -2010, 1401, 6642, 9849, 8116, 1937, -4699, -6868, -8039, -6729, -3220, 3814, 9320, 8859, 5345,
+  431, -2910, -7662, -9665, -6604, 96, 6128, 7332, 7662, 5546, 1374, -5570, -9896, -8036, -3776, 1136,
+  4196, 8336, 9131, 4872, -2106, -7288, -7418, -6968, -4205, 440, 7089, 10085, 6852, 2069, -2581, -5210,
+  -8687, -8285, -2959, 4020, 8098, 7117, 6036, 2790, -2182, -8341, -9855, -5338, -329, 3813, 5944, 8750,
+  7151, 909, -5745, -8489, -6465, -4958, -1360, 3829, 9285, 9183, 3560, -1322, -4768, -6421, -8557, -5745,
+  1215, 7176, 8424, 5536, 3827, -55, -5357, -9868, -8062, -1619, 2765, 5426, 6685, 8120, 4079, -3325,
+  -8207, -7906, -4433, -2713, 1446, 6737, 10030, 6519, -352, -3902, -5808, -6782, -7437, -2178, 5308, 8751,
+  6990, 3272, 1655, -2821, -7917, -9715, -4621, 2205, 4678, 5968, 6743, 6488, 90, -7033, -8754, -5775,
+  -2159, -659, 4183, 8825, 8889, 2482, -3796, -5081, -5982, -6576, -5249, 2100, 8364, 8216, 4393, 1172,
+  -304, -5519, -9373, -7553, -254, 5007, 5156, 5922, 6260, 3711, -4275, -9182, -7192, -2989, -348, 1274,
+  6787, 9471, 5760, -1890, -5764, -4984, -5842, -5747, -1890, 6285, 9405, 5794, 1698, -320, -2294, -7912,
+  -9048, -3614, 3775, 6053, 4673, 5762, 4979, -154, -7971, -9006, -4175, -625, 883, 3386, 8792, 8067,
+  1272, -5248, -5918, -4332, -5661, -3906, 2316, 9178, 8023, 2509, -177, -1416, -4533, -9311, -6545, 1077,
+  6206, 5459, 4052, 5480, 2501, -4450, -9787, -6562, -966, 709, 1999, 5681, 9361, 4562, -3231, -6608,
+  -4808, -3881, -5136, -784, 6382, 9733, 4779, -314, -1025, -2696, -6730, -8862, -2256, 5006, 6484, 4110,
+  3818, 4543, -1174, -7933, -9018, -2869, 1244, 1221, 3536, 7555, 7786, -185, -6258, -5928, -3493, -3814,
+  -3630, 3247, 8949, 7719, 1029, -1800, -1408, -4496, -8023, -6169, 2549, 6908, 5082, 3048, 3779, 2368,
+  -5269, -9318, -5982, 564, 2022, 1690, 5502, 8017, 4115, -4624, -6951, -4114, -2811, -3603, -784, 7054,
+  9001, 3998, -1782, -2005, -2142, -6440, -7461, -1789, 6232, 6459, 3186, 2757, 3182, -1038, -8421, -8031,
+  -1980, 2562, 1874, 2787, 7169, 6342, -605, -7249, -5562, -2431, -2812, -2441, 2959, 9225, 6520, 133,
+  -2913, -1764, -3592, -7551, -4716, 2847, 7629, 4434, 1927, 2863, 1355, -4804, -9376, -4637, 1380, 2908,
+  1787, 4471, 7471, 2704, -4735, -7402, -3255, -1692, -2788, 41, 6388, 8861, 2591, -2450, -2669, -2015,
+  -5298, -6870, -485, 6110, 6671, 2190, 1680, 2478, -1652, -7542, -7742, -595, 3047, 2338, 2461, 5930,
+  5749, -1735, -6880, -5591, -1358, -1797, -1863, 3334, 8141, 6154, -1158, -3206, -2055, -3082, -6235, -4181,
+  3748, 7029, 4344, 820, 1923, 929, -4915, -8124, -4276, 2528, 3026, 1927, 3783, 6116, 2300, -5374,
+  -6618, -3109, -572, -1934, 280, 6227, 7505, 2314, -3440, -2639, -2012, -4438, -5530, -280, 6486, 5769,
+  2032, 553, 1730, -1663, -7123, -6367, -465, 3888, 2189, 2313, 4916, 4497, -1684, -7027, -4643, -1213,
+  -663, -1256, 3084, 7511, 4851, -1108, -3933, -1803, -2775, -5102, -3101, 3414, 7011, 3413, 688, 783,
+  510, -4387, -7358, -3134, 2299, 3680, 1574, 3307, 4923, 1473, -4764, -6516, -2237, -436, -805, 456,
+  5431, 6700, 1397, -3062, -3260, -1540, -3794, -4357, 227, 5646, 5670, 1234, 389, 647, -1546, -6105,
+  -5631, 194, 3419, 2800, 1691, 4126, 3441, -1836, -6036, -4621, -474, -451, -274, 2639, 6349, 4286,
+  -1517, -3438, -2405, -1972, -4216, -2258, 3213, 5969, 3517, -29, 522, -304, -3612, -6160, -2817, 2502,
+  3221, 2140, 2300, 4020, 928, -4257, -5531, -2481, 308, -517, 1032, 4357, 5587, 1371, -3134, -2878,
+  -2025, -2584, -3537, 421, 4919, 4836, 1596, -427, 382, -1828, -4805, -4721, -66, 3448, 2508, 2040,
+  2744, 2812, -1667, -5203, -4003, -901, 464, -102, 2599, 4931, 3676, -1018, -3511, -2182, -2135, -2729,
+  -1920, 2716, 5155, 3143, 392, -490, -301, -3258, -4751, -2567, 1849, 3405, 1937, 2249, 2522, 955,
+  -3513, -4853, -2333, -36, 559, 780, 3743, 4321, 1492, -2434, -3207, -1774, -2320, -2141, -6, 4044,
+  4382, 1620, -219, -693, -1272, -4024, -3715, -520, 2811, 2978, 1671, 2309, 1630, -854, -4333, -3823,
+  -1013, 421, 888, 1721, 4106, 3013, -316, -3031, -2750, -1590, -2198, -1049, 1583, 4424, 3236, 499,
+  -607, -1118, -2085, -4020, -2281, 1013, 3144, 2532, 1498, 1997, 453, -2169, -4373, -2653, -50, 790,
+  1347, 2345, 3812, 1565, -1591, -3186, -2312, -1373, -1736, 113, 2625, 4226, 2083, -358, -965, -1543,
+  -2508, -3531, -881, 2078, 3173, 2070, 1213, 1451, -630, -2982, -4014, -1514, 739, 1112, 1689, 2603,
+  3211, 226, -2500, -3101, -1792, -1036, -1175, 1103, 3271, 3745, 932, -1087, -1205, -1787, -2662, -2868,
+  421, 2864, 2952, 1477, 872, 923, -1555, -3514, -3408, -327, 1381, 1229, 1862, 2715, 2491, -1081,
+  -3161, -2708, -1142, -754, -690, 2016, 3711, 2979, -295, -1588, -1184, -1951, -2774, -2054, 1762, 3362,
+  2360, 825, 704, 446, -2514, -3840, -2436, 905, 1679, 1094, 2093, 2825, 1521, -2453, -3428, -1921,
+  -571, -721, -146, 3054, 3861, 1773, -1458, -1636, -1005, -2316, -2832, -862, 3117, 3326, 1424, 425,
+  780, -257, -3617, -3722, -1003, 1900, 1465, 975, 2621, 2735, 68, -3696, -3036, -926, -415, -827,
+  800, 4155, 3381, 170, -2179, -1204, -1060, -2981, -2473, 843, 4124, 2568, 497, 541, 792, -1492,
+  -4596, -2813, 659, 2260, 914, 1303, 3336, 1992, -1818, -4336, -1961, -203, -770, -601, 2311, 4858,
+  2027, -1400, -2140, -675, -1714, -3600, -1264, 2776, 4287, 1285, 93, 1036, 194, -3191, -4862, -1066,
+  1975, 1851, 568, 2266, 3679, 299, -3618, -3967, -629, -186, -1247, 458, 4040, 4555, 11, -2318,
+  -1460, -661, -2890, -3488, 851, 4245, 3404, 86, 457, 1303, -1342, -4743, -3920, 1035, 2398, 1060,
+  987, 3484, 2968, -2093, -4576, -2666, 266, -842, -1114, 2399, 5186, 2987, -1961, -2229, -756, -1535,
+  -3929, -2103, 3306, 4567, 1852, -379, 1242, 623, -3524, -5278, -1831, 2670, 1864, 641, 2247, 4106,
+  930, -4359, -4217, -1075, 250, -1539, 185, 4585, 4966, 563, -3093, -1397, -779, -3019, -3921, 465,
+  5134, 3577, 442, 73, 1618, -1268, -5439, -4247, 684, 3207, 942, 1191, 3719, 3323, -1954, -5542,
+  -2738, -36, -501, -1387, 2533, 5957, 3176, -1782, -3039, -614, -1841, -4206, -2316, 3385, 5545, 1821,
+  -106, 915, 799, -3844, -6042, -1855, 2623, 2664, 507, 2643, 4354, 966, -4609, -5158, -951, -2,
+  -1182, 135, 5040, 5654, 421, -3142, -2190, -676, -3470, -4074, 610, 5496, 4449, 241, 298, 1188,
+  -1348, -5965, -4810, 977, 3328, 1740, 1119, 4172, 3332, -2258, -5964, -3528, 233, -674, -853, 2717,
+  6488, 3587, -2201, -3220, -1429, -1781, -4603, -2159, 3810, 5984, 2525, -445, 1003, 150, -4085, -6522,
+  -2109, 3145, 2904, 1339, 2557, 4645, 645, -5107, -5586, -1569, 422, -1159, 887, 5281, 6043, 529,
+  -3753, -2492, -1508, -3307, -4227, 1069, 6026, 4852, 767, -240, 1037, -2164, -6150, -5091, 1000, 4022,
+  2103, 1917, 3881, 3339, -2815, -6493, -3899, -184, 5, -580, 3543, 6571, 3762, -2342, -4000, -1839,
+  -2493, -4145, -2037, 4421, 6494, 2858, -166, 160, -214, -4858, -6479, -2192, 3398, 3773, 1766, 3123,
+  4001, 433, -5734, -6070, -1850, 318, -145, 1287, 5946, 5871, 535, -4123, -3447, -1899, -3671, -3405,
+  1322, 6643, 5311, 968, -347, -127, -2531, -6665, -4804, 1058, 4521, 3126, 2205, 4005, 2375, -3058,
+  -7093, -4330, -265, 353, 688, 3802, 6919, 3388, -2463, -4641, -2889, -2606, -4013, -988, 4614, 7081,
+  3248, -254, -434, -1512, -4944, -6668, -1758, 3597, 4560, 2779, 2992, 3631, -633, -5853, -6657, -2170,
+  626, 672, 2527, 5814, 5931, 64, -4421, -4365, -2794, -3247, -2845, 2337, 6688, 5907, 1174, -915,
+  -1113, -3618, -6298, -4780, 1561, 4944, 4135, 2892, 3268, 1700, -3968, -7078, -4933, -297, 1197, 1757,
+  4652, 6332, 3326, -3011, -5207, -3923, -2997, -2981, -286, 5386, 7034, 3837, -460, -1539, -2559, -5498,
+  -5904, -1696, 4216, 5267, 3748, 3023, 2360, -1272, -6483, -6606, -2704, 1123, 1985, 3437, 6044, 5053,
+  21, -5148, -5186, -3595, -2884, -1422, 2838, 7193, 5868, 1590, -1736, -2545, -4285, -6216, -3855, 1588,
+  5810, 5011, 3421, 2518, 233, -4281, -7497, -4903, -524, 2340, 3192, 4995, 5984, 2416, -3046, -6227,
+  -4765, -3169, -1897, 1113, 5492, 7409, 3788, -489, -2964, -3866, -5470, -5364, -844, 4299, 6432, 4449,
+  2783, 1031, -2502, -6396, -6975, -2584, 1459, 3609, 4488, 5643, 4406, -756, -5322, -6452, -4042, -2222,
+  32, 3824, 6954, 6250, 1330, -2397, -4250, -4976, -5483, -3188, 2300, 6108, 6301, 3512, 1470, -1215,
+  -4981, -7160, -5291, -53, 3305, 4840, 5256, 4994, 1797, -3726, -6660, -5978, -2829, -547, 2430, 5905,
+  7030, 4148, -1235, -4166, -5315, -5277, -4215, -317, 4992, 6979, 5468, 1979, -501, -3586, -6554, -6595,
+  -2858, 2515, 4942, 5611, 5021, 3202, -1180, -6071, -7058, -4755, -971, 1606, 4606, 6911, 5890, 1451,
+  -3763, -5581, -5678, -4498, -2024, 2638, 6942, 6880, 3828, -159, -2690, -5435, -6982, -4942, 47, 4936,
+  6021, 5487, 3746, 743, -4013, -7579, -6424, -2695, 1351, 3678, 6045, 6779, 3775, -1604, -5973, -6206,
+  -5038, -2818, 586, 5274, 7952, 5671, 1387, -2529, -4512, -6424, -6315, -2407, 3172, 6805, 6099, 4361,
+  1770, -1924, -6385, -8021, -4617, 34, 3612, 5157, 6579, 5599, 862, -4685, -7356, -5688, -3505, -652,
+  3242, 7307, 7746, 3279, -1486, -4531, -5600, -6517, -4632, 826, 6058, 7566, 4996, 2535, -499, -4513,
+  -7988, -7092, -1709, 2872, 5237, 5851, 6243, 3414, -2600, -7195, -7395, -4073, -1509, 1663, 5707, 8366,
+  6047, -12, -4096, -5708, -5929, -5751, -1952, 4381, 7998, 6841, 2993, 477, -2829, -6781, -8376, -4626,
+  1776, 5078, 5952, 5851, 5024, 269, -6062, -8387, -5937, -1839, 534, 3991, 7673, 7961, 2883, -3461,
+  -5765, -5999, -5628, -4042, 1585, 7525, 8309, 4754, 689, -1517, -5134, -8308, -7085, -912, 4944, 6139,
+  5890, 5252, 2787, -3530, -8644, -7751, -3389, 395, 2479, 6227, 8599, 5749, -1160, -6123, -6219, -5666,
+  -4698, -1261, 5452, 9311, 6749, 1954, -1381, -3439, -7215, -8465, -3996, 3186, 6925, 6051, 5357, 3929,
+  -507, -7215, -9448, -5383, -553, 2262, 4404, 8019, 7844, 1917, -5015, -7322, -5702, -4966, -2907, 2448,
+  8673, 9019, 3767, -727, -3059, -5368, -8544, -6708, 355, 6511, 7330, 5241, 4474, 1608, -4459, -9688,
+  -8047, -2036, 1833, 3807, 6295, 8689, 5077, -2656, -7576, -7003, -4723, -3842, -34, 6398, 10150, 6605,
+  328, -2746, -4540, -7119, -8366, -3026, 4811, 8154, 6427, 4181, 3018, -1774, -8110, -9994, -4814, 1240,
+  3486, 5280, 7749, 7520, 678, -6655, -8244, -5693, -3614, -1958, 3729, 9433, 9213, 2825, -2583, -4093,
+  -6020, -8079, -6138, 1801, 8051, 7897, 4890, 2993, 635, -5708, -10230, -7863, -798, 3657, 4623, 6721,
+  8005, 4266, -4221, -8913, -7198, -4081, -2269, 940, 7554, 10402, 6052, -1114, -4463, -5121, -7309, -7445,
+  -2007, 6395, 9211, 6258, 3298, 1386, -2713, -9100, -9909, -3935, 2792, 5037, 5613, 7688, 6358, -489,
+  -8155, -8971, -5190, -2537, -298, 4583, 10188, 8773, 1685, -4158, -5438, -6092, -7752, -4755, 3033, 9379,
+  8270, 4090, 1764, -1014, -6413, -10692, -7081, 521, 5183, 5730, 6515, 7406, 2706, -5427, -9999, -7221,
+  -3025, -926, 2526, 8042, 10537, 4973, -2531, -5881, -5965, -6809, -6586, -338, 7483, 10011, 5950, 2024,
+  -28, -4173, -9308, -9710, -2621, 4232, 6303, 6167, 6880, 5270, -2180, -9049, -9468, -4578, -1082, 1136,
+  5844, 10068, 8265, 211, -5557, -6514, -6328, -6636, -3497, 4654, 10020, 8468, 3204, 166, -2404, -7402,
+  -10220, -6314, 2081, 6491, 6581, 6407, 6001, 1359, -6891, -10357, -7136, -1893, 770, 3796, 8693, 9722,
+  4016, -4110, -7058, -6554, -6337, -4933, 1003, 8717, 10079, 5604, 674, -1767, -5238, -9574, -8589, -1550,
+  5777, 7314, 6456, 6039, 3442, -3414, -10003, -9259, -3995, 457, 2848, 6620, 9931, 6903, -899, -7029,
+  -7326, -6279, -5443, -1587, 5688, 10676, 8006, 2402, -1525, -4002, -7812, -9696, -4793, 3169, 7860, 7153,
+  5987, 4501, -523, -7650, -10719, -6449, -888, 2561, 5184, 8684, 8857, 2422, -5132, -8301, -6842, -5530,
+  -3203, 2742, 9157, 10174, 4717, -518, -3590, -6317, -9123, -7463, 34, 6704, 8404, 6412, 4853, 1586,
+  -4903, -10110, -9124, -2922, 1811, 4612, 7300, 9053, 5612, -2408, -7846, -8228, -5859, -3916, 272, 6844,
+  10466, 7681, 1153, -3003, -5604, -8025, -8445, -3440, 4558, 8559, 7824, 5161, 2707, -2255, -8421, -10234,
+  -5968, 531, 4104, 6515, 8396, 7321, 1104, -6378, -8871, -7231, -4290, -1248, 4223, 9526, 9468, 4100,
+  -2098, -5115, -7271, -8341, -5753, 1238, 7802, 8825, 6465, 3224, -400, -6033, -10100, -8256, -2178, 3530,
+  6018, 7793, 7827, 3848, -3447, -8803, -8466, -5532, -1962, 2147, 7557, 10127, 6701, 280, -4817, -6777,
+  -8005, -6865, -1738, 5406, 9381, 7835, 4430, 526, -3878, -8690, -9636, -4910, 1536, 5945, 7341, 7854,
+  5507, -439, -7036, -9558, -6960, -3162, 1030, 5476, 9369, 8689, 2981, -3228, -6892, -7651, -7314, -3838,
+  2555, 8287, 9361, 5863, 1744, -2627, -6831, -9569, -7365, -999, 4762, 7622, 7657, 6398, 1968, -4501,
+  -9139, -8819, -4561, -212, 4171, 7856, 9302, 5753, -966, -6104, -8091, -7325, -5151, -10, 6194, 9587,
+  7960, 3080, -1375, -5564, -8496, -8610, -3938, 2855, 7214, 8257, 6648, 3650, -1927, -7578, -9640, -6807,
+  -1456, 2937, 6717, 8727, 7550, 1997, -4614, -8048, -8085, -5650, -1985, 3748, 8617, 9307, 5388, -255,
+  -4388, -7564, -8560, -6191, 0, 6189, 8556, 7559, 4385, 254, -5382, -9292, -8601, -3741, 1979, 5639,
+  8065, 8026, 4598, -1990, -7521, -8697, -6693, -2928, 1455, 6777, 9592, 7538, 1919, -3625, -6617, -8211,
+  -7171, -2831, 3911, 8546, 8441, 5528, 1368, -3067, -7898, -9506, -6141, 4, 5100, 7272, 8021, 6046,
+  948, -5692, -9201, -7784, -4134, 206, 4528, 8720, 9028, 4449, -1936, -6314, -7583, -7531, -4697, 998,
+  7260, 9433, 6754, 2600, -1720, -5802, -9221, -8156, -2521, 3768, 7199, 7560, 6785, 3167, -2945, -8532,
+  -9206, -5407, -1021, 3115, 6866, 9377, 6898, 441, -5390, -7711, -7239, -5827, -1491, 4824, 9426, 8514,
+  3833, -511, -4356, -7702, -9163, -5279, 1682, 6700, 7844, 6670, 4694, -295, -6553, -9868, -7387, -2138,
+  1920, 5427, 8290, 8557, 3355, -3724, -7620, -7624, -5909, -3409, 2145, 8035, 9805, 5893, 438, -3157,
+  -6326, -8603, -7543, -1206, 5553, 8104, 7106, 5008, 1989, -4001, -9172, -9218, -4133, 1162, 4200, 7052,
+  8604, 6129, -1052, -7047, -8147, -6363, -4000, -448, 5784, 9868, 8127, 2235, -2577, -5051, -7600, -8256,
+  -4348, 3284, 8108, 7785, 5470, 2904, -1192, -7399, -10049, -6597, -332, 3751, 5729, 7950, 7522, 2271,
+  -5341, -8676, -7088, -4494, -1721, 2895, 8736, 9670, 4734, -1445, -4665, -6259, -8070, -6383, -2, 7079,
+  8734, 6148, 3485, 447, -4600, -9684, -8732, -2677, 2991, 5331, 6658, 7914, 4849, -2321, -8375, -8316,
+  -5064, -2464, 923, 6221, 10145, 7285, 579, -4235, -5786, -6926, -7431, -2965, 4541, 9145, 7497, 3929,
+  1431, -2377, -7653, -10051, -5426, 1409, 5146, 6077, 7046, 6581, 815, -6499, -9353, -6382, -2813, -368,
+  3883, 8779, 9373, 3293, -3154, -5736, -6247, -6976, -5346, 1476, 8048, 9014, 5091, 1756, -746, -5378,
+  -9486, -8136, -1048, 4562, 6048, 6325, 6666, 3741, -3755, -9077, -8196, -3740, -767, 1928, 6772, 9683,
+  6415, -1138, -5580, -6143, -6316, -6060, -1823, 5856, 9522, 7007, 2427, -170, -3174, -7955, -9313, -4337,
+  3113, 6204, 6089, 6199, 5119, -309, -7620, -9373, -5575, -1218, 1087, 4450, 8812, 8370, 2059, -4750,
+  -6472, -5941, -5930, -3831, 2518, 8910, 8677, 4038, 143, -2019, -5693, -9237, -6901, 243, 5973, 6450,
+  5735, 5457, 2220, -4647, -9634, -7530, -2518, 800, 2985, 6814, 9152, 5006, -2398, -6752, -6218, -5475,
+  -4729, -356, 6532, 9754, 6060, 1108, -1640, -3985, -7705, -8522, -2827, 4260, 7106, 5854, 5139, 3712,
+  -1654, -8024, -9287, -4411, 132, 2419, 4985, 8263, 7362, 532, -5721, -7092, -5419, -4688, -2405, 3671,
+  9009, 8306, 2723, -1184, -3172, -5924, -8396, -5741, 1704, 6725, 6792, 4948, 4071, 844, -5543, -9420,
+  -6924, -1114, 2060, 3923, 6717, 8048, 3773, -3721, -7263, -6294, -4447, -3248, 896, 7120, 9244, 5282,
+  -332, -2795, -4668, -7270, -7208, -1609, 5391, 7374, 5679, 3897, 2197, -2704, -8276, -8526, -3522, 1566,
+  3429, 5375, 7496, 5912, -588, -6630, -7127, -5006, -3263, -931, 4448, 8925, 7352, 1777, -2578, -3999,
+  -5987, -7329, -4244, 2657, 7402, 6609, 4310, 2508, -507, -5992, -9028, -5846, -154, 3386, 4522, 6433,
+  6738, 2325, -4459, -7719, -5907, -3596, -1605, 2035, 7213, 8598, 4144, -1275, -4023, -4993, -6639, -5735,
+  -300, 5891, 7630, 5096, 2853, 551, -3552, -8013, -7696, -2380, 2475, 4524, 5383, 6542, 4374, -1684,
+  -6895, -7207, -4232, -2057, 633, 4941, 8340, 6418, 669, -3439, -4918, -5647, -6106, -2747, 3489, 7456,
+  6532, 3345, 1189, -1892, -6092, -8182, -4883, 898, 4184, 5216, 5730, 5327, 972, -5007, -7598, -5685,
+  -2445, -240, 3151, 6915, 7574, 3214, -2266, -4735, -5411, -5585, -4238, 825, 6164, 7372, 4729, 1531,
+  -775, -4321, -7350, -6585, -1524, 3405, 5118, 5481, 5181, 2905, -2521, -6927, -6845, -3713, -598, 1823,
+  5313, 7374, 5310, -92, -4311, -5348, -5395, -4511, -1420, 4012, 7297, 6087, 2666, -354, -2849, -6050,
+  -7003, -3852, 1566, 4993, 5431, 5124, 3599, -115, -5224, -7302, -5162, -1605, 1312, 3787, 6480, 6284,
+  2311, -2854, -5464, -5360, -4652, -2495, 1600, 6113, 6990, 4122, 544, -2247, -4571, -6580, -5288, -775,
+  3932, 5733, 5122, 3980, 1267, -2945, -6666, -6412, -3005, 503, 3115, 5145, 6357, 4094, -688, -4792,
+  -5805, -4708, -3133, 2, 4086, 6894, 5622, 1844, -1513, -3867, -5469, -5846, -2785, 2028, 5429, 5679,
+  4117, 2154, -1234, -4981, -6825, -4663, -664, 2450, 4454, 5531, 5099, 1431, -3213, -5840, -5350, -3365,
+  -1104, 2361, 5614, 6491, 3575, -503, -3274, -4838, -5342, -4178, -89, 4219, 6019, 4822, 2485, 50,
+  -3335, -5988, -5927, -2389, 1620, 3938, 4998, 4935, 3142, -1197, -5028, -5958, -4107, -1529, 948, 4126,
+  6117, 5162, 1141, -2641, -4403, -4937, -4355, -2044, 2395, 5621, 5651, 3234, 556, -1841, -4726, -6018,
+  -4222, 129, 3515, 4642, 4678, 3652, 921, -3479, -5975, -5102, -2253, 371, 2596, 5141, 5708, 3132,
+  -1373, -4190, -4649, -4260, -2871, 197, 4422, 6068, 4331, 1223, -1198, -3205, -5381, -5196, -1922, 2529,
+  4625, 4440, 3735, 2043, -1292, -5191, -5884, -3374, -217, 1888, 3675, 5458, 4490, 632, -3534, -4795,
+  -4055, -3150, -1190, 2342, 5752, 5416, 2291, -697, -2426, -4022, -5374, -3597, 682, 4323, 4699, 3549,
+  2544, 318, -3325, -6063, -4678, -1157, 1463, 2817, 4268, 5124, 2535, -1953, -4842, -4363, -2984, -1940,
+  571, 4205, 6090, 3707, 56, -2045, -3089, -4424, -4695, -1331, 3103, 5057, 3838, 2416, 1341, -1476,
+  -4937, -5810, -2565, 929, 2433, 3277, 4493, 4073, 35, -4052, -4962, -3194, -1890, -735, 2385, 5467,
+  5220, 1336, -1729, -2645, -3417, -4459, -3253, 1286, 4729, 4583, 2511, 1428, 103, -3271, -5742, -4346,
+  -116, 2300, 2722, 3536, 4296, 2243, -2546, -5083, -3976, -1861, -1027, 577, 4089, 5716, 3242, -996,
+  -2627, -2719, -3644, -3969, -1076, 3655, 5091, 3221, 1302, 663, -1314, -4780, -5366, -1990, 1914, 2729,
+  2694, 3728, 3449, -192, -4523, -4769, -2410, -867, -297, 2100, 5278, 4694, 694, -2577, -2655, -2692,
+  -3755, -2720, 1479, 5080, 4166, 1635, 558, -114, -2901, -5519, -3738, 537, 2955, 2473, 2741, 3679,
+  1789, -2692, -5281, -3364, -974, -347, 604, 3664, 5452, 2568, -1599, -3057, -2258, -2841, -3450, -691,
+  3729, 5120, 2461, 476, 186, -1189, -4319, -5057, -1282, 2411, 2929, 2079, 2965, 3026, -508, -4500,
+  -4631, -1564, -158, -16, 1859, 4790, 4344, -7, -2923, -2643, -1985, -3064, -2388, 1721, 4941, 3884,
+  768, 1, -221, -2575, -5007, -3361, 1185, 3125, 2284, 1996, 3076, 1543, -2845, -5018, -2975, -143,
+  41, 566, 3274, 4922, 2190, -2153, -3049, -1939, -2101, -2942, -531, 3781, 4741, 2015, -272, -36,
+  -1034, -3879, -4519, -936, 2839, 2757, 1677, 2260, 2615, -576, -4443, -4160, -1112, 479, 55, 1611,
+  4311, 3817, -286, -3211, -2337, -1544, -2412, -2076, 1689, 4777, 3355, 353, -513, -162, -2252, -4501,
+  -2872, 1367, 3276, 1883, 1549, 2487, 1335, -2707, -4763, -2433, 200, 436, 396, 2890, 4408, 1771,
+  -2219, -3082, -1481, -1670, -2422, -436, 3535, 4424, 1501, -528, -325, -770, -3445, -4021, -618, 2786,
+  2704, 1196, 1857, 2173, -548, -4100, -3819, -661, 646, 254, 1262, 3841, 3367, -480, -3052, -2234,
+  -1060, -2042, -1722, 1530, 4359, 3035, -14, -603, -284, -1825, -4016, -2506, 1425, 3041, 1764, 1073,
+  2156, 1085, -2418, -4308, -2173, 479, 468, 449, 2390, 3937, 1521, -2147, -2809, -1369, -1202, -2138,
+  -308, 3129, 3978, 1332, -730, -316, -754, -2882, -3602, -509, 2608, 2434, 1102, 1394, 1949, -542,
+  -3605, -3431, -596, 794, 218, 1173, 3234, 3040, -438, -2808, -2001, -983, -1581, -1581, 1385, 3818,
+  2749, 20, -726, -223, -1657, -3395, -2311, 1243, 2779, 1591, 1000, 1700, 1051, -2141, -3773, -2021,
+  369, 593, 357, 2142, 3342, 1488, -1855, -2579, -1262, -1116, -1700, -403, 2748, 3507, 1326, -581,
+  -461, -615, -2565, -3078, -652, 2253, 2278, 1050, 1278, 1554, -302, -3163, -3076, -725, 649, 387,
+  969, 2870, 2636, -127, -2448, -1946, -960, -1426, -1257, 1000, 3372, 2548, 255, -625, -406, -1373,
+  -3021, -2064, 793, 2475, 1643, 975, 1511, 831, -1631, -3387, -1992, 77, 564, 531, 1774, 3004,
+  1423, -1317, -2383, -1407, -1055, -1496, -313, 2149, 3240, 1462, -287, -517, -751, -2124, -2829, -769,
+  1693, 2228, 1256, 1157, 1365, -248, -2531, -2977, -994, 407, 522, 1037, 2382, 2522, 150, -1936,
+  -2056, -1182, -1237, -1120, 807, 2773, 2645, 605, -480, -596, -1352, -2529, -2120, 405, 2076, 1901,
+  1164, 1260, 783, -1325, -2887, -2285, -288, 542, 738, 1657, 2558, 1661, -882, -2147, -1779, -1171,
+  -1207, -382, 1777, 2897, 1924, 25, -622, -934, -1922, -2481, -1178, 1287, 2179, 1690, 1171, 1075,
+  -52, -2153, -2829, -1573, 208, 734, 1159, 2126, 2315, 692, -1632, -2193, -1618, -1141, -872, 493,
+  2455, 2705, 1232, -434, -878, -1387, -2261, -2080, -211, 1935, 2195, 1545, 1066, 615, -925, -2693,
+  -2537, -887, 667, 1043, 1598, 2330, 1791, -267, -2207, -2179, -1451, -945, -319, 1342, 2875, 2324,
+  525, -911, -1212, -1781, -2339, -1454, 749, 2452, 2131, 1323, 785, -2, -1743, -3004, -2056, -135,
+  1155, 1368, 1933, 2296, 1067, -1240, -2659, -2032, -1158, -598, 344, 2132, 3073, 1719, -281, -1385,
+  -1502, -2058, -2198, -619, 1739, 2810, 1870, 966, 393, -710, -2509, -3065, -1300, 712, 1579, 1611,
+  2162, 2039, 102, -2231, -2878, -1643, -760, -174, 1109, 2864, 2956, 797, -1133, -1724, -1704, -2245,
+  -1799, 490, 2689, 2841, 1358, 558, -66, -1547, -3175, -2720, -220, 1515, 1813, 1793, 2301, 1458,
+  -1147, -3075, -2684, -1037, -370, 343, 2023, 3407, 2337, -407, -1827, -1853, -1892, -2308, -993, 1845,
+  3349, 2405, 709, 198, -675, -2525, -3519, -1800, 1041, 2046, 1862, 2006, 2236, 393, -2542, -3470,
+  -2021, -401, -30, 1080, 3021, 3467, 1121, -1637, -2162, -1865, -2129, -2048, 337, 3183, 3413, 1563,
+  136, -156, -1566, -3465, -3216, -335, 2145, 2183, 1886, 2236, 1709, -1169, -3707, -3170, -1074, 76,
+  391, 2124, 3800, 2747, -506, -2527, -2130, -1945, -2292, -1193, 2057, 4055, 2756, 598, -244, -707,
+  -2727, -3965, -2066, 1339, 2759, 2039, 2043, 2248, 492, -2931, -4182, -2206, -176, 391, 1124, 3322,
+  3905, 1205, -2095, -2839, -1948, -2165, -2054, 373, 3715, 4065, 1572, -169, -554, -1647, -3845, -3583,
+  -219, 2714, 2787, 1891, 2276, 1669, -1358, -4329, -3706, -916, 429, 774, 2256, 4219, 2989, -814,
+  -3151, -2641, -1886, -2324, -1069, 2391, 4705, 3137, 294, -621, -1086, -2909, -4374, -2143, 1812, 3389,
+  2447, 1933, 2252, 258, -3385, -4799, -2412, 245, 779, 1512, 3539, 4252, 1098, -2691, -3432, -2253,
+  -2008, -2004, 730, 4244, 4593, 1601, -678, -946, -2049, -4065, -3821, 70, 3385, 3312, 2098, 2066,
+  1539, -1831, -4879, -4106, -779, 1002, 1170, 2667, 4403, 3085, -1265, -3850, -3078, -1998, -2050, -844,
+  2956, 5223, 3384, 12, -1238, -1485, -3309, -4480, -2081, 2390, 4072, 2786, 1950, 1898, -65, -4001,
+  -5236, -2498, 651, 1426, 1906, 3899, 4243, 878, -3355, -4067, -2487, -1924, -1557, 1139, 4865, 4913,
+  1530, -1186, -1613, -2422, -4350, -3673, 428, 4093, 3874, 2220, 1871, 996, -2298, -5459, -4286, -562,
+  1594, 1843, 2994, 4579, 2789, -1731, -4564, -3549, -2000, -1734, -212, 3440, 5720, 3414, -336, -1898,
+  -2146, -3558, -4518, -1645, 2927, 4760, 3150, 1820, 1455, -763, -4459, -5618, -2380, 1114, 2139, 2529,
+  4035, 4128, 325, -3927, -4705, -2731, -1649, -994, 1866, 5253, 5164, 1272, -1750, -2359, -2972, -4339,
+  -3407, 1066, 4667, 4443, 2327, 1442, 330, -3008, -5741, -4400, -176, 2246, 2596, 3431, 4398, 2387,
+  -2418, -5114, -4031, -1952, -1147, 522, 4086, 5872, 3397, -839, -2624, -2870, -3840, -4159, -1138, 3627,
+  5267, 3528, 1597, 720, -1520, -4995, -5632, -2243, 1726, 2918, 3181, 4125, 3600, -247, -4611, -5153,
+  -2981, -1236, -136, 2590, 5645, 5042, 1026, -2464, -3164, -3502, -4214, -2736, 1662, 5314, 4818, 2425,
+  833, -609, -3641, -5969, -4156, 171, 3051, 3386, 3787, 4050, 1615, -2998, -5710, -4317, -1871, -350,
+  1485, 4577, 5932, 3048, -1281, -3506, -3596, -3979, -3601, -315, 4162, 5805, 3701, 1315, -237, -2440,
+  -5306, -5536, -1806, 2261, 3851, 3785, 4015, 2868, -1069, -5082, -5626, -3016, -740, 937, 3398, 5754,
+  4814, 515, -3088, -4109, -3923, -3844, -1880, 2434, 5713, 5215, 2290, 124, -1732, -4277, -5875, -3823,
+  750, 3758, 4293, 3972, 3433, 698, -3686, -6036, -4621, -1537, 549, 2583, 4991, 5654, 2640, -1927,
+  -4277, -4402, -3886, -2775, 598, 4743, 6061, 3889, 760, -1282, -3433, -5470, -5105, -1343, 2977, 4655,
+  4423, 3626, 1889, -1917, -5549, -5812, -3056, 42, 2063, 4211, 5665, 4271, 11, -3874, -4899, -4330,
+  -3165, -821, 3172, 6070, 5325, 2149, -872, -2858, -4848, -5552, -3209, 1291, 4604, 5009, 4096, 2497,
+  -363, -4281, -6295, -4639, -1188, 1721, 3621, 5283, 5134, 1990, -2509, -5162, -4976, -3696, -1641, 1587,
+  5185, 6232, 3789, 188, -2569, -4296, -5469, -4439, -682, 3603, 5541, 4785, 3118, 635, -2772, -5842,
+  -5902, -2808, 835, 3385, 4826, 5386, 3512, -649, -4544, -5734, -4422, -2364, 465, 3849, 6228, 5330,
+  1724, -1859, -4124, -5162, -5032, -2408, 1947, 5309, 5729, 3875, 1458, -1594, -4760, -6340, -4544, -564,
+  2851, 4736, 5270, 4428, 1186, -3166, -5875, -5511, -3145, -440, 2686, 5464, 6182, 3574, -641, -3769,
+  -5176, -5135, -3611, 98, 4266, 6222, 5073, 2251, -637, -3682, -5935, -5767, -2446, 1854, 4565, 5404,
+  4761, 2625, -1394, -5211, -6328, -4411, -1226, 1711, 4533, 6161, 5111, 1192, -3027, -5188, -5399, -4172,
+  -1516, 2655, 5965, 6172, 3538, 119, -2726, -5205, -6140, -4231, 149, 4106, 5594, 5157, 3401, 332,
+  -3840, -6493, -5743, -2485, 1009, 3630, 5678, 5872, 3149, -1529, -5031, -5751, -4694, -2488, 889, 4908,
+  6760, 5040, 1299, -2097, -4387, -5942, -5362, -1892, 2889, 5741, 5645, 4040, 1475, -2108, -5816, -6735,
+  -4079, -42, 3087, 4972, 5993, 4616, 498, -4159, -6188, -5284, -3236, -396, 3290, 6517, 6393, 2899,
+  -1214, -3932, -5376, -5827, -3644, 981, 5264, 6337, 4695, 2326, -718, -4397, -6964, -5728, -1558, 2396,
+  4601, 5598, 5443, 2461, -2480, -6133, -6177, -3921, -1351, 1840, 5385, 7111, 4753, 133, -3439, -5082,
+  -5641, -4836, -1097, 3920, 6702, 5720, 3016, 342, -2947, -6205, -6921, -3506, 1291, 4292, 5376, 5505,
+  4003, -400, -5212, -6928, -5004, -2035, 676, 4011, 6801, 6374, 2052, -2625, -4927, -5494, -5188, -2948,
+  1968, 6269, 6792, 4086, 1025, -1687, -4996, -7117, -5472, -475, 3791, 5333, 5453, 4682, 1688, -3522,
+  -7013, -6307, -3032, -25, 2681, 5857, 7102, 4246, -1126, -4728, -5522, -5265, -3976, -256, 4969, 7383,
+  5513, 1913, -943, -3643, -6539, -6720, -2756, 2646, 5396, 5519, 4935, 3064, -1293, -6209, -7350, -4475,
+  -793, 1868, 4552, 6980, 5958, 1089, -3991, -5785, -5353, -4460, -1946, 2881, 7148, 6915, 3273, -279,
+  -2747, -5373, -7121, -4832, 648, 5081, 5909, 5053, 3829, 641, -4414, -7709, -6113, -1992, 1273, 3581,
+  6061, 6912, 3391, -2341, -5864, -5799, -4640, -3027, 812, 5788, 7843, 5010, 715, -2175, -4363, -6557,
+  -6324, -1715, 3875, 6317, 5500, 4121, 2045, -2348, -6898, -7536, -3694, 492, 2986, 5077, 6801, 5355,
+  -89, -5156, -6449, -5055, -3493, -886, 3881, 7652, 6812, 2263, -1583, -3714, -5690, -6734, -4037, 1902,
+  6110, 6293, 4504, 2743, -426, -5311, -7983, -5727, -814, 2535, 4367, 6157, 6315, 2436, -3600, -6699,
+  -5900, -3871, -1858, 1846, 6530, 7858, 4368, -567, -3343, -4945, -6423, -5525, -648, 5070, 6917, 5325,
+  3167, 831, -3303, -7437, -7281, -2838, 1815, 4016, 5435, 6430, 4377, -1208, -6220, -6790, -4625, -2390,
+  331, 4707, 7951, 6296, 1248, -2889, -4571, -5807, -6130, -2918, 3006, 6992, 6367, 3844, 1529, -1599,
+  -5957, -8021, -4979, 303, 3772, 5020, 6020, 5493, 1230, -4624, -7363, -5712, -3011, -575, 2922, 6951,
+  7631, 3430, -1728, -4468, -5368, -6025, -4516, 581, 5955, 7343, 4890, 2139, -473, -4225, -7601, -6805,
+  -1762, 2968, 4991, 5603, 5777, 3227, -2395, -6923, -6971, -3963, -1230, 1602, 5422, 7842, 5604, 88,
+  -3989, -5361, -5702, -5241, -1689, 4086, 7483, 6310, 2977, 279, -2777, -6418, -7641, -4117, 1495, 4779,
+  5594, 5632, 4403, -10, -5541, -7628, -5428, -1966, 717, 3943, 7125, 7004, 2452, -2908, -5346, -5695,
+  -5355, -3277, 1760, 6670, 7381, 4396, 945, -1750, -5030, -7474, -5973, -723, 4096, 5708, 5659, 4842,
+  1907, -3444, -7412, -6795, -3277, 76, 2799, 5957, 7421, 4620, -964, -5032, -5885, -5469, -4077, -364,
+  4950, 7740, 5933, 2119, -1093, -3825, -6645, -6955, -3042, 2517, 5710, 5891, 5104, 3064, -1259, -6180,
+  -7662, -4870, -957, 2100, 4775, 7027, 6102, 1344, -3868, -6137, -5737, -4544, -1836, 2859, 7064, 7211,
+  3673, -184, -3080, -5584, -7057, -4917, 366, 4969, 6330, 5421, 3778, 447, -4330, -7560, -6443, -2404,
+  1289, 4004, 6188, 6716, 3478, -1992, -5800, -6308, -4937, -2812, 1027, 5579, 7658, 5423, 1114, -2343,
+  -4832, -6528, -6017, -1882, 3455, 6353, 6085, 4280, 1670, -2497, -6532, -7378, -4222, 161, 3326, 5515,
+  6564, 4998, 226, -4696, -6636, -5672, -3451, -398, 3872, 7139, 6759, 2904, -1387, -4212, -6003, -6276,
+  -3725, 1396, 5678, 6662, 5077, 2461, -940, -5067, -7381, -5856, -1528, 2539, 4968, 6251, 5671, 2277,
+  -2902, -6381, -6445, -4308, -1336, 2271, 6013, 7261, 4731, 142, -3589, -5556, -6228, -4778, -740, 4230,
+  6798, 6000, 3378, 121, -3518, -6660, -6806, -3444, 1208, 4506, 5937, 5921, 3652, -801, -5330, -6932,
+  -5342, -2308, 1129, 4607, 6985, 6056, 2056, -2483, -5256, -6079, -5338, -2358, 2271, 6172, 6790, 4488,
+  1135, -2349, -5479, -6983, -5062, -620, 3645, 5804, 5963, 4508, 969, -3607, -6737, -6384, -3461, 95,
+  3473, 6093, 6671, 3875, -812, -4654, -6118, -5585, -3478, 443, 4759, 7016, 5727, 2296, -1326, -4439,
+  -6426, -6078, -2550, 2192, 5468, 6175, 4961, 2307, -1812, -5690, -7005, -4840, -1036, 2494, 5201, 6476,
+  5242, 1136, -3470, -6050, -5964, -4126, -1057, 3082, 6375, 6706, 3753, -262, -3538, -5725, -6254, -4203,
+  314, 4596, 6365, 5492, 3128, -211, -4211, -6793, -6126, -2506, 1534, 4406, 6000, 5783, 3004, -1749,
+  -5520, -6393, -4786, -2024, 1444, 5163, 6931, 5282, 1153, -2714, -5059, -6028, -5093, -1686, 3115, 6193,
+  6127, 3888, 872, -2597, -5909, -6779, -4202, 240, 3739, 5476, 5826, 4212, 294, -4352, -6576, -5582,
+  -2855, 274, 3637, 6428, 6333, 2927, -1601, -4558, -5654, -5415, -3172, 1125, 5401, 6641, 4792, 1748,
+  -1370, -4536, -6696, -5599, -1515, 2854, 5136, 5607, 4822, 2002, -2516, -6204, -6381, -3809, -628, 2382,
+  5274, 6696, 4598, 39, -3928, -5459, -5360, -4072, -735, 3821, 6708, 5809, 2699, -451, -3290, -5829,
+  -6411, -3364, 1420, 4767, 5532, 4943, 3185, -593, -4972, -6877, -4964, -1535, 1449, 4078, 6179, 5835,
+  1954, -2776, -5333, -5382, -4385, -2179, 1936, 5902, 6694, 3905, 385, -2341, -4737, -6299, -4975, -440,
+  3946, 5613, 5043, 3712, 1073, -3239, -6551, -6166, -2708, 690, 3114, 5254, 6168, 3854, -1092, -4865,
+  -5616, -4558, -2941, 109, 4437, 6866, 5328, 1453, -1648, -3767, -5614, -5765, -2519, 2547, 5484, 5374,
+  3966, 2083, -1337, -5459, -6818, -4240, -224, 2463, 4303, 5795, 5083, 1035, -3833, -5784, -4935, -3300,
+  -1145, 2567, 6235, 6402, 2981, -909, -3130, -4726, -5770, -4131, 514, 4870, 5773, 4353, 2581, 135,
+  -3741, -6704, -5642, -1643, 1895, 3655, 5030, 5515, 2938, -2030, -5598, -5483, -3682, -1818, 930, 4793,
+  6821, 4592, 319, -2701, -4056, -5203, -5008, -1559, 3414, 5984, 4968, 2964, 1013, -2022, -5652, -6565,
+  -3329, 909, 3320, 4348, 5223, 4244, 68, -4576, -6027, -4292, -2232, -163, 3100, 6249, 5946, 1947,
+  -1974, -3763, -4544, -5064, -3236, 1442, 5440, 5755, 3521, 1501, -731, -4107, -6528, -5003, -546, 2834,
+  4053, 4644, 4700, 2019, -2873, -5959, -5218, -2714, -772, 1656, 4978, 6453, 3806, -779, -3471, -4220,
+  -4637, -4113, -654, 4125, 6118, 4487, 1915, 40, -2588, -5643, -6016, -2443, 1947, 3894, 4290, 4505,
+  3300, -780, -5115, -5931, -3635, -1151, 704, 3488, 6042, 5241, 1016, -2903, -4126, -4279, -4221, -2280,
+  2188, 5780, 5443, 2735, 432, -1463, -4302, -6128, -4179, 375, 3616, 4204, 4193, 3763, 1093, -3475,
+  -6087, -4720, -1844, 246, 2229, 4968, 5876, 2910, -1639, -4083, -4165, -4024, -3117, 197, 4551, 6037,
+  3838, 1004, -894, -2981, -5426, -5292, -1527, 2704, 4323, 4039, 3754, 2286, -1510, -5342, -5661, -2877,
+  -237, 1524, 3679, 5625, 4412, 132, -3527, -4371, -3848, -3361, -1294, 2757, 5803, 5013, 1906, -452,
+  -2141, -4278, -5531, -3296, 1180, 4091, 4269, 3597, 2829, 184, -3851, -5916, -4167, -980, 1070, 2739,
+  4724, 5134, 2026, -2330, -4402, -4057, -3282, -2151, 979, 4715, 5697, 3201, 135, -1630, -3296, -4969,
+  -4451, -696, 3260, 4488, 3768, 2890, 1337, -2121, -5293, -5186, -2190, 611, 2145, 3783, 4974, 3527,
+  -603, -3938, -4390, -3423, -2407, -414, 3163, 5556, 4444, 1199, -1258, -2618, -4158, -4722, -2426, 1786,
+  4358, 4149, 3030, 1823, -573, -4033, -5503, -3544, -275, 1812, 3044, 4382, 4216, 1227, -2790, -4536,
+  -3804, -2588, -1140, 1564, 4672, 5159, 2559, -550, -2284, -3405, -4420, -3485, -14, 3571, 4502, 3388,
+  2092, 374, -2495, -5043, -4570, -1557, 1265, 2685, 3677, 4252, 2575, -1134, -4110, -4295, -2920, -1537,
+  444, 3303, 5135, 3796, 593, -1867, -3016, -3831, -3875, -1550, 2150, 4410, 3954, 2412, 922, -1271,
+  -3934, -4957, -2903, 295, 2361, 3272, 3843, 3304, 480, -2988, -4489, -3515, -1868, -259, 2058, 4351,
+  4541, 1954, -1082, -2755, -3439, -3695, -2574, 567, 3619, 4376, 3004, 1292, -430, -2754, -4536, -3934,
+  -1005, 1756, 3052, 3503, 3384, 1733, -1529, -4034, -4105, -2441, -687, 1116, 3316, 4490, 3188, 98,
+  -2312, -3252, -3449, -2921, -836, 2361, 4241, 3708, 1841, 67, -1761, -3711, -4233, -2357, 735, 2752,
+  3350, 3268, 2332, -62, -3031, -4256, -3212, -1216, 550, 2328, 3923, 3799, 1490, -1475, -3074, -3339,
+  -2961, -1654, 911, 3525, 4103, 2641, 579, -1140, -2785, -3952, -3227, -628, 2109, 3277, 3215, 2541,
+  927, -1672, -3842, -3807, -2014, 54, 1673, 3109, 3810, 2558, -199, -2627, -3358, -2977, -2032, -196,
+  2317, 3989, 3388, 1350, -661, -2123, -3290, -3522, -1831, 966, 3023, 3313, 2636, 1465, -502, -2833,
+  -3977, -2868, -669, 1216, 2467, 3331, 3117, 1077, -1656, -3287, -3144, -2209, -874, 1140, 3214, 3821,
+  2265, -4, -1694, -2693, -3246, -2623, -321, 2253, 3412, 2856, 1722, 292, -1698, -3464, -3533, -1599,
+  644, 2071, 2801, 3054, 2066, -415, -2740, -3394, -2467, -1208, 254, 2170, 3584, 3125, 895, -1218,
+  -2331, -2799, -2780, -1466, 1113, 3102, 3231, 2001, 700, -748, -2554, -3579, -2608, -181, 1697, 2469,
+  2707, 2443, 840, -1756, -3321, -2932, -1491, -226, 1182, 2850, 3451, 1998, -508, -2057, -2494, -2549,
+  -2059, -197, 2321, 3386, 2517, 975, -194, -1559, -3061, -3199, -1318, 1136, 2282, 2422, 2348, 1636,
+  -450, -2785, -3289, -2015, -489, 552, 1885, 3183, 2825, 597, -1665, -2369, -2282, -2121, -1177, 1085,
+  3123, 3035, 1467, 64, -851, -2169, -3210, -2334, 128, 2064, 2330, 2105, 1877, 681, -1687, -3311,
+  -2641, -916, 283, 1103, 2414, 3129, 1740, -814, -2313, -2190, -1918, -1616, -148, 2230, 3333, 2137,
+  406, -545, -1327, -2616, -2930, -1067, 1416, 2404, 1985, 1742, 1329, -415, -2681, -3182, -1565, 27,
+  732, 1540, 2765, 2604, 350, -1894, -2349, -1753, -1587, -1002, 993, 3006, 2867, 976, -357, -864,
+  -1756, -2841, -2152, 365, 2218, 2174, 1532, 1448, 623, -1562, -3178, -2413, -420, 579, 972, 1975,
+  2822, 1588, -1030, -2372, -1919, -1350, -1310, -185, 2087, 3177, 1860, -57, -700, -1083, -2190, -2685,
+  -938, 1596, 2359, 1630, 1223, 1149, -309, -2530, -2999, -1260, 422, 746, 1223, 2378, 2418, 242,
+  -2022, -2203, -1353, -1149, -939, 844, 2850, 2658, 666, -660, -753, -1404, -2509, -2016, 450, 2280,
+  1941, 1127, 1110, 659, -1388, -3017, -2184, -134, 774, 760, 1624, 2551, 1495, -1085, -2363, -1623,
+  -977, -1078, -296, 1903, 3011, 1623, -295, -787, -802, -1864, -2476, -882, 1613, 2283, 1300, 909,
+  1019, -145, -2343, -2830, -1032, 593, 735, 905, 2096, 2266, 223, -1995, -2070, -1021, -910, -896,
+  645, 2667, 2491, 467, -754, -664, -1078, -2280, -1916, 432, 2209, 1771, 821, 953, 686, -1170,
+  -2842, -2030, 21, 793, 618, 1313, 2378, 1442, -1029, -2255, -1439, -716, -998, -375, 1677, 2850,
+  1495, -394, -741, -632, -1583, -2358, -875, 1519, 2150, 1127, 704, 1005, -30, -2117, -2690, -943,
+  635, 643, 730, 1853, 2199, 259, -1870, -1931, -876, -763, -936, 506, 2449, 2384, 426, -745,
+  -547, -913, -2078, -1900, 353, 2064, 1646, 717, 858, 764, -1017, -2640, -1968, 11, 748, 495,
+  1168, 2216, 1476, -912, -2105, -1346, -656, -944, -481, 1516, 2674, 1488, -338, -679, -520, -1462,
+  -2236, -959, 1375, 2016, 1079, 683, 979, 97, -1957, -2556, -996, 545, 584, 637, 1753, 2119,
+  392, -1713, -1834, -880, -769, -926, 364, 2298, 2304, 539, -642, -509, -842, -1998, -1864, 177,
+  1915, 1604, 767, 875, 764, -861, -2512, -1953, -152, 655, 491, 1114, 2156, 1487, -703, -1988,
+  -1370, -739, -958, -490, 1352, 2585, 1545, -144, -621, -552, -1417, -2196, -1020, 1150, 1956, 1170,
+  780, 977, 114, -1791, -2520, -1123, 347, 580, 701, 1711, 2105, 501, -1495, -1850, -1027, -857,
+  -904, 333, 2143, 2337, 723, -470, -569, -925, -1952, -1883, 28, 1733, 1707, 950, 933, 724,
+  -816, -2383, -2064, -372, 538, 616, 1200, 2106, 1546, -529, -1869, -1561, -931, -971, -438, 1292,
+  2500, 1735, 80, -583, -732, -1490, -2147, -1123, 975, 1924, 1435, 949, 938, 62, -1724, -2497,
+  -1381, 153, 635, 916, 1757, 2065, 645, -1349, -1920, -1343, -975, -815, 375, 2081, 2389, 1027,
+  -343, -718, -1151, -1965, -1864, -146, 1644, 1883, 1283, 978, 595, -839, -2343, -2197, -689, 507,
+  847, 1410, 2086, 1558, -344, -1868, -1831, -1242, -929, -287, 1296, 2502, 1942, 372, -667, -1022,
+  -1662, -2104, -1171, 806, 2029, 1774, 1201, 810, -91, -1715, -2558, -1644, -72, 840, 1233, 1874,
+  2012, 726, -1226, -2139, -1714, -1136, -612, 513, 2072, 2520, 1316, -220, -1035, -1459, -2022, -1815,
+  -248, 1598, 2210, 1642, 1028, 338, -952, -2352, -2397, -965, 513, 1251, 1677, 2086, 1526, -243,
+  -1922, -2242, -1545, -862, -1, 1379, 2546, 2200, 592, -813, -1477, -1860, -2059, -1161, 732, 2198,
+  2235, 1407, 633, -380, -1774, -2652, -1934, -196, 1121, 1697, 1989, 1938, 735, -1209, -2422, -2178,
+  -1217, -345, 783, 2118, 2670, 1604, -223, -1430, -1892, -2049, -1731, -264, 1664, 2588, 2060, 969,
+  10, -1187, -2402, -2598, -1210, 662, 1724, 2040, 2032, 1444, -240, -2089, -2685, -1871, -663, 356,
+  1576, 2615, 2435, 754, -1110, -1985, -2128, -1938, -1088, 767, 2469, 2699, 1604, 311, -735, -1935,
+  -2751, -2176, -239, 1550, 2192, 2148, 1771, 669, -1306, -2788, -2613, -1262, 72, 1110, 2254, 2800,
+  1817, -323, -1959, -2328, -2096, -1535, -195, 1842, 3023, 2417, 853, -467, -1471, -2524, -2751, -1355,
+  914, 2310, 2382, 1978, 1235, -330, -2355, -3151, -2108, -398, 856, 1808, 2735, 2591, 796, -1504,
+  -2578, -2351, -1800, -873, 896, 2819, 3148, 1690, -81, -1223, -2116, -2875, -2307, -152, 2060, 2743,
+  2240, 1569, 449, -1489, -3203, -2998, -1181, 556, 1561, 2392, 2925, 1891, -551, -2546, -2794, -2061,
+  -1290, 38, 2089, 3471, 2693, 609, -1004, -1865, -2627, -2866, -1341, 1279, 2926, 2729, 1827, 961,
+  -585, -2664, -3591, -2239, -7, 1406, 2137, 2809, 2676, 668, -1987, -3172, -2559, -1552, -580, 1184,
+  3177, 3536, 1657, -587, -1753, -2378, -2921, -2339, 102, 2628, 3268, 2303, 1245, 140, -1815, -3583,
+  -3290, -980, 1141, 2042, 2588, 2938, 1845, -932, -3154, -3210, -1983, -909, 363, 2451, 3840, 2855,
+  250, -1626, -2279, -2761, -2834, -1197, 1770, 3526, 3010, 1622, 540, -928, -3051, -3910, -2248, 485,
+  2028, 2473, 2883, 2583, 415, -2561, -3717, -2691, -1238, -131, 1544, 3568, 3767, 1503, -1178, -2340,
+  -2630, -2931, -2169, 464, 3245, 3717, 2283, 844, -328, -2188, -3949, -3401, -670, 1791, 2568, 2753,
+  2878, 1584, -1390, -3771, -3532, -1819, -441, 843, 2823, 4149, 2822, -196, -2297, -2724, -2837, -2695,
+  -840, 2299, 4098, 3186, 1328, 23, -1412, -3403, -4128, -2063, 1038, 2682, 2822, 2867, 2357, -34,
+  -3126, -4205, -2712, -834, 421, 2021, 3874, 3867, 1170, -1803, -2947, -2875, -2818, -1849, 991, 3806,
+  4089, 2151, 348, -899, -2640, -4181, -3365, -205, 2450, 3102, 2887, 2664, 1172, -1970, -4288, -3766,
+  -1544, 126, 1417, 3229, 4280, 2644, -767, -2954, -3166, -2854, -2376, -345, 2899, 4534, 3271, 926,
+  -596, -1970, -3737, -4136, -1747, 1682, 3304, 3156, 2759, 1933, -594, -3708, -4531, -2647, -321, 1070,
+  2540, 4109, 3739, 732, -2486, -3507, -3088, -2583, -1328, 1587, 4334, 4284, 1942, -256, -1558, -3094,
+  -4294, -3098, 330, 3139, 3577, 2967, 2299, 570, -2567, -4728, -3821, -1202, 802, 2060, 3589, 4253,
+  2248, -1368, -3617, -3535, -2791, -1886, 312, 3461, 4862, 3183, 464, -1320, -2569, -3976, -3962, -1240,
+  2318, 3915, 3403, 2548, 1331, -1273, -4199, -4729, -2421, 243, 1818, 3061, 4203, 3420, 143, -3125,
+  -4042, -3196, -2221, -635, 2250, 4724, 4346, 1586, -904, -2300, -3505, -4228, -2650, 971, 3753, 4015,
+  2924, 1791, -182, -3174, -4995, -3746, -729, 1513, 2763, 3858, 4021, 1693, -2030, -4184, -3858, -2585,
+  -1247, 1084, 3975, 4993, 2978, -113, -2070, -3194, -4076, -3572, -612, 2971, 4413, 3592, 2175, 585,
+  -2020, -4590, -4722, -2095, 908, 2576, 3570, 4118, 2892, -525, -3745, -4452, -3234, -1682, 180, 2927,
+  4971, 4205, 1152, -1640, -3029, -3861, -3952, -2014, 1644, 4318, 4319, 2795, 1101, -1023, -3739, -5089,
+  -3483, -198, 2297, 3423, 4029, 3565, 989, -2678, -4676, -4038, -2282, -430, 1900, 4395, 4936, 2606,
+  -727, -2873, -3742, -4042, -2960, 121, 3568, 4819, 3629, 1694, -320, -2758, -4844, -4524, -1629, 1592,
+  3364, 3964, 3871, 2160, -1247, -4273, -4758, -3113, -1035, 1125, 3539, 5049, 3883, 605, -2375, -3762,
+  -4064, -3502, -1206, 2320, 4765, 4511, 2504, 309, -1952, -4187, -4996, -3057, 419, 3059, 4055, 4014,
+  2935, 153, -3281, -5032, -4100, -1813, 470, 2755, 4652, 4687, 2097, -1401, -3632, -4228, -3797, -2190,
+  938, 4080, 5076, 3545, 1053, -1279, -3484, -4899, -4143, -1053, 2308, 4081, 4262, 3400, 1299, -2003,
+  -4683, -4908, -2868, -239, 2086, 4089, 4907, 3397, -23, -3114, -4394, -4140, -2827, -309, 2984, 5068,
+  4542, 2089, -610, -2851, -4529, -4675, -2494, 1085, 3797, 4557, 3852, 2097, -725, -3830, -5226, -4000,
+  -1229, 1466, 3532, 4770, 4215, 1480, -2094, -4336, -4554, -3393, -1239, 1747, 4503, 5159, 3302, 312,
+  -2295, -4085, -4794, -3554, -403, 3014, 4713, 4377, 2773, 295, -2704, -4976, -4876, -2473, 634, 3059,
+  4475, 4596, 2727, -690, -3813, -4910, -4019, -2012, 686, 3549, 5234, 4390, 1539, -1574, -3716, -4676,
+  -4188, -1775, 1757, 4463, 4913, 3486, 1145, -1653, -4243, -5270, -3720, -531, 2468, 4230, 4673, 3592,
+  740, -2758, -4937, -4714, -2793, -211, 2561, 4761, 5085, 2888, -515, -3274, -4569, -4466, -2836, 336,
+  3654, 5212, 4310, 1969, -742, -3367, -5083, -4685, -1922, 1555, 3950, 4714, 4068, 1955, -1411, -4411,
+  -5267, -3713, -1052, 1669, 4040, 5199, 4083, 856, -2542, -4458, -4657, -3499, -986, 2446, 4993, 5092,
+  2944, 87, -2527, -4554, -5103, -3296, 269, 3428, 4770, 4405, 2788, -37, -3402, -5369, -4685, -2040,
+  877, 3281, 4894, 4797, 2347, -1404, -4163, -4870, -3973, -1965, 1077, 4238, 5512, 4057, 1044, -1795,
+  -3905, -5049, -4283, -1269, 2493, 4708, 4757, 3389, 1061, -2099, -4916, -5405, -3234, -11, 2624, 4380,
+  5012, 3574, 105, -3480, -5031, -4443, -2681, -107, 3067, 5395, 5040, 2257, -1007, -3334, -4695, -4780,
+  -2685, 1094, 4308, 5117, 3951, 1882, -870, -3940, -5644, -4426, -1178, 1956, 3903, 4845, 4353, 1645,
+  -2269, -4930, -4966, -3315, -1021, 1840, 4679, 5633, 3588, 57, -2795, -4319, -4825, -3732, -490, 3355,
+  5308, 4596, 2571, 124, -2773, -5242, -5351, -2568, 1043, 3491, 4579, 4633, 2929, -729, -4290, -5423,
+  -4036, -1755, 785, 3635, 5588, 4797, 1423, -2062, -4024, -4684, -4266, -1962, 1953, 5014, 5273, 3328,
+  900, -1686, -4389, -5683, -3991, -218, 2952, 4388, 4637, 3724, 861, -3114, -5484, -4875, -2517, -32,
+  2554, 4995, 5506, 2972, -976, -3674, -4586, -4440, -3010, 330, 4143, 5670, 4265, 1645, -828, -3366,
+  -5409, -5046, -1797, 2089, 4207, 4626, 4094, 2134, -1555, -4974, -5565, -3489, -754, 1662, 4091, 5594,
+  4316, 534, -3062, -4545, -4520, -3597, -1119, 2750, 5552, 5183, 2599, -125, -2457, -4694, -5520, -3347,
+  740, 3850, 4694, 4280, 2951, -3, -3842, -5840, -4558, -1650, 970, 3195, 5135, 5169, 2190, -1949,
+  -4426, -4670, -3912, -2161, 1183, 4761, 5821, 3739, 691, -1766, -3856, -5376, -4542, -912, 3022, 4778,
+  4494, 3421, 1238, -2361, -5445, -5499, -2785, 240, 2501, 4414, 5382, 3660, -408, -3905, -4913, -4186,
+  -2807, -207, 3470, 5846, 4905, 1757, -1112, -3167, -4835, -5131, -2567, 1690, 4560, 4849, 3762, 2075,
+  -893, -4439, -5937, -4084, -714, 1907, 3751, 5087, 4614, 1322, -2856, -4969, -4614, -3235, -1231, 2014,
+  5202, 5712, 3097, -293, -2614, -4237, -5135, -3842, 0, 3841, 5133, 4235, 2612, 292, -3093, -5703,
+  -5192, -2011, 1227, 3229, 4604, 4954, 2845, -1316, -4596, -5069, -3740, -1899, 715, 4066, 5905, 4417,
+  893, -2062, -3746, -4824, -4529, -1676, 2547, 5093, 4806, 3150, 1101, -1750, -4865, -5794, -3443, 199,
+  2783, 4157, 4870, 3863, 402, -3618, -5326, -4376, -2481, -232, 2762, 5435, 5377, 2339, -1215, -3383,
+  -4451, -4718, -2976, 901, 4474, 5304, 3816, 1746, -691, -3693, -5730, -4687, -1175, 2120, 3861, 4611,
+  4352, 1908, -2151, -5074, -5054, -3157, -954, 1635, 4483, 5727, 3771, 16, -2893, -4215, -4617, -3769,
+  -717, 3275, 5403, 4611, 2423, 117, -2561, -5076, -5424, -2695, 1079, 3520, 4440, 4453, 2981, -528,
+  -4207, -5461, -4013, -1637, 748, 3421, 5427, 4842, 1526, -2066, -4000, -4531, -4103, -2019, 1752, 4902,
+  5268, 3299, 815, -1619, -4162, -5506, -4020, -335, 2913, 4330, 4476, 3566, 931, -2882, -5331, -4855,
+  -2502, 29, 2463, 4736, 5304, 3015, -816, -3601, -4513, -4267, -2848, 226, 3853, 5489, 4261, 1653,
+  -876, -3242, -5098, -4832, -1889, 1874, 4120, 4549, 3897, 1976, -1384, -4613, -5383, -3526, -775, 1705,
+  3912, 5220, 4119, 711, -2800, -4468, -4435, -3364, -985, 2476, 5128, 5040, 2690, -107, -2489, -4434,
+  -5087, -3212, 456, 3566, 4646, 4170, 2678, -73, -3440, -5382, -4492, -1789, 974, 3198, 4768, 4705,
+  2167, -1555, -4153, -4656, -3754, -1860, 1142, 4224, 5377, 3779, 855, -1801, -3797, -4891, -4095, -1046,
+  2541, 4555, 4503, 3194, 944, -2163, -4791, -5128, -2941, 81, 2563, 4252, 4787, 3294, -92, -3379,
+  -4769, -4191, -2503, 29, 3079, 5119, 4662, 2017, -992, -3232, -4534, -4460, -2350, 1190, 4044, 4795,
+  3727, 1703, -1009, -3843, -5204, -4012, -1046, 1850, 3779, 4622, 3928, 1317, -2201, -4520, -4639, -3124,
+  -825, 1944, 4419, 5054, 3216, 61, -2627, -4176, -4508, -3220, -248, 3086, 4800, 4309, 2401, -90,
+  -2788, -4785, -4687, -2312, 902, 3293, 4401, 4197, 2377, -806, -3815, -4879, -3815, -1585, 999, 3498,
+  4931, 4129, 1337, -1810, -3821, -4440, -3704, -1444, 1798, 4367, 4761, 3175, 709, -1856, -4043, -4862,
+  -3412, -331, 2630, 4186, 4291, 3058, 469, -2692, -4726, -4450, -2415, 186, 2622, 4405, 4589, 2569,
+  -670, -3329, -4370, -3961, -2294, 506, 3454, 4884, 3960, 1564, -1058, -3260, -4574, -4133, -1634, 1626,
+  3876, 4364, 3471, 1453, -1439, -4062, -4837, -3309, -663, 1864, 3747, 4554, 3516, 645, -2500, -4246,
+  -4170, -2850, -574, 2298, 4494, 4585, 2524, -245, -2567, -4069, -4353, -2765, 361, 3253, 4421, 3804,
+  2133, -305, -3053, -4736, -4138, -1643, 1115, 3139, 4221, 3986, 1909, -1343, -3849, -4394, -3288, -1357,
+  1153, 3679, 4778, 3513, 707, -1904, -3560, -4209, -3471, -979, 2261, 4260, 4170, 2657, 559, -1943,
+  -4157, -4614, -2737, 235, 2576, 3823, 4043, 2827, 8, -3070, -4464, -3768, -1949, 230, 2650, 4468,
+  4247, 1846, -1133, -3102, -3930, -3737, -2075, 964, 3731, 4452, 3218, 1203, -985, -3256, -4596, -3689,
+  -886, 1940, 3470, 3892, 3304, 1239, -1897, -4208, -4228, -2557, -454, 1684, 3742, 4530, 2961, -91,
+  -2616, -3675, -3723, -2759, -345, 2746, 4473, 3813, 1830, -268, -2315, -4090, -4265, -2097, 1030, 3133,
+  3726, 3440, 2116, -575, -3466, -4513, -3237, -1079, 942, 2862, 4283, 3804, 1142, -1878, -3475, -3639,
+  -3057, -1391, 1483, 4016, 4327, 2546, 343, -1554, -3315, -4305, -3162, -150, 2590, 3642, 3437, 2587,
+  601, -2337, -4363, -3933, -1786, 347, 2096, 3660, 4145, 2366, -823, -3133, -3647, -3141, -2039, 231,
+  3091, 4484, 3361, 1007, -969, -2564, -3882, -3797, -1455, 1717, 3487, 3510, 2770, 1422, -1073, -3702,
+  -4373, -2656, -253, 1513, 2953, 3964, 3268, 481, -2481, -3650, -3261, -2338, -747, 1892, 4129, 4038,
+  1870, -439, -1976, -3258, -3891, -2575, 499, 3076, 3635, 2928, 1855, 26, -2643, -4343, -3508, -1058,
+  1045, 2361, 3469, 3651, 1749, -1426, -3475, -3465, -2536, -1326, 720, 3284, 4329, 2824, 270, -1554,
+  -2672, -3573, -3242, -835, 2241, 3671, 3175, 2107, 755, -1464, -3772, -4086, -2039, 451, 1964, 2912,
+  3555, 2672, -115, -2898, -3672, -2799, -1651, -146, 2171, 4072, 3636, 1208, -1075, -2283, -3079, -3400,
+  -1960, 1042, 3365, 3502, 2371, 1176, -489, -2802, -4160, -3011, -389, 1585, 2520, 3167, 3100, 1142,
+  -1886, -3623, -3194, -1917, -682, 1133, 3316, 4028, 2262, -369, -1978, -2688, -3165, -2652, -263, 2595,
+  3677, 2789, 1456, 169, -1762, -3676, -3685, -1445, 1030, 2261, 2793, 3059, 2068, -623, -3131, -3544,
+  -2325, -999, 360, 2345, 3851, 3156, 616, -1570, -2449, -2837, -2838, -1371, 1461, 3468, 3256, 1837,
+  546, -899, -2845, -3827, -2484, 171, 1980, 2558, 2816, 2495, 597, -2196, -3599, -2852, -1350, -98,
+  1432, 3226, 3601, 1718, -872, -2264, -2602, -2721, -2032, 211, 2785, 3536, 2374, 880, -348, -1937,
+  -3459, -3191, -915, 1456, 2436, 2591, 2543, 1462, -1002, -3195, -3303, -1861, -434, 793, 2387, 3521,
+  2626, 128, -1907, -2513, -2531, -2272, -809, 1724, 3413, 2937, 1345, 14, -1229, -2752, -3405, -1949,
+  595, 2224, 2515, 2418, 1905, 109, -2334, -3440, -2478, -850, 383, 1646, 3004, 3115, 1211, -1217,
+  -2415, -2458, -2247, -1448, 599, 2795, 3292, 1966, 388, -762, -2024, -3119, -2674, -461, 1717, 2497,
+  2354, 2011, 915, -1269, -3088, -2999, -1438, 34, 1123, 2342, 3086, 2113, -252, -2084, -2490, -2208,
+  -1707, -331, 1861, 3206, 2597, 922, -418, -1459, -2576, -2903, -1473, 890, 2322, 2413, 2020, 1334,
+  -273, -2339, -3157, -2123, -437, 766, 1762, 2706, 2581, 799, -1425, -2442, -2281, -1788, -903, 861,
+  2679, 2961, 1614, -5, -1080, -2017, -2719, -2144, -133, 1843, 2460, 2106, 1510, 427, -1398, -2871,
+  -2647, -1100, 401, 1360, 2209, 2612, 1623, -485, -2138, -2396, -1894, -1186, 69, 1855, 2914, 2246,
+  604, -750, -1602, -2323, -2388, -1053, 1029, 2317, 2265, 1648, 824, -560, -2206, -2821, -1793, -142,
+  1053, 1799, 2348, 2065, 471, -1478, -2391, -2083, -1371, -432, 1019, 2440, 2612, 1315, -276, -1310,
+  -1941, -2281, -1663, 91, 1825, 2374, 1858, 1065, 27, -1421, -2553, -2311, -835, 646, 1520, 2019,
+  2123, 1210, -605, -2067, -2279, -1599, -737, 372, 1747, 2550, 1946, 373, -966, -1679, -2029, -1887,
+  -734, 1054, 2211, 2121, 1312, 397, -745, -1986, -2446, -1539, 60, 1233, 1782, 1969, 1589, 260,
+  -1427, -2265, -1911, -1004, -56, 1076, 2134, 2256, 1112, -454, -1444, -1827, -1842, -1247, 191, 1719,
+  2238, 1656, 683, -272, -1351, -2195, -2000, -680, 804, 1596, 1811, 1660, 882, -604, -1929, -2139,
+  -1367, -361, 571, 1563, 2176, 1694, 256, -1102, -1686, -1738, -1434, -512, 969, 2062, 1976, 1054,
+  50, -831, -1712, -2088, -1352, 148, 1343, 1713, 1615, 1181, 150, -1282, -2120, -1756, -727, 236,
+  1044, 1800, 1943, 986, -523, -1521, -1679, -1453, -915, 194, 1539, 2105, 1489, 402, -487, -1210,
+  -1836, -1751, -607, 860, 1631, 1590, 1267, 646, -515, -1741, -2021, -1185, -92, 694, 1330, 1827,
+  1517, 222, -1148, -1670, -1457, -1071, -382, 813, 1885, 1870, 858, -186, -854, -1414, -1779, -1248,
+  158, 1376, 1640, 1295, 876, 125, -1085, -1967, -1657, -523, 420, 970, 1469, 1696, 946, -522,
+  -1536, -1550, -1120, -690, 127, 1330, 1983, 1390, 200, -603, -1050, -1505, -1578, -615, 855, 1619,
+  1411, 948, 515, -377, -1542, -1929, -1082, 93, 733, 1106, 1525, 1422, 262, -1143, -1627, -1242,
+  -792, -347, 629, 1713, 1803, 750, -341, -814, -1152, -1531, -1223, 103, 1370, 1563, 1062, 658,
+  177, -882, -1833, -1607, -414, 532, 858, 1199, 1517, 977, -464, -1525, -1439, -890, -548, 4,
+  1134, 1890, 1351, 96, -662, -881, -1254, -1473, -687, 804, 1599, 1274, 742, 452, -207, -1372,
+  -1875, -1047, 183, 735, 902, 1317, 1387, 356, -1102, -1593, -1090, -629, -359, 436, 1583, 1780,
+  717, -408, -763, -937, -1380, -1247, 2, 1341, 1515, 910, 550, 252, -691, -1748, -1608, -383,
+  569, 765, 995, 1431, 1046, -370, -1504, -1380, -753, -500, -115, 963, 1851, 1366, 71, -667,
+  -762, -1082, -1451, -782, 725, 1586, 1210, 634, 462, -65, -1237, -1875, -1071, 200, 710, 774,
+  1190, 1420, 462, -1042, -1585, -1029, -557, -416, 293, 1492, 1814, 746, -413, -716, -817, -1306,
+  -1323, -99, 1302, 1513, 860, 519, 341, -565, -1703, -1666, -415, 563, 706, 900, 1409, 1149,
+  -283, -1486, -1386, -722, -506, -219, 868, 1848, 1441, 103, -652, -704, -1021, -1474, -896, 660,
+  1588, 1227, 626, 496, 37, -1180, -1909, -1156, 168, 693, 730, 1169, 1477, 573, -1003, -1607,
+  -1061, -572, -467, 208, 1476, 1877, 834, -385, -705, -797, -1322, -1401, -197, 1291, 1556, 910,
+  551, 394, -508, -1725, -1750, -503, 544, 711, 909, 1455, 1234, -206, -1505, -1452, -788, -545,
+  -260, 844, 1904, 1539, 185, -650, -733, -1060, -1539, -977, 609, 1637, 1316, 703, 532, 56,
+  -1190, -1992, -1261, 98, 716, 788, 1232, 1550, 640, -982, -1688, -1170, -651, -486, 218, 1516,
+  1979, 941, -336, -761, -884, -1400, -1470, -245, 1302, 1669, 1034, 621, 386, -548, -1791, -1866,
+  -603, 525, 805, 1021, 1536, 1291, -183, -1550, -1596, -919, -592, -218, 911, 1989, 1663, 270,
+  -670, -868, -1187, -1612, -1015, 612, 1719, 1487, 827, 543, -24, -1279, -2090, -1388, 39, 785,
+  959, 1360, 1604, 656, -1015, -1808, -1361, -753, -451, 331, 1619, 2087, 1062, -314, -883, -1083,
+  -1515, -1498, -237, 1366, 1827, 1231, 683, 300, -687, -1901, -1978, -710, 552, 981, 1232, 1624,
+  1288, -215, -1649, -1786, -1106, -600, -81, 1067, 2100, 1775, 351, -756, -1091, -1392, -1661, -982,
+  669, 1856, 1702, 985, 485, -203, -1439, -2198, -1494, -4, 936, 1217, 1540, 1608, 596, -1098,
+  -1983, -1587, -862, -323, 541, 1773, 2189, 1156, -323, -1101, -1356, -1651, -1455, -153, 1478, 2037,
+  1451, 725, 104, -912, -2041, -2072, -780, 625, 1258, 1499, 1703, 1201, -319, -1792, -2024, -1297,
+  -561, 172, 1290, 2221, 1859, 387, -902, -1413, -1627, -1674, -857, 791, 2031, 1956, 1123, 358,
+  -498, -1646, -2298, -1563, 10, 1157, 1563, 1720, 1553, 442, -1238, -2191, -1838, -926, -110, 857,
+  1950, 2266, 1203, -399, -1392, -1700, -1759, -1336, 21, 1638, 2272, 1676, 697, -185, -1226, -2181,
+  -2129, -796, 774, 1605, 1810, 1725, 1029, -506, -1974, -2277, -1471, -432, 518, 1581, 2319, 1894,
+  358, -1128, -1795, -1879, -1607, -646, 987, 2235, 2209, 1223, 128, -876, -1895, -2356, -1575, 95,
+  1457, 1951, 1889, 1402, 205, -1441, -2415, -2070, -930, 213, 1240, 2146, 2287, 1185, -552, -1755,
+  -2062, -1828, -1112, 271, 1849, 2508, 1863, 592, -581, -1587, -2316, -2115, -739, 1000, 2011, 2114,
+  1686, 748, -759, -2193, -2513, -1587, -214, 961, 1895, 2393, 1848, 254, -1428, -2216, -2097, -1463,
+  -327, 1236, 2461, 2426, 1246, -196, -1335, -2143, -2371, -1496, 258, 1822, 2354, 1999, 1163, -133,
+  -1683, -2643, -2247, -844, 626, 1683, 2317, 2249, 1070, -779, -2167, -2413, -1817, -796, 611, 2081,
+  2730, 1975, 390, -1057, -1983, -2405, -2031, -582, 1294, 2446, 2382, 1554, 378, -1088, -2415, -2714,
+  -1613, 101, 1467, 2220, 2402, 1722, 48, -1782, -2641, -2255, -1217, 74, 1546, 2670, 2588, 1167,
+  -611, -1836, -2380, -2306, -1330, 517, 2222, 2735, 2030, 820, -542, -1967, -2833, -2348, -650, 1116,
+  2144, 2456, 2119, 863, -1093, -2591, -2717, -1715, -380, 1010, 2337, 2891, 1996, 81, -1589, -2374,
+  -2444, -1844, -334, 1658, 2864, 2580, 1323, -85, -1460, -2639, -2831, -1536, 514, 2007, 2518, 2345,
+  1486, -243, -2184, -3021, -2326, -872, 556, 1881, 2857, 2646, 982, -1106, -2346, -2570, -2163, -1050,
+  850, 2643, 3045, 1964, 383, -1019, -2258, -2977, -2330, -355, 1664, 2590, 2531, 1900, 544, -1463,
+  -3006, -2927, -1513, 121, 1459, 2577, 2981, 1886, -315, -2155, -2729, -2407, -1561, 20, 2054, 3244,
+  2668, 995, -619, -1866, -2824, -2856, -1326, 994, 2553, 2760, 2202, 1149, -629, -2589, -3335, -2278,
+  -439, 1096, 2231, 2982, 2593, 670, -1643, -2837, -2689, -1924, -669, 1259, 3036, 3265, 1778, -128,
+  -1537, -2542, -3033, -2189, 51, 2224, 2995, 2525, 1580, 129, -1884, -3359, -3030, -1196, 681, 1934,
+  2788, 2961, 1651, -800, -2704, -3024, -2278, -1173, 461, 2470, 3531, 2640, 565, -1197, -2280, -2955,
+  -2752, -997, 1534, 3054, 2931, 1961, 708, -1083, -2981, -3530, -2115, 81, 1661, 2569, 3027, 2400,
+  255, -2207, -3259, -2728, -1585, -190, 1712, 3379, 3348, 1485, -708, -2064, -2793, -2987, -1904, 537,
+  2779, 3312, 2432, 1157, -375, -2319, -3630, -2988, -787, 1289, 2400, 2944, 2819, 1278, -1334, -3215,
+  -3219, -2061, -685, 972, 2866, 3707, 2468, 62, -1803, -2667, -3009, -2513, -545, 2086, 3491, 2994,
+  1631, 171, -1584, -3316, -3594, -1817, 649, 2237, 2861, 2974, 2065, -258, -2747, -3597, -2656, -1158,
+  376, 2183, 3631, 3288, 1074, -1312, -2584, -2979, -2824, -1481, 1088, 3275, 3532, 2229, 651, -950,
+  -2737, -3779, -2802, -285, 1899, 2843, 3015, 2547, 780, -1895, -3638, -3309, -1738, -119, 1534, 3209,
+  3739, 2161, -506, -2391, -3013, -2958, -2137, 7, 2627, 3818, 2951, 1202, -432, -2108, -3562, -3501,
+  -1403, 1255, 2776, 3096, 2799, 1596, -840, -3237, -3809, -2482, -639, 994, 2644, 3762, 3070, 574,
+  -1928, -3051, -3091, -2526, -936, 1670, 3687, 3619, 1932, 62, -1556, -3111, -3783, -2466, 277, 2497,
+  3216, 2995, 2133, 183, -2445, -3951, -3268, -1329, 518, 2102, 3473, 3610, 1724, -1103, -2944, -3276,
+  -2802, -1620, 627, 3117, 4016, 2782, 698, -1092, -2609, -3698, -3241, -886, 1860, 3262, 3235, 2507,
+  996, -1451, -3641, -3884, -2193, -57, 1650, 3051, 3758, 2692, 3, -2514, -3449, -3094, -2105, -282,
+  2240, 3985, 3568, 1534, -576, -2177, -3397, -3635, -1989, 876, 3041, 3508, 2855, 1598, -494, -2943,
+  -4129, -3094, -835, 1187, 2656, 3619, 3322, 1171, -1702, -3424, -3447, -2519, -993, 1292, 3516, 4069,
+  2494, 125, -1765, -3066, -3690, -2829, -286, 2435, 3659, 3271, 2085, 307, -2067, -3923, -3811, -1801,
+  575, 2295, 3383, 3592, 2177, -616, -3043, -3745, -2987, -1559, 435, 2773, 4137, 3376, 1051, -1245,
+  -2762, -3581, -3318, -1400, 1485, 3503, 3689, 2601, 948, -1200, -3366, -4148, -2793, -277, 1866, 3148,
+  3638, 2870, 540, -2277, -3804, -3499, -2121, -270, 1947, 3809, 3958, 2096, -492, -2424, -3434, -3540,
+  -2267, 356, 2955, 3942, 3185, 1554, -453, -2634, -4073, -3580, -1320, 1229, 2902, 3599, 3277, 1536,
+  -1239, -3491, -3918, -2757, -915, 1191, 3221, 4142, 3039, 503, -1912, -3283, -3628, -2854, -716, 2062,
+  3865, 3741, 2228, 220, -1908, -3671, -4015, -2365, 321, 2520, 3551, 3507, 2284, -152, -2788, -4069,
+  -3420, -1613, 506, 2566, 3958, 3698, 1594, -1122, -3033, -3689, -3233, -1593, 1021, 3382, 4100, 2970,
+  928, -1235, -3129, -4063, -3212, -761, 1871, 3434, 3686, 2810, 813, -1847, -3823, -3961, -2404, -196,
+  1934, 3565, 3981, 2582, -96, -2540, -3706, -3533, -2251, 16, 2591, 4095, 3661, 1744, -556, -2567,
+  -3848, -3717, -1841, 943, 3108, 3835, 3230, 1581, -854, -3220, -4190, -3214, -1010, 1299, 3103, 3963,
+  3286, 1022, -1748, -3552, -3810, -2785, -831, 1660, 3707, 4107, 2635, 230, -1999, -3513, -3902, -2708,
+  -160, 2479, 3853, 3628, 2214, 36, -2396, -4035, -3852, -1947, 566, 2623, 3775, 3671, 2013, -708,
+  -3109, -3996, -3292, -1543, 767, 3031, 4191, 3435, 1174, -1344, -3141, -3877, -3280, -1230, 1548, 3610,
+  3971, 2815, 801, -1540, -3539, -4170, -2870, -348, 2069, 3527, 3813, 2750, 391, -2327, -3961, -3776,
+  -2215, -24, 2249, 3901, 3973, 2180, -497, -2706, -3763, -3590, -2103, 469, 3012, 4142, 3417, 1521,
+  -752, -2867, -4102, -3606, -1390, 1324, 3226, 3838, 3219, 1366, -1317, -3574, -4143, -2907, -766, 1494,
+  3369, 4135, 3080, 532, -2092, -3602, -3753, -2719, -569, 2119, 3985, 3958, 2272, -14, -2171, -3738,
+  -3997, -2415, 355, 2765, 3818, 3516, 2110, -260, -2842, -4222, -3595, -1543, 782, 2757, 3960, 3689,
+  1634, -1230, -3309, -3869, -3141, -1419, 1089, 3453, 4270, 3069, 757, -1506, -3234, -4028, -3219, -769,
+  2051, 3697, 3756, 2648, 668, -1887, -3922, -4122, -2406, 47, 2157, 3587, 3935, 2601, -141, -2774,
+  -3913, -3491, -2059, 115, 2622, 4221, 3780, 1642, -830, -2712, -3806, -3682, -1856, 1052, 3362, 3951,
+  3093, 1398, -905, -3261, -4330, -3261, -816, 1557, 3156, 3883, 3271, 1012, -1920, -3785, -3816, -2585,
+  -687, 1674, 3772, 4237, 2590, -26, -2199, -3478, -3815, -2713, -106, 2696, 4024, 3523, 1993, -51,
+  -2394, -4126, -3942, -1803, 842, 2734, 3672, 3600, 2022, -819, -3340, -4071, -3094, -1341, 794, 3034,
+  4297, 3455, 944, -1594, -3150, -3735, -3240, -1223, 1716, 3816, 3931, 2557, 652, -1519, -3564, -4270,
+  -2801, -61, 2249, 3438, 3667, 2739, 349, -2536, -4100, -3621, -1942, 52, 2202, 3953, 4038, 2014,
+  -798, -2785, -3598, -3468, -2111, 562, 3234, 4181, 3166, 1278, -752, -2818, -4175, -3607, -1139, 1590,
+  3188, 3632, 3138, 1372, -1464, -3769, -4061, -2598, -589, 1429, 3340, 4210, 2995, 226, -2279, -3453,
+  -3543, -2684, -550, 2308, 4113, 3755, 1950, -101, -2065, -3740, -4045, -2236, 674, 2838, 3583, 3335,
+  2111, -321, -3046, -4247, -3290, -1256, 774, 2640, 3991, 3682, 1370, -1512, -3251, -3583, -3014, -1435,
+  1200, 3635, 4170, 2699, 548, -1413, -3132, -4072, -3134, -448, 2247, 3513, 3462, 2583, 676, -2041,
+  -4040, -3894, -2021, 150, 2004, 3517, 3968, 2425, -478, -2847, -3626, -3229, -2050, 139, 2796, 4239,
+  3443, 1294, -817, -2533, -3772, -3674, -1595, 1354, 3292, 3599, 2894, 1426, -972, -3420, -4223, -2850,
+  -554, 1438, 2981, 3876, 3196, 691, -2136, -3573, -3447, -2465, -727, 1783, 3877, 3999, 2156, -170,
+  -1998, -3333, -3814, -2556, 236, 2785, 3692, 3183, 1950, -24, -2528, -4137, -3586, -1403, 852, 2486,
+  3569, 3576, 1784, -1132, -3277, -3659, -2822, -1359, 798, 3163, 4188, 3017, 630, -1474, -2892, -3672,
+  -3167, -924, 1948, 3598, 3489, 2376, 707, -1561, -3650, -4030, -2331, 127, 2024, 3202, 3627, 2599,
+  23, -2643, -3746, -3200, -1857, -12, 2271, 3959, 3677, 1569, -839, -2489, -3405, -3426, -1898, 867,
+  3187, 3729, 2811, 1277, -703, -2891, -4071, -3156, -776, 1483, 2863, 3487, 3069, 1100, -1697, -3559,
+  -3562, -2339, -651, 1407, 3384, 3981, 2503, -10, -2043, -3137, -3437, -2565, -248, 2422, 3754, 3264,
+  1802, -5, -2069, -3718, -3697, -1758, 754, 2508, 3304, 3250, 1934, -609, -3008, -3775, -2858, -1215,
+  671, 2653, 3874, 3241, 966, -1430, -2870, -3355, -2923, -1206, 1426, 3432, 3635, 2365, 595, -1322,
+  -3127, -3842, -2643, -168, 2016, 3123, 3285, 2466, 419, -2157, -3682, -3352, -1807, 43, 1930, 3462,
+  3626, 1941, -600, -2500, -3263, -3090, -1894, 385, 2768, 3756, 2950, 1202, -679, -2468, -3638, -3241,
+  -1175, 1306, 2872, 3286, 2773, 1232, -1164, -3231, -3662, -2450, -571, 1291, 2906, 3645, 2711, 387,
+  -1926, -3125, -3191, -2340, -513, 1877, 3531, 3418, 1879, -69, -1855, -3221, -3482, -2071, 385, 2442,
+  3256, 2978, 1808, -228, -2488, -3661, -3042, -1258, 695, 2348, 3395, 3161, 1356, -1108, -2841, -3265,
+  -2653, -1197, 953, 2969, 3626, 2559, 610, -1288, -2745, -3417, -2702, -604, 1755, 3115, 3152, 2226,
+  536, -1624, -3303, -3436, -1993, 42, 1825, 3028, 3288, 2132, -148, -2304, -3260, -2922, -1711, 143,
+  2211, 3481, 3109, 1368, -676, -2285, -3181, -3015, -1482, 867, 2739, 3274, 2584, 1132, -808, -2686,
+  -3503, -2665, -711, 1269, 2648, 3198, 2616, 787, -1524, -3049, -3161, -2149, -512, 1426, 3033, 3375,
+  2128, 45, -1799, -2897, -3079, -2113, -79, 2097, 3227, 2925, 1636, -117, -1971, -3240, -3110, -1520,
+  604, 2246, 3023, 2833, 1534, -611, -2565, -3268, -2578, -1067, 728, 2418, 3307, 2725, 869, -1211,
+  -2589, -3022, -2475, -907, 1256, 2915, 3176, 2135, 470, -1293, -2754, -3235, -2238, -200, 1752, 2817,
+  2896, 2026, 260, -1832, -3136, -2954, -1616, 129, 1787, 2969, 3034, 1672, -460, -2204, -2920, -2656,
+  -1510, 379, 2320, 3222, 2615, 1045, -702, -2194, -3059, -2716, -1051, 1084, 2549, 2898, 2319, 950,
+  -988, -2702, -3170, -2173, -452, 1223, 2500, 3029, 2296, 398, -1645, -2773, -2757, -1904, -372, 1544,
+  2967, 2985, 1652, -136, -1672, -2700, -2883, -1792, 258, 2118, 2868, 2510, 1434, -204, -2029, -3104,
+  -2674, -1077, 689, 2034, 2793, 2631, 1222, -890, -2483, -2834, -2175, -932, 757, 2428, 3107, 2253,
+  479, -1185, -2302, -2782, -2283, -610, 1470, 2723, 2681, 1775, 416, -1272, -2725, -2976, -1743, 111,
+  1602, 2473, 2673, 1851, -22, -1970, -2830, -2423, -1331, 94, 1732, 2908, 2715, 1172, -664, -1930,
+  -2549, -2473, -1351, 644, 2366, 2803, 2081, 867, -584, -2124, -2969, -2337, -571, 1153, 2161, 2537,
+  2190, 800, -1230, -2639, -2650, -1680, -401, 1042, 2434, 2901, 1860, -27, -1558, -2299, -2443, -1832,
+  -217, 1751, 2777, 2389, 1245, -53, -1457, -2649, -2706, -1311, 590, 1867, 2348, 2276, 1409, -373,
+  -2179, -2777, -2042, -799, 482, 1820, 2758, 2391, 720, -1088, -2075, -2318, -2042, -933, 945, 2492,
+  2645, 1635, 361, -879, -2120, -2753, -1969, -120, 1499, 2186, 2221, 1747, 417, -1470, -2676, -2397,
+  -1197, 52, 1239, 2345, 2629, 1463, -452, -1810, -2209, -2066, -1397, 119, 1920, 2721, 2056, 754,
+  -434, -1557, -2486, -2388, -902, 967, 2014, 2157, 1860, 999, -653, -2271, -2631, -1650, -327, 777,
+  1826, 2531, 2039, 318, -1397, -2114, -2044, -1611, -561, 1160, 2503, 2418, 1208, -67, -1083, -2040,
+  -2473, -1599, 254, 1726, 2122, 1883, 1320, 96, -1614, -2604, -2103, -761, 419, 1349, 2190, 2308,
+  1090, -781, -1945, -2052, -1687, -992, 381, 1988, 2572, 1712, 332, -725, -1576, -2265, -2040, -543,
+  1234, 2055, 1922, 1461, 630, -848, -2262, -2413, -1277, 60, 986, 1761, 2258, 1679, -10, -1591,
+  -2066, -1749, -1210, -241, 1282, 2419, 2145, 829, -402, -1205, -1899, -2160, -1243, 535, 1839, 1992,
+  1548, 936, -165, -1660, -2451, -1791, -395, 689, 1388, 1983, 1971, 754, -1001, -1977, -1855, -1329,
+  -639, 574, 1959, 2359, 1381, -3, -924, -1535, -2005, -1694, -244, 1385, 2011, 1672, 1098, 320,
+  -968, -2160, -2156, -946, 349, 1112, 1648, 1956, 1340, -258, -1669, -1955, -1463, -857, 14, 1327,
+  2252, 1860, 514, -637, -1259, -1722, -1833, -928, 722, 1847, 1827, 1241, 606, -358, -1629, -2232,
+  -1496, -112, 865, 1371, 1752, 1634, 479, -1120, -1921, -1647, -1015, -345, 697, 1856, 2103, 1094,
+  -245, -1039, -1454, -1732, -1364, -23, 1435, 1900, 1437, 789, 73, -1017, -1994, -1880, -682, 543,
+  1167, 1508, 1655, 1034, -416, -1654, -1802, -1213, -565, 207, 1301, 2036, 1582, 286, -781, -1257,
+  -1531, -1517, -662, 810, 1776, 1645, 986, 340, -488, -1533, -1981, -1235, 75, 960, 1316, 1520,
+  1321, 269, -1141, -1805, -1449, -764, -114, 759, 1697, 1836, 863, -386, -1088, -1350, -1468, -1071,
+  123, 1393, 1755, 1233, 550, -114, -1009, -1784, -1616, -491, 641, 1173, 1359, 1373, 779, -492,
+  -1561, -1640, -1010, -344, 343, 1225, 1792, 1340, 141, -839, -1224, -1345, -1233, -458, 817, 1645,
+  1479, 790, 144, -565, -1394, -1721, -1029, 174, 984, 1247, 1303, 1050, 127, -1085, -1652, -1288,
+  -579, 51, 775, 1506, 1581, 704, -443, -1083, -1248, -1231, -830, 196, 1286, 1595, 1083, 379,
+  -241, -963, -1558, -1385, -383, 663, 1144, 1228, 1127, 582, -495, -1419, -1487, -874, -189, 425,
+  1120, 1547, 1148, 82, -835, -1174, -1188, -992, -318, 758, 1485, 1343, 668, 9, -598, -1238,
+  -1478, -887, 189, 962, 1179, 1125, 829, 52, -974, -1492, -1174, -469, 162, 756, 1313, 1360,
+  617, -425, -1051, -1161, -1041, -643, 205, 1140, 1450, 992, 280, -324, -892, -1342, -1202, -350,
+  623, 1106, 1124, 935, 442, -442, -1255, -1367, -803, -101, 474, 1003, 1329, 1015, 96, -785,
+  -1132, -1067, -810, -234, 653, 1324, 1254, 613, -68, -609, -1083, -1276, -811, 140, 913, 1133,
+  993, 668, 27, -832, -1349, -1118, -424, 226, 726, 1134, 1191, 596, -355, -1008, -1110, -902,
+  -517, 172, 980, 1338, 964, 240, -369, -824, -1156, -1079, -379, 547, 1074, 1065, 797, 359,
+  -359, -1096, -1294, -797, -63, 497, 901, 1152, 947, 162, -715, -1111, -1000, -683, -200, 533,
+  1183, 1221, 619, -105, -607, -958, -1125, -797, 52, 859, 1119, 918, 562, 43, -692, -1241,
+  -1122, -435, 259, 698, 998, 1079, 633, -260, -976, -1099, -823, -439, 112, 838, 1272, 996,
+  248, -397, -771, -1022, -1015, -455, 461, 1065, 1054, 720, 317, -265, -970, -1273, -847, -63,
+  516, 829, 1035, 932, 262, -650, -1122, -986, -614, -196, 418, 1087, 1242, 676, -114, -614,
+  -875, -1038, -829, -56, 823, 1146, 900, 508, 73, -574, -1187, -1176, -487, 278, 693, 914,
+  1030, 703, -161, -972, -1136, -801, -405, 54, 732, 1262, 1073, 288, -422, -755, -949, -1007,
+  -549, 384, 1092, 1094, 697, 305, -190, -891, -1307, -934, -85, 545, 806, 981, 964, 364,
+  -606, -1176, -1024, -593, -206, 340, 1046, 1313, 760, -113, -645, -850, -1011, -894, -151, 816,
+  1220, 933, 492, 100, -506, -1187, -1274, -558, 296, 724, 894, 1033, 788, -88, -1004, -1222,
+  -828, -397, 17, 687, 1305, 1184, 336, -459, -786, -941, -1040, -641, 344, 1159, 1183, 716,
+  304, -154, -877, -1386, -1044, -106, 597, 840, 991, 1021, 449, -605, -1271, -1110, -605, -208,
+  315, 1069, 1418, 857, -121, -709, -890, -1040, -965, -214, 857, 1333, 1011, 498, 101, -501,
+  -1247, -1392, -631, 334, 799, 942, 1079, 861, -57, -1084, -1345, -894, -395, 25, 710, 1396,
+  1303, 378, -524, -871, -998, -1098, -703, 352, 1271, 1308, 767, 291, -177, -931, -1499, -1150,
+  -113, 687, 933, 1057, 1082, 488, -654, -1407, -1228, -638, -181, 359, 1152, 1543, 939, -151,
+  -821, -991, -1111, -1019, -222, 945, 1485, 1115, 511, 55, -570, -1354, -1516, -681, 400, 929,
+  1049, 1150, 898, -87, -1206, -1501, -978, -383, 94, 805, 1519, 1412, 391, -624, -1016, -1106,
+  -1159, -713, 421, 1420, 1459, 826, 252, -272, -1049, -1628, -1235, -85, 817, 1088, 1160, 1125,
+  464, -761, -1573, -1366, -668, -111, 481, 1286, 1665, 991, -220, -978, -1151, -1202, -1035, -159,
+  1084, 1657, 1231, 505, -48, -717, -1496, -1619, -694, 508, 1107, 1206, 1219, 879, -187, -1370,
+  -1670, -1066, -339, 231, 970, 1657, 1488, 362, -769, -1210, -1253, -1198, -654, 556, 1598, 1616,
+  879, 165, -441, -1224, -1750, -1276, -13, 995, 1289, 1286, 1125, 365, -924, -1756, -1501, -678,
+  21, 677, 1459, 1761, 992, -333, -1183, -1350, -1296, -989, -22, 1267, 1836, 1337, 468, -223,
+  -930, -1655, -1681, -653, 661, 1332, 1392, 1271, 785, -358, -1563, -1837, -1134, -250, 446, 1188,
+  1790, 1511, 278, -958, -1446, -1413, -1198, -512, 751, 1792, 1761, 902, 22, -687, -1434, -1847,
+  -1255, 112, 1214, 1526, 1407, 1066, 180, -1133, -1942, -1616, -649, 217, 942, 1646, 1814, 927,
+  -497, -1425, -1574, -1364, -871, 196, 1480, 2006, 1414, 381, -467, -1200, -1805, -1686, -546, 860,
+  1590, 1588, 1276, 609, -598, -1769, -1982, -1164, -102, 728, 1446, 1892, 1466, 131, -1187, -1707,
+  -1566, -1133, -288, 1001, 1983, 1874, 878, -186, -995, -1662, -1894, -1162, 295, 1467, 1776, 1501,
+  931, -82, -1380, -2110, -1691, -565, 481, 1257, 1829, 1801, 790, -712, -1694, -1797, -1388, -667,
+  483, 1712, 2144, 1442, 233, -777, -1503, -1929, -1614, -370, 1102, 1863, 1767, 1220, 346, -892,
+  -1976, -2084, -1139, 111, 1070, 1716, 1947, 1338, -78, -1449, -1970, -1684, -995, 21, 1286, 2157,
+  1935, 794, -459, -1349, -1880, -1876, -985, 531, 1743, 2014, 1545, 713, -419, -1642, -2244, -1704,
+  -417, 806, 1602, 1979, 1712, 573, -969, -1973, -1993, -1346, -379, 828, 1939, 2235, 1403, 21,
+  -1140, -1815, -1999, -1459, -121, 1373, 2132, 1904, 1088, 3, -1226, -2159, -2128, -1043, 386, 1451,
+  1974, 1934, 1126, -349, -1728, -2216, -1745, -775, 400, 1592, 2289, 1929, 637, -789, -1726, -2065,
+  -1778, -729, 817, 2020, 2219, 1518, 412, -811, -1904, -2323, -1646, -198, 1177, 1950, 2076, 1536,
+  283, -1262, -2238, -2140, -1224, -13, 1210, 2145, 2258, 1289, -260, -1534, -2110, -2001, -1216, 190,
+  1665, 2372, 1977, 872, -408, -1577, -2303, -2096, -872, 720, 1846, 2194, 1839, 829, -670, -2011,
+  -2415, -1732, -470, 831, 1893, 2367, 1841, 407, -1165, -2096, -2193, -1593, -394, 1137, 2284, 2362,
+  1409, 34, -1237, -2141, -2335, -1502, 88, 1578, 2271, 2102, 1271, -74, -1572, -2471, -2212, -1018,
+  419, 1606, 2309, 2205, 1089, -595, -1939, -2358, -1921, -887, 554, 1956, 2562, 1964, 574, -868,
+  -1922, -2389, -1979, -618, 1095, 2231, 2349, 1658, 455, -1027, -2274, -2549, -1626, -92, 1293, 2168,
+  2374, 1664, 103, -1564, -2435, -2242, -1320, 8, 1476, 2509, 2426, 1207, -404, -1674, -2334, -2265,
+  -1269, 436, 1982, 2540, 2039, 924, -483, -1882, -2647, -2194, -724, 893, 1992, 2412, 2062, 806,
+  -977, -2323, -2535, -1749, -484, 954, 2227, 2676, 1855, 197, -1350, -2234, -2398, -1768, -288, 1494,
+  2569, 2418, 1383, 18, -1402, -2493, -2589, -1422, 347, 1752, 2390, 2292, 1393, -263, -1961, -2702,
+  -2194, -960, 456, 1809, 2665, 2381, 913, -882, -2081, -2454, -2095, -945, 825, 2351, 2713, 1875,
+  498, -920, -2160, -2730, -2058, -350, 1379, 2323, 2426, 1813, 440, -1372, -2642, -2599, -1476, -18,
+  1358, 2438, 2677, 1629, -236, -1814, -2469, -2307, -1453, 105, 1875, 2814, 2366, 1019, -461, -1755,
+  -2628, -2503, -1112, 815, 2165, 2517, 2103, 1025, -668, -2307, -2855, -2027, -527, 923, 2097, 2717,
+  2208, 532, -1357, -2418, -2469, -1821, -539, 1224, 2641, 2760, 1600, 22, -1351, -2370, -2694, -1800,
+  82, 1831, 2564, 2330, 1467, 13, -1745, -2855, -2534, -1111, 473, 1733, 2560, 2551, 1295, -695,
+  -2215, -2603, -2107, -1052, 534, 2202, 2934, 2190, 586, -942, -2058, -2657, -2289, -717, 1275, 2491,
+  2537, 1812, 586, -1080, -2569, -2871, -1749, -51, 1367, 2313, 2650, 1912, 96, -1789, -2650, -2375,
+  -1453, -84, 1599, 2819, 2668, 1237, -470, -1738, -2490, -2531, -1435, 535, 2210, 2690, 2130, 1041,
+  -439, -2063, -2937, -2338, -684, 955, 2044, 2580, 2298, 878, -1141, -2519, -2616, -1813, -588, 961,
+  2444, 2912, 1900, 119, -1388, -2278, -2573, -1955, -269, 1686, 2702, 2439, 1439, 106, -1460, -2719,
+  -2744, -1381, 430, 1756, 2434, 2464, 1513, -359, -2141, -2758, -2173, -1020, 389, 1912, 2869, 2442,
+  813, -939, -2051, -2504, -2251, -990, 971, 2484, 2689, 1835, 569, -882, -2291, -2880, -2025, -227,
+  1388, 2267, 2485, 1937, 410, -1532, -2699, -2509, -1441, -100, 1352, 2573, 2750, 1518, -345, -1764,
+  -2399, -2373, -1530, 196, 2010, 2780, 2233, 1008, -374, -1778, -2740, -2486, -953, 878, 2057, 2447,
+  2168, 1045, -794, -2382, -2731, -1879, -551, 839, 2138, 2779, 2103, 361, -1347, -2263, -2409, -1872,
+  -505, 1352, 2628, 2563, 1469, 85, -1276, -2411, -2684, -1625, 223, 1738, 2380, 2284, 1493, -65,
+  -1838, -2740, -2290, -1021, 377, 1670, 2579, 2459, 1081, -771, -2040, -2408, -2074, -1044, 634, 2225,
+  2720, 1935, 553, -820, -2001, -2631, -2117, -502, 1259, 2247, 2350, 1785, 545, -1170, -2495, -2576,
+  -1518, -83, 1229, 2252, 2561, 1679, -78, -1667, -2358, -2209, -1425, -18, 1645, 2636, 2322, 1061,
+  -374, -1591, -2409, -2370, -1171, 629, 1982, 2376, 1989, 1005, -510, -2032, -2647, -1979, -585, 804,
+  1890, 2460, 2069, 622, -1124, -2199, -2305, -1699, -543, 1011, 2312, 2534, 1569, 111, -1193, -2113,
+  -2402, -1675, -64, 1544, 2316, 2151, 1348, 58, -1459, -2473, -2310, -1116, 347, 1530, 2249, 2234,
+  1211, -472, -1874, -2334, -1921, -947, 426, 1829, 2511, 1994, 641, -771, -1801, -2289, -1967, -705,
+  962, 2105, 2261, 1627, 514, -885, -2105, -2431, -1606, -167, 1149, 1997, 2231, 1615, 184, -1383,
+  -2234, -2102, -1279, -66, 1296, 2273, 2242, 1171, -290, -1469, -2109, -2076, -1198, 323, 1720, 2263,
+  1870, 891, -377, -1638, -2329, -1961, -710, 710, 1720, 2133, 1833, 739, -791, -1962, -2197, -1574,
+  -478, 793, 1895, 2275, 1608, 245, -1082, -1894, -2067, -1515, -265, 1200, 2106, 2046, 1229, 58,
+  -1164, -2057, -2120, -1203, 203, 1392, 1986, 1915, 1139, -201, -1532, -2151, -1820, -850, 350, 1471,
+  2119, 1878, 770, -617, -1631, -1994, -1687, -728, 634, 1779, 2103, 1531, 453, -728, -1701, -2082,
+  -1565, -328, 982, 1792, 1919, 1394, 303, -1017, -1933, -1968, -1195, -56, 1061, 1846, 1955, 1201,
+  -101, -1286, -1871, -1766, -1053, 115, 1333, 1994, 1759, 828, -325, -1332, -1903, -1748, -805, 501,
+  1519, 1869, 1546, 684, -506, -1572, -1966, -1488, -446, 673, 1532, 1873, 1476, 399, -855, -1674,
+  -1787, -1271, -304, 852, 1729, 1856, 1169, 67, -973, -1655, -1764, -1156, 0, 1151, 1749, 1634,
+  957, -66, -1140, -1802, -1672, -820, 292, 1213, 1700, 1585, 806, -375, -1379, -1744, -1421, -622,
+  410, 1362, 1792, 1427, 457, -615, -1386, -1668, -1350, -443, 710, 1533, 1663, 1160, 282, -715,
+  -1511, -1706, -1135, -98, 890, 1486, 1568, 1072, 84, -993, -1610, -1515, -867, 45, 969, 1587,
+  1552, 813, -240, -1105, -1516, -1409, -768, 256, 1214, 1609, 1310, 559, -346, -1165, -1591, -1340,
+  -476, 543, 1255, 1478, 1203, 452, -563, -1367, -1536, -1063, -252, 610, 1298, 1526, 1082, 142,
+  -797, -1337, -1382, -963, -139, 825, 1447, 1399, 790, -39, -827, -1369, -1401, -795, 174, 994,
+  1353, 1236, 701, -160, -1034, -1456, -1209, -506, 302, 992, 1378, 1223, 491, -456, -1128, -1310,
+  -1051, -431, 431, 1181, 1396, 980, 226, -528, -1104, -1329, -1004, -188, 692, 1197, 1214, 841,
+  163, -665, -1264, -1276, -727, 35, 711, 1163, 1227, 755, -99, -874, -1205, -1077, -616, 91,
+  853, 1282, 1107, 466, -266, -847, -1170, -1081, -491, 358, 996, 1158, 909, 386, -322, -989,
+  -1239, -900, -212, 461, 935, 1129, 899, 225, -575, -1059, -1065, -722, -161, 522, 1071, 1140,
+  672, -23, -614, -979, -1046, -691, 29, 743, 1064, 936, 526, -51, -685, -1096, -995, -437,
+  229, 724, 979, 926, 469, -259, -857, -1018, -782, -330, 242, 805, 1067, 817, 208, -398,
+  -792, -941, -777, -244, 454, 915, 931, 615, 143, -407, -879, -990, -617, 3, 528, 820,
+  869, 608, 27, -606, -922, -812, -443, 31, 540, 906, 872, 410, -185, -617, -812, -770,
+  -426, 170, 710, 882, 672, 275, -186, -639, -889, -723, -209, 333, 668, 774, 648, 241,
+  -339, -767, -805, -523, -118, 317, 701, 830, 555, 24, -444, -684, -709, -511, -63, 472,
+  776, 699, 372, -24, -422, -726, -737, -379, 136, 518, 669, 624, 366, -100, -566, -745,
+  -575, -227, 147, 499, 715, 618, 208, -265, -557, -629, -524, -219, 240, 618, 680, 444,
+  95, -249, -546, -671, -482, -50, 361, 564, 570, 413, 78, -351, -631, -591, -313, 21,
+  329, 565, 600, 339, -87, -423, -546, -496, -298, 51, 431, 609, 486, 190, -119, -385,
+  -556, -507, -198, 197, 453, 507, 412, 184, -162, -477, -557, -374, -79, 197, 418, 522,
+  401, 69, -278, -456, -452, -323, -76, 250, 490, 485, 263, -16, -255, -428, -467, -289,
+  44, 330, 437, 388, 232, -22, -314, -475, -400, -160, 93, 293, 419, 397, 179, -134,
+  -355, -401, -317, -145, 106, 351, 437, 308, 69, -153, -314, -391, -316, -77, 201, 356,
+  353, 245, 64, -172, -363, -381, -218, 8, 194, 317, 348, 232, -11, -243, -339, -297,
+  -174, 8, 218, 353, 315, 135, -69, -220, -305, -295, -149, 82, 263, 308, 239, 108,
+  -68, -246, -325, -244, -62, 113, 230, 281, 235, 73, -134, -265, -267, -181, -48, 114,
+  254, 283, 174, 2, -143, -228, -247, -174, -8, 167, 251, 222, 126, -3, -146, -247,
+  -234, -110, 45, 159, 215, 207, 114, -44, -183, -225, -175, -76, 44, 163, 226, 182,
+  54, -78, -163, -194, -164, -60, 82, 183, 193, 130, 34, -74, -168, -196, -131, -9,
+  98, 158, 167, 120, 15, -105, -172, -158, -88, 1, 93, 161, 161, 84, -25, -108,
+  -145, -137, -79, 20, 116, 153, 122, 52, -28, -102, -145, -124, -44, 48, 108, 127,
+  106, 44, -45, -116, -129, -88, -23, 46, 103, 124, 89, 13, -61, -102, -105, -76,
+  -15, 60, 108, 103, 59, 0, -56, -96, -100, -58, 10, 66, 90, 83, 49, -7,
+  -66, -94, -78, -34, 16, 59, 84, 76, 32, -25, -65, -76, -62, -27, 22, 64,
+  77, 55, 15, -26, -57, -69, -53, -12, 33, 59, 60, 42, 10, -29, -58, -60,
+  -35, -1, 30, 51, 54, 34, -2, -35, -49, -45, -26, 2, 32, 49, 43, 20,
+  -8, -30, -42, -39, -19, 10, 32, 39, 31, 14, -9, -30, -38, -29, -8, 12,
+  27, 32, 26, 8, -14, -27, -29, -20, -5, 12, 25, 27, 17, 1, -13, -21,
+  -23, -15, -1, 14, 21, 19, 11, 0, -12, -19, -18, -9, 3, 12, 16, 14,
+  8, -3, -12, -15, -11, -5, 3, 10, 13, 10, 3, -4, -9, -10, -8, -3,
+  4, 8, 9, 6, 2, -3, -7, -7, -5, -1, 3, 5, 5, 4, 1, -3,
+  -5, -4, -2, 0, 2, 4, 4, 2, 0, -2, -3, -2, -1, 0, 2, 2,
+  2, 1, 0, -1, -1, -1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+};
+
+const SampleClip GLASS_SAMPLE = {GLASS_SAMPLE_DATA, GLASS_SAMPLE_LENGTH, GLASS_SAMPLE_PITCH};
@@ -6,113 +6,348 @@
  */
 
 #include <M5Unified.h>
+#include <atomic>
 #include <vector>
 #include <cmath>
+#include "esp_async_memcpy.h"
+#include "esp32s3/rom/cache.h"
+#include "CircleClear.h"
+#include "EnergyModel.h"
+#include "FrameCodec.h"
+#include "GlassEngine.h"
+#include "GlassRenderer.h"
+#include "GlassGauge.h"
+#include "PerfHud.h"
+#include "GrainSynth.h"
+#include "GlassReverb.h"
+#include "SampleVoice.h"
+#include "glass_sample.h"
+#include "PresentClock.h"
+#include "attract_anim.h"
+#include "crack_decals.h"
+#ifdef GLASSDIAL_OVERDRAW
+#include "OverdrawGfx.h"
+#endif
+#ifdef GLASSDIAL_POLYGON_BENCH
+#include "GlassPolygon.h"
+#endif
+#ifdef GLASSDIAL_KALEIDOSCOPE
+#include "Kaleidoscope.h"
+#endif
+#ifdef GLASSDIAL_PANEL_444
+#include "PanelPack444.h"
+#endif
+#ifdef GLASSDIAL_LOCKSTEP
+#include "Lockstep.h"
+#endif
+#ifdef GLASSDIAL_TRACE
+#include "TaskTrace.h"
+#endif
+#ifdef GLASSDIAL_FRAME_STREAM
+#include "freertos/stream_buffer.h"
+#endif
 
-// ========================================
-// 状態定義（State Model）
-// ========================================
-enum State {
-  NORMAL,    // 初期状態 - 完全透明な静止画面
-  CRACK,     // ひび割れ生成
-  SHATTER,   // 粉砕
-  SILENCE,   // 無音の余韻
-  REBUILD,   // 修復
-  RECOVERY   // 完全修復
-};
-
-// ========================================
-// ひび構造体
-// ========================================
-struct Crack {
-  float startX, startY;  // 開始点
-  float endX, endY;      // 終了点
-  float angle;           // 角度
-  float length;          // 長さ
-  int generation;        // 世代（フラクタル深度）
-  float alpha;           // 透明度
-  bool active;           // アクティブ状態
-};
+// 消費電力の係数は tools/energy_calibrate.cpp でボードごとに生成する。
+// 生成ヘッダがなければ EnergyModel.h の目安の係数で見積もる
+#if __has_include("energy_calibration.h")
+#include "energy_calibration.h"
+#define GLASSDIAL_ENERGY_CALIBRATED
+#endif
 
-// ========================================
-// 粉末粒子構造体
-// ========================================
-struct Particle {
-  float x, y;           // 位置
-  float vx, vy;         // 速度
-  float size;           // サイズ
-  float alpha;          // 透明度
-  bool active;          // アクティブ状態
-};
+// 状態メッセージのグリフは tools/message_atlas_gen.cpp で日本語フォントから生成し、
+// 生成ヘッダ（src/message_atlas.h）はリポジトリに入れておく（作り直しは tools/message_atlas.py）。
+// ヘッダがなければ警告を出してメッセージ表示なしでビルドする
+#if __has_include("message_atlas.h")
+#include "message_atlas.h"
+#define GLASSDIAL_MESSAGES
+#else
+#warning "src/message_atlas.h がないので状態メッセージなしでビルドする（GLASSDIAL_MESSAGE_FONT を指定して作り直すこと）"
+#endif
 
 // ========================================
 // グローバル変数
 // ========================================
-State currentState = NORMAL;
-State previousState = NORMAL;
+// シミュレーション本体（状態・ひび割れ・粒子）
+GlassEngine engine;
 
 // エンコーダー関連
 int32_t encoderValue = 0;
 int32_t lastEncoderValue = 0;
-int32_t encoderDelta = 0;
-float rotationSpeed = 0.0f;
 
-// 破壊進行度
-float destructionLevel = 0.0f;  // 0.0 ~ 1.0
-const float CRACK_THRESHOLD = 0.15f;   // ひび割れ開始閾値
-const float SHATTER_THRESHOLD = 0.65f; // 粉砕開始閾値
+// タイマー
+unsigned long lastUpdateTime = 0;
+unsigned long engineTime = 0;   // engine を最後に進めた時刻（ふつうは millis()、ロックステップではフレームの時刻）
+const unsigned long ATTRACT_IDLE_TIME = 30000; // 30秒無操作でアトラクトモード
 
-// ひび割れデータ
-std::vector<Crack> cracks;
-const int MAX_CRACKS = 80;
+// フレームバッファ（全描画をここに合成してから一括転送）
+M5Canvas frameBuffer(&M5.Display);
+uint32_t frameCounter = 0;
 
-// 粒子データ
-std::vector<Particle> particles;
-const int MAX_PARTICLES = 150;
+// 粉塵の密度グリッド（splat は core 0 の作業タスクと loop() で半分ずつ）
+DustField dustField(GLASS_DUST_RADIUS);
 
-// タイマー
-unsigned long lastUpdateTime = 0;
-unsigned long stateStartTime = 0;
-unsigned long lastInteractionTime = 0;
-const unsigned long AUTO_RECOVER_TIME = 10000; // 10秒で自動修復
+// フレームの消去・取り込みの非同期DMA（GDMA の async memcpy）。
+// 円の消去は前フレームの転送の直後に出して、次のシミュレーションと重ねる
+const int FRAME_DMA_ALIGN = 32;          // PSRAM へのDMAのそろえ（データキャッシュの行）
+const size_t FRAME_BYTES = SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t);
+CircleClear circleClear(GLASS_CLEAR_RADIUS, FRAME_DMA_ALIGN);
+async_memcpy_t frameDma = nullptr;       // nullptr = DMAなし（CPU で消す）
+SemaphoreHandle_t frameDmaSignal = nullptr;
+uint16_t* frameDmaZeros = nullptr;       // コピー元の 0（内部RAM）
+uint32_t frameDmaIssued = 0;             // 出した転送の数（loop() だけが書く）
+volatile uint32_t frameDmaDone = 0;      // 終わった転送の数（割り込みで数える）
+bool frameDmaWroteFrame = false;         // フレームバッファへ書く転送がある（待った後にキャッシュを捨てる）
+bool frameClearPending = false;          // 円の消去を出してまだ仕上げていない
+bool frameClearFellBack = false;         // 出せない行があった（仕上げで全部 CPU で消す）
+uint32_t frameDmaIssueMicrosSum = 0;     // 転送を出すのにかかった CPU 時間
+uint32_t frameDmaWaitMicrosSum = 0;      // 完了を待った時間
+uint32_t frameDmaEdgeMicrosSum = 0;      // 両端を CPU で消した時間
+uint32_t frameDmaFrames = 0;
+uint32_t frameDmaRendered = 0;           // 報告の間に renderState() が描いたフレーム
+uint32_t frameDmaSkippedClears = 0;      // そのうち仕上がった消去を使い、renderGlass の消去を飛ばしたフレーム
+uint32_t syncClearMicros = 0;            // 同じ消去を CPU だけでしたときの時間（起動時に計測）
+
+// 衝撃の跡の画像（アトラスはフラッシュ、tools/crack_decal_gen.cpp が生成）
+DecalLayer decalLayer(CRACK_DECALS, GLASS_CLEAR_RADIUS);
+
+// 奥に重ねたガラス（-DGLASSDIAL_PANES=N のときだけ作る。なければ1枚）
+PaneStack* paneStack = nullptr;
+TaskHandle_t dustTaskHandle = nullptr;
+TaskHandle_t loopTaskHandle = nullptr;
+volatile int dustSplit = 0;             // core 0 が受け持つ粒の数（先頭から）
+uint32_t dustSplatMicrosSum = 0;
+uint32_t dustRenderMicrosSum = 0;
+uint32_t dustFrames = 0;
+size_t dustPeakMotes = 0;
+uint32_t fluidMicrosSum = 0;            // 流体を進めたステップの engine.step() の時間
+uint32_t fluidStepCount = 0;
+
+// 縁の破壊進行度ゲージ（変化した扇形だけ描き直す）
+GlassGauge destructionGauge;
+
+// 性能HUD（画面タップで表示切り替え）
+PerfHud perfHud;
+uint32_t spiBytes = 0;              // パネルへ送った累計バイト数
+uint32_t presentMicrosSum = 0;      // フレームの転送（pushSprite / 12ビット出力）の時間
+uint32_t presentFrames = 0;
+uint32_t hudMicrosSum = 0;
+uint32_t hudFrames = 0;
+
+// 消費電力の見積もり（コアの処理時間・SPI・バックライト・スピーカーの活動量 × 係数）
+const unsigned long ENERGY_REPORT_INTERVAL = 60000;
+#ifdef GLASSDIAL_ENERGY_CALIBRATED
+EnergyMeter energyMeter(ENERGY_CALIBRATION);
+#else
+EnergyMeter energyMeter(ENERGY_DEFAULT_COEFFICIENTS);
+#endif
+// コアごとの処理時間の累計。core 0 は粉塵・粒状音・フレームストリームのタスクが
+// それぞれ足すので、割り込み合っても取りこぼさないよう addCoreBusy() で原子的に足す
+std::atomic<uint32_t> coreBusyMicros[ENERGY_CORES] = {{0}, {0}};
+inline void addCoreBusy(int core, uint32_t busy) { coreBusyMicros[core].fetch_add(busy, std::memory_order_relaxed); }
+uint32_t energyLastMicros = 0;
+uint32_t energyLastBusy[ENERGY_CORES] = {0, 0};
+uint32_t energyLastSpiBytes = 0;
+float energyRecentMw = 0;                // HUD 用（1/16 の指数移動平均）
+unsigned long energyLastReport = 0;
+
+// アトラクトモード（事前レンダリング済みループの再生）
+bool attractActive = false;
+unsigned long attractStartTime = 0;
+uint32_t attractShownStep = 0;      // 表示済みのフレーム数（開始から通算）
+uint16_t attractPalette[16];        // フレームバッファのバイト順に変換済み
+unsigned long attractBusyMicros = 0;
+
+// 粒状音（破片の衝突音）。合成は core 0 の音声タスク
+const uint8_t GRAIN_CHANNEL = 7;          // tone() と重ならない仮想チャンネル
+const int GRAIN_BUFFER_COUNT = 3;         // 再生中 + 待ち + 合成中
+const unsigned long GRAIN_REPORT_INTERVAL = 5000;
+GrainScheduler grainScheduler;
+GrainMixer grainMixer;
+SamplePlayer samplePlayer(GLASS_SAMPLE);  // 衝突の粒はガラス音の音程を変えて鳴らす
+GlassReverb grainReverb;                  // 粒の響き（遅延線は PSRAM）
+QueueHandle_t grainQueue = nullptr;
+int16_t* grainBuffers[GRAIN_BUFFER_COUNT];
+volatile uint32_t grainLatencyCount = 0;  // 衝突 → 発音までの遅延の集計
+volatile uint32_t grainLatencySum = 0;
+volatile uint32_t grainLatencyMax = 0;
+volatile uint32_t grainMixMicros = 0;
+volatile uint32_t grainMixBlocks = 0;
+volatile uint32_t grainReverbMicros = 0;
+volatile uint32_t grainReverbBlocks = 0;
+volatile uint32_t grainLateCount = 0;     // 予定の時刻を過ぎてから鳴らした粒
+unsigned long grainLastReport = 0;
+
+// 表示時刻の見込み（音・振動・粒状音はこの時刻に合わせて鳴らす）
+const int GRAIN_WAITING_MAX = GRAIN_MAX_PER_FRAME * 4;
+const float SOUND_AMPLITUDE = 0.6f;
+const int HAPTIC_FREQUENCY = 100;         // 振動の代わりの低いトーン
+PresentClock presentClock;
+QueueHandle_t presentQueue = nullptr;     // 音声タスク → loop（実際に鳴り始めた時刻）
+
+#ifdef GLASSDIAL_MESSAGES
+// 状態メッセージ（SILENCE・RECOVERY）
+const unsigned long MESSAGE_DELAY = 400;      // SILENCE に入ってから出始めるまで [ms]
+const unsigned long MESSAGE_FADE_IN = 1200;   // フェードインの長さ [ms]
+const uint16_t MESSAGE_COLOR = 0xCEFF;        // 青白い光（RGB565）
+uint32_t messageMicrosSum = 0;
+uint32_t messageFrames = 0;
+#endif
 
-// 画面サイズ
-const int SCREEN_WIDTH = 240;
-const int SCREEN_HEIGHT = 240;
-const int CENTER_X = 120;
-const int CENTER_Y = 120;
+#ifdef GLASSDIAL_OVERDRAW
+// 重ね塗りの計測（描画を OverdrawGfx 越しに行い、画素ごとの書き込み回数を数える）
+const unsigned long OVERDRAW_REPORT_INTERVAL = 10000;
+uint8_t* overdrawCounts = nullptr;              // 240x240 バイト（PSRAM）
+OverdrawGfx<M5Canvas>* overdrawGfx = nullptr;
+OverdrawStateStats overdrawStats[STATE_COUNT];
+uint32_t overdrawMicrosSum = 0;
+unsigned long overdrawLastReport = 0;
+#endif
+
+#ifdef GLASSDIAL_PANEL_444
+// 12ビット出力（帯ごとに詰めて、前の帯のDMA転送中に次の帯を詰める）
+const int PANEL444_STRIP_ROWS = 16;
+const size_t PANEL444_STRIP_BYTES = PANEL444_STRIP_ROWS * SCREEN_WIDTH / 2 * 3;
+uint8_t* panel444Strips[2] = {nullptr, nullptr};  // 内部RAM（DMA可）
+PanelDither444 panelDither;
+bool panelDitherEnabled = true;
+#endif
+
+#ifdef GLASSDIAL_LOCKSTEP
+// 2台のロックステップ（Port B の UART でもう1台とつなぐ。入力と種だけを交換する）
+const int LOCKSTEP_RX_PIN = 1;
+const int LOCKSTEP_TX_PIN = 2;
+const uint32_t LOCKSTEP_BAUD = 115200;
+const int LOCKSTEP_INPUT_DELAY = 4;          // 入力の遅れ（フレーム）
+const unsigned long LOCKSTEP_REPORT_INTERVAL = 10000;
+LockstepLink* lockstep = nullptr;
+unsigned long lockstepConnectedAt = 0;
+unsigned long lockstepLastReport = 0;
+uint32_t lockstepLastBytes = 0;              // 前の報告までの送受信バイト数
+#endif
+
+#ifdef GLASSDIAL_TRACE
+// スケジューリングの記録（タイマー割り込みで両コアの実行中のタスクを標本化する）
+const uint32_t TRACE_CAPACITY = 8192;             // 出来事の数（8バイトずつ、PSRAM。約7秒ぶん）
+const uint32_t TRACE_SAMPLE_MICROS = 50;          // 標本化の周期
+const int TRACE_FRAME_EVENTS = 1024;              // 1フレームの集計に写す出来事の上限
+const uint32_t TRACE_SLOW_STEAL_MICROS = 4000;    // これ以上奪われたフレームがあれば記録を書き出す
+const unsigned long TRACE_DUMP_COOLDOWN = 30000;  // 自動の書き出しの間隔の下限
+const unsigned long TRACE_REPORT_INTERVAL = 10000;
+TaskTrace* taskTrace = nullptr;
+TraceEvent* traceFrameEvents = nullptr;           // 直前のフレームの出来事（内部RAM）
+hw_timer_t* traceTimer = nullptr;
+int traceFrameDmaIsr = -1;
+uint16_t traceFrameId = 0;
+volatile uint32_t traceSamplerMicros = 0;         // 標本化の割り込み自身の時間
+uint32_t traceFrames = 0;
+uint64_t traceFrameMicrosSum = 0;
+uint64_t traceStolenSum = 0;
+uint64_t traceIsrSum = 0;
+uint32_t tracePreemptions = 0;
+TraceSteal traceWorst;                            // 期間中でいちばん奪われたフレーム
+uint32_t traceWorstFrame = 0;
+unsigned long traceLastReport = 0;
+unsigned long traceLastDump = 0;
+bool traceDumped = false;
+#endif
+
+#ifdef GLASSDIAL_KALEIDOSCOPE
+// 万華鏡モード（扇形1つだけ動かして描き、表で残りの5つへ写す。表は PSRAM）
+KaleidoscopeMirror* kaleidoscope = nullptr;
+#endif
+
+// ログの出力先。フレームストリーミング中は streamTask がパケットの合間に
+// 書き出す（別のコアから Serial に直接書くとパケットの途中に混ざる）
+#ifdef GLASSDIAL_FRAME_STREAM
+struct StreamLog : public Print {
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* data, size_t size) override;
+};
+StreamLog streamLog;
+Print& logOut = streamLog;
+#else
+Print& logOut = Serial;
+#endif
 
 // 触覚フィードバック設定
 const int HAPTIC_PIN = 25; // M5Dialの振動モーター
 
-// ========================================
-// 音響周波数定義
-// ========================================
-const int FREQ_CRACK = 1500;
-const int FREQ_SHATTER = 2000;
-const int FREQ_REBUILD = 800;
-const int FREQ_RECOVERY = 1200;
-
 // ========================================
 // 関数プロトタイプ
 // ========================================
-void updateEncoder();
-void updateState();
-void updateDestruction();
+int32_t updateEncoder();
+ButtonInput handleButton();
+void handleTouch();
+void dispatchEngineEvents();
 void renderState();
-void renderNormal();
-void renderCrack();
-void renderShatter();
-void renderSilence();
-void renderRebuild();
-void renderRecovery();
-void generateCrack(float centerX, float centerY, float angle, int generation);
-void generateParticles();
-void updateParticles();
+void renderHud();
+void initDust();
+void splatDust();
+void dustTask(void* arg);
+void reportDust(unsigned long renderMicros);
+#ifdef GLASSDIAL_MESSAGES
+void renderMessage();
+#endif
 void playSound(int frequency, int duration);
+void presentSound(int frequency, int duration);
 void hapticFeedback(int duration, int strength);
-void handleButton();
-void autoRecover();
+void schedulePresentVoice(float frequency, float amplitude, float decay);
+void collectPresentStarts();
+bool updateAttract();
+void startAttract();
+void stopAttract();
+void applyAttractFrame(int index, size_t* dirtyFirst, size_t* dirtyLast);
+void initGrainAudio();
+void submitImpactGrains();
+void grainAudioTask(void* arg);
+void reportGrainStats();
+#ifdef GLASSDIAL_FRAME_STREAM
+void initFrameStream();
+void submitStreamFrame();
+void flushStreamLog();
+void streamTask(void* arg);
+#endif
+#ifdef GLASSDIAL_RECORD_INPUT
+void recordInput(const GlassInput& input, unsigned long now);
+#endif
+#ifdef GLASSDIAL_OVERDRAW
+void initOverdraw();
+void recordOverdraw();
+void dumpOverdraw();
+#endif
+#ifdef GLASSDIAL_POLYGON_BENCH
+void runPolygonBench();
+#endif
+#ifdef GLASSDIAL_PANEL_444
+void initPanel444();
+void pushFrame444();
+#endif
+#ifdef GLASSDIAL_LOCKSTEP
+void initLockstep();
+void stepLockstep(const GlassInput& input, unsigned long now);
+void reportLockstep(unsigned long now);
+#endif
+#ifdef GLASSDIAL_TRACE
+void initTrace();
+void onTraceSample();
+void traceFrameBegin();
+void traceFrameEnd();
+void reportTrace();
+void dumpTrace();
+#endif
+#ifdef GLASSDIAL_ENERGY_CALIBRATE
+void runEnergyCalibration();
+void energyCalibrationSpinTask(void*);
+#endif
+void recordEnergy(uint32_t loopBusyMicros);
+void reportEnergy();
+void reportPresent(unsigned long presentMicros);
+void initFrameDma();
+bool frameDmaCopy(void* dst, void* src, size_t bytes, TaskHandle_t notify);
+void waitFrameDma();
+void beginFrameClear();
+bool finishFrameClear();
+void reportFrameDma();
 
 // ========================================
 // Setup
@@ -127,9 +362,19 @@ void setup() {
   M5.Display.setBrightness(200);
   M5.Display.fillScreen(TFT_BLACK);
   
+  // フレームバッファ（PSRAM上に確保）
+  frameBuffer.setPsram(true);
+  frameBuffer.setColorDepth(16);
+  frameBuffer.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT);
+#ifdef GLASSDIAL_PANEL_444
+  initPanel444();
+#endif
+  
   // スピーカー初期化
   M5.Speaker.begin();
   M5.Speaker.setVolume(128);
+  initGrainAudio();
+  initDust();
   
   // エンコーダー初期化（M5Dialのロータリーエンコーダー用変数）
   encoderValue = 0;
@@ -140,12 +385,74 @@ void setup() {
   // 初期化完了音
   playSound(FREQ_RECOVERY, 100);
   
+  // シミュレーション初期化（乱数はハードウェア乱数で種をまく）
+  uint32_t seed = esp_random();
+  engine.rng.setSeed(seed);
+#ifdef GLASSDIAL_KALEIDOSCOPE
+  engine.config.kaleidoscope = true;
+  dustField.mirrorSector = true;
+  kaleidoscope = new KaleidoscopeMirror(GLASS_CLEAR_RADIUS);
+#endif
+#ifdef GLASSDIAL_PANES
+  engine.config.paneCount = GLASSDIAL_PANES;
+  paneStack = new PaneStack(GLASS_CLEAR_RADIUS);
+#endif
+  engine.reset(millis());
+  engineTime = millis();
+  
   lastUpdateTime = millis();
-  lastInteractionTime = millis();
-  stateStartTime = millis();
   
   Serial.begin(115200);
-  Serial.println("GlassDial - Initialized");
+  logOut.println("GlassDial - Initialized");
+  
+#ifdef GLASSDIAL_MESSAGES
+  // グリフはフラッシュに置いたまま読むので、RAMに載るのはこの関数の局所変数だけ
+  logOut.printf("Message: %u glyphs, %u bytes in flash, 0 bytes RAM\n",
+                (unsigned)(sizeof(MESSAGE_GLYPHS) / sizeof(MESSAGE_GLYPHS[0])),
+                (unsigned)(sizeof(MESSAGE_GLYPHS) + sizeof(MESSAGE_BITMAP) +
+                           sizeof(MESSAGE_TEXT) + sizeof(MESSAGE_OFFSETS)));
+#endif
+  
+#ifdef GLASSDIAL_RECORD_INPUT
+  logOut.printf("SESSION,%lu,%lu\n", engine.stateStartTime, (unsigned long)seed);
+#endif
+  
+#ifdef GLASSDIAL_TRACE
+  initTrace();
+#endif
+  
+  initFrameDma();
+  
+#ifdef GLASSDIAL_FRAME_STREAM
+  initFrameStream();
+#endif
+  
+#ifdef GLASSDIAL_OVERDRAW
+  initOverdraw();
+#endif
+  
+#ifdef GLASSDIAL_POLYGON_BENCH
+  runPolygonBench();
+#endif
+
+#ifdef GLASSDIAL_ENERGY_CALIBRATE
+  runEnergyCalibration();
+#endif
+  energyLastMicros = micros();
+  energyLastReport = millis();
+
+#ifdef GLASSDIAL_KALEIDOSCOPE
+  logOut.printf("Kaleidoscope: %d sectors, mirror table %u bytes\n", KALEIDOSCOPE_SECTORS,
+                (unsigned)kaleidoscope->tableBytes());
+#endif
+
+#ifdef GLASSDIAL_PANES
+  logOut.printf("Panes: %d\n", engine.config.paneCount);
+#endif
+
+#ifdef GLASSDIAL_LOCKSTEP
+  initLockstep();
+#endif
 }
 
 // ========================================
@@ -154,24 +461,60 @@ void setup() {
 void loop() {
   M5.update();
   
+  unsigned long frameStart = micros();
   unsigned long currentTime = millis();
-  float deltaTime = (currentTime - lastUpdateTime) / 1000.0f;
+  presentClock.beginFrame(frameCounter, frameStart);
+#ifdef GLASSDIAL_TRACE
+  traceFrameBegin();
+#endif
   lastUpdateTime = currentTime;
   
-  // エンコーダー更新
-  updateEncoder();
+  // 入力（エンコーダー・ボタン）
+  GlassInput input;
+  input.encoderDelta = updateEncoder();
+  input.button = handleButton();
+  handleTouch();
   
-  // ボタン処理
-  handleButton();
+#ifdef GLASSDIAL_RECORD_INPUT
+  recordInput(input, currentTime);
+#endif
   
-  // 状態更新
-  updateState();
+  // 状態更新（破壊進行・状態遷移・ひび割れ・粒子・自動修復）
+#ifdef GLASSDIAL_LOCKSTEP
+  stepLockstep(input, currentTime);
+#else
+  unsigned long stepStart = micros();
+  engine.step(input, currentTime);
+  engineTime = currentTime;
+  if (engine.fluidSteps > 0) {
+    fluidMicrosSum += micros() - stepStart;
+    fluidStepCount += engine.fluidSteps;
+  }
+  dispatchEngineEvents();
+  submitImpactGrains();
+#endif
+  reportGrainStats();
+  
+#ifndef GLASSDIAL_LOCKSTEP
+  // アトラクトモード再生中は描画を止める（ロックステップでは使わない。
+  // 片方だけ再生すると engine の時刻を書き換えて相手とずれる）
+  if (updateAttract()) {
+#ifdef GLASSDIAL_TRACE
+    traceFrameEnd();
+#endif
+    recordEnergy(micros() - frameStart);
+    delay(5); // 入力に即応できるよう短い周期で監視
+    return;
+  }
+#endif
   
   // 描画
   renderState();
-  
-  // 自動修復チェック
-  autoRecover();
+  perfHud.recordFrame(micros() - frameStart);
+#ifdef GLASSDIAL_TRACE
+  traceFrameEnd();
+#endif
+  recordEnergy(micros() - frameStart);
   
   delay(16); // 約60FPS
 }
@@ -179,10 +522,10 @@ void loop() {
 // ========================================
 // エンコーダー更新
 // ========================================
-void updateEncoder() {
+int32_t updateEncoder() {
   // M5Dialのロータリーエンコーダー読み取り
   // I2C経由でエンコーダーチップ(0x40)から読み取り
-  static uint8_t oldEncVal = 0;
+  int32_t encoderDelta = 0;
   
   // エンコーダー値読み取り(簡易実装)
   uint8_t reg_data[4] = {0};
@@ -190,490 +533,1433 @@ void updateEncoder() {
     int16_t newEncVal = (int16_t)((reg_data[2] << 8) | reg_data[3]);
     encoderDelta = newEncVal - encoderValue;
     encoderValue = newEncVal;
-  } else {
-    encoderDelta = 0;
   }
   
   if (encoderDelta != 0) {
-    lastInteractionTime = millis();
-    
-    // 回転速度計算（-1.0 ~ 1.0）
-    rotationSpeed = constrain(encoderDelta / 10.0f, -1.0f, 1.0f);
-    
-    // 破壊進行度更新
-    updateDestruction();
-    
     lastEncoderValue = encoderValue;
-  } else {
-    rotationSpeed *= 0.9f; // 減衰
   }
+  return encoderDelta;
 }
 
 // ========================================
-// 破壊進行度更新
+// シミュレーションからの出力（音・振動・ログ）
 // ========================================
-void updateDestruction() {
-  // 正回転で破壊、逆回転で修復
-  destructionLevel += encoderDelta * 0.003f;
-  destructionLevel = constrain(destructionLevel, 0.0f, 1.0f);
+void dispatchEngineEvents() {
+  for (const GlassEvent& e : engine.events) {
+    switch (e.type) {
+      case EVENT_SOUND:
+        presentSound(e.value1, e.value2);
+        break;
+      case EVENT_HAPTIC:
+        hapticFeedback(e.value1, e.value2);
+        break;
+      case EVENT_LOG:
+        logOut.println(e.message);
+        break;
+    }
+  }
 }
 
 // ========================================
-// 状態更新ロジック
+// 描画メイン
 // ========================================
-void updateState() {
-  previousState = currentState;
+void renderState() {
+  // 粉塵を密度グリッドへ（両コアで並列）
+  splatDust();
   
-  switch (currentState) {
-    case NORMAL:
-      if (destructionLevel > CRACK_THRESHOLD) {
-        currentState = CRACK;
-        stateStartTime = millis();
-        playSound(FREQ_CRACK, 50);
-        hapticFeedback(60, 30);
-        Serial.println("State: NORMAL -> CRACK");
-      }
-      break;
-      
-    case CRACK:
-      if (destructionLevel > SHATTER_THRESHOLD) {
-        currentState = SHATTER;
-        stateStartTime = millis();
-        generateParticles();
-        playSound(FREQ_SHATTER, 200);
-        hapticFeedback(300, 10);
-        Serial.println("State: CRACK -> SHATTER");
-      } else if (destructionLevel < CRACK_THRESHOLD) {
-        currentState = NORMAL;
-        cracks.clear();
-        stateStartTime = millis();
-        Serial.println("State: CRACK -> NORMAL");
-      }
-      break;
-      
-    case SHATTER:
-      // 粒子更新
-      updateParticles();
-      
-      // 逆回転で修復開始
-      if (encoderDelta < -2) {
-        currentState = REBUILD;
-        stateStartTime = millis();
-        playSound(FREQ_REBUILD, 100);
-        hapticFeedback(500, 15);
-        Serial.println("State: SHATTER -> REBUILD");
-      }
-      
-      // 静止で余韻
-      if (millis() - lastInteractionTime > 1000 && abs(rotationSpeed) < 0.01f) {
-        currentState = SILENCE;
-        stateStartTime = millis();
-        Serial.println("State: SHATTER -> SILENCE");
-      }
-      break;
-      
-    case SILENCE:
-      // 逆回転で修復
-      if (encoderDelta < 0) {
-        currentState = REBUILD;
-        stateStartTime = millis();
-        playSound(FREQ_REBUILD, 100);
-        Serial.println("State: SILENCE -> REBUILD");
-      }
-      break;
-      
-    case REBUILD:
-      // 修復進行
-      updateParticles();
-      
-      if (destructionLevel < 0.05f) {
-        currentState = RECOVERY;
-        stateStartTime = millis();
-        playSound(FREQ_RECOVERY, 150);
-        hapticFeedback(40, 20);
-        Serial.println("State: REBUILD -> RECOVERY");
-      }
-      break;
-      
-    case RECOVERY:
-      // 完全修復後、NORMALへ
-      if (millis() - stateStartTime > 800) {
-        currentState = NORMAL;
-        particles.clear();
-        cracks.clear();
-        destructionLevel = 0.0f;
-        stateStartTime = millis();
-        Serial.println("State: RECOVERY -> NORMAL");
-      }
-      break;
+  // 前フレームの後に出した円の消去を待って両端を仕上げる
+  bool cleared = finishFrameClear();
+  frameDmaRendered++;
+  if (cleared) frameDmaSkippedClears++;
+  
+  // 状態ごとの描画は GlassRenderer.h（ホスト側ツールと共通）
+  unsigned long renderStart = micros();
+#ifdef GLASSDIAL_OVERDRAW
+  unsigned long overdrawStart = micros();
+  overdrawGfx->beginFrame();
+  renderGlass(*overdrawGfx, engine, engineTime, &dustField, &decalLayer, paneStack, cleared);
+#else
+  renderGlass(frameBuffer, engine, engineTime, &dustField, &decalLayer, paneStack, cleared);
+#endif
+#ifdef GLASSDIAL_OVERDRAW
+  // 万華鏡の写しとメッセージも直接書き込みとして数える
+  markStage(*overdrawGfx, STAGE_OVERLAY);
+#ifdef GLASSDIAL_KALEIDOSCOPE
+  kaleidoscope->apply(*overdrawGfx);
+#endif
+#else
+#ifdef GLASSDIAL_KALEIDOSCOPE
+  kaleidoscope->apply(frameBuffer);
+#endif
+#endif
+  reportDust(micros() - renderStart);
+#ifdef GLASSDIAL_MESSAGES
+  renderMessage();
+#endif
+#ifdef GLASSDIAL_OVERDRAW
+  destructionGauge.update(*overdrawGfx, engine.destructionLevel);
+  overdrawMicrosSum += micros() - overdrawStart;
+  recordOverdraw();
+#else
+  destructionGauge.update(frameBuffer, engine.destructionLevel);
+#endif
+  
+  // デバッグ情報（画面タップで表示）
+  if (perfHud.visible) {
+    renderHud();
   }
+  
+  unsigned long presentStart = micros();
+#ifdef GLASSDIAL_PANEL_444
+  pushFrame444();
+#else
+  frameBuffer.pushSprite(0, 0);
+  spiBytes += SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t);
+#endif
+  reportPresent(micros() - presentStart);
+  presentClock.presented(micros());
+  collectPresentStarts();
+  frameCounter++;
+  
+#ifdef GLASSDIAL_FRAME_STREAM
+  submitStreamFrame();
+#endif
+  
+  // 次のフレームの円の消去（DMA）。次の入力・シミュレーションの間に終わる
+  beginFrameClear();
+  reportFrameDma();
 }
 
+// 転送の時間を 600フレームごとに報告（RGB565 と 12ビット出力の比較用）
+void reportPresent(unsigned long presentMicros) {
+  presentMicrosSum += presentMicros;
+  presentFrames++;
+  if (presentFrames < 600) return;
+#ifdef GLASSDIAL_PANEL_444
+  const char* mode = panelDitherEnabled ? "RGB444 dither" : "RGB444";
+  uint32_t bytes = panelPack444Bytes(SCREEN_WIDTH * SCREEN_HEIGHT);
+#else
+  const char* mode = "RGB565";
+  uint32_t bytes = SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t);
+#endif
+  logOut.printf("Present: %s %lu us/frame, %lu bytes/frame\n", mode,
+                (unsigned long)(presentMicrosSum / presentFrames), (unsigned long)bytes);
+  presentMicrosSum = 0;
+  presentFrames = 0;
+}
+
+#ifdef GLASSDIAL_MESSAGES
 // ========================================
-// 描画メイン
+// 状態メッセージ
 // ========================================
-void renderState() {
-  M5.Display.fillScreen(TFT_BLACK);
+// SILENCE ではゆっくり浮かび上がり、RECOVERY では光の広がりに合わせて
+// 現れて消える。メッセージが終わるたびに1フレームあたりの描画時間を報告する。
+void renderMessage() {
+  unsigned long elapsed = engineTime - engine.stateStartTime;
+  int id = -1;
+  float level = 0.0f;
   
-  switch (currentState) {
-    case NORMAL:
-      renderNormal();
-      break;
-    case CRACK:
-      renderCrack();
-      break;
-    case SHATTER:
-      renderShatter();
-      break;
-    case SILENCE:
-      renderSilence();
-      break;
-    case REBUILD:
-      renderRebuild();
-      break;
-    case RECOVERY:
-      renderRecovery();
-      break;
+  if (engine.currentState == SILENCE) {
+    id = MESSAGE_SILENCE;
+    if (elapsed > MESSAGE_DELAY) {
+      level = (elapsed - MESSAGE_DELAY) / (float)MESSAGE_FADE_IN;
+      if (level > 1.0f) level = 1.0f;
+    }
+  } else if (engine.currentState == RECOVERY) {
+    id = MESSAGE_RECOVERY;
+    float progress = elapsed / (float)engine.config.recoveryDuration;
+    if (progress < 1.0f) level = sin(progress * PI);
   }
   
-  // デバッグ情報（オプション）
-  // M5.Display.setCursor(5, 5);
-  // M5.Display.printf("D:%.2f S:%d", destructionLevel, currentState);
+  if (id < 0) {
+    if (messageFrames > 0) {
+      logOut.printf("Message: %lu frames, %lu us/frame\n", (unsigned long)messageFrames,
+                    (unsigned long)(messageMicrosSum / messageFrames));
+      messageMicrosSum = 0;
+      messageFrames = 0;
+    }
+    return;
+  }
+  
+  unsigned long start = micros();
+#ifdef GLASSDIAL_OVERDRAW
+  drawMessage(*overdrawGfx, MESSAGE_FONT, id, CENTER_X, CENTER_Y, MESSAGE_COLOR, (uint8_t)(level * 255));
+#else
+  drawMessage(frameBuffer, MESSAGE_FONT, id, CENTER_X, CENTER_Y, MESSAGE_COLOR, (uint8_t)(level * 255));
+#endif
+  messageMicrosSum += micros() - start;
+  messageFrames++;
 }
+#endif
 
 // ========================================
-// NORMAL状態の描画
+// 粉塵（密度グリッド）
 // ========================================
-void renderNormal() {
-  // 完全透明な静止画面
-  // 中央に薄く円を描画（ガラスの存在を示唆）
-  M5.Display.drawCircle(CENTER_X, CENTER_Y, 80, TFT_DARKGREY);
-  M5.Display.drawCircle(CENTER_X, CENTER_Y, 81, TFT_DARKGREY);
+// 粒の列を前半・後半に分け、前半（と流体の密度）を core 0 の作業タスク、
+// 後半を loop() がそれぞれ自分のグリッドへ splat する。合成（renderGlass の中）は
+// グリッドの大きさだけで決まるので、粒が2万を超えても描画時間は変わらない。
+void initDust() {
+  loopTaskHandle = xTaskGetCurrentTaskHandle();
+  // 粒状音のタスクより低い優先度（音切れを起こさない）
+  xTaskCreatePinnedToCore(dustTask, "dustSplat", 4096, nullptr,
+                          configMAX_PRIORITIES - 5, &dustTaskHandle, 0);
+}
+
+void dustTask(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    unsigned long start = micros();
+    dustField.clear(0);
+    if (engine.fluidActive) dustField.splatFluid(0, engine.fluid);
+    dustField.splat(0, engine.dust.data(), dustSplit);
+    addCoreBusy(0, micros() - start);
+    xTaskNotifyGive(loopTaskHandle);
+  }
+}
+
+void splatDust() {
+  if (engine.dustLevel <= 0.0f) return;  // 粉塵がなければ合成もしない
+  size_t count = engine.dust.size();
   
-  // 呼吸するような光（自動修復後の余韻）
-  if (millis() - stateStartTime < 2000) {
-    float breathe = sin((millis() - stateStartTime) * 0.003f) * 0.5f + 0.5f;
-    uint8_t brightness = (uint8_t)(breathe * 30);
-    uint32_t color = M5.Display.color565(brightness, brightness, brightness + 20);
-    M5.Display.fillCircle(CENTER_X, CENTER_Y, 5, color);
+  unsigned long start = micros();
+  dustSplit = (int)(count / 2);
+  xTaskNotifyGive(dustTaskHandle);
+  
+  dustField.clear(1);
+  dustField.splat(1, engine.dust.data() + dustSplit, (int)count - dustSplit);
+  
+  // core 0 の分が終わるまで待つ（engine.dust はその間変えない）
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  dustSplatMicrosSum += micros() - start;
+  dustFrames++;
+  if (count > dustPeakMotes) dustPeakMotes = count;
+}
+
+// 粉塵が消えるたびに、粉塵があった間の1フレームあたりのコストを報告する
+void reportDust(unsigned long renderMicros) {
+  if (engine.dustLevel > 0.0f) {
+    dustRenderMicrosSum += renderMicros;
+    return;
+  }
+  if (dustFrames == 0) return;
+  logOut.printf("Dust: %lu frames, peak %lu motes, splat %lu us/frame (2 cores), render %lu us/frame\n",
+                (unsigned long)dustFrames, (unsigned long)dustPeakMotes,
+                (unsigned long)(dustSplatMicrosSum / dustFrames),
+                (unsigned long)(dustRenderMicrosSum / dustFrames));
+  if (fluidStepCount > 0) {
+    // 30Hz の流体ステップを含むフレームの engine.step() 全体（粒の更新も含む）
+    logOut.printf("Fluid: %lu steps, %lu us/step\n", (unsigned long)fluidStepCount,
+                  (unsigned long)(fluidMicrosSum / fluidStepCount));
   }
+  fluidMicrosSum = 0;
+  fluidStepCount = 0;
+  dustSplatMicrosSum = 0;
+  dustRenderMicrosSum = 0;
+  dustFrames = 0;
+  dustPeakMotes = 0;
 }
 
 // ========================================
-// CRACK状態の描画（ひび割れ）
+// 性能HUD
 // ========================================
-void renderCrack() {
-  // ベースガラス
-  M5.Display.drawCircle(CENTER_X, CENTER_Y, 80, TFT_DARKGREY);
+// 表示内容の組み直しは4Hz、毎フレームはHUDの矩形を写すだけ。
+// 表示中のHUD自体のコストも最後の行に出す。
+void renderHud() {
+  unsigned long start = micros();
   
-  // ひび割れ生成（破壊進行度に応じて）
-  int targetCracks = (int)((destructionLevel - CRACK_THRESHOLD) / 
-                           (SHATTER_THRESHOLD - CRACK_THRESHOLD) * MAX_CRACKS);
+  if (perfHud.due(millis())) {
+    HudCounters counters;
+    counters.particles = engine.activeParticleCount();
+    counters.cracks = (int)engine.cracks.size();
+    counters.freeHeap = ESP.getFreeHeap();
+    counters.spiBytes = spiBytes;
+    counters.hudMicros = hudFrames ? hudMicrosSum / hudFrames : 0;
+    counters.powerMw = (uint32_t)energyRecentMw;
+    perfHud.refresh(millis(), counters);
+    hudMicrosSum = 0;
+    hudFrames = 0;
+  }
+  perfHud.draw(frameBuffer);
   
-  while (cracks.size() < targetCracks && cracks.size() < MAX_CRACKS) {
-    float angle = random(0, 360) * DEG_TO_RAD;
-    generateCrack(CENTER_X, CENTER_Y, angle, 0);
+  hudMicrosSum += micros() - start;
+  hudFrames++;
+}
+
+// ========================================
+// サウンド再生
+// ========================================
+// 起動音だけはすぐに鳴らす（合わせる画がない）
+void playSound(int frequency, int duration) {
+  M5.Speaker.tone(frequency, duration);
+}
+
+// 遷移の音は、同じ遷移の画が表示される見込みの時刻に粒状音のミキサーで鳴らす
+// （tone() は呼んだ瞬間に鳴るので、画より 10〜30ms 先走っていた）。
+// duration [ms] の間に十分小さくなる減衰音にする
+void presentSound(int frequency, int duration) {
+  schedulePresentVoice((float)frequency, SOUND_AMPLITUDE, duration / 2000.0f);
+}
+
+// ========================================
+// 触覚フィードバック
+// ========================================
+void hapticFeedback(int duration, int strength) {
+  // M5Dialの内蔵振動モーターを制御
+  // 注: M5Dialの具体的な振動API実装に依存
+  // 擬似的な実装（実際のハードウェアに合わせて調整）
+  
+  // 低いトーンで代替する簡易実装（音と同じく表示の見込み時刻に合わせる）
+  float amplitude = strength / 30.0f;
+  if (amplitude > 1.0f) amplitude = 1.0f;
+  schedulePresentVoice((float)HAPTIC_FREQUENCY, amplitude, duration / 1000.0f);
+}
+
+// いま処理中のフレームが表示される見込みの時刻に鳴らす粒を音声タスクへ渡す
+void schedulePresentVoice(float frequency, float amplitude, float decay) {
+  GrainRequest voice;
+  voice.frequency = frequency;
+  voice.amplitude = amplitude;
+  voice.decay = decay;
+  voice.eventMicros = micros();
+  voice.startMicros = presentClock.target();
+  voice.frame = presentClock.currentFrame();
+  voice.voice = GRAIN_VOICE_SYNTH;
+  xQueueSend(grainQueue, &voice, 0); // 満杯なら捨てる
+}
+
+// 音声タスクが返した開始時刻を、そのフレームの表示時刻と比べる
+void collectPresentStarts() {
+  PresentStart start;
+  while (xQueueReceive(presentQueue, &start, 0) == pdTRUE) {
+    presentClock.recordStart(start.frame, start.micros);
+  }
+}
+
+// ========================================
+// ボタン処理
+// ========================================
+ButtonInput handleButton() {
+  // 短押し: 一段階戻る
+  if (M5.BtnA.wasPressed()) {
+    return BUTTON_PRESS;
   }
   
-  // ひび割れ描画
-  for (auto& crack : cracks) {
-    if (crack.active) {
-      uint32_t color = M5.Display.color565(200, 200, 255);
-      M5.Display.drawLine((int)crack.startX, (int)crack.startY,
-                         (int)crack.endX, (int)crack.endY, color);
-      
-      // 分岐ひび（フラクタル）
-      if (crack.generation < 2 && random(100) < 30) {
-        float newAngle = crack.angle + random(-30, 30) * DEG_TO_RAD;
-        generateCrack(crack.endX, crack.endY, newAngle, crack.generation + 1);
-      }
+  // 長押し: 完全リセット
+  if (M5.BtnA.pressedFor(1000)) {
+    // 長押し後の再トリガー防止
+    while (M5.BtnA.isPressed()) {
+      M5.update();
+      delay(10);
     }
+    return BUTTON_HOLD;
+  }
+  
+  return BUTTON_NONE;
+}
+
+// ========================================
+// タッチ処理
+// ========================================
+void handleTouch() {
+  // タップで性能HUDの表示切り替え
+  if (M5.Touch.getDetail().wasClicked()) {
+    perfHud.toggle();
   }
 }
 
 // ========================================
-// ひび割れ生成
+// 非同期DMA（フレームの消去・取り込み）
 // ========================================
-void generateCrack(float centerX, float centerY, float angle, int generation) {
-  if (cracks.size() >= MAX_CRACKS) return;
+// 円の消去（CircleClear.h）の行ごとの中ほどと、フレームストリームの取り込みを
+// GDMA の async memcpy に出す。転送は出した順に終わるので、数を数えて待つ。
+// フレームバッファは PSRAM にあるので、出す前にキャッシュを書き戻し、
+// 待った後に捨てる（その間は CPU がバッファに触らない）。
+// 計測用の -DGLASSDIAL_OVERDRAW では消去も数えたいので使わない。
+bool IRAM_ATTR onFrameDmaDone(async_memcpy_t, async_memcpy_event_t*, void* arg) {
+#ifdef GLASSDIAL_TRACE
+  if (taskTrace) taskTrace->record(micros(), TRACE_ISR_ENTER, xPortGetCoreID(), traceFrameDmaIsr);
+#endif
+  BaseType_t woken = pdFALSE;
+  frameDmaDone++;
+  if (arg) vTaskNotifyGiveFromISR((TaskHandle_t)arg, &woken);
+  xSemaphoreGiveFromISR(frameDmaSignal, &woken);
+#ifdef GLASSDIAL_TRACE
+  if (taskTrace) taskTrace->record(micros(), TRACE_ISR_EXIT, xPortGetCoreID(), traceFrameDmaIsr);
+#endif
+  return woken == pdTRUE;
+}
+
+void initFrameDma() {
+#ifndef GLASSDIAL_OVERDRAW
+  async_memcpy_config_t config = ASYNC_MEMCPY_DEFAULT_CONFIG();
+  config.backlog = SCREEN_HEIGHT + 8;   // 1行1転送 + 取り込み
+  config.psram_trans_align = FRAME_DMA_ALIGN;
+  frameDmaZeros = (uint16_t*)heap_caps_calloc(1, CircleClear::zeroBytes(), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+  frameDmaSignal = xSemaphoreCreateBinary();
+  if (!frameDmaZeros || !frameDmaSignal || esp_async_memcpy_install(&config, &frameDma) != ESP_OK) {
+    frameDma = nullptr;
+    logOut.println("FrameDma: unavailable, clearing on the CPU");
+    return;
+  }
   
-  Crack crack;
-  crack.startX = centerX;
-  crack.startY = centerY;
-  crack.length = random(15, 40) / (generation + 1.0f);
-  crack.angle = angle;
-  crack.endX = centerX + cos(angle) * crack.length;
-  crack.endY = centerY + sin(angle) * crack.length;
-  crack.generation = generation;
-  crack.alpha = 1.0f;
-  crack.active = true;
+  // 比べる相手: 同じ消去を CPU だけでした時間
+  uint16_t* buf = (uint16_t*)frameBuffer.getBuffer();
+  unsigned long start = micros();
+  for (int i = 0; i < 16; i++) circleClear.clear(buf, SCREEN_WIDTH);
+  syncClearMicros = (micros() - start) / 16;
+  logOut.printf("FrameDma: ready, CPU clear %lu us\n", (unsigned long)syncClearMicros);
+#endif
+}
+
+// 出せなければ false（待ち行列が一杯など）。呼び出し側が CPU で代わりにやる
+bool frameDmaCopy(void* dst, void* src, size_t bytes, TaskHandle_t notify) {
+  frameDmaIssued++;
+  if (esp_async_memcpy(frameDma, dst, src, bytes, onFrameDmaDone, notify) == ESP_OK) return true;
+  frameDmaIssued--;
+  return false;
+}
+
+void waitFrameDma() {
+  if (!frameDma) return;
+  while (frameDmaDone != frameDmaIssued) xSemaphoreTake(frameDmaSignal, portMAX_DELAY);
+  if (frameDmaWroteFrame) {
+    Cache_Invalidate_Addr((uint32_t)(uintptr_t)frameBuffer.getBuffer(), FRAME_BYTES);
+    frameDmaWroteFrame = false;
+  }
+}
+
+void beginFrameClear() {
+  if (!frameDma) return;
+  unsigned long start = micros();
+  uint16_t* buf = (uint16_t*)frameBuffer.getBuffer();
+  Cache_WriteBack_Addr((uint32_t)(uintptr_t)buf, FRAME_BYTES);
+  frameClearFellBack = false;
+  circleClear.issue(buf, SCREEN_WIDTH, [](uint16_t* dst, size_t bytes) {
+    if (!frameDmaCopy(dst, frameDmaZeros, bytes, nullptr)) frameClearFellBack = true;
+  });
+  frameDmaWroteFrame = true;
+  frameClearPending = true;
+  frameDmaIssueMicrosSum += micros() - start;
+}
+
+// 消去を仕上げたら true（renderGlass の消去を飛ばせる）
+bool finishFrameClear() {
+  unsigned long start = micros();
+  waitFrameDma();
+  if (!frameClearPending) return false;
+  unsigned long waited = micros();
+  frameDmaWaitMicrosSum += waited - start;
   
-  cracks.push_back(crack);
+  uint16_t* buf = (uint16_t*)frameBuffer.getBuffer();
+  if (frameClearFellBack) circleClear.clear(buf, SCREEN_WIDTH);
+  else circleClear.finish(buf, SCREEN_WIDTH);
+  frameClearPending = false;
+  frameDmaEdgeMicrosSum += micros() - waited;
+  frameDmaFrames++;
+  return true;
+}
+
+// 600フレームごとに、CPU だけで消したときと比べて空いた時間を報告。
+// skipped が描いたフレーム数より少なければ、仕上げた消去が renderGlass まで届かず
+// CPU でも消している（その分は空いていない）
+void reportFrameDma() {
+  if (frameDmaFrames < 600) return;
+  uint32_t issue = frameDmaIssueMicrosSum / frameDmaFrames;
+  uint32_t wait = frameDmaWaitMicrosSum / frameDmaFrames;
+  uint32_t edges = frameDmaEdgeMicrosSum / frameDmaFrames;
+  logOut.printf("FrameDma: CPU clear %lu us -> issue %lu + wait %lu + edges %lu us, freed %ld us/frame, "
+                "skipped %lu/%lu renderGlass clears\n",
+                (unsigned long)syncClearMicros, (unsigned long)issue, (unsigned long)wait,
+                (unsigned long)edges, (long)syncClearMicros - (long)(issue + wait + edges),
+                (unsigned long)frameDmaSkippedClears, (unsigned long)frameDmaRendered);
+  frameDmaRendered = 0;
+  frameDmaSkippedClears = 0;
+  frameDmaIssueMicrosSum = 0;
+  frameDmaWaitMicrosSum = 0;
+  frameDmaEdgeMicrosSum = 0;
+  frameDmaFrames = 0;
 }
 
+#ifdef GLASSDIAL_FRAME_STREAM
 // ========================================
-// SHATTER状態の描画（粉砕）
+// フレームストリーミング（USB CDC）
 // ========================================
-void renderShatter() {
-  // 全てのひび割れを描画
-  for (auto& crack : cracks) {
-    uint32_t color = M5.Display.color565(180, 180, 220);
-    M5.Display.drawLine((int)crack.startX, (int)crack.startY,
-                       (int)crack.endX, (int)crack.endY, color);
+// 合成済みフレームをXOR差分 + ランレングスで圧縮し、低優先度タスクから
+// USB CDCへ送出する。受信・動画化は tools/frame_stream_decode.cpp。
+// 描画側の負担はフレームのコピー1回のみ。送信が追いつかないフレームは間引く。
+// ログも streamTask がパケットの合間に書き出す（デコーダーはパケット外のバイトをログとして出す）。
+const uint32_t STREAM_BYTES_PER_SEC = 300000;  // 帯域上限
+const uint32_t STREAM_KEYFRAME_INTERVAL = 120;  // 途中接続用のキーフレーム間隔
+const size_t STREAM_PIXELS = SCREEN_WIDTH * SCREEN_HEIGHT;
+const size_t STREAM_LOG_BYTES = 4096;           // パケットの合間まで溜めておくログ
+const TickType_t STREAM_LOG_FLUSH_TICKS = pdMS_TO_TICKS(20);  // フレームが来なくてもこの間隔で書き出す
+const TickType_t STREAM_LOG_WAIT_TICKS = pdMS_TO_TICKS(200);  // ログがあふれたとき書き出しを待つ上限
+
+uint16_t* streamFrame = nullptr;   // 描画側から受け取ったフレーム
+uint16_t* streamRef = nullptr;     // 前回送信フレーム（XOR参照）
+uint8_t* streamPacket = nullptr;   // ヘッダ + 圧縮データ
+volatile bool streamBusy = false;
+uint32_t streamFrameIndex = 0;
+uint32_t streamCaptureMicros = 0;
+volatile bool streamCapturedByDma = false;  // streamTask はキャッシュを捨ててから読む
+TaskHandle_t streamTaskHandle = nullptr;
+StreamBufferHandle_t streamLogBuffer = nullptr;  // loop() → streamTask（書き手と読み手が1つずつ）
+
+void initFrameStream() {
+  // DMA で取り込めるよう、フレームバッファと同じくキャッシュの行にそろえる
+  streamFrame = (uint16_t*)heap_caps_aligned_alloc(FRAME_DMA_ALIGN, STREAM_PIXELS * 2, MALLOC_CAP_SPIRAM);
+  streamRef = (uint16_t*)heap_caps_malloc(STREAM_PIXELS * 2, MALLOC_CAP_SPIRAM);
+  streamPacket = (uint8_t*)heap_caps_malloc(sizeof(FramePacketHeader) + frameDeltaBound(STREAM_PIXELS),
+                                            MALLOC_CAP_SPIRAM);
+  streamLogBuffer = xStreamBufferCreate(STREAM_LOG_BYTES, 1);
+  if (!streamFrame || !streamRef || !streamPacket || !streamLogBuffer) {
+    logOut.println("Stream: allocation failed");
+    return;
   }
   
-  // 粒子描画
-  for (auto& p : particles) {
-    if (p.active) {
-      uint8_t alpha = (uint8_t)(p.alpha * 255);
-      uint32_t color = M5.Display.color565(alpha, alpha, alpha);
-      M5.Display.fillCircle((int)p.x, (int)p.y, (int)p.size, color);
-    }
+  // 描画（core 1）を妨げないよう core 0 の最低優先度で動かす
+  xTaskCreatePinnedToCore(streamTask, "frameStream", 4096, nullptr,
+                          tskIDLE_PRIORITY + 1, &streamTaskHandle, 0);
+}
+
+// ログは loop() からしか書かない前提（StreamBuffer は書き手が1つなら排他が要らない）。
+// ダンプのように一度に多く書くときは streamTask が書き出すのを待ち、待ちきれなければ捨てる
+size_t StreamLog::write(const uint8_t* data, size_t size) {
+  if (!streamTaskHandle) return Serial.write(data, size);
+  return xStreamBufferSend(streamLogBuffer, data, size, Serial ? STREAM_LOG_WAIT_TICKS : 0);
+}
+
+// 溜まったログを書き出す（streamTask から、パケットを書き終えたあとに呼ぶ）
+void flushStreamLog() {
+  uint8_t chunk[256];
+  size_t n;
+  while ((n = xStreamBufferReceive(streamLogBuffer, chunk, sizeof(chunk), 0)) > 0) {
+    Serial.write(chunk, n);
   }
+}
+
+void submitStreamFrame() {
+  if (!streamTaskHandle || streamBusy || !Serial) return;
   
-  // フラッシュ効果（粉砕直後）
-  if (millis() - stateStartTime < 200) {
-    float flash = 1.0f - (millis() - stateStartTime) / 200.0f;
-    uint8_t brightness = (uint8_t)(flash * 100);
-    M5.Display.fillCircle(CENTER_X, CENTER_Y, 50, 
-                         M5.Display.color565(brightness, brightness, brightness));
+  unsigned long start = micros();
+  streamFrameIndex = frameCounter;
+  streamBusy = true;
+  
+  // DMA でコピーできれば、完了の割り込みから streamTask を起こす
+  uint16_t* buf = (uint16_t*)frameBuffer.getBuffer();
+  if (frameDma && ((uintptr_t)buf & (FRAME_DMA_ALIGN - 1)) == 0) {
+    Cache_WriteBack_Addr((uint32_t)(uintptr_t)buf, STREAM_PIXELS * 2);
+    Cache_WriteBack_Addr((uint32_t)(uintptr_t)streamFrame, STREAM_PIXELS * 2);
+    streamCapturedByDma = true;
+    if (frameDmaCopy(streamFrame, buf, STREAM_PIXELS * 2, streamTaskHandle)) {
+      streamCaptureMicros = micros() - start;
+      frameDmaIssueMicrosSum += streamCaptureMicros;
+      return;
+    }
   }
+  
+  streamCapturedByDma = false;
+  memcpy(streamFrame, buf, STREAM_PIXELS * 2);
+  streamCaptureMicros = micros() - start;
+  xTaskNotifyGive(streamTaskHandle);
 }
 
-// ========================================
-// 粒子生成
-// ========================================
-void generateParticles() {
-  particles.clear();
+void streamTask(void*) {
+  uint32_t sentFrames = 0;
+  unsigned long nextSendTime = 0;
   
-  for (int i = 0; i < MAX_PARTICLES; i++) {
-    Particle p;
+  while (true) {
+    // フレームを待つあいだもログを書き出す
+    if (ulTaskNotifyTake(pdTRUE, STREAM_LOG_FLUSH_TICKS) == 0) {
+      flushStreamLog();
+      continue;
+    }
+    if (streamCapturedByDma) Cache_Invalidate_Addr((uint32_t)(uintptr_t)streamFrame, STREAM_PIXELS * 2);
+    
+    bool keyframe = (sentFrames % STREAM_KEYFRAME_INTERVAL) == 0;
+    if (keyframe) memset(streamRef, 0, STREAM_PIXELS * 2);
+    
+    FramePacketHeader* header = (FramePacketHeader*)streamPacket;
+    uint8_t* payload = streamPacket + sizeof(FramePacketHeader);
     
-    // 中心からランダムな位置
-    float angle = random(0, 360) * DEG_TO_RAD;
-    float distance = random(10, 60);
-    p.x = CENTER_X + cos(angle) * distance;
-    p.y = CENTER_Y + sin(angle) * distance;
+    unsigned long start = micros();
+    size_t payloadBytes = encodeFrameDelta(streamFrame, streamRef, STREAM_PIXELS, payload);
     
-    // 外向きの速度
-    p.vx = cos(angle) * random(1, 4);
-    p.vy = sin(angle) * random(1, 4);
+    memcpy(header->magic, FRAME_PACKET_MAGIC, 4);
+    header->frameIndex = streamFrameIndex;
+    header->width = SCREEN_WIDTH;
+    header->height = SCREEN_HEIGHT;
+    header->flags = FRAME_FLAG_SWAPPED | (keyframe ? FRAME_FLAG_KEYFRAME : 0);
+    memset(header->reserved, 0, sizeof(header->reserved));
+    header->payloadBytes = payloadBytes;
+    header->checksum = frameChecksum(payload, payloadBytes);
+    header->encodeMicros = micros() - start;
+    header->captureMicros = streamCaptureMicros;
     
-    p.size = random(1, 3);
-    p.alpha = 1.0f;
-    p.active = true;
+    // Serial に書くのはこのタスクだけなので、ログ（logOut）はパケットの合間にしか入らない
+    size_t packetBytes = sizeof(FramePacketHeader) + payloadBytes;
+    Serial.write(streamPacket, packetBytes);
+    sentFrames++;
+    addCoreBusy(0, micros() - start);
+    flushStreamLog();
     
-    particles.push_back(p);
+    // 帯域上限: 送出量に応じて次の送信まで待つ
+    unsigned long now = micros();
+    if ((long)(now - nextSendTime) > 0) nextSendTime = now;
+    nextSendTime += (unsigned long)((uint64_t)packetBytes * 1000000 / STREAM_BYTES_PER_SEC);
+    long waitMicros = (long)(nextSendTime - micros());
+    if (waitMicros > 0) vTaskDelay(pdMS_TO_TICKS(waitMicros / 1000 + 1));
+    
+    streamBusy = false;
+  }
+}
+#endif
+
+// ========================================
+// アトラクトモード
+// ========================================
+// 無操作が続くと、tools/attract_gen.cpp で事前レンダリングした
+// ひび割れ → 粉砕 → 再生のループを再生する。フラッシュ上の差分データを
+// フレームバッファへ展開し、変化した行だけをDMAでパネルへ送る。
+// CPUが行うのは差分の展開のみ。入力があった瞬間に通常描画へ戻る。
+bool updateAttract() {
+  if (!attractActive) {
+    // 通常描画を続けるときは消去に触らない（renderState() が仕上げて renderGlass の消去を飛ばす）
+    if (engine.currentState != NORMAL || millis() - engine.lastInteractionTime < ATTRACT_IDLE_TIME) {
+      return false;
+    }
+    // 出したままの消去・取り込みを終わらせてからバッファに触る
+    finishFrameClear();
+    startAttract();
+    return true;
+  }
+  finishFrameClear();
+  
+  // 入力（エンコーダー・ボタン）で即終了
+  if (millis() - engine.lastInteractionTime < ATTRACT_IDLE_TIME) {
+    stopAttract();
+    return false;
+  }
+  
+  uint32_t targetStep = (millis() - attractStartTime) * ATTRACT_FPS / 1000;
+  if (targetStep == attractShownStep) return true;
+  
+  unsigned long start = micros();
+  
+  // 前回のDMA転送が終わるまでバッファを書き換えない
+  M5.Display.waitDMA();
+  
+  // 遅れたフレームも差分なので順に適用する
+  size_t dirtyFirst = SCREEN_WIDTH * SCREEN_HEIGHT, dirtyLast = 0;
+  while (attractShownStep < targetStep) {
+    attractShownStep++;
+    int index = attractShownStep % ATTRACT_FRAME_COUNT;
+    size_t first, last;
+    applyAttractFrame(index == 0 ? ATTRACT_FRAME_COUNT : index, &first, &last);
+    if (first <= last) {
+      if (first < dirtyFirst) dirtyFirst = first;
+      if (last > dirtyLast) dirtyLast = last;
+    }
+  }
+  
+  if (dirtyFirst <= dirtyLast) {
+    int y0 = dirtyFirst / SCREEN_WIDTH;
+    int y1 = dirtyLast / SCREEN_WIDTH;
+    uint16_t* buf = (uint16_t*)frameBuffer.getBuffer();
+    M5.Display.pushImageDMA(0, y0, SCREEN_WIDTH, y1 - y0 + 1,
+                            (const lgfx::swap565_t*)(buf + y0 * SCREEN_WIDTH));
+    spiBytes += (y1 - y0 + 1) * SCREEN_WIDTH * sizeof(uint16_t);
   }
+  frameCounter++;
+  
+  attractBusyMicros += micros() - start;
+  
+  // 1ループごとにCPU使用率を報告
+  if (attractShownStep % ATTRACT_FRAME_COUNT == 0) {
+    float elapsedMicros = (millis() - attractStartTime) * 1000.0f;
+    logOut.printf("Attract: loop %lu, CPU %.1f%%\n",
+                  (unsigned long)(attractShownStep / ATTRACT_FRAME_COUNT),
+                  attractBusyMicros * 100.0f / elapsedMicros);
+  }
+  
+#ifdef GLASSDIAL_FRAME_STREAM
+  submitStreamFrame();
+#endif
+  return true;
+}
+
+void startAttract() {
+  for (int i = 0; i < 16; i++) {
+    uint16_t c = ATTRACT_PALETTE[i];
+    attractPalette[i] = (c >> 8) | (c << 8);
+  }
+  
+  attractActive = true;
+  attractStartTime = millis();
+  attractShownStep = 0;
+  attractBusyMicros = 0;
+  
+  // 先頭は黒からのキーフレーム
+  frameBuffer.fillScreen(TFT_BLACK);
+  size_t first, last;
+  applyAttractFrame(0, &first, &last);
+  
+  // 再生中はバスを握ったままにしてDMA転送を非同期に流す
+  M5.Display.startWrite();
+  M5.Display.pushImageDMA(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT,
+                          (const lgfx::swap565_t*)frameBuffer.getBuffer());
+  spiBytes += SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t);
+  
+  logOut.println("Attract: start");
+}
+
+void stopAttract() {
+  M5.Display.waitDMA();
+  M5.Display.endWrite();
+  attractActive = false;
+  engine.stateStartTime = millis();
+  destructionGauge.invalidate(); // 縁もアトラクトの画で上書きされている
+  
+  unsigned long elapsed = millis() - attractStartTime;
+  logOut.printf("Attract: stop after %lu ms, CPU %.1f%%\n", elapsed,
+                elapsed ? attractBusyMicros * 0.1f / elapsed : 0.0f);
+}
+
+void applyAttractFrame(int index, size_t* dirtyFirst, size_t* dirtyLast) {
+  uint32_t offset = ATTRACT_FRAME_OFFSETS[index];
+  uint32_t length = ATTRACT_FRAME_OFFSETS[index + 1] - offset;
+  decodePaletteDelta(ATTRACT_DATA + offset, length, attractPalette,
+                     (uint16_t*)frameBuffer.getBuffer(), SCREEN_WIDTH * SCREEN_HEIGHT,
+                     dirtyFirst, dirtyLast);
 }
 
 // ========================================
-// 粒子更新
+// 粒状音（破片の衝突音）
 // ========================================
-void updateParticles() {
-  for (auto& p : particles) {
-    if (!p.active) continue;
+// GlassEngine の衝突（縁への跳ね返り・破片同士）を GrainScheduler で
+// 1フレーム数粒にまとめ、キュー経由で音声タスクへ渡す。音声タスクは
+// 衝突の粒を SamplePlayer（フラッシュ上のガラス音を破片の大きさの音程で再標本化）、
+// 遷移の音を GrainMixer で約5.8msずつ合成し、M5.Speaker の専用チャンネルへ積む。
+// 鳴っていない間はキュー待ちで眠るので、静かなときのCPU負荷はない。
+//
+// 粒・遷移の音・振動の代わりのトーンは、どれも対応するフレームの表示の
+// 見込み時刻（PresentClock）を持つ。音声タスクはその時刻を含むブロックまで
+// 待ち、ブロックの中のサンプル位置（4サンプル = 約0.09ms 単位）から鳴らす。
+// 合成したブロックには GlassReverb で響きをつけ、響きが消えるまでは眠らない。
+void initGrainAudio() {
+  for (int i = 0; i < GRAIN_BUFFER_COUNT; i++) {
+    grainBuffers[i] = (int16_t*)heap_caps_malloc(GRAIN_BLOCK_SAMPLES * sizeof(int16_t),
+                                                 MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  }
+  int16_t* reverbLines = (int16_t*)heap_caps_malloc(GlassReverb::storageSamples() * sizeof(int16_t),
+                                                    MALLOC_CAP_SPIRAM);
+  grainReverb.begin(reverbLines);
+  grainQueue = xQueueCreate(GRAIN_WAITING_MAX, sizeof(GrainRequest));
+  presentQueue = xQueueCreate(GRAIN_WAITING_MAX, sizeof(PresentStart));
+  
+  // 描画ループ（core 1）と分け、取りこぼさないよう高めの優先度で
+  xTaskCreatePinnedToCore(grainAudioTask, "grainAudio", 4096, nullptr,
+                          configMAX_PRIORITIES - 3, nullptr, 0);
+}
+
+void submitImpactGrains() {
+  GrainRequest grains[GRAIN_MAX_PER_FRAME];
+  int count = grainScheduler.schedule(engine.impacts, millis(), micros(), grains);
+  for (int i = 0; i < count; i++) {
+    // 衝突が画に映るときに鳴らす
+    grains[i].startMicros = presentClock.target();
+    grains[i].frame = presentClock.currentFrame();
+    grains[i].voice = GRAIN_VOICE_SAMPLE;
+    xQueueSend(grainQueue, &grains[i], 0); // 満杯なら捨てる
+  }
+}
+
+void grainAudioTask(void*) {
+  const uint32_t blockMicros = GRAIN_BLOCK_SAMPLES * 1000000UL / GRAIN_SAMPLE_RATE;
+  int next = 0;
+  GrainRequest grain;
+  GrainRequest waiting[GRAIN_WAITING_MAX];  // 鳴らす時刻がまだ先の粒
+  int waitingCount = 0;
+  
+  while (true) {
+    // 鳴っておらず待ちも響きもなければ次の粒まで眠る
+    if (grainMixer.activeVoices() == 0 && samplePlayer.activeVoices() == 0 && waitingCount == 0 &&
+        !grainReverb.ringing()) {
+      xQueuePeek(grainQueue, &grain, portMAX_DELAY);
+    }
     
-    if (currentState == SHATTER || currentState == SILENCE) {
-      // 拡散
-      p.x += p.vx;
-      p.y += p.vy;
-      p.vx *= 0.98f; // 減衰
-      p.vy *= 0.98f;
-      p.alpha *= 0.995f;
-      
-      // 画面外チェック
-      if (p.x < 0 || p.x > SCREEN_WIDTH || p.y < 0 || p.y > SCREEN_HEIGHT) {
-        p.alpha *= 0.9f;
-      }
-      
-      if (p.alpha < 0.1f) {
-        p.active = false;
+    // 再生中 + 待ちが埋まっている間は待つ
+    while (M5.Speaker.isPlaying(GRAIN_CHANNEL) >= 2) {
+      vTaskDelay(1);
+    }
+    
+    // このブロックが鳴り始める時刻（先に積まれたブロックの分だけ後ろ）
+    uint32_t now = micros();
+    uint32_t playout = now + M5.Speaker.isPlaying(GRAIN_CHANNEL) * blockMicros;
+    while (waitingCount < GRAIN_WAITING_MAX && xQueueReceive(grainQueue, &grain, 0) == pdTRUE) {
+      waiting[waitingCount++] = grain;
+    }
+    
+    // このブロックの中で始まる粒をサンプル位置つきで予約し、残りは次のブロックへ
+    int kept = 0;
+    for (int i = 0; i < waitingCount; i++) {
+      const GrainRequest& g = waiting[i];
+      int32_t ahead = (int32_t)(g.startMicros - playout);
+      if (ahead >= (int32_t)blockMicros) {
+        waiting[kept++] = g;
+        continue;
       }
+      int offset = 0;
+      if (ahead > 0) offset = (int)((int64_t)ahead * GRAIN_SAMPLE_RATE / 1000000) & ~3;
+      else if (ahead < 0) grainLateCount++;
+      if (g.voice == GRAIN_VOICE_SAMPLE) samplePlayer.startAt(g, offset);
+      else grainMixer.startAt(g, offset);
       
-    } else if (currentState == REBUILD) {
-      // 中央に収束
-      float dx = CENTER_X - p.x;
-      float dy = CENTER_Y - p.y;
-      float distance = sqrt(dx * dx + dy * dy);
+      uint32_t start = playout + (uint32_t)((int64_t)offset * 1000000 / GRAIN_SAMPLE_RATE);
+      uint32_t latency = start - g.eventMicros;
+      grainLatencySum += latency;
+      grainLatencyCount++;
+      if (latency > grainLatencyMax) grainLatencyMax = latency;
       
-      if (distance > 5) {
-        p.vx = dx * 0.05f;
-        p.vy = dy * 0.05f;
-        p.x += p.vx;
-        p.y += p.vy;
-      } else {
-        p.active = false;
-      }
+      PresentStart started = {g.frame, start};
+      xQueueSend(presentQueue, &started, 0);
+    }
+    waitingCount = kept;
+    
+    int16_t* buf = grainBuffers[next];
+    next = (next + 1) % GRAIN_BUFFER_COUNT;
+    grainMixer.render(buf, GRAIN_BLOCK_SAMPLES);
+    samplePlayer.render(buf, GRAIN_BLOCK_SAMPLES);
+    uint32_t mixed = micros();
+    grainMixMicros += mixed - now;
+    grainMixBlocks++;
+    
+    grainReverb.process(buf, GRAIN_BLOCK_SAMPLES);
+    if (grainReverb.ringing()) {
+      grainReverbMicros += micros() - mixed;
+      grainReverbBlocks++;
     }
+    addCoreBusy(0, micros() - now);
+    
+    M5.Speaker.playRaw(buf, GRAIN_BLOCK_SAMPLES, GRAIN_SAMPLE_RATE, false, 1, GRAIN_CHANNEL, false);
+  }
+}
+
+void reportGrainStats() {
+  if (millis() - grainLastReport < GRAIN_REPORT_INTERVAL) return;
+  grainLastReport = millis();
+  
+  // 表示時刻の見込みと、音・振動の開始と表示のずれ（正 = 音が遅い）
+  if (presentClock.skewCount > 0) {
+    const PresentClock& pc = presentClock;
+    logOut.printf("Present: display-out %.1f ms after frame start (estimate error %.1f ms), "
+                  "skew avg %+.2f ms |avg| %.2f ms range %+.2f..%+.2f ms, "
+                  "%lu starts (%lu late, %lu unmatched)\n",
+                  pc.latency / 1000.0f,
+                  pc.frames ? pc.estimateErrorSum / 1000.0f / pc.frames : 0.0f,
+                  pc.skewSum / 1000.0f / pc.skewCount, pc.skewAbsSum / 1000.0f / pc.skewCount,
+                  pc.skewMin / 1000.0f, pc.skewMax / 1000.0f, (unsigned long)pc.skewCount,
+                  (unsigned long)grainLateCount, (unsigned long)pc.unmatched);
+    grainLateCount = 0;
   }
+  presentClock.resetStats();
+  if (grainLatencyCount == 0) return;
+  
+  // 衝突から、その画が表示される時刻に合わせて鳴り始めるまで。
+  // I2S側のDMAバッファ分は含まない
+  logOut.printf("Grains: %lu impacts -> %lu grains (%lu limited, %lu steals), "
+                "latency avg %.1f ms max %.1f ms, mix %lu us/block, reverb %lu us/block (%.1f%% core)\n",
+                (unsigned long)grainScheduler.impactsSeen,
+                (unsigned long)grainScheduler.grainsScheduled,
+                (unsigned long)grainScheduler.grainsLimited,
+                (unsigned long)(grainMixer.voiceSteals + samplePlayer.voiceSteals),
+                grainLatencySum / 1000.0f / grainLatencyCount,
+                grainLatencyMax / 1000.0f,
+                (unsigned long)(grainMixBlocks ? grainMixMicros / grainMixBlocks : 0),
+                (unsigned long)(grainReverbBlocks ? grainReverbMicros / grainReverbBlocks : 0),
+                grainReverbBlocks ? grainReverbMicros * 100.0f / grainReverbBlocks /
+                                        (GRAIN_BLOCK_SAMPLES * 1000000.0f / GRAIN_SAMPLE_RATE) : 0.0f);
+  grainLatencyCount = 0;
+  grainLatencySum = 0;
+  grainLatencyMax = 0;
+  grainMixMicros = 0;
+  grainMixBlocks = 0;
+  grainReverbMicros = 0;
+  grainReverbBlocks = 0;
 }
 
+#ifdef GLASSDIAL_RECORD_INPUT
 // ========================================
-// SILENCE状態の描画（余韻）
+// 入力記録（ホストでの再生用）
 // ========================================
-void renderSilence() {
-  // 残光の粒子のみ
-  for (auto& p : particles) {
-    if (p.active && p.alpha > 0.3f) {
-      uint8_t brightness = (uint8_t)(p.alpha * 150);
-      uint32_t color = M5.Display.color565(brightness, brightness, brightness + 50);
-      M5.Display.fillCircle((int)p.x, (int)p.y, (int)p.size, color);
-    }
-  }
+// 毎フレームの入力を "IN,時刻,回転量,ボタン" の1行で出力する。
+// 起動時の "SESSION,時刻,シード" と合わせて、tools/ のホスト側ツールで
+// 同じセッションをそのまま再現できる。
+void recordInput(const GlassInput& input, unsigned long now) {
+  logOut.printf("IN,%lu,%ld,%d\n", now, (long)input.encoderDelta, (int)input.button);
 }
+#endif
 
+#ifdef GLASSDIAL_OVERDRAW
 // ========================================
-// REBUILD状態の描画（修復）
+// 重ね塗りの計測
 // ========================================
-void renderRebuild() {
-  // ひび割れが徐々に消える
-  for (auto& crack : cracks) {
-    crack.alpha *= 0.95f;
-    if (crack.alpha > 0.1f) {
-      uint8_t brightness = (uint8_t)(crack.alpha * 200);
-      uint32_t color = M5.Display.color565(brightness, brightness, 255);
-      M5.Display.drawLine((int)crack.startX, (int)crack.startY,
-                         (int)crack.endX, (int)crack.endY, color);
-    }
+// 工程ごとの書き込み画素数とプリミティブ数を State 別に集計し、10秒ごとに
+// 1フレーム平均を出力する。シリアルから 'h' を送ると直前のフレームの
+// 書き込み回数を "OD,行,16進" で吐き出す（tools/overdraw_report --from-log で画像化）。
+// 描画時間には計数のコストも含まれるので、通常ビルドとの比較には使わないこと。
+// 万華鏡の写しとメッセージは工程 overlay に数える。
+const char* OVERDRAW_STATE_NAMES[STATE_COUNT] = {"NORMAL", "CRACK", "SHATTER", "SILENCE", "REBUILD", "RECOVERY"};
+
+void initOverdraw() {
+  overdrawCounts = (uint8_t*)heap_caps_malloc(SCREEN_WIDTH * SCREEN_HEIGHT, MALLOC_CAP_SPIRAM);
+  overdrawGfx = new OverdrawGfx<M5Canvas>(frameBuffer, overdrawCounts);
+  memset(overdrawStats, 0, sizeof(overdrawStats));
+  overdrawLastReport = millis();
+  logOut.println("Overdraw: send 'h' to dump the per-pixel write counts");
+}
+
+void recordOverdraw() {
+  overdrawStats[engine.currentState].add(overdrawGfx->frame);
+  
+  while (Serial.available() > 0) {
+    if (Serial.read() == 'h') dumpOverdraw();
   }
   
-  // 粒子が中央に集まる
-  for (auto& p : particles) {
-    if (p.active) {
-      uint32_t color = M5.Display.color565(180, 200, 255);
-      M5.Display.fillCircle((int)p.x, (int)p.y, (int)p.size, color);
-      
-      // トレイル効果
-      M5.Display.drawLine((int)p.x, (int)p.y, CENTER_X, CENTER_Y,
-                         M5.Display.color565(50, 50, 100));
+  if (millis() - overdrawLastReport < OVERDRAW_REPORT_INTERVAL) return;
+  overdrawLastReport = millis();
+  
+  uint32_t frames = 0;
+  for (int s = 0; s < STATE_COUNT; s++) {
+    const OverdrawStateStats& st = overdrawStats[s];
+    if (st.frames == 0) continue;
+    frames += st.frames;
+    
+    uint64_t total = st.totalPixels();
+    logOut.printf("Overdraw %s: %lu frames, %lu px/frame (%.2fx screen)", OVERDRAW_STATE_NAMES[s],
+                  (unsigned long)st.frames, (unsigned long)(total / st.frames),
+                  (double)total / st.frames / (SCREEN_WIDTH * SCREEN_HEIGHT));
+    for (int g = 0; g < STAGE_COUNT; g++) {
+      if (st.pixels[g] == 0) continue;
+      uint32_t prims = 0;
+      for (int p = 0; p < PRIM_COUNT; p++) prims += st.primitives[g][p];
+      logOut.printf(" %s %lu px/%lu prim", renderStageName(g),
+                    (unsigned long)(st.pixels[g] / st.frames), (unsigned long)(prims / st.frames));
     }
+    logOut.println("");
   }
-  
-  // 中央の光
-  float intensity = 1.0f - destructionLevel;
-  uint8_t brightness = (uint8_t)(intensity * 100);
-  M5.Display.fillCircle(CENTER_X, CENTER_Y, 10, 
-                       M5.Display.color565(brightness, brightness, brightness + 50));
+  if (frames > 0) {
+    logOut.printf("Overdraw: render %lu us/frame (with counting)\n",
+                  (unsigned long)(overdrawMicrosSum / frames));
+  }
+  memset(overdrawStats, 0, sizeof(overdrawStats));
+  overdrawMicrosSum = 0;
 }
 
+void dumpOverdraw() {
+  static const char HEX_DIGITS[] = "0123456789abcdef";
+  char line[SCREEN_WIDTH * 2 + 1];
+  for (int y = 0; y < SCREEN_HEIGHT; y++) {
+    const uint8_t* row = overdrawCounts + y * SCREEN_WIDTH;
+    for (int x = 0; x < SCREEN_WIDTH; x++) {
+      line[x * 2] = HEX_DIGITS[row[x] >> 4];
+      line[x * 2 + 1] = HEX_DIGITS[row[x] & 0x0F];
+    }
+    line[SCREEN_WIDTH * 2] = '\0';
+    logOut.printf("OD,%d,%s\n", y, line);
+  }
+}
+#endif
+
+#ifdef GLASSDIAL_POLYGON_BENCH
 // ========================================
-// RECOVERY状態の描画（完全修復）
+// 破片の多角形の塗りの計測
 // ========================================
-void renderRecovery() {
-  // フェードイン効果で透明ガラスに戻る
-  float progress = (millis() - stateStartTime) / 800.0f;
-  uint8_t brightness = (uint8_t)((1.0f - progress) * 150);
-  
-  // 中央の光が広がる
-  int radius = (int)(progress * 80);
-  M5.Display.drawCircle(CENTER_X, CENTER_Y, radius, 
-                       M5.Display.color565(brightness, brightness, brightness + 30));
-  
-  // 最終的な光の明滅
-  if (progress > 0.7f) {
-    float pulse = sin((millis() - stateStartTime) * 0.01f) * 0.5f + 0.5f;
-    uint8_t pulseBright = (uint8_t)(pulse * 80);
-    M5.Display.fillCircle(CENTER_X, CENTER_Y, 5,
-                         M5.Display.color565(pulseBright, pulseBright, pulseBright + 50));
+// 起動時に一度だけ、同じ破片の列を PolygonRaster（アンチエイリアス）と
+// M5GFX の fillTriangle（破片の中心からの扇に分けた三角形）でフレームバッファに描き、
+// 1フレームあたりの時間を出力する（tools/polygon_bench.cpp の端末版）。
+const int POLYGON_BENCH_COUNTS[] = {50, 100, 200};
+const int POLYGON_BENCH_FRAMES = 20;
+const int POLYGON_BENCH_MAX_POINTS = 9;
+
+struct BenchShard {
+  PolygonPoint center;
+  PolygonPoint points[POLYGON_BENCH_MAX_POINTS];
+  int count;
+  uint16_t color;
+};
+
+// 中心のまわりに角度を少しずつずらして頂点を置いた星形の多角形（凹みも含む）
+void makeBenchShard(GlassRandom& rng, BenchShard& s) {
+  float radius = rng.uniformFloat(0.0f, 95.0f);
+  float direction = rng.uniformFloat(0.0f, 6.2831853f);
+  s.center.x = CENTER_X + radius * cosf(direction);
+  s.center.y = CENTER_Y + radius * sinf(direction);
+  float size = rng.uniformFloat(5.0f, 22.0f);
+  s.count = rng.uniform(4, POLYGON_BENCH_MAX_POINTS + 1);
+  for (int i = 0; i < s.count; i++) {
+    float angle = 6.2831853f * (i + rng.uniformFloat(0.0f, 0.8f)) / s.count;
+    float r = size * rng.uniformFloat(0.3f, 1.0f);
+    s.points[i].x = s.center.x + r * cosf(angle);
+    s.points[i].y = s.center.y + r * sinf(angle);
+  }
+  uint8_t b = (uint8_t)rng.uniform(120, 256);
+  s.color = frameBuffer.color565(b * 3 / 4, b * 4 / 5, b);
+}
+
+void runPolygonBench() {
+  GlassRandom rng(5);
+  for (int count : POLYGON_BENCH_COUNTS) {
+    std::vector<BenchShard> shards(count);
+    int triangles = 0;
+    for (auto& s : shards) {
+      makeBenchShard(rng, s);
+      triangles += s.count;
+    }
+    PolygonRaster raster(GLASS_CLEAR_RADIUS, count, count * POLYGON_BENCH_MAX_POINTS);
+    
+    uint32_t aaMicros = 0, triMicros = 0;
+    for (int f = 0; f < POLYGON_BENCH_FRAMES; f++) {
+      frameBuffer.fillScreen(TFT_BLACK);
+      unsigned long start = micros();
+      for (auto& s : shards) raster.add(s.points, s.count, s.color);
+      raster.flush(frameBuffer);
+      aaMicros += micros() - start;
+      
+      frameBuffer.fillScreen(TFT_BLACK);
+      start = micros();
+      frameBuffer.startWrite();
+      for (auto& s : shards) {
+        for (int i = 0; i < s.count; i++) {
+          const PolygonPoint& a = s.points[i];
+          const PolygonPoint& b = s.points[i + 1 < s.count ? i + 1 : 0];
+          frameBuffer.fillTriangle((int)s.center.x, (int)s.center.y, (int)a.x, (int)a.y, (int)b.x, (int)b.y,
+                                   s.color);
+        }
+      }
+      frameBuffer.endWrite();
+      triMicros += micros() - start;
+    }
+    logOut.printf("PolygonBench: %d shards, %d triangles: aa %lu us/frame, fillTriangle %lu us/frame (%.2fx)\n",
+                  count, triangles, (unsigned long)(aaMicros / POLYGON_BENCH_FRAMES),
+                  (unsigned long)(triMicros / POLYGON_BENCH_FRAMES), (double)triMicros / aaMicros);
   }
+  frameBuffer.fillScreen(TFT_BLACK);
 }
+#endif
 
+#ifdef GLASSDIAL_PANEL_444
 // ========================================
-// サウンド再生
+// 12ビット出力
 // ========================================
-void playSound(int frequency, int duration) {
-  M5.Speaker.tone(frequency, duration);
+// パネルを COLMOD = 12ビットに切り替えて、詰めたバイト列をそのまま送る。
+// アトラクトモードや M5GFX の描画は RGB565 のままなので、1フレームごとに戻す。
+void initPanel444() {
+  for (int i = 0; i < 2; i++) {
+    panel444Strips[i] = (uint8_t*)heap_caps_malloc(PANEL444_STRIP_BYTES, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+  }
+}
+
+void pushFrame444() {
+  const uint16_t* buf = (const uint16_t*)frameBuffer.getBuffer();
+  M5.Display.startWrite();
+  M5.Display.writeCommand(0x3A);
+  M5.Display.writeData(PANEL_COLMOD_RGB444);
+  M5.Display.setAddrWindow(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+  for (int y = 0, strip = 0; y < SCREEN_HEIGHT; y += PANEL444_STRIP_ROWS, strip ^= 1) {
+    // 2つ前の帯の転送は、1つ前の帯を送り始めたときに終わっている
+    uint8_t* out = panel444Strips[strip];
+    int rows = SCREEN_HEIGHT - y < PANEL444_STRIP_ROWS ? SCREEN_HEIGHT - y : PANEL444_STRIP_ROWS;
+    for (int r = 0; r < rows; r++) {
+      const uint16_t* src = buf + (y + r) * SCREEN_WIDTH;
+      uint8_t* dst = out + panelPack444Bytes(r * SCREEN_WIDTH);
+      if (panelDitherEnabled) panelPack444RowDither(src, dst, SCREEN_WIDTH, y + r, panelDither);
+      else panelPack444Row(src, dst, SCREEN_WIDTH);
+    }
+    // バイト入れ替えなし（swap = false）の16ビット単位は、メモリの順のまま送られる
+    size_t bytes = panelPack444Bytes(rows * SCREEN_WIDTH);
+    M5.Display.writePixelsDMA((const uint16_t*)out, bytes / 2, false);
+    spiBytes += bytes;
+  }
+  M5.Display.waitDMA();
+  M5.Display.writeCommand(0x3A);
+  M5.Display.writeData(PANEL_COLMOD_RGB565);
+  M5.Display.endWrite();
 }
+#endif
 
+#ifdef GLASSDIAL_LOCKSTEP
 // ========================================
-// 触覚フィードバック
+// ロックステップ（2台で同じガラス）
 // ========================================
-void hapticFeedback(int duration, int strength) {
-  // M5Dialの内蔵振動モーターを制御
-  // 注: M5Dialの具体的な振動API実装に依存
-  // 擬似的な実装（実際のハードウェアに合わせて調整）
-  
-  // トーン音で代替する簡易実装
-  M5.Speaker.tone(100, duration);
+// engine は millis() ではなくフレームの時刻（Lockstep.h）で進め、両方の入力を
+// 合わせたものだけを入れる。つながったら共通の種でやり直す。
+void initLockstep() {
+  Serial1.begin(LOCKSTEP_BAUD, SERIAL_8N1, LOCKSTEP_RX_PIN, LOCKSTEP_TX_PIN);
+  lockstep = new LockstepLink(esp_random(), LOCKSTEP_INPUT_DELAY);
+  engineTime = engine.stateStartTime;
+  lockstepLastReport = millis();
+  logOut.println("Lockstep: waiting for peer on Port B");
+}
+
+void stepLockstep(const GlassInput& input, unsigned long now) {
+  uint8_t buf[64];
+  bool wasConnected = lockstep->connected();
+  while (Serial1.available() > 0) {
+    size_t n = Serial1.readBytes(buf, sizeof(buf) < (size_t)Serial1.available() ? sizeof(buf) : Serial1.available());
+    lockstep->receive(buf, n, now);
+  }
+  if (lockstep->connected() && !wasConnected) {
+    lockstepConnectedAt = now;
+    engine.rng.setSeed(lockstep->sessionSeed());
+    engine.reset(lockstep->frameTime(0));
+    engineTime = engine.stateStartTime;
+    if (paneStack) paneStack->invalidate();
+    destructionGauge.invalidate();
+    logOut.printf("Lockstep: connected, session seed %08lx\n", (unsigned long)lockstep->sessionSeed());
+  }
+
+  // loop が 16ms より遅いときは、経過したフレームの分の空の入力も送る（相手と同じ速さで進む）
+  lockstep->sendLocal(input, now);
+  if (lockstep->connected()) {
+    uint32_t target = (now - lockstepConnectedAt) / LOCKSTEP_FRAME_MS + 1;
+    GlassInput none = {0, BUTTON_NONE};
+    for (int k = 0; k < 2 && lockstep->localFrame() < target + LOCKSTEP_INPUT_DELAY; k++) {
+      lockstep->sendLocal(none, now);
+    }
+
+    // 経過に追いつくまで進める（1回の loop で3フレームまで）。音・振動はフレームごとに出す
+    GlassInput combined;
+    for (int k = 0; k < 3 && lockstep->frame < target && lockstep->nextInput(combined); k++) {
+      unsigned long stepStart = micros();
+      engineTime = lockstep->frameTime(lockstep->frame - 1);
+      engine.step(combined, engineTime);
+      if (engine.fluidSteps > 0) {
+        fluidMicrosSum += micros() - stepStart;
+        fluidStepCount += engine.fluidSteps;
+      }
+      lockstep->checkState(engine.stateHash());
+      dispatchEngineEvents();
+      submitImpactGrains();
+    }
+  }
+
+  if (!lockstep->outgoing.empty()) {
+    Serial1.write(lockstep->outgoing.data(), lockstep->outgoing.size());
+    lockstep->outgoing.clear();
+  }
+  reportLockstep(now);
+}
+
+// 通信量・往復時間・入力待ち・チェックの結果を 10秒ごとに報告
+void reportLockstep(unsigned long now) {
+  if (now - lockstepLastReport < LOCKSTEP_REPORT_INTERVAL) return;
+  const LockstepStats& s = lockstep->stats;
+  uint32_t bytes = s.bytesSent + s.bytesReceived;
+  float seconds = (now - lockstepLastReport) / 1000.0f;
+  lockstepLastReport = now;
+  if (!lockstep->connected()) {
+    logOut.println("Lockstep: waiting for peer");
+    return;
+  }
+  logOut.printf("Lockstep: frame %lu, %.0f B/s, rtt avg %lu ms max %lu ms, delay %d frames, stalls %lu, bad %lu, "
+                "checks %lu, %s\n",
+                (unsigned long)lockstep->frame, (bytes - lockstepLastBytes) / seconds,
+                (unsigned long)(s.rttCount ? s.rttSumMs / s.rttCount : 0), (unsigned long)s.rttMaxMs,
+                LOCKSTEP_INPUT_DELAY, (unsigned long)s.stalls, (unsigned long)s.badPackets,
+                (unsigned long)s.checksMatched, s.desyncFrame < 0 ? "in sync" : "DESYNC");
+  if (s.desyncFrame >= 0) logOut.printf("Lockstep: first desync at frame %ld\n", (long)s.desyncFrame);
+  lockstepLastBytes = bytes;
 }
+#endif
 
+#ifdef GLASSDIAL_TRACE
 // ========================================
-// ボタン処理
+// スケジューリングの記録
 // ========================================
-void handleButton() {
-  // 短押し: 一段階戻る
-  if (M5.BtnA.wasPressed()) {
-    lastInteractionTime = millis();
-    
-    switch (currentState) {
-      case CRACK:
-        currentState = NORMAL;
-        cracks.clear();
-        destructionLevel = 0.0f;
-        break;
-      case SHATTER:
-      case SILENCE:
-        currentState = CRACK;
-        particles.clear();
-        destructionLevel = CRACK_THRESHOLD + 0.1f;
-        break;
-      case REBUILD:
-      case RECOVERY:
-        currentState = NORMAL;
-        particles.clear();
-        cracks.clear();
-        destructionLevel = 0.0f;
-        break;
+// 50us ごとのタイマー割り込み（core 1）で両コアの実行中のタスクを見て、
+// 替わったときだけ TaskTrace に積む。フレームの区切りは loop() が積み、
+// フレームごとに描画タスク（loopTask）以外が core 1 で動いていた時間を集計する。
+// 10秒ごとに奪われた時間とタスクごとの CPU 使用率を出力し、シリアルから 't' を
+// 送るか、TRACE_SLOW_STEAL_MICROS 以上奪われたフレームがあると記録を "TR," で
+// 吐き出す（tools/trace_export で Chrome / Perfetto のタイムラインにする）。
+// 割り込みは記録を入れたもの（フレームDMAの完了）しか見えない。
+void initTrace() {
+  TraceEvent* buffer = (TraceEvent*)heap_caps_malloc(TRACE_CAPACITY * sizeof(TraceEvent), MALLOC_CAP_SPIRAM);
+  traceFrameEvents = (TraceEvent*)heap_caps_malloc(TRACE_FRAME_EVENTS * sizeof(TraceEvent), MALLOC_CAP_INTERNAL);
+  taskTrace = new TaskTrace(buffer, TRACE_CAPACITY);
+  traceFrameDmaIsr = taskTrace->registerIsr("frameDma");
+  traceLastReport = millis();
+
+  // 割り込みは登録したコア（loop の core 1）で走る。1MHz で数える
+  traceTimer = timerBegin(0, 80, true);
+  timerAttachInterrupt(traceTimer, onTraceSample, true);
+  timerAlarmWrite(traceTimer, TRACE_SAMPLE_MICROS, true);
+  timerAlarmEnable(traceTimer);
+  logOut.printf("Trace: sampling every %lu us, %lu events; send 't' to dump\n",
+                (unsigned long)TRACE_SAMPLE_MICROS, (unsigned long)TRACE_CAPACITY);
+}
+
+void IRAM_ATTR onTraceSample() {
+  uint32_t start = micros();
+  for (int core = 0; core < TRACE_CORES; core++) {
+    TaskHandle_t task = xTaskGetCurrentTaskHandleForCPU(core);
+    taskTrace->sample(start, core, task, pcTaskGetName(task));
+  }
+  traceSamplerMicros += micros() - start;
+}
+
+void traceFrameBegin() {
+  traceFrameId = (uint16_t)frameCounter;
+  taskTrace->record(micros(), TRACE_FRAME_BEGIN, xPortGetCoreID(), traceFrameId);
+}
+
+void traceFrameEnd() {
+  int core = xPortGetCoreID();
+  taskTrace->record(micros(), TRACE_FRAME_END, core, traceFrameId);
+  int renderTask = taskTrace->findTask(loopTaskHandle);
+  size_t count = taskTrace->copyLastFrame(core, traceFrameEvents, TRACE_FRAME_EVENTS);
+  if (renderTask >= 0 && count > 0) {
+    TraceSteal steal = traceSteal(traceFrameEvents, count, core, renderTask);
+    traceFrames++;
+    traceFrameMicrosSum += steal.frameMicros;
+    traceStolenSum += steal.stolenMicros;
+    traceIsrSum += steal.isrMicros;
+    tracePreemptions += steal.preemptions;
+    if (traceFrames == 1 || steal.stolenMicros > traceWorst.stolenMicros) {
+      traceWorst = steal;
+      traceWorstFrame = traceFrameId;
+    }
+    // 遅いフレームの直後に、その前後の記録を残す
+    if (steal.stolenMicros >= TRACE_SLOW_STEAL_MICROS &&
+        (!traceDumped || millis() - traceLastDump >= TRACE_DUMP_COOLDOWN)) {
+      logOut.printf("Trace: frame %u lost %lu us, dumping\n", (unsigned)traceFrameId,
+                    (unsigned long)steal.stolenMicros);
+      dumpTrace();
     }
-    
-    playSound(800, 50);
-    Serial.println("Button: Step back");
   }
-  
-  // 長押し: 完全リセット
-  if (M5.BtnA.pressedFor(1000)) {
-    currentState = NORMAL;
-    particles.clear();
-    cracks.clear();
-    destructionLevel = 0.0f;
-    lastInteractionTime = millis();
-    
-    playSound(FREQ_RECOVERY, 200);
-    Serial.println("Button: Full reset");
-    
-    // 長押し後の再トリガー防止
-    while (M5.BtnA.isPressed()) {
-      M5.update();
-      delay(10);
+
+  while (Serial.available() > 0) {
+    if (Serial.read() == 't') dumpTrace();
+  }
+  reportTrace();
+}
+
+void reportTrace() {
+  if (millis() - traceLastReport < TRACE_REPORT_INTERVAL) return;
+  unsigned long elapsed = millis() - traceLastReport;
+  traceLastReport = millis();
+
+  if (traceFrames > 0) {
+    logOut.printf("Trace: %lu frames, %lu us/frame, stolen avg %lu us (isr %lu us), %.2f preemptions/frame, "
+                  "worst %lu us in frame %lu (%s %lu us), sampler %.1f%% CPU\n",
+                  (unsigned long)traceFrames, (unsigned long)(traceFrameMicrosSum / traceFrames),
+                  (unsigned long)(traceStolenSum / traceFrames), (unsigned long)(traceIsrSum / traceFrames),
+                  (double)tracePreemptions / traceFrames, (unsigned long)traceWorst.stolenMicros,
+                  (unsigned long)traceWorstFrame,
+                  traceWorst.topTask >= 0 ? taskTrace->taskName(traceWorst.topTask) : "-",
+                  (unsigned long)traceWorst.topMicros, traceSamplerMicros * 0.1 / elapsed);
+  }
+  // タスクごとの CPU 使用率（標本数の割合）
+  for (int core = 0; core < TRACE_CORES; core++) {
+    uint32_t counts[TRACE_MAX_TASKS];
+    uint32_t total = 0;
+    for (int t = 0; t < taskTrace->tasks(); t++) {
+      counts[t] = taskTrace->takeSamples(core, t);
+      total += counts[t];
+    }
+    if (total == 0) continue;
+    logOut.printf("Trace CPU core %d:", core);
+    for (int t = 0; t < taskTrace->tasks(); t++) {
+      if (counts[t] == 0) continue;
+      logOut.printf(" %s %.1f%%", taskTrace->taskName(t), counts[t] * 100.0 / total);
     }
+    logOut.println("");
   }
+
+  traceFrames = 0;
+  traceFrameMicrosSum = 0;
+  traceStolenSum = 0;
+  traceIsrSum = 0;
+  tracePreemptions = 0;
+  traceSamplerMicros = 0;
 }
 
+// TR,BEGIN,周期,数 / TR,TASK,id,名前 / TR,ISR,id,名前 / TR,RENDER,id / TR,E,時刻,種類,コア,id / TR,END
+void dumpTrace() {
+  taskTrace->enabled = false;
+  uint32_t count = taskTrace->size();
+  logOut.printf("TR,BEGIN,%lu,%lu\n", (unsigned long)TRACE_SAMPLE_MICROS, (unsigned long)count);
+  for (int t = 0; t < taskTrace->tasks(); t++) logOut.printf("TR,TASK,%d,%s\n", t, taskTrace->taskName(t));
+  for (int i = 0; i < taskTrace->isrs(); i++) logOut.printf("TR,ISR,%d,%s\n", i, taskTrace->isrName(i));
+  logOut.printf("TR,RENDER,%d\n", taskTrace->findTask(loopTaskHandle));
+  for (uint32_t i = 0; i < count; i++) {
+    const TraceEvent& e = taskTrace->at(i);
+    logOut.printf("TR,E,%lu,%u,%u,%u\n", (unsigned long)e.micros, (unsigned)e.type, (unsigned)e.core,
+                  (unsigned)e.id);
+  }
+  logOut.println("TR,END");
+  taskTrace->enabled = true;
+  traceDumped = true;
+  traceLastDump = millis();
+}
+#endif
+
 // ========================================
-// 自動修復
+// 消費電力の見積もり
 // ========================================
-void autoRecover() {
-  // 10秒間操作がない場合、自動的にNORMALに戻る
-  if (currentState != NORMAL && 
-      millis() - lastInteractionTime > AUTO_RECOVER_TIME) {
-    
-    Serial.println("Auto-recovery triggered");
-    
-    // ゆっくりと修復
-    if (destructionLevel > 0) {
-      destructionLevel -= 0.01f;
-      
-      if (destructionLevel <= 0) {
-        destructionLevel = 0;
-        currentState = RECOVERY;
-        stateStartTime = millis();
-        particles.clear();
-        cracks.clear();
-        playSound(FREQ_RECOVERY, 150);
+// フレームごとに活動量（前回からの経過・コアごとの処理時間・SPI のバイト数・
+// バックライト・スピーカー）を EnergyMeter に足し、State 別・機能の有無別に
+// 1時間あたりの mWh を 1分ごとに出力する。core 1 の処理時間は loop() の
+// フレームの時間（DMA や粉塵タスクの待ちも含むので多めに出る）、core 0 は
+// 粉塵・粒状音・フレームストリームの各タスクが自分で足した時間。
+const char* ENERGY_STATE_NAMES[STATE_COUNT] = {"NORMAL", "CRACK", "SHATTER", "SILENCE", "REBUILD", "RECOVERY"};
+
+void recordEnergy(uint32_t loopBusyMicros) {
+  addCoreBusy(1, loopBusyMicros);
+  uint32_t now = micros();
+  EnergyActivity activity;
+  activity.elapsedMicros = now - energyLastMicros;
+  energyLastMicros = now;
+  for (int core = 0; core < ENERGY_CORES; core++) {
+    uint32_t busy = coreBusyMicros[core];
+    activity.coreBusyMicros[core] = busy - energyLastBusy[core];
+    energyLastBusy[core] = busy;
+  }
+  activity.cpuMhz = getCpuFrequencyMhz();
+  activity.spiBytes = spiBytes - energyLastSpiBytes;
+  energyLastSpiBytes = spiBytes;
+  activity.backlight = M5.Display.getBrightness();
+  bool sound = M5.Speaker.isPlaying();
+  activity.speakerMicros = sound ? activity.elapsedMicros : 0;
+
+  uint32_t features = 0;
+  if (perfHud.visible) features |= 1u << ENERGY_HUD;
+  if (attractActive) features |= 1u << ENERGY_ATTRACT;
+  if (engine.dustLevel > 0.0f) features |= 1u << ENERGY_DUST;
+  if (engine.fluidActive) features |= 1u << ENERGY_FLUID;
+  if (sound) features |= 1u << ENERGY_SOUND;
+
+  double microjoules = energyMeter.add(engine.currentState, features, activity);
+  if (activity.elapsedMicros > 0) {
+    float mw = (float)(microjoules * 1000.0 / activity.elapsedMicros);
+    energyRecentMw += (mw - energyRecentMw) / 16.0f;
+  }
+  reportEnergy();
+}
+
+void reportEnergy() {
+  if (millis() - energyLastReport < ENERGY_REPORT_INTERVAL) return;
+  energyLastReport = millis();
+
+  const EnergyBucket& total = energyMeter.total;
+  if (total.micros == 0) return;
+  double hours = total.micros / 3.6e9;
+  double ms = total.micros / 1000.0;
+#ifdef GLASSDIAL_ENERGY_CALIBRATED
+  const char* source = "calibrated";
+#else
+  const char* source = "default";
+#endif
+  logOut.printf("Energy: %.2f h, %.0f mWh/h (base %.0f, cpu %.0f, spi %.0f, backlight %.0f, speaker %.0f mW), "
+                "%.1f mWh total, %s coefficients\n",
+                hours, total.averageMw(), total.energy.base / ms, total.energy.cpu / ms, total.energy.spi / ms,
+                total.energy.backlight / ms, total.energy.speaker / ms, total.energy.total() / 3.6e6, source);
+  for (int s = 0; s < STATE_COUNT; s++) {
+    const EnergyBucket& b = energyMeter.states[s];
+    if (b.micros == 0) continue;
+    logOut.printf("Energy %s: %.1f%% of time, %.0f mWh/h while in it, %.0f mWh of each hour\n",
+                  ENERGY_STATE_NAMES[s], b.micros * 100.0 / total.micros, b.averageMw(),
+                  energyMeter.stateShareMwhPerHour(s));
+  }
+  logOut.print("Energy features:");
+  for (int f = 0; f < ENERGY_FEATURE_COUNT; f++) {
+    const EnergyBucket& on = energyMeter.features[f][1];
+    if (on.micros == 0) continue;
+    logOut.printf(" %s %+.0f mW (on %.1f%%)", ENERGY_FEATURE_NAMES[f], energyMeter.featureCostMw(f),
+                  on.micros * 100.0 / total.micros);
+  }
+  logOut.println("");
+}
+
+#ifdef GLASSDIAL_ENERGY_CALIBRATE
+// ========================================
+// 消費電力の係数の校正
+// ========================================
+// 起動時に一度だけ、負荷の段階を ENERGY_CAL_PHASE_MS ずつ順に流す。各段階の間の
+// 平均電力を USB 電力計で読み、段階ごとの活動量の行 "CAL,..." と一緒に
+// tools/energy_calibrate.cpp へ渡すと src/energy_calibration.h ができる。
+const unsigned long ENERGY_CAL_PHASE_MS = 30000;
+const unsigned long ENERGY_CAL_SPIN_MICROS = 10000;   // 1回に回し続ける時間（間に1tick 休んで WDT を満たす）
+const char* const ENERGY_CAL_PHASES[] = {"idle", "backlight", "cpu1", "cpu0+1", "spi", "speaker"};
+const int ENERGY_CAL_PHASE_COUNT = sizeof(ENERGY_CAL_PHASES) / sizeof(ENERGY_CAL_PHASES[0]);
+volatile bool energyCalSpinCore0 = false;
+
+// 決まった時間だけ CPU を回し、回した時間を返す
+uint32_t energyCalibrationSpin() {
+  volatile uint32_t x = 1;
+  uint32_t start = micros();
+  while (micros() - start < ENERGY_CAL_SPIN_MICROS) x = x * 1664525u + 1013904223u;
+  return micros() - start;
+}
+
+void energyCalibrationSpinTask(void*) {
+  for (;;) {
+    if (energyCalSpinCore0) addCoreBusy(0, energyCalibrationSpin());
+    vTaskDelay(1);
+  }
+}
+
+void runEnergyCalibration() {
+  TaskHandle_t spinTask = nullptr;
+  xTaskCreatePinnedToCore(energyCalibrationSpinTask, "energyCal", 2048, nullptr, 1, &spinTask, 0);
+  frameBuffer.fillScreen(TFT_BLACK);
+  frameBuffer.pushSprite(0, 0);
+  logOut.printf("EnergyCal: %d phases of %lu s; note the average power (mW) of each from a USB meter\n",
+                ENERGY_CAL_PHASE_COUNT, ENERGY_CAL_PHASE_MS / 1000);
+
+  for (int phase = 0; phase < ENERGY_CAL_PHASE_COUNT; phase++) {
+    const char* name = ENERGY_CAL_PHASES[phase];
+    bool backlight = strcmp(name, "backlight") == 0;
+    bool speaker = strcmp(name, "speaker") == 0;
+    M5.Display.setBrightness(backlight ? 255 : 0);
+    energyCalSpinCore0 = strcmp(name, "cpu0+1") == 0;
+    if (speaker) M5.Speaker.tone(1000, ENERGY_CAL_PHASE_MS);
+    logOut.printf("EnergyCal: phase %d %s\n", phase, name);
+
+    uint32_t busy0 = coreBusyMicros[0], busy1 = coreBusyMicros[1], bytes = spiBytes;
+    uint32_t speakerMicros = 0;
+    uint32_t start = micros();
+    unsigned long startMs = millis();
+    while (millis() - startMs < ENERGY_CAL_PHASE_MS) {
+      uint32_t step = micros();
+      if (strcmp(name, "cpu1") == 0 || energyCalSpinCore0) {
+        addCoreBusy(1, energyCalibrationSpin());
+        vTaskDelay(1);
+      } else if (strcmp(name, "spi") == 0) {
+        uint32_t pushStart = micros();
+        frameBuffer.pushSprite(0, 0);
+        addCoreBusy(1, micros() - pushStart);
+        spiBytes += SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t);
+        vTaskDelay(1);
+      } else {
+        vTaskDelay(pdMS_TO_TICKS(10));
       }
+      if (M5.Speaker.isPlaying()) speakerMicros += micros() - step;
     }
-    
-    lastInteractionTime = millis(); // 連続実行を防ぐ
+    uint32_t elapsed = micros() - start;
+    M5.Speaker.stop();
+    energyCalSpinCore0 = false;
+
+    // CAL,段階,名前,経過us,core0 us,core1 us,MHz,SPIバイト,バックライト,スピーカーus
+    logOut.printf("CAL,%d,%s,%lu,%lu,%lu,%lu,%lu,%u,%lu\n", phase, name, (unsigned long)elapsed,
+                  (unsigned long)(coreBusyMicros[0] - busy0), (unsigned long)(coreBusyMicros[1] - busy1),
+                  (unsigned long)getCpuFrequencyMhz(), (unsigned long)(spiBytes - bytes),
+                  (unsigned)(backlight ? 255 : 0), (unsigned long)speakerMicros);
   }
+
+  vTaskDelete(spinTask);
+  M5.Display.setBrightness(200);
+  logOut.println("EnergyCal: done (run tools/energy_calibrate with this log and the meter readings)");
 }
+#endif
@@ -0,0 +1,1051 @@
+// 自動生成ファイル: tools/glass_sample_gen.cpp が出力。手で編集しないこと。
+#pragma once
+
+#include <stdint.h>
+
+// [位相（0〜256、最後は小数部 1.0）][タップ]、Kaiser 窓（beta 7.0）つき sinc、各行の和は 32768
+// 音程比 <= 1.00: 16 タップ、遮断 0.450（元の標本化周波数に対する比）
+const int16_t RESAMPLE_TABLE_0[257][16] = {
+  {48, -192, 511, -1046, 1755, -2495, 3063, 29480, 3063, -2495, 1755, -1046, 511, -192, 48, 0},
+  {48, -192, 510, -1040, 1737, -2451, 2946, 29484, 3181, -2540, 1774, -1053, 513, -192, 48, -5},
+  {48, -192, 508, -1033, 1718, -2406, 2830, 29483, 3299, -2585, 1792, -1060, 515, -192, 48, -5},
+  {48, -192, 506, -1026, 1699, -2361, 2714, 29479, 3418, -2630, 1811, -1066, 516, -192, 48, -4},
+  {48, -192, 504, -1019, 1680, -2316, 2599, 29474, 3537, -2674, 1829, -1072, 518, -192, 48, -4},
+  {48, -191, 502, -1012, 1661, -2271, 2484, 29471, 3657, -2719, 1847, -1079, 519, -192, 47, -4},
+  {49, -191, 500, -1005, 1642, -2226, 2371, 29462, 3778, -2763, 1865, -1085, 520, -192, 47, -4},
+  {49, -191, 498, -998, 1622, -2180, 2257, 29456, 3899, -2808, 1882, -1091, 522, -192, 47, -4},
+  {49, -191, 496, -990, 1603, -2135, 2145, 29445, 4021, -2852, 1900, -1097, 523, -192, 47, -4},
+  {49, -190, 494, -983, 1583, -2090, 2033, 29435, 4143, -2896, 1917, -1102, 524, -192, 47, -4},
+  {49, -190, 492, -975, 1563, -2045, 1922, 29425, 4266, -2940, 1934, -1108, 525, -192, 46, -4},
+  {49, -190, 490, -968, 1544, -1999, 1812, 29409, 4389, -2983, 1952, -1113, 526, -192, 46, -4},
+  {49, -189, 487, -960, 1524, -1954, 1702, 29396, 4513, -3027, 1968, -1119, 527, -191, 46, -4},
+  {49, -189, 485, -952, 1504, -1909, 1593, 29380, 4638, -3071, 1985, -1124, 528, -191, 46, -4},
+  {49, -188, 483, -944, 1484, -1864, 1484, 29362, 4763, -3114, 2002, -1129, 529, -191, 46, -4},
+  {49, -188, 480, -936, 1463, -1818, 1377, 29345, 4889, -3157, 2018, -1134, 530, -191, 45, -4},
+  {49, -187, 478, -928, 1443, -1773, 1270, 29325, 5015, -3200, 2034, -1139, 530, -190, 45, -4},
+  {49, -187, 475, -920, 1423, -1728, 1164, 29306, 5141, -3243, 2050, -1144, 531, -190, 45, -4},
+  {49, -186, 473, -912, 1402, -1683, 1058, 29284, 5269, -3286, 2066, -1149, 531, -189, 45, -4},
+  {49, -186, 470, -904, 1382, -1638, 953, 29263, 5396, -3328, 2082, -1154, 532, -189, 44, -4},
+  {49, -185, 467, -895, 1361, -1592, 849, 29238, 5524, -3371, 2097, -1158, 532, -188, 44, -4},
+  {48, -185, 465, -887, 1341, -1547, 746, 29211, 5653, -3413, 2113, -1162, 533, -188, 44, -4},
+  {48, -184, 462, -878, 1320, -1502, 643, 29185, 5782, -3455, 2128, -1166, 533, -187, 43, -4},
+  {48, -183, 459, -870, 1299, -1457, 541, 29158, 5912, -3496, 2143, -1171, 533, -187, 43, -4},
+  {48, -183, 456, -861, 1278, -1412, 440, 29129, 6042, -3538, 2157, -1174, 533, -186, 43, -4},
+  {48, -182, 453, -852, 1258, -1368, 340, 29099, 6172, -3579, 2172, -1178, 533, -186, 42, -4},
+  {48, -181, 450, -844, 1237, -1323, 240, 29067, 6303, -3620, 2186, -1182, 533, -185, 42, -3},
+  {48, -181, 447, -835, 1216, -1278, 141, 29035, 6434, -3661, 2200, -1185, 533, -184, 41, -3},
+  {48, -180, 444, -826, 1195, -1234, 43, 29002, 6566, -3702, 2214, -1189, 533, -184, 41, -3},
+  {48, -179, 441, -817, 1174, -1189, -54, 28964, 6698, -3742, 2228, -1192, 533, -183, 41, -3},
+  {48, -178, 438, -808, 1152, -1145, -151, 28929, 6831, -3782, 2241, -1195, 533, -182, 40, -3},
+  {47, -178, 435, -799, 1131, -1100, -246, 28891, 6964, -3822, 2255, -1198, 532, -181, 40, -3},
+  {47, -177, 432, -790, 1110, -1056, -341, 28853, 7097, -3862, 2268, -1201, 532, -180, 39, -3},
+  {47, -176, 429, -781, 1089, -1012, -435, 28814, 7231, -3901, 2280, -1204, 531, -180, 39, -3},
+  {47, -175, 425, -772, 1068, -968, -529, 28772, 7365, -3940, 2293, -1206, 531, -179, 39, -3},
+  {47, -174, 422, -763, 1046, -924, -621, 28731, 7500, -3979, 2305, -1209, 530, -178, 38, -3},
+  {47, -173, 419, -753, 1025, -880, -713, 28686, 7635, -4018, 2317, -1211, 529, -177, 38, -3},
+  {47, -173, 415, -744, 1004, -836, -804, 28642, 7770, -4056, 2329, -1213, 529, -176, 37, -3},
+  {46, -172, 412, -735, 982, -793, -895, 28597, 7906, -4094, 2341, -1215, 528, -175, 37, -2},
+  {46, -171, 409, -725, 961, -749, -984, 28549, 8041, -4131, 2352, -1217, 527, -174, 36, -2},
+  {46, -170, 405, -716, 940, -706, -1073, 28502, 8178, -4169, 2363, -1219, 526, -173, 36, -2},
+  {46, -169, 402, -706, 918, -663, -1160, 28452, 8314, -4206, 2374, -1220, 524, -171, 35, -2},
+  {46, -168, 398, -697, 897, -620, -1247, 28401, 8451, -4242, 2385, -1221, 523, -170, 34, -2},
+  {45, -167, 395, -687, 875, -577, -1333, 28351, 8588, -4279, 2395, -1223, 522, -169, 34, -2},
+  {45, -166, 391, -677, 854, -534, -1419, 28298, 8726, -4315, 2405, -1224, 521, -168, 33, -2},
+  {45, -165, 387, -668, 833, -492, -1503, 28244, 8864, -4350, 2415, -1225, 519, -167, 33, -2},
+  {45, -164, 384, -658, 811, -449, -1587, 28187, 9002, -4386, 2425, -1225, 518, -165, 32, -2},
+  {45, -163, 380, -648, 790, -407, -1670, 28130, 9140, -4420, 2434, -1226, 516, -164, 32, -1},
+  {44, -162, 376, -639, 768, -365, -1752, 28077, 9278, -4455, 2443, -1226, 514, -163, 31, -1},
+  {44, -160, 373, -629, 747, -323, -1833, 28015, 9417, -4489, 2452, -1227, 513, -161, 30, -1},
+  {44, -159, 369, -619, 726, -282, -1913, 27956, 9556, -4523, 2460, -1227, 511, -160, 30, -1},
+  {44, -158, 365, -609, 704, -240, -1993, 27895, 9696, -4557, 2469, -1227, 509, -158, 29, -1},
+  {43, -157, 361, -599, 683, -199, -2071, 27835, 9835, -4590, 2477, -1227, 507, -157, 28, -1},
+  {43, -156, 358, -590, 662, -158, -2149, 27770, 9975, -4622, 2484, -1226, 505, -155, 28, -1},
+  {43, -155, 354, -580, 640, -117, -2226, 27707, 10115, -4655, 2492, -1226, 503, -154, 27, 0},
+  {43, -154, 350, -570, 619, -76, -2302, 27641, 10255, -4686, 2499, -1225, 500, -152, 26, 0},
+  {42, -152, 346, -560, 598, -36, -2378, 27575, 10395, -4718, 2506, -1224, 498, -150, 26, 0},
+  {42, -151, 342, -550, 577, 4, -2452, 27509, 10535, -4749, 2512, -1223, 496, -149, 25, 0},
+  {42, -150, 338, -540, 555, 45, -2525, 27440, 10676, -4780, 2519, -1222, 493, -147, 24, 0},
+  {42, -149, 334, -530, 534, 84, -2598, 27371, 10817, -4810, 2525, -1221, 491, -145, 23, 0},
+  {41, -148, 330, -520, 513, 124, -2670, 27300, 10958, -4840, 2530, -1219, 488, -143, 23, 1},
+  {41, -146, 326, -510, 492, 163, -2741, 27229, 11099, -4869, 2536, -1218, 485, -142, 22, 1},
+  {41, -145, 322, -500, 471, 203, -2811, 27155, 11240, -4898, 2541, -1216, 483, -140, 21, 1},
+  {40, -144, 318, -490, 450, 241, -2880, 27083, 11381, -4926, 2546, -1214, 480, -138, 20, 1},
+  {40, -143, 314, -480, 429, 280, -2949, 27007, 11523, -4954, 2550, -1211, 477, -136, 20, 1},
+  {40, -141, 310, -470, 409, 319, -3016, 26929, 11664, -4981, 2554, -1209, 474, -134, 19, 1},
+  {40, -140, 306, -460, 388, 357, -3083, 26853, 11806, -5008, 2558, -1207, 470, -132, 18, 2},
+  {39, -139, 302, -450, 367, 395, -3149, 26777, 11947, -5035, 2562, -1204, 467, -130, 17, 2},
+  {39, -137, 298, -440, 346, 432, -3213, 26697, 12089, -5061, 2565, -1201, 464, -128, 16, 2},
+  {39, -136, 294, -430, 326, 470, -3278, 26617, 12231, -5087, 2568, -1198, 461, -126, 15, 2},
+  {38, -135, 290, -420, 305, 507, -3341, 26537, 12373, -5112, 2571, -1195, 457, -124, 15, 2},
+  {38, -133, 286, -410, 285, 544, -3403, 26451, 12515, -5136, 2573, -1191, 454, -122, 14, 3},
+  {38, -132, 281, -400, 264, 581, -3464, 26369, 12657, -5160, 2575, -1188, 450, -119, 13, 3},
+  {37, -131, 277, -390, 244, 617, -3525, 26288, 12798, -5184, 2577, -1184, 446, -117, 12, 3},
+  {37, -129, 273, -380, 224, 653, -3585, 26203, 12940, -5207, 2578, -1180, 442, -115, 11, 3},
+  {37, -128, 269, -370, 204, 689, -3643, 26115, 13082, -5229, 2579, -1176, 439, -113, 10, 3},
+  {36, -127, 265, -360, 183, 725, -3701, 26028, 13224, -5251, 2580, -1172, 435, -110, 9, 4},
+  {36, -125, 261, -350, 163, 760, -3758, 25940, 13366, -5272, 2580, -1167, 430, -108, 8, 4},
+  {36, -124, 256, -340, 143, 795, -3814, 25853, 13508, -5293, 2580, -1163, 426, -106, 7, 4},
+  {35, -122, 252, -330, 124, 830, -3870, 25762, 13650, -5314, 2580, -1158, 422, -103, 6, 4},
+  {35, -121, 248, -320, 104, 864, -3924, 25671, 13792, -5333, 2579, -1153, 418, -101, 5, 4},
+  {35, -120, 244, -310, 84, 898, -3978, 25581, 13933, -5353, 2578, -1148, 413, -98, 4, 5},
+  {34, -118, 240, -300, 65, 932, -4030, 25486, 14075, -5371, 2577, -1143, 409, -96, 3, 5},
+  {34, -117, 235, -290, 45, 966, -4082, 25393, 14217, -5389, 2575, -1137, 404, -93, 2, 5},
+  {34, -115, 231, -280, 26, 999, -4133, 25298, 14358, -5407, 2573, -1131, 400, -91, 1, 5},
+  {33, -114, 227, -270, 6, 1032, -4183, 25204, 14499, -5424, 2571, -1126, 395, -88, 0, 6},
+  {33, -113, 223, -260, -13, 1064, -4232, 25107, 14641, -5440, 2568, -1120, 390, -85, -1, 6},
+  {33, -111, 219, -250, -32, 1097, -4280, 25007, 14782, -5455, 2565, -1113, 385, -83, -2, 6},
+  {32, -110, 214, -241, -51, 1129, -4328, 24912, 14923, -5471, 2562, -1107, 381, -80, -3, 6},
+  {32, -108, 210, -231, -70, 1160, -4374, 24811, 15064, -5485, 2558, -1100, 375, -77, -4, 7},
+  {32, -107, 206, -221, -89, 1192, -4420, 24712, 15205, -5499, 2554, -1094, 370, -75, -5, 7},
+  {31, -105, 202, -211, -107, 1223, -4465, 24610, 15345, -5512, 2550, -1087, 365, -72, -6, 7},
+  {31, -104, 198, -202, -126, 1254, -4509, 24509, 15486, -5525, 2545, -1080, 360, -69, -7, 7},
+  {31, -103, 193, -192, -144, 1284, -4552, 24405, 15626, -5537, 2540, -1072, 355, -66, -8, 8},
+  {30, -101, 189, -182, -163, 1314, -4594, 24302, 15766, -5548, 2535, -1065, 349, -63, -9, 8},
+  {30, -100, 185, -173, -181, 1344, -4635, 24197, 15906, -5559, 2529, -1057, 344, -60, -10, 8},
+  {30, -98, 181, -163, -199, 1374, -4676, 24092, 16045, -5569, 2523, -1049, 338, -57, -12, 8},
+  {29, -97, 177, -154, -217, 1403, -4715, 23986, 16185, -5578, 2516, -1041, 332, -54, -13, 9},
+  {29, -95, 172, -144, -235, 1432, -4754, 23879, 16324, -5587, 2509, -1033, 327, -51, -14, 9},
+  {28, -94, 168, -135, -252, 1460, -4792, 23773, 16463, -5595, 2502, -1025, 321, -48, -15, 9},
+  {28, -92, 164, -125, -270, 1488, -4829, 23662, 16602, -5603, 2495, -1016, 315, -45, -16, 10},
+  {28, -91, 160, -116, -288, 1516, -4865, 23555, 16740, -5610, 2487, -1008, 309, -42, -17, 10},
+  {27, -90, 156, -107, -305, 1543, -4900, 23448, 16878, -5616, 2478, -999, 303, -39, -19, 10},
+  {27, -88, 151, -97, -322, 1571, -4935, 23335, 17016, -5621, 2470, -990, 297, -36, -20, 10},
+  {27, -87, 147, -88, -339, 1597, -4968, 23223, 17154, -5626, 2461, -980, 290, -33, -21, 11},
+  {26, -85, 143, -79, -356, 1624, -5001, 23111, 17291, -5630, 2451, -971, 284, -29, -22, 11},
+  {26, -84, 139, -70, -373, 1650, -5033, 22998, 17428, -5633, 2441, -961, 278, -26, -23, 11},
+  {26, -82, 135, -61, -390, 1676, -5064, 22885, 17565, -5636, 2431, -952, 271, -23, -25, 12},
+  {25, -81, 131, -52, -406, 1701, -5094, 22771, 17701, -5638, 2421, -942, 265, -20, -26, 12},
+  {25, -79, 127, -43, -423, 1726, -5123, 22654, 17837, -5639, 2410, -931, 258, -16, -27, 12},
+  {25, -78, 123, -34, -439, 1751, -5152, 22540, 17972, -5640, 2399, -921, 251, -13, -28, 12},
+  {24, -76, 119, -25, -455, 1775, -5179, 22423, 18108, -5640, 2387, -911, 245, -10, -30, 13},
+  {24, -75, 115, -16, -471, 1799, -5206, 22305, 18243, -5639, 2375, -900, 238, -6, -31, 13},
+  {23, -74, 110, -7, -487, 1823, -5232, 22189, 18377, -5637, 2363, -889, 231, -3, -32, 13},
+  {23, -72, 106, 2, -503, 1846, -5257, 22070, 18511, -5635, 2350, -878, 224, 1, -34, 14},
+  {23, -71, 102, 11, -518, 1869, -5282, 21951, 18645, -5632, 2337, -867, 217, 4, -35, 14},
+  {22, -69, 98, 19, -534, 1891, -5305, 21832, 18778, -5628, 2324, -856, 210, 8, -36, 14},
+  {22, -68, 94, 28, -549, 1914, -5328, 21710, 18911, -5623, 2310, -844, 203, 11, -38, 15},
+  {22, -66, 90, 37, -564, 1936, -5349, 21586, 19044, -5618, 2296, -832, 195, 15, -39, 15},
+  {21, -65, 86, 45, -579, 1957, -5370, 21468, 19176, -5612, 2281, -821, 188, 18, -40, 15},
+  {21, -64, 83, 54, -594, 1978, -5391, 21344, 19307, -5605, 2266, -809, 181, 22, -41, 16},
+  {21, -62, 79, 62, -608, 1999, -5410, 21220, 19438, -5598, 2251, -796, 173, 26, -43, 16},
+  {20, -61, 75, 70, -623, 2019, -5429, 21098, 19569, -5589, 2236, -784, 166, 29, -44, 16},
+  {20, -59, 71, 79, -637, 2039, -5446, 20971, 19699, -5580, 2220, -771, 158, 33, -46, 17},
+  {20, -58, 67, 87, -651, 2059, -5463, 20847, 19829, -5570, 2203, -759, 150, 37, -47, 17},
+  {19, -57, 63, 95, -665, 2078, -5479, 20724, 19958, -5560, 2186, -746, 143, 40, -48, 17},
+  {19, -55, 59, 103, -679, 2097, -5495, 20597, 20087, -5548, 2169, -733, 135, 44, -50, 18},
+  {19, -54, 55, 111, -693, 2116, -5509, 20470, 20215, -5536, 2152, -720, 127, 48, -51, 18},
+  {18, -52, 52, 119, -706, 2134, -5523, 20341, 20343, -5523, 2134, -706, 119, 52, -52, 18},
+  {18, -51, 48, 127, -720, 2152, -5536, 20215, 20470, -5509, 2116, -693, 111, 55, -54, 19},
+  {18, -50, 44, 135, -733, 2169, -5548, 20087, 20597, -5495, 2097, -679, 103, 59, -55, 19},
+  {17, -48, 40, 143, -746, 2186, -5560, 19958, 20724, -5479, 2078, -665, 95, 63, -57, 19},
+  {17, -47, 37, 150, -759, 2203, -5570, 19829, 20847, -5463, 2059, -651, 87, 67, -58, 20},
+  {17, -46, 33, 158, -771, 2220, -5580, 19699, 20971, -5446, 2039, -637, 79, 71, -59, 20},
+  {16, -44, 29, 166, -784, 2236, -5589, 19569, 21098, -5429, 2019, -623, 70, 75, -61, 20},
+  {16, -43, 26, 173, -796, 2251, -5598, 19438, 21220, -5410, 1999, -608, 62, 79, -62, 21},
+  {16, -41, 22, 181, -809, 2266, -5605, 19307, 21344, -5391, 1978, -594, 54, 83, -64, 21},
+  {15, -40, 18, 188, -821, 2281, -5612, 19176, 21468, -5370, 1957, -579, 45, 86, -65, 21},
+  {15, -39, 15, 195, -832, 2296, -5618, 19044, 21586, -5349, 1936, -564, 37, 90, -66, 22},
+  {15, -38, 11, 203, -844, 2310, -5623, 18911, 21710, -5328, 1914, -549, 28, 94, -68, 22},
+  {14, -36, 8, 210, -856, 2324, -5628, 18778, 21832, -5305, 1891, -534, 19, 98, -69, 22},
+  {14, -35, 4, 217, -867, 2337, -5632, 18645, 21951, -5282, 1869, -518, 11, 102, -71, 23},
+  {14, -34, 1, 224, -878, 2350, -5635, 18511, 22070, -5257, 1846, -503, 2, 106, -72, 23},
+  {13, -32, -3, 231, -889, 2363, -5637, 18377, 22189, -5232, 1823, -487, -7, 110, -74, 23},
+  {13, -31, -6, 238, -900, 2375, -5639, 18243, 22305, -5206, 1799, -471, -16, 115, -75, 24},
+  {13, -30, -10, 245, -911, 2387, -5640, 18108, 22423, -5179, 1775, -455, -25, 119, -76, 24},
+  {12, -28, -13, 251, -921, 2399, -5640, 17972, 22540, -5152, 1751, -439, -34, 123, -78, 25},
+  {12, -27, -16, 258, -931, 2410, -5639, 17837, 22654, -5123, 1726, -423, -43, 127, -79, 25},
+  {12, -26, -20, 265, -942, 2421, -5638, 17701, 22771, -5094, 1701, -406, -52, 131, -81, 25},
+  {12, -25, -23, 271, -952, 2431, -5636, 17565, 22885, -5064, 1676, -390, -61, 135, -82, 26},
+  {11, -23, -26, 278, -961, 2441, -5633, 17428, 22998, -5033, 1650, -373, -70, 139, -84, 26},
+  {11, -22, -29, 284, -971, 2451, -5630, 17291, 23111, -5001, 1624, -356, -79, 143, -85, 26},
+  {11, -21, -33, 290, -980, 2461, -5626, 17154, 23223, -4968, 1597, -339, -88, 147, -87, 27},
+  {10, -20, -36, 297, -990, 2470, -5621, 17016, 23335, -4935, 1571, -322, -97, 151, -88, 27},
+  {10, -19, -39, 303, -999, 2478, -5616, 16878, 23448, -4900, 1543, -305, -107, 156, -90, 27},
+  {10, -17, -42, 309, -1008, 2487, -5610, 16740, 23555, -4865, 1516, -288, -116, 160, -91, 28},
+  {10, -16, -45, 315, -1016, 2495, -5603, 16602, 23662, -4829, 1488, -270, -125, 164, -92, 28},
+  {9, -15, -48, 321, -1025, 2502, -5595, 16463, 23773, -4792, 1460, -252, -135, 168, -94, 28},
+  {9, -14, -51, 327, -1033, 2509, -5587, 16324, 23879, -4754, 1432, -235, -144, 172, -95, 29},
+  {9, -13, -54, 332, -1041, 2516, -5578, 16185, 23986, -4715, 1403, -217, -154, 177, -97, 29},
+  {8, -12, -57, 338, -1049, 2523, -5569, 16045, 24092, -4676, 1374, -199, -163, 181, -98, 30},
+  {8, -10, -60, 344, -1057, 2529, -5559, 15906, 24197, -4635, 1344, -181, -173, 185, -100, 30},
+  {8, -9, -63, 349, -1065, 2535, -5548, 15766, 24302, -4594, 1314, -163, -182, 189, -101, 30},
+  {8, -8, -66, 355, -1072, 2540, -5537, 15626, 24405, -4552, 1284, -144, -192, 193, -103, 31},
+  {7, -7, -69, 360, -1080, 2545, -5525, 15486, 24509, -4509, 1254, -126, -202, 198, -104, 31},
+  {7, -6, -72, 365, -1087, 2550, -5512, 15345, 24610, -4465, 1223, -107, -211, 202, -105, 31},
+  {7, -5, -75, 370, -1094, 2554, -5499, 15205, 24712, -4420, 1192, -89, -221, 206, -107, 32},
+  {7, -4, -77, 375, -1100, 2558, -5485, 15064, 24811, -4374, 1160, -70, -231, 210, -108, 32},
+  {6, -3, -80, 381, -1107, 2562, -5471, 14923, 24912, -4328, 1129, -51, -241, 214, -110, 32},
+  {6, -2, -83, 385, -1113, 2565, -5455, 14782, 25007, -4280, 1097, -32, -250, 219, -111, 33},
+  {6, -1, -85, 390, -1120, 2568, -5440, 14641, 25107, -4232, 1064, -13, -260, 223, -113, 33},
+  {6, 0, -88, 395, -1126, 2571, -5424, 14499, 25204, -4183, 1032, 6, -270, 227, -114, 33},
+  {5, 1, -91, 400, -1131, 2573, -5407, 14358, 25298, -4133, 999, 26, -280, 231, -115, 34},
+  {5, 2, -93, 404, -1137, 2575, -5389, 14217, 25393, -4082, 966, 45, -290, 235, -117, 34},
+  {5, 3, -96, 409, -1143, 2577, -5371, 14075, 25486, -4030, 932, 65, -300, 240, -118, 34},
+  {5, 4, -98, 413, -1148, 2578, -5353, 13933, 25581, -3978, 898, 84, -310, 244, -120, 35},
+  {4, 5, -101, 418, -1153, 2579, -5333, 13792, 25671, -3924, 864, 104, -320, 248, -121, 35},
+  {4, 6, -103, 422, -1158, 2580, -5314, 13650, 25762, -3870, 830, 124, -330, 252, -122, 35},
+  {4, 7, -106, 426, -1163, 2580, -5293, 13508, 25853, -3814, 795, 143, -340, 256, -124, 36},
+  {4, 8, -108, 430, -1167, 2580, -5272, 13366, 25940, -3758, 760, 163, -350, 261, -125, 36},
+  {4, 9, -110, 435, -1172, 2580, -5251, 13224, 26028, -3701, 725, 183, -360, 265, -127, 36},
+  {3, 10, -113, 439, -1176, 2579, -5229, 13082, 26115, -3643, 689, 204, -370, 269, -128, 37},
+  {3, 11, -115, 442, -1180, 2578, -5207, 12940, 26203, -3585, 653, 224, -380, 273, -129, 37},
+  {3, 12, -117, 446, -1184, 2577, -5184, 12798, 26288, -3525, 617, 244, -390, 277, -131, 37},
+  {3, 13, -119, 450, -1188, 2575, -5160, 12657, 26369, -3464, 581, 264, -400, 281, -132, 38},
+  {3, 14, -122, 454, -1191, 2573, -5136, 12515, 26451, -3403, 544, 285, -410, 286, -133, 38},
+  {2, 15, -124, 457, -1195, 2571, -5112, 12373, 26537, -3341, 507, 305, -420, 290, -135, 38},
+  {2, 15, -126, 461, -1198, 2568, -5087, 12231, 26617, -3278, 470, 326, -430, 294, -136, 39},
+  {2, 16, -128, 464, -1201, 2565, -5061, 12089, 26697, -3213, 432, 346, -440, 298, -137, 39},
+  {2, 17, -130, 467, -1204, 2562, -5035, 11947, 26777, -3149, 395, 367, -450, 302, -139, 39},
+  {2, 18, -132, 470, -1207, 2558, -5008, 11806, 26853, -3083, 357, 388, -460, 306, -140, 40},
+  {1, 19, -134, 474, -1209, 2554, -4981, 11664, 26929, -3016, 319, 409, -470, 310, -141, 40},
+  {1, 20, -136, 477, -1211, 2550, -4954, 11523, 27007, -2949, 280, 429, -480, 314, -143, 40},
+  {1, 20, -138, 480, -1214, 2546, -4926, 11381, 27083, -2880, 241, 450, -490, 318, -144, 40},
+  {1, 21, -140, 483, -1216, 2541, -4898, 11240, 27155, -2811, 203, 471, -500, 322, -145, 41},
+  {1, 22, -142, 485, -1218, 2536, -4869, 11099, 27229, -2741, 163, 492, -510, 326, -146, 41},
+  {1, 23, -143, 488, -1219, 2530, -4840, 10958, 27300, -2670, 124, 513, -520, 330, -148, 41},
+  {0, 23, -145, 491, -1221, 2525, -4810, 10817, 27371, -2598, 84, 534, -530, 334, -149, 42},
+  {0, 24, -147, 493, -1222, 2519, -4780, 10676, 27440, -2525, 45, 555, -540, 338, -150, 42},
+  {0, 25, -149, 496, -1223, 2512, -4749, 10535, 27509, -2452, 4, 577, -550, 342, -151, 42},
+  {0, 26, -150, 498, -1224, 2506, -4718, 10395, 27575, -2378, -36, 598, -560, 346, -152, 42},
+  {0, 26, -152, 500, -1225, 2499, -4686, 10255, 27641, -2302, -76, 619, -570, 350, -154, 43},
+  {0, 27, -154, 503, -1226, 2492, -4655, 10115, 27707, -2226, -117, 640, -580, 354, -155, 43},
+  {-1, 28, -155, 505, -1226, 2484, -4622, 9975, 27770, -2149, -158, 662, -590, 358, -156, 43},
+  {-1, 28, -157, 507, -1227, 2477, -4590, 9835, 27835, -2071, -199, 683, -599, 361, -157, 43},
+  {-1, 29, -158, 509, -1227, 2469, -4557, 9696, 27895, -1993, -240, 704, -609, 365, -158, 44},
+  {-1, 30, -160, 511, -1227, 2460, -4523, 9556, 27956, -1913, -282, 726, -619, 369, -159, 44},
+  {-1, 30, -161, 513, -1227, 2452, -4489, 9417, 28015, -1833, -323, 747, -629, 373, -160, 44},
+  {-1, 31, -163, 514, -1226, 2443, -4455, 9278, 28077, -1752, -365, 768, -639, 376, -162, 44},
+  {-1, 32, -164, 516, -1226, 2434, -4420, 9140, 28130, -1670, -407, 790, -648, 380, -163, 45},
+  {-2, 32, -165, 518, -1225, 2425, -4386, 9002, 28187, -1587, -449, 811, -658, 384, -164, 45},
+  {-2, 33, -167, 519, -1225, 2415, -4350, 8864, 28244, -1503, -492, 833, -668, 387, -165, 45},
+  {-2, 33, -168, 521, -1224, 2405, -4315, 8726, 28298, -1419, -534, 854, -677, 391, -166, 45},
+  {-2, 34, -169, 522, -1223, 2395, -4279, 8588, 28351, -1333, -577, 875, -687, 395, -167, 45},
+  {-2, 34, -170, 523, -1221, 2385, -4242, 8451, 28401, -1247, -620, 897, -697, 398, -168, 46},
+  {-2, 35, -171, 524, -1220, 2374, -4206, 8314, 28452, -1160, -663, 918, -706, 402, -169, 46},
+  {-2, 36, -173, 526, -1219, 2363, -4169, 8178, 28502, -1073, -706, 940, -716, 405, -170, 46},
+  {-2, 36, -174, 527, -1217, 2352, -4131, 8041, 28549, -984, -749, 961, -725, 409, -171, 46},
+  {-2, 37, -175, 528, -1215, 2341, -4094, 7906, 28597, -895, -793, 982, -735, 412, -172, 46},
+  {-3, 37, -176, 529, -1213, 2329, -4056, 7770, 28642, -804, -836, 1004, -744, 415, -173, 47},
+  {-3, 38, -177, 529, -1211, 2317, -4018, 7635, 28686, -713, -880, 1025, -753, 419, -173, 47},
+  {-3, 38, -178, 530, -1209, 2305, -3979, 7500, 28731, -621, -924, 1046, -763, 422, -174, 47},
+  {-3, 39, -179, 531, -1206, 2293, -3940, 7365, 28772, -529, -968, 1068, -772, 425, -175, 47},
+  {-3, 39, -180, 531, -1204, 2280, -3901, 7231, 28814, -435, -1012, 1089, -781, 429, -176, 47},
+  {-3, 39, -180, 532, -1201, 2268, -3862, 7097, 28853, -341, -1056, 1110, -790, 432, -177, 47},
+  {-3, 40, -181, 532, -1198, 2255, -3822, 6964, 28891, -246, -1100, 1131, -799, 435, -178, 47},
+  {-3, 40, -182, 533, -1195, 2241, -3782, 6831, 28929, -151, -1145, 1152, -808, 438, -178, 48},
+  {-3, 41, -183, 533, -1192, 2228, -3742, 6698, 28964, -54, -1189, 1174, -817, 441, -179, 48},
+  {-3, 41, -184, 533, -1189, 2214, -3702, 6566, 29002, 43, -1234, 1195, -826, 444, -180, 48},
+  {-3, 41, -184, 533, -1185, 2200, -3661, 6434, 29035, 141, -1278, 1216, -835, 447, -181, 48},
+  {-3, 42, -185, 533, -1182, 2186, -3620, 6303, 29067, 240, -1323, 1237, -844, 450, -181, 48},
+  {-4, 42, -186, 533, -1178, 2172, -3579, 6172, 29099, 340, -1368, 1258, -852, 453, -182, 48},
+  {-4, 43, -186, 533, -1174, 2157, -3538, 6042, 29129, 440, -1412, 1278, -861, 456, -183, 48},
+  {-4, 43, -187, 533, -1171, 2143, -3496, 5912, 29158, 541, -1457, 1299, -870, 459, -183, 48},
+  {-4, 43, -187, 533, -1166, 2128, -3455, 5782, 29185, 643, -1502, 1320, -878, 462, -184, 48},
+  {-4, 44, -188, 533, -1162, 2113, -3413, 5653, 29211, 746, -1547, 1341, -887, 465, -185, 48},
+  {-4, 44, -188, 532, -1158, 2097, -3371, 5524, 29238, 849, -1592, 1361, -895, 467, -185, 49},
+  {-4, 44, -189, 532, -1154, 2082, -3328, 5396, 29263, 953, -1638, 1382, -904, 470, -186, 49},
+  {-4, 45, -189, 531, -1149, 2066, -3286, 5269, 29284, 1058, -1683, 1402, -912, 473, -186, 49},
+  {-4, 45, -190, 531, -1144, 2050, -3243, 5141, 29306, 1164, -1728, 1423, -920, 475, -187, 49},
+  {-4, 45, -190, 530, -1139, 2034, -3200, 5015, 29325, 1270, -1773, 1443, -928, 478, -187, 49},
+  {-4, 45, -191, 530, -1134, 2018, -3157, 4889, 29345, 1377, -1818, 1463, -936, 480, -188, 49},
+  {-4, 46, -191, 529, -1129, 2002, -3114, 4763, 29362, 1484, -1864, 1484, -944, 483, -188, 49},
+  {-4, 46, -191, 528, -1124, 1985, -3071, 4638, 29380, 1593, -1909, 1504, -952, 485, -189, 49},
+  {-4, 46, -191, 527, -1119, 1968, -3027, 4513, 29396, 1702, -1954, 1524, -960, 487, -189, 49},
+  {-4, 46, -192, 526, -1113, 1952, -2983, 4389, 29409, 1812, -1999, 1544, -968, 490, -190, 49},
+  {-4, 46, -192, 525, -1108, 1934, -2940, 4266, 29425, 1922, -2045, 1563, -975, 492, -190, 49},
+  {-4, 47, -192, 524, -1102, 1917, -2896, 4143, 29435, 2033, -2090, 1583, -983, 494, -190, 49},
+  {-4, 47, -192, 523, -1097, 1900, -2852, 4021, 29445, 2145, -2135, 1603, -990, 496, -191, 49},
+  {-4, 47, -192, 522, -1091, 1882, -2808, 3899, 29456, 2257, -2180, 1622, -998, 498, -191, 49},
+  {-4, 47, -192, 520, -1085, 1865, -2763, 3778, 29462, 2371, -2226, 1642, -1005, 500, -191, 49},
+  {-4, 47, -192, 519, -1079, 1847, -2719, 3657, 29471, 2484, -2271, 1661, -1012, 502, -191, 48},
+  {-4, 48, -192, 518, -1072, 1829, -2674, 3537, 29474, 2599, -2316, 1680, -1019, 504, -192, 48},
+  {-4, 48, -192, 516, -1066, 1811, -2630, 3418, 29479, 2714, -2361, 1699, -1026, 506, -192, 48},
+  {-5, 48, -192, 515, -1060, 1792, -2585, 3299, 29483, 2830, -2406, 1718, -1033, 508, -192, 48},
+  {-5, 48, -192, 513, -1053, 1774, -2540, 3181, 29484, 2946, -2451, 1737, -1040, 510, -192, 48},
+  {0, 48, -192, 511, -1046, 1755, -2495, 3063, 29480, 3063, -2495, 1755, -1046, 511, -192, 48},
+};
+
+// 音程比 <= 1.25: 24 タップ、遮断 0.320（元の標本化周波数に対する比）
+const int16_t RESAMPLE_TABLE_1[257][24] = {
+  {-3, 59, -92, -94, 445, -353, -682, 1769, -704, -3669, 9225, 20966, 9225, -3669, -704, 1769, -682, -353, 445, -94, -92, 59, -3, 0},
+  {-3, 59, -91, -96, 445, -348, -688, 1764, -681, -3685, 9154, 20969, 9298, -3654, -727, 1775, -676, -359, 446, -93, -93, 59, -3, -4},
+  {-3, 59, -90, -97, 444, -342, -694, 1758, -658, -3700, 9082, 20966, 9370, -3639, -750, 1781, -669, -365, 447, -91, -94, 60, -3, -4},
+  {-3, 59, -89, -99, 443, -336, -700, 1752, -636, -3715, 9011, 20967, 9441, -3622, -773, 1786, -663, -371, 447, -89, -95, 60, -2, -5},
+  {-4, 59, -88, -101, 442, -331, -706, 1746, -613, -3729, 8939, 20967, 9513, -3606, -796, 1792, -657, -376, 448, -88, -96, 60, -2, -5},
+  {-4, 59, -87, -102, 442, -325, -712, 1740, -590, -3743, 8867, 20962, 9585, -3589, -819, 1797, -650, -382, 449, -86, -97, 60, -2, -5},
+  {-4, 59, -86, -104, 441, -319, -718, 1734, -568, -3757, 8796, 20962, 9656, -3572, -842, 1802, -644, -388, 449, -84, -98, 60, -2, -5},
+  {-4, 59, -85, -105, 440, -313, -723, 1728, -545, -3770, 8724, 20955, 9728, -3555, -865, 1807, -637, -393, 450, -82, -99, 60, -2, -5},
+  {-4, 59, -84, -107, 439, -308, -729, 1721, -523, -3783, 8652, 20955, 9800, -3537, -888, 1812, -630, -399, 450, -81, -100, 60, -2, -5},
+  {-4, 59, -83, -108, 438, -302, -735, 1715, -500, -3796, 8580, 20949, 9872, -3519, -911, 1817, -624, -405, 451, -79, -101, 60, -1, -5},
+  {-5, 59, -82, -110, 437, -296, -740, 1708, -478, -3808, 8509, 20945, 9943, -3501, -934, 1822, -617, -410, 451, -77, -102, 60, -1, -5},
+  {-5, 59, -81, -112, 436, -291, -746, 1702, -455, -3821, 8437, 20942, 10015, -3482, -957, 1826, -610, -416, 451, -75, -103, 60, -1, -5},
+  {-5, 59, -80, -113, 435, -285, -751, 1695, -433, -3833, 8366, 20935, 10086, -3463, -980, 1831, -603, -422, 452, -73, -104, 60, -1, -5},
+  {-5, 58, -79, -114, 434, -279, -757, 1688, -411, -3844, 8294, 20932, 10158, -3444, -1004, 1835, -596, -427, 452, -72, -105, 60, -1, -5},
+  {-5, 58, -78, -116, 433, -274, -762, 1681, -389, -3855, 8222, 20927, 10229, -3425, -1027, 1840, -589, -433, 452, -70, -106, 60, 0, -5},
+  {-5, 58, -77, -117, 432, -268, -767, 1674, -367, -3866, 8151, 20918, 10301, -3405, -1050, 1844, -582, -439, 453, -68, -107, 60, 0, -5},
+  {-5, 58, -76, -119, 431, -262, -772, 1667, -345, -3877, 8079, 20912, 10372, -3385, -1073, 1848, -575, -444, 453, -66, -108, 60, 0, -5},
+  {-6, 58, -75, -120, 430, -256, -777, 1660, -322, -3888, 8008, 20903, 10444, -3364, -1097, 1852, -567, -450, 453, -64, -109, 60, 0, -5},
+  {-6, 58, -74, -122, 429, -251, -782, 1653, -301, -3898, 7936, 20897, 10515, -3343, -1120, 1856, -560, -455, 453, -62, -110, 60, 0, -5},
+  {-6, 58, -73, -123, 428, -245, -787, 1645, -279, -3908, 7865, 20887, 10586, -3322, -1143, 1860, -553, -461, 454, -60, -111, 60, 1, -5},
+  {-6, 58, -72, -124, 427, -239, -792, 1638, -257, -3917, 7794, 20878, 10658, -3301, -1167, 1864, -545, -467, 454, -58, -112, 59, 1, -6},
+  {-6, 58, -71, -126, 425, -234, -797, 1630, -235, -3926, 7722, 20873, 10729, -3279, -1190, 1867, -538, -472, 454, -57, -113, 59, 1, -6},
+  {-6, 57, -70, -127, 424, -228, -802, 1623, -213, -3935, 7651, 20862, 10800, -3257, -1213, 1871, -530, -478, 454, -55, -114, 59, 1, -6},
+  {-6, 57, -69, -128, 423, -222, -806, 1615, -192, -3944, 7580, 20853, 10871, -3235, -1237, 1874, -523, -483, 454, -53, -115, 59, 1, -6},
+  {-6, 57, -68, -130, 422, -217, -811, 1608, -170, -3952, 7509, 20840, 10942, -3212, -1260, 1878, -515, -489, 454, -51, -116, 59, 2, -6},
+  {-7, 57, -67, -131, 420, -211, -815, 1600, -149, -3960, 7438, 20830, 11013, -3189, -1284, 1881, -507, -494, 454, -49, -117, 59, 2, -6},
+  {-7, 57, -66, -132, 419, -206, -820, 1592, -127, -3968, 7367, 20819, 11084, -3166, -1307, 1884, -499, -500, 454, -47, -118, 59, 2, -6},
+  {-7, 57, -65, -134, 418, -200, -824, 1584, -106, -3976, 7296, 20807, 11155, -3142, -1330, 1887, -492, -505, 454, -45, -119, 59, 2, -6},
+  {-7, 57, -64, -135, 416, -194, -829, 1576, -84, -3983, 7225, 20795, 11226, -3118, -1354, 1890, -484, -511, 454, -43, -120, 59, 2, -6},
+  {-7, 56, -63, -136, 415, -189, -833, 1568, -63, -3990, 7154, 20783, 11296, -3094, -1377, 1892, -476, -516, 454, -41, -121, 59, 3, -6},
+  {-7, 56, -61, -137, 413, -183, -837, 1560, -42, -3996, 7083, 20770, 11367, -3070, -1401, 1895, -468, -522, 453, -39, -122, 59, 3, -6},
+  {-7, 56, -60, -138, 412, -177, -841, 1551, -21, -4003, 7013, 20755, 11437, -3045, -1424, 1898, -460, -527, 453, -37, -123, 59, 3, -6},
+  {-7, 56, -59, -140, 411, -172, -845, 1543, 0, -4009, 6942, 20740, 11508, -3019, -1447, 1900, -451, -533, 453, -35, -124, 59, 3, -6},
+  {-8, 56, -58, -141, 409, -166, -849, 1535, 21, -4015, 6872, 20725, 11578, -2994, -1471, 1902, -443, -538, 453, -32, -125, 59, 4, -6},
+  {-8, 56, -57, -142, 408, -161, -853, 1526, 42, -4020, 6801, 20712, 11649, -2968, -1494, 1904, -435, -544, 452, -30, -126, 58, 4, -6},
+  {-8, 55, -56, -143, 406, -155, -857, 1518, 63, -4025, 6731, 20697, 11719, -2942, -1518, 1906, -427, -549, 452, -28, -127, 58, 4, -6},
+  {-8, 55, -55, -144, 404, -150, -861, 1509, 83, -4030, 6660, 20684, 11789, -2916, -1541, 1908, -418, -554, 452, -26, -128, 58, 4, -7},
+  {-8, 55, -54, -145, 403, -144, -864, 1500, 104, -4035, 6590, 20666, 11859, -2889, -1564, 1910, -410, -560, 451, -24, -129, 58, 5, -7},
+  {-8, 55, -53, -146, 401, -139, -868, 1492, 124, -4039, 6520, 20649, 11929, -2862, -1588, 1912, -401, -565, 451, -22, -130, 58, 5, -7},
+  {-8, 55, -52, -147, 400, -133, -872, 1483, 145, -4044, 6450, 20631, 11999, -2834, -1611, 1913, -393, -570, 451, -20, -131, 58, 5, -7},
+  {-8, 55, -51, -149, 398, -128, -875, 1474, 165, -4047, 6380, 20615, 12068, -2807, -1634, 1915, -384, -576, 450, -18, -131, 58, 5, -7},
+  {-8, 54, -50, -150, 396, -122, -879, 1465, 186, -4051, 6310, 20599, 12138, -2779, -1658, 1916, -376, -581, 450, -15, -132, 57, 5, -7},
+  {-8, 54, -49, -151, 395, -117, -882, 1456, 206, -4054, 6240, 20578, 12207, -2750, -1681, 1918, -367, -586, 449, -13, -133, 57, 6, -7},
+  {-9, 54, -48, -152, 393, -111, -885, 1447, 226, -4057, 6171, 20560, 12277, -2722, -1704, 1919, -358, -592, 448, -11, -134, 57, 6, -7},
+  {-9, 54, -47, -153, 391, -106, -888, 1438, 246, -4060, 6101, 20541, 12346, -2693, -1727, 1920, -349, -597, 448, -9, -135, 57, 6, -7},
+  {-9, 54, -46, -154, 390, -100, -892, 1429, 266, -4062, 6032, 20520, 12415, -2663, -1751, 1921, -340, -602, 447, -7, -136, 57, 6, -7},
+  {-9, 53, -45, -155, 388, -95, -895, 1420, 286, -4065, 5962, 20503, 12484, -2634, -1774, 1921, -332, -607, 446, -4, -137, 57, 7, -7},
+  {-9, 53, -44, -156, 386, -89, -898, 1410, 305, -4067, 5893, 20483, 12553, -2604, -1797, 1922, -323, -612, 446, -2, -138, 56, 7, -7},
+  {-9, 53, -43, -157, 384, -84, -901, 1401, 325, -4068, 5824, 20462, 12622, -2574, -1820, 1922, -314, -617, 445, 0, -139, 56, 7, -7},
+  {-9, 53, -42, -157, 383, -79, -904, 1392, 345, -4070, 5755, 20438, 12691, -2543, -1843, 1923, -304, -623, 444, 2, -140, 56, 7, -7},
+  {-9, 52, -41, -158, 381, -73, -906, 1382, 364, -4071, 5686, 20415, 12759, -2512, -1866, 1923, -295, -628, 443, 5, -140, 56, 8, -7},
+  {-9, 52, -41, -159, 379, -68, -909, 1373, 384, -4072, 5617, 20393, 12828, -2481, -1889, 1923, -286, -633, 443, 7, -141, 56, 8, -7},
+  {-9, 52, -40, -160, 377, -63, -912, 1363, 403, -4072, 5549, 20373, 12896, -2450, -1912, 1923, -277, -638, 442, 9, -142, 56, 8, -8},
+  {-9, 52, -39, -161, 375, -57, -914, 1353, 422, -4073, 5480, 20352, 12964, -2418, -1935, 1923, -268, -643, 441, 11, -143, 55, 8, -8},
+  {-9, 52, -38, -162, 373, -52, -917, 1344, 441, -4073, 5412, 20326, 13032, -2386, -1958, 1923, -258, -648, 440, 14, -144, 55, 9, -8},
+  {-10, 51, -37, -163, 372, -47, -919, 1334, 460, -4073, 5343, 20305, 13100, -2353, -1981, 1922, -249, -653, 439, 16, -145, 55, 9, -8},
+  {-10, 51, -36, -164, 370, -41, -922, 1324, 479, -4072, 5275, 20279, 13168, -2320, -2004, 1922, -240, -658, 438, 18, -145, 55, 9, -8},
+  {-10, 51, -35, -164, 368, -36, -924, 1314, 498, -4071, 5207, 20254, 13235, -2287, -2027, 1921, -230, -663, 437, 21, -146, 54, 9, -8},
+  {-10, 51, -34, -165, 366, -31, -926, 1304, 517, -4070, 5139, 20228, 13303, -2254, -2050, 1921, -221, -668, 436, 23, -147, 54, 10, -8},
+  {-10, 50, -33, -166, 364, -26, -929, 1294, 535, -4069, 5071, 20206, 13370, -2220, -2073, 1920, -211, -673, 435, 25, -148, 54, 10, -8},
+  {-10, 50, -32, -167, 362, -21, -931, 1284, 554, -4068, 5004, 20177, 13437, -2186, -2095, 1919, -201, -677, 434, 28, -149, 54, 10, -8},
+  {-10, 50, -31, -167, 360, -15, -933, 1274, 572, -4066, 4936, 20152, 13504, -2152, -2118, 1918, -192, -682, 432, 30, -150, 53, 11, -8},
+  {-10, 50, -30, -168, 358, -10, -935, 1264, 590, -4064, 4869, 20124, 13571, -2117, -2140, 1916, -182, -687, 431, 32, -150, 53, 11, -8},
+  {-10, 49, -29, -169, 356, -5, -937, 1254, 609, -4062, 4802, 20096, 13638, -2082, -2163, 1915, -172, -692, 430, 35, -151, 53, 11, -8},
+  {-10, 49, -28, -170, 354, 0, -938, 1244, 627, -4059, 4735, 20067, 13704, -2047, -2185, 1914, -162, -697, 429, 37, -152, 53, 11, -8},
+  {-10, 49, -27, -170, 352, 5, -940, 1234, 645, -4057, 4668, 20041, 13770, -2012, -2208, 1912, -153, -701, 427, 40, -153, 52, 12, -8},
+  {-10, 49, -26, -171, 350, 10, -942, 1223, 663, -4054, 4601, 20013, 13837, -1976, -2230, 1910, -143, -706, 426, 42, -154, 52, 12, -8},
+  {-10, 48, -25, -172, 348, 15, -944, 1213, 680, -4051, 4534, 19987, 13903, -1940, -2253, 1908, -133, -711, 425, 44, -154, 52, 12, -8},
+  {-10, 48, -24, -172, 345, 20, -945, 1203, 698, -4047, 4468, 19955, 13969, -1903, -2275, 1906, -123, -715, 423, 47, -155, 51, 12, -8},
+  {-10, 48, -23, -173, 343, 25, -947, 1192, 716, -4043, 4401, 19927, 14034, -1866, -2297, 1904, -113, -720, 422, 49, -156, 51, 13, -9},
+  {-10, 48, -22, -173, 341, 30, -948, 1182, 733, -4039, 4335, 19895, 14100, -1829, -2319, 1902, -103, -725, 420, 52, -157, 51, 13, -9},
+  {-11, 47, -22, -174, 339, 35, -950, 1171, 750, -4035, 4269, 19869, 14165, -1792, -2341, 1899, -93, -729, 419, 54, -157, 51, 13, -9},
+  {-11, 47, -21, -175, 337, 40, -951, 1161, 768, -4031, 4203, 19838, 14230, -1754, -2363, 1897, -83, -734, 417, 56, -158, 50, 14, -9},
+  {-11, 47, -20, -175, 335, 45, -952, 1150, 785, -4026, 4138, 19803, 14295, -1716, -2385, 1894, -72, -738, 416, 59, -159, 50, 14, -9},
+  {-11, 47, -19, -176, 333, 50, -953, 1140, 802, -4021, 4072, 19772, 14360, -1678, -2407, 1891, -62, -743, 414, 61, -159, 50, 14, -9},
+  {-11, 46, -18, -176, 330, 55, -954, 1129, 819, -4016, 4007, 19741, 14424, -1639, -2429, 1888, -52, -747, 413, 64, -160, 49, 14, -9},
+  {-11, 46, -17, -177, 328, 60, -955, 1118, 835, -4011, 3941, 19710, 14489, -1600, -2451, 1885, -42, -751, 411, 66, -161, 49, 15, -9},
+  {-11, 46, -16, -177, 326, 65, -956, 1108, 852, -4005, 3876, 19674, 14553, -1561, -2472, 1882, -31, -756, 409, 69, -162, 49, 15, -9},
+  {-11, 46, -15, -178, 324, 70, -957, 1097, 869, -3999, 3812, 19640, 14617, -1521, -2494, 1879, -21, -760, 407, 71, -162, 48, 15, -9},
+  {-11, 45, -14, -178, 321, 74, -958, 1086, 885, -3993, 3747, 19607, 14681, -1481, -2516, 1875, -10, -764, 406, 74, -163, 48, 16, -9},
+  {-11, 45, -14, -179, 319, 79, -959, 1075, 902, -3987, 3682, 19576, 14744, -1441, -2537, 1872, 0, -769, 404, 76, -164, 48, 16, -9},
+  {-11, 45, -13, -179, 317, 84, -960, 1064, 918, -3980, 3618, 19540, 14808, -1401, -2558, 1868, 10, -773, 402, 79, -164, 47, 16, -9},
+  {-11, 44, -12, -180, 315, 89, -960, 1054, 934, -3974, 3554, 19506, 14871, -1360, -2580, 1864, 21, -777, 400, 81, -165, 47, 16, -9},
+  {-11, 44, -11, -180, 312, 93, -961, 1043, 950, -3967, 3490, 19471, 14934, -1319, -2601, 1860, 32, -781, 398, 84, -166, 46, 17, -9},
+  {-11, 44, -10, -180, 310, 98, -961, 1032, 966, -3960, 3426, 19435, 14996, -1278, -2622, 1856, 42, -785, 396, 86, -166, 46, 17, -9},
+  {-11, 44, -9, -181, 308, 103, -962, 1021, 981, -3952, 3363, 19397, 15059, -1236, -2643, 1852, 53, -789, 394, 89, -167, 46, 17, -9},
+  {-11, 43, -8, -181, 305, 107, -962, 1010, 997, -3944, 3299, 19363, 15121, -1194, -2664, 1847, 63, -793, 392, 91, -167, 45, 18, -9},
+  {-11, 43, -7, -182, 303, 112, -963, 999, 1013, -3937, 3236, 19327, 15183, -1152, -2685, 1843, 74, -797, 390, 94, -168, 45, 18, -10},
+  {-11, 43, -7, -182, 301, 117, -963, 988, 1028, -3928, 3173, 19288, 15245, -1109, -2705, 1838, 85, -801, 388, 97, -169, 44, 18, -10},
+  {-11, 42, -6, -182, 298, 121, -963, 977, 1043, -3920, 3110, 19252, 15307, -1066, -2726, 1833, 96, -805, 386, 99, -169, 44, 18, -10},
+  {-11, 42, -5, -183, 296, 126, -963, 965, 1058, -3912, 3047, 19216, 15368, -1023, -2747, 1828, 106, -809, 384, 102, -170, 44, 19, -10},
+  {-11, 42, -4, -183, 294, 130, -963, 954, 1073, -3903, 2985, 19176, 15430, -980, -2767, 1823, 117, -813, 382, 104, -170, 43, 19, -10},
+  {-11, 42, -3, -183, 291, 135, -963, 943, 1088, -3894, 2923, 19136, 15491, -936, -2788, 1818, 128, -817, 380, 107, -171, 43, 19, -10},
+  {-11, 41, -2, -183, 289, 139, -963, 932, 1103, -3885, 2861, 19098, 15551, -892, -2808, 1813, 139, -820, 377, 109, -172, 42, 20, -10},
+  {-11, 41, -2, -184, 286, 144, -963, 921, 1118, -3875, 2799, 19057, 15612, -847, -2828, 1807, 150, -824, 375, 112, -172, 42, 20, -10},
+  {-11, 41, -1, -184, 284, 148, -963, 910, 1132, -3866, 2737, 19020, 15672, -803, -2848, 1802, 161, -828, 373, 114, -173, 41, 20, -10},
+  {-11, 40, 0, -184, 281, 152, -963, 898, 1147, -3856, 2676, 18980, 15732, -758, -2868, 1796, 172, -832, 370, 117, -173, 41, 21, -10},
+  {-11, 40, 1, -184, 279, 157, -963, 887, 1161, -3846, 2615, 18938, 15792, -713, -2888, 1790, 183, -835, 368, 120, -174, 40, 21, -10},
+  {-11, 40, 2, -185, 277, 161, -962, 876, 1175, -3836, 2554, 18896, 15852, -667, -2908, 1784, 194, -839, 366, 122, -174, 40, 21, -10},
+  {-11, 39, 2, -185, 274, 165, -962, 865, 1189, -3826, 2493, 18857, 15911, -621, -2927, 1778, 205, -842, 363, 125, -175, 40, 21, -10},
+  {-11, 39, 3, -185, 272, 170, -961, 853, 1203, -3815, 2432, 18814, 15970, -575, -2947, 1772, 216, -846, 361, 127, -175, 39, 22, -10},
+  {-11, 39, 4, -185, 269, 174, -961, 842, 1217, -3804, 2372, 18772, 16029, -529, -2966, 1765, 227, -849, 358, 130, -176, 39, 22, -10},
+  {-11, 39, 5, -185, 267, 178, -960, 831, 1231, -3793, 2312, 18728, 16087, -482, -2986, 1759, 238, -852, 355, 133, -176, 38, 22, -10},
+  {-11, 38, 6, -186, 264, 182, -959, 819, 1244, -3782, 2252, 18688, 16146, -435, -3005, 1752, 249, -856, 353, 135, -177, 38, 23, -10},
+  {-11, 38, 6, -186, 262, 186, -959, 808, 1257, -3771, 2192, 18647, 16204, -388, -3024, 1745, 260, -859, 350, 138, -177, 37, 23, -10},
+  {-11, 38, 7, -186, 259, 190, -958, 796, 1271, -3759, 2132, 18604, 16261, -340, -3043, 1738, 271, -862, 348, 140, -178, 37, 23, -10},
+  {-11, 37, 8, -186, 257, 195, -957, 785, 1284, -3747, 2073, 18558, 16319, -293, -3062, 1731, 283, -866, 345, 143, -178, 36, 24, -10},
+  {-11, 37, 9, -186, 254, 199, -956, 774, 1297, -3735, 2014, 18512, 16376, -245, -3080, 1724, 294, -869, 342, 146, -178, 36, 24, -10},
+  {-11, 37, 9, -186, 252, 203, -955, 762, 1310, -3723, 1955, 18471, 16433, -196, -3099, 1716, 305, -872, 339, 148, -179, 35, 24, -10},
+  {-11, 36, 10, -186, 249, 207, -954, 751, 1323, -3711, 1897, 18425, 16490, -148, -3117, 1709, 316, -875, 337, 151, -179, 34, 25, -11},
+  {-11, 36, 11, -186, 247, 211, -953, 739, 1335, -3698, 1838, 18383, 16546, -99, -3136, 1701, 327, -878, 334, 153, -180, 34, 25, -11},
+  {-11, 36, 12, -186, 244, 215, -952, 728, 1348, -3686, 1780, 18335, 16603, -49, -3154, 1693, 339, -881, 331, 156, -180, 33, 25, -11},
+  {-11, 36, 12, -186, 242, 219, -951, 716, 1360, -3673, 1722, 18291, 16658, 0, -3172, 1685, 350, -884, 328, 159, -180, 33, 25, -11},
+  {-11, 35, 13, -186, 239, 223, -950, 705, 1372, -3660, 1665, 18246, 16714, 50, -3190, 1677, 361, -887, 325, 161, -181, 32, 26, -11},
+  {-11, 35, 14, -186, 237, 226, -948, 693, 1384, -3646, 1607, 18198, 16769, 100, -3208, 1669, 373, -890, 322, 164, -181, 32, 26, -11},
+  {-11, 35, 14, -186, 234, 230, -947, 682, 1396, -3633, 1550, 18151, 16825, 150, -3226, 1661, 384, -892, 319, 167, -181, 31, 26, -11},
+  {-11, 34, 15, -186, 231, 234, -946, 670, 1408, -3619, 1493, 18106, 16879, 201, -3243, 1652, 395, -895, 316, 169, -182, 31, 27, -11},
+  {-11, 34, 16, -186, 229, 238, -944, 659, 1420, -3605, 1436, 18056, 16934, 251, -3261, 1644, 407, -898, 313, 172, -182, 30, 27, -11},
+  {-11, 34, 17, -186, 226, 242, -942, 648, 1432, -3591, 1380, 18006, 16988, 303, -3278, 1635, 418, -900, 310, 174, -182, 29, 27, -11},
+  {-11, 33, 17, -186, 224, 245, -941, 636, 1443, -3577, 1323, 17961, 17042, 354, -3295, 1626, 430, -903, 307, 177, -183, 29, 28, -11},
+  {-11, 33, 18, -186, 221, 249, -939, 625, 1454, -3563, 1267, 17912, 17096, 406, -3312, 1617, 441, -906, 304, 180, -183, 28, 28, -11},
+  {-11, 33, 19, -186, 219, 253, -938, 613, 1465, -3548, 1212, 17862, 17149, 458, -3329, 1608, 452, -908, 301, 182, -183, 28, 28, -11},
+  {-11, 32, 19, -186, 216, 256, -936, 602, 1477, -3534, 1156, 17814, 17202, 510, -3345, 1599, 464, -911, 297, 185, -183, 27, 29, -11},
+  {-11, 32, 20, -186, 213, 260, -934, 590, 1487, -3519, 1101, 17768, 17255, 562, -3362, 1589, 475, -913, 294, 187, -184, 26, 29, -11},
+  {-11, 32, 21, -185, 211, 263, -932, 579, 1498, -3504, 1046, 17713, 17307, 615, -3378, 1580, 487, -915, 291, 190, -184, 26, 29, -11},
+  {-11, 31, 21, -185, 208, 267, -930, 567, 1509, -3489, 991, 17666, 17359, 668, -3395, 1570, 498, -918, 288, 193, -184, 25, 30, -11},
+  {-11, 31, 22, -185, 206, 270, -928, 556, 1519, -3474, 937, 17615, 17411, 721, -3411, 1560, 510, -920, 284, 195, -184, 25, 30, -11},
+  {-11, 31, 23, -185, 203, 274, -926, 544, 1530, -3458, 882, 17564, 17463, 775, -3427, 1550, 521, -922, 281, 198, -185, 24, 30, -11},
+  {-11, 31, 23, -185, 200, 277, -924, 533, 1540, -3442, 828, 17514, 17514, 828, -3442, 1540, 533, -924, 277, 200, -185, 23, 31, -11},
+  {-11, 30, 24, -185, 198, 281, -922, 521, 1550, -3427, 775, 17463, 17564, 882, -3458, 1530, 544, -926, 274, 203, -185, 23, 31, -11},
+  {-11, 30, 25, -184, 195, 284, -920, 510, 1560, -3411, 721, 17411, 17615, 937, -3474, 1519, 556, -928, 270, 206, -185, 22, 31, -11},
+  {-11, 30, 25, -184, 193, 288, -918, 498, 1570, -3395, 668, 17359, 17666, 991, -3489, 1509, 567, -930, 267, 208, -185, 21, 31, -11},
+  {-11, 29, 26, -184, 190, 291, -915, 487, 1580, -3378, 615, 17307, 17713, 1046, -3504, 1498, 579, -932, 263, 211, -185, 21, 32, -11},
+  {-11, 29, 26, -184, 187, 294, -913, 475, 1589, -3362, 562, 17255, 17768, 1101, -3519, 1487, 590, -934, 260, 213, -186, 20, 32, -11},
+  {-11, 29, 27, -183, 185, 297, -911, 464, 1599, -3345, 510, 17202, 17814, 1156, -3534, 1477, 602, -936, 256, 216, -186, 19, 32, -11},
+  {-11, 28, 28, -183, 182, 301, -908, 452, 1608, -3329, 458, 17149, 17862, 1212, -3548, 1465, 613, -938, 253, 219, -186, 19, 33, -11},
+  {-11, 28, 28, -183, 180, 304, -906, 441, 1617, -3312, 406, 17096, 17912, 1267, -3563, 1454, 625, -939, 249, 221, -186, 18, 33, -11},
+  {-11, 28, 29, -183, 177, 307, -903, 430, 1626, -3295, 354, 17042, 17961, 1323, -3577, 1443, 636, -941, 245, 224, -186, 17, 33, -11},
+  {-11, 27, 29, -182, 174, 310, -900, 418, 1635, -3278, 303, 16988, 18006, 1380, -3591, 1432, 648, -942, 242, 226, -186, 17, 34, -11},
+  {-11, 27, 30, -182, 172, 313, -898, 407, 1644, -3261, 251, 16934, 18056, 1436, -3605, 1420, 659, -944, 238, 229, -186, 16, 34, -11},
+  {-11, 27, 31, -182, 169, 316, -895, 395, 1652, -3243, 201, 16879, 18106, 1493, -3619, 1408, 670, -946, 234, 231, -186, 15, 34, -11},
+  {-11, 26, 31, -181, 167, 319, -892, 384, 1661, -3226, 150, 16825, 18151, 1550, -3633, 1396, 682, -947, 230, 234, -186, 14, 35, -11},
+  {-11, 26, 32, -181, 164, 322, -890, 373, 1669, -3208, 100, 16769, 18198, 1607, -3646, 1384, 693, -948, 226, 237, -186, 14, 35, -11},
+  {-11, 26, 32, -181, 161, 325, -887, 361, 1677, -3190, 50, 16714, 18246, 1665, -3660, 1372, 705, -950, 223, 239, -186, 13, 35, -11},
+  {-11, 25, 33, -180, 159, 328, -884, 350, 1685, -3172, 0, 16658, 18291, 1722, -3673, 1360, 716, -951, 219, 242, -186, 12, 36, -11},
+  {-11, 25, 33, -180, 156, 331, -881, 339, 1693, -3154, -49, 16603, 18335, 1780, -3686, 1348, 728, -952, 215, 244, -186, 12, 36, -11},
+  {-11, 25, 34, -180, 153, 334, -878, 327, 1701, -3136, -99, 16546, 18383, 1838, -3698, 1335, 739, -953, 211, 247, -186, 11, 36, -11},
+  {-11, 25, 34, -179, 151, 337, -875, 316, 1709, -3117, -148, 16490, 18425, 1897, -3711, 1323, 751, -954, 207, 249, -186, 10, 36, -11},
+  {-10, 24, 35, -179, 148, 339, -872, 305, 1716, -3099, -196, 16433, 18471, 1955, -3723, 1310, 762, -955, 203, 252, -186, 9, 37, -11},
+  {-10, 24, 36, -178, 146, 342, -869, 294, 1724, -3080, -245, 16376, 18512, 2014, -3735, 1297, 774, -956, 199, 254, -186, 9, 37, -11},
+  {-10, 24, 36, -178, 143, 345, -866, 283, 1731, -3062, -293, 16319, 18558, 2073, -3747, 1284, 785, -957, 195, 257, -186, 8, 37, -11},
+  {-10, 23, 37, -178, 140, 348, -862, 271, 1738, -3043, -340, 16261, 18604, 2132, -3759, 1271, 796, -958, 190, 259, -186, 7, 38, -11},
+  {-10, 23, 37, -177, 138, 350, -859, 260, 1745, -3024, -388, 16204, 18647, 2192, -3771, 1257, 808, -959, 186, 262, -186, 6, 38, -11},
+  {-10, 23, 38, -177, 135, 353, -856, 249, 1752, -3005, -435, 16146, 18688, 2252, -3782, 1244, 819, -959, 182, 264, -186, 6, 38, -11},
+  {-10, 22, 38, -176, 133, 355, -852, 238, 1759, -2986, -482, 16087, 18728, 2312, -3793, 1231, 831, -960, 178, 267, -185, 5, 39, -11},
+  {-10, 22, 39, -176, 130, 358, -849, 227, 1765, -2966, -529, 16029, 18772, 2372, -3804, 1217, 842, -961, 174, 269, -185, 4, 39, -11},
+  {-10, 22, 39, -175, 127, 361, -846, 216, 1772, -2947, -575, 15970, 18814, 2432, -3815, 1203, 853, -961, 170, 272, -185, 3, 39, -11},
+  {-10, 21, 40, -175, 125, 363, -842, 205, 1778, -2927, -621, 15911, 18857, 2493, -3826, 1189, 865, -962, 165, 274, -185, 2, 39, -11},
+  {-10, 21, 40, -174, 122, 366, -839, 194, 1784, -2908, -667, 15852, 18896, 2554, -3836, 1175, 876, -962, 161, 277, -185, 2, 40, -11},
+  {-10, 21, 40, -174, 120, 368, -835, 183, 1790, -2888, -713, 15792, 18938, 2615, -3846, 1161, 887, -963, 157, 279, -184, 1, 40, -11},
+  {-10, 21, 41, -173, 117, 370, -832, 172, 1796, -2868, -758, 15732, 18980, 2676, -3856, 1147, 898, -963, 152, 281, -184, 0, 40, -11},
+  {-10, 20, 41, -173, 114, 373, -828, 161, 1802, -2848, -803, 15672, 19020, 2737, -3866, 1132, 910, -963, 148, 284, -184, -1, 41, -11},
+  {-10, 20, 42, -172, 112, 375, -824, 150, 1807, -2828, -847, 15612, 19057, 2799, -3875, 1118, 921, -963, 144, 286, -184, -2, 41, -11},
+  {-10, 20, 42, -172, 109, 377, -820, 139, 1813, -2808, -892, 15551, 19098, 2861, -3885, 1103, 932, -963, 139, 289, -183, -2, 41, -11},
+  {-10, 19, 43, -171, 107, 380, -817, 128, 1818, -2788, -936, 15491, 19136, 2923, -3894, 1088, 943, -963, 135, 291, -183, -3, 42, -11},
+  {-10, 19, 43, -170, 104, 382, -813, 117, 1823, -2767, -980, 15430, 19176, 2985, -3903, 1073, 954, -963, 130, 294, -183, -4, 42, -11},
+  {-10, 19, 44, -170, 102, 384, -809, 106, 1828, -2747, -1023, 15368, 19216, 3047, -3912, 1058, 965, -963, 126, 296, -183, -5, 42, -11},
+  {-10, 18, 44, -169, 99, 386, -805, 96, 1833, -2726, -1066, 15307, 19252, 3110, -3920, 1043, 977, -963, 121, 298, -182, -6, 42, -11},
+  {-10, 18, 44, -169, 97, 388, -801, 85, 1838, -2705, -1109, 15245, 19288, 3173, -3928, 1028, 988, -963, 117, 301, -182, -7, 43, -11},
+  {-10, 18, 45, -168, 94, 390, -797, 74, 1843, -2685, -1152, 15183, 19327, 3236, -3937, 1013, 999, -963, 112, 303, -182, -7, 43, -11},
+  {-9, 18, 45, -167, 91, 392, -793, 63, 1847, -2664, -1194, 15121, 19363, 3299, -3944, 997, 1010, -962, 107, 305, -181, -8, 43, -11},
+  {-9, 17, 46, -167, 89, 394, -789, 53, 1852, -2643, -1236, 15059, 19397, 3363, -3952, 981, 1021, -962, 103, 308, -181, -9, 44, -11},
+  {-9, 17, 46, -166, 86, 396, -785, 42, 1856, -2622, -1278, 14996, 19435, 3426, -3960, 966, 1032, -961, 98, 310, -180, -10, 44, -11},
+  {-9, 17, 46, -166, 84, 398, -781, 32, 1860, -2601, -1319, 14934, 19471, 3490, -3967, 950, 1043, -961, 93, 312, -180, -11, 44, -11},
+  {-9, 16, 47, -165, 81, 400, -777, 21, 1864, -2580, -1360, 14871, 19506, 3554, -3974, 934, 1054, -960, 89, 315, -180, -12, 44, -11},
+  {-9, 16, 47, -164, 79, 402, -773, 10, 1868, -2558, -1401, 14808, 19540, 3618, -3980, 918, 1064, -960, 84, 317, -179, -13, 45, -11},
+  {-9, 16, 48, -164, 76, 404, -769, 0, 1872, -2537, -1441, 14744, 19576, 3682, -3987, 902, 1075, -959, 79, 319, -179, -14, 45, -11},
+  {-9, 16, 48, -163, 74, 406, -764, -10, 1875, -2516, -1481, 14681, 19607, 3747, -3993, 885, 1086, -958, 74, 321, -178, -14, 45, -11},
+  {-9, 15, 48, -162, 71, 407, -760, -21, 1879, -2494, -1521, 14617, 19640, 3812, -3999, 869, 1097, -957, 70, 324, -178, -15, 46, -11},
+  {-9, 15, 49, -162, 69, 409, -756, -31, 1882, -2472, -1561, 14553, 19674, 3876, -4005, 852, 1108, -956, 65, 326, -177, -16, 46, -11},
+  {-9, 15, 49, -161, 66, 411, -751, -42, 1885, -2451, -1600, 14489, 19710, 3941, -4011, 835, 1118, -955, 60, 328, -177, -17, 46, -11},
+  {-9, 14, 49, -160, 64, 413, -747, -52, 1888, -2429, -1639, 14424, 19741, 4007, -4016, 819, 1129, -954, 55, 330, -176, -18, 46, -11},
+  {-9, 14, 50, -159, 61, 414, -743, -62, 1891, -2407, -1678, 14360, 19772, 4072, -4021, 802, 1140, -953, 50, 333, -176, -19, 47, -11},
+  {-9, 14, 50, -159, 59, 416, -738, -72, 1894, -2385, -1716, 14295, 19803, 4138, -4026, 785, 1150, -952, 45, 335, -175, -20, 47, -11},
+  {-9, 14, 50, -158, 56, 417, -734, -83, 1897, -2363, -1754, 14230, 19838, 4203, -4031, 768, 1161, -951, 40, 337, -175, -21, 47, -11},
+  {-9, 13, 51, -157, 54, 419, -729, -93, 1899, -2341, -1792, 14165, 19869, 4269, -4035, 750, 1171, -950, 35, 339, -174, -22, 47, -11},
+  {-9, 13, 51, -157, 52, 420, -725, -103, 1902, -2319, -1829, 14100, 19895, 4335, -4039, 733, 1182, -948, 30, 341, -173, -22, 48, -10},
+  {-9, 13, 51, -156, 49, 422, -720, -113, 1904, -2297, -1866, 14034, 19927, 4401, -4043, 716, 1192, -947, 25, 343, -173, -23, 48, -10},
+  {-8, 12, 51, -155, 47, 423, -715, -123, 1906, -2275, -1903, 13969, 19955, 4468, -4047, 698, 1203, -945, 20, 345, -172, -24, 48, -10},
+  {-8, 12, 52, -154, 44, 425, -711, -133, 1908, -2253, -1940, 13903, 19987, 4534, -4051, 680, 1213, -944, 15, 348, -172, -25, 48, -10},
+  {-8, 12, 52, -154, 42, 426, -706, -143, 1910, -2230, -1976, 13837, 20013, 4601, -4054, 663, 1223, -942, 10, 350, -171, -26, 49, -10},
+  {-8, 12, 52, -153, 40, 427, -701, -153, 1912, -2208, -2012, 13770, 20041, 4668, -4057, 645, 1234, -940, 5, 352, -170, -27, 49, -10},
+  {-8, 11, 53, -152, 37, 429, -697, -162, 1914, -2185, -2047, 13704, 20067, 4735, -4059, 627, 1244, -938, 0, 354, -170, -28, 49, -10},
+  {-8, 11, 53, -151, 35, 430, -692, -172, 1915, -2163, -2082, 13638, 20096, 4802, -4062, 609, 1254, -937, -5, 356, -169, -29, 49, -10},
+  {-8, 11, 53, -150, 32, 431, -687, -182, 1916, -2140, -2117, 13571, 20124, 4869, -4064, 590, 1264, -935, -10, 358, -168, -30, 50, -10},
+  {-8, 11, 53, -150, 30, 432, -682, -192, 1918, -2118, -2152, 13504, 20152, 4936, -4066, 572, 1274, -933, -15, 360, -167, -31, 50, -10},
+  {-8, 10, 54, -149, 28, 434, -677, -201, 1919, -2095, -2186, 13437, 20177, 5004, -4068, 554, 1284, -931, -21, 362, -167, -32, 50, -10},
+  {-8, 10, 54, -148, 25, 435, -673, -211, 1920, -2073, -2220, 13370, 20206, 5071, -4069, 535, 1294, -929, -26, 364, -166, -33, 50, -10},
+  {-8, 10, 54, -147, 23, 436, -668, -221, 1921, -2050, -2254, 13303, 20228, 5139, -4070, 517, 1304, -926, -31, 366, -165, -34, 51, -10},
+  {-8, 9, 54, -146, 21, 437, -663, -230, 1921, -2027, -2287, 13235, 20254, 5207, -4071, 498, 1314, -924, -36, 368, -164, -35, 51, -10},
+  {-8, 9, 55, -145, 18, 438, -658, -240, 1922, -2004, -2320, 13168, 20279, 5275, -4072, 479, 1324, -922, -41, 370, -164, -36, 51, -10},
+  {-8, 9, 55, -145, 16, 439, -653, -249, 1922, -1981, -2353, 13100, 20305, 5343, -4073, 460, 1334, -919, -47, 372, -163, -37, 51, -10},
+  {-8, 9, 55, -144, 14, 440, -648, -258, 1923, -1958, -2386, 13032, 20326, 5412, -4073, 441, 1344, -917, -52, 373, -162, -38, 52, -9},
+  {-8, 8, 55, -143, 11, 441, -643, -268, 1923, -1935, -2418, 12964, 20352, 5480, -4073, 422, 1353, -914, -57, 375, -161, -39, 52, -9},
+  {-8, 8, 56, -142, 9, 442, -638, -277, 1923, -1912, -2450, 12896, 20373, 5549, -4072, 403, 1363, -912, -63, 377, -160, -40, 52, -9},
+  {-7, 8, 56, -141, 7, 443, -633, -286, 1923, -1889, -2481, 12828, 20393, 5617, -4072, 384, 1373, -909, -68, 379, -159, -41, 52, -9},
+  {-7, 8, 56, -140, 5, 443, -628, -295, 1923, -1866, -2512, 12759, 20415, 5686, -4071, 364, 1382, -906, -73, 381, -158, -41, 52, -9},
+  {-7, 7, 56, -140, 2, 444, -623, -304, 1923, -1843, -2543, 12691, 20438, 5755, -4070, 345, 1392, -904, -79, 383, -157, -42, 53, -9},
+  {-7, 7, 56, -139, 0, 445, -617, -314, 1922, -1820, -2574, 12622, 20462, 5824, -4068, 325, 1401, -901, -84, 384, -157, -43, 53, -9},
+  {-7, 7, 56, -138, -2, 446, -612, -323, 1922, -1797, -2604, 12553, 20483, 5893, -4067, 305, 1410, -898, -89, 386, -156, -44, 53, -9},
+  {-7, 7, 57, -137, -4, 446, -607, -332, 1921, -1774, -2634, 12484, 20503, 5962, -4065, 286, 1420, -895, -95, 388, -155, -45, 53, -9},
+  {-7, 6, 57, -136, -7, 447, -602, -340, 1921, -1751, -2663, 12415, 20520, 6032, -4062, 266, 1429, -892, -100, 390, -154, -46, 54, -9},
+  {-7, 6, 57, -135, -9, 448, -597, -349, 1920, -1727, -2693, 12346, 20541, 6101, -4060, 246, 1438, -888, -106, 391, -153, -47, 54, -9},
+  {-7, 6, 57, -134, -11, 448, -592, -358, 1919, -1704, -2722, 12277, 20560, 6171, -4057, 226, 1447, -885, -111, 393, -152, -48, 54, -9},
+  {-7, 6, 57, -133, -13, 449, -586, -367, 1918, -1681, -2750, 12207, 20578, 6240, -4054, 206, 1456, -882, -117, 395, -151, -49, 54, -8},
+  {-7, 5, 57, -132, -15, 450, -581, -376, 1916, -1658, -2779, 12138, 20599, 6310, -4051, 186, 1465, -879, -122, 396, -150, -50, 54, -8},
+  {-7, 5, 58, -131, -18, 450, -576, -384, 1915, -1634, -2807, 12068, 20615, 6380, -4047, 165, 1474, -875, -128, 398, -149, -51, 55, -8},
+  {-7, 5, 58, -131, -20, 451, -570, -393, 1913, -1611, -2834, 11999, 20631, 6450, -4044, 145, 1483, -872, -133, 400, -147, -52, 55, -8},
+  {-7, 5, 58, -130, -22, 451, -565, -401, 1912, -1588, -2862, 11929, 20649, 6520, -4039, 124, 1492, -868, -139, 401, -146, -53, 55, -8},
+  {-7, 5, 58, -129, -24, 451, -560, -410, 1910, -1564, -2889, 11859, 20666, 6590, -4035, 104, 1500, -864, -144, 403, -145, -54, 55, -8},
+  {-7, 4, 58, -128, -26, 452, -554, -418, 1908, -1541, -2916, 11789, 20684, 6660, -4030, 83, 1509, -861, -150, 404, -144, -55, 55, -8},
+  {-6, 4, 58, -127, -28, 452, -549, -427, 1906, -1518, -2942, 11719, 20697, 6731, -4025, 63, 1518, -857, -155, 406, -143, -56, 55, -8},
+  {-6, 4, 58, -126, -30, 452, -544, -435, 1904, -1494, -2968, 11649, 20712, 6801, -4020, 42, 1526, -853, -161, 408, -142, -57, 56, -8},
+  {-6, 4, 59, -125, -32, 453, -538, -443, 1902, -1471, -2994, 11578, 20725, 6872, -4015, 21, 1535, -849, -166, 409, -141, -58, 56, -8},
+  {-6, 3, 59, -124, -35, 453, -533, -451, 1900, -1447, -3019, 11508, 20740, 6942, -4009, 0, 1543, -845, -172, 411, -140, -59, 56, -7},
+  {-6, 3, 59, -123, -37, 453, -527, -460, 1898, -1424, -3045, 11437, 20755, 7013, -4003, -21, 1551, -841, -177, 412, -138, -60, 56, -7},
+  {-6, 3, 59, -122, -39, 453, -522, -468, 1895, -1401, -3070, 11367, 20770, 7083, -3996, -42, 1560, -837, -183, 413, -137, -61, 56, -7},
+  {-6, 3, 59, -121, -41, 454, -516, -476, 1892, -1377, -3094, 11296, 20783, 7154, -3990, -63, 1568, -833, -189, 415, -136, -63, 56, -7},
+  {-6, 2, 59, -120, -43, 454, -511, -484, 1890, -1354, -3118, 11226, 20795, 7225, -3983, -84, 1576, -829, -194, 416, -135, -64, 57, -7},
+  {-6, 2, 59, -119, -45, 454, -505, -492, 1887, -1330, -3142, 11155, 20807, 7296, -3976, -106, 1584, -824, -200, 418, -134, -65, 57, -7},
+  {-6, 2, 59, -118, -47, 454, -500, -499, 1884, -1307, -3166, 11084, 20819, 7367, -3968, -127, 1592, -820, -206, 419, -132, -66, 57, -7},
+  {-6, 2, 59, -117, -49, 454, -494, -507, 1881, -1284, -3189, 11013, 20830, 7438, -3960, -149, 1600, -815, -211, 420, -131, -67, 57, -7},
+  {-6, 2, 59, -116, -51, 454, -489, -515, 1878, -1260, -3212, 10942, 20840, 7509, -3952, -170, 1608, -811, -217, 422, -130, -68, 57, -6},
+  {-6, 1, 59, -115, -53, 454, -483, -523, 1874, -1237, -3235, 10871, 20853, 7580, -3944, -192, 1615, -806, -222, 423, -128, -69, 57, -6},
+  {-6, 1, 59, -114, -55, 454, -478, -530, 1871, -1213, -3257, 10800, 20862, 7651, -3935, -213, 1623, -802, -228, 424, -127, -70, 57, -6},
+  {-6, 1, 59, -113, -57, 454, -472, -538, 1867, -1190, -3279, 10729, 20873, 7722, -3926, -235, 1630, -797, -234, 425, -126, -71, 58, -6},
+  {-6, 1, 59, -112, -58, 454, -467, -545, 1864, -1167, -3301, 10658, 20878, 7794, -3917, -257, 1638, -792, -239, 427, -124, -72, 58, -6},
+  {-5, 1, 60, -111, -60, 454, -461, -553, 1860, -1143, -3322, 10586, 20887, 7865, -3908, -279, 1645, -787, -245, 428, -123, -73, 58, -6},
+  {-5, 0, 60, -110, -62, 453, -455, -560, 1856, -1120, -3343, 10515, 20897, 7936, -3898, -301, 1653, -782, -251, 429, -122, -74, 58, -6},
+  {-5, 0, 60, -109, -64, 453, -450, -567, 1852, -1097, -3364, 10444, 20903, 8008, -3888, -322, 1660, -777, -256, 430, -120, -75, 58, -6},
+  {-5, 0, 60, -108, -66, 453, -444, -575, 1848, -1073, -3385, 10372, 20912, 8079, -3877, -345, 1667, -772, -262, 431, -119, -76, 58, -5},
+  {-5, 0, 60, -107, -68, 453, -439, -582, 1844, -1050, -3405, 10301, 20918, 8151, -3866, -367, 1674, -767, -268, 432, -117, -77, 58, -5},
+  {-5, 0, 60, -106, -70, 452, -433, -589, 1840, -1027, -3425, 10229, 20927, 8222, -3855, -389, 1681, -762, -274, 433, -116, -78, 58, -5},
+  {-5, -1, 60, -105, -72, 452, -427, -596, 1835, -1004, -3444, 10158, 20932, 8294, -3844, -411, 1688, -757, -279, 434, -114, -79, 58, -5},
+  {-5, -1, 60, -104, -73, 452, -422, -603, 1831, -980, -3463, 10086, 20935, 8366, -3833, -433, 1695, -751, -285, 435, -113, -80, 59, -5},
+  {-5, -1, 60, -103, -75, 451, -416, -610, 1826, -957, -3482, 10015, 20942, 8437, -3821, -455, 1702, -746, -291, 436, -112, -81, 59, -5},
+  {-5, -1, 60, -102, -77, 451, -410, -617, 1822, -934, -3501, 9943, 20945, 8509, -3808, -478, 1708, -740, -296, 437, -110, -82, 59, -5},
+  {-5, -1, 60, -101, -79, 451, -405, -624, 1817, -911, -3519, 9872, 20949, 8580, -3796, -500, 1715, -735, -302, 438, -108, -83, 59, -4},
+  {-5, -2, 60, -100, -81, 450, -399, -630, 1812, -888, -3537, 9800, 20955, 8652, -3783, -523, 1721, -729, -308, 439, -107, -84, 59, -4},
+  {-5, -2, 60, -99, -82, 450, -393, -637, 1807, -865, -3555, 9728, 20955, 8724, -3770, -545, 1728, -723, -313, 440, -105, -85, 59, -4},
+  {-5, -2, 60, -98, -84, 449, -388, -644, 1802, -842, -3572, 9656, 20962, 8796, -3757, -568, 1734, -718, -319, 441, -104, -86, 59, -4},
+  {-5, -2, 60, -97, -86, 449, -382, -650, 1797, -819, -3589, 9585, 20962, 8867, -3743, -590, 1740, -712, -325, 442, -102, -87, 59, -4},
+  {-5, -2, 60, -96, -88, 448, -376, -657, 1792, -796, -3606, 9513, 20967, 8939, -3729, -613, 1746, -706, -331, 442, -101, -88, 59, -4},
+  {-5, -2, 60, -95, -89, 447, -371, -663, 1786, -773, -3622, 9441, 20967, 9011, -3715, -636, 1752, -700, -336, 443, -99, -89, 59, -3},
+  {-4, -3, 60, -94, -91, 447, -365, -669, 1781, -750, -3639, 9370, 20966, 9082, -3700, -658, 1758, -694, -342, 444, -97, -90, 59, -3},
+  {-4, -3, 59, -93, -93, 446, -359, -676, 1775, -727, -3654, 9298, 20969, 9154, -3685, -681, 1764, -688, -348, 445, -96, -91, 59, -3},
+  {0, -3, 59, -92, -94, 445, -353, -682, 1769, -704, -3669, 9225, 20966, 9225, -3669, -704, 1769, -682, -353, 445, -94, -92, 59, -3},
+};
+
+// 音程比 <= 1.50: 24 タップ、遮断 0.267（元の標本化周波数に対する比）
+const int16_t RESAMPLE_TABLE_2[257][24] = {
+  {-9, -54, 79, 190, -332, -431, 1005, 733, -2694, -991, 10146, 17484, 10146, -991, -2694, 733, 1005, -431, -332, 190, 79, -54, -9, 0},
+  {-9, -54, 78, 191, -329, -434, 999, 743, -2682, -1019, 10096, 17478, 10193, -962, -2704, 724, 1010, -428, -334, 190, 80, -54, -10, 5},
+  {-9, -54, 77, 192, -327, -437, 994, 752, -2672, -1047, 10048, 17479, 10241, -934, -2714, 714, 1016, -425, -337, 189, 81, -54, -10, 5},
+  {-9, -54, 76, 192, -324, -441, 988, 761, -2661, -1075, 9999, 17483, 10289, -905, -2725, 704, 1021, -422, -340, 188, 82, -54, -10, 5},
+  {-9, -54, 76, 193, -321, -443, 983, 771, -2650, -1102, 9950, 17476, 10338, -876, -2735, 694, 1027, -419, -342, 187, 83, -54, -10, 5},
+  {-9, -54, 75, 194, -319, -446, 977, 780, -2639, -1130, 9902, 17476, 10386, -847, -2746, 685, 1032, -416, -345, 187, 84, -54, -10, 5},
+  {-8, -54, 74, 194, -316, -449, 971, 789, -2628, -1157, 9853, 17475, 10434, -818, -2756, 675, 1038, -412, -348, 186, 85, -54, -11, 5},
+  {-8, -54, 73, 195, -313, -452, 965, 798, -2616, -1184, 9804, 17473, 10482, -789, -2766, 665, 1043, -409, -350, 185, 86, -54, -11, 5},
+  {-8, -54, 72, 195, -311, -455, 960, 807, -2605, -1211, 9755, 17473, 10530, -759, -2776, 655, 1048, -406, -353, 184, 87, -54, -11, 5},
+  {-8, -54, 71, 196, -308, -458, 954, 816, -2594, -1237, 9707, 17468, 10577, -730, -2786, 645, 1054, -402, -355, 184, 88, -54, -11, 5},
+  {-8, -54, 70, 196, -305, -461, 948, 825, -2582, -1264, 9658, 17467, 10625, -700, -2796, 635, 1059, -399, -358, 183, 89, -54, -11, 5},
+  {-8, -54, 69, 197, -303, -463, 942, 834, -2571, -1290, 9609, 17466, 10673, -670, -2806, 624, 1064, -396, -360, 182, 90, -54, -12, 5},
+  {-7, -54, 68, 198, -300, -466, 937, 842, -2559, -1317, 9560, 17463, 10720, -640, -2815, 614, 1069, -392, -363, 181, 90, -54, -12, 5},
+  {-7, -54, 67, 198, -297, -469, 931, 851, -2547, -1343, 9511, 17459, 10768, -609, -2825, 604, 1075, -389, -366, 180, 91, -54, -12, 5},
+  {-7, -54, 66, 199, -295, -471, 925, 860, -2536, -1368, 9461, 17454, 10815, -579, -2834, 593, 1080, -385, -368, 180, 92, -53, -12, 5},
+  {-7, -54, 65, 199, -292, -474, 919, 868, -2524, -1394, 9412, 17452, 10863, -548, -2844, 583, 1085, -382, -371, 179, 93, -53, -12, 5},
+  {-7, -54, 65, 200, -289, -477, 913, 877, -2512, -1420, 9363, 17447, 10910, -517, -2853, 572, 1090, -378, -373, 178, 94, -53, -13, 5},
+  {-7, -54, 64, 200, -286, -479, 907, 885, -2500, -1445, 9314, 17442, 10957, -486, -2862, 562, 1095, -374, -376, 177, 95, -53, -13, 5},
+  {-6, -54, 63, 200, -284, -482, 901, 893, -2488, -1470, 9265, 17440, 11004, -455, -2872, 551, 1100, -371, -378, 176, 96, -53, -13, 5},
+  {-6, -54, 62, 201, -281, -484, 895, 902, -2476, -1495, 9215, 17433, 11051, -423, -2881, 541, 1105, -367, -381, 175, 97, -53, -13, 5},
+  {-6, -54, 61, 201, -278, -487, 889, 910, -2464, -1520, 9166, 17429, 11098, -392, -2890, 530, 1110, -363, -383, 174, 98, -53, -13, 5},
+  {-6, -54, 60, 202, -276, -489, 883, 918, -2451, -1544, 9117, 17423, 11145, -360, -2898, 519, 1115, -360, -386, 173, 99, -53, -14, 5},
+  {-6, -54, 59, 202, -273, -492, 877, 926, -2439, -1569, 9067, 17418, 11192, -328, -2907, 508, 1120, -356, -388, 172, 100, -53, -14, 6},
+  {-6, -54, 58, 203, -270, -494, 871, 934, -2427, -1593, 9018, 17411, 11239, -296, -2916, 497, 1125, -352, -391, 171, 101, -53, -14, 6},
+  {-5, -54, 57, 203, -267, -496, 865, 942, -2414, -1617, 8968, 17404, 11285, -264, -2924, 486, 1129, -348, -393, 170, 102, -53, -14, 6},
+  {-5, -54, 56, 203, -265, -499, 859, 950, -2402, -1641, 8919, 17398, 11332, -231, -2933, 475, 1134, -344, -396, 169, 103, -52, -14, 6},
+  {-5, -54, 56, 204, -262, -501, 853, 958, -2389, -1664, 8869, 17390, 11378, -199, -2941, 464, 1139, -341, -398, 168, 104, -52, -15, 6},
+  {-5, -54, 55, 204, -259, -503, 846, 965, -2377, -1688, 8820, 17384, 11425, -166, -2949, 453, 1144, -337, -401, 167, 105, -52, -15, 6},
+  {-5, -54, 54, 204, -257, -505, 840, 973, -2364, -1711, 8770, 17379, 11471, -133, -2957, 441, 1148, -333, -403, 166, 105, -52, -15, 6},
+  {-5, -54, 53, 205, -254, -508, 834, 980, -2351, -1734, 8720, 17372, 11517, -100, -2966, 430, 1153, -329, -405, 165, 106, -52, -15, 6},
+  {-4, -53, 52, 205, -251, -510, 828, 988, -2339, -1757, 8671, 17361, 11563, -67, -2973, 419, 1158, -325, -408, 164, 107, -52, -15, 6},
+  {-4, -53, 51, 205, -248, -512, 822, 995, -2326, -1780, 8621, 17356, 11609, -34, -2981, 407, 1162, -321, -410, 163, 108, -52, -16, 6},
+  {-4, -53, 50, 206, -246, -514, 816, 1003, -2313, -1803, 8571, 17347, 11655, 0, -2989, 396, 1167, -317, -413, 162, 109, -52, -16, 6},
+  {-4, -53, 49, 206, -243, -516, 809, 1010, -2300, -1825, 8522, 17338, 11701, 34, -2997, 384, 1171, -313, -415, 161, 110, -51, -16, 6},
+  {-4, -53, 48, 206, -240, -518, 803, 1017, -2287, -1847, 8472, 17327, 11746, 68, -3004, 373, 1176, -308, -417, 160, 111, -51, -16, 6},
+  {-4, -53, 48, 207, -238, -520, 797, 1024, -2274, -1869, 8422, 17318, 11792, 102, -3011, 361, 1180, -304, -420, 159, 112, -51, -16, 6},
+  {-4, -53, 47, 207, -235, -522, 790, 1031, -2261, -1891, 8372, 17313, 11837, 136, -3019, 349, 1184, -300, -422, 158, 113, -51, -17, 6},
+  {-3, -53, 46, 207, -232, -524, 784, 1038, -2247, -1913, 8323, 17300, 11883, 170, -3026, 338, 1189, -296, -424, 156, 114, -51, -17, 6},
+  {-3, -53, 45, 207, -229, -526, 778, 1045, -2234, -1934, 8273, 17291, 11928, 205, -3033, 326, 1193, -292, -427, 155, 115, -51, -17, 6},
+  {-3, -53, 44, 207, -227, -528, 771, 1052, -2221, -1956, 8223, 17284, 11973, 239, -3040, 314, 1197, -287, -429, 154, 116, -51, -17, 6},
+  {-3, -53, 43, 208, -224, -529, 765, 1059, -2207, -1977, 8173, 17270, 12018, 274, -3047, 302, 1201, -283, -431, 153, 117, -50, -17, 6},
+  {-3, -53, 42, 208, -221, -531, 759, 1066, -2194, -1998, 8123, 17262, 12063, 309, -3054, 290, 1205, -279, -434, 152, 118, -50, -18, 6},
+  {-3, -52, 42, 208, -218, -533, 752, 1072, -2181, -2019, 8074, 17250, 12108, 344, -3060, 278, 1210, -274, -436, 150, 118, -50, -18, 6},
+  {-3, -52, 41, 208, -216, -535, 746, 1079, -2167, -2039, 8024, 17239, 12152, 380, -3067, 266, 1214, -270, -438, 149, 119, -50, -18, 6},
+  {-2, -52, 40, 208, -213, -536, 740, 1085, -2154, -2060, 7974, 17228, 12197, 415, -3073, 254, 1218, -266, -441, 148, 120, -50, -18, 6},
+  {-2, -52, 39, 209, -210, -538, 733, 1092, -2140, -2080, 7924, 17214, 12241, 451, -3079, 242, 1222, -261, -443, 147, 121, -49, -19, 6},
+  {-2, -52, 38, 209, -208, -540, 727, 1098, -2126, -2100, 7874, 17205, 12286, 487, -3086, 229, 1226, -257, -445, 145, 122, -49, -19, 6},
+  {-2, -52, 37, 209, -205, -541, 720, 1104, -2113, -2120, 7824, 17194, 12330, 522, -3092, 217, 1230, -252, -447, 144, 123, -49, -19, 6},
+  {-2, -52, 36, 209, -202, -543, 714, 1111, -2099, -2139, 7775, 17179, 12374, 559, -3098, 205, 1233, -248, -449, 143, 124, -49, -19, 6},
+  {-2, -52, 36, 209, -199, -544, 708, 1117, -2085, -2159, 7725, 17165, 12418, 595, -3103, 192, 1237, -243, -452, 142, 125, -49, -19, 6},
+  {-2, -52, 35, 209, -197, -546, 701, 1123, -2071, -2178, 7675, 17156, 12462, 631, -3109, 180, 1241, -239, -454, 140, 126, -49, -20, 6},
+  {-2, -52, 34, 209, -194, -547, 695, 1129, -2057, -2197, 7625, 17140, 12506, 668, -3115, 167, 1245, -234, -456, 139, 127, -48, -20, 6},
+  {-1, -51, 33, 209, -191, -549, 688, 1135, -2043, -2216, 7575, 17125, 12549, 704, -3120, 155, 1249, -229, -458, 138, 128, -48, -20, 6},
+  {-1, -51, 32, 209, -189, -550, 682, 1141, -2029, -2235, 7525, 17113, 12593, 741, -3125, 142, 1252, -225, -460, 136, 129, -48, -20, 6},
+  {-1, -51, 32, 209, -186, -552, 675, 1146, -2015, -2254, 7475, 17103, 12636, 778, -3131, 129, 1256, -220, -462, 135, 129, -48, -21, 6},
+  {-1, -51, 31, 209, -183, -553, 669, 1152, -2001, -2272, 7426, 17087, 12679, 815, -3136, 117, 1259, -215, -465, 133, 130, -47, -21, 6},
+  {-1, -51, 30, 209, -181, -554, 662, 1158, -1987, -2290, 7376, 17073, 12722, 853, -3141, 104, 1263, -211, -467, 132, 131, -47, -21, 6},
+  {-1, -51, 29, 209, -178, -556, 656, 1163, -1973, -2308, 7326, 17060, 12765, 890, -3146, 91, 1266, -206, -469, 131, 132, -47, -21, 6},
+  {-1, -51, 28, 210, -175, -557, 649, 1169, -1959, -2326, 7276, 17043, 12808, 928, -3150, 78, 1270, -201, -471, 129, 133, -47, -21, 6},
+  {-1, -51, 27, 210, -172, -558, 643, 1174, -1945, -2344, 7226, 17028, 12851, 966, -3155, 65, 1273, -196, -473, 128, 134, -46, -22, 6},
+  {0, -50, 27, 209, -170, -559, 636, 1179, -1931, -2361, 7176, 17014, 12893, 1003, -3159, 52, 1276, -191, -475, 126, 135, -46, -22, 6},
+  {0, -50, 26, 209, -167, -560, 629, 1185, -1916, -2379, 7127, 16995, 12936, 1042, -3164, 39, 1280, -186, -477, 125, 136, -46, -22, 6},
+  {0, -50, 25, 209, -164, -562, 623, 1190, -1902, -2396, 7077, 16981, 12978, 1080, -3168, 26, 1283, -181, -479, 123, 137, -46, -22, 6},
+  {0, -50, 24, 209, -162, -563, 616, 1195, -1888, -2413, 7027, 16968, 13020, 1118, -3172, 13, 1286, -177, -481, 122, 138, -45, -23, 6},
+  {0, -50, 23, 209, -159, -564, 610, 1200, -1873, -2430, 6977, 16952, 13062, 1157, -3176, 0, 1289, -172, -483, 120, 138, -45, -23, 6},
+  {0, -50, 23, 209, -156, -565, 603, 1205, -1859, -2446, 6928, 16934, 13104, 1195, -3180, -13, 1292, -167, -485, 119, 139, -45, -23, 6},
+  {0, -50, 22, 209, -154, -566, 597, 1210, -1844, -2463, 6878, 16917, 13146, 1234, -3183, -26, 1295, -162, -487, 117, 140, -45, -23, 6},
+  {0, -49, 21, 209, -151, -567, 590, 1215, -1830, -2479, 6828, 16900, 13188, 1273, -3187, -40, 1298, -157, -489, 116, 141, -44, -24, 6},
+  {0, -49, 20, 209, -148, -568, 583, 1220, -1815, -2495, 6779, 16881, 13229, 1312, -3190, -53, 1301, -151, -491, 114, 142, -44, -24, 6},
+  {1, -49, 20, 209, -146, -569, 577, 1224, -1801, -2511, 6729, 16863, 13271, 1351, -3194, -66, 1304, -146, -493, 113, 143, -44, -24, 6},
+  {1, -49, 19, 209, -143, -570, 570, 1229, -1786, -2527, 6680, 16846, 13312, 1390, -3197, -80, 1307, -141, -495, 111, 144, -44, -24, 6},
+  {1, -49, 18, 209, -140, -570, 564, 1233, -1772, -2542, 6630, 16825, 13353, 1430, -3200, -93, 1310, -136, -497, 110, 145, -43, -24, 6},
+  {1, -49, 17, 209, -138, -571, 557, 1238, -1757, -2557, 6580, 16810, 13394, 1469, -3203, -107, 1313, -131, -498, 108, 145, -43, -25, 6},
+  {1, -48, 16, 208, -135, -572, 551, 1242, -1742, -2573, 6531, 16793, 13434, 1509, -3206, -120, 1315, -126, -500, 106, 146, -43, -25, 6},
+  {1, -48, 16, 208, -133, -573, 544, 1247, -1728, -2588, 6481, 16773, 13475, 1549, -3208, -134, 1318, -121, -502, 105, 147, -42, -25, 6},
+  {1, -48, 15, 208, -130, -574, 537, 1251, -1713, -2602, 6432, 16755, 13515, 1589, -3211, -148, 1320, -115, -504, 103, 148, -42, -25, 6},
+  {1, -48, 14, 208, -127, -574, 531, 1255, -1698, -2617, 6383, 16733, 13556, 1629, -3213, -161, 1323, -110, -506, 102, 149, -42, -26, 6},
+  {1, -48, 13, 208, -125, -575, 524, 1259, -1683, -2631, 6333, 16715, 13596, 1670, -3215, -175, 1325, -105, -508, 100, 150, -41, -26, 6},
+  {1, -48, 13, 208, -122, -576, 517, 1263, -1669, -2646, 6284, 16697, 13636, 1710, -3218, -189, 1328, -99, -509, 98, 150, -41, -26, 6},
+  {2, -48, 12, 207, -119, -576, 511, 1267, -1654, -2660, 6235, 16674, 13676, 1751, -3220, -202, 1330, -94, -511, 97, 151, -41, -26, 6},
+  {2, -47, 11, 207, -117, -577, 504, 1271, -1639, -2674, 6185, 16656, 13715, 1791, -3221, -216, 1333, -89, -513, 95, 152, -40, -27, 6},
+  {2, -47, 11, 207, -114, -577, 498, 1275, -1624, -2687, 6136, 16632, 13755, 1832, -3223, -230, 1335, -83, -515, 93, 153, -40, -27, 6},
+  {2, -47, 10, 207, -112, -578, 491, 1279, -1609, -2701, 6087, 16614, 13794, 1873, -3225, -244, 1337, -78, -516, 91, 154, -40, -27, 6},
+  {2, -47, 9, 206, -109, -579, 484, 1282, -1594, -2714, 6038, 16593, 13834, 1914, -3226, -258, 1339, -73, -518, 90, 155, -39, -27, 6},
+  {2, -47, 8, 206, -106, -579, 478, 1286, -1580, -2727, 5989, 16572, 13873, 1955, -3227, -272, 1341, -67, -520, 88, 155, -39, -27, 6},
+  {2, -46, 8, 206, -104, -579, 471, 1290, -1565, -2740, 5939, 16550, 13912, 1997, -3228, -286, 1343, -62, -521, 86, 156, -39, -28, 6},
+  {2, -46, 7, 206, -101, -580, 465, 1293, -1550, -2753, 5890, 16529, 13950, 2038, -3229, -300, 1345, -56, -523, 84, 157, -38, -28, 6},
+  {2, -46, 6, 205, -99, -580, 458, 1296, -1535, -2766, 5841, 16508, 13989, 2080, -3230, -314, 1347, -51, -524, 83, 158, -38, -28, 6},
+  {2, -46, 6, 205, -96, -581, 451, 1300, -1520, -2778, 5792, 16485, 14027, 2122, -3231, -328, 1349, -45, -526, 81, 159, -38, -28, 6},
+  {2, -46, 5, 205, -94, -581, 445, 1303, -1505, -2791, 5744, 16463, 14066, 2163, -3231, -342, 1351, -40, -528, 79, 160, -37, -29, 6},
+  {3, -46, 4, 205, -91, -581, 438, 1306, -1490, -2803, 5695, 16441, 14104, 2205, -3232, -357, 1353, -34, -529, 77, 160, -37, -29, 6},
+  {3, -45, 3, 204, -89, -582, 432, 1309, -1475, -2815, 5646, 16419, 14142, 2248, -3232, -371, 1354, -28, -531, 75, 161, -37, -29, 6},
+  {3, -45, 3, 204, -86, -582, 425, 1312, -1460, -2827, 5597, 16394, 14179, 2290, -3232, -385, 1356, -23, -532, 74, 162, -36, -29, 6},
+  {3, -45, 2, 204, -84, -582, 418, 1315, -1445, -2838, 5549, 16371, 14217, 2332, -3232, -399, 1358, -17, -534, 72, 163, -36, -30, 6},
+  {3, -45, 1, 203, -81, -582, 412, 1318, -1430, -2850, 5500, 16348, 14254, 2375, -3232, -414, 1359, -11, -535, 70, 164, -35, -30, 6},
+  {3, -45, 1, 203, -78, -582, 405, 1321, -1414, -2861, 5451, 16324, 14292, 2417, -3232, -428, 1361, -6, -537, 68, 164, -35, -30, 6},
+  {3, -44, 0, 203, -76, -583, 399, 1324, -1399, -2872, 5403, 16298, 14329, 2460, -3231, -442, 1362, 0, -538, 66, 165, -35, -30, 6},
+  {3, -44, -1, 202, -73, -583, 392, 1327, -1384, -2883, 5354, 16277, 14365, 2503, -3231, -457, 1364, 6, -540, 64, 166, -34, -31, 6},
+  {3, -44, -1, 202, -71, -583, 386, 1329, -1369, -2894, 5306, 16252, 14402, 2546, -3230, -471, 1365, 11, -541, 62, 167, -34, -31, 6},
+  {3, -44, -2, 201, -68, -583, 379, 1332, -1354, -2904, 5258, 16227, 14439, 2589, -3229, -486, 1366, 17, -542, 60, 167, -33, -31, 6},
+  {3, -44, -3, 201, -66, -583, 373, 1334, -1339, -2914, 5209, 16204, 14475, 2632, -3228, -500, 1367, 23, -544, 58, 168, -33, -31, 6},
+  {3, -43, -3, 201, -64, -583, 366, 1337, -1324, -2925, 5161, 16176, 14511, 2675, -3227, -515, 1369, 29, -545, 57, 169, -32, -31, 6},
+  {3, -43, -4, 200, -61, -583, 359, 1339, -1309, -2935, 5113, 16151, 14547, 2719, -3225, -529, 1370, 35, -546, 55, 170, -32, -32, 6},
+  {4, -43, -5, 200, -59, -583, 353, 1341, -1294, -2944, 5065, 16127, 14583, 2762, -3224, -544, 1371, 41, -548, 53, 170, -32, -32, 6},
+  {4, -43, -5, 199, -56, -583, 346, 1344, -1278, -2954, 5017, 16098, 14619, 2806, -3222, -558, 1372, 46, -549, 51, 171, -31, -32, 6},
+  {4, -43, -6, 199, -54, -583, 340, 1346, -1263, -2964, 4969, 16074, 14654, 2850, -3220, -573, 1372, 52, -550, 49, 172, -31, -32, 6},
+  {4, -42, -7, 199, -51, -582, 333, 1348, -1248, -2973, 4921, 16045, 14690, 2894, -3218, -588, 1373, 58, -551, 47, 173, -30, -33, 6},
+  {4, -42, -7, 198, -49, -582, 327, 1350, -1233, -2982, 4873, 16020, 14725, 2938, -3216, -602, 1374, 64, -553, 45, 173, -30, -33, 6},
+  {4, -42, -8, 198, -46, -582, 320, 1352, -1218, -2991, 4825, 15993, 14760, 2982, -3214, -617, 1375, 70, -554, 43, 174, -29, -33, 6},
+  {4, -42, -8, 197, -44, -582, 314, 1354, -1203, -3000, 4777, 15968, 14794, 3026, -3212, -632, 1376, 76, -555, 41, 175, -29, -33, 6},
+  {4, -42, -9, 197, -42, -582, 307, 1355, -1187, -3009, 4730, 15944, 14829, 3070, -3209, -647, 1376, 82, -556, 39, 175, -29, -34, 6},
+  {4, -41, -10, 196, -39, -581, 301, 1357, -1172, -3017, 4682, 15913, 14863, 3115, -3206, -661, 1377, 88, -557, 36, 176, -28, -34, 6},
+  {4, -41, -10, 196, -37, -581, 294, 1359, -1157, -3025, 4635, 15886, 14897, 3159, -3203, -676, 1377, 94, -558, 34, 177, -28, -34, 6},
+  {4, -41, -11, 195, -35, -581, 288, 1360, -1142, -3034, 4587, 15861, 14931, 3204, -3200, -691, 1378, 100, -559, 32, 177, -27, -34, 6},
+  {4, -41, -11, 195, -32, -580, 282, 1362, -1127, -3041, 4540, 15829, 14965, 3249, -3197, -706, 1378, 106, -560, 30, 178, -27, -34, 6},
+  {4, -41, -12, 194, -30, -580, 275, 1363, -1112, -3049, 4493, 15806, 14999, 3293, -3194, -721, 1378, 112, -561, 28, 179, -26, -35, 5},
+  {4, -40, -13, 194, -27, -580, 269, 1365, -1097, -3057, 4445, 15776, 15032, 3338, -3190, -735, 1378, 118, -562, 26, 180, -26, -35, 5},
+  {4, -40, -13, 193, -25, -579, 262, 1366, -1081, -3064, 4398, 15745, 15066, 3383, -3186, -750, 1379, 124, -563, 24, 180, -25, -35, 5},
+  {4, -40, -14, 193, -23, -579, 256, 1367, -1066, -3072, 4351, 15717, 15099, 3429, -3183, -765, 1379, 131, -564, 22, 181, -25, -35, 5},
+  {5, -40, -14, 192, -20, -578, 250, 1369, -1051, -3079, 4304, 15687, 15131, 3474, -3179, -780, 1379, 137, -565, 20, 181, -24, -36, 5},
+  {5, -39, -15, 192, -18, -578, 243, 1370, -1036, -3086, 4257, 15658, 15164, 3519, -3174, -795, 1379, 143, -566, 18, 182, -24, -36, 5},
+  {5, -39, -16, 191, -16, -577, 237, 1371, -1021, -3092, 4211, 15628, 15196, 3565, -3170, -810, 1379, 149, -567, 15, 183, -23, -36, 5},
+  {5, -39, -16, 191, -14, -577, 230, 1372, -1006, -3099, 4164, 15602, 15229, 3610, -3166, -825, 1378, 155, -568, 13, 183, -23, -36, 5},
+  {5, -39, -17, 190, -11, -576, 224, 1373, -991, -3106, 4117, 15572, 15261, 3656, -3161, -840, 1378, 161, -569, 11, 184, -22, -37, 5},
+  {5, -39, -17, 189, -9, -575, 218, 1373, -976, -3112, 4071, 15540, 15293, 3702, -3156, -855, 1378, 168, -570, 9, 185, -22, -37, 5},
+  {5, -38, -18, 189, -7, -575, 211, 1374, -960, -3118, 4024, 15510, 15324, 3747, -3151, -870, 1378, 174, -570, 7, 185, -21, -37, 5},
+  {5, -38, -18, 188, -4, -574, 205, 1375, -945, -3124, 3978, 15479, 15356, 3793, -3146, -885, 1377, 180, -571, 4, 186, -21, -37, 5},
+  {5, -38, -19, 188, -2, -573, 199, 1376, -930, -3130, 3932, 15447, 15387, 3839, -3141, -900, 1377, 186, -572, 2, 187, -20, -37, 5},
+  {5, -38, -19, 187, 0, -573, 193, 1376, -915, -3135, 3885, 15418, 15418, 3885, -3135, -915, 1376, 193, -573, 0, 187, -19, -38, 5},
+  {5, -37, -20, 187, 2, -572, 186, 1377, -900, -3141, 3839, 15387, 15447, 3932, -3130, -930, 1376, 199, -573, -2, 188, -19, -38, 5},
+  {5, -37, -21, 186, 4, -571, 180, 1377, -885, -3146, 3793, 15356, 15479, 3978, -3124, -945, 1375, 205, -574, -4, 188, -18, -38, 5},
+  {5, -37, -21, 185, 7, -570, 174, 1378, -870, -3151, 3747, 15324, 15510, 4024, -3118, -960, 1374, 211, -575, -7, 189, -18, -38, 5},
+  {5, -37, -22, 185, 9, -570, 168, 1378, -855, -3156, 3702, 15293, 15540, 4071, -3112, -976, 1373, 218, -575, -9, 189, -17, -39, 5},
+  {5, -37, -22, 184, 11, -569, 161, 1378, -840, -3161, 3656, 15261, 15572, 4117, -3106, -991, 1373, 224, -576, -11, 190, -17, -39, 5},
+  {5, -36, -23, 183, 13, -568, 155, 1378, -825, -3166, 3610, 15229, 15602, 4164, -3099, -1006, 1372, 230, -577, -14, 191, -16, -39, 5},
+  {5, -36, -23, 183, 15, -567, 149, 1379, -810, -3170, 3565, 15196, 15628, 4211, -3092, -1021, 1371, 237, -577, -16, 191, -16, -39, 5},
+  {5, -36, -24, 182, 18, -566, 143, 1379, -795, -3174, 3519, 15164, 15658, 4257, -3086, -1036, 1370, 243, -578, -18, 192, -15, -39, 5},
+  {5, -36, -24, 181, 20, -565, 137, 1379, -780, -3179, 3474, 15131, 15687, 4304, -3079, -1051, 1369, 250, -578, -20, 192, -14, -40, 5},
+  {5, -35, -25, 181, 22, -564, 131, 1379, -765, -3183, 3429, 15099, 15717, 4351, -3072, -1066, 1367, 256, -579, -23, 193, -14, -40, 4},
+  {5, -35, -25, 180, 24, -563, 124, 1379, -750, -3186, 3383, 15066, 15745, 4398, -3064, -1081, 1366, 262, -579, -25, 193, -13, -40, 4},
+  {5, -35, -26, 180, 26, -562, 118, 1378, -735, -3190, 3338, 15032, 15776, 4445, -3057, -1097, 1365, 269, -580, -27, 194, -13, -40, 4},
+  {5, -35, -26, 179, 28, -561, 112, 1378, -721, -3194, 3293, 14999, 15806, 4493, -3049, -1112, 1363, 275, -580, -30, 194, -12, -41, 4},
+  {6, -34, -27, 178, 30, -560, 106, 1378, -706, -3197, 3249, 14965, 15829, 4540, -3041, -1127, 1362, 282, -580, -32, 195, -11, -41, 4},
+  {6, -34, -27, 177, 32, -559, 100, 1378, -691, -3200, 3204, 14931, 15861, 4587, -3034, -1142, 1360, 288, -581, -35, 195, -11, -41, 4},
+  {6, -34, -28, 177, 34, -558, 94, 1377, -676, -3203, 3159, 14897, 15886, 4635, -3025, -1157, 1359, 294, -581, -37, 196, -10, -41, 4},
+  {6, -34, -28, 176, 36, -557, 88, 1377, -661, -3206, 3115, 14863, 15913, 4682, -3017, -1172, 1357, 301, -581, -39, 196, -10, -41, 4},
+  {6, -34, -29, 175, 39, -556, 82, 1376, -647, -3209, 3070, 14829, 15944, 4730, -3009, -1187, 1355, 307, -582, -42, 197, -9, -42, 4},
+  {6, -33, -29, 175, 41, -555, 76, 1376, -632, -3212, 3026, 14794, 15968, 4777, -3000, -1203, 1354, 314, -582, -44, 197, -8, -42, 4},
+  {6, -33, -29, 174, 43, -554, 70, 1375, -617, -3214, 2982, 14760, 15993, 4825, -2991, -1218, 1352, 320, -582, -46, 198, -8, -42, 4},
+  {6, -33, -30, 173, 45, -553, 64, 1374, -602, -3216, 2938, 14725, 16020, 4873, -2982, -1233, 1350, 327, -582, -49, 198, -7, -42, 4},
+  {6, -33, -30, 173, 47, -551, 58, 1373, -588, -3218, 2894, 14690, 16045, 4921, -2973, -1248, 1348, 333, -582, -51, 199, -7, -42, 4},
+  {6, -32, -31, 172, 49, -550, 52, 1372, -573, -3220, 2850, 14654, 16074, 4969, -2964, -1263, 1346, 340, -583, -54, 199, -6, -43, 4},
+  {6, -32, -31, 171, 51, -549, 46, 1372, -558, -3222, 2806, 14619, 16098, 5017, -2954, -1278, 1344, 346, -583, -56, 199, -5, -43, 4},
+  {6, -32, -32, 170, 53, -548, 41, 1371, -544, -3224, 2762, 14583, 16127, 5065, -2944, -1294, 1341, 353, -583, -59, 200, -5, -43, 4},
+  {6, -32, -32, 170, 55, -546, 35, 1370, -529, -3225, 2719, 14547, 16151, 5113, -2935, -1309, 1339, 359, -583, -61, 200, -4, -43, 3},
+  {6, -31, -32, 169, 57, -545, 29, 1369, -515, -3227, 2675, 14511, 16176, 5161, -2925, -1324, 1337, 366, -583, -64, 201, -3, -43, 3},
+  {6, -31, -33, 168, 58, -544, 23, 1367, -500, -3228, 2632, 14475, 16204, 5209, -2914, -1339, 1334, 373, -583, -66, 201, -3, -44, 3},
+  {6, -31, -33, 167, 60, -542, 17, 1366, -486, -3229, 2589, 14439, 16227, 5258, -2904, -1354, 1332, 379, -583, -68, 201, -2, -44, 3},
+  {6, -31, -34, 167, 62, -541, 11, 1365, -471, -3230, 2546, 14402, 16252, 5306, -2894, -1369, 1329, 386, -583, -71, 202, -1, -44, 3},
+  {6, -31, -34, 166, 64, -540, 6, 1364, -457, -3231, 2503, 14365, 16277, 5354, -2883, -1384, 1327, 392, -583, -73, 202, -1, -44, 3},
+  {6, -30, -35, 165, 66, -538, 0, 1362, -442, -3231, 2460, 14329, 16298, 5403, -2872, -1399, 1324, 399, -583, -76, 203, 0, -44, 3},
+  {6, -30, -35, 164, 68, -537, -6, 1361, -428, -3232, 2417, 14292, 16324, 5451, -2861, -1414, 1321, 405, -582, -78, 203, 1, -45, 3},
+  {6, -30, -35, 164, 70, -535, -11, 1359, -414, -3232, 2375, 14254, 16348, 5500, -2850, -1430, 1318, 412, -582, -81, 203, 1, -45, 3},
+  {6, -30, -36, 163, 72, -534, -17, 1358, -399, -3232, 2332, 14217, 16371, 5549, -2838, -1445, 1315, 418, -582, -84, 204, 2, -45, 3},
+  {6, -29, -36, 162, 74, -532, -23, 1356, -385, -3232, 2290, 14179, 16394, 5597, -2827, -1460, 1312, 425, -582, -86, 204, 3, -45, 3},
+  {6, -29, -37, 161, 75, -531, -28, 1354, -371, -3232, 2248, 14142, 16419, 5646, -2815, -1475, 1309, 432, -582, -89, 204, 3, -45, 3},
+  {6, -29, -37, 160, 77, -529, -34, 1353, -357, -3232, 2205, 14104, 16441, 5695, -2803, -1490, 1306, 438, -581, -91, 205, 4, -46, 3},
+  {6, -29, -37, 160, 79, -528, -40, 1351, -342, -3231, 2163, 14066, 16463, 5744, -2791, -1505, 1303, 445, -581, -94, 205, 5, -46, 2},
+  {6, -28, -38, 159, 81, -526, -45, 1349, -328, -3231, 2122, 14027, 16485, 5792, -2778, -1520, 1300, 451, -581, -96, 205, 6, -46, 2},
+  {6, -28, -38, 158, 83, -524, -51, 1347, -314, -3230, 2080, 13989, 16508, 5841, -2766, -1535, 1296, 458, -580, -99, 205, 6, -46, 2},
+  {6, -28, -38, 157, 84, -523, -56, 1345, -300, -3229, 2038, 13950, 16529, 5890, -2753, -1550, 1293, 465, -580, -101, 206, 7, -46, 2},
+  {6, -28, -39, 156, 86, -521, -62, 1343, -286, -3228, 1997, 13912, 16550, 5939, -2740, -1565, 1290, 471, -579, -104, 206, 8, -46, 2},
+  {6, -27, -39, 155, 88, -520, -67, 1341, -272, -3227, 1955, 13873, 16572, 5989, -2727, -1580, 1286, 478, -579, -106, 206, 8, -47, 2},
+  {6, -27, -39, 155, 90, -518, -73, 1339, -258, -3226, 1914, 13834, 16593, 6038, -2714, -1594, 1282, 484, -579, -109, 206, 9, -47, 2},
+  {6, -27, -40, 154, 91, -516, -78, 1337, -244, -3225, 1873, 13794, 16614, 6087, -2701, -1609, 1279, 491, -578, -112, 207, 10, -47, 2},
+  {6, -27, -40, 153, 93, -515, -83, 1335, -230, -3223, 1832, 13755, 16632, 6136, -2687, -1624, 1275, 498, -577, -114, 207, 11, -47, 2},
+  {6, -27, -40, 152, 95, -513, -89, 1333, -216, -3221, 1791, 13715, 16656, 6185, -2674, -1639, 1271, 504, -577, -117, 207, 11, -47, 2},
+  {6, -26, -41, 151, 97, -511, -94, 1330, -202, -3220, 1751, 13676, 16674, 6235, -2660, -1654, 1267, 511, -576, -119, 207, 12, -48, 2},
+  {6, -26, -41, 150, 98, -509, -99, 1328, -189, -3218, 1710, 13636, 16697, 6284, -2646, -1669, 1263, 517, -576, -122, 208, 13, -48, 1},
+  {6, -26, -41, 150, 100, -508, -105, 1325, -175, -3215, 1670, 13596, 16715, 6333, -2631, -1683, 1259, 524, -575, -125, 208, 13, -48, 1},
+  {6, -26, -42, 149, 102, -506, -110, 1323, -161, -3213, 1629, 13556, 16733, 6383, -2617, -1698, 1255, 531, -574, -127, 208, 14, -48, 1},
+  {6, -25, -42, 148, 103, -504, -115, 1320, -148, -3211, 1589, 13515, 16755, 6432, -2602, -1713, 1251, 537, -574, -130, 208, 15, -48, 1},
+  {6, -25, -42, 147, 105, -502, -121, 1318, -134, -3208, 1549, 13475, 16773, 6481, -2588, -1728, 1247, 544, -573, -133, 208, 16, -48, 1},
+  {6, -25, -43, 146, 106, -500, -126, 1315, -120, -3206, 1509, 13434, 16793, 6531, -2573, -1742, 1242, 551, -572, -135, 208, 16, -48, 1},
+  {6, -25, -43, 145, 108, -498, -131, 1313, -107, -3203, 1469, 13394, 16810, 6580, -2557, -1757, 1238, 557, -571, -138, 209, 17, -49, 1},
+  {6, -24, -43, 145, 110, -497, -136, 1310, -93, -3200, 1430, 13353, 16825, 6630, -2542, -1772, 1233, 564, -570, -140, 209, 18, -49, 1},
+  {6, -24, -44, 144, 111, -495, -141, 1307, -80, -3197, 1390, 13312, 16846, 6680, -2527, -1786, 1229, 570, -570, -143, 209, 19, -49, 1},
+  {6, -24, -44, 143, 113, -493, -146, 1304, -66, -3194, 1351, 13271, 16863, 6729, -2511, -1801, 1224, 577, -569, -146, 209, 20, -49, 1},
+  {6, -24, -44, 142, 114, -491, -151, 1301, -53, -3190, 1312, 13229, 16881, 6779, -2495, -1815, 1220, 583, -568, -148, 209, 20, -49, 0},
+  {6, -24, -44, 141, 116, -489, -157, 1298, -40, -3187, 1273, 13188, 16900, 6828, -2479, -1830, 1215, 590, -567, -151, 209, 21, -49, 0},
+  {6, -23, -45, 140, 117, -487, -162, 1295, -26, -3183, 1234, 13146, 16917, 6878, -2463, -1844, 1210, 597, -566, -154, 209, 22, -50, 0},
+  {6, -23, -45, 139, 119, -485, -167, 1292, -13, -3180, 1195, 13104, 16934, 6928, -2446, -1859, 1205, 603, -565, -156, 209, 23, -50, 0},
+  {6, -23, -45, 138, 120, -483, -172, 1289, 0, -3176, 1157, 13062, 16952, 6977, -2430, -1873, 1200, 610, -564, -159, 209, 23, -50, 0},
+  {6, -23, -45, 138, 122, -481, -177, 1286, 13, -3172, 1118, 13020, 16968, 7027, -2413, -1888, 1195, 616, -563, -162, 209, 24, -50, 0},
+  {6, -22, -46, 137, 123, -479, -181, 1283, 26, -3168, 1080, 12978, 16981, 7077, -2396, -1902, 1190, 623, -562, -164, 209, 25, -50, 0},
+  {6, -22, -46, 136, 125, -477, -186, 1280, 39, -3164, 1042, 12936, 16995, 7127, -2379, -1916, 1185, 629, -560, -167, 209, 26, -50, 0},
+  {6, -22, -46, 135, 126, -475, -191, 1276, 52, -3159, 1003, 12893, 17014, 7176, -2361, -1931, 1179, 636, -559, -170, 209, 27, -50, 0},
+  {6, -22, -46, 134, 128, -473, -196, 1273, 65, -3155, 966, 12851, 17028, 7226, -2344, -1945, 1174, 643, -558, -172, 210, 27, -51, -1},
+  {6, -21, -47, 133, 129, -471, -201, 1270, 78, -3150, 928, 12808, 17043, 7276, -2326, -1959, 1169, 649, -557, -175, 210, 28, -51, -1},
+  {6, -21, -47, 132, 131, -469, -206, 1266, 91, -3146, 890, 12765, 17060, 7326, -2308, -1973, 1163, 656, -556, -178, 209, 29, -51, -1},
+  {6, -21, -47, 131, 132, -467, -211, 1263, 104, -3141, 853, 12722, 17073, 7376, -2290, -1987, 1158, 662, -554, -181, 209, 30, -51, -1},
+  {6, -21, -47, 130, 133, -465, -215, 1259, 117, -3136, 815, 12679, 17087, 7426, -2272, -2001, 1152, 669, -553, -183, 209, 31, -51, -1},
+  {6, -21, -48, 129, 135, -462, -220, 1256, 129, -3131, 778, 12636, 17103, 7475, -2254, -2015, 1146, 675, -552, -186, 209, 32, -51, -1},
+  {6, -20, -48, 129, 136, -460, -225, 1252, 142, -3125, 741, 12593, 17113, 7525, -2235, -2029, 1141, 682, -550, -189, 209, 32, -51, -1},
+  {6, -20, -48, 128, 138, -458, -229, 1249, 155, -3120, 704, 12549, 17125, 7575, -2216, -2043, 1135, 688, -549, -191, 209, 33, -51, -1},
+  {6, -20, -48, 127, 139, -456, -234, 1245, 167, -3115, 668, 12506, 17140, 7625, -2197, -2057, 1129, 695, -547, -194, 209, 34, -52, -2},
+  {6, -20, -49, 126, 140, -454, -239, 1241, 180, -3109, 631, 12462, 17156, 7675, -2178, -2071, 1123, 701, -546, -197, 209, 35, -52, -2},
+  {6, -19, -49, 125, 142, -452, -243, 1237, 192, -3103, 595, 12418, 17165, 7725, -2159, -2085, 1117, 708, -544, -199, 209, 36, -52, -2},
+  {6, -19, -49, 124, 143, -449, -248, 1233, 205, -3098, 559, 12374, 17179, 7775, -2139, -2099, 1111, 714, -543, -202, 209, 36, -52, -2},
+  {6, -19, -49, 123, 144, -447, -252, 1230, 217, -3092, 522, 12330, 17194, 7824, -2120, -2113, 1104, 720, -541, -205, 209, 37, -52, -2},
+  {6, -19, -49, 122, 145, -445, -257, 1226, 229, -3086, 487, 12286, 17205, 7874, -2100, -2126, 1098, 727, -540, -208, 209, 38, -52, -2},
+  {6, -19, -49, 121, 147, -443, -261, 1222, 242, -3079, 451, 12241, 17214, 7924, -2080, -2140, 1092, 733, -538, -210, 209, 39, -52, -2},
+  {6, -18, -50, 120, 148, -441, -266, 1218, 254, -3073, 415, 12197, 17228, 7974, -2060, -2154, 1085, 740, -536, -213, 208, 40, -52, -2},
+  {6, -18, -50, 119, 149, -438, -270, 1214, 266, -3067, 380, 12152, 17239, 8024, -2039, -2167, 1079, 746, -535, -216, 208, 41, -52, -3},
+  {6, -18, -50, 118, 150, -436, -274, 1210, 278, -3060, 344, 12108, 17250, 8074, -2019, -2181, 1072, 752, -533, -218, 208, 42, -52, -3},
+  {6, -18, -50, 118, 152, -434, -279, 1205, 290, -3054, 309, 12063, 17262, 8123, -1998, -2194, 1066, 759, -531, -221, 208, 42, -53, -3},
+  {6, -17, -50, 117, 153, -431, -283, 1201, 302, -3047, 274, 12018, 17270, 8173, -1977, -2207, 1059, 765, -529, -224, 208, 43, -53, -3},
+  {6, -17, -51, 116, 154, -429, -287, 1197, 314, -3040, 239, 11973, 17284, 8223, -1956, -2221, 1052, 771, -528, -227, 207, 44, -53, -3},
+  {6, -17, -51, 115, 155, -427, -292, 1193, 326, -3033, 205, 11928, 17291, 8273, -1934, -2234, 1045, 778, -526, -229, 207, 45, -53, -3},
+  {6, -17, -51, 114, 156, -424, -296, 1189, 338, -3026, 170, 11883, 17300, 8323, -1913, -2247, 1038, 784, -524, -232, 207, 46, -53, -3},
+  {6, -17, -51, 113, 158, -422, -300, 1184, 349, -3019, 136, 11837, 17313, 8372, -1891, -2261, 1031, 790, -522, -235, 207, 47, -53, -4},
+  {6, -16, -51, 112, 159, -420, -304, 1180, 361, -3011, 102, 11792, 17318, 8422, -1869, -2274, 1024, 797, -520, -238, 207, 48, -53, -4},
+  {6, -16, -51, 111, 160, -417, -308, 1176, 373, -3004, 68, 11746, 17327, 8472, -1847, -2287, 1017, 803, -518, -240, 206, 48, -53, -4},
+  {6, -16, -51, 110, 161, -415, -313, 1171, 384, -2997, 34, 11701, 17338, 8522, -1825, -2300, 1010, 809, -516, -243, 206, 49, -53, -4},
+  {6, -16, -52, 109, 162, -413, -317, 1167, 396, -2989, 0, 11655, 17347, 8571, -1803, -2313, 1003, 816, -514, -246, 206, 50, -53, -4},
+  {6, -16, -52, 108, 163, -410, -321, 1162, 407, -2981, -34, 11609, 17356, 8621, -1780, -2326, 995, 822, -512, -248, 205, 51, -53, -4},
+  {6, -15, -52, 107, 164, -408, -325, 1158, 419, -2973, -67, 11563, 17361, 8671, -1757, -2339, 988, 828, -510, -251, 205, 52, -53, -4},
+  {6, -15, -52, 106, 165, -405, -329, 1153, 430, -2966, -100, 11517, 17372, 8720, -1734, -2351, 980, 834, -508, -254, 205, 53, -54, -5},
+  {6, -15, -52, 105, 166, -403, -333, 1148, 441, -2957, -133, 11471, 17379, 8770, -1711, -2364, 973, 840, -505, -257, 204, 54, -54, -5},
+  {6, -15, -52, 105, 167, -401, -337, 1144, 453, -2949, -166, 11425, 17384, 8820, -1688, -2377, 965, 846, -503, -259, 204, 55, -54, -5},
+  {6, -15, -52, 104, 168, -398, -341, 1139, 464, -2941, -199, 11378, 17390, 8869, -1664, -2389, 958, 853, -501, -262, 204, 56, -54, -5},
+  {6, -14, -52, 103, 169, -396, -344, 1134, 475, -2933, -231, 11332, 17398, 8919, -1641, -2402, 950, 859, -499, -265, 203, 56, -54, -5},
+  {6, -14, -53, 102, 170, -393, -348, 1129, 486, -2924, -264, 11285, 17404, 8968, -1617, -2414, 942, 865, -496, -267, 203, 57, -54, -5},
+  {6, -14, -53, 101, 171, -391, -352, 1125, 497, -2916, -296, 11239, 17411, 9018, -1593, -2427, 934, 871, -494, -270, 203, 58, -54, -6},
+  {6, -14, -53, 100, 172, -388, -356, 1120, 508, -2907, -328, 11192, 17418, 9067, -1569, -2439, 926, 877, -492, -273, 202, 59, -54, -6},
+  {5, -14, -53, 99, 173, -386, -360, 1115, 519, -2898, -360, 11145, 17423, 9117, -1544, -2451, 918, 883, -489, -276, 202, 60, -54, -6},
+  {5, -13, -53, 98, 174, -383, -363, 1110, 530, -2890, -392, 11098, 17429, 9166, -1520, -2464, 910, 889, -487, -278, 201, 61, -54, -6},
+  {5, -13, -53, 97, 175, -381, -367, 1105, 541, -2881, -423, 11051, 17433, 9215, -1495, -2476, 902, 895, -484, -281, 201, 62, -54, -6},
+  {5, -13, -53, 96, 176, -378, -371, 1100, 551, -2872, -455, 11004, 17440, 9265, -1470, -2488, 893, 901, -482, -284, 200, 63, -54, -6},
+  {5, -13, -53, 95, 177, -376, -374, 1095, 562, -2862, -486, 10957, 17442, 9314, -1445, -2500, 885, 907, -479, -286, 200, 64, -54, -7},
+  {5, -13, -53, 94, 178, -373, -378, 1090, 572, -2853, -517, 10910, 17447, 9363, -1420, -2512, 877, 913, -477, -289, 200, 65, -54, -7},
+  {5, -12, -53, 93, 179, -371, -382, 1085, 583, -2844, -548, 10863, 17452, 9412, -1394, -2524, 868, 919, -474, -292, 199, 65, -54, -7},
+  {5, -12, -53, 92, 180, -368, -385, 1080, 593, -2834, -579, 10815, 17454, 9461, -1368, -2536, 860, 925, -471, -295, 199, 66, -54, -7},
+  {5, -12, -54, 91, 180, -366, -389, 1075, 604, -2825, -609, 10768, 17459, 9511, -1343, -2547, 851, 931, -469, -297, 198, 67, -54, -7},
+  {5, -12, -54, 90, 181, -363, -392, 1069, 614, -2815, -640, 10720, 17463, 9560, -1317, -2559, 842, 937, -466, -300, 198, 68, -54, -7},
+  {5, -12, -54, 90, 182, -360, -396, 1064, 624, -2806, -670, 10673, 17466, 9609, -1290, -2571, 834, 942, -463, -303, 197, 69, -54, -8},
+  {5, -11, -54, 89, 183, -358, -399, 1059, 635, -2796, -700, 10625, 17467, 9658, -1264, -2582, 825, 948, -461, -305, 196, 70, -54, -8},
+  {5, -11, -54, 88, 184, -355, -402, 1054, 645, -2786, -730, 10577, 17468, 9707, -1237, -2594, 816, 954, -458, -308, 196, 71, -54, -8},
+  {5, -11, -54, 87, 184, -353, -406, 1048, 655, -2776, -759, 10530, 17473, 9755, -1211, -2605, 807, 960, -455, -311, 195, 72, -54, -8},
+  {5, -11, -54, 86, 185, -350, -409, 1043, 665, -2766, -789, 10482, 17473, 9804, -1184, -2616, 798, 965, -452, -313, 195, 73, -54, -8},
+  {5, -11, -54, 85, 186, -348, -412, 1038, 675, -2756, -818, 10434, 17475, 9853, -1157, -2628, 789, 971, -449, -316, 194, 74, -54, -8},
+  {5, -10, -54, 84, 187, -345, -416, 1032, 685, -2746, -847, 10386, 17476, 9902, -1130, -2639, 780, 977, -446, -319, 194, 75, -54, -9},
+  {5, -10, -54, 83, 187, -342, -419, 1027, 694, -2735, -876, 10338, 17476, 9950, -1102, -2650, 771, 983, -443, -321, 193, 76, -54, -9},
+  {5, -10, -54, 82, 188, -340, -422, 1021, 704, -2725, -905, 10289, 17483, 9999, -1075, -2661, 761, 988, -441, -324, 192, 76, -54, -9},
+  {5, -10, -54, 81, 189, -337, -425, 1016, 714, -2714, -934, 10241, 17479, 10048, -1047, -2672, 752, 994, -437, -327, 192, 77, -54, -9},
+  {5, -10, -54, 80, 190, -334, -428, 1010, 724, -2704, -962, 10193, 17478, 10096, -1019, -2682, 743, 999, -434, -329, 191, 78, -54, -9},
+  {0, -9, -54, 79, 190, -332, -431, 1005, 733, -2694, -991, 10146, 17484, 10146, -991, -2694, 733, 1005, -431, -332, 190, 79, -54, -9},
+};
+
+// 音程比 <= 2.00: 32 タップ、遮断 0.200（元の標本化周波数に対する比）
+const int16_t RESAMPLE_TABLE_3[257][32] = {
+  {0, -28, -34, 59, 157, 0, -362, -324, 457, 1032, 0, -2020, -1823, 2915, 9798, 13114, 9798, 2915, -1823, -2020, 0, 1032, 457, -324, -362, 0, 157, 59, -34, -28, 0, 0},
+  {0, -28, -34, 59, 157, 1, -361, -325, 454, 1033, 7, -2014, -1832, 2888, 9773, 13109, 9821, 2940, -1813, -2026, -7, 1032, 461, -322, -363, -1, 157, 60, -34, -28, 0, 4},
+  {0, -28, -34, 58, 157, 3, -360, -327, 450, 1033, 15, -2008, -1841, 2862, 9750, 13111, 9844, 2966, -1803, -2032, -15, 1032, 465, -320, -365, -3, 157, 60, -34, -29, 0, 4},
+  {0, -28, -34, 58, 157, 4, -359, -329, 446, 1033, 22, -2002, -1850, 2836, 9726, 13111, 9868, 2992, -1794, -2038, -22, 1031, 468, -318, -366, -4, 157, 61, -33, -29, 0, 4},
+  {0, -28, -34, 57, 157, 5, -358, -330, 443, 1033, 29, -1995, -1859, 2811, 9702, 13108, 9891, 3018, -1784, -2044, -30, 1031, 472, -316, -367, -5, 157, 62, -33, -29, 0, 4},
+  {0, -28, -35, 57, 157, 6, -357, -332, 439, 1034, 37, -1989, -1868, 2785, 9678, 13108, 9914, 3044, -1774, -2049, -37, 1030, 476, -315, -368, -6, 157, 62, -33, -29, 0, 4},
+  {0, -27, -35, 56, 157, 7, -355, -334, 435, 1034, 44, -1983, -1877, 2759, 9654, 13108, 9938, 3071, -1765, -2055, -45, 1030, 479, -313, -369, -8, 157, 63, -33, -29, 0, 4},
+  {0, -27, -35, 56, 157, 9, -354, -335, 431, 1034, 51, -1977, -1886, 2733, 9630, 13107, 9961, 3097, -1755, -2061, -52, 1029, 483, -311, -370, -9, 157, 63, -33, -29, 0, 4},
+  {0, -27, -35, 55, 157, 10, -353, -337, 428, 1034, 59, -1971, -1895, 2708, 9606, 13106, 9984, 3123, -1745, -2067, -60, 1029, 487, -309, -371, -10, 157, 64, -33, -29, -1, 4},
+  {1, -27, -35, 55, 157, 11, -352, -339, 424, 1034, 66, -1964, -1904, 2682, 9582, 13105, 10007, 3149, -1735, -2073, -67, 1028, 490, -307, -372, -11, 157, 64, -32, -29, -1, 4},
+  {1, -27, -35, 54, 156, 12, -351, -340, 420, 1034, 73, -1958, -1912, 2657, 9558, 13105, 10030, 3176, -1725, -2078, -75, 1028, 494, -306, -373, -13, 157, 65, -32, -30, -1, 4},
+  {1, -27, -35, 54, 156, 14, -350, -342, 417, 1034, 80, -1952, -1921, 2631, 9534, 13104, 10053, 3202, -1714, -2084, -83, 1027, 498, -304, -374, -14, 157, 65, -32, -30, -1, 4},
+  {1, -27, -36, 53, 156, 15, -348, -343, 413, 1034, 87, -1945, -1930, 2605, 9510, 13103, 10076, 3228, -1704, -2089, -90, 1026, 501, -302, -375, -15, 157, 66, -32, -30, -1, 4},
+  {1, -27, -36, 53, 156, 16, -347, -345, 409, 1034, 95, -1939, -1938, 2580, 9485, 13102, 10099, 3255, -1694, -2095, -98, 1026, 505, -300, -376, -17, 157, 66, -32, -30, -1, 4},
+  {1, -26, -36, 52, 156, 17, -346, -347, 405, 1034, 102, -1932, -1946, 2555, 9461, 13099, 10122, 3281, -1683, -2101, -106, 1025, 509, -298, -377, -18, 157, 67, -32, -30, -1, 4},
+  {1, -26, -36, 52, 156, 18, -345, -348, 402, 1034, 109, -1926, -1955, 2529, 9436, 13098, 10144, 3308, -1673, -2106, -113, 1024, 512, -296, -378, -19, 157, 67, -31, -30, -1, 4},
+  {1, -26, -36, 51, 156, 20, -344, -350, 398, 1034, 116, -1919, -1963, 2504, 9412, 13094, 10167, 3334, -1662, -2111, -121, 1024, 516, -294, -379, -21, 157, 68, -31, -30, -1, 4},
+  {1, -26, -36, 51, 156, 21, -342, -351, 394, 1034, 123, -1913, -1971, 2479, 9387, 13092, 10190, 3361, -1652, -2117, -129, 1023, 520, -292, -380, -22, 157, 68, -31, -30, -1, 4},
+  {1, -26, -36, 50, 156, 22, -341, -353, 391, 1034, 130, -1906, -1979, 2453, 9363, 13090, 10212, 3387, -1641, -2122, -136, 1022, 523, -290, -381, -23, 157, 69, -31, -30, -1, 4},
+  {1, -26, -36, 50, 156, 23, -340, -354, 387, 1033, 137, -1899, -1987, 2428, 9338, 13090, 10235, 3414, -1630, -2128, -144, 1021, 527, -288, -382, -25, 157, 69, -31, -31, -1, 4},
+  {1, -26, -37, 49, 156, 24, -339, -356, 383, 1033, 144, -1893, -1995, 2403, 9314, 13089, 10257, 3441, -1619, -2133, -152, 1020, 531, -286, -383, -26, 157, 70, -31, -31, -1, 4},
+  {1, -26, -37, 49, 155, 25, -338, -357, 379, 1033, 151, -1886, -2003, 2378, 9289, 13088, 10279, 3467, -1608, -2138, -160, 1019, 534, -284, -384, -27, 157, 70, -30, -31, -1, 4},
+  {1, -25, -37, 48, 155, 27, -336, -358, 376, 1033, 158, -1879, -2010, 2353, 9264, 13080, 10302, 3494, -1597, -2143, -167, 1018, 538, -282, -385, -29, 157, 71, -30, -31, -2, 4},
+  {1, -25, -37, 48, 155, 28, -335, -360, 372, 1032, 165, -1873, -2018, 2328, 9239, 13078, 10324, 3521, -1586, -2148, -175, 1018, 542, -280, -386, -30, 157, 72, -30, -31, -2, 4},
+  {1, -25, -37, 47, 155, 29, -334, -361, 368, 1032, 172, -1866, -2026, 2303, 9214, 13079, 10346, 3547, -1575, -2154, -183, 1017, 545, -278, -387, -31, 157, 72, -30, -31, -2, 4},
+  {1, -25, -37, 47, 155, 30, -333, -363, 365, 1032, 179, -1859, -2033, 2278, 9189, 13076, 10368, 3574, -1564, -2159, -191, 1016, 549, -276, -388, -33, 156, 73, -30, -31, -2, 4},
+  {1, -25, -37, 46, 155, 31, -331, -364, 361, 1031, 186, -1852, -2041, 2253, 9164, 13073, 10390, 3601, -1552, -2164, -199, 1015, 552, -274, -389, -34, 156, 73, -29, -31, -2, 4},
+  {2, -25, -37, 46, 155, 32, -330, -366, 357, 1031, 193, -1845, -2048, 2228, 9139, 13070, 10412, 3628, -1541, -2169, -207, 1013, 556, -272, -390, -35, 156, 74, -29, -32, -2, 4},
+  {2, -25, -37, 45, 154, 33, -329, -367, 353, 1031, 199, -1839, -2055, 2203, 9114, 13069, 10434, 3655, -1529, -2174, -214, 1012, 560, -270, -391, -37, 156, 74, -29, -32, -2, 4},
+  {2, -25, -37, 44, 154, 35, -327, -368, 350, 1030, 206, -1832, -2063, 2179, 9089, 13064, 10456, 3682, -1518, -2179, -222, 1011, 563, -268, -392, -38, 156, 75, -29, -32, -2, 4},
+  {2, -24, -38, 44, 154, 36, -326, -370, 346, 1030, 213, -1825, -2070, 2154, 9064, 13059, 10478, 3709, -1506, -2184, -230, 1010, 567, -265, -393, -39, 156, 75, -29, -32, -2, 4},
+  {2, -24, -38, 43, 154, 37, -325, -371, 342, 1029, 220, -1818, -2077, 2129, 9039, 13056, 10499, 3736, -1494, -2188, -238, 1009, 570, -263, -394, -41, 156, 76, -28, -32, -2, 4},
+  {2, -24, -38, 43, 154, 38, -324, -372, 339, 1029, 227, -1811, -2084, 2105, 9013, 13051, 10521, 3763, -1483, -2193, -246, 1008, 574, -261, -395, -42, 156, 76, -28, -32, -2, 4},
+  {2, -24, -38, 42, 154, 39, -322, -374, 335, 1028, 233, -1804, -2091, 2080, 8988, 13051, 10542, 3790, -1471, -2198, -254, 1006, 577, -259, -395, -44, 156, 77, -28, -32, -2, 4},
+  {2, -24, -38, 42, 154, 40, -321, -375, 331, 1028, 240, -1797, -2098, 2055, 8963, 13046, 10564, 3817, -1459, -2203, -262, 1005, 581, -257, -396, -45, 156, 77, -28, -32, -2, 4},
+  {2, -24, -38, 41, 153, 41, -320, -376, 327, 1027, 247, -1790, -2104, 2031, 8937, 13044, 10585, 3844, -1447, -2207, -270, 1004, 585, -255, -397, -46, 155, 78, -28, -32, -3, 4},
+  {2, -24, -38, 41, 153, 42, -318, -377, 324, 1026, 253, -1783, -2111, 2007, 8912, 13040, 10606, 3871, -1435, -2212, -278, 1003, 588, -252, -398, -48, 155, 78, -27, -33, -3, 4},
+  {2, -23, -38, 40, 153, 43, -317, -379, 320, 1026, 260, -1775, -2118, 1982, 8886, 13035, 10628, 3898, -1422, -2217, -286, 1001, 592, -250, -399, -49, 155, 79, -27, -33, -3, 4},
+  {2, -23, -38, 40, 153, 45, -316, -380, 316, 1025, 266, -1768, -2124, 1958, 8861, 13030, 10649, 3925, -1410, -2221, -294, 1000, 595, -248, -400, -50, 155, 79, -27, -33, -3, 4},
+  {2, -23, -38, 39, 153, 46, -314, -381, 313, 1024, 273, -1761, -2131, 1934, 8835, 13027, 10670, 3952, -1398, -2226, -302, 998, 599, -246, -401, -52, 155, 80, -27, -33, -3, 4},
+  {2, -23, -38, 39, 152, 47, -313, -382, 309, 1024, 280, -1754, -2137, 1909, 8810, 13020, 10691, 3980, -1385, -2230, -310, 997, 602, -244, -401, -53, 155, 80, -27, -33, -3, 4},
+  {2, -23, -39, 38, 152, 48, -312, -383, 305, 1023, 286, -1747, -2144, 1885, 8784, 13018, 10712, 4007, -1373, -2234, -318, 995, 606, -241, -402, -55, 155, 81, -26, -33, -3, 4},
+  {2, -23, -39, 38, 152, 49, -310, -385, 302, 1022, 293, -1739, -2150, 1861, 8758, 13012, 10733, 4034, -1360, -2239, -326, 994, 609, -239, -403, -56, 154, 82, -26, -33, -3, 4},
+  {2, -23, -39, 37, 152, 50, -309, -386, 298, 1021, 299, -1732, -2156, 1837, 8732, 13010, 10754, 4061, -1348, -2243, -334, 992, 613, -237, -404, -57, 154, 82, -26, -33, -3, 4},
+  {2, -23, -39, 37, 152, 51, -308, -387, 294, 1021, 306, -1725, -2162, 1813, 8707, 13003, 10774, 4089, -1335, -2247, -343, 991, 616, -234, -405, -59, 154, 83, -26, -33, -3, 4},
+  {2, -22, -39, 37, 151, 52, -306, -388, 290, 1020, 312, -1718, -2168, 1789, 8681, 12998, 10795, 4116, -1322, -2252, -351, 989, 620, -232, -405, -60, 154, 83, -25, -34, -3, 4},
+  {2, -22, -39, 36, 151, 53, -305, -389, 287, 1019, 318, -1710, -2174, 1765, 8655, 12993, 10816, 4143, -1309, -2256, -359, 988, 623, -230, -406, -62, 154, 84, -25, -34, -3, 4},
+  {2, -22, -39, 36, 151, 54, -304, -390, 283, 1018, 325, -1703, -2180, 1741, 8629, 12988, 10836, 4171, -1296, -2260, -367, 986, 627, -227, -407, -63, 154, 84, -25, -34, -4, 4},
+  {3, -22, -39, 35, 151, 55, -302, -391, 279, 1017, 331, -1695, -2186, 1717, 8603, 12984, 10857, 4198, -1283, -2264, -375, 984, 630, -225, -408, -65, 153, 85, -25, -34, -4, 4},
+  {3, -22, -39, 35, 151, 56, -301, -392, 276, 1016, 337, -1688, -2192, 1694, 8577, 12976, 10877, 4225, -1270, -2268, -383, 983, 634, -223, -408, -66, 153, 85, -24, -34, -4, 4},
+  {3, -22, -39, 34, 150, 57, -299, -394, 272, 1015, 344, -1681, -2197, 1670, 8551, 12971, 10897, 4253, -1257, -2272, -391, 981, 637, -220, -409, -67, 153, 86, -24, -34, -4, 4},
+  {3, -22, -39, 34, 150, 58, -298, -395, 268, 1014, 350, -1673, -2203, 1646, 8525, 12968, 10918, 4280, -1244, -2276, -400, 979, 641, -218, -410, -69, 153, 86, -24, -34, -4, 4},
+  {3, -21, -39, 33, 150, 59, -297, -396, 265, 1013, 356, -1666, -2208, 1623, 8499, 12960, 10938, 4308, -1230, -2280, -408, 977, 644, -216, -411, -70, 153, 87, -24, -34, -4, 4},
+  {3, -21, -39, 33, 150, 60, -295, -397, 261, 1012, 363, -1658, -2214, 1599, 8473, 12954, 10958, 4335, -1217, -2284, -416, 975, 647, -213, -411, -72, 152, 87, -23, -34, -4, 4},
+  {3, -21, -39, 32, 149, 61, -294, -398, 257, 1011, 369, -1651, -2219, 1576, 8446, 12950, 10978, 4363, -1204, -2288, -424, 974, 651, -211, -412, -73, 152, 88, -23, -35, -4, 4},
+  {3, -21, -40, 32, 149, 62, -293, -399, 254, 1010, 375, -1643, -2225, 1552, 8420, 12946, 10998, 4390, -1190, -2291, -433, 972, 654, -208, -413, -75, 152, 88, -23, -35, -4, 4},
+  {3, -21, -40, 31, 149, 63, -291, -400, 250, 1009, 381, -1635, -2230, 1529, 8394, 12938, 11017, 4418, -1176, -2295, -441, 970, 658, -206, -414, -76, 152, 89, -23, -35, -4, 4},
+  {3, -21, -40, 31, 149, 64, -290, -401, 246, 1008, 387, -1628, -2235, 1505, 8367, 12934, 11037, 4445, -1163, -2299, -449, 968, 661, -203, -414, -77, 151, 89, -22, -35, -4, 4},
+  {3, -21, -40, 30, 148, 65, -288, -402, 243, 1007, 393, -1620, -2240, 1482, 8341, 12925, 11057, 4473, -1149, -2302, -457, 966, 665, -201, -415, -79, 151, 90, -22, -35, -4, 4},
+  {3, -21, -40, 30, 148, 66, -287, -403, 239, 1006, 399, -1613, -2245, 1459, 8315, 12920, 11077, 4501, -1135, -2306, -466, 964, 668, -198, -416, -80, 151, 90, -22, -35, -5, 4},
+  {3, -20, -40, 29, 148, 67, -286, -404, 235, 1004, 405, -1605, -2250, 1436, 8288, 12916, 11096, 4528, -1121, -2310, -474, 962, 671, -196, -416, -82, 151, 91, -22, -35, -5, 4},
+  {3, -20, -40, 29, 148, 68, -284, -404, 232, 1003, 411, -1597, -2255, 1413, 8262, 12904, 11115, 4556, -1107, -2313, -482, 960, 675, -193, -417, -83, 150, 91, -21, -35, -5, 4},
+  {3, -20, -40, 28, 147, 69, -283, -405, 228, 1002, 417, -1590, -2260, 1389, 8235, 12900, 11135, 4584, -1093, -2316, -490, 958, 678, -191, -417, -85, 150, 92, -21, -35, -5, 4},
+  {3, -20, -40, 28, 147, 70, -281, -406, 224, 1001, 423, -1582, -2264, 1366, 8209, 12893, 11154, 4611, -1079, -2320, -499, 956, 681, -188, -418, -86, 150, 92, -21, -35, -5, 4},
+  {3, -20, -40, 27, 147, 71, -280, -407, 221, 999, 429, -1574, -2269, 1343, 8182, 12888, 11173, 4639, -1065, -2323, -507, 953, 685, -186, -419, -88, 150, 93, -21, -36, -5, 5},
+  {3, -20, -40, 27, 147, 72, -278, -408, 217, 998, 435, -1566, -2274, 1321, 8156, 12875, 11192, 4667, -1050, -2326, -515, 951, 688, -183, -419, -89, 149, 94, -20, -36, -5, 5},
+  {3, -20, -40, 26, 146, 73, -277, -409, 214, 997, 441, -1559, -2278, 1298, 8129, 12873, 11212, 4694, -1036, -2330, -524, 949, 691, -181, -420, -91, 149, 94, -20, -36, -5, 5},
+  {3, -20, -40, 26, 146, 74, -276, -410, 210, 995, 447, -1551, -2283, 1275, 8102, 12864, 11231, 4722, -1021, -2333, -532, 947, 695, -178, -421, -92, 149, 95, -20, -36, -5, 5},
+  {3, -19, -40, 25, 146, 75, -274, -411, 206, 994, 453, -1543, -2287, 1252, 8076, 12855, 11249, 4750, -1007, -2336, -540, 944, 698, -175, -421, -93, 149, 95, -20, -36, -5, 5},
+  {3, -19, -40, 25, 145, 76, -273, -411, 203, 993, 459, -1535, -2291, 1230, 8049, 12847, 11268, 4778, -992, -2339, -549, 942, 701, -173, -422, -95, 148, 96, -19, -36, -6, 5},
+  {3, -19, -40, 25, 145, 77, -271, -412, 199, 991, 464, -1527, -2296, 1207, 8022, 12840, 11287, 4805, -978, -2342, -557, 940, 705, -170, -422, -96, 148, 96, -19, -36, -6, 5},
+  {3, -19, -40, 24, 145, 78, -270, -413, 196, 990, 470, -1519, -2300, 1184, 7995, 12834, 11306, 4833, -963, -2345, -566, 937, 708, -168, -423, -98, 148, 97, -19, -36, -6, 5},
+  {3, -19, -40, 24, 145, 79, -268, -414, 192, 988, 476, -1512, -2304, 1162, 7968, 12825, 11324, 4861, -948, -2348, -574, 935, 711, -165, -423, -99, 147, 97, -18, -36, -6, 5},
+  {3, -19, -40, 23, 144, 80, -267, -414, 188, 987, 482, -1504, -2308, 1139, 7942, 12816, 11343, 4889, -933, -2351, -582, 933, 714, -162, -424, -101, 147, 98, -18, -36, -6, 5},
+  {3, -19, -40, 23, 144, 80, -265, -415, 185, 985, 487, -1496, -2312, 1117, 7915, 12809, 11361, 4917, -918, -2354, -591, 930, 718, -160, -424, -102, 147, 98, -18, -36, -6, 5},
+  {3, -18, -40, 22, 144, 81, -264, -416, 181, 984, 493, -1488, -2316, 1095, 7888, 12801, 11379, 4945, -903, -2356, -599, 928, 721, -157, -425, -104, 146, 99, -18, -37, -6, 5},
+  {3, -18, -40, 22, 143, 82, -263, -417, 178, 982, 499, -1480, -2319, 1072, 7861, 12793, 11398, 4972, -888, -2359, -608, 925, 724, -154, -425, -105, 146, 99, -17, -37, -6, 5},
+  {4, -18, -40, 21, 143, 83, -261, -417, 174, 981, 504, -1472, -2323, 1050, 7834, 12784, 11416, 5000, -873, -2362, -616, 923, 727, -152, -426, -107, 146, 100, -17, -37, -6, 5},
+  {4, -18, -40, 21, 143, 84, -260, -418, 170, 979, 510, -1464, -2327, 1028, 7807, 12775, 11434, 5028, -857, -2364, -624, 920, 730, -149, -426, -108, 145, 100, -17, -37, -6, 5},
+  {4, -18, -40, 20, 142, 85, -258, -419, 167, 978, 515, -1456, -2330, 1006, 7780, 12766, 11452, 5056, -842, -2367, -633, 917, 734, -146, -427, -110, 145, 101, -16, -37, -6, 5},
+  {4, -18, -41, 20, 142, 86, -257, -419, 163, 976, 521, -1448, -2334, 984, 7753, 12757, 11470, 5084, -827, -2369, -641, 915, 737, -143, -427, -111, 145, 101, -16, -37, -7, 5},
+  {4, -18, -41, 20, 142, 87, -255, -420, 160, 974, 526, -1440, -2337, 962, 7726, 12750, 11488, 5112, -811, -2372, -650, 912, 740, -141, -428, -113, 144, 102, -16, -37, -7, 5},
+  {4, -18, -41, 19, 141, 88, -254, -421, 156, 973, 532, -1432, -2341, 940, 7699, 12742, 11505, 5140, -795, -2374, -658, 909, 743, -138, -428, -114, 144, 102, -16, -37, -7, 5},
+  {4, -17, -41, 19, 141, 88, -252, -421, 153, 971, 537, -1424, -2344, 918, 7671, 12732, 11523, 5168, -780, -2377, -667, 907, 746, -135, -429, -116, 144, 103, -15, -37, -7, 5},
+  {4, -17, -41, 18, 141, 89, -251, -422, 149, 969, 543, -1416, -2347, 896, 7644, 12724, 11540, 5196, -764, -2379, -675, 904, 749, -132, -429, -117, 143, 103, -15, -37, -7, 5},
+  {4, -17, -41, 18, 140, 90, -249, -423, 146, 967, 548, -1408, -2350, 875, 7617, 12713, 11558, 5224, -748, -2381, -684, 901, 753, -130, -429, -119, 143, 104, -15, -37, -7, 5},
+  {4, -17, -41, 17, 140, 91, -248, -423, 142, 966, 553, -1399, -2354, 853, 7590, 12704, 11575, 5252, -732, -2383, -692, 898, 756, -127, -430, -120, 142, 104, -14, -37, -7, 5},
+  {4, -17, -41, 17, 140, 92, -246, -424, 139, 964, 559, -1391, -2357, 831, 7563, 12693, 11593, 5280, -716, -2385, -701, 895, 759, -124, -430, -122, 142, 105, -14, -38, -7, 5},
+  {4, -17, -41, 16, 139, 93, -245, -424, 135, 962, 564, -1383, -2360, 810, 7535, 12687, 11610, 5308, -700, -2388, -709, 892, 762, -121, -431, -123, 142, 105, -14, -38, -7, 5},
+  {4, -17, -41, 16, 139, 93, -243, -425, 132, 960, 569, -1375, -2362, 788, 7508, 12675, 11627, 5336, -684, -2390, -717, 890, 765, -118, -431, -125, 141, 106, -13, -38, -7, 5},
+  {4, -17, -41, 16, 139, 94, -242, -425, 128, 959, 574, -1367, -2365, 767, 7481, 12666, 11644, 5364, -668, -2392, -726, 887, 768, -116, -431, -126, 141, 106, -13, -38, -8, 5},
+  {4, -16, -41, 15, 138, 95, -240, -426, 125, 957, 580, -1359, -2368, 745, 7453, 12657, 11661, 5392, -652, -2393, -734, 884, 771, -113, -432, -128, 140, 107, -13, -38, -8, 5},
+  {4, -16, -41, 15, 138, 96, -239, -427, 121, 955, 585, -1351, -2371, 724, 7426, 12648, 11678, 5420, -636, -2395, -743, 881, 774, -110, -432, -129, 140, 107, -13, -38, -8, 5},
+  {4, -16, -41, 14, 138, 97, -237, -427, 118, 953, 590, -1342, -2373, 703, 7399, 12632, 11695, 5448, -619, -2397, -751, 878, 777, -107, -432, -131, 140, 108, -12, -38, -8, 5},
+  {4, -16, -41, 14, 137, 97, -236, -428, 114, 951, 595, -1334, -2376, 682, 7371, 12630, 11711, 5476, -603, -2399, -760, 874, 780, -104, -433, -132, 139, 108, -12, -38, -8, 5},
+  {4, -16, -41, 13, 137, 98, -234, -428, 111, 949, 600, -1326, -2378, 661, 7344, 12616, 11728, 5504, -586, -2401, -768, 871, 783, -101, -433, -134, 139, 109, -12, -38, -8, 5},
+  {4, -16, -41, 13, 137, 99, -233, -428, 107, 947, 605, -1318, -2381, 640, 7316, 12606, 11744, 5532, -569, -2402, -777, 868, 786, -98, -433, -135, 138, 109, -11, -38, -8, 5},
+  {4, -16, -41, 13, 136, 100, -231, -429, 104, 945, 610, -1310, -2383, 619, 7289, 12596, 11761, 5560, -553, -2404, -786, 865, 789, -95, -434, -137, 138, 110, -11, -38, -8, 5},
+  {4, -16, -41, 12, 136, 101, -230, -429, 100, 943, 615, -1301, -2386, 598, 7261, 12586, 11777, 5588, -536, -2405, -794, 862, 792, -92, -434, -138, 137, 110, -11, -38, -8, 5},
+  {4, -15, -41, 12, 136, 101, -228, -430, 97, 941, 620, -1293, -2388, 577, 7234, 12574, 11794, 5616, -519, -2407, -803, 859, 795, -89, -434, -140, 137, 110, -10, -38, -9, 5},
+  {4, -15, -41, 11, 135, 102, -227, -430, 93, 939, 625, -1285, -2390, 556, 7206, 12565, 11810, 5644, -502, -2408, -811, 855, 798, -87, -434, -141, 137, 111, -10, -38, -9, 5},
+  {4, -15, -41, 11, 135, 103, -225, -431, 90, 937, 630, -1276, -2392, 535, 7179, 12555, 11826, 5672, -485, -2409, -820, 852, 801, -84, -435, -143, 136, 111, -10, -39, -9, 5},
+  {4, -15, -41, 10, 134, 104, -224, -431, 86, 935, 635, -1268, -2394, 515, 7151, 12544, 11842, 5700, -468, -2411, -828, 849, 804, -81, -435, -145, 136, 112, -9, -39, -9, 5},
+  {4, -15, -41, 10, 134, 104, -222, -431, 83, 933, 640, -1260, -2396, 494, 7123, 12534, 11858, 5728, -451, -2412, -837, 845, 807, -78, -435, -146, 135, 112, -9, -39, -9, 5},
+  {4, -15, -41, 10, 134, 105, -221, -432, 80, 931, 645, -1252, -2398, 473, 7096, 12522, 11873, 5756, -434, -2413, -845, 842, 810, -75, -435, -148, 135, 113, -9, -39, -9, 5},
+  {4, -15, -41, 9, 133, 106, -219, -432, 76, 929, 650, -1243, -2400, 453, 7068, 12510, 11889, 5784, -417, -2414, -854, 839, 813, -72, -435, -149, 134, 113, -8, -39, -9, 5},
+  {4, -15, -41, 9, 133, 107, -218, -432, 73, 927, 654, -1235, -2401, 432, 7040, 12498, 11905, 5812, -399, -2415, -862, 835, 816, -69, -436, -151, 134, 114, -8, -39, -9, 5},
+  {4, -14, -41, 8, 132, 107, -216, -433, 69, 924, 659, -1227, -2403, 412, 7013, 12491, 11920, 5840, -382, -2416, -871, 832, 818, -66, -436, -152, 133, 114, -8, -39, -9, 5},
+  {4, -14, -41, 8, 132, 108, -215, -433, 66, 922, 664, -1218, -2405, 392, 6985, 12476, 11936, 5868, -364, -2417, -879, 828, 821, -63, -436, -154, 133, 115, -7, -39, -10, 5},
+  {4, -14, -41, 7, 132, 109, -213, -433, 63, 920, 669, -1210, -2406, 372, 6957, 12464, 11951, 5896, -347, -2418, -888, 825, 824, -60, -436, -155, 132, 115, -7, -39, -10, 5},
+  {4, -14, -41, 7, 131, 110, -212, -434, 59, 918, 673, -1201, -2408, 351, 6930, 12453, 11966, 5924, -329, -2419, -896, 821, 827, -56, -436, -157, 132, 116, -7, -39, -10, 5},
+  {4, -14, -41, 7, 131, 110, -210, -434, 56, 916, 678, -1193, -2409, 331, 6902, 12439, 11982, 5952, -312, -2420, -905, 818, 830, -53, -436, -158, 131, 116, -6, -39, -10, 5},
+  {4, -14, -40, 6, 130, 111, -209, -434, 53, 913, 682, -1185, -2411, 311, 6874, 12430, 11997, 5980, -294, -2420, -913, 814, 832, -50, -437, -160, 131, 117, -6, -39, -10, 5},
+  {4, -14, -40, 6, 130, 112, -207, -435, 49, 911, 687, -1176, -2412, 291, 6846, 12417, 12012, 6008, -276, -2421, -922, 810, 835, -47, -437, -161, 130, 117, -5, -39, -10, 5},
+  {4, -14, -40, 5, 130, 112, -206, -435, 46, 909, 692, -1168, -2413, 271, 6819, 12404, 12026, 6036, -258, -2422, -930, 807, 838, -44, -437, -163, 130, 118, -5, -39, -10, 5},
+  {4, -13, -40, 5, 129, 113, -204, -435, 43, 906, 696, -1159, -2414, 252, 6791, 12390, 12041, 6064, -240, -2422, -939, 803, 841, -41, -437, -164, 129, 118, -5, -39, -10, 5},
+  {4, -13, -40, 5, 129, 114, -203, -435, 39, 904, 701, -1151, -2415, 232, 6763, 12379, 12056, 6092, -222, -2423, -947, 799, 843, -38, -437, -166, 128, 118, -4, -39, -10, 5},
+  {4, -13, -40, 4, 128, 114, -201, -435, 36, 902, 705, -1143, -2416, 212, 6735, 12368, 12071, 6120, -204, -2423, -956, 795, 846, -35, -437, -167, 128, 119, -4, -39, -11, 5},
+  {4, -13, -40, 4, 128, 115, -200, -436, 33, 899, 709, -1134, -2417, 193, 6707, 12358, 12085, 6148, -186, -2423, -965, 792, 849, -32, -437, -169, 127, 119, -4, -40, -11, 5},
+  {4, -13, -40, 3, 128, 116, -198, -436, 29, 897, 714, -1126, -2418, 173, 6680, 12342, 12100, 6177, -167, -2424, -973, 788, 851, -29, -437, -171, 127, 120, -3, -40, -11, 5},
+  {4, -13, -40, 3, 127, 116, -197, -436, 26, 895, 718, -1117, -2419, 154, 6652, 12330, 12114, 6205, -149, -2424, -982, 784, 854, -25, -437, -172, 126, 120, -3, -40, -11, 5},
+  {4, -13, -40, 3, 127, 117, -195, -436, 23, 892, 722, -1109, -2420, 134, 6624, 12317, 12128, 6233, -131, -2424, -990, 780, 857, -22, -437, -174, 126, 121, -3, -40, -11, 5},
+  {4, -13, -40, 2, 126, 118, -193, -436, 19, 890, 727, -1100, -2421, 115, 6596, 12304, 12142, 6261, -112, -2424, -999, 776, 859, -19, -437, -175, 125, 121, -2, -40, -11, 5},
+  {4, -12, -40, 2, 126, 118, -192, -436, 16, 887, 731, -1092, -2421, 95, 6568, 12292, 12156, 6289, -94, -2424, -1007, 772, 862, -16, -437, -177, 124, 122, -2, -40, -11, 5},
+  {4, -12, -40, 2, 126, 119, -190, -437, 13, 885, 735, -1083, -2422, 76, 6540, 12277, 12170, 6317, -75, -2424, -1016, 768, 865, -13, -437, -178, 124, 122, -2, -40, -11, 5},
+  {4, -12, -40, 1, 125, 120, -189, -437, 10, 882, 740, -1075, -2422, 57, 6512, 12266, 12184, 6344, -56, -2424, -1024, 764, 867, -10, -437, -180, 123, 122, -1, -40, -11, 5},
+  {4, -12, -40, 1, 125, 120, -187, -437, 6, 880, 744, -1067, -2423, 38, 6484, 12254, 12198, 6372, -38, -2424, -1033, 760, 870, -6, -437, -181, 123, 123, -1, -40, -12, 4},
+  {4, -12, -40, 0, 124, 121, -186, -437, 3, 877, 748, -1058, -2423, 19, 6456, 12243, 12211, 6400, -19, -2424, -1041, 756, 872, -3, -437, -183, 122, 123, 0, -40, -12, 4},
+  {4, -12, -40, 0, 124, 121, -184, -437, 0, 875, 752, -1050, -2423, 0, 6428, 12227, 12225, 6428, 0, -2423, -1050, 752, 875, 0, -437, -184, 121, 124, 0, -40, -12, 4},
+  {4, -12, -40, 0, 123, 122, -183, -437, -3, 872, 756, -1041, -2424, -19, 6400, 12211, 12243, 6456, 19, -2423, -1058, 748, 877, 3, -437, -186, 121, 124, 0, -40, -12, 4},
+  {4, -12, -40, -1, 123, 123, -181, -437, -6, 870, 760, -1033, -2424, -38, 6372, 12198, 12254, 6484, 38, -2423, -1067, 744, 880, 6, -437, -187, 120, 125, 1, -40, -12, 4},
+  {5, -11, -40, -1, 122, 123, -180, -437, -10, 867, 764, -1024, -2424, -56, 6344, 12184, 12266, 6512, 57, -2422, -1075, 740, 882, 10, -437, -189, 120, 125, 1, -40, -12, 4},
+  {5, -11, -40, -2, 122, 124, -178, -437, -13, 865, 768, -1016, -2424, -75, 6317, 12170, 12277, 6540, 76, -2422, -1083, 735, 885, 13, -437, -190, 119, 126, 2, -40, -12, 4},
+  {5, -11, -40, -2, 122, 124, -177, -437, -16, 862, 772, -1007, -2424, -94, 6289, 12156, 12292, 6568, 95, -2421, -1092, 731, 887, 16, -436, -192, 118, 126, 2, -40, -12, 4},
+  {5, -11, -40, -2, 121, 125, -175, -437, -19, 859, 776, -999, -2424, -112, 6261, 12142, 12304, 6596, 115, -2421, -1100, 727, 890, 19, -436, -193, 118, 126, 2, -40, -13, 4},
+  {5, -11, -40, -3, 121, 126, -174, -437, -22, 857, 780, -990, -2424, -131, 6233, 12128, 12317, 6624, 134, -2420, -1109, 722, 892, 23, -436, -195, 117, 127, 3, -40, -13, 4},
+  {5, -11, -40, -3, 120, 126, -172, -437, -25, 854, 784, -982, -2424, -149, 6205, 12114, 12330, 6652, 154, -2419, -1117, 718, 895, 26, -436, -197, 116, 127, 3, -40, -13, 4},
+  {5, -11, -40, -3, 120, 127, -171, -437, -29, 851, 788, -973, -2424, -167, 6177, 12100, 12342, 6680, 173, -2418, -1126, 714, 897, 29, -436, -198, 116, 128, 3, -40, -13, 4},
+  {5, -11, -40, -4, 119, 127, -169, -437, -32, 849, 792, -965, -2423, -186, 6148, 12085, 12358, 6707, 193, -2417, -1134, 709, 899, 33, -436, -200, 115, 128, 4, -40, -13, 4},
+  {5, -11, -39, -4, 119, 128, -167, -437, -35, 846, 795, -956, -2423, -204, 6120, 12071, 12368, 6735, 212, -2416, -1143, 705, 902, 36, -435, -201, 114, 128, 4, -40, -13, 4},
+  {5, -10, -39, -4, 118, 128, -166, -437, -38, 843, 799, -947, -2423, -222, 6092, 12056, 12379, 6763, 232, -2415, -1151, 701, 904, 39, -435, -203, 114, 129, 5, -40, -13, 4},
+  {5, -10, -39, -5, 118, 129, -164, -437, -41, 841, 803, -939, -2422, -240, 6064, 12041, 12390, 6791, 252, -2414, -1159, 696, 906, 43, -435, -204, 113, 129, 5, -40, -13, 4},
+  {5, -10, -39, -5, 118, 130, -163, -437, -44, 838, 807, -930, -2422, -258, 6036, 12026, 12404, 6819, 271, -2413, -1168, 692, 909, 46, -435, -206, 112, 130, 5, -40, -14, 4},
+  {5, -10, -39, -5, 117, 130, -161, -437, -47, 835, 810, -922, -2421, -276, 6008, 12012, 12417, 6846, 291, -2412, -1176, 687, 911, 49, -435, -207, 112, 130, 6, -40, -14, 4},
+  {5, -10, -39, -6, 117, 131, -160, -437, -50, 832, 814, -913, -2420, -294, 5980, 11997, 12430, 6874, 311, -2411, -1185, 682, 913, 53, -434, -209, 111, 130, 6, -40, -14, 4},
+  {5, -10, -39, -6, 116, 131, -158, -436, -53, 830, 818, -905, -2420, -312, 5952, 11982, 12439, 6902, 331, -2409, -1193, 678, 916, 56, -434, -210, 110, 131, 7, -41, -14, 4},
+  {5, -10, -39, -7, 116, 132, -157, -436, -56, 827, 821, -896, -2419, -329, 5924, 11966, 12453, 6930, 351, -2408, -1201, 673, 918, 59, -434, -212, 110, 131, 7, -41, -14, 4},
+  {5, -10, -39, -7, 115, 132, -155, -436, -60, 824, 825, -888, -2418, -347, 5896, 11951, 12464, 6957, 372, -2406, -1210, 669, 920, 63, -433, -213, 109, 132, 7, -41, -14, 4},
+  {5, -10, -39, -7, 115, 133, -154, -436, -63, 821, 828, -879, -2417, -364, 5868, 11936, 12476, 6985, 392, -2405, -1218, 664, 922, 66, -433, -215, 108, 132, 8, -41, -14, 4},
+  {5, -9, -39, -8, 114, 133, -152, -436, -66, 818, 832, -871, -2416, -382, 5840, 11920, 12491, 7013, 412, -2403, -1227, 659, 924, 69, -433, -216, 107, 132, 8, -41, -14, 4},
+  {5, -9, -39, -8, 114, 134, -151, -436, -69, 816, 835, -862, -2415, -399, 5812, 11905, 12498, 7040, 432, -2401, -1235, 654, 927, 73, -432, -218, 107, 133, 9, -41, -15, 4},
+  {5, -9, -39, -8, 113, 134, -149, -435, -72, 813, 839, -854, -2414, -417, 5784, 11889, 12510, 7068, 453, -2400, -1243, 650, 929, 76, -432, -219, 106, 133, 9, -41, -15, 4},
+  {5, -9, -39, -9, 113, 135, -148, -435, -75, 810, 842, -845, -2413, -434, 5756, 11873, 12522, 7096, 473, -2398, -1252, 645, 931, 80, -432, -221, 105, 134, 10, -41, -15, 4},
+  {5, -9, -39, -9, 112, 135, -146, -435, -78, 807, 845, -837, -2412, -451, 5728, 11858, 12534, 7123, 494, -2396, -1260, 640, 933, 83, -431, -222, 104, 134, 10, -41, -15, 4},
+  {5, -9, -39, -9, 112, 136, -145, -435, -81, 804, 849, -828, -2411, -468, 5700, 11842, 12544, 7151, 515, -2394, -1268, 635, 935, 86, -431, -224, 104, 134, 10, -41, -15, 4},
+  {5, -9, -39, -10, 111, 136, -143, -435, -84, 801, 852, -820, -2409, -485, 5672, 11826, 12555, 7179, 535, -2392, -1276, 630, 937, 90, -431, -225, 103, 135, 11, -41, -15, 4},
+  {5, -9, -38, -10, 111, 137, -141, -434, -87, 798, 855, -811, -2408, -502, 5644, 11810, 12565, 7206, 556, -2390, -1285, 625, 939, 93, -430, -227, 102, 135, 11, -41, -15, 4},
+  {5, -9, -38, -10, 110, 137, -140, -434, -89, 795, 859, -803, -2407, -519, 5616, 11794, 12574, 7234, 577, -2388, -1293, 620, 941, 97, -430, -228, 101, 136, 12, -41, -15, 4},
+  {5, -8, -38, -11, 110, 137, -138, -434, -92, 792, 862, -794, -2405, -536, 5588, 11777, 12586, 7261, 598, -2386, -1301, 615, 943, 100, -429, -230, 101, 136, 12, -41, -16, 4},
+  {5, -8, -38, -11, 110, 138, -137, -434, -95, 789, 865, -786, -2404, -553, 5560, 11761, 12596, 7289, 619, -2383, -1310, 610, 945, 104, -429, -231, 100, 136, 13, -41, -16, 4},
+  {5, -8, -38, -11, 109, 138, -135, -433, -98, 786, 868, -777, -2402, -569, 5532, 11744, 12606, 7316, 640, -2381, -1318, 605, 947, 107, -428, -233, 99, 137, 13, -41, -16, 4},
+  {5, -8, -38, -12, 109, 139, -134, -433, -101, 783, 871, -768, -2401, -586, 5504, 11728, 12616, 7344, 661, -2378, -1326, 600, 949, 111, -428, -234, 98, 137, 13, -41, -16, 4},
+  {5, -8, -38, -12, 108, 139, -132, -433, -104, 780, 874, -760, -2399, -603, 5476, 11711, 12630, 7371, 682, -2376, -1334, 595, 951, 114, -428, -236, 97, 137, 14, -41, -16, 4},
+  {5, -8, -38, -12, 108, 140, -131, -432, -107, 777, 878, -751, -2397, -619, 5448, 11695, 12632, 7399, 703, -2373, -1342, 590, 953, 118, -427, -237, 97, 138, 14, -41, -16, 4},
+  {5, -8, -38, -13, 107, 140, -129, -432, -110, 774, 881, -743, -2395, -636, 5420, 11678, 12648, 7426, 724, -2371, -1351, 585, 955, 121, -427, -239, 96, 138, 15, -41, -16, 4},
+  {5, -8, -38, -13, 107, 140, -128, -432, -113, 771, 884, -734, -2393, -652, 5392, 11661, 12657, 7453, 745, -2368, -1359, 580, 957, 125, -426, -240, 95, 138, 15, -41, -16, 4},
+  {5, -8, -38, -13, 106, 141, -126, -431, -116, 768, 887, -726, -2392, -668, 5364, 11644, 12666, 7481, 767, -2365, -1367, 574, 959, 128, -425, -242, 94, 139, 16, -41, -17, 4},
+  {5, -7, -38, -13, 106, 141, -125, -431, -118, 765, 890, -717, -2390, -684, 5336, 11627, 12675, 7508, 788, -2362, -1375, 569, 960, 132, -425, -243, 93, 139, 16, -41, -17, 4},
+  {5, -7, -38, -14, 105, 142, -123, -431, -121, 762, 892, -709, -2388, -700, 5308, 11610, 12687, 7535, 810, -2360, -1383, 564, 962, 135, -424, -245, 93, 139, 16, -41, -17, 4},
+  {5, -7, -38, -14, 105, 142, -122, -430, -124, 759, 895, -701, -2385, -716, 5280, 11593, 12693, 7563, 831, -2357, -1391, 559, 964, 139, -424, -246, 92, 140, 17, -41, -17, 4},
+  {5, -7, -37, -14, 104, 142, -120, -430, -127, 756, 898, -692, -2383, -732, 5252, 11575, 12704, 7590, 853, -2354, -1399, 553, 966, 142, -423, -248, 91, 140, 17, -41, -17, 4},
+  {5, -7, -37, -15, 104, 143, -119, -429, -130, 753, 901, -684, -2381, -748, 5224, 11558, 12713, 7617, 875, -2350, -1408, 548, 967, 146, -423, -249, 90, 140, 18, -41, -17, 4},
+  {5, -7, -37, -15, 103, 143, -117, -429, -132, 749, 904, -675, -2379, -764, 5196, 11540, 12724, 7644, 896, -2347, -1416, 543, 969, 149, -422, -251, 89, 141, 18, -41, -17, 4},
+  {5, -7, -37, -15, 103, 144, -116, -429, -135, 746, 907, -667, -2377, -780, 5168, 11523, 12732, 7671, 918, -2344, -1424, 537, 971, 153, -421, -252, 88, 141, 19, -41, -17, 4},
+  {5, -7, -37, -16, 102, 144, -114, -428, -138, 743, 909, -658, -2374, -795, 5140, 11505, 12742, 7699, 940, -2341, -1432, 532, 973, 156, -421, -254, 88, 141, 19, -41, -18, 4},
+  {5, -7, -37, -16, 102, 144, -113, -428, -141, 740, 912, -650, -2372, -811, 5112, 11488, 12750, 7726, 962, -2337, -1440, 526, 974, 160, -420, -255, 87, 142, 20, -41, -18, 4},
+  {5, -7, -37, -16, 101, 145, -111, -427, -143, 737, 915, -641, -2369, -827, 5084, 11470, 12757, 7753, 984, -2334, -1448, 521, 976, 163, -419, -257, 86, 142, 20, -41, -18, 4},
+  {5, -6, -37, -16, 101, 145, -110, -427, -146, 734, 917, -633, -2367, -842, 5056, 11452, 12766, 7780, 1006, -2330, -1456, 515, 978, 167, -419, -258, 85, 142, 20, -40, -18, 4},
+  {5, -6, -37, -17, 100, 145, -108, -426, -149, 730, 920, -624, -2364, -857, 5028, 11434, 12775, 7807, 1028, -2327, -1464, 510, 979, 170, -418, -260, 84, 143, 21, -40, -18, 4},
+  {5, -6, -37, -17, 100, 146, -107, -426, -152, 727, 923, -616, -2362, -873, 5000, 11416, 12784, 7834, 1050, -2323, -1472, 504, 981, 174, -417, -261, 83, 143, 21, -40, -18, 4},
+  {5, -6, -37, -17, 99, 146, -105, -425, -154, 724, 925, -608, -2359, -888, 4972, 11398, 12793, 7861, 1072, -2319, -1480, 499, 982, 178, -417, -263, 82, 143, 22, -40, -18, 3},
+  {5, -6, -37, -18, 99, 146, -104, -425, -157, 721, 928, -599, -2356, -903, 4945, 11379, 12801, 7888, 1095, -2316, -1488, 493, 984, 181, -416, -264, 81, 144, 22, -40, -18, 3},
+  {5, -6, -36, -18, 98, 147, -102, -424, -160, 718, 930, -591, -2354, -918, 4917, 11361, 12809, 7915, 1117, -2312, -1496, 487, 985, 185, -415, -265, 80, 144, 23, -40, -19, 3},
+  {5, -6, -36, -18, 98, 147, -101, -424, -162, 714, 933, -582, -2351, -933, 4889, 11343, 12816, 7942, 1139, -2308, -1504, 482, 987, 188, -414, -267, 80, 144, 23, -40, -19, 3},
+  {5, -6, -36, -18, 97, 147, -99, -423, -165, 711, 935, -574, -2348, -948, 4861, 11324, 12825, 7968, 1162, -2304, -1512, 476, 988, 192, -414, -268, 79, 145, 24, -40, -19, 3},
+  {5, -6, -36, -19, 97, 148, -98, -423, -168, 708, 937, -566, -2345, -963, 4833, 11306, 12834, 7995, 1184, -2300, -1519, 470, 990, 196, -413, -270, 78, 145, 24, -40, -19, 3},
+  {5, -6, -36, -19, 96, 148, -96, -422, -170, 705, 940, -557, -2342, -978, 4805, 11287, 12840, 8022, 1207, -2296, -1527, 464, 991, 199, -412, -271, 77, 145, 25, -40, -19, 3},
+  {5, -6, -36, -19, 96, 148, -95, -422, -173, 701, 942, -549, -2339, -992, 4778, 11268, 12847, 8049, 1230, -2291, -1535, 459, 993, 203, -411, -273, 76, 145, 25, -40, -19, 3},
+  {5, -5, -36, -20, 95, 149, -93, -421, -175, 698, 944, -540, -2336, -1007, 4750, 11249, 12855, 8076, 1252, -2287, -1543, 453, 994, 206, -411, -274, 75, 146, 25, -40, -19, 3},
+  {5, -5, -36, -20, 95, 149, -92, -421, -178, 695, 947, -532, -2333, -1021, 4722, 11231, 12864, 8102, 1275, -2283, -1551, 447, 995, 210, -410, -276, 74, 146, 26, -40, -20, 3},
+  {5, -5, -36, -20, 94, 149, -91, -420, -181, 691, 949, -524, -2330, -1036, 4694, 11212, 12873, 8129, 1298, -2278, -1559, 441, 997, 214, -409, -277, 73, 146, 26, -40, -20, 3},
+  {5, -5, -36, -20, 94, 149, -89, -419, -183, 688, 951, -515, -2326, -1050, 4667, 11192, 12875, 8156, 1321, -2274, -1566, 435, 998, 217, -408, -278, 72, 147, 27, -40, -20, 3},
+  {5, -5, -36, -21, 93, 150, -88, -419, -186, 685, 953, -507, -2323, -1065, 4639, 11173, 12888, 8182, 1343, -2269, -1574, 429, 999, 221, -407, -280, 71, 147, 27, -40, -20, 3},
+  {4, -5, -35, -21, 92, 150, -86, -418, -188, 681, 956, -499, -2320, -1079, 4611, 11154, 12893, 8209, 1366, -2264, -1582, 423, 1001, 224, -406, -281, 70, 147, 28, -40, -20, 3},
+  {4, -5, -35, -21, 92, 150, -85, -417, -191, 678, 958, -490, -2316, -1093, 4584, 11135, 12900, 8235, 1389, -2260, -1590, 417, 1002, 228, -405, -283, 69, 147, 28, -40, -20, 3},
+  {4, -5, -35, -21, 91, 150, -83, -417, -193, 675, 960, -482, -2313, -1107, 4556, 11115, 12904, 8262, 1413, -2255, -1597, 411, 1003, 232, -404, -284, 68, 148, 29, -40, -20, 3},
+  {4, -5, -35, -22, 91, 151, -82, -416, -196, 671, 962, -474, -2310, -1121, 4528, 11096, 12916, 8288, 1436, -2250, -1605, 405, 1004, 235, -404, -286, 67, 148, 29, -40, -20, 3},
+  {4, -5, -35, -22, 90, 151, -80, -416, -198, 668, 964, -466, -2306, -1135, 4501, 11077, 12920, 8315, 1459, -2245, -1613, 399, 1006, 239, -403, -287, 66, 148, 30, -40, -21, 3},
+  {4, -4, -35, -22, 90, 151, -79, -415, -201, 665, 966, -457, -2302, -1149, 4473, 11057, 12925, 8341, 1482, -2240, -1620, 393, 1007, 243, -402, -288, 65, 148, 30, -40, -21, 3},
+  {4, -4, -35, -22, 89, 151, -77, -414, -203, 661, 968, -449, -2299, -1163, 4445, 11037, 12934, 8367, 1505, -2235, -1628, 387, 1008, 246, -401, -290, 64, 149, 31, -40, -21, 3},
+  {4, -4, -35, -23, 89, 152, -76, -414, -206, 658, 970, -441, -2295, -1176, 4418, 11017, 12938, 8394, 1529, -2230, -1635, 381, 1009, 250, -400, -291, 63, 149, 31, -40, -21, 3},
+  {4, -4, -35, -23, 88, 152, -75, -413, -208, 654, 972, -433, -2291, -1190, 4390, 10998, 12946, 8420, 1552, -2225, -1643, 375, 1010, 254, -399, -293, 62, 149, 32, -40, -21, 3},
+  {4, -4, -35, -23, 88, 152, -73, -412, -211, 651, 974, -424, -2288, -1204, 4363, 10978, 12950, 8446, 1576, -2219, -1651, 369, 1011, 257, -398, -294, 61, 149, 32, -39, -21, 3},
+  {4, -4, -34, -23, 87, 152, -72, -411, -213, 647, 975, -416, -2284, -1217, 4335, 10958, 12954, 8473, 1599, -2214, -1658, 363, 1012, 261, -397, -295, 60, 150, 33, -39, -21, 3},
+  {4, -4, -34, -24, 87, 153, -70, -411, -216, 644, 977, -408, -2280, -1230, 4308, 10938, 12960, 8499, 1623, -2208, -1666, 356, 1013, 265, -396, -297, 59, 150, 33, -39, -21, 3},
+  {4, -4, -34, -24, 86, 153, -69, -410, -218, 641, 979, -400, -2276, -1244, 4280, 10918, 12968, 8525, 1646, -2203, -1673, 350, 1014, 268, -395, -298, 58, 150, 34, -39, -22, 3},
+  {4, -4, -34, -24, 86, 153, -67, -409, -220, 637, 981, -391, -2272, -1257, 4253, 10897, 12971, 8551, 1670, -2197, -1681, 344, 1015, 272, -394, -299, 57, 150, 34, -39, -22, 3},
+  {4, -4, -34, -24, 85, 153, -66, -408, -223, 634, 983, -383, -2268, -1270, 4225, 10877, 12976, 8577, 1694, -2192, -1688, 337, 1016, 276, -392, -301, 56, 151, 35, -39, -22, 3},
+  {4, -4, -34, -25, 85, 153, -65, -408, -225, 630, 984, -375, -2264, -1283, 4198, 10857, 12984, 8603, 1717, -2186, -1695, 331, 1017, 279, -391, -302, 55, 151, 35, -39, -22, 3},
+  {4, -4, -34, -25, 84, 154, -63, -407, -227, 627, 986, -367, -2260, -1296, 4171, 10836, 12988, 8629, 1741, -2180, -1703, 325, 1018, 283, -390, -304, 54, 151, 36, -39, -22, 2},
+  {4, -3, -34, -25, 84, 154, -62, -406, -230, 623, 988, -359, -2256, -1309, 4143, 10816, 12993, 8655, 1765, -2174, -1710, 318, 1019, 287, -389, -305, 53, 151, 36, -39, -22, 2},
+  {4, -3, -34, -25, 83, 154, -60, -405, -232, 620, 989, -351, -2252, -1322, 4116, 10795, 12998, 8681, 1789, -2168, -1718, 312, 1020, 290, -388, -306, 52, 151, 37, -39, -22, 2},
+  {4, -3, -33, -26, 83, 154, -59, -405, -234, 616, 991, -343, -2247, -1335, 4089, 10774, 13003, 8707, 1813, -2162, -1725, 306, 1021, 294, -387, -308, 51, 152, 37, -39, -23, 2},
+  {4, -3, -33, -26, 82, 154, -57, -404, -237, 613, 992, -334, -2243, -1348, 4061, 10754, 13010, 8732, 1837, -2156, -1732, 299, 1021, 298, -386, -309, 50, 152, 37, -39, -23, 2},
+  {4, -3, -33, -26, 82, 154, -56, -403, -239, 609, 994, -326, -2239, -1360, 4034, 10733, 13012, 8758, 1861, -2150, -1739, 293, 1022, 302, -385, -310, 49, 152, 38, -39, -23, 2},
+  {4, -3, -33, -26, 81, 155, -55, -402, -241, 606, 995, -318, -2234, -1373, 4007, 10712, 13018, 8784, 1885, -2144, -1747, 286, 1023, 305, -383, -312, 48, 152, 38, -39, -23, 2},
+  {4, -3, -33, -27, 80, 155, -53, -401, -244, 602, 997, -310, -2230, -1385, 3980, 10691, 13020, 8810, 1909, -2137, -1754, 280, 1024, 309, -382, -313, 47, 152, 39, -38, -23, 2},
+  {4, -3, -33, -27, 80, 155, -52, -401, -246, 599, 998, -302, -2226, -1398, 3952, 10670, 13027, 8835, 1934, -2131, -1761, 273, 1024, 313, -381, -314, 46, 153, 39, -38, -23, 2},
+  {4, -3, -33, -27, 79, 155, -50, -400, -248, 595, 1000, -294, -2221, -1410, 3925, 10649, 13030, 8861, 1958, -2124, -1768, 266, 1025, 316, -380, -316, 45, 153, 40, -38, -23, 2},
+  {4, -3, -33, -27, 79, 155, -49, -399, -250, 592, 1001, -286, -2217, -1422, 3898, 10628, 13035, 8886, 1982, -2118, -1775, 260, 1026, 320, -379, -317, 43, 153, 40, -38, -23, 2},
+  {4, -3, -33, -27, 78, 155, -48, -398, -252, 588, 1003, -278, -2212, -1435, 3871, 10606, 13040, 8912, 2007, -2111, -1783, 253, 1026, 324, -377, -318, 42, 153, 41, -38, -24, 2},
+  {4, -3, -32, -28, 78, 155, -46, -397, -255, 585, 1004, -270, -2207, -1447, 3844, 10585, 13044, 8937, 2031, -2104, -1790, 247, 1027, 327, -376, -320, 41, 153, 41, -38, -24, 2},
+  {4, -2, -32, -28, 77, 156, -45, -396, -257, 581, 1005, -262, -2203, -1459, 3817, 10564, 13046, 8963, 2055, -2098, -1797, 240, 1028, 331, -375, -321, 40, 154, 42, -38, -24, 2},
+  {4, -2, -32, -28, 77, 156, -44, -395, -259, 577, 1006, -254, -2198, -1471, 3790, 10542, 13051, 8988, 2080, -2091, -1804, 233, 1028, 335, -374, -322, 39, 154, 42, -38, -24, 2},
+  {4, -2, -32, -28, 76, 156, -42, -395, -261, 574, 1008, -246, -2193, -1483, 3763, 10521, 13051, 9013, 2105, -2084, -1811, 227, 1029, 339, -372, -324, 38, 154, 43, -38, -24, 2},
+  {4, -2, -32, -28, 76, 156, -41, -394, -263, 570, 1009, -238, -2188, -1494, 3736, 10499, 13056, 9039, 2129, -2077, -1818, 220, 1029, 342, -371, -325, 37, 154, 43, -38, -24, 2},
+  {4, -2, -32, -29, 75, 156, -39, -393, -265, 567, 1010, -230, -2184, -1506, 3709, 10478, 13059, 9064, 2154, -2070, -1825, 213, 1030, 346, -370, -326, 36, 154, 44, -38, -24, 2},
+  {4, -2, -32, -29, 75, 156, -38, -392, -268, 563, 1011, -222, -2179, -1518, 3682, 10456, 13064, 9089, 2179, -2063, -1832, 206, 1030, 350, -368, -327, 35, 154, 44, -37, -25, 2},
+  {4, -2, -32, -29, 74, 156, -37, -391, -270, 560, 1012, -214, -2174, -1529, 3655, 10434, 13069, 9114, 2203, -2055, -1839, 199, 1031, 353, -367, -329, 33, 154, 45, -37, -25, 2},
+  {4, -2, -32, -29, 74, 156, -35, -390, -272, 556, 1013, -207, -2169, -1541, 3628, 10412, 13070, 9139, 2228, -2048, -1845, 193, 1031, 357, -366, -330, 32, 155, 46, -37, -25, 2},
+  {4, -2, -31, -29, 73, 156, -34, -389, -274, 552, 1015, -199, -2164, -1552, 3601, 10390, 13073, 9164, 2253, -2041, -1852, 186, 1031, 361, -364, -331, 31, 155, 46, -37, -25, 1},
+  {4, -2, -31, -30, 73, 156, -33, -388, -276, 549, 1016, -191, -2159, -1564, 3574, 10368, 13076, 9189, 2278, -2033, -1859, 179, 1032, 365, -363, -333, 30, 155, 47, -37, -25, 1},
+  {4, -2, -31, -30, 72, 157, -31, -387, -278, 545, 1017, -183, -2154, -1575, 3547, 10346, 13079, 9214, 2303, -2026, -1866, 172, 1032, 368, -361, -334, 29, 155, 47, -37, -25, 1},
+  {4, -2, -31, -30, 72, 157, -30, -386, -280, 542, 1018, -175, -2148, -1586, 3521, 10324, 13078, 9239, 2328, -2018, -1873, 165, 1032, 372, -360, -335, 28, 155, 48, -37, -25, 1},
+  {4, -2, -31, -30, 71, 157, -29, -385, -282, 538, 1018, -167, -2143, -1597, 3494, 10302, 13080, 9264, 2353, -2010, -1879, 158, 1033, 376, -358, -336, 27, 155, 48, -37, -25, 1},
+  {4, -1, -31, -30, 70, 157, -27, -384, -284, 534, 1019, -160, -2138, -1608, 3467, 10279, 13088, 9289, 2378, -2003, -1886, 151, 1033, 379, -357, -338, 25, 155, 49, -37, -26, 1},
+  {4, -1, -31, -31, 70, 157, -26, -383, -286, 531, 1020, -152, -2133, -1619, 3441, 10257, 13089, 9314, 2403, -1995, -1893, 144, 1033, 383, -356, -339, 24, 156, 49, -37, -26, 1},
+  {4, -1, -31, -31, 69, 157, -25, -382, -288, 527, 1021, -144, -2128, -1630, 3414, 10235, 13090, 9338, 2428, -1987, -1899, 137, 1033, 387, -354, -340, 23, 156, 50, -36, -26, 1},
+  {4, -1, -30, -31, 69, 157, -23, -381, -290, 523, 1022, -136, -2122, -1641, 3387, 10212, 13090, 9363, 2453, -1979, -1906, 130, 1034, 391, -353, -341, 22, 156, 50, -36, -26, 1},
+  {4, -1, -30, -31, 68, 157, -22, -380, -292, 520, 1023, -129, -2117, -1652, 3361, 10190, 13092, 9387, 2479, -1971, -1913, 123, 1034, 394, -351, -342, 21, 156, 51, -36, -26, 1},
+  {4, -1, -30, -31, 68, 157, -21, -379, -294, 516, 1024, -121, -2111, -1662, 3334, 10167, 13094, 9412, 2504, -1963, -1919, 116, 1034, 398, -350, -344, 20, 156, 51, -36, -26, 1},
+  {4, -1, -30, -31, 67, 157, -19, -378, -296, 512, 1024, -113, -2106, -1673, 3308, 10144, 13098, 9436, 2529, -1955, -1926, 109, 1034, 402, -348, -345, 18, 156, 52, -36, -26, 1},
+  {4, -1, -30, -32, 67, 157, -18, -377, -298, 509, 1025, -106, -2101, -1683, 3281, 10122, 13099, 9461, 2555, -1946, -1932, 102, 1034, 405, -347, -346, 17, 156, 52, -36, -26, 1},
+  {4, -1, -30, -32, 66, 157, -17, -376, -300, 505, 1026, -98, -2095, -1694, 3255, 10099, 13102, 9485, 2580, -1938, -1939, 95, 1034, 409, -345, -347, 16, 156, 53, -36, -27, 1},
+  {4, -1, -30, -32, 66, 157, -15, -375, -302, 501, 1026, -90, -2089, -1704, 3228, 10076, 13103, 9510, 2605, -1930, -1945, 87, 1034, 413, -343, -348, 15, 156, 53, -36, -27, 1},
+  {4, -1, -30, -32, 65, 157, -14, -374, -304, 498, 1027, -83, -2084, -1714, 3202, 10053, 13104, 9534, 2631, -1921, -1952, 80, 1034, 417, -342, -350, 14, 156, 54, -35, -27, 1},
+  {4, -1, -30, -32, 65, 157, -13, -373, -306, 494, 1028, -75, -2078, -1725, 3176, 10030, 13105, 9558, 2657, -1912, -1958, 73, 1034, 420, -340, -351, 12, 156, 54, -35, -27, 1},
+  {4, -1, -29, -32, 64, 157, -11, -372, -307, 490, 1028, -67, -2073, -1735, 3149, 10007, 13105, 9582, 2682, -1904, -1964, 66, 1034, 424, -339, -352, 11, 157, 55, -35, -27, 1},
+  {4, -1, -29, -33, 64, 157, -10, -371, -309, 487, 1029, -60, -2067, -1745, 3123, 9984, 13106, 9606, 2708, -1895, -1971, 59, 1034, 428, -337, -353, 10, 157, 55, -35, -27, 0},
+  {4, 0, -29, -33, 63, 157, -9, -370, -311, 483, 1029, -52, -2061, -1755, 3097, 9961, 13107, 9630, 2733, -1886, -1977, 51, 1034, 431, -335, -354, 9, 157, 56, -35, -27, 0},
+  {4, 0, -29, -33, 63, 157, -8, -369, -313, 479, 1030, -45, -2055, -1765, 3071, 9938, 13108, 9654, 2759, -1877, -1983, 44, 1034, 435, -334, -355, 7, 157, 56, -35, -27, 0},
+  {4, 0, -29, -33, 62, 157, -6, -368, -315, 476, 1030, -37, -2049, -1774, 3044, 9914, 13108, 9678, 2785, -1868, -1989, 37, 1034, 439, -332, -357, 6, 157, 57, -35, -28, 0},
+  {4, 0, -29, -33, 62, 157, -5, -367, -316, 472, 1031, -30, -2044, -1784, 3018, 9891, 13108, 9702, 2811, -1859, -1995, 29, 1033, 443, -330, -358, 5, 157, 57, -34, -28, 0},
+  {4, 0, -29, -33, 61, 157, -4, -366, -318, 468, 1031, -22, -2038, -1794, 2992, 9868, 13111, 9726, 2836, -1850, -2002, 22, 1033, 446, -329, -359, 4, 157, 58, -34, -28, 0},
+  {4, 0, -29, -34, 60, 157, -3, -365, -320, 465, 1032, -15, -2032, -1803, 2966, 9844, 13111, 9750, 2862, -1841, -2008, 15, 1033, 450, -327, -360, 3, 157, 58, -34, -28, 0},
+  {4, 0, -28, -34, 60, 157, -1, -363, -322, 461, 1032, -7, -2026, -1813, 2940, 9821, 13109, 9773, 2888, -1832, -2014, 7, 1033, 454, -325, -361, 1, 157, 59, -34, -28, 0},
+  {0, 0, -28, -34, 59, 157, 0, -362, -324, 457, 1032, 0, -2020, -1823, 2915, 9798, 13114, 9798, 2915, -1823, -2020, 0, 1032, 457, -324, -362, 0, 157, 59, -34, -28, 0},
+};
+
+const int16_t* const RESAMPLE_TABLES[4] = {&RESAMPLE_TABLE_0[0][0], &RESAMPLE_TABLE_1[0][0], &RESAMPLE_TABLE_2[0][0], &RESAMPLE_TABLE_3[0][0]};
@@ -0,0 +1,145 @@
+/**
+ * 描画が毎フレームの消去円（GLASS_CLEAR_RADIUS の fillCircle）からはみ出さないこと
+ *
+ * 消去円の外はゲージが差分で描くだけで誰も消さないので、はみ出した画素は
+ * 残像として残り続ける。OverdrawGfx の書き込み回数で、消去円の外に
+ * 1画素でも書いたら失敗にする（getBuffer() 越しの書き込みも countSpan で数える）。
+ *
+ * 実行: pio test -e native -f test_clear_disc
+ */
+
+#include "CrackDecal.h"
+#include "DustField.h"
+#include "GlassEngine.h"
+#include "GlassRaster.h"
+#include "GlassRenderer.h"
+#include "OverdrawGfx.h"
+#include "SessionInput.h"
+#include "SoftCanvas.h"
+#include "crack_decals.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+#include <unity.h>
+
+static const int PIXELS = SCREEN_WIDTH * SCREEN_HEIGHT;
+
+static std::vector<uint8_t> clearMask;   // 消去円が塗る画素
+
+void setUp() {
+  if (!clearMask.empty()) return;
+  clearMask.assign(PIXELS, 0);
+  rasterFillCircle(CENTER_X, CENTER_Y, GLASS_CLEAR_RADIUS, [](int x, int y, int len) {
+    for (int i = 0; i < len; i++) clearMask[y * SCREEN_WIDTH + x + i] = 1;
+  });
+}
+
+void tearDown() {}
+
+// 消去円の外に書いた画素の数（最初の1つを first に）
+static int countOutside(const uint8_t* counts, int& first) {
+  int outside = 0;
+  first = -1;
+  for (int i = 0; i < PIXELS; i++) {
+    if (counts[i] && !clearMask[i]) {
+      if (first < 0) first = i;
+      outside++;
+    }
+  }
+  return outside;
+}
+
+static int maxParticleSize(const GlassEngine& engine) {
+  int size = 0;
+  for (const DestructionProfile& pr : engine.profiles) size = pr.particleSizeMax > size ? pr.particleSizeMax : size;
+  return size;
+}
+
+// いちばん大きな破片を縁のすぐ内側から全方向へ外向きに飛ばし、跳ね返る間を描く
+void test_rim_bounce_stays_inside_clear_disc() {
+  GlassEngine engine(GlassConfig(), 7);
+  engine.reset(0);
+  engine.currentState = SHATTER;
+  engine.stateStartTime = 0;
+
+  // uniform(min, max) は max を含まないので、出てくる最大は particleSizeMax - 1
+  const float size = (float)(maxParticleSize(engine) - 1);
+  for (int i = 0; i < 64; i++) {
+    float a = i * 6.2831853f / 64;
+    Particle p = {};
+    p.x = CENTER_X + cosf(a) * (GLASS_RIM_RADIUS - 1.0f);
+    p.y = CENTER_Y + sinf(a) * (GLASS_RIM_RADIUS - 1.0f);
+    p.vx = cosf(a) * 6.0f;
+    p.vy = sinf(a) * 6.0f;
+    p.size = size;
+    p.alpha = 1.0f;
+    p.active = true;
+    engine.particles.push_back(p);
+  }
+
+  SoftCanvas canvas;
+  std::vector<uint8_t> counts(PIXELS);
+  OverdrawGfx<SoftCanvas> gfx(canvas, counts.data());
+  DustField dust(GLASS_DUST_RADIUS);
+  DecalLayer decals(CRACK_DECALS, GLASS_CLEAR_RADIUS);
+  GlassInput still = {0, BUTTON_NONE};
+  for (unsigned long t = 17; t <= 17 * 12; t += 17) {
+    engine.step(still, t);
+    gfx.beginFrame();
+    dust.prepare(engine);
+    renderGlass(gfx, engine, t, &dust, &decals);
+
+    int first;
+    int outside = countOutside(counts.data(), first);
+    if (outside) {
+      char message[96];
+      snprintf(message, sizeof(message), "%d px outside the clear disc at t=%lu, first (%d, %d)", outside, t,
+               first % SCREEN_WIDTH, first / SCREEN_WIDTH);
+      TEST_FAIL_MESSAGE(message);
+    }
+  }
+}
+
+// 合成入力のセッションで、縁の近くの破片の塗り円が消去円に収まっていること（描画はしない）
+void test_synthetic_sessions_keep_particles_inside_clear_disc() {
+  const float nearRim = GLASS_CLEAR_RADIUS - 8.0f;
+  for (uint32_t seed = 1; seed <= 40; seed++) {
+    Session session = makeSyntheticSession(seed, 60000, 17);
+    GlassEngine engine(GlassConfig(), session.seed);
+    engine.reset(session.startTime);
+    for (const SessionStep& step : session.steps) {
+      engine.step(step.input, step.time);
+      if (engine.currentState != SHATTER && engine.currentState != SILENCE && engine.currentState != REBUILD) continue;
+      for (const Particle& p : engine.particles) {
+        if (!p.active) continue;
+        float dx = p.x - CENTER_X, dy = p.y - CENTER_Y;
+        if (dx * dx + dy * dy < nearRim * nearRim) continue;
+        bool inside = true;
+        rasterFillCircle((int)p.x, (int)p.y, (int)p.size, [&](int x, int y, int len) {
+          for (int i = 0; i < len; i++) {
+            int px = x + i;
+            if ((unsigned)px >= (unsigned)SCREEN_WIDTH || (unsigned)y >= (unsigned)SCREEN_HEIGHT ||
+                !clearMask[y * SCREEN_WIDTH + px]) {
+              inside = false;
+            }
+          }
+        });
+        if (!inside) {
+          char message[128];
+          snprintf(message, sizeof(message), "seed %u t=%lu: particle at (%.1f, %.1f) size %.0f leaves the clear disc",
+                   seed, step.time, p.x, p.y, p.size);
+          TEST_FAIL_MESSAGE(message);
+        }
+      }
+    }
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_rim_bounce_stays_inside_clear_disc);
+  RUN_TEST(test_synthetic_sessions_keep_particles_inside_clear_disc);
+  return UNITY_END();
+}
@@ -0,0 +1,164 @@
+/**
+ * 12ビット出力の詰め込み（PanelPack444.h）が割り算で求めた 4-4-4 と1ビットも違わないこと
+ *
+ * RGB565 の全 65,536 色を、ディザなしと 4x4 のディザの全位置で詰めて比べる。
+ * 行の長さの端（ディザありは2画素単位、ディザなしは4画素単位）と、
+ * 詰めた範囲の外に書かないことも確かめる。速度は tools/pack444_bench.cpp。
+ *
+ * 実行: pio test -e native -f test_pack444
+ */
+
+#include "PanelPack444.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include <unity.h>
+
+static std::vector<uint16_t> allColors;   // 全色を4画素ずつ（ディザの4列がそろう）、バッファ形式
+
+static uint16_t stored(uint16_t c) { return (uint16_t)((c >> 8) | (c << 8)); }
+
+void setUp() {
+  if (!allColors.empty()) return;
+  allColors.resize(65536 * 4);
+  for (int c = 0; c < 65536; c++) {
+    for (int k = 0; k < 4; k++) allColors[c * 4 + k] = stored((uint16_t)c);
+  }
+}
+
+void tearDown() {}
+
+// 割り算で求める 4-4-4（bayer は 0 ~ 15、-1 でディザなし）
+static uint32_t reference444(uint16_t c, int bayer) {
+  int r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+  if (bayer >= 0) {
+    r += bayer >> 3;
+    g += bayer >> 2;
+    b += bayer >> 3;
+  }
+  r = r / 2 > 15 ? 15 : r / 2;
+  g = g / 4 > 15 ? 15 : g / 4;
+  b = b / 2 > 15 ? 15 : b / 2;
+  return (uint32_t)(r << 8 | g << 4 | b);
+}
+
+static uint32_t unpack444(const uint8_t* bytes, int index) {
+  const uint8_t* p = bytes + index / 2 * 3;
+  return index & 1 ? ((p[1] & 0x0F) << 8) | p[2] : (p[0] << 4) | (p[1] >> 4);
+}
+
+static void checkAgainstReference(const std::vector<uint8_t>& packed, int row, bool dithered) {
+  for (size_t i = 0; i < allColors.size(); i++) {
+    uint16_t c = (uint16_t)(i / 4);
+    uint32_t want = reference444(c, dithered ? PANEL_BAYER4[row][i & 3] : -1);
+    uint32_t got = unpack444(packed.data(), (int)i);
+    if (want != got) {
+      char message[96];
+      snprintf(message, sizeof(message), "color %04x (row %d, column %d): want %03x got %03x", c, row,
+               (int)(i & 3), (unsigned)want, (unsigned)got);
+      TEST_FAIL_MESSAGE(message);
+    }
+  }
+}
+
+void test_bytes_per_frame() {
+  TEST_ASSERT_EQUAL_UINT32(86400, panelPack444Bytes(240 * 240));
+  TEST_ASSERT_EQUAL_UINT32(6, panelPack444Bytes(4));
+}
+
+void test_truncate_single_pixel() {
+  TEST_ASSERT_EQUAL_HEX16(0x000, panelRgb444(0x0000));
+  TEST_ASSERT_EQUAL_HEX16(0xFFF, panelRgb444(0xFFFF));
+  TEST_ASSERT_EQUAL_HEX16(0xF00, panelRgb444(0xF800));
+  TEST_ASSERT_EQUAL_HEX16(0x0F0, panelRgb444(0x07E0));
+  TEST_ASSERT_EQUAL_HEX16(0x00F, panelRgb444(0x001F));
+  for (int c = 0; c < 65536; c++) {
+    if (panelRgb444((uint16_t)c) != reference444((uint16_t)c, -1)) {
+      char message[64];
+      snprintf(message, sizeof(message), "panelRgb444(%04x)", c);
+      TEST_FAIL_MESSAGE(message);
+    }
+  }
+}
+
+void test_plain_matches_reference_for_all_colors() {
+  std::vector<uint8_t> packed(panelPack444Bytes(allColors.size()));
+  panelPack444Row(allColors.data(), packed.data(), (int)allColors.size());
+  checkAgainstReference(packed, 0, false);
+}
+
+void test_dither_matches_reference_at_every_position() {
+  std::vector<uint8_t> packed(panelPack444Bytes(allColors.size()));
+  PanelDither444 dither;
+  for (int y = 0; y < 4; y++) {
+    panelPack444RowDither(allColors.data(), packed.data(), (int)allColors.size(), y, dither);
+    checkAgainstReference(packed, y, true);
+  }
+  // 模様は4行で繰り返す
+  std::vector<uint8_t> again(packed.size());
+  panelPack444RowDither(allColors.data(), again.data(), (int)allColors.size(), 7, dither);
+  panelPack444RowDither(allColors.data(), packed.data(), (int)allColors.size(), 3, dither);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(packed.data(), again.data(), packed.size());
+}
+
+// 4x4 の平均が元の色（4ビットの目盛り）から 1/2 目盛り以内（飽和する最上位の目盛りは除く）
+void test_dither_average_tracks_source() {
+  std::vector<uint8_t> packed(panelPack444Bytes(allColors.size()));
+  std::vector<float> sums(65536 * 3, 0.0f);
+  PanelDither444 dither;
+  for (int y = 0; y < 4; y++) {
+    panelPack444RowDither(allColors.data(), packed.data(), (int)allColors.size(), y, dither);
+    for (size_t i = 0; i < allColors.size(); i++) {
+      uint32_t v = unpack444(packed.data(), (int)i);
+      sums[i / 4 * 3 + 0] += (float)(v >> 8);
+      sums[i / 4 * 3 + 1] += (float)((v >> 4) & 0xF);
+      sums[i / 4 * 3 + 2] += (float)(v & 0xF);
+    }
+  }
+  for (int c = 0; c < 65536; c++) {
+    float exact[3] = {(c >> 11) / 2.0f, ((c >> 5) & 0x3F) / 4.0f, (c & 0x1F) / 2.0f};
+    for (int ch = 0; ch < 3; ch++) {
+      if (exact[ch] > 15.0f) continue;
+      TEST_ASSERT_FLOAT_WITHIN(0.5f, exact[ch], sums[c * 3 + ch] / 16.0f);
+    }
+  }
+}
+
+// 行の長さの端: 詰めるのは count 画素ぶんだけで、その先のバイトには触らない
+void test_rows_stop_at_count() {
+  const uint16_t row[8] = {stored(0xF800), stored(0x07E0), stored(0x001F), stored(0xFFFF),
+                           stored(0x8410), stored(0x0000), stored(0xFFFF), stored(0xFFFF)};
+  PanelDither444 dither;
+
+  // ディザなしは4画素単位
+  uint8_t plain[12];
+  memset(plain, 0xA5, sizeof(plain));
+  panelPack444Row(row, plain, 4);
+  const uint8_t plainWant[6] = {0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xFF};
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(plainWant, plain, 6);
+  for (int i = 6; i < 12; i++) TEST_ASSERT_EQUAL_HEX8(0xA5, plain[i]);
+
+  // ディザありは2画素単位（4の倍数でない幅）
+  uint8_t dithered[12];
+  memset(dithered, 0xA5, sizeof(dithered));
+  panelPack444RowDither(row, dithered, 6, 0, dither);
+  for (int i = 0; i < 6; i++) {
+    int bayer = PANEL_BAYER4[0][i & 3];
+    TEST_ASSERT_EQUAL_HEX16(reference444(stored(row[i]), bayer), unpack444(dithered, i));
+  }
+  for (int i = 9; i < 12; i++) TEST_ASSERT_EQUAL_HEX8(0xA5, dithered[i]);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_bytes_per_frame);
+  RUN_TEST(test_truncate_single_pixel);
+  RUN_TEST(test_plain_matches_reference_for_all_colors);
+  RUN_TEST(test_dither_matches_reference_at_every_position);
+  RUN_TEST(test_dither_average_tracks_source);
+  RUN_TEST(test_rows_stop_at_count);
+  return UNITY_END();
+}
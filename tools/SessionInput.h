@@ -0,0 +1,141 @@
+/**
+ * SessionInput - ホスト側ツール共通のセッション入力
+ *
+ * 端末の入力記録（-DGLASSDIAL_RECORD_INPUT のシリアルログ）の読み込みと、
+ * 人の操作を真似た合成入力の生成を行う。
+ *
+ * 記録形式（それ以外の行は無視するので、シリアルログをそのまま渡せる）:
+ *   SESSION,<開始時刻ms>,<シード>
+ *   IN,<時刻ms>,<回転量>,<ボタン 0=なし 1=短押し 2=長押し>
+ */
+#pragma once
+
+#include "GlassEngine.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct SessionStep {
+  unsigned long time;
+  GlassInput input;
+};
+
+struct Session {
+  std::string name;
+  uint32_t seed = 1;
+  unsigned long startTime = 0;
+  std::vector<SessionStep> steps;
+
+  unsigned long duration() const {
+    return steps.empty() ? 0 : steps.back().time - startTime;
+  }
+};
+
+// 入力記録ファイルを読み込む。IN行が1つもなければ false
+inline bool loadSession(const char* path, Session& session) {
+  FILE* f = fopen(path, "r");
+  if (!f) return false;
+
+  session = Session();
+  session.name = path;
+  bool haveStart = false;
+  char line[256];
+  while (fgets(line, sizeof(line), f)) {
+    // シリアルログの途中から始まる行もあるので行中の記録も拾う
+    char* rec = strstr(line, "SESSION,");
+    if (rec) {
+      unsigned long start = 0, seed = 0;
+      if (sscanf(rec, "SESSION,%lu,%lu", &start, &seed) == 2) {
+        session.startTime = start;
+        session.seed = (uint32_t)seed;
+        session.steps.clear();  // 再起動したら最新のセッションを使う
+        haveStart = true;
+      }
+      continue;
+    }
+    rec = strstr(line, "IN,");
+    if (!rec) continue;
+    unsigned long t = 0;
+    long delta = 0;
+    int button = 0;
+    if (sscanf(rec, "IN,%lu,%ld,%d", &t, &delta, &button) != 3) continue;
+    if (!haveStart) {
+      session.startTime = t;
+      haveStart = true;
+    }
+    SessionStep step;
+    step.time = t;
+    step.input.encoderDelta = (int32_t)delta;
+    step.input.button = (button == 1) ? BUTTON_PRESS : (button == 2 ? BUTTON_HOLD : BUTTON_NONE);
+    session.steps.push_back(step);
+  }
+  fclose(f);
+  return !session.steps.empty();
+}
+
+// ========================================
+// 合成入力（操作者モデル）
+// ========================================
+// 放置・勢いのある回転・ゆっくりした回転・逆回転・ボタンを
+// 確率的に切り替える。シードが同じなら同じ入力列になる。
+inline Session makeSyntheticSession(uint32_t seed, unsigned long durationMs, unsigned long frameMs) {
+  Session session;
+  session.name = "synthetic";
+  session.seed = seed;
+  session.startTime = 0;
+
+  GlassRandom rng(seed * 2654435761u + 1);
+  enum Behaviour { IDLE, SPIN, GRIND, REVERSE };
+  Behaviour behaviour = IDLE;
+  unsigned long behaviourEnd = 0;
+  int speed = 0;
+
+  for (unsigned long t = frameMs; t <= durationMs; t += frameMs) {
+    if (t >= behaviourEnd) {
+      long r = rng.uniform(100);
+      if (r < 30) {
+        behaviour = IDLE;
+        behaviourEnd = t + rng.uniform(300, 6000);
+      } else if (r < 60) {
+        behaviour = SPIN;
+        speed = (int)rng.uniform(2, 14);
+        behaviourEnd = t + rng.uniform(200, 2500);
+      } else if (r < 80) {
+        behaviour = GRIND;
+        behaviourEnd = t + rng.uniform(1000, 5000);
+      } else {
+        behaviour = REVERSE;
+        speed = (int)rng.uniform(1, 10);
+        behaviourEnd = t + rng.uniform(300, 3000);
+      }
+    }
+
+    SessionStep step;
+    step.time = t;
+    step.input.button = BUTTON_NONE;
+    switch (behaviour) {
+      case IDLE:
+        step.input.encoderDelta = 0;
+        break;
+      case SPIN:
+        step.input.encoderDelta = speed + (int32_t)rng.uniform(-1, 2);
+        break;
+      case GRIND:
+        step.input.encoderDelta = rng.uniform(4) == 0 ? 1 : 0;
+        break;
+      case REVERSE:
+        step.input.encoderDelta = -(speed + (int32_t)rng.uniform(-1, 2));
+        break;
+    }
+
+    long b = rng.uniform(10000);
+    if (b < 8) step.input.button = BUTTON_PRESS;
+    else if (b < 9) step.input.button = BUTTON_HOLD;
+
+    session.steps.push_back(step);
+  }
+  return session;
+}
@@ -0,0 +1,108 @@
+/**
+ * SoftCanvas - ホスト用の 240x240 RGB565 キャンバス
+ *
+ * GlassRenderer.h の描画先として M5Canvas の代わりに使う。
+ * 直線・円・塗り円は LovyanGFX と同じ整数アルゴリズム（include/GlassRaster.h）で描き、
+ * 画素は M5Canvas と同じビッグエンディアンRGB565で持つので、
+ * バッファのハッシュは端末のフレームストリームと突き合わせられる。
+ *
+ * 色の型の扱いも LovyanGFX に合わせる:
+ *   uint16_t / int → RGB565、uint32_t → RGB888
+ */
+#pragma once
+
+#include "GlassRaster.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+
+class SoftCanvas {
+public:
+  SoftCanvas(int width = 240, int height = 240)
+      : w(width), h(height), pixels(width * height, 0) {}
+
+  int width() const { return w; }
+  int height() const { return h; }
+  uint16_t* getBuffer() { return pixels.data(); }
+  const uint16_t* getBuffer() const { return pixels.data(); }
+
+  static uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+  }
+
+  // ビッグエンディアン格納値 → RGB565
+  uint16_t readPixel(int x, int y) const {
+    uint16_t v = pixels[y * w + x];
+    return (uint16_t)((v >> 8) | (v << 8));
+  }
+
+  template <typename T>
+  void fillScreen(T color) {
+    std::fill(pixels.begin(), pixels.end(), stored(color));
+  }
+
+  template <typename T>
+  void drawPixel(int x, int y, T color) {
+    plot(x, y, stored(color));
+  }
+
+  template <typename T>
+  void drawFastHLine(int x, int y, int len, T color) {
+    hline(x, y, len, stored(color));
+  }
+
+  template <typename T>
+  void fillRect(int x, int y, int rw, int rh, T color) {
+    uint16_t c = stored(color);
+    for (int j = 0; j < rh; j++) hline(x, y + j, rw, c);
+  }
+
+  template <typename T>
+  void drawLine(int x0, int y0, int x1, int y1, T color) {
+    uint16_t c = stored(color);
+    rasterLine(x0, y0, x1, y1, [&](int x, int y) { plot(x, y, c); });
+  }
+
+  template <typename T>
+  void drawCircle(int x, int y, int r, T color) {
+    uint16_t c = stored(color);
+    rasterCircle(x, y, r, [&](int hx, int hy, int len) { hline(hx, hy, len, c); },
+                 [&](int vx, int vy, int len) { vline(vx, vy, len, c); });
+  }
+
+  template <typename T>
+  void fillCircle(int x, int y, int r, T color) {
+    uint16_t c = stored(color);
+    rasterFillCircle(x, y, r, [&](int hx, int hy, int len) { hline(hx, hy, len, c); });
+  }
+
+private:
+  int w, h;
+  std::vector<uint16_t> pixels;
+
+  static uint16_t swap16(uint16_t v) { return (uint16_t)((v >> 8) | (v << 8)); }
+
+  static uint16_t stored(uint16_t c) { return swap16(c); }
+  static uint16_t stored(int c) { return swap16((uint16_t)c); }
+  static uint16_t stored(uint32_t c) {
+    return swap16(color565((c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF));
+  }
+
+  void plot(int x, int y, uint16_t c) {
+    if ((unsigned)x < (unsigned)w && (unsigned)y < (unsigned)h) pixels[y * w + x] = c;
+  }
+
+  void hline(int x, int y, int len, uint16_t c) {
+    if ((unsigned)y >= (unsigned)h || len <= 0) return;
+    int x0 = std::max(x, 0), x1 = std::min(x + len, w);
+    for (int i = x0; i < x1; i++) pixels[y * w + i] = c;
+  }
+
+  void vline(int x, int y, int len, uint16_t c) {
+    if ((unsigned)x >= (unsigned)w || len <= 0) return;
+    int y0 = std::max(y, 0), y1 = std::min(y + len, h);
+    for (int i = y0; i < y1; i++) pixels[i * w + x] = c;
+  }
+};
@@ -0,0 +1,265 @@
+/**
+ * attract_gen - アトラクトモード用アニメーションの事前レンダリング
+ *
+ * ひび割れ → 粉砕 → 収束 → 透明ガラス、の一周をオフラインで描画し、
+ * 16色パレット + フレーム間差分（PaletteDelta）で src/attract_anim.h に書き出す。
+ * 端末はフラッシュ上のこのデータを読み出してそのままパネルへ転送するだけ。
+ *
+ * ビルド/実行:
+ *   g++ -O2 -std=c++17 -Iinclude tools/attract_gen.cpp -o attract_gen
+ *   ./attract_gen src/attract_anim.h
+ */
+
+#include "FrameCodec.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+const int W = 240;
+const int H = 240;
+const int CX = 120;
+const int CY = 120;
+const int FPS = 30;
+const int FRAME_COUNT = 90;  // 3秒ループ
+
+// パレット: 0 = 黒, 1 = ガラスの縁, 2-15 = 青白い光の明るさ段階
+const int PAL_BLACK = 0;
+const int PAL_RIM = 1;
+const int PAL_LIGHT_BASE = 2;
+const int PAL_LIGHT_LEVELS = 14;
+
+static uint16_t rgb565(int r, int g, int b) {
+  return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+// ========================================
+// 8bitインデックスのソフトウェア描画
+// ========================================
+struct IndexCanvas {
+  std::vector<uint8_t> px = std::vector<uint8_t>(W * H, 0);
+
+  void clear() { std::fill(px.begin(), px.end(), 0); }
+
+  void pixel(int x, int y, uint8_t c) {
+    if (x < 0 || y < 0 || x >= W || y >= H) return;
+    px[y * W + x] = c;
+  }
+
+  void line(int x0, int y0, int x1, int y1, uint8_t c) {
+    int dx = std::abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -std::abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    while (true) {
+      pixel(x0, y0, c);
+      if (x0 == x1 && y0 == y1) break;
+      int e2 = 2 * err;
+      if (e2 >= dy) { err += dy; x0 += sx; }
+      if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+  }
+
+  void fillCircle(int x, int y, int r, uint8_t c) {
+    for (int dy = -r; dy <= r; dy++)
+      for (int dx = -r; dx <= r; dx++)
+        if (dx * dx + dy * dy <= r * r + r) pixel(x + dx, y + dy, c);
+  }
+
+  void circle(int x, int y, int r, uint8_t c) {
+    int dx = r, dy = 0, err = 1 - r;
+    while (dx >= dy) {
+      pixel(x + dx, y + dy, c); pixel(x - dx, y + dy, c);
+      pixel(x + dx, y - dy, c); pixel(x - dx, y - dy, c);
+      pixel(x + dy, y + dx, c); pixel(x - dy, y + dx, c);
+      pixel(x + dy, y - dx, c); pixel(x - dy, y - dx, c);
+      dy++;
+      if (err < 0) err += 2 * dy + 1;
+      else { dx--; err += 2 * (dy - dx) + 1; }
+    }
+  }
+};
+
+static uint8_t light(float t) {
+  if (t <= 0.0f) return PAL_BLACK;
+  int level = (int)(t * PAL_LIGHT_LEVELS);
+  if (level >= PAL_LIGHT_LEVELS) level = PAL_LIGHT_LEVELS - 1;
+  return (uint8_t)(PAL_LIGHT_BASE + level);
+}
+
+// ========================================
+// 演出データ（決定的な乱数で生成）
+// ========================================
+struct Segment {
+  float x0, y0, x1, y1;
+  float start;  // 伸び始める時刻（0-1, ひび割れ区間内）
+};
+
+struct Dust {
+  float x, y, vx, vy;
+  int size;
+};
+
+static uint32_t rngState = 0x6C617373;  // "lass"
+
+static float frand() {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return (rngState & 0xFFFFFF) / 16777216.0f;
+}
+
+static void addCrack(std::vector<Segment>& segs, float x, float y, float angle, int gen, float start) {
+  float length = (25 + frand() * 35) / (gen + 1.0f);
+  Segment s = {x, y, x + cosf(angle) * length, y + sinf(angle) * length, start};
+  segs.push_back(s);
+  if (gen < 2) {
+    int branches = frand() < 0.6f ? 2 : 1;
+    for (int b = 0; b < branches; b++) {
+      float a = angle + (frand() - 0.5f) * 1.2f;
+      addCrack(segs, s.x1, s.y1, a, gen + 1, start + 0.25f);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  const char* outPath = argc > 1 ? argv[1] : "src/attract_anim.h";
+
+  // 衝撃点から放射状のひび
+  std::vector<Segment> segs;
+  const float impactX = CX + 6, impactY = CY - 8;
+  for (int i = 0; i < 12; i++) {
+    float angle = i * (2 * M_PI / 12) + (frand() - 0.5f) * 0.4f;
+    addCrack(segs, impactX, impactY, angle, 0, frand() * 0.2f);
+  }
+
+  // 粉砕時の破片はひびの上から飛び散る
+  std::vector<Dust> dust;
+  for (int i = 0; i < 150; i++) {
+    const Segment& s = segs[(size_t)(frand() * segs.size())];
+    float t = frand();
+    Dust d;
+    d.x = s.x0 + (s.x1 - s.x0) * t;
+    d.y = s.y0 + (s.y1 - s.y0) * t;
+    float a = atan2f(d.y - impactY, d.x - impactX);
+    float speed = 1.0f + frand() * 3.0f;
+    d.vx = cosf(a) * speed;
+    d.vy = sinf(a) * speed;
+    d.size = frand() < 0.3f ? 2 : 1;
+    dust.push_back(d);
+  }
+
+  // 区間（フレーム番号）
+  const int CRACK_BEGIN = 10, CRACK_END = 34;
+  const int SHATTER_BEGIN = 35, SHATTER_END = 66;
+  const int REBUILD_END = FRAME_COUNT;
+
+  IndexCanvas canvas, prev;
+  std::vector<uint8_t> data;
+  std::vector<uint32_t> offsets;
+  std::vector<uint8_t> scratch(W * H * 2);
+  size_t maxFrameBytes = 0;
+
+  for (int f = 0; f <= FRAME_COUNT; f++) {
+    int frame = f % FRAME_COUNT;
+    canvas.clear();
+    canvas.circle(CX, CY, 80, PAL_RIM);
+
+    if (frame < CRACK_BEGIN) {
+      // 静止したガラスと呼吸する光
+      float breathe = sinf(frame * 0.2f) * 0.5f + 0.5f;
+      canvas.circle(CX, CY, 81, PAL_RIM);
+      canvas.fillCircle(CX, CY, 5, light(0.1f + breathe * 0.15f));
+    } else if (frame <= CRACK_END) {
+      // ひびが伸びる
+      float t = (frame - CRACK_BEGIN) / (float)(CRACK_END - CRACK_BEGIN);
+      for (const Segment& s : segs) {
+        float grow = (t - s.start) / 0.35f;
+        if (grow <= 0) continue;
+        if (grow > 1) grow = 1;
+        canvas.line((int)s.x0, (int)s.y0, (int)(s.x0 + (s.x1 - s.x0) * grow),
+                    (int)(s.y0 + (s.y1 - s.y0) * grow), light(0.85f));
+      }
+      if (frame < CRACK_BEGIN + 3) canvas.fillCircle((int)impactX, (int)impactY, 4 - (frame - CRACK_BEGIN), light(1.0f));
+    } else if (frame <= SHATTER_END) {
+      // 粉砕: ひびが消え、破片が飛び散る
+      int k = frame - SHATTER_BEGIN;
+      float fade = 1.0f - k / (float)(SHATTER_END - SHATTER_BEGIN);
+      float crackFade = 1.0f - (k / 4) * 4 / (float)(SHATTER_END - SHATTER_BEGIN);  // 4フレームごとに減光（差分量を抑える）
+      for (const Segment& s : segs) {
+        canvas.line((int)s.x0, (int)s.y0, (int)s.x1, (int)s.y1, light(0.7f * crackFade * crackFade));
+      }
+      if (k < 4) canvas.fillCircle(CX, CY, 50, light(0.45f * (1.0f - k / 4.0f)));
+      for (const Dust& d : dust) {
+        float damp = (1.0f - powf(0.93f, (float)k)) / 0.07f;
+        canvas.fillCircle((int)(d.x + d.vx * damp), (int)(d.y + d.vy * damp), d.size, light(0.2f + 0.8f * fade));
+      }
+    } else {
+      // 収束: 破片が中心へ戻り、光の輪が広がってガラスに戻る
+      float t = (frame - SHATTER_END) / (float)(REBUILD_END - SHATTER_END);
+      float damp = (1.0f - powf(0.93f, (float)(SHATTER_END - SHATTER_BEGIN))) / 0.07f;
+      float pull = 1.0f - (1.0f - t) * (1.0f - t);
+      for (const Dust& d : dust) {
+        float x = d.x + d.vx * damp, y = d.y + d.vy * damp;
+        x += (CX - x) * pull;
+        y += (CY - y) * pull;
+        if (t < 0.85f) canvas.pixel((int)x, (int)y, light(0.3f * (1.0f - t)));
+      }
+      if (t > 0.4f) canvas.circle(CX, CY, (int)((t - 0.4f) / 0.6f * 80), light(0.5f * (1.0f - t)));
+      canvas.fillCircle(CX, CY, 5, light(0.1f + 0.25f * (1.0f - t)));
+    }
+
+    if (f == 0) {
+      // 入場用キーフレーム（黒からの差分）
+      IndexCanvas black;
+      size_t n = encodePaletteDelta(canvas.px.data(), black.px.data(), W * H, scratch.data());
+      offsets.push_back(data.size());
+      data.insert(data.end(), scratch.begin(), scratch.begin() + n);
+      if (n > maxFrameBytes) maxFrameBytes = n;
+    } else {
+      // f == FRAME_COUNT はループを閉じる差分（最終フレーム → 先頭）
+      size_t n = encodePaletteDelta(canvas.px.data(), prev.px.data(), W * H, scratch.data());
+      offsets.push_back(data.size());
+      data.insert(data.end(), scratch.begin(), scratch.begin() + n);
+      if (n > maxFrameBytes) maxFrameBytes = n;
+    }
+    prev = canvas;
+  }
+  offsets.push_back(data.size());
+
+  FILE* out = fopen(outPath, "w");
+  if (!out) {
+    perror(outPath);
+    return 1;
+  }
+  fprintf(out, "// 自動生成ファイル: tools/attract_gen.cpp が出力。手で編集しないこと。\n");
+  fprintf(out, "#pragma once\n\n#include <stdint.h>\n\n");
+  fprintf(out, "const int ATTRACT_WIDTH = %d;\n", W);
+  fprintf(out, "const int ATTRACT_HEIGHT = %d;\n", H);
+  fprintf(out, "const int ATTRACT_FPS = %d;\n", FPS);
+  fprintf(out, "const int ATTRACT_FRAME_COUNT = %d;\n\n", FRAME_COUNT);
+
+  fprintf(out, "// RGB565（ビッグエンディアンへの変換は再生側で行う）\n");
+  fprintf(out, "const uint16_t ATTRACT_PALETTE[16] = {\n ");
+  uint16_t pal[16] = {rgb565(0, 0, 0), rgb565(128, 128, 128)};
+  for (int i = 0; i < PAL_LIGHT_LEVELS; i++) {
+    float t = (i + 1) / (float)PAL_LIGHT_LEVELS;
+    pal[PAL_LIGHT_BASE + i] = rgb565((int)(t * 220), (int)(t * 225), (int)(t * 255));
+  }
+  for (int i = 0; i < 16; i++) fprintf(out, " 0x%04X,", pal[i]);
+  fprintf(out, "\n};\n\n");
+
+  fprintf(out, "// [0] = 黒からのキーフレーム, [1..N-1] = 前フレームからの差分, [N] = 最終 → 先頭の差分\n");
+  fprintf(out, "const uint32_t ATTRACT_FRAME_OFFSETS[%d] = {", FRAME_COUNT + 2);
+  for (size_t i = 0; i < offsets.size(); i++) fprintf(out, "%s%u,", i % 10 ? " " : "\n  ", offsets[i]);
+  fprintf(out, "\n};\n\n");
+
+  fprintf(out, "const uint8_t ATTRACT_DATA[%zu] = {", data.size());
+  for (size_t i = 0; i < data.size(); i++) fprintf(out, "%s%u,", i % 24 ? "" : "\n  ", data[i]);
+  fprintf(out, "\n};\n");
+  fclose(out);
+
+  fprintf(stderr, "%d frames, %zu bytes total (%.1f bytes/frame avg, %zu max, raw 4bpp %d)\n",
+          FRAME_COUNT, data.size(), (double)data.size() / (FRAME_COUNT + 1), maxFrameBytes, W * H / 2);
+  return 0;
+}
@@ -0,0 +1,383 @@
+/**
+ * batch_sim - GlassEngine のパラメータスイープ用バッチシミュレータ
+ *
+ * 設定の組み合わせ × セッション数ぶんのシミュレーションをスレッドプールで並列に回し、
+ * 設定ごとに各Stateの滞在時間・粒子数のピーク・推定フレームコストを集計する。
+ * 推定フレームコストを core 1 の処理時間として EnergyModel.h の既定の係数に
+ * 掛け、1時間あたりの消費電力の目安（mWh/h）も出す（音・core 0 のタスクは含まない）。
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -pthread -Iinclude -Itools tools/batch_sim.cpp src/GlassEngine.cpp src/GlassFluid.cpp -o batch_sim
+ * 例:
+ *   ./batch_sim --sessions 2000 --crack 0.10,0.15,0.20 --rate 0.002,0.003,0.004
+ *   ./batch_sim --input dial_log.txt --shatter 0.55,0.65,0.75
+ *   ./batch_sim --max-dust 20000 --sessions 200   （粉塵も動かして、フレームコストと消費電力に含める）
+ *
+ * 粉塵（DustField）は描画にしか効かず状態遷移を変えないので、既定では動かさない
+ * （--max-dust 0。粉塵を動かすと1セッションが数十倍遅くなる）。その代わり frame_us と
+ * mWh/h に粉塵のぶんは入らない。端末の既定（GlassConfig::maxDust）と同じコストを
+ * 見積もるときは --max-dust 20000 を付ける。
+ *
+ * オプション（カンマ区切りで複数値を与えると直積でスイープ）:
+ *   --crack --shatter --rate --decay --crack-fade --particle-fade --max-cracks --max-particles
+ *   --max-dust                          （既定 0 = 粉塵なし。上を参照）
+ *   --fluid-share                       （0 = 流体を使わず、細かい粉も粒として動かす）
+ *   --sessions N      設定ごとのセッション数（既定 500、記録入力がある場合はその本数が単位）
+ *   --duration SEC    合成入力のセッション長（既定 120）
+ *   --frame-ms MS     合成入力のフレーム間隔（既定 17）
+ *   --threads N       ワーカースレッド数（既定: 論理コア数）
+ *   --input FILE      端末の入力記録（複数可）。指定時は合成入力の代わりに使う
+ *   --csv FILE        集計結果をCSVでも書き出す
+ */
+
+#include "DustField.h"
+#include "EnergyModel.h"
+#include "GlassEngine.h"
+#include "GlassGauge.h"
+#include "SessionInput.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const char* STATE_NAMES[STATE_COUNT] = {"NORMAL", "CRACK", "SHATTER", "SILENCE", "REBUILD", "RECOVERY"};
+
+// ========================================
+// 推定フレームコスト
+// ========================================
+// main.cpp の描画関数が発行するプリミティブ数と、粉塵・ひびの画像・ゲージ・流体の
+// 量から1フレームの時間を見積もる。
+// 係数は ESP32-S3 + PSRAMスプライトでのおおよその値（実機で校正すること）。
+const double COST_CLEAR_US = 180.0;        // fillScreen（115KB）
+const double COST_PUSH_US = 11520.0;       // 240x240x16bit を 80MHz SPI で転送
+const double COST_LINE_BASE_US = 1.5;
+const double COST_LINE_PER_PX_US = 0.04;
+const double COST_FILL_BASE_US = 1.0;
+const double COST_FILL_PER_PX_US = 0.03;
+const double COST_CIRCLE_BASE_US = 2.0;
+const double COST_CIRCLE_PER_PX_US = 0.02;
+const double COST_DUST_SPLAT_US = 0.15;     // 1粒の splat（2レーンに分けて両コアで並列）
+const double COST_FLUID_SPLAT_US = 1400.0;  // 流体の密度をグリッドへ（core 0 のレーンに乗る）
+const double COST_DUST_COMPOSITE_US = 2400.0; // トーンマップ + 2倍拡大の加算合成（円全体）
+const double COST_DECAL_BASE_US = 2.0;
+const double COST_DECAL_US = 40.0;          // ひびの画像1枚の型押し（64x64 の星で 0.01us/px）
+const double COST_GAUGE_SECTOR_US = 0.5;    // ゲージの1度分の扇形（数本の横ラン）
+const double COST_FLUID_STEP_US = 3000.0;   // 64x64 の流体の1ステップ
+const uint8_t SIM_BACKLIGHT = 200;         // main.cpp の既定の明るさ
+
+static double lineCost(float length) { return COST_LINE_BASE_US + COST_LINE_PER_PX_US * length; }
+static double fillCost(float r) { return COST_FILL_BASE_US + COST_FILL_PER_PX_US * 3.14159 * r * r; }
+static double circleCost(float r) { return COST_CIRCLE_BASE_US + COST_CIRCLE_PER_PX_US * 6.28318 * r; }
+
+static double decalCost(const GlassEngine& e) { return e.decals.size() * (COST_DECAL_BASE_US + COST_DECAL_US); }
+
+// gaugeSectors: このフレームでゲージが塗り直す扇形の数
+static double estimateFrameCost(const GlassEngine& e, unsigned long now, int gaugeSectors) {
+  double us = COST_CLEAR_US + COST_PUSH_US;
+  unsigned long inState = now - e.stateStartTime;
+
+  // 状態によらない分（GlassEngine::step の流体、粉塵の splat と合成、縁のゲージ）
+  us += e.fluidSteps * COST_FLUID_STEP_US;
+  if (e.dustLevel > 0.0f) {
+    // loop() は core 0 の前半（+ 流体の密度）を待つので、長い方のレーンが効く
+    us += (e.fluidActive ? COST_FLUID_SPLAT_US : 0.0) +
+          COST_DUST_SPLAT_US * ((e.dust.size() + DustField::LANES - 1) / DustField::LANES) +
+          COST_DUST_COMPOSITE_US;
+  }
+  us += gaugeSectors * COST_GAUGE_SECTOR_US;
+
+  switch (e.currentState) {
+    case NORMAL:
+      us += 2 * circleCost(80);
+      if (inState < 2000) us += fillCost(5);
+      break;
+    case CRACK:
+      us += circleCost(80) + decalCost(e);
+      for (const auto& c : e.cracks) if (c.active) us += lineCost(c.length);
+      break;
+    case SHATTER:
+      us += decalCost(e);
+      for (const auto& c : e.cracks) us += lineCost(c.length);
+      for (const auto& p : e.particles) if (p.active) us += fillCost(p.size);
+      if (inState < 200) us += fillCost(50);
+      break;
+    case SILENCE:
+      for (const auto& p : e.particles) if (p.active && p.alpha > 0.3f) us += fillCost(p.size);
+      break;
+    case REBUILD:
+      us += decalCost(e);
+      for (const auto& c : e.cracks) if (c.alpha > 0.1f) us += lineCost(c.length);
+      for (const auto& p : e.particles) {
+        if (!p.active) continue;
+        float dx = p.x - CENTER_X, dy = p.y - CENTER_Y;
+        us += fillCost(p.size) + lineCost(sqrtf(dx * dx + dy * dy));
+      }
+      us += fillCost(10);
+      break;
+    case RECOVERY:
+      us += circleCost(80 * inState / (float)e.config.recoveryDuration) + fillCost(5);
+      break;
+  }
+  return us;
+}
+
+// ========================================
+// 1セッションの実行と結果
+// ========================================
+struct SessionResult {
+  double stateMillis[STATE_COUNT] = {};
+  int peakParticles = 0;
+  int peakCracks = 0;
+  int shatterCount = 0;
+  double frameCostSum = 0;
+  double frameCostMax = 0;
+  double energyMicrojoules = 0;
+  long frames = 0;
+};
+
+static SessionResult runSession(const GlassConfig& config, const Session& session) {
+  SessionResult result;
+  GlassEngine engine(config, session.seed);
+  engine.reset(session.startTime);
+
+  unsigned long prev = session.startTime;
+  int gaugeShown = -1;   // GlassGauge::shownSectors と同じく、最初のフレームは全体を描く
+  for (const SessionStep& step : session.steps) {
+    engine.step(step.input, step.time);
+
+    unsigned long elapsed = step.time - prev;
+    result.stateMillis[engine.currentState] += elapsed;
+    prev = step.time;
+
+    if (engine.currentState == SHATTER && engine.previousState == CRACK) result.shatterCount++;
+    int live = engine.activeParticleCount();
+    if (live > result.peakParticles) result.peakParticles = live;
+    if ((int)engine.cracks.size() > result.peakCracks) result.peakCracks = (int)engine.cracks.size();
+
+    int gauge = (int)(engine.destructionLevel * GAUGE_SECTORS + 0.5f);
+    int gaugeSectors = gaugeShown < 0 ? GAUGE_SECTORS : std::abs(gauge - gaugeShown);
+    gaugeShown = gauge;
+
+    double cost = estimateFrameCost(engine, step.time, gaugeSectors);
+    result.frameCostSum += cost;
+    if (cost > result.frameCostMax) result.frameCostMax = cost;
+
+    EnergyActivity activity = {};
+    activity.elapsedMicros = (uint32_t)(elapsed * 1000);
+    activity.coreBusyMicros[1] = (uint32_t)std::min(cost, (double)activity.elapsedMicros);
+    activity.cpuMhz = (uint32_t)ENERGY_REFERENCE_MHZ;
+    activity.spiBytes = SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t);
+    activity.backlight = SIM_BACKLIGHT;
+    result.energyMicrojoules += estimateEnergy(activity, ENERGY_DEFAULT_COEFFICIENTS).total();
+    result.frames++;
+  }
+  return result;
+}
+
+// ========================================
+// コマンドライン
+// ========================================
+static std::vector<double> parseList(const char* arg) {
+  std::vector<double> values;
+  std::string s(arg);
+  size_t pos = 0;
+  while (pos <= s.size()) {
+    size_t comma = s.find(',', pos);
+    if (comma == std::string::npos) comma = s.size();
+    if (comma > pos) values.push_back(atof(s.substr(pos, comma - pos).c_str()));
+    pos = comma + 1;
+  }
+  return values;
+}
+
+struct Sweep {
+  std::vector<double> crack = {0.15};
+  std::vector<double> shatter = {0.65};
+  std::vector<double> rate = {0.003};
+  std::vector<double> decay = {0.9};
+  std::vector<double> crackFade = {0.95};
+  std::vector<double> particleFade = {0.995};
+  std::vector<double> maxCracks = {80};
+  std::vector<double> maxParticles = {150};
+  std::vector<double> maxDust = {0};      // 粉塵は描画だけ（状態遷移には効かない）
+  std::vector<double> fluidShare = {0.5};
+};
+
+static std::vector<GlassConfig> expand(const Sweep& s) {
+  std::vector<GlassConfig> configs;
+  for (double a : s.crack)
+  for (double b : s.shatter)
+  for (double c : s.rate)
+  for (double d : s.decay)
+  for (double e : s.crackFade)
+  for (double f : s.particleFade)
+  for (double g : s.maxCracks)
+  for (double h : s.maxParticles)
+  for (double k : s.maxDust)
+  for (double l : s.fluidShare) {
+    GlassConfig cfg;
+    cfg.crackThreshold = (float)a;
+    cfg.shatterThreshold = (float)b;
+    cfg.destructionRate = (float)c;
+    cfg.rotationDecay = (float)d;
+    cfg.crackFade = (float)e;
+    cfg.particleFade = (float)f;
+    cfg.maxCracks = (int)g;
+    cfg.maxParticles = (int)h;
+    cfg.maxDust = (int)k;
+    cfg.fluidDustShare = (float)l;
+    configs.push_back(cfg);
+  }
+  return configs;
+}
+
+int main(int argc, char** argv) {
+  Sweep sweep;
+  int sessionsPerConfig = 500;
+  double durationSec = 120;
+  unsigned long frameMs = 17;
+  unsigned threadCount = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<Session> recorded;
+  const char* csvPath = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    std::string opt = argv[i];
+    const char* val = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (!val) {
+      fprintf(stderr, "missing value for %s\n", opt.c_str());
+      return 1;
+    }
+    i++;
+    if (opt == "--crack") sweep.crack = parseList(val);
+    else if (opt == "--shatter") sweep.shatter = parseList(val);
+    else if (opt == "--rate") sweep.rate = parseList(val);
+    else if (opt == "--decay") sweep.decay = parseList(val);
+    else if (opt == "--crack-fade") sweep.crackFade = parseList(val);
+    else if (opt == "--particle-fade") sweep.particleFade = parseList(val);
+    else if (opt == "--max-cracks") sweep.maxCracks = parseList(val);
+    else if (opt == "--max-particles") sweep.maxParticles = parseList(val);
+    else if (opt == "--max-dust") sweep.maxDust = parseList(val);
+    else if (opt == "--fluid-share") sweep.fluidShare = parseList(val);
+    else if (opt == "--sessions") sessionsPerConfig = atoi(val);
+    else if (opt == "--duration") durationSec = atof(val);
+    else if (opt == "--frame-ms") frameMs = (unsigned long)atol(val);
+    else if (opt == "--threads") threadCount = std::max(1, atoi(val));
+    else if (opt == "--csv") csvPath = val;
+    else if (opt == "--input") {
+      Session s;
+      if (!loadSession(val, s)) {
+        fprintf(stderr, "%s: no IN records\n", val);
+        return 1;
+      }
+      recorded.push_back(s);
+    } else {
+      fprintf(stderr, "unknown option %s\n", opt.c_str());
+      return 1;
+    }
+  }
+
+  std::vector<GlassConfig> configs = expand(sweep);
+  if (!recorded.empty()) sessionsPerConfig = std::max<int>(sessionsPerConfig / recorded.size(), 1) * recorded.size();
+
+  // 合成入力は設定間で共通（同じ操作で設定だけを比べる）
+  std::vector<Session> synthetic;
+  if (recorded.empty()) {
+    synthetic.reserve(sessionsPerConfig);
+    for (int i = 0; i < sessionsPerConfig; i++) {
+      synthetic.push_back(makeSyntheticSession(i + 1, (unsigned long)(durationSec * 1000), frameMs));
+    }
+  }
+  const std::vector<Session>& inputs = recorded.empty() ? synthetic : recorded;
+
+  // ジョブ = (設定, セッション)。ワーカーはアトミックなカウンタから順に取る
+  size_t jobCount = configs.size() * sessionsPerConfig;
+  std::vector<SessionResult> results(jobCount);
+  std::atomic<size_t> nextJob(0);
+
+  auto startTime = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (unsigned t = 0; t < threadCount; t++) {
+    workers.emplace_back([&]() {
+      while (true) {
+        size_t job = nextJob.fetch_add(1);
+        if (job >= jobCount) break;
+        const GlassConfig& cfg = configs[job / sessionsPerConfig];
+        Session session = inputs[(job % sessionsPerConfig) % inputs.size()];
+        // 記録入力を繰り返す場合はシードだけ変える
+        session.seed += (uint32_t)((job % sessionsPerConfig) / inputs.size()) * 7919u;
+        results[job] = runSession(cfg, session);
+      }
+    });
+  }
+  for (auto& w : workers) w.join();
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+  FILE* csv = csvPath ? fopen(csvPath, "w") : nullptr;
+  if (csv) {
+    fprintf(csv, "crack,shatter,rate,decay,crack_fade,particle_fade,max_cracks,max_particles,max_dust,fluid_share");
+    for (int s = 0; s < STATE_COUNT; s++) fprintf(csv, ",pct_%s", STATE_NAMES[s]);
+    fprintf(csv, ",peak_particles_mean,peak_particles_max,peak_cracks_mean,shatters_per_session,"
+                 "frame_us_mean,frame_us_max,mwh_per_hour\n");
+  }
+
+  printf("%-55s", "config (crack/shatter/rate/decay/cf/pf/mc/mp/md/fs)");
+  for (int s = 0; s < STATE_COUNT; s++) printf(" %8.8s", STATE_NAMES[s]);
+  printf(" %9s %9s %8s %10s %10s %7s\n", "peakP", "peakPmax", "shatters", "frame_us", "frame_max", "mWh/h");
+
+  for (size_t c = 0; c < configs.size(); c++) {
+    const GlassConfig& cfg = configs[c];
+    double stateMs[STATE_COUNT] = {};
+    double totalMs = 0, peakP = 0, peakC = 0, shatters = 0, costSum = 0, costMax = 0, energy = 0;
+    int peakPMax = 0;
+    long frames = 0;
+    for (int i = 0; i < sessionsPerConfig; i++) {
+      const SessionResult& r = results[c * sessionsPerConfig + i];
+      for (int s = 0; s < STATE_COUNT; s++) {
+        stateMs[s] += r.stateMillis[s];
+        totalMs += r.stateMillis[s];
+      }
+      peakP += r.peakParticles;
+      peakPMax = std::max(peakPMax, r.peakParticles);
+      peakC += r.peakCracks;
+      shatters += r.shatterCount;
+      costSum += r.frameCostSum;
+      costMax = std::max(costMax, r.frameCostMax);
+      energy += r.energyMicrojoules;
+      frames += r.frames;
+    }
+
+    // uJ / ms = mW（= 1時間あたりの mWh）
+    double mwhPerHour = totalMs > 0 ? energy / totalMs : 0;
+
+    char label[80];
+    snprintf(label, sizeof(label), "%.3f/%.3f/%.4f/%.2f/%.3f/%.4f/%d/%d/%d/%.2f", cfg.crackThreshold,
+             cfg.shatterThreshold, cfg.destructionRate, cfg.rotationDecay, cfg.crackFade,
+             cfg.particleFade, cfg.maxCracks, cfg.maxParticles, cfg.maxDust, cfg.fluidDustShare);
+    printf("%-55s", label);
+    for (int s = 0; s < STATE_COUNT; s++) printf(" %7.1f%%", totalMs > 0 ? stateMs[s] * 100 / totalMs : 0);
+    printf(" %9.1f %9d %8.2f %10.0f %10.0f %7.0f\n", peakP / sessionsPerConfig, peakPMax,
+           shatters / sessionsPerConfig, frames ? costSum / frames : 0, costMax, mwhPerHour);
+
+    if (csv) {
+      fprintf(csv, "%g,%g,%g,%g,%g,%g,%d,%d,%d,%g", cfg.crackThreshold, cfg.shatterThreshold,
+              cfg.destructionRate, cfg.rotationDecay, cfg.crackFade, cfg.particleFade,
+              cfg.maxCracks, cfg.maxParticles, cfg.maxDust, cfg.fluidDustShare);
+      for (int s = 0; s < STATE_COUNT; s++) fprintf(csv, ",%.3f", totalMs > 0 ? stateMs[s] * 100 / totalMs : 0);
+      fprintf(csv, ",%.2f,%d,%.2f,%.3f,%.1f,%.1f,%.1f\n", peakP / sessionsPerConfig, peakPMax,
+              peakC / sessionsPerConfig, shatters / sessionsPerConfig, frames ? costSum / frames : 0, costMax,
+              mwhPerHour);
+    }
+  }
+  if (csv) fclose(csv);
+
+  fprintf(stderr, "%zu sessions (%zu configs x %d) on %u threads in %.2f s = %.0f sessions/min\n",
+          jobCount, configs.size(), sessionsPerConfig, threadCount, elapsed,
+          elapsed > 0 ? jobCount * 60.0 / elapsed : 0.0);
+  return 0;
+}
@@ -0,0 +1,311 @@
+/**
+ * crack_decal_gen - ひびの画像（CrackDecal.h のアトラス）の生成
+ *
+ * 衝撃の中心の星形のひび（DECAL_STAR）と、縁の欠け（DECAL_CHIP）の画像を
+ * DECAL_ANGLES 通りの向きに回転し、4bpp（16階調）の不透明度にして
+ * src/crack_decals.h に書き出す。
+ *
+ * 元の画像は、--star / --chip にグレースケールの PGM（P5、白がひび）を渡すと
+ * その写真を使い、なければ手続き生成する。
+ *   星形  先細りでぎざぎざの放射状のひび + 放射の間をつなぐ円弧状のひび +
+ *         砕けた中心 + 細かいざらつき
+ *   欠け  縁から内側（向き 0 で -x 側）へ貝殻状にえぐれた跡と同心の波紋
+ * 回転は出力の 1画素を 4x4 に分け、元の画像（出力の MASTER_SCALE 倍の解像度）を
+ * 双線形補間で読んで平均する。元の画像は内接円の外を使わないので、
+ * どの向きでも画像からはみ出さない。
+ *
+ * ビルド/実行:
+ *   g++ -O2 -std=c++17 -Iinclude tools/crack_decal_gen.cpp -o crack_decal_gen
+ *   ./crack_decal_gen src/crack_decals.h
+ *   ./crack_decal_gen src/crack_decals.h --star star.pgm --chip chip.pgm
+ */
+
+#include "CrackDecal.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+const int STAR_SIZE = 64;       // 出力の1辺 [px]
+const int CHIP_SIZE = 24;
+const int MASTER_SCALE = 4;     // 元の画像の解像度（出力比）
+const int SUPERSAMPLE = 4;      // 回転時の1辺あたりの標本数
+const unsigned SEED = 7;
+
+// 元の画像（0 ~ 1 の不透明度）
+struct Master {
+  int size;
+  std::vector<float> value;
+
+  explicit Master(int s) : size(s), value(s * s, 0.0f) {}
+  float& at(int x, int y) { return value[y * size + x]; }
+
+  // 範囲外は 0
+  float sample(float x, float y) const {
+    int x0 = (int)floorf(x), y0 = (int)floorf(y);
+    float fx = x - x0, fy = y - y0;
+    auto get = [&](int px, int py) {
+      return px < 0 || py < 0 || px >= size || py >= size ? 0.0f : value[py * size + px];
+    };
+    float top = get(x0, y0) + (get(x0 + 1, y0) - get(x0, y0)) * fx;
+    float bottom = get(x0, y0 + 1) + (get(x0 + 1, y0 + 1) - get(x0, y0 + 1)) * fx;
+    return top + (bottom - top) * fy;
+  }
+};
+
+static float frand(float lo, float hi) { return lo + (hi - lo) * (rand() / (float)RAND_MAX); }
+
+// 線分 (x0, y0)-(x1, y1) を太さ width0 → width1、濃さ v0 → v1 で描く（重なりは明るい方）
+static void stroke(Master& m, float x0, float y0, float x1, float y1, float width0, float width1, float v0, float v1) {
+  float pad = std::max(width0, width1) / 2 + 1;
+  int minX = std::max(0, (int)floorf(std::min(x0, x1) - pad)), maxX = std::min(m.size - 1, (int)ceilf(std::max(x0, x1) + pad));
+  int minY = std::max(0, (int)floorf(std::min(y0, y1) - pad)), maxY = std::min(m.size - 1, (int)ceilf(std::max(y0, y1) + pad));
+  float dx = x1 - x0, dy = y1 - y0;
+  float lengthSq = std::max(dx * dx + dy * dy, 1e-6f);
+  for (int y = minY; y <= maxY; y++) {
+    for (int x = minX; x <= maxX; x++) {
+      float px = x + 0.5f - x0, py = y + 0.5f - y0;
+      float t = std::min(1.0f, std::max(0.0f, (px * dx + py * dy) / lengthSq));
+      float ex = px - t * dx, ey = py - t * dy;
+      float distance = sqrtf(ex * ex + ey * ey);
+      float width = width0 + (width1 - width0) * t;
+      float coverage = std::min(1.0f, std::max(0.0f, width / 2 + 0.5f - distance));
+      float v = coverage * (v0 + (v1 - v0) * t);
+      if (v > m.at(x, y)) m.at(x, y) = v;
+    }
+  }
+}
+
+// 中心から angle の向きへ、ぎざぎざに曲がりながら細くなるひび（分かれ目で枝を出す）
+static void jaggedRay(Master& m, float x, float y, float angle, float length, float width, float v, int depth) {
+  const int segments = 8;
+  float step = length / segments;
+  for (int s = 0; s < segments; s++) {
+    angle += frand(-0.25f, 0.25f);
+    float nx = x + cosf(angle) * step, ny = y + sinf(angle) * step;
+    float w1 = width * (1.0f - 0.8f * (s + 1) / segments), w0 = width * (1.0f - 0.8f * s / segments);
+    float v1 = v * (1.0f - 0.5f * (s + 1) / segments), v0 = v * (1.0f - 0.5f * s / segments);
+    stroke(m, x, y, nx, ny, w0, w1, v0, v1);
+    if (depth == 0 && s >= 2 && rand() % 4 == 0) {
+      float side = rand() % 2 ? 1.0f : -1.0f;
+      jaggedRay(m, nx, ny, angle + side * frand(0.4f, 0.9f), length * (segments - s) / segments * 0.6f, w1, v1, 1);
+    }
+    x = nx;
+    y = ny;
+  }
+}
+
+// ========================================
+// 手続き生成の元の画像
+// ========================================
+static Master makeStar() {
+  Master m(STAR_SIZE * MASTER_SCALE);
+  const float c = m.size / 2.0f, radius = m.size / 2.0f - 2;
+
+  // 放射状のひび（角度は均等 + 揺らぎ）
+  const int rays = 9;
+  std::vector<float> angles;
+  for (int i = 0; i < rays; i++) {
+    float angle = 6.2831853f * (i + frand(-0.3f, 0.3f)) / rays;
+    angles.push_back(angle);
+    jaggedRay(m, c, c, angle, radius * frand(0.6f, 0.92f), 3.0f * MASTER_SCALE / 2, 1.0f, 0);
+  }
+
+  // 円弧状のひび（隣り合う放射の間を、中心からの距離をほぼ保ってつなぐ）
+  for (int ring = 0; ring < 2; ring++) {
+    float r = radius * (ring == 0 ? 0.3f : 0.55f);
+    for (int i = 0; i < rays; i++) {
+      if (rand() % 3 == 0) continue;
+      float a0 = angles[i], a1 = angles[(i + 1) % rays];
+      if (a1 < a0) a1 += 6.2831853f;
+      const int pieces = 4;
+      float px = c + cosf(a0) * r, py = c + sinf(a0) * r;
+      for (int p = 1; p <= pieces; p++) {
+        float a = a0 + (a1 - a0) * p / pieces;
+        float rr = r * frand(0.9f, 1.1f);
+        float nx = c + cosf(a) * rr, ny = c + sinf(a) * rr;
+        stroke(m, px, py, nx, ny, 1.2f * MASTER_SCALE / 2, 1.2f * MASTER_SCALE / 2, 0.6f, 0.6f);
+        px = nx;
+        py = ny;
+      }
+    }
+  }
+
+  // 砕けた中心とざらつき
+  const float crushed = radius * 0.1f;
+  for (int y = 0; y < m.size; y++) {
+    for (int x = 0; x < m.size; x++) {
+      float dx = x + 0.5f - c, dy = y + 0.5f - c;
+      float d = sqrtf(dx * dx + dy * dy);
+      float& v = m.at(x, y);
+      if (d < crushed) v = std::max(v, frand(0.5f, 1.0f));
+      else if (d < crushed * 2) v = std::max(v, frand(0.0f, 0.6f) * (2 - d / crushed));
+      v *= frand(0.8f, 1.0f);
+      if (d > radius) v = 0.0f;
+    }
+  }
+  return m;
+}
+
+static Master makeChip() {
+  Master m(CHIP_SIZE * MASTER_SCALE);
+  const float c = m.size / 2.0f, radius = m.size / 2.0f - 2;
+
+  // 縁（画像の中心を通る x = c の線）から内側（-x）へ半楕円にえぐれた跡
+  for (int y = 0; y < m.size; y++) {
+    for (int x = 0; x < m.size; x++) {
+      float dx = (x + 0.5f - c) / (radius * 0.8f), dy = (y + 0.5f - c) / radius;
+      if (dx > 0) continue;
+      float d = sqrtf(dx * dx + dy * dy);
+      if (d >= 1.0f) continue;
+      // 外周は明るい縁、内側は同心の波紋（貝殻状の割れ口）
+      float edge = std::max(0.0f, 1.0f - fabsf(d - 0.92f) / 0.08f);
+      float ripple = 0.35f + 0.2f * cosf(d * 18.0f + frand(-0.3f, 0.3f));
+      m.at(x, y) = std::max(edge, ripple * (0.6f + 0.4f * d)) * frand(0.85f, 1.0f);
+    }
+  }
+  // 割れ口から内側へ伸びる短いひび
+  for (int i = 0; i < 3; i++) {
+    float angle = 3.14159265f + frand(-0.9f, 0.9f);
+    float start = radius * 0.7f;
+    jaggedRay(m, c + cosf(angle) * start, c + sinf(angle) * start, angle, radius * 0.3f, 1.5f * MASTER_SCALE / 2, 0.8f, 1);
+  }
+  return m;
+}
+
+// ========================================
+// 写真の読み込み
+// ========================================
+// P5 の PGM を size x size に合わせて読む（長い辺を合わせ、内接円の外は捨てる）
+static bool loadPgm(const std::string& path, Master& m) {
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  int width = 0, height = 0, maxValue = 0;
+  if (fscanf(f, "P5 %d %d %d", &width, &height, &maxValue) != 3 || maxValue <= 0 || maxValue > 255) {
+    fclose(f);
+    return false;
+  }
+  fgetc(f);
+  std::vector<uint8_t> pixels((size_t)width * height);
+  bool ok = fread(pixels.data(), 1, pixels.size(), f) == pixels.size();
+  fclose(f);
+  if (!ok) return false;
+
+  Master photo(std::max(width, height));
+  int offsetX = (photo.size - width) / 2, offsetY = (photo.size - height) / 2;
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) photo.at(x + offsetX, y + offsetY) = pixels[y * width + x] / (float)maxValue;
+  }
+  const float scale = (float)photo.size / m.size, c = m.size / 2.0f;
+  for (int y = 0; y < m.size; y++) {
+    for (int x = 0; x < m.size; x++) {
+      float dx = x + 0.5f - c, dy = y + 0.5f - c;
+      if (dx * dx + dy * dy > c * c) continue;
+      m.at(x, y) = photo.sample((x + 0.5f) * scale - 0.5f, (y + 0.5f) * scale - 0.5f);
+    }
+  }
+  return true;
+}
+
+// ========================================
+// 回転と量子化
+// ========================================
+// 画面の向き angle（y は下向き）に回した size x size の 4bpp 画像
+static std::vector<uint8_t> rotate(const Master& m, int size, float angle) {
+  const int stride = (size + 1) / 2;
+  std::vector<uint8_t> packed(stride * size, 0);
+  const float cosA = cosf(angle), sinA = sinf(angle);
+  const float half = size / 2.0f, masterHalf = m.size / 2.0f, scale = (float)m.size / size;
+  for (int y = 0; y < size; y++) {
+    for (int x = 0; x < size; x++) {
+      float sum = 0.0f;
+      for (int sy = 0; sy < SUPERSAMPLE; sy++) {
+        for (int sx = 0; sx < SUPERSAMPLE; sx++) {
+          float ox = x + (sx + 0.5f) / SUPERSAMPLE - half;
+          float oy = y + (sy + 0.5f) / SUPERSAMPLE - half;
+          // 出力の点を -angle 回して元の画像の点へ
+          float mx = ox * cosA + oy * sinA, my = -ox * sinA + oy * cosA;
+          sum += m.sample(mx * scale + masterHalf - 0.5f, my * scale + masterHalf - 0.5f);
+        }
+      }
+      int level = (int)lrintf(std::min(1.0f, sum / (SUPERSAMPLE * SUPERSAMPLE)) * 15.0f);
+      packed[y * stride + x / 2] |= (uint8_t)(x & 1 ? level : level << 4);
+    }
+  }
+  return packed;
+}
+
+int main(int argc, char** argv) {
+  const char* outPath = "src/crack_decals.h";
+  std::string starPath, chipPath;
+  int arg = 1;
+  if (arg < argc && argv[arg][0] != '-') outPath = argv[arg++];
+  for (; arg + 1 < argc; arg += 2) {
+    std::string opt = argv[arg];
+    if (opt == "--star") starPath = argv[arg + 1];
+    else if (opt == "--chip") chipPath = argv[arg + 1];
+    else {
+      fprintf(stderr, "usage: %s [out.h] [--star star.pgm] [--chip chip.pgm]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  srand(SEED);
+  Master masters[DECAL_KIND_COUNT] = {Master(STAR_SIZE * MASTER_SCALE), Master(CHIP_SIZE * MASTER_SCALE)};
+  const int sizes[DECAL_KIND_COUNT] = {STAR_SIZE, CHIP_SIZE};
+  const std::string* paths[DECAL_KIND_COUNT] = {&starPath, &chipPath};
+  const char* sources[DECAL_KIND_COUNT];
+  for (int k = 0; k < DECAL_KIND_COUNT; k++) {
+    if (!paths[k]->empty()) {
+      if (!loadPgm(*paths[k], masters[k])) {
+        fprintf(stderr, "%s: not a readable 8bit P5 PGM\n", paths[k]->c_str());
+        return 1;
+      }
+      sources[k] = paths[k]->c_str();
+    } else {
+      masters[k] = k == DECAL_STAR ? makeStar() : makeChip();
+      sources[k] = "procedural";
+    }
+  }
+
+  std::vector<uint8_t> bitmap;
+  std::vector<DecalImage> images;
+  for (int k = 0; k < DECAL_KIND_COUNT; k++) {
+    for (int a = 0; a < DECAL_ANGLES; a++) {
+      std::vector<uint8_t> packed = rotate(masters[k], sizes[k], 6.2831853f * a / DECAL_ANGLES);
+      images.push_back({(uint8_t)sizes[k], (uint8_t)sizes[k], (uint32_t)bitmap.size()});
+      bitmap.insert(bitmap.end(), packed.begin(), packed.end());
+    }
+  }
+
+  FILE* f = fopen(outPath, "w");
+  if (!f) {
+    perror(outPath);
+    return 1;
+  }
+  fprintf(f, "// 自動生成ファイル: tools/crack_decal_gen.cpp が出力。手で編集しないこと。\n");
+  fprintf(f, "#pragma once\n\n#include \"CrackDecal.h\"\n\n#include <stdint.h>\n\n");
+  fprintf(f, "// 星形 %dx%d（%s）、欠け %dx%d（%s）、各 %d 方向、4bpp\n", STAR_SIZE, STAR_SIZE, sources[DECAL_STAR],
+          CHIP_SIZE, CHIP_SIZE, sources[DECAL_CHIP], DECAL_ANGLES);
+  fprintf(f, "const DecalImage CRACK_DECAL_IMAGES[%d] = {\n", (int)images.size());
+  for (size_t i = 0; i < images.size(); i++) {
+    fprintf(f, "%s{%d, %d, %u},%s", i % 8 == 0 ? "  " : "", images[i].width, images[i].height,
+            (unsigned)images[i].offset, i % 8 == 7 || i + 1 == images.size() ? "\n" : " ");
+  }
+  fprintf(f, "};\n\n");
+  fprintf(f, "const uint8_t CRACK_DECAL_BITMAP[%d] = {\n", (int)bitmap.size());
+  for (size_t i = 0; i < bitmap.size(); i++) {
+    fprintf(f, "%s0x%02X,%s", i % 16 == 0 ? "  " : "", bitmap[i], i % 16 == 15 ? "\n" : " ");
+  }
+  fprintf(f, "\n};\n\n");
+  fprintf(f, "const DecalAtlas CRACK_DECALS = {CRACK_DECAL_IMAGES, CRACK_DECAL_BITMAP};\n");
+  fclose(f);
+
+  printf("%s: %d images (%s star %dpx, %s chip %dpx, %d angles), %d bytes\n", outPath, (int)images.size(),
+         sources[DECAL_STAR], STAR_SIZE, sources[DECAL_CHIP], CHIP_SIZE, DECAL_ANGLES, (int)bitmap.size());
+  return 0;
+}
@@ -0,0 +1,162 @@
+/**
+ * decal_bench - ひびの画像の型押し（CrackDecal.h）のコスト
+ *
+ * 型押し  種類ごとに、円の内側のばらばらな位置・向きへ --stamps 回型押しして
+ *         1枚あたりの時間と、画像の画素の処理速度 [Mpx/s] を表示する。
+ * 密度    ひびの本数を増やしたときの1フレームの時間を、
+ *           lines  線のひび（GlassRenderer と同じ drawLine、中心から枝分かれ）
+ *           decal  星形の画像1枚（画像の中のひびの本数は何本でも同じ）
+ *         で比べる。線は本数に比例して増え、画像は画像の大きさだけで決まる。
+ * --out を付けると最後のフレームを lines_N.ppm / decal.ppm に書き出す。
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -Iinclude -Isrc -Itools tools/decal_bench.cpp src/GlassEngine.cpp src/GlassFluid.cpp -o decal_bench
+ * 例:
+ *   ./decal_bench
+ *   ./decal_bench --stamps 20000 --lines 16,64,256,1024 --out decals
+ */
+
+#include "CrackDecal.h"
+#include "GlassEngine.h"
+#include "GlassRenderer.h"
+#include "SoftCanvas.h"
+#include "crack_decals.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+
+struct Line {
+  int x0, y0, x1, y1;
+};
+
+// GlassEngine の生成と同じく中心から放射し、先の方で枝分かれする線
+static std::vector<Line> makeLines(int count, GlassRandom& rng) {
+  std::vector<Line> lines;
+  std::vector<float> tipX, tipY, tipAngle;
+  while ((int)lines.size() < count) {
+    float x = CENTER_X, y = CENTER_Y, angle = rng.uniformFloat(0.0f, 6.2831853f), length = rng.uniformFloat(20.0f, 50.0f);
+    if (!tipX.empty() && rng.uniform(3) != 0) {
+      int from = rng.uniform((long)tipX.size());
+      x = tipX[from];
+      y = tipY[from];
+      angle = tipAngle[from] + rng.uniformFloat(-0.8f, 0.8f);
+      length *= 0.5f;
+    }
+    float ex = x + cosf(angle) * length, ey = y + sinf(angle) * length;
+    float dx = ex - CENTER_X, dy = ey - CENTER_Y;
+    if (dx * dx + dy * dy > 100.0f * 100.0f) continue;
+    lines.push_back({(int)x, (int)y, (int)ex, (int)ey});
+    tipX.push_back(ex);
+    tipY.push_back(ey);
+    tipAngle.push_back(angle);
+  }
+  return lines;
+}
+
+static bool writePpm(const std::string& path, const SoftCanvas& canvas) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", canvas.width(), canvas.height());
+  for (int y = 0; y < canvas.height(); y++) {
+    for (int x = 0; x < canvas.width(); x++) {
+      uint16_t c = canvas.readPixel(x, y);
+      uint8_t rgb[3] = {(uint8_t)((c >> 11) * 255 / 31), (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+                        (uint8_t)((c & 0x1F) * 255 / 31)};
+      fwrite(rgb, 1, 3, f);
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+static double elapsedUs(std::chrono::steady_clock::time_point since) {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - since).count();
+}
+
+int main(int argc, char** argv) {
+  int stamps = 10000;
+  int frames = 200;
+  std::vector<int> lineCounts = {16, 64, 256, 1024};
+  std::string outDir;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string opt = argv[i];
+    if (opt == "--stamps") {
+      stamps = atoi(argv[i + 1]);
+    } else if (opt == "--frames") {
+      frames = atoi(argv[i + 1]);
+    } else if (opt == "--lines") {
+      lineCounts.clear();
+      for (const char* p = argv[i + 1]; *p;) {
+        lineCounts.push_back(atoi(p));
+        while (*p && *p != ',') p++;
+        if (*p == ',') p++;
+      }
+    } else if (opt == "--out") {
+      outDir = argv[i + 1];
+    } else {
+      fprintf(stderr, "usage: %s [--stamps N] [--frames N] [--lines N,N,...] [--out DIR]\n", argv[0]);
+      return 1;
+    }
+  }
+  if (!outDir.empty()) mkdir(outDir.c_str(), 0755);
+
+  SoftCanvas canvas;
+  DecalLayer layer(CRACK_DECALS, GLASS_CLEAR_RADIUS);
+  const uint16_t color = SoftCanvas::color565(200, 210, 255);
+
+  // ========================================
+  // 型押し
+  // ========================================
+  const char* kindNames[DECAL_KIND_COUNT] = {"star", "chip"};
+  printf("%-5s %7s %11s %9s\n", "kind", "size", "us/stamp", "Mpx/s");
+  for (int kind = 0; kind < DECAL_KIND_COUNT; kind++) {
+    const DecalImage& image = CRACK_DECALS.images[kind * DECAL_ANGLES];
+    GlassRandom rng(3);
+    canvas.fillScreen(0);
+    auto t0 = std::chrono::steady_clock::now();
+    for (int s = 0; s < stamps; s++) {
+      float r = rng.uniformFloat(0.0f, 100.0f), a = rng.uniformFloat(0.0f, 6.2831853f);
+      layer.stamp(canvas, kind, rng.uniform(DECAL_ANGLES), (int)(CENTER_X + r * cosf(a)),
+                  (int)(CENTER_Y + r * sinf(a)), color, (uint8_t)rng.uniform(64, 256));
+    }
+    double us = elapsedUs(t0);
+    char size[16];
+    snprintf(size, sizeof(size), "%dx%d", image.width, image.height);
+    printf("%-5s %7s %11.2f %9.1f\n", kindNames[kind], size, us / stamps,
+           (double)image.width * image.height * stamps / us);
+  }
+
+  // ========================================
+  // 密度
+  // ========================================
+  printf("\n%7s %14s %14s\n", "lines", "lines us/frame", "decal us/frame");
+  for (int count : lineCounts) {
+    GlassRandom rng(9);
+    std::vector<Line> lines = makeLines(count, rng);
+    double linesUs = 0, decalUs = 0;
+    for (int f = 0; f < frames; f++) {
+      canvas.fillScreen(0);
+      auto t0 = std::chrono::steady_clock::now();
+      for (const Line& l : lines) canvas.drawLine(l.x0, l.y0, l.x1, l.y1, color);
+      linesUs += elapsedUs(t0);
+    }
+    if (!outDir.empty()) writePpm(outDir + "/lines_" + std::to_string(count) + ".ppm", canvas);
+    for (int f = 0; f < frames; f++) {
+      canvas.fillScreen(0);
+      auto t0 = std::chrono::steady_clock::now();
+      layer.stamp(canvas, DECAL_STAR, f % DECAL_ANGLES, CENTER_X, CENTER_Y, color, 255);
+      decalUs += elapsedUs(t0);
+    }
+    printf("%7d %14.1f %14.1f\n", count, linesUs / frames, decalUs / frames);
+  }
+  if (!outDir.empty()) writePpm(outDir + "/decal.ppm", canvas);
+
+  printf("\natlas %d images, %d bytes flash\n", DECAL_KIND_COUNT * DECAL_ANGLES, (int)sizeof(CRACK_DECAL_BITMAP));
+  return 0;
+}
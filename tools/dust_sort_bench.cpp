@@ -0,0 +1,256 @@
+/**
+ * dust_sort_bench - 粉塵の Z 順ソートの効果の計測
+ *
+ * 粉塵の数を変えて、同じ入力で Z 順ソートあり/なしの GlassEngine を並べて動かし、
+ * 1フレームあたりの時間（engine.step・密度グリッドへの splat・合成）と
+ * splat 中のキャッシュミスを比べる。
+ *
+ * キャッシュミスは2通り:
+ *   sim   splat が読み書きするアドレス列を ESP32-S3 のデータキャッシュ相当
+ *         （32KB・8ウェイ・32バイトライン、LRU）に通したミス率。PSRAM 上の
+ *         密度グリッドを想定した端末向けの目安
+ *   host  Linux の perf_event で数えたこのマシンのキャッシュミス（使えなければ n/a）
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -Iinclude -Itools tools/dust_sort_bench.cpp src/GlassEngine.cpp src/GlassFluid.cpp -o dust_sort_bench
+ * 例:
+ *   ./dust_sort_bench
+ *   ./dust_sort_bench --counts 1000,5000,20000,40000 --frames 900
+ */
+
+#include "GlassEngine.h"
+#include "GlassRenderer.h"
+#include "SoftCanvas.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// ========================================
+// ESP32-S3 のデータキャッシュのモデル
+// ========================================
+class CacheModel {
+public:
+  static const int LINE_BYTES = 32;
+  static const int WAYS = 8;
+  static const int SETS = 32 * 1024 / LINE_BYTES / WAYS;
+
+  CacheModel() { reset(); }
+
+  void reset() {
+    memset(tags, 0xFF, sizeof(tags));
+    memset(ages, 0, sizeof(ages));
+    clock = 0;
+    accesses = 0;
+    misses = 0;
+  }
+
+  void access(uintptr_t address) {
+    uintptr_t line = address / LINE_BYTES;
+    int set = (int)(line % SETS);
+    accesses++;
+    clock++;
+    int victim = 0;
+    for (int w = 0; w < WAYS; w++) {
+      if (tags[set][w] == line) {
+        ages[set][w] = clock;
+        return;
+      }
+      if (ages[set][w] < ages[set][victim]) victim = w;
+    }
+    misses++;
+    tags[set][victim] = line;
+    ages[set][victim] = clock;
+  }
+
+  uint64_t accesses, misses;
+
+private:
+  uintptr_t tags[SETS][WAYS];
+  uint64_t ages[SETS][WAYS];
+  uint64_t clock;
+};
+
+// DustField::splat と同じ位置計算で、粒の読み込みとグリッドの4セルを通す
+// （グリッドは 0 番地から、粒の配列はその後ろに置いたことにする）
+static void simulateSplat(CacheModel& cache, const std::vector<DustMote>& dust) {
+  const uintptr_t gridBase = 0;
+  const uintptr_t motesBase = DUST_GRID * DUST_GRID * sizeof(uint32_t) + 4096;
+  const int fixedScale = (1 << DUST_FRACTION_BITS) / DUST_SCALE;
+  for (size_t i = 0; i < dust.size(); i++) {
+    cache.access(motesBase + i * sizeof(DustMote));
+    int fx = (int)(dust[i].x * fixedScale) - (1 << DUST_FRACTION_BITS) / 2;
+    int fy = (int)(dust[i].y * fixedScale) - (1 << DUST_FRACTION_BITS) / 2;
+    int cx = fx >> DUST_FRACTION_BITS;
+    int cy = fy >> DUST_FRACTION_BITS;
+    if (cx < 0 || cy < 0 || cx >= DUST_GRID - 1 || cy >= DUST_GRID - 1) continue;
+    uintptr_t cell = gridBase + (cy * DUST_GRID + cx) * sizeof(uint32_t);
+    cache.access(cell);
+    cache.access(cell + sizeof(uint32_t));
+    cache.access(cell + DUST_GRID * sizeof(uint32_t));
+    cache.access(cell + (DUST_GRID + 1) * sizeof(uint32_t));
+  }
+}
+
+// ========================================
+// ホストのキャッシュミス（perf_event）
+// ========================================
+class HostMissCounter {
+public:
+  HostMissCounter() : fd(-1) {
+#ifdef __linux__
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+  }
+
+  bool available() const { return fd >= 0; }
+
+  void start() {
+#ifdef __linux__
+    if (fd < 0) return;
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+  }
+
+  uint64_t stop() {
+    uint64_t count = 0;
+#ifdef __linux__
+    if (fd < 0) return 0;
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    if (read(fd, &count, sizeof(count)) != sizeof(count)) count = 0;
+#endif
+    return count;
+  }
+
+private:
+  int fd;
+};
+
+// ========================================
+// 1条件分の計測
+// ========================================
+struct BenchResult {
+  size_t motes;
+  double stepUs, splatUs, compositeUs;
+  double simMissRate;
+  double hostMissesPerFrame;
+  int frames;
+};
+
+static double elapsedUs(std::chrono::steady_clock::time_point since) {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - since).count();
+}
+
+static BenchResult runBench(int count, bool sorted, int frames, HostMissCounter& host) {
+  GlassConfig config;
+  config.maxDust = count;
+  config.fluidDustShare = 0.0f;   // 全部を粒として持つ
+  config.dustFade = 1.0f;         // 計測の間に消えないように
+  config.autoRecoverTime = 1000000;
+  config.dustSortInterval = sorted ? GlassConfig().dustSortInterval : 0;
+
+  GlassEngine engine(config, 12345);
+  engine.reset(0);
+  SoftCanvas canvas;
+  DustField field(GLASS_DUST_RADIUS);
+  CacheModel cache;
+
+  // 激しく回して粉砕させる
+  unsigned long now = 0;
+  while (engine.currentState != SHATTER && now < 60000) {
+    now += 16;
+    engine.step({12, BUTTON_NONE}, now);
+  }
+
+  BenchResult r = {};
+  r.motes = engine.dust.size();
+  uint64_t hostMisses = 0;
+  for (int f = 0; f < frames && engine.dustLevel > 0.0f; f++) {
+    // ときどき回して流れを起こす（SHATTER のまま漂わせる）
+    now += 16;
+    auto t0 = std::chrono::steady_clock::now();
+    engine.step({(f / 60) % 3 == 0 ? 2 : 0, BUTTON_NONE}, now);
+    r.stepUs += elapsedUs(t0);
+
+    host.start();
+    t0 = std::chrono::steady_clock::now();
+    field.prepare(engine);
+    r.splatUs += elapsedUs(t0);
+    hostMisses += host.stop();
+
+    t0 = std::chrono::steady_clock::now();
+    field.composite(canvas, engine.dustLevel);
+    r.compositeUs += elapsedUs(t0);
+
+    cache.reset();
+    simulateSplat(cache, engine.dust);
+    r.simMissRate += cache.accesses ? (double)cache.misses / cache.accesses : 0.0;
+    r.frames++;
+  }
+  if (r.frames > 0) {
+    r.stepUs /= r.frames;
+    r.splatUs /= r.frames;
+    r.compositeUs /= r.frames;
+    r.simMissRate /= r.frames;
+    r.hostMissesPerFrame = (double)hostMisses / r.frames;
+  }
+  return r;
+}
+
+int main(int argc, char** argv) {
+  std::vector<int> counts = {1000, 5000, 20000};
+  int frames = 600;
+
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string opt = argv[i];
+    if (opt == "--counts") {
+      counts.clear();
+      for (char* p = argv[i + 1]; *p;) {
+        counts.push_back(atoi(p));
+        while (*p && *p != ',') p++;
+        if (*p == ',') p++;
+      }
+    } else if (opt == "--frames") {
+      frames = atoi(argv[i + 1]);
+    } else {
+      fprintf(stderr, "usage: %s [--counts N,N,...] [--frames N]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  HostMissCounter host;
+  printf("%-6s %7s %6s %9s %9s %10s %9s %12s\n", "order", "motes", "frames", "step us", "splat us",
+         "compose us", "sim miss", "host miss/f");
+  for (int count : counts) {
+    for (int sorted = 0; sorted < 2; sorted++) {
+      BenchResult r = runBench(count, sorted != 0, frames, host);
+      char hostText[32];
+      if (host.available()) snprintf(hostText, sizeof(hostText), "%.0f", r.hostMissesPerFrame);
+      else snprintf(hostText, sizeof(hostText), "n/a");
+      printf("%-6s %7zu %6d %9.1f %9.1f %10.1f %8.1f%% %12s\n", sorted ? "morton" : "spawn", r.motes,
+             r.frames, r.stepUs, r.splatUs, r.compositeUs, r.simMissRate * 100.0, hostText);
+    }
+  }
+  printf("\nstep us includes the radix sort every %d steps; sim miss = ESP32-S3 32KB/8-way/32B dcache model\n",
+         GlassConfig().dustSortInterval);
+  return 0;
+}
@@ -0,0 +1,166 @@
+/**
+ * energy_calibrate - 校正の記録と電力計の値から消費電力の係数（EnergyModel.h）を求める
+ *
+ * -DGLASSDIAL_ENERGY_CALIBRATE の端末は起動時に負荷の段階を順に流し、段階ごとの
+ * 活動量を "CAL,段階,名前,経過us,core0 us,core1 us,MHz,SPIバイト,バックライト,スピーカーus"
+ * としてシリアルに出す。その記録と、各段階の間に USB 電力計で読んだ平均電力 [mW] を
+ * 段階の順に与えると、各段階の平均電力 = 基本 + CPU + SPI + バックライト + スピーカー
+ * を最小二乗で解き、係数を表示して src/energy_calibration.h に書き出す
+ * （main.cpp はこのファイルがあれば既定の係数の代わりに使う）。
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -Iinclude -Isrc tools/energy_calibrate.cpp -o energy_calibrate
+ * 例:
+ *   ./energy_calibrate cal_log.txt 182,441,276,370,226,330
+ *   ./energy_calibrate cal_log.txt 182,441,276,370,226,330 out=/tmp/energy_calibration.h
+ */
+
+#include "EnergyModel.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+const int TERMS = 5;   // 基本・CPU・SPI・バックライト・スピーカー
+const char* const TERM_NAMES[TERMS] = {"baseMw", "coreActiveMw", "spiNanojoulesPerByte", "backlightMw", "speakerMw"};
+
+struct Phase {
+  std::string name;
+  EnergyActivity activity;
+  double measuredMw;
+};
+
+// 段階の平均電力 [mW] を係数の一次式として表したときの各項の重み。
+// estimateEnergy() を段階の長さで割ったものと同じ形にする
+static void phaseRow(const EnergyActivity& a, double row[TERMS]) {
+  double elapsedMs = a.elapsedMicros / 1000.0;
+  double busyMs = (a.coreBusyMicros[0] + a.coreBusyMicros[1]) / 1000.0;
+  row[0] = 1.0;
+  row[1] = busyMs * (a.cpuMhz / ENERGY_REFERENCE_MHZ) / elapsedMs;
+  row[2] = a.spiBytes / 1000.0 / elapsedMs;
+  row[3] = a.backlight / 255.0;
+  row[4] = a.speakerMicros / 1000.0 / elapsedMs;
+}
+
+static bool parseCalLine(const char* line, Phase& phase) {
+  int index;
+  char name[32];
+  unsigned long elapsed, core0, core1, mhz, spi, backlight, speaker;
+  if (sscanf(line, "CAL,%d,%31[^,],%lu,%lu,%lu,%lu,%lu,%lu,%lu", &index, name, &elapsed, &core0, &core1, &mhz, &spi,
+             &backlight, &speaker) != 9) {
+    return false;
+  }
+  if (elapsed == 0) return false;
+  phase.name = name;
+  phase.activity.elapsedMicros = (uint32_t)elapsed;
+  phase.activity.coreBusyMicros[0] = (uint32_t)core0;
+  phase.activity.coreBusyMicros[1] = (uint32_t)core1;
+  phase.activity.cpuMhz = (uint32_t)mhz;
+  phase.activity.spiBytes = (uint32_t)spi;
+  phase.activity.backlight = (uint8_t)backlight;
+  phase.activity.speakerMicros = (uint32_t)speaker;
+  phase.measuredMw = 0;
+  return true;
+}
+
+// 正規方程式 (AᵀA) x = Aᵀb を部分ピボット付きの消去で解く（解けなければ false）
+static bool solveLeastSquares(const std::vector<Phase>& phases, double x[TERMS]) {
+  double m[TERMS][TERMS + 1] = {};
+  for (const Phase& p : phases) {
+    double row[TERMS];
+    phaseRow(p.activity, row);
+    for (int i = 0; i < TERMS; i++) {
+      for (int j = 0; j < TERMS; j++) m[i][j] += row[i] * row[j];
+      m[i][TERMS] += row[i] * p.measuredMw;
+    }
+  }
+  for (int col = 0; col < TERMS; col++) {
+    int pivot = col;
+    for (int r = col + 1; r < TERMS; r++) {
+      if (fabs(m[r][col]) > fabs(m[pivot][col])) pivot = r;
+    }
+    if (fabs(m[pivot][col]) < 1e-12) return false;
+    for (int k = 0; k <= TERMS; k++) std::swap(m[col][k], m[pivot][k]);
+    for (int r = 0; r < TERMS; r++) {
+      if (r == col) continue;
+      double f = m[r][col] / m[col][col];
+      for (int k = col; k <= TERMS; k++) m[r][k] -= f * m[col][k];
+    }
+  }
+  for (int i = 0; i < TERMS; i++) x[i] = m[i][TERMS] / m[i][i];
+  return true;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s LOG mW,mW,... [out=src/energy_calibration.h]\n", argv[0]);
+    return 1;
+  }
+  std::string outPath = "src/energy_calibration.h";
+  for (int i = 3; i < argc; i++) {
+    if (strncmp(argv[i], "out=", 4) == 0) outPath = argv[i] + 4;
+  }
+
+  FILE* log = fopen(argv[1], "r");
+  if (!log) {
+    perror(argv[1]);
+    return 1;
+  }
+  std::vector<Phase> phases;
+  char line[256];
+  while (fgets(line, sizeof(line), log)) {
+    const char* cal = strstr(line, "CAL,");   // 行頭にタイムスタンプが付いていてもよい
+    Phase phase;
+    if (cal && parseCalLine(cal, phase)) phases.push_back(phase);
+  }
+  fclose(log);
+
+  std::vector<double> measured;
+  for (const char* p = argv[2]; *p;) {
+    char* end;
+    double v = strtod(p, &end);
+    if (end == p) break;
+    measured.push_back(v);
+    p = *end == ',' ? end + 1 : end;
+  }
+  if (phases.size() != measured.size()) {
+    fprintf(stderr, "%zu CAL phases in %s but %zu meter readings\n", phases.size(), argv[1], measured.size());
+    return 1;
+  }
+  if ((int)phases.size() < TERMS) {
+    fprintf(stderr, "need at least %d phases, got %zu\n", TERMS, phases.size());
+    return 1;
+  }
+  for (size_t i = 0; i < phases.size(); i++) phases[i].measuredMw = measured[i];
+
+  double x[TERMS];
+  if (!solveLeastSquares(phases, x)) {
+    fprintf(stderr, "phases do not separate the terms (is a phase missing?)\n");
+    return 1;
+  }
+  EnergyCoefficients c = {(float)x[0], (float)x[1], (float)x[2], (float)x[3], (float)x[4]};
+
+  printf("coefficients:\n");
+  for (int i = 0; i < TERMS; i++) printf("  %-22s %8.2f\n", TERM_NAMES[i], x[i]);
+  printf("%-10s %9s %9s %8s\n", "phase", "measured", "model", "resid");
+  for (const Phase& p : phases) {
+    double model = estimateEnergy(p.activity, c).total() / (p.activity.elapsedMicros / 1000.0);
+    printf("%-10s %9.1f %9.1f %+8.1f\n", p.name.c_str(), p.measuredMw, model, p.measuredMw - model);
+  }
+
+  FILE* out = fopen(outPath.c_str(), "w");
+  if (!out) {
+    perror(outPath.c_str());
+    return 1;
+  }
+  fprintf(out, "// tools/energy_calibrate.cpp で %s と電力計の値から生成（手で編集しない）\n", argv[1]);
+  fprintf(out, "#pragma once\n\n#include \"EnergyModel.h\"\n\n");
+  fprintf(out, "const EnergyCoefficients ENERGY_CALIBRATION = {%.2ff, %.2ff, %.3ff, %.2ff, %.2ff};\n", c.baseMw,
+          c.coreActiveMw, c.spiNanojoulesPerByte, c.backlightMw, c.speakerMw);
+  fclose(out);
+  printf("wrote %s\n", outPath.c_str());
+  return 0;
+}
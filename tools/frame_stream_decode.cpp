@@ -0,0 +1,194 @@
+/**
+ * frame_stream_decode - GlassDialのフレームストリームを受信してY4M動画に書き出す
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -Iinclude tools/frame_stream_decode.cpp -o frame_stream_decode
+ * 使い方:
+ *   ./frame_stream_decode /dev/ttyACM0 out.y4m [fps]
+ *   ffmpeg -i out.y4m out.mp4
+ *
+ * 入力はシリアルデバイスでも保存済みのダンプファイルでもよい（"-" で標準入力）。
+ * パケット以外のバイト列（端末のログ出力）は標準エラーへそのまま流す。
+ * 終了時（Ctrl+C または入力終端）に圧縮率と1フレームあたりのCPU時間を表示する。
+ */
+
+#include "FrameCodec.h"
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+static volatile sig_atomic_t stopRequested = 0;
+
+static void onSignal(int) { stopRequested = 1; }
+
+// シリアルデバイスならrawモードにする
+static void configureTty(int fd) {
+  if (!isatty(fd)) return;
+  termios tio;
+  if (tcgetattr(fd, &tio) != 0) return;
+  cfmakeraw(&tio);
+  tio.c_cc[VMIN] = 1;
+  tio.c_cc[VTIME] = 0;
+  tcsetattr(fd, TCSANOW, &tio);
+}
+
+static bool readExact(int fd, uint8_t* dst, size_t len) {
+  while (len > 0) {
+    ssize_t n = read(fd, dst, len);
+    if (n <= 0) return false;
+    dst += n;
+    len -= n;
+  }
+  return true;
+}
+
+// RGB565 → YUV 4:4:4 (BT.601 limited range)
+static void writeY4mFrame(FILE* out, const std::vector<uint16_t>& frame, bool swapped,
+                          std::vector<uint8_t>& planes) {
+  size_t pixels = frame.size();
+  planes.resize(pixels * 3);
+  for (size_t i = 0; i < pixels; i++) {
+    uint16_t c = frame[i];
+    if (swapped) c = (uint16_t)((c >> 8) | (c << 8));
+    int r = ((c >> 11) & 0x1F) * 255 / 31;
+    int g = ((c >> 5) & 0x3F) * 255 / 63;
+    int b = (c & 0x1F) * 255 / 31;
+    planes[i] = (uint8_t)((66 * r + 129 * g + 25 * b + 128) / 256 + 16);
+    planes[pixels + i] = (uint8_t)((-38 * r - 74 * g + 112 * b + 128) / 256 + 128);
+    planes[pixels * 2 + i] = (uint8_t)((112 * r - 94 * g - 18 * b + 128) / 256 + 128);
+  }
+  fputs("FRAME\n", out);
+  fwrite(planes.data(), 1, planes.size(), out);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s <device|file|-> <out.y4m> [fps]\n", argv[0]);
+    return 1;
+  }
+  int fps = argc > 3 ? atoi(argv[3]) : 50;
+
+  int fd = 0;
+  if (std::string(argv[1]) != "-") {
+    fd = open(argv[1], O_RDONLY | O_NOCTTY);
+    if (fd < 0) {
+      perror(argv[1]);
+      return 1;
+    }
+  }
+  configureTty(fd);
+
+  FILE* out = fopen(argv[2], "wb");
+  if (!out) {
+    perror(argv[2]);
+    return 1;
+  }
+
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+
+  std::vector<uint16_t> frame;
+  std::vector<uint8_t> payload, planes;
+  bool headerWritten = false;
+  bool synced = false;  // キーフレーム受信前の差分は捨てる
+  bool swapped = false;
+  uint32_t lastIndex = 0;
+
+  uint64_t framesDecoded = 0, framesWritten = 0, framesDropped = 0, badPackets = 0;
+  uint64_t rawBytes = 0, encodedBytes = 0, encodeMicros = 0, captureMicros = 0;
+  uint32_t maxEncodeMicros = 0;
+
+  size_t matched = 0;
+  while (!stopRequested) {
+    // マジックを探す。一致しなかったバイトはログとして流す
+    uint8_t b;
+    if (!readExact(fd, &b, 1)) break;
+    if (b != FRAME_PACKET_MAGIC[matched]) {
+      if (matched) fwrite(FRAME_PACKET_MAGIC, 1, matched, stderr);
+      matched = (b == FRAME_PACKET_MAGIC[0]) ? 1 : 0;
+      if (!matched) fputc(b, stderr);
+      continue;
+    }
+    if (++matched < 4) continue;
+    matched = 0;
+
+    FramePacketHeader header;
+    memcpy(header.magic, FRAME_PACKET_MAGIC, 4);
+    if (!readExact(fd, (uint8_t*)&header + 4, sizeof(header) - 4)) break;
+
+    size_t pixels = (size_t)header.width * header.height;
+    if (pixels == 0 || header.payloadBytes > frameDeltaBound(pixels)) {
+      badPackets++;
+      continue;
+    }
+    payload.resize(header.payloadBytes);
+    if (!readExact(fd, payload.data(), payload.size())) break;
+    if (frameChecksum(payload.data(), payload.size()) != header.checksum) {
+      badPackets++;
+      synced = false;
+      continue;
+    }
+
+    bool keyframe = header.flags & FRAME_FLAG_KEYFRAME;
+    if (!headerWritten) {
+      if (!keyframe) continue;
+      fprintf(out, "YUV4MPEG2 W%u H%u F%d:1 Ip A1:1 C444\n", header.width, header.height, fps);
+      headerWritten = true;
+    }
+    if (keyframe) {
+      frame.assign(pixels, 0);
+      synced = true;
+    }
+    if (!synced || frame.size() != pixels) continue;
+    if (!decodeFrameDelta(payload.data(), payload.size(), frame.data(), pixels)) {
+      badPackets++;
+      synced = false;
+      continue;
+    }
+    swapped = header.flags & FRAME_FLAG_SWAPPED;
+
+    // 間引かれたフレームは直前の画を繰り返して実時間を保つ
+    if (framesDecoded > 0 && header.frameIndex > lastIndex + 1) {
+      uint32_t gap = header.frameIndex - lastIndex - 1;
+      framesDropped += gap;
+      for (uint32_t i = 0; i < gap; i++) {
+        writeY4mFrame(out, frame, swapped, planes);
+        framesWritten++;
+      }
+    }
+    writeY4mFrame(out, frame, swapped, planes);
+    framesWritten++;
+    lastIndex = header.frameIndex;
+
+    framesDecoded++;
+    rawBytes += pixels * 2;
+    encodedBytes += sizeof(FramePacketHeader) + header.payloadBytes;
+    encodeMicros += header.encodeMicros;
+    captureMicros += header.captureMicros;
+    if (header.encodeMicros > maxEncodeMicros) maxEncodeMicros = header.encodeMicros;
+  }
+
+  fclose(out);
+
+  fprintf(stderr, "\n--- frame stream summary ---\n");
+  fprintf(stderr, "frames decoded : %llu (written %llu, dropped by bandwidth cap %llu, bad %llu)\n",
+          (unsigned long long)framesDecoded, (unsigned long long)framesWritten,
+          (unsigned long long)framesDropped, (unsigned long long)badPackets);
+  if (framesDecoded > 0) {
+    fprintf(stderr, "compression    : %.1f:1 (%.1f bytes/frame)\n",
+            (double)rawBytes / encodedBytes, (double)encodedBytes / framesDecoded);
+    fprintf(stderr, "encode cpu     : %.1f us/frame avg, %u us max (stream task, core 0)\n",
+            (double)encodeMicros / framesDecoded, maxEncodeMicros);
+    fprintf(stderr, "capture cpu    : %.1f us/frame avg (render task copy)\n",
+            (double)captureMicros / framesDecoded);
+  }
+  return 0;
+}
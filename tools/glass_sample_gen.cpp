@@ -0,0 +1,190 @@
+/**
+ * glass_sample_gen - 音程を変えて鳴らすガラス音と再標本化の係数表の生成
+ *
+ * SampleVoice（include/SampleVoice.h）が使う2つのヘッダを書き出す。
+ *   src/glass_sample.h     ガラスの「チリン」1つ（44.1kHz・16bit、前後に RESAMPLE_PAD 個の 0）
+ *   src/resample_table.h   ポリフェーズの係数表（Kaiser 窓つき sinc、Q15）
+ *
+ * ガラス音は打撃のノイズと、わずかにずれてうなる基音・非整数倍の部分音を
+ * 減衰させて重ねたもの。基音は GLASS_SAMPLE_PITCH で、音程比 1/8〜2 で鳴らす。
+ * 係数表は帯域ごとに遮断周波数を音程比の上限に合わせて下げ、各行の和が
+ * ちょうど 1.0（32768）になるよう丸める（直流の利得が音程で変わらない）。
+ *
+ * ビルド/実行:
+ *   g++ -O2 -std=c++17 -Iinclude tools/glass_sample_gen.cpp -o glass_sample_gen
+ *   ./glass_sample_gen src/glass_sample.h src/resample_table.h
+ */
+
+#include "SampleVoice.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+const double SAMPLE_PITCH = 4500.0;    // 基音 [Hz]
+const double SAMPLE_SECONDS = 0.35;
+const double FADE_SECONDS = 0.03;      // 終わりのフェードアウト
+const double PEAK = 0.7;               // 最大振幅（積和のあふれを防ぐ余裕）
+const double KAISER_BETA = 7.0;
+
+// 遮断周波数 = ナイキスト * PASSBAND / 音程比の上限。
+// 音程を上げる帯域は折り返しが可聴域に落ちないよう低めにする
+const double PASSBAND[RESAMPLE_BANDS] = {0.9, 0.8, 0.8, 0.8};
+
+// 部分音（基音比・音量・減衰時間 [s]）
+struct Partial {
+  double ratio, gain, decay;
+};
+static const Partial PARTIALS[] = {
+    {1.0, 1.0, 0.22},
+    {1.004, 0.6, 0.20},   // うなり
+    {2.32, 0.5, 0.10},
+    {2.335, 0.25, 0.09},
+    {4.25, 0.18, 0.04},
+};
+
+// ========================================
+// ガラス音
+// ========================================
+static std::vector<double> synthesizeGlass() {
+  const int length = (int)(SAMPLE_SECONDS * GRAIN_SAMPLE_RATE);
+  std::vector<double> out(length, 0.0);
+
+  for (const Partial& p : PARTIALS) {
+    double freq = SAMPLE_PITCH * p.ratio;
+    if (freq > GRAIN_SAMPLE_RATE * 0.45) continue;
+    for (int i = 0; i < length; i++) {
+      double t = (double)i / GRAIN_SAMPLE_RATE;
+      out[i] += p.gain * exp(-t / p.decay) * sin(2 * M_PI * freq * t);
+    }
+  }
+
+  // 打撃: 2ms の高域寄りのノイズ
+  srand(3);
+  double prev = 0.0;
+  const int strike = GRAIN_SAMPLE_RATE / 500;
+  for (int i = 0; i < strike; i++) {
+    double noise = rand() / (double)RAND_MAX * 2.0 - 1.0;
+    double high = noise - prev;
+    prev = noise;
+    out[i] += 0.35 * high * (1.0 - (double)i / strike);
+  }
+
+  // フェードアウトと正規化
+  const int fade = (int)(FADE_SECONDS * GRAIN_SAMPLE_RATE);
+  double peak = 0.0;
+  for (int i = 0; i < length; i++) {
+    if (i >= length - fade) out[i] *= 0.5 + 0.5 * cos(M_PI * (i - (length - fade)) / fade);
+    peak = std::max(peak, fabs(out[i]));
+  }
+  for (double& x : out) x *= PEAK / peak;
+  return out;
+}
+
+// ========================================
+// 係数表
+// ========================================
+static double besselI0(double x) {
+  double sum = 1.0, term = 1.0;
+  for (int k = 1; k < 50; k++) {
+    term *= (x / (2 * k)) * (x / (2 * k));
+    sum += term;
+  }
+  return sum;
+}
+
+// phase の行の taps 個（Q15、和が 32768）
+static std::vector<int16_t> buildPhase(int taps, double cutoff, int phase) {
+  const double frac = (double)phase / RESAMPLE_PHASES;
+  const double half = taps / 2.0;
+  std::vector<double> h(taps);
+  double sum = 0.0;
+  for (int k = 0; k < taps; k++) {
+    // 出力位置から標本 k までの距離（標本 k は整数部から taps/2 - 1 個前が先頭）
+    double d = frac + (taps / 2 - 1) - k;
+    double x = 2 * cutoff * d;
+    double sinc = fabs(x) < 1e-12 ? 1.0 : sin(M_PI * x) / (M_PI * x);
+    double w = fabs(d) < half ? besselI0(KAISER_BETA * sqrt(1.0 - (d / half) * (d / half))) / besselI0(KAISER_BETA) : 0.0;
+    h[k] = 2 * cutoff * sinc * w;
+    sum += h[k];
+  }
+
+  std::vector<int16_t> q(taps);
+  int total = 0, largest = 0;
+  for (int k = 0; k < taps; k++) {
+    q[k] = (int16_t)lrint(h[k] / sum * 32768.0);
+    total += q[k];
+    if (abs(q[k]) > abs(q[largest])) largest = k;
+  }
+  q[largest] += 32768 - total;  // 丸めの誤差を一番大きい係数へ
+  return q;
+}
+
+static void writeTable(FILE* f, int band) {
+  const int taps = RESAMPLE_TAPS[band];
+  const double maxRatio = RESAMPLE_BAND_RATIO[band];
+  const double cutoff = 0.5 * PASSBAND[band] / maxRatio;
+  fprintf(f, "// 音程比 <= %.2f: %d タップ、遮断 %.3f（元の標本化周波数に対する比）\n", maxRatio, taps, cutoff);
+  fprintf(f, "const int16_t RESAMPLE_TABLE_%d[%d][%d] = {\n", band, RESAMPLE_PHASES + 1, taps);
+  for (int p = 0; p <= RESAMPLE_PHASES; p++) {
+    std::vector<int16_t> q = buildPhase(taps, cutoff, p);
+    fprintf(f, "  {");
+    for (int k = 0; k < taps; k++) fprintf(f, "%s%d", k ? ", " : "", q[k]);
+    fprintf(f, "},\n");
+  }
+  fprintf(f, "};\n\n");
+}
+
+int main(int argc, char** argv) {
+  const char* samplePath = argc > 1 ? argv[1] : "src/glass_sample.h";
+  const char* tablePath = argc > 2 ? argv[2] : "src/resample_table.h";
+
+  // ガラス音
+  std::vector<double> glass = synthesizeGlass();
+  FILE* f = fopen(samplePath, "w");
+  if (!f) {
+    perror(samplePath);
+    return 1;
+  }
+  fprintf(f, "// 自動生成ファイル: tools/glass_sample_gen.cpp が出力。手で編集しないこと。\n");
+  fprintf(f, "#pragma once\n\n#include \"SampleVoice.h\"\n\n#include <stdint.h>\n\n");
+  fprintf(f, "const int GLASS_SAMPLE_LENGTH = %d;\n", (int)glass.size());
+  fprintf(f, "const float GLASS_SAMPLE_PITCH = %.1ff;\n\n", SAMPLE_PITCH);
+  fprintf(f, "// 前後に RESAMPLE_PAD 個の 0\n");
+  fprintf(f, "const int16_t GLASS_SAMPLE_DATA[%d] = {\n", (int)glass.size() + 2 * RESAMPLE_PAD);
+  std::vector<int16_t> padded(glass.size() + 2 * RESAMPLE_PAD, 0);
+  for (size_t i = 0; i < glass.size(); i++) padded[RESAMPLE_PAD + i] = (int16_t)lrint(glass[i] * 32767.0);
+  for (size_t i = 0; i < padded.size(); i++) {
+    fprintf(f, "%s%d,%s", i % 16 == 0 ? "  " : "", padded[i], i % 16 == 15 ? "\n" : " ");
+  }
+  fprintf(f, "\n};\n\n");
+  fprintf(f, "const SampleClip GLASS_SAMPLE = {GLASS_SAMPLE_DATA, GLASS_SAMPLE_LENGTH, GLASS_SAMPLE_PITCH};\n");
+  fclose(f);
+
+  // 係数表
+  f = fopen(tablePath, "w");
+  if (!f) {
+    perror(tablePath);
+    return 1;
+  }
+  fprintf(f, "// 自動生成ファイル: tools/glass_sample_gen.cpp が出力。手で編集しないこと。\n");
+  fprintf(f, "#pragma once\n\n#include <stdint.h>\n\n");
+  fprintf(f, "// [位相（0〜%d、最後は小数部 1.0）][タップ]、Kaiser 窓（beta %.1f）つき sinc、各行の和は 32768\n",
+          RESAMPLE_PHASES, KAISER_BETA);
+  for (int b = 0; b < RESAMPLE_BANDS; b++) writeTable(f, b);
+  fprintf(f, "const int16_t* const RESAMPLE_TABLES[%d] = {", RESAMPLE_BANDS);
+  for (int b = 0; b < RESAMPLE_BANDS; b++) fprintf(f, "%s&RESAMPLE_TABLE_%d[0][0]", b ? ", " : "", b);
+  fprintf(f, "};\n");
+  fclose(f);
+
+  printf("%s: %d samples (%.2f s, pitch %.0f Hz, %d bytes)\n", samplePath, (int)glass.size(),
+         glass.size() / (double)GRAIN_SAMPLE_RATE, SAMPLE_PITCH, (int)(padded.size() * sizeof(int16_t)));
+  int totalTaps = 0;
+  for (int b = 0; b < RESAMPLE_BANDS; b++) totalTaps += RESAMPLE_TAPS[b];
+  printf("%s: %d phases, %d bands, %d taps in all (%d bytes)\n", tablePath, RESAMPLE_PHASES, RESAMPLE_BANDS,
+         totalTaps, (int)((RESAMPLE_PHASES + 1) * totalTaps * sizeof(int16_t)));
+  return 0;
+}
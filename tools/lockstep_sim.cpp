@@ -0,0 +1,287 @@
+/**
+ * lockstep_sim - ロックステップ通信（Lockstep.h）を疑似端末でつないだ2台のホストで動かす
+ *
+ * --bridge  疑似端末を2つ作って名前を表示し、間でバイト列を中継する（UART の代わり）。
+ *           --baud で UART（8N1 = 1バイト10ビット）の速さに絞り、
+ *           --corrupt N で N バイトごとに1ビット化けさせる（CRC と食い違いの検出の確認用）。
+ * --port    1台ぶんのシミュレータ。合成入力を 16ms ごとに手元の入力として送り、
+ *           両方の入力を合わせて GlassEngine を進める。--frames まで進めたら、
+ *           通信量・往復時間・入力待ち・状態のチェックの結果と最後の状態のハッシュを表示する。
+ *           2台の最後のハッシュが同じなら同期できている（食い違いがあれば終了コード 1）。
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -Iinclude -Itools tools/lockstep_sim.cpp src/GlassEngine.cpp src/GlassFluid.cpp -o lockstep_sim
+ * 例:
+ *   ./lockstep_sim --bridge --baud 115200        # /dev/pts/5 /dev/pts/6 のように表示される
+ *   ./lockstep_sim --port /dev/pts/5 --seed 1 --frames 3600
+ *   ./lockstep_sim --port /dev/pts/6 --seed 2 --frames 3600
+ *
+ * オプション（--port）:
+ *   --seed N        この台の種（既定: プロセスID）。合成入力もこの種で作る
+ *   --frames N      進めるフレーム数（既定 3600 = 約1分）
+ *   --delay N       入力の遅れ（フレーム、既定 4）
+ *   --check N       状態のチェックの間隔（フレーム、既定 30）
+ */
+
+#include "GlassEngine.h"
+#include "Lockstep.h"
+#include "SessionInput.h"
+
+#include <chrono>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+static volatile sig_atomic_t stopRequested = 0;
+
+static void onSignal(int) { stopRequested = 1; }
+
+static void configureTty(int fd) {
+  if (!isatty(fd)) return;
+  termios tio;
+  if (tcgetattr(fd, &tio) != 0) return;
+  cfmakeraw(&tio);
+  tio.c_cc[VMIN] = 0;
+  tio.c_cc[VTIME] = 0;
+  tcsetattr(fd, TCSANOW, &tio);
+}
+
+static uint32_t elapsedMs(std::chrono::steady_clock::time_point since) {
+  return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - since)
+      .count();
+}
+
+static bool writeAll(int fd, const uint8_t* data, size_t length) {
+  while (length > 0) {
+    ssize_t n = write(fd, data, length);
+    if (n < 0) {
+      if (errno == EAGAIN || errno == EINTR) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        continue;
+      }
+      return false;
+    }
+    data += n;
+    length -= (size_t)n;
+  }
+  return true;
+}
+
+// ========================================
+// 中継（疑似端末の組）
+// ========================================
+struct BridgeSide {
+  int master;
+  int slave;     // 相手が閉じても master が EIO にならないよう、こちらでも開いておく
+  std::string name;
+  std::deque<uint8_t> queue;   // もう片方へまだ送っていないバイト
+  double allowance = 0;        // 今送ってよいバイト数（--baud のとき）
+  uint64_t relayed = 0;
+};
+
+static bool openPty(BridgeSide& side) {
+  side.master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (side.master < 0 || grantpt(side.master) != 0 || unlockpt(side.master) != 0) return false;
+  side.name = ptsname(side.master);
+  side.slave = open(side.name.c_str(), O_RDWR | O_NOCTTY);
+  if (side.slave < 0) return false;
+  configureTty(side.slave);   // 相手が開く前に届いたバイトがエコーされないように
+  fcntl(side.master, F_SETFL, O_NONBLOCK);
+  return true;
+}
+
+static int runBridge(int baud, int corruptEvery) {
+  BridgeSide sides[2];
+  for (BridgeSide& side : sides) {
+    if (!openPty(side)) {
+      perror("posix_openpt");
+      return 1;
+    }
+  }
+  printf("%s %s\n", sides[0].name.c_str(), sides[1].name.c_str());
+  fflush(stdout);
+
+  const double bytesPerMs = baud > 0 ? baud / 10.0 / 1000.0 : 0;
+  uint64_t corruptCount = 0, byteIndex = 0;
+  auto last = std::chrono::steady_clock::now();
+  while (!stopRequested) {
+    pollfd fds[2] = {{sides[0].master, POLLIN, 0}, {sides[1].master, POLLIN, 0}};
+    poll(fds, 2, 1);
+
+    for (int i = 0; i < 2; i++) {
+      uint8_t buf[512];
+      ssize_t n = read(sides[i].master, buf, sizeof(buf));
+      for (ssize_t k = 0; k < n; k++) {
+        uint8_t b = buf[k];
+        if (corruptEvery > 0 && ++byteIndex % (uint64_t)corruptEvery == 0) {
+          b ^= (uint8_t)(1 << (byteIndex / corruptEvery % 8));
+          corruptCount++;
+        }
+        sides[i].queue.push_back(b);
+      }
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(now - last).count();
+    last = now;
+    for (int i = 0; i < 2; i++) {
+      BridgeSide& from = sides[i];
+      size_t count = from.queue.size();
+      if (bytesPerMs > 0) {
+        // 送るものがない間は溜めない（UART は空いている間の分を先送りできない）
+        from.allowance = count ? from.allowance + ms * bytesPerMs : 0;
+        if ((double)count > from.allowance) count = (size_t)from.allowance;
+        from.allowance -= (double)count;
+      }
+      if (count == 0) continue;
+      std::vector<uint8_t> chunk(from.queue.begin(), from.queue.begin() + count);
+      from.queue.erase(from.queue.begin(), from.queue.begin() + count);
+      writeAll(sides[1 - i].master, chunk.data(), chunk.size());
+      from.relayed += count;
+    }
+  }
+  fprintf(stderr, "bridge: relayed %llu / %llu bytes, corrupted %llu\n", (unsigned long long)sides[0].relayed,
+          (unsigned long long)sides[1].relayed, (unsigned long long)corruptCount);
+  return 0;
+}
+
+// ========================================
+// 1台ぶんのシミュレータ
+// ========================================
+static int runInstance(const std::string& port, uint32_t seed, uint32_t frames, int delay, int checkInterval) {
+  int fd = open(port.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (fd < 0) {
+    perror(port.c_str());
+    return 1;
+  }
+  configureTty(fd);
+
+  const unsigned long frameMs = LOCKSTEP_FRAME_MS;
+  Session session = makeSyntheticSession(seed, (unsigned long)(frames + 600) * frameMs, frameMs);
+  LockstepLink link(seed, delay, checkInterval);
+  std::unique_ptr<GlassEngine> engine;
+  uint32_t finalHash = 0;
+  uint32_t connectedAt = 0, finishedAt = 0;
+  size_t tick = 0;
+  uint32_t stepsDone = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  uint32_t nextTick = 0;
+  while (!stopRequested) {
+    uint32_t now = elapsedMs(start);
+    if (now < nextTick) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(nextTick - now));
+      continue;
+    }
+    nextTick += (uint32_t)frameMs;
+
+    uint8_t buf[256];
+    ssize_t n;
+    while ((n = read(fd, buf, sizeof(buf))) > 0) link.receive(buf, (size_t)n, now);
+
+    GlassInput input = {0, BUTTON_NONE};
+    if (link.connected() && tick < session.steps.size()) input = session.steps[tick++].input;
+    link.sendLocal(input, now);
+
+    if (link.connected() && !engine) {
+      connectedAt = now;
+      engine.reset(new GlassEngine(GlassConfig(), link.sessionSeed()));
+      engine->reset(link.frameTime(0));
+      printf("connected: local seed %u, session seed %08x\n", seed, link.sessionSeed());
+    }
+    if (engine && !finishedAt) {
+      // つながってからの経過に追いつくまで進める（1回に3フレームまで）
+      uint32_t target = (now - connectedAt) / (uint32_t)frameMs + 1;
+      GlassInput combined;
+      for (int k = 0; k < 3 && link.frame < target && link.frame < frames && link.nextInput(combined); k++) {
+        engine->step(combined, link.frameTime(link.frame - 1));
+        link.checkState(engine->stateHash());
+        stepsDone++;
+      }
+      if (link.frame >= frames) {
+        finalHash = engine->stateHash();
+        finishedAt = now;
+      }
+    }
+
+    if (!link.outgoing.empty()) {
+      if (!writeAll(fd, link.outgoing.data(), link.outgoing.size())) break;
+      link.outgoing.clear();
+    }
+
+    // 終わってからも少しの間は受け取り続け、相手の最後のチェックを待つ
+    if (finishedAt && now - finishedAt > 500) break;
+    if (!link.connected() && now > 10000) {
+      fprintf(stderr, "no peer on %s\n", port.c_str());
+      return 1;
+    }
+  }
+  close(fd);
+
+  const LockstepStats& s = link.stats;
+  double seconds = (elapsedMs(start) - connectedAt) / 1000.0;
+  printf("frames:    %u stepped in %.1f s (%u stalls, input delay %d frames = %d ms)\n", stepsDone, seconds,
+         s.stalls, delay, delay * (int)frameMs);
+  printf("bandwidth: sent %.0f B/s (%u packets, %.1f B/packet), received %.0f B/s, bad packets %u\n",
+         s.bytesSent / seconds, s.packetsSent, s.packetsSent ? (double)s.bytesSent / s.packetsSent : 0.0,
+         s.bytesReceived / seconds, s.badPackets);
+  printf("rtt:       avg %.1f ms, max %u ms (%u samples)\n", s.rttCount ? (double)s.rttSumMs / s.rttCount : 0.0,
+         s.rttMaxMs, s.rttCount);
+  if (s.desyncFrame >= 0) printf("checks:    %u matched, DESYNC at frame %d\n", s.checksMatched, s.desyncFrame);
+  else printf("checks:    %u matched, no desync\n", s.checksMatched);
+  printf("state:     %08x at frame %u\n", finalHash, link.frame);
+  return s.desyncFrame >= 0 || link.frame < frames ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+  bool bridge = false;
+  std::string port;
+  int baud = 0, corruptEvery = 0, delay = 4, checkInterval = 30;
+  uint32_t seed = (uint32_t)getpid();
+  uint32_t frames = 3600;
+  for (int i = 1; i < argc; i++) {
+    std::string opt = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (opt == "--bridge") {
+      bridge = true;
+      continue;
+    }
+    if (!value) {
+      fprintf(stderr, "missing value for %s\n", opt.c_str());
+      return 1;
+    }
+    i++;
+    if (opt == "--port") port = value;
+    else if (opt == "--baud") baud = atoi(value);
+    else if (opt == "--corrupt") corruptEvery = atoi(value);
+    else if (opt == "--seed") seed = (uint32_t)strtoul(value, nullptr, 0);
+    else if (opt == "--frames") frames = (uint32_t)atoi(value);
+    else if (opt == "--delay") delay = atoi(value);
+    else if (opt == "--check") checkInterval = atoi(value);
+    else {
+      fprintf(stderr, "unknown option %s\n", opt.c_str());
+      return 1;
+    }
+  }
+  if (!bridge && port.empty()) {
+    fprintf(stderr, "usage: %s --bridge [--baud N] [--corrupt N]\n"
+                    "       %s --port PATH [--seed N] [--frames N] [--delay N] [--check N]\n",
+            argv[0], argv[0]);
+    return 1;
+  }
+
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  return bridge ? runBridge(baud, corruptEvery) : runInstance(port, seed, frames, delay, checkInterval);
+}
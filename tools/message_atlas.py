@@ -0,0 +1,100 @@
+"""
+message_atlas - 状態メッセージのグリフアトラス（src/message_atlas.h）を作り直す
+
+生成したアトラスはリポジトリに入れておき、普段のビルドはそれをそのまま使う
+（ネットワーク・FreeType・ホストのコンパイラは要らない）。
+作り直すのは、環境変数 GLASSDIAL_MESSAGE_FONT に日本語フォント（.otf / .ttf）を
+指定してビルドしたときだけ。PlatformIO の extra_scripts（pre:）として動き、
+フォントの中身（sha256）・ピクセルサイズ・生成器（tools/message_atlas_gen.cpp と
+include/MessageText.h）のどれかが、アトラスの先頭行に記録した値と違うときだけ
+ホストのコンパイラで message_atlas_gen を作って実行する。
+指定したのに作れなければビルドを止める。作り直したアトラスはコミットすること。
+
+例:
+  GLASSDIAL_MESSAGE_FONT=~/fonts/NotoSansJP-Regular.otf pio run -e m5stack-dial
+ホストに C++ コンパイラと FreeType（pkg-config freetype2）が要る。
+"""
+
+Import("env")  # noqa: F821  (SCons が与える)
+
+import hashlib
+import os
+import shlex
+import subprocess
+import sys
+
+PIXEL_SIZE = "18"
+STAMP_PREFIX = "// message_atlas: "
+
+
+def fail(message):
+    sys.stderr.write("message_atlas: %s\n" % message)
+    env.Exit(1)  # noqa: F821
+
+
+def sha256(path):
+    digest = hashlib.sha256()
+    with open(path, "rb") as f:
+        for block in iter(lambda: f.read(1 << 16), b""):
+            digest.update(block)
+    return digest.hexdigest()
+
+
+def pkg_config(option):
+    try:
+        out = subprocess.check_output(["pkg-config", option, "freetype2"], universal_newlines=True)
+    except (OSError, subprocess.CalledProcessError):
+        fail("FreeType not found (pkg-config freetype2); install libfreetype-dev or equivalent")
+    return shlex.split(out)
+
+
+def read_stamp(atlas):
+    if not os.path.isfile(atlas):
+        return None
+    with open(atlas, encoding="utf-8") as f:
+        line = f.readline().rstrip("\n")
+    return line[len(STAMP_PREFIX):] if line.startswith(STAMP_PREFIX) else None
+
+
+def build_atlas():
+    project = env.subst("$PROJECT_DIR")  # noqa: F821
+    atlas = os.path.join(project, "src", "message_atlas.h")
+    generator = os.path.join(project, "tools", "message_atlas_gen.cpp")
+    format_header = os.path.join(project, "include", "MessageText.h")
+
+    font = os.environ.get("GLASSDIAL_MESSAGE_FONT")
+    if not font:
+        if not os.path.isfile(atlas):
+            print("message_atlas: src/message_atlas.h is missing and GLASSDIAL_MESSAGE_FONT is not set; "
+                  "building without state messages")
+        return
+    font = os.path.expanduser(font)
+    if not os.path.isfile(font):
+        fail("GLASSDIAL_MESSAGE_FONT=%s does not exist" % font)
+
+    stamp = "font=%s size=%s generator=%s format=%s" % (sha256(font), PIXEL_SIZE, sha256(generator),
+                                                      sha256(format_header))
+    if read_stamp(atlas) == stamp:
+        return
+
+    build_dir = os.path.join(env.subst("$PROJECT_WORKSPACE_DIR"), "message_atlas")  # noqa: F821
+    os.makedirs(build_dir, exist_ok=True)
+    exe = os.path.join(build_dir, "message_atlas_gen")
+    cxx = os.environ.get("CXX", "c++")
+    command = ([cxx, "-O2", "-std=c++17", "-I" + os.path.join(project, "include")] + pkg_config("--cflags") +
+               [generator, "-o", exe] + pkg_config("--libs"))
+    if subprocess.call(command) != 0:
+        fail("cannot build %s" % generator)
+    generated = os.path.join(build_dir, "message_atlas.h")
+    if subprocess.call([exe, font, generated, PIXEL_SIZE]) != 0:
+        fail("message_atlas_gen failed with %s" % font)
+
+    # 先頭行に作ったときの値を残す（次のビルドで同じなら作り直さない）
+    with open(generated, encoding="utf-8") as f:
+        body = f.read()
+    with open(atlas, "w", encoding="utf-8") as f:
+        f.write(STAMP_PREFIX + stamp + "\n" + body)
+    print("message_atlas: wrote %s (commit it)" % atlas)
+
+
+build_atlas()
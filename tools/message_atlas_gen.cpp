@@ -0,0 +1,187 @@
+/**
+ * message_atlas_gen - 状態メッセージ用グリフアトラスの生成
+ *
+ * 下の MESSAGES に書いた文だけを日本語フォントから FreeType で
+ * ラスタライズし、4bpp のアンチエイリアス済みグリフとして
+ * src/message_atlas.h に書き出す。端末は全角フォントを持たずに済む。
+ * 生成したヘッダはコミットしておく。作り直しは、GLASSDIAL_MESSAGE_FONT を指定して
+ * ビルドすれば tools/message_atlas.py がしてくれるので、手で動かすのはフォントや
+ * 大きさを試すときだけ。
+ *
+ * ビルド/実行:
+ *   g++ -O2 -std=c++17 -Iinclude $(pkg-config --cflags freetype2) \
+ *       tools/message_atlas_gen.cpp -o message_atlas_gen $(pkg-config --libs freetype2)
+ *   ./message_atlas_gen NotoSansJP-Regular.otf src/message_atlas.h [ピクセルサイズ=18]
+ */
+
+#include "MessageText.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// ========================================
+// メッセージ（enum 名, 本文）。本文の "\n" で改行
+// ========================================
+struct MessageSource {
+  const char* id;
+  const char* text;
+};
+
+static const MessageSource MESSAGES[] = {
+  {"MESSAGE_SILENCE", "静けさのなかで\nかけらが光る"},
+  {"MESSAGE_RECOVERY", "触れる破壊、\n手の中の再生"},
+};
+
+static std::vector<uint32_t> decodeUtf8(const char* s) {
+  std::vector<uint32_t> out;
+  const uint8_t* p = (const uint8_t*)s;
+  while (*p) {
+    uint32_t c = *p++;
+    int extra = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+    if (extra) c &= 0x3F >> extra;
+    while (extra-- && (*p & 0xC0) == 0x80) c = (c << 6) | (*p++ & 0x3F);
+    out.push_back(c);
+  }
+  return out;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s font.(ttf|otf) out.h [pixel_size]\n", argv[0]);
+    return 1;
+  }
+  const char* fontPath = argv[1];
+  const char* outPath = argv[2];
+  int pixelSize = argc > 3 ? atoi(argv[3]) : 18;
+
+  FT_Library library;
+  FT_Face face;
+  if (FT_Init_FreeType(&library) || FT_New_Face(library, fontPath, 0, &face)) {
+    fprintf(stderr, "cannot open font: %s\n", fontPath);
+    return 1;
+  }
+  FT_Set_Pixel_Sizes(face, 0, pixelSize);
+
+  // 使う文字だけを集める（改行は除く）
+  const int messageCount = sizeof(MESSAGES) / sizeof(MESSAGES[0]);
+  std::vector<uint32_t> codepoints;
+  for (const auto& m : MESSAGES) {
+    for (uint32_t c : decodeUtf8(m.text)) {
+      if (c != '\n') codepoints.push_back(c);
+    }
+  }
+  std::sort(codepoints.begin(), codepoints.end());
+  codepoints.erase(std::unique(codepoints.begin(), codepoints.end()), codepoints.end());
+  if (codepoints.size() >= MESSAGE_NEWLINE) {
+    fprintf(stderr, "too many glyphs: %zu\n", codepoints.size());
+    return 1;
+  }
+
+  // 8bit の濃淡を 4bpp（2画素/バイト）に量子化
+  std::vector<MessageGlyph> glyphs;
+  std::vector<uint8_t> bitmap;
+  for (uint32_t c : codepoints) {
+    if (FT_Get_Char_Index(face, c) == 0) {
+      fprintf(stderr, "font has no glyph for U+%04X\n", c);
+      return 1;
+    }
+    if (FT_Load_Char(face, c, FT_LOAD_RENDER | FT_LOAD_TARGET_NORMAL)) {
+      fprintf(stderr, "cannot render U+%04X\n", c);
+      return 1;
+    }
+    FT_GlyphSlot slot = face->glyph;
+    const FT_Bitmap& bm = slot->bitmap;
+
+    MessageGlyph g;
+    g.left = (int8_t)slot->bitmap_left;
+    g.top = (int8_t)slot->bitmap_top;
+    g.width = (uint8_t)bm.width;
+    g.height = (uint8_t)bm.rows;
+    g.advance = (uint8_t)(slot->advance.x >> 6);
+    g.offset = (uint32_t)bitmap.size();
+
+    int stride = (bm.width + 1) / 2;
+    for (unsigned y = 0; y < bm.rows; y++) {
+      const uint8_t* row = bm.buffer + y * bm.pitch;
+      for (int b = 0; b < stride; b++) {
+        unsigned x = b * 2;
+        uint8_t hi = (row[x] * 15 + 127) / 255;
+        uint8_t lo = x + 1 < bm.width ? (row[x + 1] * 15 + 127) / 255 : 0;
+        bitmap.push_back((uint8_t)((hi << 4) | lo));
+      }
+    }
+    glyphs.push_back(g);
+  }
+
+  // メッセージ本文をグリフ番号の列へ
+  std::vector<uint8_t> text;
+  std::vector<uint16_t> offsets;
+  for (const auto& m : MESSAGES) {
+    offsets.push_back((uint16_t)text.size());
+    for (uint32_t c : decodeUtf8(m.text)) {
+      if (c == '\n') {
+        text.push_back(MESSAGE_NEWLINE);
+      } else {
+        size_t index = std::lower_bound(codepoints.begin(), codepoints.end(), c) - codepoints.begin();
+        text.push_back((uint8_t)index);
+      }
+    }
+  }
+  offsets.push_back((uint16_t)text.size());
+
+  int ascent = (int)(face->size->metrics.ascender >> 6);
+  int lineHeight = (int)(face->size->metrics.height >> 6);
+
+  FILE* out = fopen(outPath, "w");
+  if (!out) {
+    perror(outPath);
+    return 1;
+  }
+  fprintf(out, "// 自動生成ファイル: tools/message_atlas_gen.cpp が出力。手で編集しないこと。\n");
+  fprintf(out, "// フォント: %s (%dpx), %zu グリフ, アトラス %zu バイト\n",
+          face->family_name ? face->family_name : "?", pixelSize, glyphs.size(), bitmap.size());
+  fprintf(out, "#pragma once\n\n#include \"MessageText.h\"\n\n");
+
+  fprintf(out, "enum MessageId {\n");
+  for (const auto& m : MESSAGES) fprintf(out, "  %s,\n", m.id);
+  fprintf(out, "  MESSAGE_COUNT\n};\n\n");
+
+  fprintf(out, "const MessageGlyph MESSAGE_GLYPHS[%zu] = {\n", glyphs.size());
+  for (size_t i = 0; i < glyphs.size(); i++) {
+    const MessageGlyph& g = glyphs[i];
+    fprintf(out, "  {%d, %d, %u, %u, %u, %u},  // U+%04X\n", g.left, g.top, g.width, g.height,
+            g.advance, g.offset, codepoints[i]);
+  }
+  fprintf(out, "};\n\n");
+
+  fprintf(out, "const uint8_t MESSAGE_BITMAP[%zu] = {", bitmap.size());
+  for (size_t i = 0; i < bitmap.size(); i++) fprintf(out, "%s%u,", i % 24 ? "" : "\n  ", bitmap[i]);
+  fprintf(out, "\n};\n\n");
+
+  fprintf(out, "const uint8_t MESSAGE_TEXT[%zu] = {", text.size());
+  for (size_t i = 0; i < text.size(); i++) fprintf(out, "%s%u,", i % 24 ? " " : "\n  ", text[i]);
+  fprintf(out, "\n};\n\n");
+
+  fprintf(out, "const uint16_t MESSAGE_OFFSETS[%d] = {", messageCount + 1);
+  for (size_t i = 0; i < offsets.size(); i++) fprintf(out, " %u,", offsets[i]);
+  fprintf(out, " };\n\n");
+
+  fprintf(out, "const MessageFont MESSAGE_FONT = {\n");
+  fprintf(out, "  %d, %d, MESSAGE_GLYPHS, MESSAGE_BITMAP, MESSAGE_TEXT, MESSAGE_OFFSETS, MESSAGE_COUNT\n", ascent, lineHeight);
+  fprintf(out, "};\n");
+  fclose(out);
+
+  printf("%s: %zu glyphs, %zu bytes of 4bpp bitmap, %d messages\n", outPath, glyphs.size(),
+         bitmap.size(), messageCount);
+
+  FT_Done_Face(face);
+  FT_Done_FreeType(library);
+  return 0;
+}
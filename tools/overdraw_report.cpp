@@ -0,0 +1,263 @@
+/**
+ * overdraw_report - 状態・描画工程ごとの重ね塗りと塗り面積の集計
+ *
+ * セッションを GlassEngine で再生し、GlassRenderer.h を OverdrawGfx 越しに
+ * 描画して、画素ごとの書き込み回数と工程ごとのプリミティブ数を数える。
+ * Stateごとの平均（1フレームの書き込み画素数・重ね塗り率・工程の内訳）を表にし、
+ * Stateごとの平均書き込み回数をヒートマップ画像（PPM）で書き出す。
+ *
+ * 端末の計測ビルド（-DGLASSDIAL_OVERDRAW）がシリアルに出した
+ * "OD,行,16進" のダンプも --from-log でヒートマップ画像に変換できる。
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -pthread -Iinclude -Isrc -Itools tools/overdraw_report.cpp src/GlassEngine.cpp src/GlassFluid.cpp -o overdraw_report
+ * 例:
+ *   ./overdraw_report --synthetic 50 --out overdraw
+ *   ./overdraw_report --out overdraw session1.log
+ *   ./overdraw_report --from-log device.log --out overdraw
+ */
+
+#include "GlassEngine.h"
+#include "GlassGauge.h"
+#include "GlassRenderer.h"
+#include "OverdrawGfx.h"
+#include "SessionInput.h"
+#include "SoftCanvas.h"
+#include "crack_decals.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/stat.h>
+
+static const char* STATE_NAMES[STATE_COUNT] = {"NORMAL", "CRACK", "SHATTER", "SILENCE", "REBUILD", "RECOVERY"};
+
+const int PIXELS = SCREEN_WIDTH * SCREEN_HEIGHT;
+
+// ========================================
+// 集計（スレッドごとに持ち、最後に合算）
+// ========================================
+struct OverdrawTotals {
+  OverdrawStateStats states[STATE_COUNT];
+  uint64_t covered[STATE_COUNT];              // 1回以上書かれた画素数の合計
+  std::vector<uint32_t> heat[STATE_COUNT];    // 画素ごとの書き込み回数の合計
+
+  OverdrawTotals() {
+    memset(states, 0, sizeof(states));
+    memset(covered, 0, sizeof(covered));
+    for (auto& h : heat) h.assign(PIXELS, 0);
+  }
+
+  void merge(const OverdrawTotals& o) {
+    for (int s = 0; s < STATE_COUNT; s++) {
+      states[s].frames += o.states[s].frames;
+      for (int st = 0; st < STAGE_COUNT; st++) {
+        states[s].pixels[st] += o.states[s].pixels[st];
+        for (int p = 0; p < PRIM_COUNT; p++) states[s].primitives[st][p] += o.states[s].primitives[st][p];
+      }
+      covered[s] += o.covered[s];
+      for (int i = 0; i < PIXELS; i++) heat[s][i] += o.heat[s][i];
+    }
+  }
+};
+
+static bool writeHeatmap(const std::string& path, const uint8_t* counts) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+  for (int i = 0; i < PIXELS; i++) {
+    uint8_t rgb[3];
+    overdrawHeatColor(counts[i], rgb);
+    fwrite(rgb, 1, 3, f);
+  }
+  fclose(f);
+  return true;
+}
+
+// 端末のダンプ（"OD,y,16進480文字"）からヒートマップを作る
+static int convertDeviceLog(const char* path, const std::string& outDir) {
+  FILE* f = fopen(path, "r");
+  if (!f) {
+    perror(path);
+    return 1;
+  }
+  std::vector<uint8_t> counts(PIXELS, 0);
+  int rows = 0, dumps = 0;
+  char line[1024];
+  while (fgets(line, sizeof(line), f)) {
+    const char* p = strstr(line, "OD,");
+    if (!p) continue;
+    int y = atoi(p + 3);
+    const char* hex = strchr(p + 3, ',');
+    if (!hex || y < 0 || y >= SCREEN_HEIGHT) continue;
+    hex++;
+    for (int x = 0; x < SCREEN_WIDTH && hex[0] && hex[1]; x++, hex += 2) {
+      char byte[3] = {hex[0], hex[1], 0};
+      counts[y * SCREEN_WIDTH + x] = (uint8_t)strtol(byte, nullptr, 16);
+    }
+    rows++;
+    if (y == SCREEN_HEIGHT - 1) {
+      char name[64];
+      snprintf(name, sizeof(name), "/device_%03d.ppm", dumps++);
+      writeHeatmap(outDir + name, counts.data());
+    }
+  }
+  fclose(f);
+  printf("%s: %d rows, %d heatmaps written to %s\n", path, rows, dumps, outDir.c_str());
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  std::string outDir = "overdraw_out";
+  unsigned threadCount = std::max(1u, std::thread::hardware_concurrency());
+  int syntheticCount = 0;
+  double durationSec = 60;
+  int fps = 60;
+  const char* deviceLog = nullptr;
+  std::vector<std::string> inputs;
+
+  for (int i = 1; i < argc; i++) {
+    std::string opt = argv[i];
+    if (opt.rfind("--", 0) != 0) {
+      inputs.push_back(opt);
+      continue;
+    }
+    if (i + 1 >= argc) {
+      fprintf(stderr, "missing value for %s\n", opt.c_str());
+      return 1;
+    }
+    const char* val = argv[++i];
+    if (opt == "--out") outDir = val;
+    else if (opt == "--threads") threadCount = std::max(1, atoi(val));
+    else if (opt == "--synthetic") syntheticCount = atoi(val);
+    else if (opt == "--duration") durationSec = atof(val);
+    else if (opt == "--fps") fps = atoi(val);
+    else if (opt == "--from-log") deviceLog = val;
+    else {
+      fprintf(stderr, "unknown option %s\n", opt.c_str());
+      return 1;
+    }
+  }
+  mkdir(outDir.c_str(), 0755);
+
+  if (deviceLog) return convertDeviceLog(deviceLog, outDir);
+
+  if (inputs.empty() && syntheticCount == 0) {
+    fprintf(stderr, "usage: %s [--out DIR] [--threads N] [--synthetic N --duration SEC] [--fps N] session.log...\n"
+                    "       %s --from-log device.log [--out DIR]\n", argv[0], argv[0]);
+    return 1;
+  }
+
+  std::vector<Session> sessions;
+  for (const std::string& path : inputs) {
+    Session session;
+    if (!loadSession(path.c_str(), session)) {
+      fprintf(stderr, "%s: no IN records\n", path.c_str());
+      return 1;
+    }
+    sessions.push_back(std::move(session));
+  }
+  for (int i = 0; i < syntheticCount; i++) {
+    sessions.push_back(makeSyntheticSession(i + 1, (unsigned long)(durationSec * 1000), 1000 / fps));
+  }
+
+  // セッション単位で並列に再生・計測
+  OverdrawTotals totals;
+  std::mutex totalsMutex;
+  std::atomic<size_t> next(0);
+  std::vector<std::thread> workers;
+  for (unsigned t = 0; t < std::min<size_t>(threadCount, sessions.size()); t++) {
+    workers.emplace_back([&]() {
+      OverdrawTotals local;
+      SoftCanvas canvas;
+      std::vector<uint8_t> counts(PIXELS);
+      OverdrawGfx<SoftCanvas> gfx(canvas, counts.data());
+      DustField dust(GLASS_DUST_RADIUS);
+      DecalLayer decals(CRACK_DECALS, GLASS_CLEAR_RADIUS);
+
+      for (size_t k; (k = next.fetch_add(1)) < sessions.size();) {
+        const Session& session = sessions[k];
+        GlassEngine engine(GlassConfig(), session.seed);
+        engine.reset(session.startTime);
+        GlassGauge gauge;
+
+        for (const SessionStep& step : session.steps) {
+          engine.step(step.input, step.time);
+
+          gfx.beginFrame();
+          dust.prepare(engine);
+          renderGlass(gfx, engine, step.time, &dust, &decals);
+          markStage(gfx, STAGE_OVERLAY);
+          gauge.update(gfx, engine.destructionLevel);
+
+          int s = engine.currentState;
+          local.states[s].add(gfx.frame);
+          std::vector<uint32_t>& heat = local.heat[s];
+          uint32_t covered = 0;
+          for (int i = 0; i < PIXELS; i++) {
+            heat[i] += counts[i];
+            covered += counts[i] != 0;
+          }
+          local.covered[s] += covered;
+        }
+      }
+
+      std::lock_guard<std::mutex> lock(totalsMutex);
+      totals.merge(local);
+    });
+  }
+  for (auto& w : workers) w.join();
+
+  // ========================================
+  // 結果
+  // ========================================
+  printf("%-9s %7s %9s %7s %8s", "state", "frames", "px/frame", "screen", "overdraw");
+  for (int st = 0; st < STAGE_COUNT; st++) printf(" %9s", renderStageName(st));
+  printf("\n");
+
+  for (int s = 0; s < STATE_COUNT; s++) {
+    const OverdrawStateStats& st = totals.states[s];
+    if (st.frames == 0) continue;
+    double pxPerFrame = (double)st.totalPixels() / st.frames;
+    double coveredPerFrame = (double)totals.covered[s] / st.frames;
+    printf("%-9s %7u %9.0f %6.2fx %7.2fx", STATE_NAMES[s], st.frames, pxPerFrame,
+           pxPerFrame / PIXELS, coveredPerFrame > 0 ? pxPerFrame / coveredPerFrame : 0.0);
+    for (int g = 0; g < STAGE_COUNT; g++) {
+      printf(" %8.1f%%", st.totalPixels() ? 100.0 * st.pixels[g] / st.totalPixels() : 0.0);
+    }
+    printf("\n");
+
+    // 平均書き込み回数のヒートマップ
+    std::vector<uint8_t> mean(PIXELS);
+    for (int i = 0; i < PIXELS; i++) {
+      mean[i] = (uint8_t)std::min<uint32_t>(255, (totals.heat[s][i] + st.frames / 2) / st.frames);
+    }
+    writeHeatmap(outDir + "/overdraw_" + STATE_NAMES[s] + ".ppm", mean.data());
+  }
+
+  // 工程ごとのプリミティブ数（1フレーム平均）
+  printf("\nprimitives per frame (stage: type=count)\n");
+  for (int s = 0; s < STATE_COUNT; s++) {
+    const OverdrawStateStats& st = totals.states[s];
+    if (st.frames == 0) continue;
+    printf("%-9s", STATE_NAMES[s]);
+    for (int g = 0; g < STAGE_COUNT; g++) {
+      for (int p = 0; p < PRIM_COUNT; p++) {
+        if (st.primitives[g][p] == 0) continue;
+        printf(" %s:%s=%.1f", renderStageName(g), overdrawPrimitiveName(p),
+               (double)st.primitives[g][p] / st.frames);
+      }
+    }
+    printf("\n");
+  }
+  printf("\nheatmaps: %s/overdraw_<STATE>.ppm (black 0, blue 1, green 2, yellow 3, red 4, white 5+)\n",
+         outDir.c_str());
+  return 0;
+}
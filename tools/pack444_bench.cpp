@@ -0,0 +1,174 @@
+/**
+ * pack444_bench - 12ビット出力の詰め込み（PanelPack444.h）の検算と速度
+ *
+ * 検算  RGB565 の全 65,536 色を、ディザなし／ディザあり（4x4 の全位置）で詰め、
+ *       色ごとに割り算で求めた値と1ビットでも違えば失敗にする。
+ *       ディザありは 4x4 の平均が元の色（各4ビットの目盛りで）に近いことも確かめる。
+ * 速度  合成セッションを再生して描いたフレーム（--frame 番目）を
+ *       1画面ずつ詰める時間と、RGB565 との誤差（画素あたりの平均、最大）を表示する。
+ * 端末の関数をそのまま使うので、失敗したら終了コード 1。
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -Iinclude -Isrc -Itools tools/pack444_bench.cpp src/GlassEngine.cpp src/GlassFluid.cpp -o pack444_bench
+ * 例:
+ *   ./pack444_bench
+ *   ./pack444_bench --frame 1080 --repeat 2000
+ */
+
+#include "GlassEngine.h"
+#include "GlassRenderer.h"
+#include "PanelPack444.h"
+#include "SessionInput.h"
+#include "SoftCanvas.h"
+#include "crack_decals.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+static const char* STATE_NAMES[STATE_COUNT] = {"NORMAL", "CRACK", "SHATTER", "SILENCE", "REBUILD", "RECOVERY"};
+
+// 割り算で求める 4-4-4（ディザのしきい値 bayer は 0 ~ 15）
+static void reference444(uint16_t c, int bayer, int out[3]) {
+  int r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+  if (bayer >= 0) {
+    r += bayer >> 3;
+    g += bayer >> 2;
+    b += bayer >> 3;
+  }
+  out[0] = r / 2 > 15 ? 15 : r / 2;
+  out[1] = g / 4 > 15 ? 15 : g / 4;
+  out[2] = b / 2 > 15 ? 15 : b / 2;
+}
+
+static void unpack444(const uint8_t* bytes, int index, int out[3]) {
+  const uint8_t* p = bytes + index / 2 * 3;
+  uint32_t v = index & 1 ? ((p[1] & 0x0F) << 8) | p[2] : (p[0] << 4) | (p[1] >> 4);
+  out[0] = v >> 8;
+  out[1] = (v >> 4) & 0xF;
+  out[2] = v & 0xF;
+}
+
+static uint16_t stored(uint16_t c) { return (uint16_t)((c >> 8) | (c << 8)); }
+
+static double elapsedUs(std::chrono::steady_clock::time_point since) {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - since).count();
+}
+
+int main(int argc, char** argv) {
+  int frameIndex = 1080;
+  int repeat = 1000;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string opt = argv[i];
+    if (opt == "--frame") {
+      frameIndex = atoi(argv[i + 1]);
+    } else if (opt == "--repeat") {
+      repeat = atoi(argv[i + 1]);
+    } else {
+      fprintf(stderr, "usage: %s [--frame N] [--repeat N]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  // ========================================
+  // 検算
+  // ========================================
+  // 1行 = 4x4 の1行ぶんのしきい値がそろうよう、全色を4画素ずつ並べる
+  std::vector<uint16_t> colors(65536 * 4);
+  for (int c = 0; c < 65536; c++) {
+    for (int k = 0; k < 4; k++) colors[c * 4 + k] = stored((uint16_t)c);
+  }
+  std::vector<uint8_t> packed(panelPack444Bytes(colors.size()));
+  PanelDither444 dither;
+  int failures = 0;
+
+  panelPack444Row(colors.data(), packed.data(), (int)colors.size());
+  for (size_t i = 0; i < colors.size() && failures < 10; i++) {
+    int want[3], got[3];
+    reference444((uint16_t)(i / 4), -1, want);
+    unpack444(packed.data(), (int)i, got);
+    if (want[0] != got[0] || want[1] != got[1] || want[2] != got[2]) {
+      printf("FAIL plain  color %04zx: want %x%x%x got %x%x%x\n", i / 4, want[0], want[1], want[2],
+             got[0], got[1], got[2]);
+      failures++;
+    }
+  }
+
+  double worstMean = 0;
+  std::vector<double> sums(65536 * 3, 0.0);
+  for (int y = 0; y < 4; y++) {
+    panelPack444RowDither(colors.data(), packed.data(), (int)colors.size(), y, dither);
+    for (size_t i = 0; i < colors.size() && failures < 10; i++) {
+      int want[3], got[3];
+      reference444((uint16_t)(i / 4), PANEL_BAYER4[y][i & 3], want);
+      unpack444(packed.data(), (int)i, got);
+      if (want[0] != got[0] || want[1] != got[1] || want[2] != got[2]) {
+        printf("FAIL dither color %04zx y %d x %zu: want %x%x%x got %x%x%x\n", i / 4, y, i & 3,
+               want[0], want[1], want[2], got[0], got[1], got[2]);
+        failures++;
+      }
+      for (int ch = 0; ch < 3; ch++) sums[i / 4 * 3 + ch] += got[ch];
+    }
+  }
+  // 4x4 の平均と元の色の差（飽和する最上位の目盛りは除く）
+  for (int c = 0; c < 65536; c++) {
+    double exact[3] = {(c >> 11) / 2.0, ((c >> 5) & 0x3F) / 4.0, (c & 0x1F) / 2.0};
+    for (int ch = 0; ch < 3; ch++) {
+      if (exact[ch] > 15.0) continue;
+      worstMean = std::max(worstMean, std::fabs(sums[c * 3 + ch] / 16.0 - exact[ch]));
+    }
+  }
+  printf("check: %s (dither mean error <= %.3f of a 4-bit step)\n", failures ? "FAILED" : "ok", worstMean);
+
+  // ========================================
+  // 速度
+  // ========================================
+  Session session = makeSyntheticSession(1, (unsigned long)(frameIndex + 1) * 16, 16);
+  GlassEngine engine(GlassConfig(), session.seed);
+  engine.reset(session.startTime);
+  for (const SessionStep& step : session.steps) engine.step(step.input, step.time);
+  SoftCanvas canvas;
+  DustField dust(GLASS_DUST_RADIUS);
+  DecalLayer decals(CRACK_DECALS, GLASS_CLEAR_RADIUS);
+  dust.prepare(engine);
+  renderGlass(canvas, engine, session.steps.back().time, &dust, &decals);
+  const uint16_t* frame = (const uint16_t*)canvas.getBuffer();
+
+  std::vector<uint8_t> out(panelPack444Bytes(SCREEN_WIDTH * SCREEN_HEIGHT));
+  printf("\nframe %d (%s), %d x %d: RGB565 %d bytes -> 12-bit %d bytes\n", frameIndex,
+         STATE_NAMES[engine.currentState], SCREEN_WIDTH, SCREEN_HEIGHT,
+         SCREEN_WIDTH * SCREEN_HEIGHT * 2, (int)out.size());
+  printf("%-7s %12s %10s %10s\n", "mode", "us/frame", "mean err", "max err");
+  for (int mode = 0; mode < 2; mode++) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeat; r++) {
+      for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        uint8_t* row = out.data() + panelPack444Bytes(y * SCREEN_WIDTH);
+        if (mode == 0) panelPack444Row(frame + y * SCREEN_WIDTH, row, SCREEN_WIDTH);
+        else panelPack444RowDither(frame + y * SCREEN_WIDTH, row, SCREEN_WIDTH, y, dither);
+      }
+    }
+    double us = elapsedUs(t0) / repeat;
+
+    // 誤差は 8ビットの目盛りで（4ビットの値を 17 倍に戻して比べる）
+    double sum = 0;
+    int worst = 0;
+    for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
+      uint16_t c = stored(frame[i]);
+      int orig[3] = {(c >> 11) * 255 / 31, ((c >> 5) & 0x3F) * 255 / 63, (c & 0x1F) * 255 / 31};
+      int got[3];
+      unpack444(out.data(), i, got);
+      for (int ch = 0; ch < 3; ch++) {
+        int e = abs(got[ch] * 17 - orig[ch]);
+        sum += e;
+        if (e > worst) worst = e;
+      }
+    }
+    printf("%-7s %12.1f %10.2f %10d\n", mode ? "dither" : "plain", us, sum / (SCREEN_WIDTH * SCREEN_HEIGHT * 3),
+           worst);
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,116 @@
+/**
+ * pane_bench - 奥に重ねたガラス（GlassPanes.h）の1フレームのコスト
+ *
+ * 合成入力のセッションを --panes 枚で再生し、奥の板があるフレームごとに
+ *   draw     PaneStack::draw の時間と、打った画素数（OverdrawGfx で数える）
+ *   clear    renderGlass の消去（GLASS_CLEAR_RADIUS の fillCircle）の時間（比較用）
+ *   same     奥の板の revision・視差のずれ・activePane が前フレームと同じだった割合
+ * を表示する。same は「奥の板を画像として取っておいて使い回す」ときに
+ * 描き直しを省けるフレームの上限（フレームバッファは毎フレーム消すので、
+ * 使い回すにも消去円ぶんの写しが要る）。
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -Iinclude -Isrc -Itools tools/pane_bench.cpp src/GlassEngine.cpp src/GlassFluid.cpp -o pane_bench
+ * 例:
+ *   ./pane_bench
+ *   ./pane_bench --sessions 50 --duration 120 --panes 2
+ */
+
+#include "GlassEngine.h"
+#include "GlassPanes.h"
+#include "OverdrawGfx.h"
+#include "SessionInput.h"
+#include "SoftCanvas.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+static double elapsedUs(std::chrono::steady_clock::time_point since) {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - since).count();
+}
+
+int main(int argc, char** argv) {
+  int sessions = 20;
+  double durationSec = 60;
+  int paneCount = 3;
+
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string opt = argv[i];
+    const char* val = argv[i + 1];
+    if (opt == "--sessions") sessions = std::max(1, atoi(val));
+    else if (opt == "--duration") durationSec = atof(val);
+    else if (opt == "--panes") paneCount = std::max(2, std::min(MAX_PANES, atoi(val)));
+    else {
+      fprintf(stderr, "usage: %s [--sessions N] [--duration SEC] [--panes N]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  SoftCanvas canvas;
+  std::vector<uint8_t> counts(SCREEN_WIDTH * SCREEN_HEIGHT);
+  OverdrawGfx<SoftCanvas> counter(canvas, counts.data());
+  PaneStack panes(GLASS_CLEAR_RADIUS);
+
+  long frames = 0, paneFrames = 0, sameFrames = 0;
+  double drawUs = 0, clearUs = 0;
+  uint64_t pixels = 0;
+
+  for (int s = 0; s < sessions; s++) {
+    Session session = makeSyntheticSession(s + 1, (unsigned long)(durationSec * 1000), 17);
+    GlassConfig config;
+    config.paneCount = paneCount;
+    GlassEngine engine(config, session.seed);
+    engine.reset(session.startTime);
+    panes.invalidate();
+
+    int shownActive = -1;
+    int shownOffset[MAX_PANES] = {};
+    uint32_t shownRevision[MAX_PANES] = {};
+
+    for (const SessionStep& step : session.steps) {
+      engine.step(step.input, step.time);
+      frames++;
+
+      auto start = std::chrono::steady_clock::now();
+      canvas.fillCircle(CENTER_X, CENTER_Y, GLASS_CLEAR_RADIUS, 0);
+      clearUs += elapsedUs(start);
+
+      if (engine.activePane + 1 >= paneCount) continue;
+      paneFrames++;
+
+      bool same = shownActive == engine.activePane;
+      for (int pane = engine.activePane + 1; pane < paneCount; pane++) {
+        int offset = (int)lroundf(engine.paneOffset(pane));
+        if (offset != shownOffset[pane] || engine.panes[pane].revision != shownRevision[pane]) same = false;
+        shownOffset[pane] = offset;
+        shownRevision[pane] = engine.panes[pane].revision;
+      }
+      shownActive = engine.activePane;
+      if (same) sameFrames++;
+
+      start = std::chrono::steady_clock::now();
+      panes.draw(canvas, engine);
+      drawUs += elapsedUs(start);
+
+      counter.beginFrame();
+      panes.draw(counter, engine);
+      for (uint8_t c : counts) pixels += c;
+    }
+  }
+
+  if (paneFrames == 0) {
+    printf("no frame had back panes\n");
+    return 0;
+  }
+  printf("%d panes, %d sessions x %.0f s: %ld frames, %ld with back panes\n", paneCount, sessions, durationSec,
+         frames, paneFrames);
+  printf("draw   %8.2f us/frame  %6.0f px/frame\n", drawUs / paneFrames, (double)pixels / paneFrames);
+  printf("clear  %8.2f us/frame\n", clearUs / frames);
+  printf("same   %7.1f%% of frames, %d rebuilds\n", sameFrames * 100.0 / paneFrames, panes.rebuilds);
+  return 0;
+}
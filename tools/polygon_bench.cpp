@@ -0,0 +1,262 @@
+/**
+ * polygon_bench - 破片の多角形の塗り（GlassPolygon.h）と三角形分割 + fillTriangle の比較
+ *
+ * 画面の円の中にばらばらな大きさ・向きの破片（凹多角形を含む 4〜9 角形）を
+ * --shards 個ずつ置いたフレームを用意し、同じ破片を
+ *   aa     PolygonRaster（解析的な被覆のアンチエイリアス、帯ごとの描画）
+ *   tri    耳切りで三角形に分け、fillTriangle（M5GFX と同じく行ごとに hline で塗る
+ *          整数の辺の補間、縁はぎざぎざ）で塗る
+ * で描いて1フレームの時間を比べる。耳切りは破片の形が変わらなければ
+ * 使い回せるので時間に含めない（tri に有利な比べ方）。端末の fillTriangle は
+ * 1本ごとに描画先の関数呼び出しの手間が加わるので、差はホストより開く。
+ *
+ * 正しさの確認として、aa の被覆の合計（画素の明るさから逆算）と
+ * 多角形の面積（頂点から解析的に計算）の差も表示する。
+ * --out を付けると最後のフレームを aa.ppm / tri.ppm に書き出す。
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -Iinclude -Itools tools/polygon_bench.cpp src/GlassEngine.cpp src/GlassFluid.cpp -o polygon_bench
+ * 例:
+ *   ./polygon_bench
+ *   ./polygon_bench --shards 50,100,200,400 --frames 300 --out polygons
+ */
+
+#include "GlassEngine.h"
+#include "GlassPolygon.h"
+#include "GlassRenderer.h"
+#include "SoftCanvas.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+
+struct Shard {
+  std::vector<PolygonPoint> points;
+  std::vector<int> triangles;   // 耳切りの結果（頂点番号 3 つずつ）
+  uint16_t color;
+};
+
+// ========================================
+// 破片の生成
+// ========================================
+static Shard makeShard(GlassRandom& rng) {
+  Shard s;
+  float radius = rng.uniformFloat(0.0f, 95.0f);
+  float direction = rng.uniformFloat(0.0f, 6.2831853f);
+  float cx = CENTER_X + radius * cosf(direction);
+  float cy = CENTER_Y + radius * sinf(direction);
+  float size = rng.uniformFloat(5.0f, 22.0f);
+  int count = rng.uniform(4, 10);
+
+  // 中心のまわりに角度を少しずつずらして頂点を置く（角の間隔が半周未満なので自己交差しない）。
+  // 半径がばらつくので凹んだ頂点もできる
+  for (int i = 0; i < count; i++) {
+    float angle = 6.2831853f * (i + rng.uniformFloat(0.0f, 0.8f)) / count;
+    float r = size * rng.uniformFloat(0.3f, 1.0f);
+    s.points.push_back({cx + r * cosf(angle), cy + r * sinf(angle)});
+  }
+  uint8_t b = (uint8_t)rng.uniform(120, 256);
+  s.color = SoftCanvas::color565(b * 3 / 4, b * 4 / 5, b);
+  return s;
+}
+
+static float cross(const PolygonPoint& o, const PolygonPoint& a, const PolygonPoint& b) {
+  return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+static double polygonArea(const std::vector<PolygonPoint>& p) {
+  double twice = 0;
+  for (size_t i = 0; i < p.size(); i++) {
+    const PolygonPoint& a = p[i];
+    const PolygonPoint& b = p[(i + 1) % p.size()];
+    twice += (double)a.x * b.y - (double)b.x * a.y;
+  }
+  return fabs(twice) / 2.0;
+}
+
+// 耳切り（O(n^3) だが頂点は 10 未満）
+static void triangulate(Shard& s) {
+  std::vector<int> index(s.points.size());
+  for (size_t i = 0; i < index.size(); i++) index[i] = (int)i;
+  double twice = 0;
+  for (size_t i = 0; i < s.points.size(); i++) {
+    const PolygonPoint& a = s.points[i];
+    const PolygonPoint& b = s.points[(i + 1) % s.points.size()];
+    twice += (double)a.x * b.y - (double)b.x * a.y;
+  }
+  float orientation = twice > 0 ? 1.0f : -1.0f;
+
+  while (index.size() > 3) {
+    bool clipped = false;
+    for (size_t i = 0; i < index.size(); i++) {
+      int ia = index[(i + index.size() - 1) % index.size()], ib = index[i], ic = index[(i + 1) % index.size()];
+      const PolygonPoint &a = s.points[ia], &b = s.points[ib], &c = s.points[ic];
+      if (cross(a, b, c) * orientation <= 0) continue;   // 凹んだ頂点
+      bool inside = false;
+      for (int j : index) {
+        if (j == ia || j == ib || j == ic) continue;
+        const PolygonPoint& p = s.points[j];
+        if (cross(a, b, p) * orientation >= 0 && cross(b, c, p) * orientation >= 0 &&
+            cross(c, a, p) * orientation >= 0) {
+          inside = true;
+          break;
+        }
+      }
+      if (inside) continue;
+      s.triangles.insert(s.triangles.end(), {ia, ib, ic});
+      index.erase(index.begin() + i);
+      clipped = true;
+      break;
+    }
+    if (!clipped) break;   // 数値誤差で耳が見つからない（退化した形）
+  }
+  if (index.size() == 3) s.triangles.insert(s.triangles.end(), {index[0], index[1], index[2]});
+}
+
+// ========================================
+// 比較用: 整数の fillTriangle
+// ========================================
+static void fillTriangle(SoftCanvas& gfx, int x0, int y0, int x1, int y1, int x2, int y2, uint16_t color) {
+  if (y0 > y1) std::swap(y0, y1), std::swap(x0, x1);
+  if (y1 > y2) std::swap(y1, y2), std::swap(x1, x2);
+  if (y0 > y1) std::swap(y0, y1), std::swap(x0, x1);
+  if (y0 == y2) {
+    int a = std::min({x0, x1, x2}), b = std::max({x0, x1, x2});
+    gfx.drawFastHLine(a, y0, b - a + 1, color);
+    return;
+  }
+  int dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+  int sa = 0, sb = 0;
+  int last = y1 == y2 ? y1 : y1 - 1;
+  int y = y0;
+  for (; y <= last; y++) {
+    int a = x0 + sa / dy01, b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b) std::swap(a, b);
+    gfx.drawFastHLine(a, y, b - a + 1, color);
+  }
+  sa = dx12 * (y - y1);
+  sb = dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    int a = x1 + sa / dy12, b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b) std::swap(a, b);
+    gfx.drawFastHLine(a, y, b - a + 1, color);
+  }
+}
+
+static bool writePpm(const std::string& path, const SoftCanvas& canvas) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", canvas.width(), canvas.height());
+  for (int y = 0; y < canvas.height(); y++) {
+    for (int x = 0; x < canvas.width(); x++) {
+      uint16_t c = canvas.readPixel(x, y);
+      uint8_t rgb[3] = {(uint8_t)((c >> 11) * 255 / 31), (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+                        (uint8_t)((c & 0x1F) * 255 / 31)};
+      fwrite(rgb, 1, 3, f);
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  std::vector<int> counts = {50, 100, 200};
+  int frames = 200;
+  std::string outDir;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string opt = argv[i];
+    if (opt == "--shards") {
+      counts.clear();
+      for (const char* p = argv[i + 1]; *p;) {
+        counts.push_back(atoi(p));
+        while (*p && *p != ',') p++;
+        if (*p == ',') p++;
+      }
+    } else if (opt == "--frames") {
+      frames = atoi(argv[i + 1]);
+    } else if (opt == "--out") {
+      outDir = argv[i + 1];
+    } else {
+      fprintf(stderr, "usage: %s [--shards N,N,...] [--frames N] [--out DIR]\n", argv[0]);
+      return 1;
+    }
+  }
+  if (!outDir.empty()) mkdir(outDir.c_str(), 0755);
+
+  printf("%7s %9s %12s %12s %8s %12s\n", "shards", "triangles", "aa us/frame", "tri us/frame", "speedup",
+         "area error");
+  for (int count : counts) {
+    // 毎フレーム別の配置（同じ列を aa と tri で使う）
+    const int layouts = 16;
+    GlassRandom rng(5);
+    std::vector<std::vector<Shard>> scenes(layouts);
+    size_t triangles = 0;
+    for (auto& scene : scenes) {
+      for (int i = 0; i < count; i++) {
+        scene.push_back(makeShard(rng));
+        triangulate(scene.back());
+        triangles += scene.back().triangles.size() / 3;
+      }
+    }
+
+    SoftCanvas aaCanvas, triCanvas;
+    PolygonRaster raster(GLASS_CLEAR_RADIUS, count, count * 10);
+    double aaUs = 0, triUs = 0;
+    for (int f = 0; f < frames; f++) {
+      const std::vector<Shard>& scene = scenes[f % layouts];
+      aaCanvas.fillScreen(0);
+      triCanvas.fillScreen(0);
+
+      auto t0 = std::chrono::steady_clock::now();
+      for (const Shard& s : scene) raster.add(s.points.data(), (int)s.points.size(), s.color);
+      raster.flush(aaCanvas);
+      auto t1 = std::chrono::steady_clock::now();
+      for (const Shard& s : scene) {
+        for (size_t t = 0; t + 2 < s.triangles.size(); t += 3) {
+          const PolygonPoint &a = s.points[s.triangles[t]], &b = s.points[s.triangles[t + 1]],
+                             &c = s.points[s.triangles[t + 2]];
+          fillTriangle(triCanvas, (int)a.x, (int)a.y, (int)b.x, (int)b.y, (int)c.x, (int)c.y, s.color);
+        }
+      }
+      auto t2 = std::chrono::steady_clock::now();
+      aaUs += std::chrono::duration<double, std::micro>(t1 - t0).count();
+      triUs += std::chrono::duration<double, std::micro>(t2 - t1).count();
+    }
+
+    // 被覆の確認: 白い破片1つずつを黒に塗り、明るさの合計を面積と比べる
+    SoftCanvas check;
+    double coveredSum = 0, areaSum = 0;
+    for (const Shard& s : scenes[0]) {
+      float dx = s.points[0].x - CENTER_X, dy = s.points[0].y - CENTER_Y;
+      if (dx * dx + dy * dy > 80.0f * 80.0f) continue;   // 円のクリップにかかるものは除く
+      check.fillScreen(0);
+      raster.add(s.points.data(), (int)s.points.size(), 0xFFFF);
+      raster.flush(check);
+      double covered = 0;
+      for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        for (int x = 0; x < SCREEN_WIDTH; x++) covered += (check.readPixel(x, y) & 0x1F) / 31.0;
+      }
+      coveredSum += covered;
+      areaSum += polygonArea(s.points);
+    }
+
+    printf("%7d %9.1f %12.1f %12.1f %7.2fx %+11.2f%%\n", count, (double)triangles / layouts, aaUs / frames,
+           triUs / frames, triUs / aaUs, 100.0 * (coveredSum - areaSum) / areaSum);
+
+    if (!outDir.empty()) {
+      writePpm(outDir + "/aa_" + std::to_string(count) + ".ppm", aaCanvas);
+      writePpm(outDir + "/tri_" + std::to_string(count) + ".ppm", triCanvas);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,395 @@
+/**
+ * render_export - 記録セッションを並列にオフライン描画する
+ *
+ * 端末の入力記録（-DGLASSDIAL_RECORD_INPUT）を GlassEngine で再生し、
+ * GlassRenderer.h + SoftCanvas で1フレームずつ描画して、
+ * Y4M動画またはPNG連番と、フレームごとのハッシュを書き出す。
+ *
+ * まずシミュレーションだけを先頭から流して区間の境目ごとに GlassEngine を
+ * チェックポイントとして保存し、各ワーカーはそこから途中開始して区間を描画する。
+ * 描画が並列になるので、数百セッションの回帰用コーパスも数分で作り直せる。
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -pthread -Iinclude -Isrc -Itools tools/render_export.cpp src/GlassEngine.cpp src/GlassFluid.cpp -o render_export
+ * 例:
+ *   ./render_export --out corpus session1.log session2.log
+ *   ./render_export --out corpus --format png --from 600 --to 900 session1.log
+ *   ./render_export --out corpus --format none --synthetic 200      # ハッシュのみ
+ *   ./render_export --out corpus --kaleidoscope 1 session1.log      # 万華鏡モードの記録
+ *   ./render_export --out corpus --panes 3 session1.log             # 重ねたガラス3枚
+ *
+ * 出力（セッション名ごと）:
+ *   <name>.y4m または <name>/frame_NNNNNN.png
+ *   <name>.hashes   "フレーム番号 時刻ms State FNV-1a64" の1行/フレーム
+ */
+
+#include "GlassEngine.h"
+#include "GlassGauge.h"
+#include "CircleClear.h"
+#include "GlassRenderer.h"
+#include "Kaleidoscope.h"
+#include "SessionInput.h"
+#include "SoftCanvas.h"
+#include "crack_decals.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ========================================
+// 出力形式
+// ========================================
+enum OutputFormat { FORMAT_Y4M, FORMAT_PNG, FORMAT_NONE };
+
+static uint64_t hashFrame(const SoftCanvas& canvas) {
+  // FNV-1a 64bit（バッファのバイト列そのまま）
+  const uint8_t* p = (const uint8_t*)canvas.getBuffer();
+  size_t n = (size_t)canvas.width() * canvas.height() * 2;
+  uint64_t h = 1469598103934665603ull;
+  for (size_t i = 0; i < n; i++) {
+    h ^= p[i];
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+static void toRgb888(const SoftCanvas& canvas, uint8_t* rgb) {
+  for (int y = 0; y < canvas.height(); y++) {
+    for (int x = 0; x < canvas.width(); x++) {
+      uint16_t c = canvas.readPixel(x, y);
+      *rgb++ = ((c >> 11) & 0x1F) * 255 / 31;
+      *rgb++ = ((c >> 5) & 0x3F) * 255 / 63;
+      *rgb++ = (c & 0x1F) * 255 / 31;
+    }
+  }
+}
+
+// Y4M（C444）の1フレーム: "FRAME\n" + Y/U/V 各プレーン
+static size_t y4mFrameBytes(const SoftCanvas& c) { return 6 + (size_t)c.width() * c.height() * 3; }
+
+static void encodeY4mFrame(const SoftCanvas& canvas, std::vector<uint8_t>& out) {
+  size_t n = (size_t)canvas.width() * canvas.height();
+  out.resize(6 + n * 3);
+  memcpy(out.data(), "FRAME\n", 6);
+  uint8_t* planes = out.data() + 6;
+  std::vector<uint8_t> rgb(n * 3);
+  toRgb888(canvas, rgb.data());
+  for (size_t i = 0; i < n; i++) {
+    int r = rgb[i * 3], g = rgb[i * 3 + 1], b = rgb[i * 3 + 2];
+    planes[i] = (uint8_t)((66 * r + 129 * g + 25 * b + 128) / 256 + 16);
+    planes[n + i] = (uint8_t)((-38 * r - 74 * g + 112 * b + 128) / 256 + 128);
+    planes[n * 2 + i] = (uint8_t)((112 * r - 94 * g - 18 * b + 128) / 256 + 128);
+  }
+}
+
+// 無圧縮（stored deflate）のPNG。依存ライブラリなしで書ける最小形
+static uint32_t crcTable[256];
+
+static void initCrcTable() {
+  for (uint32_t n = 0; n < 256; n++) {
+    uint32_t c = n;
+    for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+    crcTable[n] = c;
+  }
+}
+
+static uint32_t crc32(const uint8_t* p, size_t n, uint32_t crc = 0xFFFFFFFFu) {
+  for (size_t i = 0; i < n; i++) crc = crcTable[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+  return crc;
+}
+
+static void putBe32(std::vector<uint8_t>& v, uint32_t x) {
+  v.push_back(x >> 24); v.push_back(x >> 16); v.push_back(x >> 8); v.push_back(x);
+}
+
+static void putChunk(std::vector<uint8_t>& png, const char* type, const std::vector<uint8_t>& data) {
+  putBe32(png, (uint32_t)data.size());
+  size_t start = png.size();
+  png.insert(png.end(), type, type + 4);
+  png.insert(png.end(), data.begin(), data.end());
+  putBe32(png, crc32(png.data() + start, png.size() - start) ^ 0xFFFFFFFFu);
+}
+
+static bool writePng(const char* path, const SoftCanvas& canvas) {
+  int w = canvas.width(), h = canvas.height();
+  std::vector<uint8_t> raw;
+  std::vector<uint8_t> rgb((size_t)w * h * 3);
+  toRgb888(canvas, rgb.data());
+  for (int y = 0; y < h; y++) {
+    raw.push_back(0);  // フィルタなし
+    raw.insert(raw.end(), rgb.begin() + (size_t)y * w * 3, rgb.begin() + (size_t)(y + 1) * w * 3);
+  }
+
+  std::vector<uint8_t> z = {0x78, 0x01};
+  uint32_t a = 1, b = 0;
+  for (uint8_t c : raw) {
+    a = (a + c) % 65521;
+    b = (b + a) % 65521;
+  }
+  for (size_t pos = 0; pos < raw.size(); pos += 65535) {
+    size_t len = std::min<size_t>(65535, raw.size() - pos);
+    z.push_back(pos + len == raw.size() ? 1 : 0);
+    z.push_back(len & 0xFF); z.push_back(len >> 8);
+    z.push_back(~len & 0xFF); z.push_back((~len >> 8) & 0xFF);
+    z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + len);
+  }
+  putBe32(z, (b << 16) | a);
+
+  std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  std::vector<uint8_t> ihdr;
+  putBe32(ihdr, w);
+  putBe32(ihdr, h);
+  ihdr.insert(ihdr.end(), {8, 2, 0, 0, 0});  // 8bit RGB
+  putChunk(png, "IHDR", ihdr);
+  putChunk(png, "IDAT", z);
+  putChunk(png, "IEND", {});
+
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  fwrite(png.data(), 1, png.size(), f);
+  fclose(f);
+  return true;
+}
+
+// ========================================
+// セッション・区間
+// ========================================
+struct SessionJob {
+  Session session;
+  std::string base;                    // 出力パス（拡張子なし）
+  std::vector<GlassEngine> checkpoints;  // 区間先頭（そのフレームを進める前）の状態
+  std::vector<uint64_t> hashes;
+  std::vector<uint8_t> states;
+  int y4mFd = -1;
+  size_t y4mHeaderBytes = 0;
+  size_t firstFrame = 0, lastFrame = 0;  // 出力範囲 [first, last)
+};
+
+struct SegmentJob {
+  size_t session;
+  size_t segment;
+};
+
+static std::string baseName(const std::string& path) {
+  size_t slash = path.find_last_of('/');
+  std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+  size_t dot = name.find_last_of('.');
+  return dot == std::string::npos || dot == 0 ? name : name.substr(0, dot);
+}
+
+int main(int argc, char** argv) {
+  std::string outDir = "render_out";
+  OutputFormat format = FORMAT_Y4M;
+  size_t segmentFrames = 300;
+  size_t fromFrame = 0, toFrame = (size_t)-1;
+  unsigned threadCount = std::max(1u, std::thread::hardware_concurrency());
+  int syntheticCount = 0;
+  double durationSec = 60;
+  int fps = 60;
+  bool kaleidoscopeMode = false;
+  int paneCount = 1;
+  std::vector<std::string> inputs;
+
+  for (int i = 1; i < argc; i++) {
+    std::string opt = argv[i];
+    if (opt.rfind("--", 0) != 0) {
+      inputs.push_back(opt);
+      continue;
+    }
+    if (i + 1 >= argc) {
+      fprintf(stderr, "missing value for %s\n", opt.c_str());
+      return 1;
+    }
+    const char* val = argv[++i];
+    if (opt == "--out") outDir = val;
+    else if (opt == "--format") {
+      std::string f = val;
+      format = f == "png" ? FORMAT_PNG : (f == "none" ? FORMAT_NONE : FORMAT_Y4M);
+    }
+    else if (opt == "--segment") segmentFrames = std::max(1, atoi(val));
+    else if (opt == "--from") fromFrame = (size_t)atol(val);
+    else if (opt == "--to") toFrame = (size_t)atol(val);
+    else if (opt == "--threads") threadCount = std::max(1, atoi(val));
+    else if (opt == "--synthetic") syntheticCount = atoi(val);
+    else if (opt == "--duration") durationSec = atof(val);
+    else if (opt == "--fps") fps = atoi(val);
+    else if (opt == "--kaleidoscope") kaleidoscopeMode = atoi(val) != 0;
+    else if (opt == "--panes") paneCount = std::max(1, std::min(MAX_PANES, atoi(val)));
+    else {
+      fprintf(stderr, "unknown option %s\n", opt.c_str());
+      return 1;
+    }
+  }
+  if (inputs.empty() && syntheticCount == 0) {
+    fprintf(stderr, "usage: %s [--out DIR] [--format y4m|png|none] [--segment N] [--from F] [--to F]\n"
+                    "       [--threads N] [--synthetic N --duration SEC] [--fps N] [--kaleidoscope 0|1]\n"
+                    "       [--panes N] session.log...\n", argv[0]);
+    return 1;
+  }
+  initCrcTable();
+  mkdir(outDir.c_str(), 0755);
+
+  std::vector<SessionJob> sessions;
+  for (const std::string& path : inputs) {
+    SessionJob job;
+    if (!loadSession(path.c_str(), job.session)) {
+      fprintf(stderr, "%s: no IN records\n", path.c_str());
+      return 1;
+    }
+    job.base = outDir + "/" + baseName(path);
+    sessions.push_back(std::move(job));
+  }
+  for (int i = 0; i < syntheticCount; i++) {
+    SessionJob job;
+    job.session = makeSyntheticSession(i + 1, (unsigned long)(durationSec * 1000), 1000 / fps);
+    char name[32];
+    snprintf(name, sizeof(name), "synthetic_%04d", i + 1);
+    job.base = outDir + "/" + name;
+    sessions.push_back(std::move(job));
+  }
+
+  auto startTime = std::chrono::steady_clock::now();
+
+  // 1) シミュレーションのみの先行実行で区間ごとのチェックポイントを作る（並列）
+  std::vector<SegmentJob> segments;
+  {
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threadCount; t++) {
+      workers.emplace_back([&]() {
+        for (size_t s; (s = next.fetch_add(1)) < sessions.size();) {
+          SessionJob& job = sessions[s];
+          const std::vector<SessionStep>& steps = job.session.steps;
+          GlassConfig config;
+          config.kaleidoscope = kaleidoscopeMode;
+          config.paneCount = paneCount;
+          GlassEngine engine(config, job.session.seed);
+          engine.reset(job.session.startTime);
+          job.firstFrame = std::min(fromFrame, steps.size());
+          job.lastFrame = std::min(toFrame, steps.size());
+          for (size_t f = 0; f < job.lastFrame; f++) {
+            if (f % segmentFrames == 0) job.checkpoints.push_back(engine);
+            engine.step(steps[f].input, steps[f].time);
+          }
+          job.hashes.assign(job.lastFrame, 0);
+          job.states.assign(job.lastFrame, 0);
+        }
+      });
+    }
+    for (auto& w : workers) w.join();
+  }
+
+  size_t totalFrames = 0;
+  for (size_t s = 0; s < sessions.size(); s++) {
+    SessionJob& job = sessions[s];
+    if (job.firstFrame >= job.lastFrame) continue;
+    totalFrames += job.lastFrame - job.firstFrame;
+    for (size_t seg = job.firstFrame / segmentFrames; seg < job.checkpoints.size(); seg++) {
+      segments.push_back({s, seg});
+    }
+
+    if (format == FORMAT_Y4M) {
+      // 全フレームの位置が決まっているので、各ワーカーが pwrite で直接書ける
+      std::string path = job.base + ".y4m";
+      job.y4mFd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if (job.y4mFd < 0) {
+        perror(path.c_str());
+        return 1;
+      }
+      char header[64];
+      int n = snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n",
+                       SCREEN_WIDTH, SCREEN_HEIGHT, fps);
+      if (write(job.y4mFd, header, n) != n) return 1;
+      job.y4mHeaderBytes = n;
+    } else if (format == FORMAT_PNG) {
+      mkdir(job.base.c_str(), 0755);
+    }
+  }
+
+  // 2) 区間ごとにチェックポイントから再開して描画
+  {
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threadCount; t++) {
+      workers.emplace_back([&]() {
+        SoftCanvas canvas;
+        GlassGauge gauge;
+        DustField dust(GLASS_DUST_RADIUS);
+        DecalLayer decals(CRACK_DECALS, GLASS_CLEAR_RADIUS);
+        KaleidoscopeMirror mirror(GLASS_CLEAR_RADIUS);
+        PaneStack panes(GLASS_CLEAR_RADIUS);
+        CircleClear clear(GLASS_CLEAR_RADIUS, 32);   // 端末と同じ分け方（DMA の代わりに memcpy）
+        std::vector<uint16_t> zeros(CircleClear::zeroBytes() / sizeof(uint16_t), 0);
+        std::vector<uint8_t> frameBytes;
+        for (size_t k; (k = next.fetch_add(1)) < segments.size();) {
+          SessionJob& job = sessions[segments[k].session];
+          const std::vector<SessionStep>& steps = job.session.steps;
+          GlassEngine engine = job.checkpoints[segments[k].segment];
+          size_t begin = segments[k].segment * segmentFrames;
+          size_t end = std::min(begin + segmentFrames, job.lastFrame);
+          gauge.invalidate(); // 区間の先頭で縁を描き直す（前の区間の弧が残っている）
+          panes.invalidate();
+
+          for (size_t f = begin; f < end; f++) {
+            engine.step(steps[f].input, steps[f].time);
+            if (f < job.firstFrame) continue;
+
+            dust.prepare(engine);
+            clear.issue(canvas.getBuffer(), SCREEN_WIDTH,
+                        [&](uint16_t* dst, size_t bytes) { memcpy(dst, zeros.data(), bytes); });
+            clear.finish(canvas.getBuffer(), SCREEN_WIDTH);
+            renderGlass(canvas, engine, steps[f].time, &dust, &decals, &panes, true);
+            if (kaleidoscopeMode) mirror.apply(canvas);
+            gauge.update(canvas, engine.destructionLevel);
+            job.hashes[f] = hashFrame(canvas);
+            job.states[f] = (uint8_t)engine.currentState;
+
+            size_t index = f - job.firstFrame;
+            if (format == FORMAT_Y4M) {
+              encodeY4mFrame(canvas, frameBytes);
+              off_t offset = job.y4mHeaderBytes + index * y4mFrameBytes(canvas);
+              if (pwrite(job.y4mFd, frameBytes.data(), frameBytes.size(), offset) < 0) perror("pwrite");
+            } else if (format == FORMAT_PNG) {
+              char path[512];
+              snprintf(path, sizeof(path), "%s/frame_%06zu.png", job.base.c_str(), f);
+              if (!writePng(path, canvas)) perror(path);
+            }
+          }
+        }
+      });
+    }
+    for (auto& w : workers) w.join();
+  }
+
+  // 3) ハッシュ一覧
+  for (SessionJob& job : sessions) {
+    if (job.y4mFd >= 0) close(job.y4mFd);
+    std::string path = job.base + ".hashes";
+    FILE* f = fopen(path.c_str(), "w");
+    if (!f) {
+      perror(path.c_str());
+      continue;
+    }
+    for (size_t i = job.firstFrame; i < job.lastFrame; i++) {
+      fprintf(f, "%zu %lu %d %016llx\n", i, job.session.steps[i].time, job.states[i],
+              (unsigned long long)job.hashes[i]);
+    }
+    fclose(f);
+  }
+
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+  fprintf(stderr, "%zu sessions, %zu frames in %zu segments on %u threads: %.2f s (%.0f frames/s)\n",
+          sessions.size(), totalFrames, segments.size(), threadCount, elapsed,
+          elapsed > 0 ? totalFrames / elapsed : 0.0);
+  return 0;
+}
@@ -0,0 +1,178 @@
+/**
+ * resample_bench - SampleVoice の再標本化の品質（折り返し）とコストの計測
+ *
+ * 品質: 正弦波を音素材にして音程比ごとに SamplePlayer::resample で鳴らし、
+ *   snr    出力と理想の正弦波（周波数 × 音程比、解析的に計算）との比 [dB]
+ *   alias  音程を上げるとナイキストを超える正弦波を鳴らしたときの出力の大きさ
+ *          （理想は無音）[dB、入力比]
+ * を、比較用の線形補間と並べて表示する。
+ *
+ * コスト: 生成したガラス音（src/glass_sample.h）を --voices 個、ばらばらの音程で
+ * 鳴らし続け、GRAIN_BLOCK_SAMPLES ごとの render() の時間を測る。
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -Iinclude -Isrc -Itools tools/resample_bench.cpp src/SampleVoice.cpp src/GrainSynth.cpp src/GlassEngine.cpp src/GlassFluid.cpp -o resample_bench
+ * 例:
+ *   ./resample_bench
+ *   ./resample_bench --voices 24 --seconds 10
+ */
+
+#include "SampleVoice.h"
+#include "glass_sample.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+const double AMPLITUDE = 0.5;
+const int SKIP = 64;   // 端の過渡を除く出力サンプル数
+
+// 前後に RESAMPLE_PAD 個の 0 を持つ正弦波の音素材
+static std::vector<int16_t> makeSine(double freq, int length) {
+  std::vector<int16_t> data(length + 2 * RESAMPLE_PAD, 0);
+  for (int i = 0; i < length; i++) {
+    data[RESAMPLE_PAD + i] = (int16_t)lrint(AMPLITUDE * 32767.0 * sin(2 * M_PI * freq * i / GRAIN_SAMPLE_RATE));
+  }
+  return data;
+}
+
+// 比較用: 線形補間
+static void linearResample(const SampleClip& clip, uint32_t step, std::vector<int32_t>& out) {
+  const int16_t* x = clip.data + RESAMPLE_PAD;
+  uint32_t pos = 0;
+  for (size_t i = 0; i < out.size(); i++, pos += step) {
+    uint32_t n = pos >> 16;
+    int32_t frac = pos & 0xFFFF;
+    out[i] = x[n] + (((x[n + 1] - x[n]) * frac) >> 16);
+  }
+}
+
+struct Quality {
+  double snr;     // dB
+  double level;   // 入力比 dB
+};
+
+// out と理想の正弦波（振幅 AMPLITUDE、周波数 freq * ratio）を比べる
+static Quality measure(const std::vector<int32_t>& out, double freq, double ratio) {
+  double signal = 0, error = 0, power = 0;
+  int n = 0;
+  for (size_t i = SKIP; i + SKIP < out.size(); i++) {
+    double ideal = AMPLITUDE * 32767.0 * sin(2 * M_PI * freq * (i * ratio) / GRAIN_SAMPLE_RATE);
+    double e = out[i] - ideal;
+    signal += ideal * ideal;
+    error += e * e;
+    power += (double)out[i] * out[i];
+    n++;
+  }
+  double input = AMPLITUDE * 32767.0 * AMPLITUDE * 32767.0 / 2.0 * n;
+  Quality q;
+  q.snr = 10.0 * log10(signal / (error + 1e-9));
+  q.level = 10.0 * log10(power / input + 1e-12);
+  return q;
+}
+
+int main(int argc, char** argv) {
+  int voiceCount = SAMPLE_MAX_VOICES;
+  double seconds = 5.0;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string opt = argv[i];
+    if (opt == "--voices") voiceCount = atoi(argv[i + 1]);
+    else if (opt == "--seconds") seconds = atof(argv[i + 1]);
+    else {
+      fprintf(stderr, "usage: %s [--voices N] [--seconds S]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  // ========================================
+  // 品質
+  // ========================================
+  const double ratios[] = {0.125, 0.5, 0.8, 1.0, 1.2, 1.45, 1.7, 2.0};
+  const int inputLength = GRAIN_SAMPLE_RATE;
+  printf("%-6s %4s %8s %-22s %-22s\n", "ratio", "taps", "pass Hz", "in-band snr dB", "alias dB (ideal -inf)");
+  printf("%-6s %4s %8s %-22s %-22s\n", "", "", "(output)", "polyphase / linear", "polyphase / linear");
+  for (double ratio : ratios) {
+    int band = SamplePlayer::bandFor((float)ratio);
+    uint32_t step = (uint32_t)(ratio * 65536.0 + 0.5);
+    double actual = step / 65536.0;
+    int outLength = (int)((inputLength - 2) / actual);
+
+    // 帯域の通過域（入力で 0.3 * 標本化周波数 / 帯域の音程比の上限）に収まる正弦波の最悪の SNR
+    const double passband = GRAIN_SAMPLE_RATE * 0.3 / std::max(1.0f, RESAMPLE_BAND_RATIO[band]);
+    double snrPoly = 1e9, snrLinear = 1e9;
+    for (double f = 500; f < passband; f *= 1.25) {
+      std::vector<int16_t> sine = makeSine(f, inputLength);
+      SampleClip clip = {sine.data(), inputLength, 1.0f};
+      std::vector<int32_t> out(outLength, 0);
+      uint32_t pos = 0;
+      SamplePlayer::resample(clip, band, pos, step, 32767, out.data(), outLength);
+      snrPoly = std::min(snrPoly, measure(out, f, actual).snr);
+      linearResample(clip, step, out);
+      snrLinear = std::min(snrLinear, measure(out, f, actual).snr);
+    }
+
+    // 出力でナイキストを超える正弦波の最大の漏れ
+    double aliasPoly = -1e9, aliasLinear = -1e9;
+    bool anyAlias = false;
+    for (double f = GRAIN_SAMPLE_RATE * 0.55 / actual; f < GRAIN_SAMPLE_RATE * 0.45; f *= 1.1) {
+      anyAlias = true;
+      std::vector<int16_t> sine = makeSine(f, inputLength);
+      SampleClip clip = {sine.data(), inputLength, 1.0f};
+      std::vector<int32_t> out(outLength, 0);
+      uint32_t pos = 0;
+      SamplePlayer::resample(clip, band, pos, step, 32767, out.data(), outLength);
+      aliasPoly = std::max(aliasPoly, measure(out, f, actual).level);
+      linearResample(clip, step, out);
+      aliasLinear = std::max(aliasLinear, measure(out, f, actual).level);
+    }
+
+    char snrText[32], aliasText[32];
+    snprintf(snrText, sizeof(snrText), "%6.1f / %6.1f", snrPoly, snrLinear);
+    if (anyAlias) snprintf(aliasText, sizeof(aliasText), "%6.1f / %6.1f", aliasPoly, aliasLinear);
+    else snprintf(aliasText, sizeof(aliasText), "   -");
+    printf("%-6.3f %4d %8.0f %-22s %-22s\n", ratio, RESAMPLE_TAPS[band], std::min(passband * actual, GRAIN_SAMPLE_RATE * 0.3),
+           snrText, aliasText);
+  }
+
+  // ========================================
+  // コスト
+  // ========================================
+  SamplePlayer player(GLASS_SAMPLE);
+  GlassRandom rng(11);
+  std::vector<int16_t> block(GRAIN_BLOCK_SAMPLES);
+  const int blocks = (int)(seconds * GRAIN_SAMPLE_RATE / GRAIN_BLOCK_SAMPLES);
+  double renderUs = 0;
+  std::vector<double> blockUs;
+  long voiceSamples = 0;
+  for (int b = 0; b < blocks; b++) {
+    // 止まった声を補充して、常に voiceCount 個鳴らす
+    while (player.activeVoices() < voiceCount && player.activeVoices() < SAMPLE_MAX_VOICES) {
+      GrainRequest g = {};
+      g.frequency = GLASS_SAMPLE_PITCH * rng.uniformFloat(0.25f, 2.0f);
+      g.amplitude = 0.1f;
+      player.startAt(g, 0);
+    }
+    voiceSamples += (long)player.activeVoices() * GRAIN_BLOCK_SAMPLES;
+    std::fill(block.begin(), block.end(), 0);
+    auto t0 = std::chrono::steady_clock::now();
+    player.render(block.data(), GRAIN_BLOCK_SAMPLES);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    renderUs += us;
+    blockUs.push_back(us);
+  }
+  std::sort(blockUs.begin(), blockUs.end());
+  const double budgetUs = GRAIN_BLOCK_SAMPLES * 1e6 / GRAIN_SAMPLE_RATE;
+  printf("\n%d voices: %.1f us/block avg, %.1f us p99 (%.2f%% of a %.0f us block), %.1f ns/voice-sample\n",
+         voiceCount, renderUs / blocks, blockUs[blockUs.size() * 99 / 100], 100.0 * renderUs / blocks / budgetUs,
+         budgetUs, renderUs * 1000.0 / voiceSamples);
+  int totalTaps = 0;
+  for (int b = 0; b < RESAMPLE_BANDS; b++) totalTaps += RESAMPLE_TAPS[b];
+  printf("sample %d samples (%d bytes flash), tables %d phases x %d bands (%d bytes flash)\n",
+         GLASS_SAMPLE_LENGTH, (int)sizeof(GLASS_SAMPLE_DATA), RESAMPLE_PHASES, RESAMPLE_BANDS,
+         (int)((RESAMPLE_PHASES + 1) * totalTaps * sizeof(int16_t)));
+  return 0;
+}
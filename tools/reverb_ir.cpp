@@ -0,0 +1,171 @@
+/**
+ * reverb_ir - GlassReverb のインパルス応答の書き出しと計測
+ *
+ * 端末の音声タスクと同じ GRAIN_BLOCK_SAMPLES ずつ GlassReverb に通して、
+ *   ir.wav      インパルス（1サンプル）への応答
+ *   grains.wav  粉砕の粒（GrainMixer）に響きをつけた音
+ * を書き出し、次を表示する。
+ *   RT60    ノイズの断続（50ms）を入れ、止めたあとの減衰の Schroeder 積分から
+ *           求めた残響時間（-5〜-25dB の傾き、T20）。遅延線は int16 なので、
+ *           インパルス1つでは減衰の途中で量子化の底に届いてしまう
+ *   tail    響きが止まる（ringing() が false になる）までの時間
+ *   cost    1ブロックの処理時間（このマシン）と実時間に対する割合
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -Iinclude -Itools tools/reverb_ir.cpp src/GlassReverb.cpp src/GrainSynth.cpp src/GlassEngine.cpp src/GlassFluid.cpp -o reverb_ir
+ * 例:
+ *   ./reverb_ir
+ *   ./reverb_ir --out reverb --seconds 4
+ */
+
+#include "GlassReverb.h"
+#include "GrainSynth.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+
+static bool writeWav(const std::string& path, const std::vector<int16_t>& samples) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return false;
+  uint32_t dataBytes = (uint32_t)(samples.size() * sizeof(int16_t));
+  uint32_t riffBytes = 36 + dataBytes;
+  uint32_t fmtBytes = 16;
+  uint16_t format = 1, channels = 1, bits = 16, blockAlign = 2;
+  uint32_t rate = GRAIN_SAMPLE_RATE, byteRate = GRAIN_SAMPLE_RATE * 2;
+  fwrite("RIFF", 1, 4, f);
+  fwrite(&riffBytes, 4, 1, f);
+  fwrite("WAVEfmt ", 1, 8, f);
+  fwrite(&fmtBytes, 4, 1, f);
+  fwrite(&format, 2, 1, f);
+  fwrite(&channels, 2, 1, f);
+  fwrite(&rate, 4, 1, f);
+  fwrite(&byteRate, 4, 1, f);
+  fwrite(&blockAlign, 2, 1, f);
+  fwrite(&bits, 2, 1, f);
+  fwrite("data", 1, 4, f);
+  fwrite(&dataBytes, 4, 1, f);
+  fwrite(samples.data(), sizeof(int16_t), samples.size(), f);
+  fclose(f);
+  return true;
+}
+
+// Schroeder の後ろ向き積分から -5dB〜-25dB の傾きで RT60 を求める（T20）
+static double measureRt60(const std::vector<int16_t>& ir, int skip) {
+  std::vector<double> energy(ir.size() + 1, 0.0);
+  for (size_t i = ir.size(); i-- > (size_t)skip;) energy[i] = energy[i + 1] + (double)ir[i] * ir[i];
+  double total = energy[skip];
+  if (total <= 0) return 0.0;
+
+  // -5dB〜-25dB の区間で最小二乗の直線
+  double sx = 0, sy = 0, sxx = 0, sxy = 0;
+  int n = 0;
+  for (size_t i = skip; i < ir.size(); i++) {
+    if (energy[i] <= 0) break;
+    double db = 10.0 * log10(energy[i] / total);
+    if (db > -5.0) continue;
+    if (db < -25.0) break;
+    double t = (double)(i - skip) / GRAIN_SAMPLE_RATE;
+    sx += t;
+    sy += db;
+    sxx += t * t;
+    sxy += t * db;
+    n++;
+  }
+  if (n < 2) return 0.0;
+  double slope = (n * sxy - sx * sy) / (n * sxx - sx * sx);  // dB/s
+  return slope < 0 ? -60.0 / slope : 0.0;
+}
+
+int main(int argc, char** argv) {
+  std::string outDir = "reverb_out";
+  double seconds = 3.0;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string opt = argv[i];
+    if (opt == "--out") outDir = argv[i + 1];
+    else if (opt == "--seconds") seconds = atof(argv[i + 1]);
+    else {
+      fprintf(stderr, "usage: %s [--out DIR] [--seconds S]\n", argv[0]);
+      return 1;
+    }
+  }
+  mkdir(outDir.c_str(), 0755);
+
+  const int blocks = (int)(seconds * GRAIN_SAMPLE_RATE / GRAIN_BLOCK_SAMPLES);
+  std::vector<int16_t> storage(GlassReverb::storageSamples());
+  GlassReverb reverb;
+  reverb.begin(storage.data());
+
+  // ========================================
+  // インパルス応答
+  // ========================================
+  std::vector<int16_t> ir(blocks * GRAIN_BLOCK_SAMPLES, 0);
+  ir[0] = 16384;
+  int tailBlocks = blocks;
+  double processUs = 0;
+  int processed = 0;
+  for (int b = 0; b < blocks; b++) {
+    auto t0 = std::chrono::steady_clock::now();
+    reverb.process(ir.data() + b * GRAIN_BLOCK_SAMPLES, GRAIN_BLOCK_SAMPLES);
+    auto t1 = std::chrono::steady_clock::now();
+    if (reverb.ringing()) {
+      processUs += std::chrono::duration<double, std::micro>(t1 - t0).count();
+      processed++;
+    } else if (tailBlocks == blocks) {
+      tailBlocks = b + 1;
+    }
+  }
+  writeWav(outDir + "/ir.wav", ir);
+
+  // ========================================
+  // 断続ノイズの減衰（RT60 の計測）
+  // ========================================
+  reverb.clear();
+  GlassRandom noise(1);
+  const int burst = GRAIN_SAMPLE_RATE / 20;
+  std::vector<int16_t> decay(blocks * GRAIN_BLOCK_SAMPLES, 0);
+  for (int i = 0; i < burst && i < (int)decay.size(); i++) decay[i] = (int16_t)noise.uniform(-8000, 8001);
+  for (int b = 0; b < blocks; b++) reverb.process(decay.data() + b * GRAIN_BLOCK_SAMPLES, GRAIN_BLOCK_SAMPLES);
+
+  // ========================================
+  // 粉砕の粒 + 響き
+  // ========================================
+  reverb.clear();
+  GrainMixer mixer;
+  GlassRandom rng(7);
+  std::vector<int16_t> grains(blocks * GRAIN_BLOCK_SAMPLES, 0);
+  for (int b = 0; b < blocks; b++) {
+    // 最初の 0.3 秒に、端末の上限（GRAIN_RATE_PER_SEC）程度の粒を散らす
+    if (b * GRAIN_BLOCK_SAMPLES < GRAIN_SAMPLE_RATE * 3 / 10 && b % 2 == 0) {
+      GrainRequest g = {};
+      float size = rng.uniformFloat(0.5f, 6.0f);
+      g.frequency = 6600.0f / (size + 0.5f);
+      g.amplitude = rng.uniformFloat(0.2f, 0.8f);
+      g.decay = 0.02f + 0.03f * size;
+      mixer.startAt(g, rng.uniform(0, GRAIN_BLOCK_SAMPLES));
+    }
+    int16_t* block = grains.data() + b * GRAIN_BLOCK_SAMPLES;
+    mixer.render(block, GRAIN_BLOCK_SAMPLES);
+    reverb.process(block, GRAIN_BLOCK_SAMPLES);
+  }
+  writeWav(outDir + "/grains.wav", grains);
+
+  // ========================================
+  // 結果
+  // ========================================
+  const double blockUs = GRAIN_BLOCK_SAMPLES * 1e6 / GRAIN_SAMPLE_RATE;
+  double perBlock = processed ? processUs / processed : 0.0;
+  printf("lines %d, delay storage %d samples (%d bytes), RT60 target %.2f s (lows; damping shortens the highs)\n", REVERB_LINES,
+         GlassReverb::storageSamples(), (int)(GlassReverb::storageSamples() * sizeof(int16_t)), REVERB_RT60);
+  printf("RT60 measured (T20) %.2f s, impulse tail stops after %.2f s\n", measureRt60(decay, burst),
+         tailBlocks * blockUs / 1e6);
+  printf("cost %.1f us/block on this host (%.2f%% of real time, %.1f us block)\n", perBlock,
+         100.0 * perBlock / blockUs, blockUs);
+  printf("wrote %s/ir.wav and %s/grains.wav\n", outDir.c_str(), outDir.c_str());
+  return 0;
+}
@@ -0,0 +1,306 @@
+/**
+ * trace_export - GlassDial のスケジューリングの記録（TaskTrace.h）をタイムラインにする
+ *
+ * -DGLASSDIAL_TRACE の端末のシリアルログから "TR," の書き出しを読み、
+ *   - Chrome のトレース形式（JSON）に書き出す。chrome://tracing か https://ui.perfetto.dev で開くと、
+ *     コアごとの実行中のタスク・記録した割り込み・描画フレームが同じ時間軸に並ぶ
+ *   - フレームごとに描画タスクから奪われた時間（端末と同じ traceSteal）を集計し、
+ *     平均・p95・最大と、奪われた時間の多いフレームの一覧を表示する
+ *   - 記録の範囲でのタスクごとの実行時間（コアごと）を表示する
+ * ログに書き出しが複数あれば最後のものを使う（--dump N で N 番目、0 から）。
+ *
+ * ビルド:
+ *   g++ -O2 -std=c++17 -Iinclude tools/trace_export.cpp -o trace_export
+ * 例:
+ *   ./trace_export dial_log.txt trace.json
+ *   ./trace_export dial_log.txt trace.json --dump 0 --top 20
+ */
+
+#include "TaskTrace.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct TraceDump {
+  uint32_t sampleMicros = 0;
+  std::map<int, std::string> tasks;
+  std::map<int, std::string> isrs;
+  int renderTask = -1;
+  std::vector<TraceEvent> events;
+};
+
+static std::vector<std::string> split(const std::string& line) {
+  std::vector<std::string> fields;
+  std::stringstream ss(line);
+  std::string field;
+  while (std::getline(ss, field, ',')) fields.push_back(field);
+  return fields;
+}
+
+static bool readDumps(std::istream& in, std::vector<TraceDump>& dumps) {
+  std::string line;
+  bool inside = false;
+  while (std::getline(in, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.compare(0, 3, "TR,") != 0) continue;
+    std::vector<std::string> f = split(line);
+    const std::string& kind = f[1];
+    if (kind == "BEGIN" && f.size() >= 4) {
+      dumps.emplace_back();
+      dumps.back().sampleMicros = (uint32_t)strtoul(f[2].c_str(), nullptr, 10);
+      dumps.back().events.reserve(strtoul(f[3].c_str(), nullptr, 10));
+      inside = true;
+    } else if (!inside) {
+      continue;
+    } else if (kind == "TASK" && f.size() >= 4) {
+      dumps.back().tasks[atoi(f[2].c_str())] = f[3];
+    } else if (kind == "ISR" && f.size() >= 4) {
+      dumps.back().isrs[atoi(f[2].c_str())] = f[3];
+    } else if (kind == "RENDER" && f.size() >= 3) {
+      dumps.back().renderTask = atoi(f[2].c_str());
+    } else if (kind == "E" && f.size() >= 6) {
+      TraceEvent e;
+      e.micros = (uint32_t)strtoul(f[2].c_str(), nullptr, 10);
+      e.type = (uint8_t)atoi(f[3].c_str());
+      e.core = (uint8_t)atoi(f[4].c_str());
+      e.id = (uint16_t)atoi(f[5].c_str());
+      if (e.type < TRACE_EVENT_TYPES && e.core < TRACE_CORES) dumps.back().events.push_back(e);
+    } else if (kind == "END") {
+      inside = false;
+    }
+  }
+  return !dumps.empty();
+}
+
+static std::string nameOf(const std::map<int, std::string>& names, int id) {
+  auto it = names.find(id);
+  return it != names.end() ? it->second : "#" + std::to_string(id);
+}
+
+// JSON の文字列（タスク名に使える文字は限られるが、念のため " と \ を逃がす）
+static std::string quoted(const std::string& s) {
+  std::string out = "\"";
+  for (char c : s) {
+    if (c == '"' || c == '\\') out += '\\';
+    out += c;
+  }
+  return out + "\"";
+}
+
+// ========================================
+// Chrome のトレース形式
+// ========================================
+// pid 0 の中で、tid = コア（タスク）、10 + コア（割り込み）、100（フレーム）
+static void writeChromeTrace(FILE* out, const TraceDump& dump) {
+  const std::vector<TraceEvent>& ev = dump.events;
+  uint32_t origin = ev.front().micros;
+  auto ts = [&](uint32_t micros) { return (double)(uint32_t)(micros - origin); };
+  bool first = true;
+  auto emit = [&](const std::string& json) {
+    fprintf(out, "%s\n  %s", first ? "" : ",", json.c_str());
+    first = false;
+  };
+  auto complete = [&](const std::string& name, int tid, uint32_t start, uint32_t end, const std::string& args) {
+    char buf[160];
+    snprintf(buf, sizeof(buf), "\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.0f,\"dur\":%.0f", tid, ts(start),
+             (double)(uint32_t)(end - start));
+    emit("{\"name\":" + quoted(name) + "," + buf + (args.empty() ? "" : ",\"args\":{" + args + "}") + "}");
+  };
+
+  fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  for (int core = 0; core < TRACE_CORES; core++) {
+    emit("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" + std::to_string(core) +
+         ",\"args\":{\"name\":\"core " + std::to_string(core) + "\"}}");
+    emit("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" + std::to_string(10 + core) +
+         ",\"args\":{\"name\":\"core " + std::to_string(core) + " ISR\"}}");
+  }
+  emit("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":100,\"args\":{\"name\":\"frames\"}}");
+
+  int running[TRACE_CORES] = {-1, -1};
+  uint32_t runStart[TRACE_CORES] = {origin, origin};
+  std::vector<uint32_t> isrStart[TRACE_CORES];
+  std::map<uint16_t, uint32_t> frameStart;
+  for (size_t i = 0; i < ev.size(); i++) {
+    const TraceEvent& e = ev[i];
+    switch (e.type) {
+      case TRACE_RUN:
+        if (running[e.core] >= 0) complete(nameOf(dump.tasks, running[e.core]), e.core, runStart[e.core], e.micros, "");
+        running[e.core] = e.id;
+        runStart[e.core] = e.micros;
+        break;
+      case TRACE_ISR_ENTER:
+        isrStart[e.core].push_back(e.micros);
+        break;
+      case TRACE_ISR_EXIT:
+        if (!isrStart[e.core].empty()) {
+          complete(nameOf(dump.isrs, e.id), 10 + e.core, isrStart[e.core].back(), e.micros, "");
+          isrStart[e.core].pop_back();
+        }
+        break;
+      case TRACE_FRAME_BEGIN:
+        frameStart[e.id] = (uint32_t)i;
+        break;
+      case TRACE_FRAME_END: {
+        auto it = frameStart.find(e.id);
+        if (it == frameStart.end()) break;
+        TraceSteal steal = traceSteal(&ev[it->second], i - it->second + 1, e.core, dump.renderTask);
+        std::string args = "\"stolen_us\":" + std::to_string(steal.stolenMicros) +
+                           ",\"isr_us\":" + std::to_string(steal.isrMicros) +
+                           ",\"preemptions\":" + std::to_string(steal.preemptions);
+        if (steal.topTask >= 0) args += ",\"top\":" + quoted(nameOf(dump.tasks, steal.topTask));
+        complete("frame " + std::to_string(e.id), 100, ev[it->second].micros, e.micros, args);
+        frameStart.erase(it);
+        break;
+      }
+    }
+  }
+  for (int core = 0; core < TRACE_CORES; core++) {
+    if (running[core] >= 0) complete(nameOf(dump.tasks, running[core]), core, runStart[core], ev.back().micros, "");
+  }
+  fprintf(out, "\n]}\n");
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s <log|-> <out.json> [--dump N] [--top N]\n", argv[0]);
+    return 1;
+  }
+  int dumpIndex = -1;
+  int top = 10;
+  for (int i = 3; i + 1 < argc; i += 2) {
+    std::string opt = argv[i];
+    if (opt == "--dump") dumpIndex = atoi(argv[i + 1]);
+    else if (opt == "--top") top = atoi(argv[i + 1]);
+    else {
+      fprintf(stderr, "unknown option %s\n", opt.c_str());
+      return 1;
+    }
+  }
+
+  std::vector<TraceDump> dumps;
+  std::ifstream file;
+  if (std::string(argv[1]) != "-") {
+    file.open(argv[1]);
+    if (!file) {
+      perror(argv[1]);
+      return 1;
+    }
+  }
+  if (!readDumps(file.is_open() ? file : std::cin, dumps)) {
+    fprintf(stderr, "no TR,BEGIN ... TR,END block in %s\n", argv[1]);
+    return 1;
+  }
+  if (dumpIndex < 0) dumpIndex = (int)dumps.size() - 1;
+  if (dumpIndex >= (int)dumps.size()) {
+    fprintf(stderr, "only %zu dumps in the log\n", dumps.size());
+    return 1;
+  }
+  const TraceDump& dump = dumps[dumpIndex];
+  if (dump.events.empty()) {
+    fprintf(stderr, "dump %d is empty\n", dumpIndex);
+    return 1;
+  }
+
+  FILE* out = fopen(argv[2], "w");
+  if (!out) {
+    perror(argv[2]);
+    return 1;
+  }
+  writeChromeTrace(out, dump);
+  fclose(out);
+
+  const std::vector<TraceEvent>& ev = dump.events;
+  double spanMs = (uint32_t)(ev.back().micros - ev.front().micros) / 1000.0;
+  printf("dump %d of %zu: %zu events over %.1f ms, sampled every %u us, render task %s\n", dumpIndex, dumps.size(),
+         ev.size(), spanMs, dump.sampleMicros, nameOf(dump.tasks, dump.renderTask).c_str());
+
+  // ========================================
+  // フレームごとの奪われた時間
+  // ========================================
+  struct FrameRow {
+    uint16_t frame;
+    TraceSteal steal;
+  };
+  std::vector<FrameRow> frames;
+  std::map<uint16_t, size_t> open;
+  std::map<int, uint64_t> thieves;   // タスクごとの「いちばん奪ったタスク」になった時間
+  for (size_t i = 0; i < ev.size(); i++) {
+    if (ev[i].type == TRACE_FRAME_BEGIN) open[ev[i].id] = i;
+    if (ev[i].type != TRACE_FRAME_END) continue;
+    auto it = open.find(ev[i].id);
+    if (it == open.end()) continue;
+    TraceSteal steal = traceSteal(&ev[it->second], i - it->second + 1, ev[i].core, dump.renderTask);
+    frames.push_back({ev[i].id, steal});
+    if (steal.topTask >= 0) thieves[steal.topTask] += steal.topMicros;
+    open.erase(it);
+  }
+  if (!frames.empty()) {
+    std::vector<uint32_t> stolen;
+    uint64_t stolenSum = 0, isrSum = 0, frameSum = 0, preemptions = 0;
+    for (const FrameRow& r : frames) {
+      stolen.push_back(r.steal.stolenMicros);
+      stolenSum += r.steal.stolenMicros;
+      isrSum += r.steal.isrMicros;
+      frameSum += r.steal.frameMicros;
+      preemptions += r.steal.preemptions;
+    }
+    std::sort(stolen.begin(), stolen.end());
+    size_t n = frames.size();
+    printf("\n%zu frames: %.0f us/frame, stolen avg %.0f us (isr %.0f us), p95 %u us, max %u us, "
+           "%.2f preemptions/frame\n",
+           n, (double)frameSum / n, (double)stolenSum / n, (double)isrSum / n, stolen[n * 95 / 100], stolen.back(),
+           (double)preemptions / n);
+
+    printf("\nstolen by (as the top thief of a frame):\n");
+    std::vector<std::pair<uint64_t, int>> ranked;
+    for (const auto& t : thieves) ranked.push_back({t.second, t.first});
+    std::sort(ranked.rbegin(), ranked.rend());
+    for (const auto& t : ranked) {
+      printf("  %-16s %8.1f ms\n", nameOf(dump.tasks, t.second).c_str(), t.first / 1000.0);
+    }
+
+    std::vector<FrameRow> worst = frames;
+    std::sort(worst.begin(), worst.end(),
+              [](const FrameRow& a, const FrameRow& b) { return a.steal.stolenMicros > b.steal.stolenMicros; });
+    printf("\n%-7s %9s %9s %7s %6s  %s\n", "frame", "frame us", "stolen us", "isr us", "preempt", "top");
+    for (int i = 0; i < top && i < (int)worst.size(); i++) {
+      const TraceSteal& s = worst[i].steal;
+      printf("%-7u %9u %9u %7u %6d  %s %u us\n", worst[i].frame, s.frameMicros, s.stolenMicros, s.isrMicros,
+             s.preemptions, s.topTask >= 0 ? nameOf(dump.tasks, s.topTask).c_str() : "-", s.topMicros);
+    }
+  }
+
+  // ========================================
+  // タスクごとの実行時間
+  // ========================================
+  std::map<int, uint64_t> runMicros[TRACE_CORES];
+  int running[TRACE_CORES] = {-1, -1};
+  uint32_t since[TRACE_CORES] = {0, 0};
+  for (const TraceEvent& e : ev) {
+    if (e.type != TRACE_RUN) continue;
+    if (running[e.core] >= 0) runMicros[e.core][running[e.core]] += (uint32_t)(e.micros - since[e.core]);
+    running[e.core] = e.id;
+    since[e.core] = e.micros;
+  }
+  printf("\nrun time over the dump:\n");
+  for (int core = 0; core < TRACE_CORES; core++) {
+    uint64_t total = 0;
+    for (const auto& t : runMicros[core]) total += t.second;
+    if (total == 0) continue;
+    printf("  core %d:", core);
+    for (const auto& t : runMicros[core]) {
+      printf(" %s %.1f%%", nameOf(dump.tasks, t.first).c_str(), t.second * 100.0 / total);
+    }
+    printf("\n");
+  }
+  printf("\nwrote %s\n", argv[2]);
+  return 0;
+}